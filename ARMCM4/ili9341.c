@@ -20,6 +20,9 @@
  * @note    Does not support multiple calling threads natively.
  */
 
+#include <stddef.h>
+#include <string.h>
+
 #include "ch.h"
 #include "hal.h"
 #include "ili9341.h"
@@ -77,6 +80,161 @@ ILI9341Driver ILI9341D1;
 /* Driver local functions.                                                   */
 /*===========================================================================*/
 
+#if ILI9341_USE_COMMAND_LISTS || defined(__DOXYGEN__)
+
+/**
+ * @brief   Appends bytes to a command list.
+ * @details The bytes are added to the last run if it is of the same kind and
+ *          ends where they start, otherwise a new run is allocated.
+ *
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] kind      run kind
+ * @param[in] datap     bytes, already in place
+ * @param[in] length    bytes count
+ *
+ * @notapi
+ */
+static void ili9341_list_append(ILI9341List *listp, uint8_t kind,
+                                const uint8_t *datap, size_t length) {
+
+  ILI9341Run *runp;
+
+  while (length > 0) {
+    size_t n;
+
+    if (listp->nruns > 0) {
+      runp = &listp->runs[listp->nruns - 1];
+      if (runp->kind == kind && runp->datap + runp->length == datap &&
+          runp->length < ILI9341_MAX_RUN_LENGTH) {
+        n = ILI9341_MAX_RUN_LENGTH - runp->length;
+        if (n > length)
+          n = length;
+        runp->length += (uint16_t)n;
+        datap += n;
+        length -= n;
+        continue;
+      }
+    }
+
+    chDbgAssert(listp->nruns < listp->maxruns,
+                "ili9341_list_append(), #1", "runs overflow");
+    n = length < ILI9341_MAX_RUN_LENGTH ? length : ILI9341_MAX_RUN_LENGTH;
+    runp = &listp->runs[listp->nruns++];
+    runp->datap = datap;
+    runp->length = (uint16_t)n;
+    runp->kind = kind;
+    datap += n;
+    length -= n;
+  }
+}
+
+/**
+ * @brief   Copies bytes into the buffer of a command list.
+ *
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] kind      run kind
+ * @param[in] bytes     bytes to be copied
+ * @param[in] length    bytes count
+ *
+ * @notapi
+ */
+static void ili9341_list_put(ILI9341List *listp, uint8_t kind,
+                             const uint8_t *bytes, size_t length) {
+
+  uint8_t *datap = &listp->bufferp[listp->used];
+
+  chDbgAssert(length <= listp->size - listp->used,
+              "ili9341_list_put(), #1", "buffer overflow");
+
+  memcpy(datap, bytes, length);
+  listp->used += length;
+  ili9341_list_append(listp, kind, datap, length);
+}
+
+static void ili9341_list_next_i(ILI9341Driver *driverp);
+
+/**
+ * @brief   Delay runs timer callback.
+ *
+ * @param[in] p         pointer to the @p ILI9341Driver object
+ *
+ * @notapi
+ */
+static void ili9341_list_delay_cb(void *p) {
+
+  ili9341_list_next_i((ILI9341Driver *)p);
+}
+
+/**
+ * @brief   Plays the next run of the current command list.
+ * @details Data runs are started on the SPI, delay runs arm the driver timer.
+ *          When the list is over the end callback is invoked and the waiting
+ *          thread, if any, is woken up.
+ *
+ * @param[in] driverp   pointer to the @p ILI9341Driver object
+ *
+ * @notapi
+ */
+static void ili9341_list_next_i(ILI9341Driver *driverp) {
+
+  const ILI9341List *listp = driverp->listp;
+  const ILI9341Run *runp;
+
+  if (driverp->run >= listp->nruns) {
+    driverp->listp = NULL;
+    if (driverp->endcb != NULL)
+      driverp->endcb(driverp);
+    if (driverp->thread != NULL) {
+      Thread *tp = driverp->thread;
+      driverp->thread = NULL;
+      tp->p_u.rdymsg = RDY_OK;
+      chSchReadyI(tp);
+    }
+    return;
+  }
+
+  runp = &listp->runs[driverp->run++];
+  switch (runp->kind) {
+  case ILI9341_RUN_DELAY:
+    chVTSetI(&driverp->vt, (systime_t)runp->length,
+             ili9341_list_delay_cb, driverp);
+    return;
+  case ILI9341_RUN_COMMAND:
+    palClearPad(driverp->config->dcx_port, driverp->config->dcx_pad);
+    break;
+  default:
+    palSetPad(driverp->config->dcx_port, driverp->config->dcx_pad);
+    break;
+  }
+  spiStartSendI(driverp->config->spi, runp->length, runp->datap);
+}
+
+/**
+ * @brief   SPI end callback.
+ * @details The SPI driver signals the end of a send operation once the last
+ *          byte has been received back, so the <tt>D/!C</tt> signal can be
+ *          safely changed here for the next run.
+ *
+ * @param[in] spip      pointer to the @p SPIDriver object
+ *
+ * @notapi
+ */
+static void ili9341_spi_end_cb(SPIDriver *spip) {
+
+  ILI9341Driver *driverp = (ILI9341Driver *)((uint8_t *)spip->config -
+                                             offsetof(ILI9341Driver, spicfg));
+
+  /* Blocking transfers are not part of a list.*/
+  if (driverp->listp == NULL)
+    return;
+
+  chSysLockFromIsr();
+  ili9341_list_next_i(driverp);
+  chSysUnlockFromIsr();
+}
+
+#endif /* ILI9341_USE_COMMAND_LISTS */
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -101,11 +259,18 @@ void ili9341ObjectInit(ILI9341Driver *driverp) {
   chSemInit(&driverp->lock, 1);
 #endif
 #endif /* ILI9341_USE_MUTUAL_EXCLUSION */
+#if ILI9341_USE_COMMAND_LISTS
+  driverp->busconfig = NULL;
+  driverp->listp = NULL;
+  driverp->thread = NULL;
+  driverp->vt.vt_func = NULL;
+#endif /* ILI9341_USE_COMMAND_LISTS */
 }
 
 /**
  * @brief   Configures and activates the ILI9341 peripheral.
  * @pre     ILI9341 is stopped.
+ * @pre     The SPI driver is started.
  *
  * @param[in] driverp   pointer to the @p ILI9341Driver object
  * @param[in] configp   pointer to the @p ILI9341Config object
@@ -114,6 +279,19 @@ void ili9341ObjectInit(ILI9341Driver *driverp) {
  */
 void ili9341Start(ILI9341Driver *driverp, const ILI9341Config *configp) {
 
+#if ILI9341_USE_COMMAND_LISTS
+  chDbgCheck(driverp != NULL && configp != NULL && configp->spi != NULL,
+             "ili9341Start");
+  chDbgAssert(configp->spi->state == SPI_READY,
+              "ili9341Start(), #2", "SPI not ready");
+
+  /* The SPI is restarted with the same settings and the list callback.*/
+  driverp->busconfig = configp->spi->config;
+  driverp->spicfg = *driverp->busconfig;
+  driverp->spicfg.end_cb = ili9341_spi_end_cb;
+  spiStart(configp->spi, &driverp->spicfg);
+#endif /* ILI9341_USE_COMMAND_LISTS */
+
   chSysLock();
   chDbgCheck(driverp != NULL, "ili9341Start");
   chDbgCheck(configp != NULL, "ili9341Start");
@@ -145,6 +323,10 @@ void ili9341Stop(ILI9341Driver *driverp) {
 
   driverp->state = ILI9341_STOP;
   chSysUnlock();
+
+#if ILI9341_USE_COMMAND_LISTS
+  spiStart(driverp->config->spi, driverp->busconfig);
+#endif /* ILI9341_USE_COMMAND_LISTS */
 }
 
 #if ILI9341_USE_MUTUAL_EXCLUSION
@@ -288,6 +470,10 @@ void ili9341UnselectI(ILI9341Driver *driverp) {
   chDbgCheck(driverp != NULL, "ili9341Unselect");
   chDbgAssert(driverp->state == ILI9341_ACTIVE,
               "ili9341UnselectI(), #1", "invalid state");
+#if ILI9341_USE_COMMAND_LISTS
+  chDbgAssert(driverp->listp == NULL,
+              "ili9341UnselectI(), #2", "list playing");
+#endif
 
   spiUnselectI(driverp->config->spi);
   driverp->state = ILI9341_READY;
@@ -323,6 +509,10 @@ void ili9341WriteCommand(ILI9341Driver *driverp, uint8_t cmd) {
   chDbgCheck(driverp != NULL, "ili9341WriteCommand");
   chDbgAssert(driverp->state == ILI9341_ACTIVE,
               "ili9341WriteCommand(), #1", "invalid state");
+#if ILI9341_USE_COMMAND_LISTS
+  chDbgAssert(driverp->listp == NULL,
+              "ili9341WriteCommand(), #2", "list playing");
+#endif
 
   driverp->value = cmd;
   palClearPad(driverp->config->dcx_port, driverp->config->dcx_pad); /* !Cmd */
@@ -343,6 +533,10 @@ void ili9341WriteByte(ILI9341Driver *driverp, uint8_t value) {
   chDbgCheck(driverp != NULL, "ili9341WriteByte");
   chDbgAssert(driverp->state == ILI9341_ACTIVE,
               "ili9341WriteByte(), #1", "invalid state");
+#if ILI9341_USE_COMMAND_LISTS
+  chDbgAssert(driverp->listp == NULL,
+              "ili9341WriteByte(), #2", "list playing");
+#endif
 
   driverp->value = value;
   palSetPad(driverp->config->dcx_port, driverp->config->dcx_pad); /* Data */
@@ -366,6 +560,10 @@ uint8_t ili9341ReadByte(ILI9341Driver *driverp) {
   chDbgCheck(driverp != NULL, "ili9341ReadByte");
   chDbgAssert(driverp->state == ILI9341_ACTIVE,
               "ili9341ReadByte(), #1", "invalid state");
+#if ILI9341_USE_COMMAND_LISTS
+  chDbgAssert(driverp->listp == NULL,
+              "ili9341ReadByte(), #2", "list playing");
+#endif
 
   palSetPad(driverp->config->dcx_port, driverp->config->dcx_pad); /* Data */
   spiReceive(driverp->config->spi, 1, &driverp->value);
@@ -390,6 +588,10 @@ void ili9341WriteChunk(ILI9341Driver *driverp, const uint8_t chunk[],
   chDbgCheck(chunk != NULL, "ili9341WriteChunk");
   chDbgAssert(driverp->state == ILI9341_ACTIVE,
               "ili9341WriteChunk(), #1", "invalid state");
+#if ILI9341_USE_COMMAND_LISTS
+  chDbgAssert(driverp->listp == NULL,
+              "ili9341WriteChunk(), #2", "list playing");
+#endif
 
   if (length == 0)
     return;
@@ -416,6 +618,10 @@ void ili9341ReadChunk(ILI9341Driver *driverp, uint8_t chunk[],
   chDbgCheck(chunk != NULL, "ili9341ReadChunk");
   chDbgAssert(driverp->state == ILI9341_ACTIVE,
               "ili9341ReadChunk(), #1", "invalid state");
+#if ILI9341_USE_COMMAND_LISTS
+  chDbgAssert(driverp->listp == NULL,
+              "ili9341ReadChunk(), #2", "list playing");
+#endif
 
   if (length == 0)
     return;
@@ -424,6 +630,316 @@ void ili9341ReadChunk(ILI9341Driver *driverp, uint8_t chunk[],
   spiReceive(driverp->config->spi, length, chunk);
 }
 
+#if ILI9341_USE_COMMAND_LISTS || defined(__DOXYGEN__)
+
+/**
+ * @brief   Initializes a command list.
+ *
+ * @param[out] listp    pointer to the @p ILI9341List object
+ * @param[in] bufferp   bytes buffer, must be accessed by DMA
+ * @param[in] size      bytes buffer size
+ * @param[in] runs      runs table
+ * @param[in] maxruns   runs table size
+ *
+ * @init
+ */
+void ili9341ListInit(ILI9341List *listp, uint8_t *bufferp, size_t size,
+                     ILI9341Run *runs, size_t maxruns) {
+
+  chDbgCheck(listp != NULL, "ili9341ListInit");
+  chDbgCheck(runs != NULL && maxruns > 0, "ili9341ListInit");
+  chDbgCheck(bufferp != NULL || size == 0, "ili9341ListInit");
+
+  listp->bufferp = bufferp;
+  listp->size = size;
+  listp->runs = runs;
+  listp->maxruns = maxruns;
+  ili9341ListReset(listp);
+}
+
+/**
+ * @brief   Empties a command list.
+ * @pre     The list is not being played.
+ *
+ * @param[in] listp     pointer to the @p ILI9341List object
+ *
+ * @api
+ */
+void ili9341ListReset(ILI9341List *listp) {
+
+  chDbgCheck(listp != NULL, "ili9341ListReset");
+
+  listp->used = 0;
+  listp->nruns = 0;
+}
+
+/**
+ * @brief   Appends a command byte.
+ *
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] cmd       command byte
+ *
+ * @api
+ */
+void ili9341ListCommand(ILI9341List *listp, uint8_t cmd) {
+
+  chDbgCheck(listp != NULL, "ili9341ListCommand");
+
+  ili9341_list_put(listp, ILI9341_RUN_COMMAND, &cmd, 1);
+}
+
+/**
+ * @brief   Appends a data byte.
+ *
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] value     data byte
+ *
+ * @api
+ */
+void ili9341ListByte(ILI9341List *listp, uint8_t value) {
+
+  chDbgCheck(listp != NULL, "ili9341ListByte");
+
+  ili9341_list_put(listp, ILI9341_RUN_DATA, &value, 1);
+}
+
+/**
+ * @brief   Appends data bytes.
+ * @details The bytes are copied into the list buffer.
+ *
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] bytes     data bytes
+ * @param[in] length    bytes count
+ *
+ * @api
+ */
+void ili9341ListBytes(ILI9341List *listp, const uint8_t bytes[],
+                      size_t length) {
+
+  chDbgCheck(listp != NULL, "ili9341ListBytes");
+  chDbgCheck(bytes != NULL || length == 0, "ili9341ListBytes");
+
+  ili9341_list_put(listp, ILI9341_RUN_DATA, bytes, length);
+}
+
+/**
+ * @brief   Appends a data chunk.
+ * @details The chunk is not copied, it is sent from its own memory when the
+ *          list is played. Chunks longer than @p ILI9341_MAX_RUN_LENGTH take
+ *          more runs.
+ * @pre     The chunk must be accessed by DMA.
+ * @pre     The chunk must not change until the list has been played.
+ *
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] chunk     chunk bytes
+ * @param[in] length    chunk length
+ *
+ * @api
+ */
+void ili9341ListChunk(ILI9341List *listp, const uint8_t chunk[],
+                      size_t length) {
+
+  chDbgCheck(listp != NULL, "ili9341ListChunk");
+  chDbgCheck(chunk != NULL || length == 0, "ili9341ListChunk");
+
+  ili9341_list_append(listp, ILI9341_RUN_DATA, chunk, length);
+}
+
+/**
+ * @brief   Appends a delay.
+ * @details The delay is timed by a virtual timer, no thread is involved.
+ *
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] time      delay in system ticks, must be in range
+ *                      <tt>1..ILI9341_MAX_RUN_LENGTH</tt>
+ *
+ * @api
+ */
+void ili9341ListDelay(ILI9341List *listp, systime_t time) {
+
+  ILI9341Run *runp;
+
+  chDbgCheck(listp != NULL, "ili9341ListDelay");
+  chDbgCheck(time > 0 && time <= ILI9341_MAX_RUN_LENGTH, "ili9341ListDelay");
+  chDbgAssert(listp->nruns < listp->maxruns,
+              "ili9341ListDelay(), #1", "runs overflow");
+
+  runp = &listp->runs[listp->nruns++];
+  runp->datap = NULL;
+  runp->length = (uint16_t)time;
+  runp->kind = ILI9341_RUN_DELAY;
+}
+
+/**
+ * @brief   Appends a memory window selection.
+ * @details The column and page addresses are set, then the memory write is
+ *          started. The window pixels are expected to follow, usually as
+ *          chunks.
+ *
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] x1        first column
+ * @param[in] y1        first page
+ * @param[in] x2        last column, included
+ * @param[in] y2        last page, included
+ *
+ * @api
+ */
+void ili9341ListWindow(ILI9341List *listp, uint16_t x1, uint16_t y1,
+                       uint16_t x2, uint16_t y2) {
+
+  uint8_t params[4];
+
+  chDbgCheck(listp != NULL, "ili9341ListWindow");
+  chDbgCheck(x1 <= x2 && y1 <= y2, "ili9341ListWindow");
+
+  params[0] = (uint8_t)(x1 >> 8);
+  params[1] = (uint8_t)x1;
+  params[2] = (uint8_t)(x2 >> 8);
+  params[3] = (uint8_t)x2;
+  ili9341ListCommand(listp, ILI9341_SET_COL_ADDR);
+  ili9341ListBytes(listp, params, sizeof(params));
+
+  params[0] = (uint8_t)(y1 >> 8);
+  params[1] = (uint8_t)y1;
+  params[2] = (uint8_t)(y2 >> 8);
+  params[3] = (uint8_t)y2;
+  ili9341ListCommand(listp, ILI9341_SET_PAGE_ADDR);
+  ili9341ListBytes(listp, params, sizeof(params));
+
+  ili9341ListCommand(listp, ILI9341_SET_MEM);
+}
+
+/**
+ * @brief   Starts playing a command list.
+ * @details The runs are chained from the SPI end callback, the CPU is only
+ *          involved once per run.
+ * @pre     ILI9341 is active and no list is being played.
+ * @post    At the end of the list the callback is invoked.
+ * @note    The list must not be modified until it has been played.
+ *
+ * @param[in] driverp   pointer to the @p ILI9341Driver object
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] endcb     end callback, or @p NULL
+ *
+ * @iclass
+ */
+void ili9341ListStartI(ILI9341Driver *driverp, const ILI9341List *listp,
+                       ili9341cb_t endcb) {
+
+  chDbgCheckClassI();
+  chDbgCheck(driverp != NULL, "ili9341ListStartI");
+  chDbgCheck(listp != NULL && listp->nruns > 0, "ili9341ListStartI");
+  chDbgAssert(driverp->state == ILI9341_ACTIVE,
+              "ili9341ListStartI(), #1", "invalid state");
+  chDbgAssert(driverp->listp == NULL,
+              "ili9341ListStartI(), #2", "list playing");
+  chDbgAssert(driverp->config->spi->state == SPI_READY ||
+              driverp->config->spi->state == SPI_COMPLETE,
+              "ili9341ListStartI(), #3", "SPI not ready");
+
+  driverp->listp = listp;
+  driverp->run = 0;
+  driverp->endcb = endcb;
+  ili9341_list_next_i(driverp);
+}
+
+/**
+ * @brief   Starts playing a command list.
+ * @details The runs are chained from the SPI end callback, the CPU is only
+ *          involved once per run.
+ * @pre     ILI9341 is active and no list is being played.
+ * @post    At the end of the list the callback is invoked.
+ * @note    The list must not be modified until it has been played.
+ *
+ * @param[in] driverp   pointer to the @p ILI9341Driver object
+ * @param[in] listp     pointer to the @p ILI9341List object
+ * @param[in] endcb     end callback, or @p NULL
+ *
+ * @api
+ */
+void ili9341ListStart(ILI9341Driver *driverp, const ILI9341List *listp,
+                      ili9341cb_t endcb) {
+
+  chSysLock();
+  ili9341ListStartI(driverp, listp, endcb);
+  chSysUnlock();
+}
+
+/**
+ * @brief   Waits for the end of the command list being played.
+ * @details Returns immediately if no list is being played.
+ * @note    Only one thread at a time can wait.
+ *
+ * @param[in] driverp   pointer to the @p ILI9341Driver object
+ *
+ * @return              The wait result.
+ * @retval RDY_OK       the list has been played.
+ *
+ * @sclass
+ */
+msg_t ili9341ListWaitS(ILI9341Driver *driverp) {
+
+  chDbgCheckClassS();
+  chDbgCheck(driverp != NULL, "ili9341ListWaitS");
+  chDbgAssert(driverp->thread == NULL,
+              "ili9341ListWaitS(), #1", "already waiting");
+
+  if (driverp->listp == NULL)
+    return RDY_OK;
+
+  driverp->thread = chThdSelf();
+  chSchGoSleepS(THD_STATE_SUSPENDED);
+  return chThdSelf()->p_u.rdymsg;
+}
+
+/**
+ * @brief   Waits for the end of the command list being played.
+ * @details Returns immediately if no list is being played.
+ * @note    Only one thread at a time can wait.
+ *
+ * @param[in] driverp   pointer to the @p ILI9341Driver object
+ *
+ * @return              The wait result.
+ * @retval RDY_OK       the list has been played.
+ *
+ * @api
+ */
+msg_t ili9341ListWait(ILI9341Driver *driverp) {
+
+  msg_t msg;
+
+  chSysLock();
+  msg = ili9341ListWaitS(driverp);
+  chSysUnlock();
+  return msg;
+}
+
+/**
+ * @brief   Plays a command list.
+ * @details The calling thread sleeps until the whole list has been played.
+ * @pre     ILI9341 is active and no list is being played.
+ *
+ * @param[in] driverp   pointer to the @p ILI9341Driver object
+ * @param[in] listp     pointer to the @p ILI9341List object
+ *
+ * @return              The wait result.
+ * @retval RDY_OK       the list has been played.
+ *
+ * @api
+ */
+msg_t ili9341ListExecute(ILI9341Driver *driverp, const ILI9341List *listp) {
+
+  msg_t msg;
+
+  chSysLock();
+  ili9341ListStartI(driverp, listp, NULL);
+  msg = ili9341ListWaitS(driverp);
+  chSysUnlock();
+  return msg;
+}
+
+#endif /* ILI9341_USE_COMMAND_LISTS */
+
 #else /* ILI9341_IM == * */
 #error "Only the ILI9341_IM_4LSI_1 interface mode is currently supported"
 #endif /* ILI9341_IM == * */
@@ -129,6 +129,20 @@
 #define ILI9341_IM_4LSI_2               0xE     /**< 4-line serial, mode 2.*/
 /** @} */
 
+/**
+ * @name    ILI9341 command list run kinds
+ * @{
+ */
+#define ILI9341_RUN_COMMAND             0       /**< Command bytes, D/!C low.*/
+#define ILI9341_RUN_DATA                1       /**< Data bytes, D/!C high.*/
+#define ILI9341_RUN_DELAY               2       /**< Delay, in system ticks.*/
+/** @} */
+
+/**
+ * @brief   Maximum length of a single DMA transfer in a command list.
+ */
+#define ILI9341_MAX_RUN_LENGTH          0xFFFF
+
 /*===========================================================================*/
 /* Driver pre-compile time settings.                                         */
 /*===========================================================================*/
@@ -163,6 +177,18 @@
 #define ILI9341_USE_CHECKS                  TRUE
 #endif
 
+/**
+ * @brief   Enables the command lists APIs.
+ * @details Command lists batch command and data bytes and play them back as
+ *          a chain of DMA transfers, the <tt>D/!C</tt> signal is toggled
+ *          from the SPI end callback between two transfers.
+ * @note    The driver replaces the callback of the SPI configuration while
+ *          it is started.
+ */
+#if !defined(ILI9341_USE_COMMAND_LISTS) || defined(__DOXYGEN__)
+#define ILI9341_USE_COMMAND_LISTS           TRUE
+#endif
+
 /** @} */
 
 /*===========================================================================*/
@@ -187,6 +213,40 @@ typedef struct ILI9341Config ILI9341Config;
 typedef enum ili9341state_t ili9341state_t;
 typedef struct ILI9341Driver ILI9341Driver;
 
+#if ILI9341_USE_COMMAND_LISTS || defined(__DOXYGEN__)
+/**
+ * @brief   Command list end callback.
+ * @note    The callback is invoked from ISR context, with the system locked.
+ */
+typedef void (*ili9341cb_t)(ILI9341Driver *driverp);
+
+/**
+ * @brief   Command list run.
+ * @details A run is a single DMA transfer with a constant <tt>D/!C</tt> level,
+ *          or a delay.
+ */
+typedef struct ILI9341Run {
+  const uint8_t         *datap;     /**< Bytes to be sent.*/
+  uint16_t              length;     /**< Bytes count, or delay ticks.*/
+  uint8_t               kind;       /**< Run kind.*/
+} ILI9341Run;
+
+/**
+ * @brief   Command list.
+ * @details Command and data bytes are packed into the list buffer, adjacent
+ *          bytes of the same kind share the same run. Pixel chunks are not
+ *          copied, their runs reference the caller memory.
+ */
+typedef struct ILI9341List {
+  uint8_t               *bufferp;   /**< Packed bytes, DMA accessible.*/
+  size_t                size;       /**< Buffer size.*/
+  size_t                used;       /**< Used buffer bytes.*/
+  ILI9341Run            *runs;      /**< Runs table.*/
+  size_t                maxruns;    /**< Runs table size.*/
+  size_t                nruns;      /**< Used runs.*/
+} ILI9341List;
+#endif /* ILI9341_USE_COMMAND_LISTS */
+
 /**
  * @brief   ILI9341 driver configuration.
  */
@@ -224,6 +284,17 @@ typedef struct ILI9341Driver {
 #endif
 #endif /* ILI9341_USE_MUTUAL_EXCLUSION */
 
+#if ILI9341_USE_COMMAND_LISTS || defined(__DOXYGEN__)
+  /* Command lists stuff.*/
+  SPIConfig             spicfg;     /**< SPI configuration with list callback.*/
+  const SPIConfig       *busconfig; /**< Original SPI configuration.*/
+  const ILI9341List     *listp;     /**< Playing list, @p NULL if none.*/
+  size_t                run;        /**< Next run to be played.*/
+  ili9341cb_t           endcb;      /**< List end callback, or @p NULL.*/
+  Thread                *thread;    /**< Thread waiting for the list end.*/
+  VirtualTimer          vt;         /**< Delay runs timer.*/
+#endif /* ILI9341_USE_COMMAND_LISTS */
+
   /* Temporary variables.*/
   uint8_t               value;      /**< Non-stacked value, for SPI with CCM.*/
 } ILI9341Driver;
@@ -581,6 +652,27 @@ extern "C" {
                          size_t length);
   void ili9341ReadChunk(ILI9341Driver *driverp, uint8_t chunk[],
                         size_t length);
+#if ILI9341_USE_COMMAND_LISTS
+  void ili9341ListInit(ILI9341List *listp, uint8_t *bufferp, size_t size,
+                       ILI9341Run *runs, size_t maxruns);
+  void ili9341ListReset(ILI9341List *listp);
+  void ili9341ListCommand(ILI9341List *listp, uint8_t cmd);
+  void ili9341ListByte(ILI9341List *listp, uint8_t value);
+  void ili9341ListBytes(ILI9341List *listp, const uint8_t bytes[],
+                        size_t length);
+  void ili9341ListChunk(ILI9341List *listp, const uint8_t chunk[],
+                        size_t length);
+  void ili9341ListDelay(ILI9341List *listp, systime_t time);
+  void ili9341ListWindow(ILI9341List *listp, uint16_t x1, uint16_t y1,
+                         uint16_t x2, uint16_t y2);
+  void ili9341ListStartI(ILI9341Driver *driverp, const ILI9341List *listp,
+                         ili9341cb_t endcb);
+  void ili9341ListStart(ILI9341Driver *driverp, const ILI9341List *listp,
+                        ili9341cb_t endcb);
+  msg_t ili9341ListWaitS(ILI9341Driver *driverp);
+  msg_t ili9341ListWait(ILI9341Driver *driverp);
+  msg_t ili9341ListExecute(ILI9341Driver *driverp, const ILI9341List *listp);
+#endif /* ILI9341_USE_COMMAND_LISTS */
 
 #ifdef __cplusplus
 }
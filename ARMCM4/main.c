@@ -14,12 +14,18 @@
     limitations under the License.
 */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "ch.h"
 #include "hal.h"
 #include "test.h"
 
 #include "chprintf.h"
 #include "shell.h"
+#if CH_DBG_TRACE_EVENTS
+#include "tracestream.h"
+#endif
 #if HAL_USE_SERIAL_USB
 #include "usbcfg.h"
 #endif
@@ -30,21 +36,18 @@
 #include "ili9341.h"
 #include "stm32_ltdc.h"
 #include "stm32_dma2d.h"
+#include "compositor.h"
+#include "sdram.h"
+#include "assets.h"
+#include "raster.h"
+#include "probes.h"
 
-#include "res/wolf3d_vgagraph_chunk87.h"
+#include "res/wolf3d_assets.h"
 
 #define IS42S16400J_SIZE             0x400000
 
-/*
- * Erases the whole SDRAM bank.
- */
-static void sdram_bulk_erase(void) {
-
-  volatile uint8_t *p = (volatile uint8_t *)SDRAM_BANK_ADDR;
-  volatile uint8_t *end = p + IS42S16400J_SIZE;
-  while (p < end)
-    *p++ = 0;
-}
+/* Pattern written by the "write" command and expected by "check".*/
+#define SDRAM_CHECK_PATTERN          0x3C3CC3C3
 
 /*
  * Red LED blinker thread, times are in milliseconds.
@@ -84,11 +87,16 @@ static msg_t Thread2(void *arg) {
 /* LTDC related.                                                             */
 /*===========================================================================*/
 
-static uint8_t frame_buffer[240 * 320 * 3] __attribute__((section(".sdram")));
+static uint8_t frame_buffers[3][240 * 320 * 3]
+  __attribute__((section(".sdram")));
+
+static uint8_t view_buffer[240 * 320] __attribute__((aligned(4)));
 
-static uint8_t view_buffer[240 * 320];
+/* Unpacked from the assets archive at boot.*/
+static uint8_t splash_buffer[200 * 320]
+  __attribute__((section(".sdram")));
 
-extern const ltdc_color_t wolf3d_palette[256];
+static ltdc_color_t wolf3d_palette[256];
 
 static const ltdc_window_t ltdc_fullscreen_wincfg = {
   0,
@@ -118,7 +126,7 @@ static const ltdc_laycfg_t ltdc_view_laycfg1 = {
 };
 
 static const ltdc_frame_t ltdc_screen_frmcfg1 = {
-  frame_buffer,
+  frame_buffers[0],
   240,
   320,
   240 * 3,
@@ -137,6 +145,20 @@ static const ltdc_laycfg_t ltdc_screen_laycfg1 = {
   LTDC_LEF_ENABLE
 };
 
+static void *const ltdc_swap_buffers[3] = {
+  frame_buffers[0],
+  frame_buffers[1],
+  frame_buffers[2]
+};
+
+/* Triple buffering, every rendered frame is shown.*/
+static const ltdc_swapcfg_t ltdc_swapcfg = {
+  ltdc_swap_buffers,
+  3,
+  LTDC_L1,
+  LTDC_SWAP_FIFO
+};
+
 static const LTDCConfig ltdc_cfg = {
   /* Display specifications.*/
   240,                              /**< Screen pixel width.*/
@@ -189,87 +211,104 @@ static void initialize_lcd(void) {
     0x42, 0x05, 0x0C, 0x0A, 0x28, 0x2F, 0x0F
   };
 
+  static uint8_t list_buffer[64];
+  static ILI9341Run list_runs[40];
+  ILI9341List list;
   ILI9341Driver *const lcdp = &ILI9341D1;
 
-  /* XOR-checkerboard texture.*/
+  /* XOR-checkerboard texture, four pixels at time, the per-byte adds of
+     the column indexes never carry.*/
   unsigned x, y;
-  for (y = 0; y < 320; ++y)
-    for (x = 0; x < 240; ++x)
-      view_buffer[y * 240 + x] = (uint8_t)(x ^ y);
+  for (y = 0; y < 320; ++y) {
+    uint32_t *p = (uint32_t *)&view_buffer[y * 240];
+    uint32_t row = (y & 0xFF) * 0x01010101U;
+    uint32_t cols = 0x03020100U;
+
+    for (x = 0; x < 240; x += 4) {
+      *p++ = cols ^ row;
+      cols = __UADD8(cols, 0x04040404U);
+    }
+  }
 
-  ili9341AcquireBus(lcdp);
-  ili9341Select(lcdp);
+  /* The whole setup is sent as a single command list.*/
+  ili9341ListInit(&list, list_buffer, sizeof(list_buffer),
+                  list_runs, sizeof(list_runs) / sizeof(list_runs[0]));
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_FRAME_CTL_NORMAL);
-  ili9341WriteByte(lcdp, 0x00);
-  ili9341WriteByte(lcdp, 0x1B);
+  ili9341ListCommand(&list, ILI9341_SET_FRAME_CTL_NORMAL);
+  ili9341ListByte(&list, 0x00);
+  ili9341ListByte(&list, 0x1B);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_FUNCTION_CTL);
-  ili9341WriteByte(lcdp, 0x0A);
-  ili9341WriteByte(lcdp, 0xA2);
+  ili9341ListCommand(&list, ILI9341_SET_FUNCTION_CTL);
+  ili9341ListByte(&list, 0x0A);
+  ili9341ListByte(&list, 0xA2);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_POWER_CTL_1);
-  ili9341WriteByte(lcdp, 0x10);
+  ili9341ListCommand(&list, ILI9341_SET_POWER_CTL_1);
+  ili9341ListByte(&list, 0x10);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_POWER_CTL_2);
-  ili9341WriteByte(lcdp, 0x10);
+  ili9341ListCommand(&list, ILI9341_SET_POWER_CTL_2);
+  ili9341ListByte(&list, 0x10);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_VCOM_CTL_1);
-  ili9341WriteByte(lcdp, 0x45);
-  ili9341WriteByte(lcdp, 0x15);
+  ili9341ListCommand(&list, ILI9341_SET_VCOM_CTL_1);
+  ili9341ListByte(&list, 0x45);
+  ili9341ListByte(&list, 0x15);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_VCOM_CTL_2);
-  ili9341WriteByte(lcdp, 0x90);
+  ili9341ListCommand(&list, ILI9341_SET_VCOM_CTL_2);
+  ili9341ListByte(&list, 0x90);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_MEM_ACS_CTL);
-  ili9341WriteByte(lcdp, 0xC8);
+  ili9341ListCommand(&list, ILI9341_SET_MEM_ACS_CTL);
+  ili9341ListByte(&list, 0xC8);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_RGB_IF_SIG_CTL);
-  ili9341WriteByte(lcdp, 0xC2);
+  ili9341ListCommand(&list, ILI9341_SET_RGB_IF_SIG_CTL);
+  ili9341ListByte(&list, 0xC2);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_FUNCTION_CTL);
-  ili9341WriteByte(lcdp, 0x0A);
-  ili9341WriteByte(lcdp, 0xA7);
-  ili9341WriteByte(lcdp, 0x27);
-  ili9341WriteByte(lcdp, 0x04);
+  ili9341ListCommand(&list, ILI9341_SET_FUNCTION_CTL);
+  ili9341ListByte(&list, 0x0A);
+  ili9341ListByte(&list, 0xA7);
+  ili9341ListByte(&list, 0x27);
+  ili9341ListByte(&list, 0x04);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_COL_ADDR);
-  ili9341WriteByte(lcdp, 0x00);
-  ili9341WriteByte(lcdp, 0x00);
-  ili9341WriteByte(lcdp, 0x00);
-  ili9341WriteByte(lcdp, 0xEF);
+  ili9341ListCommand(&list, ILI9341_SET_COL_ADDR);
+  ili9341ListByte(&list, 0x00);
+  ili9341ListByte(&list, 0x00);
+  ili9341ListByte(&list, 0x00);
+  ili9341ListByte(&list, 0xEF);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_PAGE_ADDR);
-  ili9341WriteByte(lcdp, 0x00);
-  ili9341WriteByte(lcdp, 0x00);
-  ili9341WriteByte(lcdp, 0x01);
-  ili9341WriteByte(lcdp, 0x3F);
+  ili9341ListCommand(&list, ILI9341_SET_PAGE_ADDR);
+  ili9341ListByte(&list, 0x00);
+  ili9341ListByte(&list, 0x00);
+  ili9341ListByte(&list, 0x01);
+  ili9341ListByte(&list, 0x3F);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_IF_CTL);
-  ili9341WriteByte(lcdp, 0x01);
-  ili9341WriteByte(lcdp, 0x00);
-  ili9341WriteByte(lcdp, 0x06);
+  ili9341ListCommand(&list, ILI9341_SET_IF_CTL);
+  ili9341ListByte(&list, 0x01);
+  ili9341ListByte(&list, 0x00);
+  ili9341ListByte(&list, 0x06);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_GAMMA);
-  ili9341WriteByte(lcdp, 0x01);
+  ili9341ListCommand(&list, ILI9341_SET_GAMMA);
+  ili9341ListByte(&list, 0x01);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_PGAMMA);
-  ili9341WriteChunk(lcdp, pgamma, 15);
+  ili9341ListCommand(&list, ILI9341_SET_PGAMMA);
+  ili9341ListChunk(&list, pgamma, 15);
 
-  ili9341WriteCommand(lcdp, ILI9341_SET_NGAMMA);
-  ili9341WriteChunk(lcdp, ngamma, 15);
+  ili9341ListCommand(&list, ILI9341_SET_NGAMMA);
+  ili9341ListChunk(&list, ngamma, 15);
 
-  ili9341WriteCommand(lcdp, ILI9341_CMD_SLEEP_OFF);
-  chThdSleepMilliseconds(10);
+  ili9341ListCommand(&list, ILI9341_CMD_SLEEP_OFF);
+  ili9341ListDelay(&list, MS2ST(10));
 
-  ili9341WriteCommand(lcdp, ILI9341_CMD_DISPLAY_ON);
-  ili9341WriteCommand(lcdp, ILI9341_SET_MEM);
-  chThdSleepMilliseconds(10);
+  ili9341ListCommand(&list, ILI9341_CMD_DISPLAY_ON);
+  ili9341ListCommand(&list, ILI9341_SET_MEM);
+  ili9341ListDelay(&list, MS2ST(10));
 
+  ili9341AcquireBus(lcdp);
+  ili9341Select(lcdp);
+  ili9341ListExecute(lcdp, &list);
   ili9341Unselect(lcdp);
   ili9341ReleaseBus(lcdp);
 }
 
+static dma2d_job_t dma2d_jobs[4];
+
 static const DMA2DConfig dma2d_cfg = {
   /* ISR callbacks.*/
   NULL,     /**< Configuration error, or @p NULL.*/
@@ -277,14 +316,14 @@ static const DMA2DConfig dma2d_cfg = {
   NULL,     /**< Palette access error, or @p NULL.*/
   NULL,     /**< Transfer watermark, or @p NULL.*/
   NULL,     /**< Transfer complete, or @p NULL.*/
-  NULL      /**< Transfer error, or @p NULL.*/
+  NULL,     /**< Transfer error, or @p NULL.*/
+  /* Job queue.*/
+  dma2d_jobs,
+  sizeof(dma2d_jobs) / sizeof(dma2d_jobs[0])
 };
 
-static const dma2d_palcfg_t dma2d_palcfg = {
-  wolf3d_palette,
-  256,
-  DMA2D_FMT_ARGB8888
-};
+/* Filled by assetLoadClut().*/
+static dma2d_palcfg_t dma2d_palcfg;
 
 static const dma2d_laycfg_t dma2d_bg_laycfg = {
   view_buffer,
@@ -296,7 +335,7 @@ static const dma2d_laycfg_t dma2d_bg_laycfg = {
 };
 
 static const dma2d_laycfg_t dma2d_fg_laycfg = {
-  (void *)wolf3d_vgagraph_chunk87,
+  splash_buffer,
   0,
   DMA2D_FMT_L8,
   DMA2D_COLOR_LIME,
@@ -304,49 +343,118 @@ static const dma2d_laycfg_t dma2d_fg_laycfg = {
   &dma2d_palcfg
 };
 
-static const dma2d_laycfg_t dma2d_frame_laycfg = {
-  frame_buffer,
-  0,
+static void *const comp_buffers[3] = {
+  frame_buffers[0],
+  frame_buffers[1],
+  frame_buffers[2]
+};
+
+static const CompConfig comp_cfg = {
+  &DMA2DD1,
+  240,
+  320,
   DMA2D_FMT_RGB888,
-  DMA2D_COLOR_BLUE,
-  0xFF,
-  NULL
+  0x000000,
+  comp_buffers,
+  3
 };
 
-static void dma2d_test(void) {
+/* Status indicator, a translucent disc.*/
+static uint32_t status_sprite[32 * 32];
+
+static CompLayer comp_layers[3];
+
+static Compositor comp;
+
+static TIME_PROBE_DECL(probe_render, "render");
+static TIME_PROBE_DECL(probe_acquire, "acquire");
+
+/*
+ * Renderer thread, a status indicator slides back and forth over the
+ * splashscreen picture. Only the damaged areas are redrawn, frames are
+ * flipped upon vsync by the LTDC driver.
+ */
+static WORKING_AREA(waRender, 256);
+static msg_t Render(void *arg) {
 
   DMA2DDriver *const dma2dp = &DMA2DD1;
   LTDCDriver *const ltdcp = &LTDCD1;
+  unsigned x = 0;
+  int dx = 4;
+  int i, j;
+
+  (void)arg;
+  chRegSetThreadName("render");
+
+  for (j = 0; j < 32; ++j)
+    for (i = 0; i < 32; ++i)
+      status_sprite[j * 32 + i] =
+        (i - 16) * (i - 16) + (j - 16) * (j - 16) < 15 * 15 ?
+        0xC0FFFF00 : 0x00000000;
+
+  /* Background, splashscreen at (8, 0) and status indicator.*/
+  comp_layers[0].cl_source = dma2d_bg_laycfg;
+  comp_layers[0].cl_amode = DMA2D_ALPHA_KEEP;
+  comp_layers[0].cl_x = 0;
+  comp_layers[0].cl_y = 0;
+  comp_layers[0].cl_width = 240;
+  comp_layers[0].cl_height = 320;
+  comp_layers[0].cl_blend = FALSE;
+  comp_layers[0].cl_visible = TRUE;
+  comp_layers[1].cl_source = dma2d_fg_laycfg;
+  comp_layers[1].cl_amode = DMA2D_ALPHA_KEEP;
+  comp_layers[1].cl_x = 8;
+  comp_layers[1].cl_y = 0;
+  comp_layers[1].cl_width = 200;
+  comp_layers[1].cl_height = 320;
+  comp_layers[1].cl_blend = FALSE;
+  comp_layers[1].cl_visible = TRUE;
+  comp_layers[2].cl_source.bufferp = status_sprite;
+  comp_layers[2].cl_source.wrap_offset = 0;
+  comp_layers[2].cl_source.fmt = DMA2D_FMT_ARGB8888;
+  comp_layers[2].cl_source.def_color = DMA2D_COLOR_BLACK;
+  comp_layers[2].cl_source.const_alpha = 0xFF;
+  comp_layers[2].cl_source.palettep = NULL;
+  comp_layers[2].cl_amode = DMA2D_ALPHA_KEEP;
+  comp_layers[2].cl_x = x;
+  comp_layers[2].cl_y = 284;
+  comp_layers[2].cl_width = 32;
+  comp_layers[2].cl_height = 32;
+  comp_layers[2].cl_blend = TRUE;
+  comp_layers[2].cl_visible = TRUE;
+  compObjectInit(&comp, &comp_cfg, comp_layers, 3);
 
   chThdSleepSeconds(1);
 
+  /* Switch to the RGB-888 screen and start flipping its buffers.*/
+  dma2dAcquireBus(dma2dp);
+  compRender(&comp, frame_buffers[0]);
+  dma2dReleaseBus(dma2dp);
   ltdcBgSetConfig(ltdcp, &ltdc_screen_laycfg1);
   ltdcReload(ltdcp, TRUE);
+  ltdcSwapStart(ltdcp, &ltdc_swapcfg);
 
-  dma2dAcquireBus(dma2dp);
-
-  /* Target the frame buffer by default.*/
-  dma2dBgSetConfig(dma2dp, &dma2d_frame_laycfg);
-  dma2dFgSetConfig(dma2dp, &dma2d_frame_laycfg);
-  dma2dOutSetConfig(dma2dp, &dma2d_frame_laycfg);
-
-  /* Copy the background.*/
-  dma2dFgSetConfig(dma2dp, &dma2d_bg_laycfg);
-  dma2dJobSetMode(dma2dp, DMA2D_JOB_CONVERT);
-  dma2dJobSetSize(dma2dp, 240, 320);
-  dma2dJobExecute(dma2dp);
-
-  /* Draw the splashscren picture at (8, 0).*/
-  dma2dFgSetConfig(dma2dp, &dma2d_fg_laycfg);
-  dma2dOutSetAddress(dma2dp, dma2dComputeAddress(
-    frame_buffer, ltdc_screen_frmcfg1.pitch, DMA2D_FMT_RGB888, 8, 0
-  ));
-  dma2dOutSetWrapOffset(dma2dp, ltdc_screen_frmcfg1.width - 200);
-  dma2dJobSetMode(dma2dp, DMA2D_JOB_CONVERT);
-  dma2dJobSetSize(dma2dp, 200, 320);
-  dma2dJobExecute(dma2dp);
-
-  dma2dReleaseBus(dma2dp);
+  while (TRUE) {
+    void *bufferp;
+    halrtcnt_t start;
+
+    if ((x == 0 && dx < 0) || (x == 240 - 32 && dx > 0))
+      dx = -dx;
+    x += dx;
+    compLayerMove(&comp, 2, x, 284);
+
+    start = probeStart();
+    bufferp = ltdcSwapAcquire(ltdcp);
+    probeStop(&probe_acquire, start);
+
+    start = probeStart();
+    dma2dAcquireBus(dma2dp);
+    compRender(&comp, bufferp);
+    dma2dReleaseBus(dma2dp);
+    probeStop(&probe_render, start);
+    ltdcSwapPresent(ltdcp);
+  }
+  return CH_SUCCESS;
 }
 
 /*===========================================================================*/
@@ -362,26 +470,38 @@ SerialUSBDriver SDU1;
 #define TEST_WA_SIZE    THD_WA_SIZE(256)
 
 static void cmd_mem(BaseSequentialStream *chp, int argc, char *argv[]) {
-  size_t n, size;
+  HeapStatus hs;
 
   (void)argv;
   if (argc > 0) {
     chprintf(chp, "Usage: mem\r\n");
     return;
   }
-  n = chHeapStatus(NULL, &size);
+  chHeapGetStatus(NULL, &hs);
   chprintf(chp, "core free memory : %u bytes\r\n", chCoreStatus());
-  chprintf(chp, "heap fragments   : %u\r\n", n);
-  chprintf(chp, "heap free total  : %u bytes\r\n", size);
+  chprintf(chp, "heap fragments   : %u\r\n", hs.hs_fragments);
+  chprintf(chp, "heap free total  : %u bytes\r\n", hs.hs_free);
+  chprintf(chp, "heap largest     : %u bytes\r\n", hs.hs_largest);
 }
 
 static void cmd_threads(BaseSequentialStream *chp, int argc, char *argv[]) {
   static const char *states[] = {THD_STATE_NAMES};
   Thread *tp;
 
+#if CH_DBG_THREADS_STATISTICS
+  if ((argc == 1) && (strcmp(argv[0], "reset") == 0)) {
+    /* Starts a new measurement window.*/
+    tp = chRegFirstThread();
+    do {
+      chRegResetThreadStats(tp);
+      tp = chRegNextThread(tp);
+    } while (tp != NULL);
+    return;
+  }
+#endif
   (void)argv;
   if (argc > 0) {
-    chprintf(chp, "Usage: threads\r\n");
+    chprintf(chp, "Usage: threads [reset]\r\n");
     return;
   }
   chprintf(chp, "    addr    stack prio refs     state time\r\n");
@@ -393,6 +513,40 @@ static void cmd_threads(BaseSequentialStream *chp, int argc, char *argv[]) {
             states[tp->p_state], (uint32_t)tp->p_time);
     tp = chRegNextThread(tp);
   } while (tp != NULL);
+#if CH_DBG_THREADS_STATISTICS
+  {
+    ThreadStats ts;
+    uint64_t total = 0;
+    uint32_t cpm = halGetCounterFrequency() / 1000000;
+
+    /* Run times are printed as per-mille of the total and in
+       microseconds, latencies in microseconds.*/
+    tp = chRegFirstThread();
+    do {
+      chRegGetThreadStats(tp, &ts);
+      total += ts.ts_runtime;
+      tp = chRegNextThread(tp);
+    } while (tp != NULL);
+    if (total == 0)
+      total = 1;
+    chprintf(chp, "    addr     name load      run_us switches  lat_us"
+                  " stk_used/size\r\n");
+    tp = chRegFirstThread();
+    do {
+      const char *name = chRegGetThreadName(tp);
+
+      chRegGetThreadStats(tp, &ts);
+      chprintf(chp, "%.8lx %8s %4lu %11lu %8lu %7lu %8lu/%lu\r\n",
+               (uint32_t)tp, name != NULL ? name : "",
+               (uint32_t)((ts.ts_runtime * 1000) / total),
+               (uint32_t)(ts.ts_runtime / cpm), ts.ts_switches,
+               ts.ts_maxlatency / cpm,
+               (uint32_t)chRegGetStackHighWater(tp),
+               (uint32_t)ts.ts_stksize);
+      tp = chRegNextThread(tp);
+    } while (tp != NULL);
+  }
+#endif /* CH_DBG_THREADS_STATISTICS */
 }
 
 static void cmd_test(BaseSequentialStream *chp, int argc, char *argv[]) {
@@ -412,80 +566,164 @@ static void cmd_test(BaseSequentialStream *chp, int argc, char *argv[]) {
   chThdWait(tp);
 }
 
-static void cmd_reset(BaseSequentialStream *chp, int argc, char *argv[]) {
-  (void)argv;
+static void cmd_frames(BaseSequentialStream *chp, int argc, char *argv[]) {
+  ltdc_swapstats_t stats;
+  unsigned i;
+
+  if ((argc == 1) && (strcmp(argv[0], "reset") == 0)) {
+    ltdcSwapResetStats(&LTDCD1);
+    return;
+  }
   if (argc > 0) {
-    chprintf(chp, "Usage: reset\r\n");
+    chprintf(chp, "Usage: frames [reset]\r\n");
     return;
   }
-
-  chprintf(chp, "Will reset in 200ms\r\n");
-  chThdSleepMilliseconds(200);
-  NVIC_SystemReset();
+  ltdcSwapGetStats(&LTDCD1, &stats);
+  chprintf(chp, "presented %lu, flipped %lu, dropped %lu\r\n",
+           stats.presented, stats.flipped, stats.dropped);
+  chprintf(chp, "last frame %lu rects, %lu jobs, %lu bytes"
+                " (full redraw %lu bytes)\r\n",
+           comp.co_stats.cs_rects, comp.co_stats.cs_jobs,
+           comp.co_stats.cs_bytes, comp.co_stats.cs_full_bytes);
+  chprintf(chp, " frame time us    count\r\n");
+  for (i = 0; i < LTDC_SWAP_HISTOGRAM_BINS; ++i) {
+    if (i < LTDC_SWAP_HISTOGRAM_BINS - 1)
+      chprintf(chp, "%6u-%-6u %8lu\r\n", i * LTDC_SWAP_HISTOGRAM_STEP,
+               (i + 1) * LTDC_SWAP_HISTOGRAM_STEP, stats.histogram[i]);
+    else
+      chprintf(chp, "%6u-       %8lu\r\n", i * LTDC_SWAP_HISTOGRAM_STEP,
+               stats.histogram[i]);
+  }
 }
 
-static void cmd_write(BaseSequentialStream *chp, int argc, char *argv[]) {
-  uint32_t counter = 0;
-  uint8_t ubWritedata_8b = 0x3C;
-  uint32_t uwReadwritestatus = 0;
-  TimeMeasurement tm;
-
+static void cmd_probes(BaseSequentialStream *chp, int argc, char *argv[]) {
+  TimeProbe *pp;
 
-  (void)argv;
+  if ((argc == 1) && (strcmp(argv[0], "reset") == 0)) {
+    probesReset();
+    return;
+  }
+  if ((argc == 2) && (strcmp(argv[0], "reset") == 0)) {
+    if ((pp = probeFind(argv[1])) == NULL) {
+      chprintf(chp, "%s: no such probe\r\n", argv[1]);
+      return;
+    }
+    probeReset(pp);
+    return;
+  }
   if (argc > 0) {
-    chprintf(chp, "Usage: write\r\n");
+    chprintf(chp, "Usage: probes [reset [name]]\r\n");
     return;
   }
+  probesDump(chp);
+}
 
-  tmObjectInit(&tm);
+#if CH_DBG_TRACE_EVENTS
+static WORKING_AREA(waTrace, 512);
+static Thread *tracetp = NULL;
 
-  tmStartMeasurement(&tm);
+static void cmd_trace(BaseSequentialStream *chp, int argc, char *argv[]) {
+  static TraceStreamConfig trace_cfg;
+  int seconds = 10;
 
-  /* Write data value to all SDRAM memory */
-  for (counter = 0; counter < IS42S16400J_SIZE; counter++)
-  {
-    *(__IO uint8_t*) (SDRAM_BANK_ADDR + counter) = (uint8_t)(ubWritedata_8b + counter);
+  if (argc == 1)
+    seconds = atoi(argv[0]);
+  if ((argc > 1) || (seconds <= 0)) {
+    chprintf(chp, "Usage: trace [seconds]\r\n");
+    return;
   }
 
-  tmStopMeasurement(&tm);
-  uint32_t write_ms = RTT2MS(tm.last);
+  /* The shell channel is handed over to the trace stream, the shell is not
+     respawned until the streaming thread terminates after the specified
+     duration.*/
+  trace_cfg.tsc_channel   = chp;
+  trace_cfg.tsc_frequency = halGetCounterFrequency();
+  trace_cfg.tsc_duration  = S2ST(seconds);
+  tracetp = traceStreamCreateStatic(&trace_cfg, waTrace, sizeof(waTrace),
+                                    NORMALPRIO + 1);
+  shellExit(RDY_OK);
+}
+#endif /* CH_DBG_TRACE_EVENTS */
 
-  if (!uwReadwritestatus) {
-    chprintf(chp, "SDRAM written in %dms.\r\n", write_ms);
+static void cmd_reset(BaseSequentialStream *chp, int argc, char *argv[]) {
+  (void)argv;
+  if (argc > 0) {
+    chprintf(chp, "Usage: reset\r\n");
+    return;
   }
 
+  chprintf(chp, "Will reset in 200ms\r\n");
+  chThdSleepMilliseconds(200);
+  NVIC_SystemReset();
+}
+
+/*
+ * Parses the optional fill engine argument of the SDRAM commands.
+ */
+static bool_t sdram_get_engine(int argc, char *argv[],
+                               sdramengine_t *enginep) {
+
+  *enginep = SDRAM_ENGINE_DMA;
+  if (argc == 0)
+    return TRUE;
+  if (argc > 1)
+    return FALSE;
+  if (strcmp(argv[0], "cpu") == 0)
+    *enginep = SDRAM_ENGINE_CPU;
+  else if (strcmp(argv[0], "dma2d") == 0)
+    *enginep = SDRAM_ENGINE_DMA2D;
+  else if (strcmp(argv[0], "dma") != 0)
+    return FALSE;
+  return TRUE;
 }
 
-static void cmd_erase(BaseSequentialStream *chp, int argc, char *argv[]) {
-  uint32_t counter = 0;
-  uint32_t uwReadwritestatus = 0;
-  TimeMeasurement tm;
+static void sdram_print_report(BaseSequentialStream *chp, const char *what,
+                               const SDRAMReport *rp) {
+  uint32_t rate = sdramGetRate(rp);
+  uint32_t i;
+
+  chprintf(chp, "%s: %u errors, %ums, %u.%03u MB/s\r\n", what, rp->errors,
+           RTT2MS(rp->ticks), rate / 1000, rate % 1000);
+  for (i = 0; i < rp->errors && i < SDRAM_MAX_ERRORS; i++)
+    chprintf(chp, "  at 0x%08x, expected 0x%08x but read 0x%08x\r\n",
+             (uint32_t)rp->first[i].addressp, rp->first[i].expected,
+             rp->first[i].actual);
+}
 
+static void cmd_write(BaseSequentialStream *chp, int argc, char *argv[]) {
+  sdramengine_t engine;
+  SDRAMReport report;
 
-  (void)argv;
-  if (argc > 0) {
-    chprintf(chp, "Usage: erase\r\n");
+  if (!sdram_get_engine(argc, argv, &engine)) {
+    chprintf(chp, "Usage: write [cpu|dma|dma2d]\r\n");
     return;
   }
 
-  tmObjectInit(&tm);
-
-  //XXX tmStartMeasurement(&tm);
-
-  /* Write data value to all SDRAM memory */
-  /* Erase SDRAM memory */
-  for (counter = 0; counter < IS42S16400J_SIZE; counter++)
-  {
-    *(__IO uint8_t*) (SDRAM_BANK_ADDR + counter) = (uint8_t)0x0;
+  sdramReportInit(&report);
+  if (sdramFill((uint32_t *)SDRAM_BANK_ADDR, IS42S16400J_SIZE,
+                SDRAM_CHECK_PATTERN, engine, &report) != RDY_OK) {
+    chprintf(chp, "SDRAM write failed.\r\n");
+    return;
   }
+  sdram_print_report(chp, "SDRAM written", &report);
+}
 
-  //XXX tmStopMeasurement(&tm);
-  uint32_t write_ms = 0;//XXX RTT2MS(tm.last);
+static void cmd_erase(BaseSequentialStream *chp, int argc, char *argv[]) {
+  sdramengine_t engine;
+  SDRAMReport report;
 
-  if (!uwReadwritestatus) {
-    chprintf(chp, "SDRAM erased in %dms.\r\n", write_ms);
+  if (!sdram_get_engine(argc, argv, &engine)) {
+    chprintf(chp, "Usage: erase [cpu|dma|dma2d]\r\n");
+    return;
   }
 
+  sdramReportInit(&report);
+  if (sdramFill((uint32_t *)SDRAM_BANK_ADDR, IS42S16400J_SIZE,
+                0, engine, &report) != RDY_OK) {
+    chprintf(chp, "SDRAM erase failed.\r\n");
+    return;
+  }
+  sdram_print_report(chp, "SDRAM erased", &report);
 }
 
 static void cmd_selfrefresh(BaseSequentialStream *chp, int argc, char *argv[]) {
@@ -553,11 +791,7 @@ static void cmd_normal(BaseSequentialStream *chp, int argc, char *argv[]) {
 }
 
 static void cmd_check(BaseSequentialStream *chp, int argc, char *argv[]) {
-  uint32_t counter = 0;
-  uint8_t ubWritedata_8b = 0x3C, ubReaddata_8b = 0;
-  uint32_t uwReadwritestatus = 0;
-  TimeMeasurement tm;
-
+  SDRAMReport report;
 
   (void)argv;
   if (argc > 0) {
@@ -565,104 +799,195 @@ static void cmd_check(BaseSequentialStream *chp, int argc, char *argv[]) {
     return;
   }
 
-  tmObjectInit(&tm);
+  sdramReportInit(&report);
+  sdramVerify((const uint32_t *)SDRAM_BANK_ADDR, IS42S16400J_SIZE,
+              SDRAM_CHECK_PATTERN, &report);
+  sdram_print_report(chp, "SDRAM checked", &report);
+}
 
-  tmStartMeasurement(&tm);
+static void cmd_sdram(BaseSequentialStream *chp, int argc, char *argv[]) {
+  static const struct {
+    const char    *name;
+    sdramtest_t   test;
+  } tests[] = {
+    {"data", SDRAM_TEST_DATA_BUS},
+    {"address", SDRAM_TEST_ADDRESS_BUS},
+    {"aliasing", SDRAM_TEST_ADDRESS},
+    {"march", SDRAM_TEST_MARCH}
+  };
+  SDRAMReport report;
+  unsigned i;
+  bool_t found = FALSE;
 
-  /* Read back SDRAM memory and check content correctness*/
-  counter = 0;
-  uwReadwritestatus = 0;
-  while ((counter < IS42S16400J_SIZE) && (uwReadwritestatus == 0))
-  {
-    ubReaddata_8b = *(__IO uint8_t*)(SDRAM_BANK_ADDR + counter);
-    if ( ubReaddata_8b != (uint8_t)(ubWritedata_8b + counter))
-    {
-      uwReadwritestatus = 1;
-      chprintf(chp, "Error at %d, expected %d but read %d.\r\n", counter, ubWritedata_8b + counter, ubReaddata_8b);
+  if (argc > 1) {
+    chprintf(chp, "Usage: sdram [data|address|aliasing|march]\r\n");
+    return;
+  }
+
+  for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+    if ((argc == 0) || (strcmp(argv[0], tests[i].name) == 0)) {
+      found = TRUE;
+      sdramReportInit(&report);
+      sdramTest((uint32_t *)SDRAM_BANK_ADDR, IS42S16400J_SIZE,
+                tests[i].test, SDRAM_ENGINE_DMA, &report);
+      sdram_print_report(chp, tests[i].name, &report);
     }
-    counter++;
   }
+  if (!found)
+    chprintf(chp, "Usage: sdram [data|address|aliasing|march]\r\n");
+}
 
-  tmStopMeasurement(&tm);
-  uint32_t check_ms = RTT2MS(tm.last);
+/*
+ * Raster kernels against the DMA2D, on square RGB-888 rectangles. The word
+ * parallel kernels output is checked against the reference kernels one.
+ */
+#define RASTER_BENCH_MAX             64
+#define RASTER_BENCH_RUNS            4
+#define RASTER_BENCH_COLOR           0x3C3CC3
+
+static uint32_t raster_src[RASTER_BENCH_MAX * RASTER_BENCH_MAX]
+  __attribute__((section(".sdram")));
+static uint8_t raster_src_l8[RASTER_BENCH_MAX * RASTER_BENCH_MAX]
+  __attribute__((section(".sdram")));
+static uint8_t raster_dst[2][RASTER_BENCH_MAX * RASTER_BENCH_MAX * 3]
+  __attribute__((section(".sdram"), aligned(4)));
+
+static const struct {
+  const char        *name;
+  dma2d_jobmode_t   mode;
+  dma2d_pixfmt_t    fmt;
+} raster_ops[] = {
+  {"fill", DMA2D_JOB_CONST, DMA2D_FMT_ARGB8888},
+  {"copy", DMA2D_JOB_COPY, DMA2D_FMT_RGB888},
+  {"convert", DMA2D_JOB_CONVERT, DMA2D_FMT_ARGB8888},
+  {"expand", DMA2D_JOB_CONVERT, DMA2D_FMT_L8},
+  {"blend", DMA2D_JOB_BLEND, DMA2D_FMT_ARGB8888}
+};
 
-  //FIXME time this
-  if (!uwReadwritestatus) {
-    chprintf(chp, "SDRAM read and check completed successfully in %dms.\r\n", check_ms);
+static void raster_bench_cpu(unsigned op, bool_t ref, uint8_t *dstp,
+                             uint16_t n) {
+  size_t pitch = n * 3;
+
+  switch (op) {
+  case 0:
+    (ref ? rasterRefFill : rasterFill)(dstp, pitch, RASTER_FMT_RGB888,
+                                       n, n, RASTER_BENCH_COLOR);
+    break;
+  case 1:
+    (ref ? rasterRefCopy : rasterCopy)(dstp, pitch, raster_src, pitch,
+                                       RASTER_FMT_RGB888, n, n);
+    break;
+  case 2:
+    (ref ? rasterRefConvert : rasterConvert)(dstp, pitch, RASTER_FMT_RGB888,
+                                             raster_src, n * 4,
+                                             RASTER_FMT_ARGB8888, n, n);
+    break;
+  case 3:
+    (ref ? rasterRefExpand : rasterExpand)(dstp, pitch, RASTER_FMT_RGB888,
+                                           raster_src_l8, n, wolf3d_palette,
+                                           n, n);
+    break;
+  default:
+    (ref ? rasterRefBlend : rasterBlend)(dstp, pitch, RASTER_FMT_RGB888,
+                                         raster_src, n * 4, n, n, 0xFF);
+    break;
   }
+}
 
+static void raster_bench_dma2d(unsigned op, uint8_t *dstp, uint16_t n) {
+  dma2d_job_t *jobp = dma2dJobAlloc(&DMA2DD1);
+
+  jobp->mode = raster_ops[op].mode;
+  jobp->width = n;
+  jobp->height = n;
+  jobp->out.bufferp = dstp;
+  jobp->out.wrap_offset = 0;
+  jobp->out.fmt = DMA2D_FMT_RGB888;
+  jobp->out.def_color = RASTER_BENCH_COLOR;
+  jobp->out.const_alpha = 0xFF;
+  jobp->out.palettep = NULL;
+  jobp->fg.bufferp = op == 3 ? (void *)raster_src_l8 : (void *)raster_src;
+  jobp->fg.wrap_offset = 0;
+  jobp->fg.fmt = raster_ops[op].fmt;
+  jobp->fg.def_color = 0;
+  jobp->fg.const_alpha = 0xFF;
+  jobp->fg.palettep = op == 3 ? &dma2d_palcfg : NULL;
+  jobp->fg_amode = DMA2D_ALPHA_KEEP;
+  jobp->bg = jobp->out;
+  jobp->bg_amode = DMA2D_ALPHA_KEEP;
+  jobp->callback = NULL;
+  jobp->arg = NULL;
+#if CH_USE_EVENTS
+  jobp->esp = NULL;
+#endif
+  dma2dJobSubmit(&DMA2DD1, jobp);
+  dma2dQueueWait(&DMA2DD1);
 }
 
-static void cmd_sdram(BaseSequentialStream *chp, int argc, char *argv[]) {
-  uint32_t counter = 0;
-  uint8_t ubWritedata_8b = 0x3C, ubReaddata_8b = 0;
-  uint32_t uwReadwritestatus = 0;
-  TimeMeasurement tm;
+/* Best of a few runs, the renderer thread shares the CPU and the DMA2D.
+   The engine is the DMA2D if negative, else the reference kernels flag.*/
+static halrtcnt_t raster_bench_time(unsigned op, int engine, uint8_t *dstp,
+                                    uint16_t n) {
+  halrtcnt_t best = (halrtcnt_t)-1, t;
+  unsigned i;
+
+  for (i = 0; i < RASTER_BENCH_RUNS; i++) {
+    rasterFill(dstp, n * 3, RASTER_FMT_RGB888, n, n, 0x808080);
+    t = halGetCounterValue();
+    if (engine < 0)
+      raster_bench_dma2d(op, dstp, n);
+    else
+      raster_bench_cpu(op, (bool_t)engine, dstp, n);
+    t = halGetCounterValue() - t;
+    if (t < best)
+      best = t;
+  }
+  return best;
+}
 
+static void cmd_raster(BaseSequentialStream *chp, int argc, char *argv[]) {
+  unsigned i, op;
+  uint16_t n;
+  halrtcnt_t ref, simd, dma2d;
 
   (void)argv;
   if (argc > 0) {
-    chprintf(chp, "Usage: sdram\r\n");
+    chprintf(chp, "Usage: raster\r\n");
     return;
   }
 
-  tmObjectInit(&tm);
-
-  tmStartMeasurement(&tm);
-
-//  /* Erase SDRAM memory */
-//  for (counter = 0; counter < IS42S16400J_SIZE; counter++)
-//  {
-//    *(__IO uint8_t*) (SDRAM_BANK_ADDR + counter) = (uint8_t)0x0;
-//  }
-
-  /* Write data value to all SDRAM memory */
-  for (counter = 0; counter < IS42S16400J_SIZE; counter++)
-  {
-    *(__IO uint8_t*) (SDRAM_BANK_ADDR + counter) = (uint8_t)(ubWritedata_8b + counter);
-  }
-
-  tmStopMeasurement(&tm);
-  uint32_t write_ms = RTT2MS(tm.last);
-
-  tmStartMeasurement(&tm);
-
-  /* Read back SDRAM memory */
-  counter = 0;
-  while ((counter < IS42S16400J_SIZE))
-  {
-    ubReaddata_8b = *(__IO uint8_t*)(SDRAM_BANK_ADDR + counter);
-    counter++;
+  /* Translucent sources, some pixels are fully transparent or opaque.*/
+  for (i = 0; i < RASTER_BENCH_MAX * RASTER_BENCH_MAX; i++) {
+    raster_src[i] = i * 0x9E3779B9U;
+    raster_src_l8[i] = (uint8_t)(i * 7);
   }
 
-  tmStopMeasurement(&tm);
-  uint32_t read_ms = RTT2MS(tm.last);
-
-  /* Read back SDRAM memory and check content correctness*/
-  counter = 0;
-  uwReadwritestatus = 0;
-  while ((counter < IS42S16400J_SIZE) && (uwReadwritestatus == 0))
-  {
-    ubReaddata_8b = *(__IO uint8_t*)(SDRAM_BANK_ADDR + counter);
-    if ( ubReaddata_8b != (uint8_t)(ubWritedata_8b + counter))
-    {
-      uwReadwritestatus = 1;
-      chprintf(chp, "Error at %d, expected %d but read %d.\r\n", counter, ubWritedata_8b + counter, ubReaddata_8b);
+  chprintf(chp, "op       size      ref     simd    dma2d  (cycles)\r\n");
+  for (op = 0; op < sizeof(raster_ops) / sizeof(raster_ops[0]); op++) {
+    for (n = 8; n <= RASTER_BENCH_MAX; n *= 2) {
+      ref = raster_bench_time(op, TRUE, raster_dst[1], n);
+      simd = raster_bench_time(op, FALSE, raster_dst[0], n);
+      chprintf(chp, "%-8s %2ux%-2u %8u %8u",
+               raster_ops[op].name, n, n, ref, simd);
+      if (memcmp(raster_dst[0], raster_dst[1], n * n * 3) != 0)
+        chprintf(chp, " MISMATCH");
+      dma2d = raster_bench_time(op, -1, raster_dst[0], n);
+      chprintf(chp, " %8u\r\n", dma2d);
     }
-    counter++;
-  }
-
-  if (!uwReadwritestatus) {
-    chprintf(chp, "SDRAM test completed successfully, writing entire memory took %dms, reading it took %dms.\r\n", write_ms, read_ms);
   }
-
 }
 
 static const ShellCommand commands[] = {
   {"mem", cmd_mem},
   {"threads", cmd_threads},
   {"test", cmd_test},
+  {"frames", cmd_frames},
+  {"probes", cmd_probes},
+#if CH_DBG_TRACE_EVENTS
+  {"trace", cmd_trace},
+#endif
   {"sdram", cmd_sdram},
+  {"raster", cmd_raster},
   {"reset", cmd_reset},
   {"write", cmd_write},
   {"check", cmd_check},
@@ -701,6 +1026,11 @@ int main(void) {
   halInit();
   chSysInit();
 
+  /*
+   * Time probes calibration.
+   */
+  probesInit();
+
   /*
    * Shell manager initialization.
    */
@@ -733,7 +1063,17 @@ int main(void) {
    * Initialise SDRAM, board.h has already configured GPIO correctly (except that ST example uses 50MHz not 100MHz?)
    */
   SDRAM_Init();
-  sdram_bulk_erase();
+  sdramFill((uint32_t *)SDRAM_BANK_ADDR, IS42S16400J_SIZE, 0,
+            SDRAM_ENGINE_DMA, NULL);
+
+  /*
+   * Unpacks the splashscreen into SDRAM and its palette for the LTDC and
+   * DMA2D CLUTs.
+   */
+  if (assetDecode(wolf3d_assets, ASSET_SPLASH, splash_buffer, 0) ||
+      assetLoadClut(wolf3d_assets, ASSET_PALETTE, wolf3d_palette, 256,
+                    &dma2d_palcfg))
+    chSysHalt();
 
   /*
    * Activates the LCD-related drivers.
@@ -747,7 +1087,6 @@ int main(void) {
    * Activates the DMA2D-related drivers.
    */
   dma2dStart(&DMA2DD1, &dma2d_cfg);
-  dma2d_test();
 
   /*
    * Creating the blinker threads.
@@ -757,11 +1096,28 @@ int main(void) {
   chThdCreateStatic(waThread2, sizeof(waThread2), NORMALPRIO + 10,
                     Thread2, NULL);
 
+  /*
+   * Creating the renderer thread, below the control threads.
+   */
+  chThdCreateStatic(waRender, sizeof(waRender), NORMALPRIO - 1,
+                    Render, NULL);
+
   /*
    * Normal main() thread activity, in this demo it just performs
    * a shell respawn upon its termination.
    */
   while (TRUE) {
+#if CH_DBG_TRACE_EVENTS
+    if (tracetp != NULL) {
+      /* The channel is owned by the trace stream until it terminates.*/
+      if (!chThdTerminated(tracetp)) {
+        chThdSleepMilliseconds(500);
+        continue;
+      }
+      chThdWait(tracetp);
+      tracetp = NULL;
+    }
+#endif
     if (!shelltp) {
 #if HAL_USE_SERIAL_USB
       if (SDU1.config->usbp->state == USB_ACTIVE) {
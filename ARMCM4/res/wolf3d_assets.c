@@ -0,0 +1,1414 @@
+/* Generated by assetpack.py, do not edit manually.*/
+
+#include <stdint.h>
+
+#include "wolf3d_assets.h"
+
+/* SPLASH: chunk87.bin, 200x320, lz4 64000 -> 21735 bytes.*/
+/* PALETTE: wolf3d_palette.gif, 256x1, lz4 768 -> 679 bytes.*/
+const uint8_t wolf3d_assets[22464] __attribute__((aligned(4))) = {
+  0x41, 0x53, 0x45, 0x54, 0x01, 0x00, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE7, 0x54, 0x00, 0x00,
+  0x00, 0xFA, 0x00, 0x00, 0xC8, 0x00, 0x40, 0x01, 0x02, 0x01, 0x00, 0x00, 0x18, 0x55, 0x00, 0x00,
+  0xA7, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x04, 0x00, 0x00,
+  0x17, 0x00, 0x01, 0x00, 0x1F, 0x9F, 0x01, 0x00, 0x00, 0x08, 0x20, 0x00, 0x02, 0x22, 0x00, 0x8A,
+  0x9D, 0x9D, 0x9D, 0x1F, 0x1F, 0x9E, 0x9E, 0x9E, 0x1A, 0x00, 0x08, 0x01, 0x00, 0xA1, 0x9D, 0x9D,
+  0xE9, 0xE9, 0x9E, 0x9E, 0xE9, 0xE9, 0x9D, 0x9D, 0x43, 0x00, 0x40, 0x9E, 0x9E, 0x9D, 0x9D, 0x17,
+  0x00, 0x60, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x06, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01, 0x00,
+  0x20, 0x9C, 0x9C, 0x48, 0x00, 0x02, 0x12, 0x00, 0x00, 0x07, 0x00, 0x23, 0xE8, 0xE8, 0x1F, 0x00,
+  0x01, 0x01, 0x00, 0x8F, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x1F, 0xED, 0x1D, 0x01, 0x00, 0x11, 0x0E,
+  0xA8, 0x00, 0x0F, 0xC8, 0x00, 0x0D, 0x7F, 0x00, 0x00, 0x00, 0x9E, 0x9E, 0x1F, 0x1F, 0xC7, 0x00,
+  0x07, 0x01, 0x28, 0x00, 0x00, 0x85, 0x00, 0x00, 0xB5, 0x00, 0x03, 0xCA, 0x00, 0x04, 0xC8, 0x00,
+  0x01, 0xAB, 0x00, 0x30, 0x00, 0x00, 0xE8, 0x1F, 0x00, 0x01, 0xB5, 0x00, 0x00, 0x50, 0x00, 0x03,
+  0xC5, 0x00, 0x04, 0x01, 0x00, 0x00, 0x11, 0x00, 0x01, 0x10, 0x00, 0x6F, 0xE8, 0xE8, 0xE9, 0x9E,
+  0x9E, 0x1E, 0xC8, 0x00, 0x21, 0x0E, 0xCA, 0x00, 0x0F, 0xC8, 0x00, 0x04, 0x0F, 0xC6, 0x00, 0x0A,
+  0x00, 0x29, 0x00, 0x02, 0xC8, 0x00, 0x36, 0xE8, 0xE9, 0xE8, 0xC8, 0x00, 0x20, 0x00, 0xE9, 0x04,
+  0x00, 0x02, 0xC8, 0x00, 0x03, 0x01, 0x00, 0x02, 0xC8, 0x00, 0x07, 0x91, 0x01, 0x01, 0xC4, 0x00,
+  0x04, 0x11, 0x00, 0x10, 0xE9, 0xD7, 0x01, 0x0F, 0xC8, 0x00, 0x24, 0x0C, 0xC9, 0x00, 0x0F, 0xB1,
+  0x00, 0x0D, 0x0F, 0x01, 0x00, 0x05, 0x05, 0xAD, 0x00, 0x08, 0x90, 0x01, 0x06, 0xA2, 0x00, 0x01,
+  0xC4, 0x00, 0x4F, 0xE8, 0xE8, 0x9C, 0x9C, 0x62, 0x00, 0x0E, 0x2F, 0x1E, 0xEE, 0xC8, 0x00, 0x23,
+  0x0B, 0xC9, 0x00, 0x0F, 0x66, 0x00, 0x0C, 0x0F, 0x01, 0x00, 0x08, 0x02, 0xED, 0x02, 0x07, 0x58,
+  0x02, 0x00, 0xDC, 0x00, 0x02, 0x72, 0x01, 0x05, 0x0A, 0x03, 0x0F, 0xC8, 0x00, 0x4C, 0x0F, 0x5B,
+  0x00, 0x0C, 0x0F, 0x01, 0x00, 0x5A, 0x0F, 0xC8, 0x00, 0x26, 0x0F, 0x01, 0x00, 0x7C, 0x0F, 0xC8,
+  0x00, 0x5F, 0x0F, 0xC3, 0x04, 0x0B, 0x0B, 0x01, 0x00, 0x04, 0xEA, 0x03, 0x0F, 0x01, 0x00, 0x06,
+  0x04, 0x23, 0x00, 0x0F, 0xE8, 0x03, 0x25, 0x0F, 0x01, 0x00, 0x23, 0x01, 0xC4, 0x00, 0x4F, 0x1F,
+  0x00, 0x00, 0x1F, 0x91, 0x05, 0x0C, 0x05, 0x01, 0x00, 0x2F, 0x9F, 0x9E, 0x01, 0x00, 0x0B, 0x0F,
+  0xC8, 0x00, 0x38, 0x06, 0x1C, 0x01, 0x0F, 0x56, 0x06, 0x0C, 0x01, 0x01, 0x00, 0x00, 0xC0, 0x00,
+  0x10, 0x1E, 0xC9, 0x00, 0x14, 0x1E, 0xCA, 0x00, 0x0F, 0x6B, 0x01, 0x08, 0x00, 0xC8, 0x00, 0x40,
+  0x9D, 0x9D, 0x9D, 0x9D, 0x23, 0x07, 0x40, 0x9C, 0x9D, 0x9C, 0x9C, 0x0C, 0x00, 0x10, 0x9C, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xC8, 0x00, 0x2F, 0x9E, 0x9E, 0x90, 0x01, 0x33,
+  0x09, 0x7A, 0x00, 0x03, 0xCA, 0x04, 0x04, 0x44, 0x06, 0x0D, 0xC8, 0x00, 0x40, 0x1F, 0x1F, 0x00,
+  0x1F, 0xC9, 0x00, 0x14, 0x1E, 0xC9, 0x00, 0x0D, 0xFE, 0x00, 0x00, 0xB9, 0x04, 0x39, 0x9E, 0x9F,
+  0x9F, 0xC8, 0x00, 0x00, 0xBA, 0x00, 0x02, 0xC2, 0x00, 0x0F, 0xC8, 0x00, 0x48, 0x03, 0xCA, 0x00,
+  0x06, 0x0F, 0x00, 0x01, 0xC2, 0x00, 0x2D, 0x9F, 0x00, 0xC8, 0x00, 0x01, 0x4F, 0x02, 0x42, 0x1F,
+  0x1E, 0x00, 0x1E, 0xC9, 0x00, 0x04, 0x3D, 0x00, 0x10, 0x9E, 0x9D, 0x00, 0x04, 0x77, 0x01, 0x11,
+  0x9C, 0xA0, 0x00, 0x33, 0x9E, 0x9E, 0x9D, 0xC8, 0x00, 0x00, 0xD3, 0x00, 0x10, 0x9E, 0xE8, 0x08,
+  0x01, 0xC1, 0x00, 0x01, 0x1A, 0x00, 0x00, 0x01, 0x00, 0x21, 0x9B, 0x9B, 0x0E, 0x00, 0x10, 0xE8,
+  0x6E, 0x07, 0x0F, 0x20, 0x03, 0x39, 0x08, 0xC7, 0x00, 0x05, 0xCF, 0x00, 0x0E, 0x13, 0x00, 0x01,
+  0x8F, 0x01, 0x10, 0x1D, 0x55, 0x02, 0x01, 0x91, 0x01, 0x02, 0x27, 0x03, 0x01, 0xBF, 0x00, 0x02,
+  0xC9, 0x00, 0x12, 0x9E, 0xC8, 0x00, 0x00, 0xAF, 0x00, 0x07, 0xC8, 0x00, 0x00, 0x01, 0x00, 0x07,
+  0xC8, 0x00, 0x00, 0x24, 0x00, 0x0C, 0xC8, 0x00, 0x0F, 0x60, 0x09, 0x22, 0x0F, 0x01, 0x00, 0x28,
+  0x00, 0x19, 0x03, 0x75, 0x1D, 0x1F, 0x1D, 0x1F, 0x00, 0x00, 0x1E, 0xC9, 0x00, 0x13, 0xE8, 0x9C,
+  0x00, 0x00, 0xC9, 0x00, 0x33, 0x9B, 0x9B, 0x9B, 0x73, 0x01, 0x02, 0xC8, 0x00, 0x04, 0xC9, 0x00,
+  0x06, 0xC7, 0x00, 0x31, 0x9B, 0x9B, 0x9B, 0xEC, 0x00, 0x22, 0x99, 0x99, 0xC8, 0x00, 0x00, 0x93,
+  0x0A, 0x00, 0xC8, 0x00, 0x0F, 0x79, 0x05, 0x12, 0x0F, 0xC1, 0x00, 0x2F, 0x04, 0x01, 0x00, 0x00,
+  0xC9, 0x00, 0x00, 0xC8, 0x00, 0x12, 0x1F, 0x22, 0x03, 0x02, 0xC8, 0x00, 0x00, 0xC6, 0x03, 0x01,
+  0xC8, 0x00, 0x41, 0x9B, 0x9B, 0x9B, 0x9B, 0x48, 0x02, 0x0B, 0xC8, 0x00, 0x04, 0x17, 0x03, 0x01,
+  0xC7, 0x00, 0x2F, 0x9B, 0x9B, 0xC8, 0x00, 0x70, 0x30, 0x00, 0x00, 0x1E, 0x90, 0x01, 0x03, 0x59,
+  0x02, 0x02, 0xC9, 0x00, 0x00, 0xE9, 0x09, 0x10, 0x9E, 0xA8, 0x00, 0x00, 0xA4, 0x00, 0x02, 0x48,
+  0x02, 0x07, 0xC8, 0x00, 0x11, 0x9D, 0x05, 0x0C, 0x01, 0xC7, 0x00, 0x00, 0x19, 0x00, 0x01, 0xC9,
+  0x00, 0x03, 0xCE, 0x00, 0x02, 0xC8, 0x00, 0x00, 0xBF, 0x08, 0x0F, 0xC8, 0x00, 0x60, 0x00, 0xC9,
+  0x00, 0x01, 0x98, 0x01, 0x04, 0x90, 0x01, 0x10, 0x00, 0x79, 0x0B, 0x00, 0xC8, 0x00, 0x12, 0x9C,
+  0x56, 0x02, 0x01, 0x01, 0x00, 0x07, 0xC8, 0x00, 0x03, 0xAC, 0x04, 0x1F, 0x9D, 0xC8, 0x00, 0x7D,
+  0x00, 0x01, 0x00, 0x09, 0x90, 0x01, 0x22, 0x00, 0xE8, 0x49, 0x05, 0x02, 0xB1, 0x00, 0x06, 0xE3,
+  0x06, 0x02, 0x95, 0x05, 0x00, 0xC9, 0x00, 0x02, 0x3F, 0x03, 0x00, 0x52, 0x0D, 0x00, 0xBF, 0x00,
+  0x01, 0xB0, 0x04, 0x10, 0x9B, 0x17, 0x04, 0x01, 0xC8, 0x00, 0x00, 0xEA, 0x03, 0x1F, 0x1F, 0x99,
+  0x08, 0x13, 0x0F, 0xB8, 0x00, 0x2E, 0x09, 0x01, 0x00, 0x00, 0x74, 0x05, 0x03, 0x0A, 0x07, 0x14,
+  0x1F, 0xC9, 0x00, 0x02, 0x43, 0x0E, 0x01, 0x79, 0x01, 0x0C, 0xC8, 0x00, 0x02, 0x6A, 0x05, 0x31,
+  0x9D, 0x9D, 0xE8, 0xC8, 0x00, 0x02, 0x0C, 0x00, 0x0F, 0xC8, 0x00, 0x72, 0x00, 0xAC, 0x04, 0x13,
+  0x00, 0x08, 0x07, 0x02, 0x06, 0x00, 0x01, 0xC8, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xC6, 0x00, 0x03,
+  0xB6, 0x00, 0x00, 0x18, 0x00, 0x00, 0xA5, 0x00, 0x02, 0xE1, 0x00, 0x14, 0x9D, 0x31, 0x08, 0x03,
+  0xCF, 0x04, 0x00, 0x82, 0x02, 0x31, 0x9F, 0x9F, 0x9E, 0xE1, 0x0B, 0x0F, 0x41, 0x06, 0x17, 0x0F,
+  0xB7, 0x00, 0x2B, 0x0C, 0x01, 0x00, 0x10, 0x1F, 0x1D, 0x03, 0x04, 0x0D, 0x00, 0x20, 0x1D, 0x1C,
+  0x06, 0x00, 0x51, 0x9D, 0x9F, 0x9F, 0xE8, 0xE8, 0x7A, 0x04, 0x00, 0xA0, 0x07, 0x38, 0x9D, 0x9B,
+  0x9B, 0xC8, 0x00, 0x21, 0x9F, 0x9F, 0x24, 0x06, 0x03, 0x6D, 0x0D, 0x01, 0xC8, 0x00, 0x01, 0x8E,
+  0x01, 0x0F, 0xC8, 0x00, 0x5D, 0x01, 0xC7, 0x07, 0x09, 0x1A, 0x0A, 0x02, 0xC8, 0x00, 0x00, 0xCF,
+  0x00, 0x30, 0x1E, 0x1F, 0x1F, 0xC9, 0x00, 0x20, 0x9D, 0x9D, 0xC8, 0x00, 0x11, 0x9F, 0xAF, 0x00,
+  0x00, 0xC7, 0x00, 0x03, 0xC8, 0x00, 0x02, 0x4A, 0x0D, 0x01, 0x67, 0x02, 0x00, 0xE0, 0x00, 0x05,
+  0xC7, 0x00, 0x20, 0x9D, 0x9B, 0x18, 0x04, 0x02, 0xC8, 0x00, 0x00, 0xDE, 0x00, 0x0F, 0x90, 0x01,
+  0x54, 0x10, 0x1F, 0x01, 0x00, 0x0A, 0x12, 0x00, 0x00, 0x9B, 0x08, 0x04, 0x0D, 0x00, 0x11, 0x1C,
+  0xC8, 0x00, 0x02, 0x90, 0x00, 0x21, 0xE8, 0xE8, 0xAE, 0x07, 0x12, 0x9B, 0x20, 0x03, 0x06, 0xC8,
+  0x00, 0x01, 0x01, 0x00, 0x24, 0x9F, 0xE8, 0xC8, 0x00, 0x00, 0xED, 0x0E, 0x0F, 0xC8, 0x00, 0x2A,
+  0x0F, 0x73, 0x0B, 0x16, 0x09, 0xB6, 0x00, 0x04, 0x83, 0x08, 0x09, 0x15, 0x00, 0x02, 0x07, 0x00,
+  0x10, 0x1E, 0x2D, 0x03, 0x03, 0x41, 0x02, 0x01, 0x8F, 0x01, 0x03, 0x47, 0x06, 0x02, 0xE9, 0x08,
+  0x00, 0xC9, 0x00, 0x00, 0x56, 0x02, 0x03, 0xFC, 0x03, 0x00, 0x74, 0x02, 0x03, 0x2D, 0x03, 0x10,
+  0xE8, 0xAB, 0x05, 0x02, 0x58, 0x02, 0x00, 0x25, 0x00, 0x0F, 0xC8, 0x00, 0x1A, 0x01, 0x58, 0x01,
+  0x0C, 0x92, 0x00, 0x0F, 0xD9, 0x00, 0x11, 0x05, 0x4C, 0x09, 0x0C, 0x18, 0x00, 0x91, 0x1E, 0x00,
+  0x00, 0x1D, 0x1E, 0x1D, 0x1E, 0x00, 0xE8, 0x32, 0x02, 0x07, 0x8F, 0x01, 0x04, 0xC8, 0x00, 0x00,
+  0x17, 0x03, 0x02, 0xB6, 0x00, 0x03, 0x5D, 0x02, 0x04, 0xC7, 0x00, 0x0F, 0xC8, 0x00, 0x27, 0x01,
+  0x9F, 0x03, 0x01, 0x01, 0x00, 0x01, 0x32, 0x05, 0x04, 0xD1, 0x00, 0x0E, 0xDA, 0x00, 0x0F, 0xB1,
+  0x00, 0x02, 0x0B, 0x26, 0x00, 0x32, 0xDF, 0xDF, 0xDF, 0x18, 0x00, 0x13, 0x1D, 0xC9, 0x00, 0x04,
+  0xA8, 0x00, 0x02, 0x95, 0x0B, 0x03, 0xC8, 0x00, 0x01, 0xC4, 0x03, 0x06, 0xC8, 0x00, 0x00, 0xB6,
+  0x01, 0x15, 0x9C, 0xC7, 0x00, 0x0F, 0xC8, 0x00, 0x26, 0x01, 0xC4, 0x00, 0x50, 0xED, 0xED, 0xED,
+  0xED, 0x1E, 0x94, 0x00, 0x01, 0xA4, 0x03, 0x04, 0x32, 0x09, 0x0F, 0xC9, 0x00, 0x10, 0x01, 0xCA,
+  0x00, 0x02, 0x29, 0x00, 0x52, 0xDF, 0xDF, 0xDE, 0xDD, 0xDD, 0xCA, 0x00, 0x01, 0xC9, 0x00, 0x00,
+  0x62, 0x00, 0x10, 0xE8, 0x97, 0x00, 0x00, 0x70, 0x01, 0x01, 0x65, 0x0C, 0x05, 0x90, 0x01, 0x25,
+  0xE9, 0xE9, 0xC8, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC4, 0x07, 0x07, 0xB6, 0x0D, 0x0F, 0xC8, 0x00,
+  0x21, 0x00, 0x8E, 0x01, 0x00, 0xC5, 0x00, 0x01, 0xC9, 0x00, 0x00, 0x93, 0x01, 0x22, 0xEE, 0xEE,
+  0xCA, 0x00, 0x00, 0x9A, 0x07, 0x0F, 0x5C, 0x02, 0x11, 0x01, 0x27, 0x00, 0x00, 0x29, 0x00, 0xB0,
+  0xDD, 0xDF, 0xDC, 0xDC, 0xDD, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE, 0xDF, 0xA6, 0x08, 0x00, 0x39, 0x0A,
+  0x00, 0xC9, 0x00, 0x00, 0x03, 0x07, 0x13, 0x9F, 0xC8, 0x00, 0x03, 0x40, 0x06, 0x00, 0xA5, 0x00,
+  0x01, 0x76, 0x05, 0x02, 0xC7, 0x00, 0x34, 0xE9, 0xE9, 0xE9, 0xC8, 0x00, 0x02, 0x87, 0x09, 0x0F,
+  0xC8, 0x00, 0x20, 0x02, 0xC7, 0x00, 0x03, 0x36, 0x07, 0x82, 0xEE, 0xEE, 0x1E, 0x00, 0x00, 0xEE,
+  0x1D, 0x1D, 0x64, 0x02, 0x00, 0x8B, 0x00, 0x0F, 0xC8, 0x00, 0x0F, 0x04, 0x01, 0x00, 0xC2, 0xDF,
+  0xDD, 0xDF, 0xDE, 0xDC, 0xDD, 0xDF, 0xDD, 0xDB, 0xDB, 0xDB, 0xDB, 0xC9, 0x00, 0x01, 0x60, 0x00,
+  0x20, 0x1E, 0x00, 0x06, 0x07, 0x01, 0xF4, 0x06, 0x02, 0x2F, 0x06, 0x03, 0xC7, 0x00, 0x00, 0xCA,
+  0x00, 0x03, 0x83, 0x01, 0x00, 0x0C, 0x00, 0x03, 0x56, 0x02, 0x03, 0x45, 0x0F, 0x02, 0xC8, 0x00,
+  0x00, 0x20, 0x00, 0x0F, 0xC8, 0x00, 0x17, 0x11, 0x1E, 0x2B, 0x00, 0x12, 0xEC, 0x01, 0x00, 0x70,
+  0x1D, 0xEE, 0x1E, 0x1F, 0x1D, 0x1C, 0xEC, 0xCA, 0x00, 0x12, 0x1F, 0x53, 0x01, 0x0F, 0xC2, 0x00,
+  0x10, 0x01, 0x9A, 0x04, 0x70, 0xDF, 0xDF, 0xDD, 0xDF, 0xDC, 0xDD, 0xDD, 0xC7, 0x00, 0x82, 0xDE,
+  0xDC, 0xDA, 0xDA, 0xDA, 0xDD, 0x00, 0x1C, 0x64, 0x00, 0x32, 0x1E, 0x00, 0x1F, 0xF5, 0x06, 0x09,
+  0x5C, 0x0E, 0x01, 0x95, 0x13, 0x10, 0xE8, 0xEA, 0x15, 0x08, 0x5F, 0x02, 0x02, 0xC7, 0x00, 0x21,
+  0x9D, 0x9D, 0xC8, 0x00, 0x01, 0x11, 0x00, 0x0F, 0xC8, 0x00, 0x18, 0x02, 0xC7, 0x00, 0x12, 0x1C,
+  0x01, 0x00, 0x10, 0x1D, 0xC8, 0x00, 0x30, 0x1C, 0x1C, 0xEC, 0xC3, 0x00, 0x26, 0x1E, 0x1D, 0x91,
+  0x01, 0x05, 0xFC, 0x09, 0x0F, 0xCA, 0x00, 0x03, 0x02, 0xC7, 0x00, 0x81, 0xDC, 0xDD, 0xDA, 0xD8,
+  0xD9, 0xDB, 0xDE, 0xDA, 0x01, 0x00, 0x32, 0xDD, 0x00, 0x1C, 0xCA, 0x00, 0x20, 0x1E, 0x00, 0x22,
+  0x06, 0x0D, 0x5A, 0x0E, 0x00, 0x5D, 0x14, 0x02, 0xBB, 0x00, 0x03, 0xEF, 0x03, 0x02, 0x12, 0x07,
+  0x05, 0xC8, 0x00, 0x02, 0xA0, 0x01, 0x0F, 0xC8, 0x00, 0x14, 0x13, 0x1F, 0xC7, 0x00, 0x40, 0x1C,
+  0x1C, 0x1C, 0xEA, 0x01, 0x00, 0x00, 0xC9, 0x00, 0x70, 0x1D, 0x1C, 0x1B, 0xEA, 0x1C, 0xEC, 0x1E,
+  0xD1, 0x00, 0x14, 0x1D, 0x68, 0x08, 0x03, 0xFA, 0x03, 0x0F, 0xC9, 0x00, 0x06, 0x40, 0x00, 0xDF,
+  0xDD, 0xDD, 0x86, 0x01, 0x30, 0xDA, 0xD5, 0xDB, 0x07, 0x00, 0x92, 0xD5, 0xD5, 0xDA, 0xDA, 0xDA,
+  0x00, 0x00, 0x1E, 0x1A, 0x2D, 0x01, 0x0B, 0xE8, 0x0F, 0x03, 0xC7, 0x00, 0x03, 0xAC, 0x00, 0x01,
+  0x07, 0x03, 0x00, 0xC8, 0x00, 0x00, 0x99, 0x16, 0x0A, 0xC8, 0x00, 0x0F, 0x08, 0x07, 0x17, 0x32,
+  0x1F, 0x1E, 0x1E, 0x8D, 0x01, 0x13, 0x1B, 0x01, 0x00, 0x00, 0x54, 0x02, 0x20, 0x1C, 0xEA, 0xC9,
+  0x00, 0x00, 0xD1, 0x00, 0x00, 0x4D, 0x01, 0x02, 0x9A, 0x12, 0x03, 0x94, 0x05, 0x0F, 0xC8, 0x00,
+  0x08, 0x80, 0xDC, 0xDC, 0xDA, 0xDD, 0xDA, 0xD8, 0xCF, 0xDD, 0xCE, 0x00, 0x30, 0xCF, 0xDF, 0xDD,
+  0xC8, 0x00, 0x51, 0x00, 0x00, 0x19, 0x1C, 0x19, 0x7E, 0x05, 0x0F, 0x33, 0x00, 0x01, 0x02, 0x41,
+  0x09, 0x01, 0xCF, 0x03, 0x13, 0x9F, 0x1A, 0x19, 0x02, 0x05, 0x0B, 0x02, 0x20, 0x03, 0x00, 0xA6,
+  0x01, 0x0F, 0xC8, 0x00, 0x15, 0x10, 0x1F, 0xC8, 0x0F, 0x02, 0xC7, 0x00, 0x12, 0xEB, 0x01, 0x00,
+  0x71, 0x1B, 0x1C, 0x1C, 0xEC, 0x1C, 0x1B, 0xEA, 0xD0, 0x00, 0x12, 0xEC, 0xC8, 0x00, 0x02, 0xD0,
+  0x11, 0x03, 0x5C, 0x06, 0x0F, 0xC8, 0x00, 0x0A, 0x30, 0xDA, 0xD8, 0xD5, 0xC8, 0x00, 0x51, 0xD5,
+  0xDA, 0xCF, 0x00, 0xDF, 0x0B, 0x07, 0x75, 0x1D, 0x00, 0x17, 0x1E, 0x08, 0x08, 0x1C, 0x3D, 0x0A,
+  0x08, 0x01, 0x00, 0x23, 0xE8, 0xE8, 0xCD, 0x16, 0x07, 0xC8, 0x00, 0x02, 0x83, 0x05, 0x04, 0xC8,
+  0x00, 0x0F, 0xF9, 0x11, 0x17, 0x01, 0x56, 0x02, 0x04, 0xC7, 0x00, 0x11, 0x1A, 0x02, 0x00, 0x20,
+  0x1B, 0x1C, 0xC7, 0x00, 0x10, 0xEA, 0x23, 0x03, 0x36, 0xEC, 0xEA, 0x1C, 0xC8, 0x00, 0x0F, 0xC9,
+  0x00, 0x0C, 0x21, 0xDF, 0xDE, 0xC8, 0x00, 0xF0, 0x00, 0xCF, 0xCF, 0xDF, 0xDA, 0xDA, 0xCF, 0xD5,
+  0xCF, 0x00, 0x00, 0x1D, 0x1A, 0x1D, 0x1D, 0x19, 0xC8, 0x00, 0x2F, 0x17, 0x19, 0xC9, 0x00, 0x03,
+  0x00, 0xC8, 0x00, 0x03, 0x47, 0x18, 0x00, 0x23, 0x03, 0x04, 0x87, 0x17, 0x05, 0xC8, 0x00, 0x02,
+  0x33, 0x03, 0x0F, 0xC8, 0x00, 0x17, 0x41, 0xEC, 0xEC, 0x1C, 0xEA, 0xC7, 0x00, 0x00, 0x01, 0x00,
+  0x20, 0xEB, 0x1A, 0x94, 0x01, 0x01, 0xC9, 0x00, 0x22, 0xEC, 0xEC, 0xC8, 0x00, 0x01, 0xC4, 0x0A,
+  0x32, 0x1F, 0x1E, 0xEE, 0xDE, 0x0A, 0x0F, 0xC9, 0x00, 0x06, 0x00, 0xC8, 0x00, 0xF2, 0x01, 0xD8,
+  0xD5, 0xCF, 0xD5, 0xDF, 0xDA, 0xD5, 0xCF, 0xD4, 0xCF, 0xDA, 0x00, 0x00, 0x1C, 0x17, 0x18, 0x1A,
+  0x00, 0x40, 0x17, 0x17, 0x08, 0x08, 0xF3, 0x0E, 0x0D, 0x01, 0x00, 0x07, 0x42, 0x1B, 0x03, 0xC8,
+  0x00, 0x01, 0x0F, 0x00, 0x0F, 0xC8, 0x00, 0x2B, 0x01, 0xC7, 0x00, 0x02, 0xCC, 0x00, 0x22, 0xEB,
+  0xEB, 0xC9, 0x00, 0x41, 0x1C, 0xEA, 0x1C, 0x1C, 0xC8, 0x00, 0x00, 0xAE, 0x0E, 0x14, 0xEE, 0x22,
+  0x03, 0x0F, 0x92, 0x00, 0x01, 0x1B, 0x1D, 0xC8, 0x00, 0x21, 0xD5, 0x00, 0x1E, 0x03, 0x03, 0x51,
+  0x03, 0x3F, 0x1A, 0x17, 0x19, 0xC9, 0x00, 0x02, 0x03, 0x57, 0x02, 0x05, 0xC6, 0x00, 0x03, 0x1F,
+  0x1C, 0x00, 0x19, 0x03, 0x01, 0xC8, 0x00, 0x00, 0xA7, 0x01, 0x0F, 0xC1, 0x12, 0x13, 0x0F, 0xC8,
+  0x00, 0x01, 0x10, 0x1B, 0xB8, 0x04, 0x20, 0x1B, 0x1B, 0x5B, 0x02, 0x40, 0x1B, 0x1C, 0x1D, 0x1F,
+  0x62, 0x08, 0x01, 0xC8, 0x00, 0x03, 0x84, 0x05, 0x0F, 0x90, 0x00, 0x00, 0x10, 0x1D, 0xAA, 0x05,
+  0xF3, 0x03, 0x00, 0xDD, 0xDC, 0xD8, 0xD7, 0xCF, 0xCF, 0xD5, 0xDC, 0xDF, 0xDF, 0xDF, 0xD5, 0xDA,
+  0x00, 0xD5, 0xCF, 0xD6, 0x7C, 0x0A, 0x10, 0x1F, 0xC9, 0x00, 0x10, 0x1A, 0x4A, 0x00, 0x03, 0x01,
+  0x00, 0x02, 0x82, 0x09, 0x00, 0x01, 0x00, 0x01, 0x40, 0x06, 0x01, 0x05, 0x00, 0x06, 0x8E, 0x01,
+  0x02, 0xD6, 0x07, 0x0F, 0xC8, 0x00, 0x1F, 0x19, 0xEE, 0xC8, 0x00, 0x20, 0xEB, 0x1A, 0xE9, 0x03,
+  0x20, 0xEC, 0x1C, 0xCA, 0x00, 0x40, 0xEA, 0xEA, 0x1B, 0x1C, 0xD2, 0x04, 0x01, 0xCB, 0x06, 0x32,
+  0x1E, 0xEE, 0x1D, 0x5A, 0x02, 0x0E, 0xC7, 0x00, 0xD0, 0x1F, 0x1D, 0x1C, 0x08, 0x08, 0x19, 0x19,
+  0x1C, 0xDC, 0xD8, 0xD5, 0xCF, 0xCF, 0x71, 0x05, 0x51, 0xDA, 0x00, 0x00, 0xD6, 0xD6, 0xC7, 0x00,
+  0x02, 0xE0, 0x08, 0x50, 0x00, 0x00, 0x1A, 0x19, 0x18, 0xC9, 0x00, 0x01, 0x3D, 0x00, 0x12, 0xDF,
+  0x01, 0x00, 0x01, 0x91, 0x01, 0x05, 0x54, 0x02, 0x01, 0xD4, 0x00, 0x05, 0xC8, 0x00, 0x07, 0x28,
+  0x0A, 0x0F, 0xC8, 0x00, 0x23, 0x02, 0xC7, 0x00, 0x61, 0x1C, 0x1C, 0xEA, 0x1B, 0x1B, 0xEB, 0x86,
+  0x05, 0x00, 0xC8, 0x00, 0x02, 0x25, 0x03, 0x10, 0xEE, 0x1B, 0x07, 0x0F, 0xC7, 0x00, 0x08, 0x30,
+  0x19, 0x19, 0x1C, 0xC8, 0x00, 0x63, 0xCF, 0xD5, 0xCF, 0xCF, 0xD2, 0xDA, 0x0A, 0x0C, 0x02, 0xDF,
+  0x08, 0x01, 0x34, 0x00, 0x40, 0x19, 0x1B, 0x1B, 0x18, 0xEE, 0x03, 0x03, 0xC6, 0x00, 0x32, 0xDE,
+  0xDE, 0xDE, 0xC9, 0x00, 0x01, 0x93, 0x05, 0x0B, 0xC8, 0x00, 0x08, 0xF0, 0x0A, 0x0F, 0xC8, 0x00,
+  0x01, 0x9F, 0x08, 0x18, 0x07, 0x07, 0x07, 0x32, 0x33, 0x22, 0x28, 0xC8, 0x00, 0x05, 0x51, 0xEB,
+  0x1A, 0x1B, 0x1B, 0xEC, 0x10, 0x00, 0x00, 0xC2, 0x04, 0x00, 0xC8, 0x00, 0x00, 0xC2, 0x00, 0x11,
+  0x1C, 0xCE, 0x00, 0x00, 0x82, 0x09, 0x1F, 0xED, 0xC9, 0x00, 0x00, 0x04, 0xC7, 0x00, 0x31, 0x17,
+  0x17, 0x1A, 0xC8, 0x00, 0x00, 0x01, 0x00, 0x13, 0xD2, 0xD1, 0x0C, 0x00, 0x78, 0x0A, 0x04, 0x46,
+  0x02, 0x43, 0x19, 0x16, 0x00, 0x1E, 0xC5, 0x00, 0x00, 0xC6, 0x00, 0x02, 0xC9, 0x00, 0x01, 0xFD,
+  0x1C, 0x02, 0x61, 0x02, 0x03, 0xAE, 0x04, 0x08, 0x80, 0x0C, 0x0F, 0x58, 0x02, 0x03, 0x40, 0x1B,
+  0x17, 0x13, 0x0F, 0x01, 0x00, 0x4F, 0x30, 0x31, 0x33, 0x35, 0xC8, 0x00, 0x00, 0x12, 0xEB, 0xC7,
+  0x00, 0x12, 0x1C, 0x07, 0x07, 0x20, 0xEA, 0x1D, 0x8F, 0x01, 0x11, 0xEA, 0x8A, 0x01, 0x31, 0x1C,
+  0x1C, 0x1D, 0xF7, 0x07, 0x01, 0x7D, 0x09, 0x0D, 0xC9, 0x00, 0xD0, 0x1D, 0x00, 0x1C, 0x08, 0x19,
+  0x19, 0x08, 0x08, 0x17, 0x17, 0x17, 0x1C, 0xDA, 0x21, 0x03, 0x13, 0xD9, 0xC5, 0x00, 0x00, 0xEE,
+  0x0A, 0x31, 0xED, 0x1E, 0xDE, 0x43, 0x02, 0x66, 0xDF, 0x00, 0xDE, 0xDE, 0x1B, 0x1D, 0xC6, 0x00,
+  0x10, 0xDD, 0x01, 0x00, 0x01, 0xC9, 0x00, 0x09, 0xC8, 0x00, 0x0B, 0x48, 0x0D, 0x0F, 0xC8, 0x00,
+  0x02, 0xE5, 0x18, 0x13, 0x0F, 0x0F, 0x11, 0x12, 0x14, 0x17, 0x17, 0x18, 0x19, 0x32, 0x32, 0x20,
+  0xC8, 0x00, 0x25, 0x1E, 0xEE, 0x40, 0x06, 0x00, 0x71, 0x05, 0x21, 0x1C, 0xEC, 0xC7, 0x00, 0x31,
+  0x1B, 0xEA, 0x1D, 0xA6, 0x08, 0x00, 0xD4, 0x02, 0x15, 0x1D, 0xC8, 0x00, 0x01, 0x75, 0x09, 0x0D,
+  0x58, 0x02, 0x40, 0x1C, 0x1C, 0x19, 0x08, 0x01, 0x00, 0x35, 0x17, 0x17, 0x1A, 0x5A, 0x0E, 0x04,
+  0xC8, 0x00, 0x31, 0x1D, 0x1E, 0xDE, 0xC9, 0x00, 0x02, 0x10, 0x03, 0x72, 0xDF, 0xDF, 0xDA, 0xDA,
+  0xDC, 0xDD, 0xDF, 0xC7, 0x00, 0x31, 0xDC, 0xDC, 0xDC, 0x5B, 0x02, 0x02, 0x5F, 0x02, 0x06, 0xE3,
+  0x03, 0x02, 0x3C, 0x11, 0x01, 0xC8, 0x00, 0x01, 0xC1, 0x12, 0x0B, 0xC8, 0x00, 0xF8, 0x01, 0x17,
+  0x12, 0x0F, 0x12, 0x14, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x34, 0x22, 0xC8,
+  0x00, 0x04, 0xC9, 0x00, 0x03, 0x96, 0x08, 0x20, 0x1B, 0xEA, 0x51, 0x02, 0x00, 0x87, 0x01, 0x01,
+  0x12, 0x03, 0x50, 0x1D, 0x1C, 0x08, 0x1C, 0x1E, 0xC0, 0x08, 0x46, 0xEC, 0x1C, 0x1D, 0xEE, 0xD8,
+  0x11, 0x03, 0x01, 0x00, 0xA0, 0x1E, 0x1C, 0x1C, 0x08, 0x08, 0x08, 0x1A, 0x19, 0x19, 0x1A, 0x91,
+  0x01, 0x0A, 0xC8, 0x00, 0x10, 0xEC, 0xC7, 0x00, 0x05, 0xC9, 0x00, 0x22, 0xDF, 0x00, 0x41, 0x0A,
+  0x11, 0xDC, 0xC8, 0x00, 0x10, 0xDC, 0x01, 0x00, 0x03, 0xC9, 0x00, 0x02, 0xC6, 0x00, 0x03, 0xF7,
+  0x03, 0x00, 0x85, 0x01, 0x0F, 0xC8, 0x00, 0x07, 0x60, 0x18, 0x13, 0x14, 0x15, 0x15, 0x16, 0xC8,
+  0x00, 0x84, 0x17, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x08, 0x25, 0xC8, 0x00, 0x12, 0xED, 0xC9, 0x00,
+  0x01, 0x61, 0x09, 0x02, 0x55, 0x09, 0x00, 0xC7, 0x00, 0x10, 0x1D, 0xA7, 0x04, 0x01, 0x6A, 0x05,
+  0x03, 0xC8, 0x00, 0x00, 0x21, 0x03, 0x4B, 0x1C, 0xEC, 0x1D, 0xED, 0x91, 0x01, 0x04, 0xC7, 0x00,
+  0x71, 0x18, 0x18, 0x18, 0x1A, 0x17, 0x17, 0x19, 0x45, 0x0E, 0x02, 0x02, 0x00, 0x51, 0x1F, 0x1F,
+  0x1C, 0xEC, 0xEC, 0x8F, 0x01, 0x04, 0xC9, 0x00, 0x86, 0xDA, 0xD8, 0xDA, 0xDD, 0xDF, 0xDF, 0xDC,
+  0xDA, 0xC8, 0x00, 0x14, 0xDC, 0xC7, 0x00, 0x04, 0x5F, 0x1F, 0x03, 0x95, 0x01, 0x03, 0xC8, 0x00,
+  0x00, 0x0B, 0x00, 0x0A, 0xC8, 0x00, 0x84, 0x08, 0x07, 0x07, 0x08, 0x08, 0x1B, 0x19, 0x19, 0x90,
+  0x01, 0x00, 0xC9, 0x00, 0x00, 0xF7, 0x01, 0x01, 0x45, 0x0D, 0x01, 0x7C, 0x0C, 0x00, 0x88, 0x01,
+  0x10, 0x1B, 0xE0, 0x0A, 0x21, 0x1D, 0x1C, 0x50, 0x02, 0x02, 0xC7, 0x00, 0x04, 0xC8, 0x00, 0x20,
+  0x1D, 0x1E, 0x59, 0x02, 0x4A, 0x1C, 0xEC, 0xEC, 0xED, 0x5A, 0x0D, 0x00, 0x3D, 0x03, 0x02, 0xC8,
+  0x00, 0x10, 0x17, 0x01, 0x00, 0x07, 0xC7, 0x00, 0x52, 0x1E, 0x1E, 0x1F, 0x1C, 0x1C, 0x56, 0x02,
+  0x03, 0xC9, 0x00, 0x76, 0x00, 0xD7, 0xD8, 0x00, 0x00, 0xDE, 0xDE, 0xC8, 0x00, 0x22, 0xDB, 0xDB,
+  0x91, 0x01, 0x02, 0xED, 0x03, 0x07, 0xDD, 0x07, 0x04, 0x58, 0x02, 0x0E, 0xC8, 0x00, 0x94, 0x15,
+  0x18, 0x08, 0x36, 0x23, 0x04, 0x04, 0x2B, 0x19, 0x90, 0x01, 0x52, 0x1A, 0x1A, 0x08, 0x28, 0x1E,
+  0xB8, 0x0B, 0x01, 0x63, 0x09, 0x01, 0x37, 0x02, 0x10, 0x1B, 0x8F, 0x01, 0x10, 0x1D, 0xAE, 0x0B,
+  0x03, 0x7C, 0x0C, 0x01, 0xC2, 0x07, 0x33, 0x1D, 0x08, 0xEB, 0x91, 0x01, 0x30, 0xEC, 0x1C, 0xEC,
+  0x1A, 0x18, 0x08, 0x8F, 0x01, 0x10, 0x1D, 0xAE, 0x04, 0x03, 0xC7, 0x00, 0x21, 0x1A, 0x18, 0xB3,
+  0x10, 0x13, 0x1F, 0x26, 0x0F, 0x42, 0x1E, 0xEA, 0xEA, 0x1E, 0xC4, 0x00, 0x02, 0xA1, 0x04, 0x66,
+  0xDF, 0xD6, 0xDE, 0xDA, 0xDA, 0xDD, 0x58, 0x02, 0x00, 0x38, 0x0E, 0x02, 0x91, 0x01, 0x0F, 0x01,
+  0x00, 0x03, 0x0F, 0x58, 0x02, 0x01, 0x30, 0x19, 0x12, 0x33, 0x07, 0x00, 0x34, 0x2B, 0x2B, 0x1E,
+  0x90, 0x01, 0x40, 0x1B, 0x08, 0x08, 0x29, 0x1B, 0x0C, 0x02, 0xE8, 0x05, 0x00, 0xC9, 0x0E, 0x01,
+  0xC8, 0x03, 0x03, 0x87, 0x01, 0x10, 0x1E, 0x12, 0x00, 0x03, 0x37, 0x11, 0x01, 0xC8, 0x00, 0x03,
+  0x91, 0x01, 0x00, 0x08, 0x00, 0x08, 0x8F, 0x01, 0x64, 0x1D, 0x1E, 0x00, 0x1D, 0x08, 0x1B, 0xC8,
+  0x00, 0x12, 0x1A, 0x27, 0x0F, 0x03, 0x26, 0x0F, 0x34, 0x1E, 0x08, 0x08, 0x69, 0x05, 0x20, 0xDE,
+  0xDE, 0x45, 0x02, 0x10, 0xDF, 0x1E, 0x03, 0x01, 0xD3, 0x00, 0x05, 0xC8, 0x00, 0x1F, 0xDB, 0xC8,
+  0x00, 0x1C, 0x05, 0x01, 0x00, 0x00, 0xC9, 0x00, 0x03, 0x90, 0x01, 0x31, 0x08, 0x08, 0x2D, 0x83,
+  0x15, 0x02, 0xC7, 0x14, 0x04, 0x01, 0x00, 0x02, 0xD7, 0x00, 0x00, 0xC6, 0x00, 0x03, 0xF5, 0x14,
+  0x53, 0x1F, 0x1D, 0x08, 0x1A, 0xEB, 0xA3, 0x01, 0x00, 0xBA, 0x04, 0x08, 0x6B, 0x00, 0x02, 0xC8,
+  0x00, 0x22, 0x08, 0x08, 0xC8, 0x00, 0x01, 0xE6, 0x03, 0x70, 0x00, 0x1F, 0xED, 0xED, 0x1D, 0xEC,
+  0x1C, 0x14, 0x01, 0x23, 0x1A, 0x1A, 0xC8, 0x00, 0x41, 0xDC, 0xDA, 0xD9, 0xD9, 0xE3, 0x03, 0x00,
+  0xF4, 0x0E, 0x0A, 0xC8, 0x00, 0x05, 0xB3, 0x04, 0x0C, 0x01, 0x00, 0x4F, 0x1D, 0x17, 0x0F, 0x1E,
+  0x98, 0x08, 0x0A, 0x15, 0x1E, 0x90, 0x01, 0x20, 0x08, 0x08, 0x41, 0x01, 0x01, 0x90, 0x00, 0x03,
+  0xC1, 0x00, 0x09, 0x01, 0x00, 0x03, 0x93, 0x19, 0x01, 0xC8, 0x00, 0x40, 0x08, 0x1C, 0x1E, 0x1E,
+  0xC8, 0x00, 0x19, 0xEC, 0x79, 0x05, 0x04, 0xC7, 0x00, 0x22, 0x08, 0x08, 0xC8, 0x00, 0x02, 0xD6,
+  0x0F, 0x11, 0xED, 0x0B, 0x0C, 0x25, 0xEC, 0xEC, 0xC8, 0x00, 0xD1, 0xDE, 0xDA, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD9, 0xD9, 0xDA, 0xDB, 0xDA, 0xDA, 0xD9, 0xBE, 0x00, 0x03, 0x1F, 0x03, 0x0F, 0x59, 0x02,
+  0x09, 0x5F, 0x19, 0x07, 0x07, 0x17, 0x1E, 0x60, 0x09, 0x0A, 0x15, 0x1C, 0x90, 0x01, 0x26, 0x19,
+  0x07, 0x93, 0x00, 0x0F, 0xE0, 0x14, 0x00, 0x00, 0x65, 0x02, 0x00, 0xC8, 0x00, 0x14, 0x1B, 0xC8,
+  0x00, 0x10, 0xEE, 0x49, 0x06, 0x09, 0x22, 0x00, 0x01, 0xC7, 0x00, 0x21, 0x1A, 0x1A, 0xC8, 0x00,
+  0xC0, 0x08, 0x00, 0x1E, 0x1D, 0x08, 0x1E, 0x1E, 0x1F, 0xEE, 0xED, 0xED, 0xEC, 0xC9, 0x00, 0x01,
+  0xC8, 0x00, 0x01, 0x35, 0x06, 0x70, 0xD5, 0xD3, 0xD3, 0xD6, 0xD7, 0xD9, 0xD9, 0xC7, 0x00, 0x02,
+  0xC8, 0x00, 0x32, 0xDB, 0xDD, 0xDE, 0xC7, 0x00, 0x2F, 0xDB, 0xDC, 0x30, 0x20, 0x03, 0x8F, 0x00,
+  0x00, 0x07, 0x08, 0x33, 0x07, 0x08, 0x1E, 0xC8, 0x00, 0x09, 0x23, 0x00, 0x1B, 0x90, 0x01, 0x3F,
+  0x19, 0x14, 0x11, 0x0E, 0x01, 0x05, 0x04, 0xC7, 0x00, 0x00, 0xD2, 0x04, 0x02, 0x90, 0x01, 0x00,
+  0x21, 0x03, 0x25, 0xEE, 0x1C, 0xD0, 0x07, 0x03, 0xCF, 0x00, 0x10, 0x1D, 0xC6, 0x00, 0x31, 0x18,
+  0x18, 0x1A, 0xCE, 0x07, 0xF0, 0x03, 0x1E, 0x1E, 0x00, 0x08, 0x08, 0x08, 0x1E, 0x1E, 0xEC, 0xED,
+  0xED, 0xEA, 0xEA, 0x08, 0x1C, 0x1D, 0x19, 0x19, 0x7F, 0x10, 0xF1, 0x00, 0x00, 0xDF, 0xD7, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD6, 0xD9, 0xDA, 0xDA, 0xD8, 0xD8, 0xD9, 0xD9, 0x6F, 0x05, 0x14, 0xDB, 0x57,
+  0x02, 0x21, 0xDB, 0xDB, 0x67, 0x0C, 0x0D, 0x01, 0x00, 0x01, 0xC8, 0x00, 0x01, 0xEA, 0x01, 0x50,
+  0x08, 0x1B, 0x1A, 0x1A, 0x19, 0xB8, 0x02, 0xF2, 0x04, 0x16, 0x16, 0x16, 0x07, 0x07, 0x14, 0x14,
+  0x14, 0x13, 0x12, 0x12, 0x11, 0x11, 0x11, 0x0F, 0x0F, 0x0F, 0x07, 0x1C, 0x90, 0x01, 0x33, 0x19,
+  0x14, 0x0F, 0xE9, 0x0C, 0x0F, 0xC8, 0x00, 0x07, 0x01, 0xCA, 0x07, 0x03, 0xC8, 0x00, 0x00, 0x93,
+  0x05, 0x04, 0x57, 0x02, 0x0A, 0xC7, 0x00, 0x20, 0x18, 0x18, 0xC8, 0x00, 0x00, 0xC4, 0x19, 0x10,
+  0x1E, 0x33, 0x0D, 0x70, 0x1C, 0xEC, 0xED, 0xEA, 0x1A, 0x08, 0x08, 0xC8, 0x00, 0x00, 0x57, 0x02,
+  0xB0, 0xDA, 0xD3, 0xD0, 0xD3, 0xD6, 0xD7, 0xD7, 0xDA, 0xDA, 0xD8, 0xD7, 0x06, 0x00, 0x64, 0xDE,
+  0xDE, 0xDC, 0xD9, 0xDA, 0xDA, 0x90, 0x01, 0x31, 0xDB, 0x00, 0x9E, 0x79, 0x17, 0x13, 0x9F, 0x7F,
+  0x17, 0x03, 0xD3, 0x19, 0x62, 0x00, 0x00, 0x07, 0x1C, 0x33, 0x34, 0xC9, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0x98, 0x0E, 0x03, 0x97, 0x00, 0x30, 0x1D, 0x1C, 0x1C, 0x59, 0x04, 0x30, 0x07, 0x11, 0x07,
+  0x7E, 0x07, 0x10, 0x1B, 0xC7, 0x00, 0x0F, 0x38, 0x18, 0x08, 0x00, 0x33, 0x03, 0x00, 0x58, 0x0C,
+  0xA1, 0x1D, 0x1F, 0x1E, 0x08, 0xEB, 0x1A, 0x08, 0x1C, 0x1C, 0x1E, 0xE2, 0x07, 0x04, 0xFB, 0x15,
+  0x07, 0xC7, 0x00, 0x01, 0x3A, 0x06, 0x40, 0x17, 0x17, 0x17, 0x1F, 0xAB, 0x0C, 0x20, 0x1E, 0x17,
+  0x8A, 0x05, 0x71, 0xEC, 0xED, 0x1A, 0x1A, 0x08, 0x1D, 0x17, 0xC8, 0x00, 0x60, 0x00, 0xDA, 0xD2,
+  0xD0, 0xD2, 0xD7, 0xE8, 0x03, 0x30, 0xD8, 0xD6, 0xD6, 0x96, 0x01, 0x10, 0xDA, 0x04, 0x00, 0x2F,
+  0xDF, 0xDE, 0xC8, 0x00, 0x0C, 0xF0, 0x0B, 0x17, 0x1C, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25,
+  0x27, 0x28, 0x29, 0x2B, 0x2D, 0x1F, 0x00, 0x00, 0x19, 0x15, 0x13, 0x12, 0x13, 0x13, 0x14, 0x14,
+  0x07, 0xCF, 0x07, 0x05, 0xD0, 0x07, 0x11, 0x1A, 0xC7, 0x00, 0x0F, 0xC8, 0x00, 0x0B, 0x01, 0x1F,
+  0x0D, 0x04, 0xC8, 0x00, 0x32, 0x08, 0x1C, 0x1E, 0x10, 0x07, 0x01, 0x1C, 0x00, 0x02, 0xC8, 0x00,
+  0x33, 0x08, 0x1A, 0x08, 0xC7, 0x00, 0x10, 0x08, 0x1F, 0x03, 0x00, 0xC9, 0x00, 0xD1, 0x1A, 0x1D,
+  0xED, 0xED, 0x1C, 0x1B, 0x08, 0xED, 0xEC, 0x1A, 0x1A, 0x1B, 0x17, 0xE8, 0x03, 0x44, 0xDC, 0xD7,
+  0xD0, 0xD1, 0xC8, 0x00, 0x41, 0xD4, 0xD2, 0xD5, 0xD7, 0xC7, 0x00, 0x33, 0xDA, 0xDD, 0x00, 0xC9,
+  0x00, 0x13, 0x00, 0xCA, 0x19, 0x01, 0x56, 0x29, 0x08, 0xC8, 0x00, 0x18, 0x1D, 0xC8, 0x00, 0x63,
+  0x00, 0x00, 0x18, 0x11, 0x10, 0x10, 0xC8, 0x00, 0x02, 0x98, 0x08, 0x02, 0x40, 0x06, 0x30, 0x19,
+  0x14, 0x0F, 0x5C, 0x12, 0x0F, 0xC5, 0x00, 0x05, 0x01, 0xAC, 0x04, 0x01, 0xE4, 0x06, 0x51, 0x1C,
+  0x1F, 0x1E, 0x1C, 0xEB, 0x16, 0x04, 0x30, 0x1C, 0x08, 0x08, 0x91, 0x04, 0x06, 0xC7, 0x00, 0x34,
+  0x00, 0x08, 0x19, 0xC8, 0x00, 0x30, 0x17, 0x17, 0x19, 0x30, 0x00, 0x00, 0x7F, 0x17, 0xB0, 0xED,
+  0xED, 0xED, 0x1C, 0x1A, 0xEC, 0xEC, 0x1A, 0x1A, 0x08, 0x1B, 0xC8, 0x00, 0xF1, 0x03, 0x00, 0xDC,
+  0xD5, 0xCF, 0xD1, 0xD2, 0xD4, 0xD6, 0xDA, 0xDA, 0xD9, 0xD6, 0xD4, 0xD2, 0xD1, 0xD7, 0xD9, 0x1E,
+  0x84, 0x05, 0x40, 0xDD, 0xDF, 0x00, 0xDB, 0x87, 0x05, 0x00, 0x20, 0x03, 0x0F, 0x50, 0x23, 0x01,
+  0x2B, 0x00, 0x18, 0xC8, 0x00, 0x4F, 0x07, 0x0F, 0x10, 0x12, 0x90, 0x01, 0x00, 0x31, 0x07, 0x0F,
+  0x07, 0xF4, 0x03, 0x0B, 0xBE, 0x00, 0x04, 0x4A, 0x25, 0x01, 0x3F, 0x1E, 0x06, 0xC8, 0x00, 0x11,
+  0x19, 0xC9, 0x00, 0x22, 0x1A, 0x08, 0x73, 0x09, 0x04, 0x22, 0x07, 0x37, 0x1D, 0x08, 0x18, 0xC8,
+  0x00, 0x02, 0x86, 0x06, 0x70, 0x1C, 0x00, 0xEC, 0xEC, 0xED, 0xED, 0x1B, 0x71, 0x02, 0x30, 0x1A,
+  0x1B, 0x1B, 0xB0, 0x04, 0x60, 0xDA, 0xD2, 0xD0, 0xD0, 0xD1, 0xD1, 0xB1, 0x04, 0xD1, 0xD6, 0xD3,
+  0xD1, 0xD5, 0xD7, 0x2B, 0xDE, 0x1F, 0xD8, 0xD9, 0xDA, 0xD9, 0xDC, 0x36, 0x0A, 0x0F, 0xC8, 0x00,
+  0x08, 0x2F, 0x19, 0x1E, 0xC8, 0x00, 0x06, 0x08, 0x90, 0x01, 0x11, 0x0F, 0x8F, 0x01, 0x09, 0xC8,
+  0x00, 0x00, 0xBE, 0x00, 0x11, 0x1E, 0x74, 0x13, 0x01, 0xE5, 0x07, 0x03, 0xC8, 0x00, 0x50, 0x08,
+  0x1F, 0x1E, 0x1C, 0x08, 0x18, 0x04, 0x30, 0x1A, 0x1A, 0x08, 0x13, 0x00, 0x01, 0xED, 0x07, 0x02,
+  0x30, 0x00, 0x44, 0x1D, 0x08, 0x17, 0x18, 0xC8, 0x00, 0x10, 0x19, 0x57, 0x02, 0x11, 0x1E, 0xF0,
+  0x12, 0x00, 0x51, 0x0E, 0x50, 0x1A, 0x08, 0x1A, 0x19, 0x1A, 0xE1, 0x08, 0x40, 0xDF, 0xDF, 0xD7,
+  0xD2, 0x5A, 0x0D, 0xE2, 0xD1, 0xD3, 0xD7, 0xD9, 0xD5, 0xD3, 0xCF, 0xD9, 0xDC, 0x1C, 0xDE, 0x00,
+  0xD6, 0xD8, 0xC8, 0x00, 0x10, 0xDD, 0x85, 0x05, 0x06, 0xB2, 0x1A, 0x02, 0xF9, 0x1F, 0x03, 0xB8,
+  0x0B, 0x0F, 0xC8, 0x00, 0x09, 0x07, 0x90, 0x01, 0x03, 0x8F, 0x01, 0x0C, 0x90, 0x01, 0x00, 0xE1,
+  0x09, 0x02, 0x1C, 0x03, 0x01, 0xC8, 0x00, 0x00, 0xC7, 0x00, 0x40, 0x08, 0x1F, 0x1E, 0x1D, 0x95,
+  0x00, 0x30, 0x1A, 0x18, 0x19, 0x84, 0x05, 0x04, 0x8B, 0x17, 0x01, 0x39, 0x04, 0x50, 0x08, 0x1A,
+  0x17, 0x1A, 0x1A, 0x58, 0x09, 0x30, 0x17, 0x19, 0x08, 0xC8, 0x00, 0xB6, 0x1F, 0x08, 0x17, 0x08,
+  0x1C, 0x1D, 0x1B, 0x1A, 0x1B, 0x1B, 0x19, 0xC8, 0x00, 0xFF, 0x0D, 0xD3, 0xD0, 0xCF, 0xD1, 0xD1,
+  0xCF, 0xCF, 0xD1, 0xD5, 0xD5, 0xD5, 0xD2, 0xCF, 0xD9, 0xDC, 0x1A, 0x00, 0x00, 0xD5, 0xD7, 0xDA,
+  0xDB, 0xDD, 0xDF, 0x00, 0xDE, 0xDB, 0xD7, 0xC8, 0x00, 0x01, 0x12, 0xE8, 0xC8, 0x00, 0x2F, 0x1A,
+  0x1F, 0x90, 0x01, 0x10, 0x13, 0x17, 0x8F, 0x01, 0x0B, 0x90, 0x01, 0x01, 0xE3, 0x09, 0x04, 0xF9,
+  0x18, 0x07, 0xC8, 0x00, 0x72, 0x1C, 0x1A, 0x19, 0x19, 0x17, 0x19, 0x19, 0x06, 0x0B, 0x04, 0xB7,
+  0x1A, 0x00, 0x07, 0x16, 0xA0, 0x08, 0x1A, 0x17, 0x17, 0x18, 0x17, 0x18, 0x1C, 0x1C, 0x1C, 0xCB,
+  0x01, 0x91, 0x1E, 0x1D, 0x1D, 0x08, 0x17, 0x08, 0x1D, 0x1B, 0x1B, 0xBE, 0x01, 0x30, 0x19, 0x19,
+  0x1B, 0xBE, 0x01, 0xF0, 0x09, 0xDF, 0xD3, 0xCF, 0xCF, 0xCF, 0xD3, 0xD8, 0xD6, 0xD1, 0xD2, 0xD5,
+  0xD4, 0xD5, 0xD1, 0xD9, 0xDC, 0x9C, 0x00, 0xDB, 0xD4, 0xD6, 0xDA, 0xDD, 0xDE, 0x58, 0x02, 0x21,
+  0xD7, 0xD9, 0x58, 0x02, 0x04, 0xEA, 0x0A, 0x01, 0x50, 0x09, 0x12, 0xE8, 0x2C, 0x2B, 0x0A, 0xC8,
+  0x00, 0x4F, 0x2F, 0x00, 0x00, 0x12, 0x90, 0x01, 0x01, 0x04, 0x8F, 0x01, 0x0B, 0x90, 0x01, 0x01,
+  0x5E, 0x14, 0x00, 0x84, 0x0F, 0x00, 0xAD, 0x12, 0x00, 0xA9, 0x00, 0x00, 0xC8, 0x00, 0x01, 0xD0,
+  0x00, 0x00, 0xC8, 0x00, 0x10, 0x1A, 0xBD, 0x04, 0x01, 0xDA, 0x08, 0x03, 0xC8, 0x00, 0x10, 0x1B,
+  0x35, 0x03, 0x10, 0x18, 0x51, 0x00, 0x10, 0x08, 0x71, 0x0A, 0x30, 0x00, 0x1E, 0x1E, 0x0A, 0x04,
+  0x31, 0xEC, 0xEC, 0x1C, 0xC9, 0x00, 0x31, 0x19, 0x19, 0x1A, 0x86, 0x02, 0x00, 0xC8, 0x00, 0xF0,
+  0x02, 0xCF, 0x19, 0xD8, 0xD8, 0xD5, 0xD8, 0xD7, 0xD7, 0xD5, 0xD9, 0xD9, 0x1E, 0x00, 0xD3, 0xD4,
+  0xD8, 0xDC, 0x96, 0x0C, 0x43, 0xDA, 0xD7, 0x3F, 0xD8, 0xC8, 0x00, 0x03, 0xD6, 0x0E, 0x02, 0xD3,
+  0x00, 0x01, 0xA9, 0x1E, 0x45, 0xE9, 0x08, 0x1E, 0x35, 0xC8, 0x00, 0x55, 0x2F, 0x00, 0x00, 0x18,
+  0x0F, 0xC8, 0x00, 0x01, 0xC9, 0x00, 0x02, 0x90, 0x01, 0x04, 0x8F, 0x01, 0x02, 0x90, 0x1A, 0x05,
+  0xA3, 0x07, 0x01, 0x8C, 0x0C, 0x01, 0xC9, 0x00, 0x27, 0xEE, 0xEE, 0xC8, 0x00, 0x20, 0x1C, 0x1D,
+  0xCF, 0x03, 0x37, 0x19, 0x1A, 0x08, 0xC8, 0x00, 0x01, 0x1F, 0x00, 0x02, 0xAF, 0x00, 0x41, 0x19,
+  0x17, 0x1A, 0x1B, 0x53, 0x03, 0x00, 0x44, 0x00, 0x01, 0xB2, 0x0B, 0x10, 0xEC, 0xE6, 0x03, 0x30,
+  0x19, 0x19, 0x1A, 0xCD, 0x08, 0x00, 0xC8, 0x00, 0x70, 0xD2, 0xCF, 0x18, 0xDA, 0xD4, 0xD8, 0xD8,
+  0xD0, 0x07, 0x50, 0xDE, 0x2E, 0x00, 0xD1, 0xD4, 0x77, 0x05, 0x83, 0xDB, 0xD7, 0xD7, 0x3F, 0x3F,
+  0xD7, 0xDB, 0xDC, 0xFC, 0x11, 0x03, 0x05, 0x00, 0x04, 0x49, 0x0D, 0x53, 0x9F, 0xE9, 0x1E, 0x1C,
+  0x1E, 0xC8, 0x00, 0x23, 0x2A, 0x2E, 0x68, 0x01, 0xF4, 0x03, 0x2F, 0x2D, 0x2C, 0x2B, 0x29, 0x04,
+  0x04, 0x04, 0x04, 0x24, 0x22, 0x36, 0x36, 0x34, 0x0C, 0x33, 0x32, 0x31, 0x8F, 0x01, 0x03, 0xB8,
+  0x0B, 0x04, 0xC9, 0x00, 0x06, 0x85, 0x0F, 0x00, 0x91, 0x01, 0x04, 0xC8, 0x00, 0x30, 0x1D, 0x1C,
+  0x1C, 0xC8, 0x00, 0x10, 0x18, 0x0D, 0x07, 0x01, 0x84, 0x17, 0x01, 0xAB, 0x1A, 0x21, 0x1E, 0x1E,
+  0xE7, 0x03, 0x01, 0x29, 0x11, 0x13, 0x1C, 0xFB, 0x15, 0x32, 0x1F, 0x00, 0x00, 0x9D, 0x1B, 0x12,
+  0x1E, 0xEA, 0x0E, 0x14, 0x1B, 0xC8, 0x00, 0x90, 0xCD, 0x19, 0xDA, 0xD3, 0xD8, 0xDA, 0xDA, 0xD5,
+  0xD7, 0xC1, 0x00, 0x21, 0xCF, 0xD5, 0x57, 0x02, 0x10, 0x3F, 0x01, 0x00, 0x24, 0xDB, 0xDD, 0x93,
+  0x2F, 0x02, 0xC1, 0x00, 0x04, 0x9B, 0x13, 0x20, 0x9F, 0xE9, 0xC9, 0x00, 0x07, 0x08, 0x07, 0xF3,
+  0x01, 0x1D, 0x1C, 0x1C, 0x2D, 0x2B, 0x2A, 0x04, 0x25, 0x36, 0x35, 0x33, 0x32, 0x31, 0x31, 0x32,
+  0x33, 0xC7, 0x00, 0x03, 0x8F, 0x01, 0x00, 0xC8, 0x00, 0x05, 0xDE, 0x1B, 0x01, 0x6C, 0x05, 0x40,
+  0xED, 0xEC, 0xEC, 0x1D, 0x89, 0x00, 0x00, 0x75, 0x13, 0x00, 0xB0, 0x04, 0x90, 0x1A, 0x08, 0x1E,
+  0x1D, 0x08, 0x1C, 0x1D, 0x08, 0x19, 0x3E, 0x02, 0x01, 0x91, 0x01, 0x03, 0xC8, 0x00, 0x31, 0x1C,
+  0x1E, 0x1D, 0x54, 0x02, 0x30, 0x18, 0x18, 0x17, 0x01, 0x04, 0x23, 0xED, 0xED, 0x35, 0x01, 0x00,
+  0x3D, 0x00, 0x00, 0xC7, 0x00, 0x10, 0x08, 0x6D, 0x07, 0xA1, 0xEC, 0x1F, 0x1F, 0x1F, 0xD8, 0xCF,
+  0xD1, 0xD2, 0xCD, 0x1A, 0xC8, 0x00, 0x80, 0xD1, 0xD7, 0xD7, 0xDA, 0xDE, 0xD5, 0xD1, 0xD8, 0x73,
+  0x14, 0x21, 0xDF, 0xDD, 0xC8, 0x00, 0x14, 0xDE, 0x5E, 0x30, 0x02, 0xC9, 0x00, 0x06, 0xC7, 0x12,
+  0x10, 0xE9, 0x0E, 0x1B, 0x16, 0x26, 0xE8, 0x03, 0x4F, 0x00, 0x00, 0x08, 0x17, 0x32, 0x0A, 0x05,
+  0x03, 0xC8, 0x00, 0x02, 0xC9, 0x00, 0x02, 0xFC, 0x06, 0x11, 0xED, 0xF4, 0x18, 0x00, 0x61, 0x05,
+  0x10, 0xEE, 0xD5, 0x03, 0x12, 0x1C, 0xC8, 0x00, 0x30, 0x1E, 0x08, 0x19, 0x5B, 0x05, 0x30, 0x08,
+  0x1C, 0x1C, 0xDD, 0x00, 0x02, 0xC8, 0x00, 0x00, 0x28, 0x0D, 0x01, 0x75, 0x05, 0x30, 0x18, 0x1A,
+  0x08, 0xC8, 0x00, 0x30, 0xED, 0x1F, 0xED, 0xBD, 0x0F, 0x03, 0x8E, 0x01, 0x00, 0xA9, 0x01, 0x03,
+  0xC8, 0x00, 0xF0, 0x09, 0xD6, 0xD2, 0xD6, 0xCF, 0x1B, 0xDA, 0xD6, 0xDA, 0xDA, 0xDA, 0xD6, 0xD3,
+  0xD6, 0xD6, 0xDB, 0xD7, 0xD3, 0xD5, 0xD8, 0xDF, 0x00, 0x00, 0xDD, 0xD8, 0xC8, 0x00, 0x01, 0x57,
+  0x02, 0x05, 0x65, 0x10, 0x08, 0x01, 0x00, 0x93, 0x15, 0x17, 0x18, 0x1A, 0x1B, 0x1C, 0x1E, 0x29,
+  0x26, 0xC8, 0x00, 0x34, 0x1D, 0x17, 0x08, 0x45, 0x02, 0x0F, 0xC8, 0x00, 0x02, 0x00, 0x58, 0x1B,
+  0x13, 0xEE, 0x72, 0x0C, 0x00, 0x4B, 0x01, 0x00, 0x4D, 0x10, 0x00, 0x45, 0x11, 0x00, 0x43, 0x02,
+  0x06, 0x90, 0x01, 0x12, 0x1D, 0x21, 0x03, 0x00, 0x99, 0x08, 0x00, 0x1A, 0x00, 0x01, 0x60, 0x10,
+  0x10, 0x1E, 0x6F, 0x02, 0x91, 0x18, 0x1A, 0x18, 0x18, 0x17, 0x08, 0x1F, 0xED, 0xED, 0x43, 0x1B,
+  0x01, 0xEE, 0x04, 0x00, 0x90, 0x05, 0x00, 0xC7, 0x00, 0xF0, 0x13, 0x19, 0x1A, 0xEB, 0xEC, 0x1E,
+  0x1F, 0x00, 0xDC, 0xD5, 0xD5, 0xDA, 0xD6, 0x1D, 0xDE, 0xD9, 0xD8, 0xDA, 0xDE, 0xCF, 0xD1, 0xD2,
+  0xD5, 0xDB, 0xD9, 0xD7, 0xD9, 0xDC, 0x00, 0xDB, 0xD7, 0x3F, 0x3F, 0x3F, 0xD8, 0x8F, 0x01, 0x0F,
+  0x01, 0x00, 0x05, 0x13, 0x17, 0x08, 0x00, 0x22, 0x2E, 0x2B, 0xC8, 0x00, 0x25, 0x19, 0x0F, 0xC8,
+  0x00, 0x40, 0x19, 0x07, 0x07, 0x07, 0x77, 0x04, 0x07, 0xC8, 0x00, 0x02, 0xB2, 0x03, 0x10, 0xEE,
+  0x0E, 0x03, 0x03, 0x01, 0x00, 0x00, 0x1B, 0x0A, 0x11, 0x1D, 0xC8, 0x00, 0x01, 0xC7, 0x00, 0x11,
+  0x19, 0xC8, 0x00, 0x20, 0x1C, 0x1E, 0x21, 0x03, 0x03, 0x91, 0x01, 0x00, 0x5F, 0x14, 0x02, 0x2E,
+  0x15, 0x04, 0x62, 0x10, 0x50, 0x1C, 0xED, 0xED, 0xED, 0x08, 0x38, 0x19, 0x02, 0x49, 0x0A, 0x10,
+  0x1E, 0xE7, 0x03, 0x00, 0xE3, 0x00, 0x01, 0xC8, 0x00, 0xF0, 0x04, 0x00, 0xDC, 0xDC, 0x00, 0xD9,
+  0x1E, 0xDF, 0xDC, 0xDC, 0xDE, 0xDE, 0xD1, 0xD3, 0xD6, 0xDA, 0x00, 0x00, 0xDD, 0xDC, 0x75, 0x05,
+  0x2F, 0xDD, 0xDB, 0xC7, 0x00, 0x0A, 0x3A, 0x00, 0x18, 0x00, 0x40, 0x06, 0x23, 0x17, 0x0F, 0x58,
+  0x02, 0xC5, 0x08, 0x07, 0x0F, 0x0F, 0x31, 0x32, 0x32, 0x33, 0x33, 0x34, 0x35, 0x26, 0xC8, 0x00,
+  0x03, 0x7B, 0x04, 0x00, 0x32, 0x1F, 0x01, 0x45, 0x1F, 0x01, 0x65, 0x05, 0x02, 0xC3, 0x00, 0x11,
+  0x1C, 0xC7, 0x00, 0x00, 0xC8, 0x00, 0x10, 0x1A, 0x59, 0x02, 0x00, 0x0C, 0x03, 0x00, 0x6F, 0x14,
+  0x41, 0x1F, 0x1D, 0x1C, 0x1B, 0x4F, 0x1E, 0x30, 0x1C, 0x08, 0x19, 0xB1, 0x04, 0x70, 0x19, 0x17,
+  0x17, 0x1B, 0x1D, 0xED, 0xED, 0x84, 0x01, 0x01, 0x00, 0x07, 0x11, 0x1D, 0x48, 0x06, 0x10, 0x1C,
+  0x08, 0x0B, 0x01, 0xC8, 0x00, 0x05, 0x95, 0x24, 0x81, 0x9E, 0x9E, 0xDE, 0xD7, 0xD9, 0xDD, 0xDF,
+  0x9F, 0x70, 0x17, 0x4F, 0xDE, 0xDB, 0xDA, 0xD8, 0xD5, 0x0E, 0x08, 0x00, 0x10, 0x0E, 0x0D, 0x08,
+  0x07, 0x02, 0xC8, 0x00, 0x34, 0x08, 0x07, 0x0F, 0xC0, 0x12, 0x35, 0x35, 0x20, 0x24, 0xC8, 0x00,
+  0x00, 0xCF, 0x0E, 0x00, 0x47, 0x02, 0x13, 0xEE, 0x41, 0x1F, 0x01, 0xA5, 0x04, 0x00, 0xB8, 0x1D,
+  0x01, 0x18, 0x0A, 0x23, 0x19, 0x18, 0xC8, 0x00, 0x01, 0x59, 0x02, 0x10, 0x18, 0xB2, 0x02, 0x51,
+  0x1D, 0x1F, 0x1C, 0x1B, 0x1B, 0x8F, 0x02, 0x02, 0x9D, 0x16, 0x82, 0x17, 0x18, 0x18, 0x1D, 0x1B,
+  0x1A, 0xED, 0x1D, 0x9D, 0x0D, 0x00, 0x2D, 0x07, 0x40, 0x08, 0x00, 0x1D, 0x1C, 0x6E, 0x02, 0x40,
+  0x18, 0x1A, 0xEB, 0x1D, 0xC8, 0x00, 0x06, 0xD6, 0x23, 0x21, 0xDE, 0xDF, 0x06, 0x27, 0x10, 0x00,
+  0x8E, 0x01, 0x00, 0xAA, 0x0F, 0x0F, 0xC7, 0x00, 0x08, 0x2D, 0x00, 0x1B, 0x98, 0x08, 0x21, 0x08,
+  0x18, 0xC7, 0x00, 0x22, 0x12, 0x07, 0x08, 0x07, 0x00, 0x32, 0x13, 0x25, 0x22, 0x27, 0xC8, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0xC4, 0x00, 0x03, 0x40, 0x1F, 0x21, 0xEC, 0xEC, 0xB9, 0x0C, 0x00, 0xE3,
+  0x06, 0x11, 0x1B, 0xEA, 0x0D, 0x33, 0x1E, 0x1D, 0x19, 0x59, 0x02, 0x40, 0x17, 0x17, 0x19, 0x1A,
+  0x91, 0x01, 0x30, 0x1B, 0x1A, 0x1D, 0x89, 0x09, 0x00, 0xC5, 0x04, 0x00, 0x4F, 0x00, 0x40, 0x1B,
+  0x1B, 0x18, 0x18, 0xBB, 0x08, 0x30, 0x17, 0x17, 0x19, 0xC8, 0x00, 0x00, 0x7A, 0x0C, 0x04, 0x2D,
+  0x00, 0x01, 0xC8, 0x00, 0x01, 0x78, 0x08, 0x04, 0x64, 0x25, 0x01, 0x9F, 0x24, 0x12, 0x00, 0x6C,
+  0x10, 0x02, 0x0B, 0x0E, 0x00, 0xB5, 0x00, 0x03, 0xD6, 0x15, 0x06, 0x1B, 0x2E, 0x3A, 0x9D, 0x9D,
+  0x1C, 0xF0, 0x0A, 0x12, 0x1C, 0xC8, 0x00, 0x84, 0x08, 0x07, 0x13, 0x04, 0x04, 0x04, 0x19, 0x18,
+  0x60, 0x09, 0x13, 0x24, 0x73, 0x17, 0x00, 0xC5, 0x00, 0x17, 0xEE, 0x3E, 0x1F, 0x41, 0x1C, 0x1D,
+  0x1D, 0xEC, 0x1E, 0x0D, 0x50, 0x1A, 0x08, 0x08, 0x1B, 0x1B, 0xC5, 0x07, 0x50, 0x08, 0x1D, 0x1F,
+  0x19, 0x1B, 0xD5, 0x03, 0xC0, 0x1A, 0x17, 0x16, 0x16, 0x17, 0x1A, 0x1B, 0x08, 0x1D, 0x1F, 0x1C,
+  0x19, 0x8B, 0x0F, 0x10, 0x1C, 0x8E, 0x05, 0x10, 0x18, 0x42, 0x06, 0x00, 0x22, 0x03, 0x01, 0xD4,
+  0x00, 0x40, 0x17, 0x19, 0x19, 0x18, 0x6C, 0x02, 0x02, 0x06, 0x0B, 0x11, 0x19, 0x66, 0x11, 0x0F,
+  0xC8, 0x00, 0x02, 0x02, 0x01, 0x00, 0x02, 0xA5, 0x01, 0x0F, 0xC8, 0x00, 0x10, 0xE0, 0x2F, 0x00,
+  0x1D, 0x18, 0x0F, 0x0F, 0x08, 0x19, 0x1D, 0x1D, 0x08, 0x00, 0x04, 0x04, 0x73, 0x17, 0x02, 0xF2,
+  0x05, 0x42, 0x19, 0x19, 0x1A, 0x25, 0xC9, 0x00, 0x01, 0x4F, 0x02, 0x00, 0xC6, 0x00, 0x05, 0x41,
+  0x0E, 0x00, 0xBD, 0x07, 0x00, 0x17, 0x0A, 0x01, 0x8F, 0x01, 0x10, 0x17, 0x97, 0x01, 0x20, 0x1F,
+  0x1A, 0x92, 0x08, 0x71, 0x1D, 0x1A, 0x18, 0x16, 0x16, 0x18, 0x1A, 0x91, 0x01, 0x42, 0x1A, 0x19,
+  0x1D, 0x00, 0x25, 0x07, 0x00, 0x28, 0x06, 0x40, 0x18, 0x17, 0x17, 0x1B, 0xB9, 0x08, 0x00, 0xBB,
+  0x00, 0x86, 0x18, 0x17, 0x08, 0x19, 0x19, 0x18, 0x08, 0x1D, 0xC8, 0x00, 0x01, 0xAD, 0x00, 0x01,
+  0x4D, 0x22, 0x04, 0x24, 0x0D, 0x00, 0xC8, 0x00, 0x01, 0x72, 0x34, 0x01, 0x00, 0x24, 0x01, 0x92,
+  0x1E, 0x01, 0xD0, 0x07, 0x00, 0x21, 0x00, 0x00, 0x6D, 0x34, 0x01, 0x27, 0x00, 0x25, 0x9C, 0x1D,
+  0x10, 0x0E, 0x04, 0xD0, 0x07, 0x00, 0xC8, 0x00, 0x11, 0x1D, 0xC7, 0x00, 0x03, 0xC9, 0x00, 0x00,
+  0xD7, 0x02, 0x32, 0x1B, 0x27, 0x2A, 0x92, 0x01, 0x00, 0xEF, 0x18, 0x01, 0x93, 0x00, 0x01, 0x71,
+  0x17, 0x00, 0xE2, 0x0D, 0x03, 0xC7, 0x00, 0x30, 0x08, 0x1B, 0x19, 0x1B, 0x06, 0x50, 0x08, 0x1A,
+  0x1D, 0x1B, 0x19, 0x31, 0x15, 0x10, 0x1C, 0x88, 0x0F, 0x11, 0x1A, 0x2C, 0x02, 0x30, 0x1C, 0x1B,
+  0x1C, 0x90, 0x1D, 0x01, 0xCC, 0x07, 0x02, 0xB5, 0x0B, 0x03, 0x0A, 0x00, 0x30, 0x19, 0x17, 0x17,
+  0xD8, 0x00, 0x11, 0x18, 0x40, 0x0A, 0x10, 0x1A, 0xC2, 0x05, 0x02, 0xF4, 0x26, 0x0F, 0xC8, 0x00,
+  0x0D, 0x00, 0x04, 0x07, 0x31, 0x1F, 0xE8, 0x9E, 0x7C, 0x1E, 0x0D, 0xC8, 0x00, 0x50, 0x28, 0x29,
+  0x2B, 0x00, 0x07, 0x91, 0x00, 0x08, 0x31, 0x06, 0x13, 0x1B, 0x90, 0x01, 0x21, 0x1B, 0x28, 0x91,
+  0x01, 0x09, 0xC5, 0x00, 0x01, 0xCB, 0x19, 0x01, 0xF9, 0x05, 0x00, 0xC8, 0x0E, 0x03, 0x54, 0x09,
+  0x42, 0x08, 0x1A, 0x1C, 0x1D, 0xC8, 0x00, 0x01, 0xC8, 0x0A, 0x10, 0x1B, 0xC5, 0x0A, 0x02, 0x7A,
+  0x06, 0x00, 0xCE, 0x04, 0x04, 0x9C, 0x0F, 0x06, 0x01, 0x00, 0x00, 0x14, 0x00, 0x62, 0x18, 0x18,
+  0x1C, 0x17, 0x18, 0x18, 0x57, 0x02, 0x0A, 0xDE, 0x06, 0x02, 0xAE, 0x20, 0x03, 0xF5, 0x06, 0x01,
+  0x61, 0x1E, 0x06, 0x57, 0x26, 0x20, 0xE9, 0xE9, 0xB9, 0x0B, 0x05, 0xEF, 0x00, 0x27, 0x08, 0x1C,
+  0x20, 0x03, 0x20, 0x19, 0x07, 0xEC, 0x01, 0x23, 0x16, 0x16, 0x2F, 0x11, 0x42, 0x0F, 0x0F, 0x12,
+  0x15, 0x90, 0x01, 0x21, 0x1A, 0x26, 0x03, 0x19, 0x10, 0xEC, 0xC6, 0x00, 0x04, 0xC3, 0x00, 0x01,
+  0x61, 0x11, 0x24, 0x18, 0x18, 0xC7, 0x00, 0x02, 0xC3, 0x07, 0x00, 0x0A, 0x07, 0x53, 0x1B, 0x19,
+  0x1D, 0x1D, 0x1E, 0x92, 0x17, 0x01, 0xDC, 0x16, 0x02, 0xE0, 0x0E, 0x00, 0xB1, 0x04, 0x0E, 0xC8,
+  0x00, 0x01, 0x82, 0x03, 0x32, 0x1B, 0x18, 0x18, 0xB7, 0x0B, 0x0F, 0xC8, 0x00, 0x13, 0x03, 0x26,
+  0x0A, 0x04, 0x75, 0x29, 0x02, 0xB7, 0x01, 0x28, 0x08, 0x08, 0xB0, 0x04, 0x02, 0x01, 0x00, 0x01,
+  0xE0, 0x06, 0x00, 0x80, 0x07, 0x22, 0x13, 0x10, 0x90, 0x01, 0x30, 0x1A, 0x33, 0x37, 0xC8, 0x00,
+  0x01, 0xC7, 0x00, 0x03, 0xA8, 0x1D, 0x10, 0x19, 0xC6, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x68, 0x05,
+  0x01, 0xEC, 0x14, 0x01, 0x8F, 0x01, 0x51, 0x1A, 0x1A, 0x1D, 0x1F, 0x1B, 0xCC, 0x01, 0x02, 0x46,
+  0x23, 0x02, 0x4F, 0x00, 0x01, 0xE3, 0x23, 0x23, 0x1D, 0x1B, 0x68, 0x17, 0x0A, 0xC7, 0x00, 0x00,
+  0xC8, 0x00, 0x3B, 0x19, 0x1A, 0x1A, 0x0C, 0x16, 0x09, 0x01, 0x00, 0x04, 0x45, 0x1B, 0x33, 0xE9,
+  0x9E, 0xE3, 0x58, 0x02, 0x02, 0x80, 0x0C, 0x05, 0x6D, 0x06, 0x00, 0xEC, 0x24, 0x27, 0x18, 0x08,
+  0xC8, 0x00, 0x3A, 0x1C, 0x17, 0x14, 0xB8, 0x0B, 0x02, 0x90, 0x01, 0x21, 0x31, 0x33, 0x2B, 0x0A,
+  0x00, 0x8D, 0x01, 0x04, 0x4E, 0x02, 0x00, 0xF3, 0x09, 0x00, 0x1D, 0x00, 0x00, 0x7E, 0x08, 0x11,
+  0x1C, 0xBF, 0x03, 0x11, 0x19, 0xC7, 0x00, 0x20, 0x1A, 0x1B, 0x65, 0x06, 0x05, 0x38, 0x07, 0x00,
+  0x6D, 0x00, 0x03, 0xAF, 0x19, 0x20, 0x00, 0x00, 0xD4, 0x04, 0x0D, 0x01, 0x00, 0x00, 0x68, 0x06,
+  0x00, 0x49, 0x03, 0x0F, 0xFC, 0x1F, 0x02, 0x0F, 0xC8, 0x00, 0x04, 0x01, 0x1F, 0x0A, 0x0B, 0xC8,
+  0x00, 0x37, 0x9E, 0x18, 0x08, 0x40, 0x06, 0x15, 0x11, 0x80, 0x0C, 0x05, 0x40, 0x06, 0x42, 0x19,
+  0x19, 0x31, 0x12, 0xF2, 0x0A, 0x01, 0xC7, 0x00, 0x02, 0xC4, 0x00, 0x00, 0xC6, 0x00, 0x20, 0x17,
+  0x18, 0x8D, 0x01, 0x03, 0xC7, 0x00, 0x20, 0x18, 0x19, 0x8F, 0x00, 0x01, 0x13, 0x03, 0x03, 0xFC,
+  0x27, 0x00, 0xBB, 0x00, 0x02, 0x6D, 0x00, 0x04, 0x41, 0x1B, 0x24, 0x9F, 0x1D, 0x6D, 0x17, 0x08,
+  0xC8, 0x00, 0x00, 0x67, 0x06, 0x03, 0x63, 0x23, 0x0F, 0xC8, 0x00, 0x06, 0x04, 0x83, 0x01, 0x02,
+  0x20, 0x03, 0x03, 0x7E, 0x1E, 0x04, 0xA7, 0x25, 0x00, 0x9E, 0x21, 0x00, 0x04, 0x28, 0x27, 0x16,
+  0x08, 0x08, 0x07, 0x1E, 0x11, 0x90, 0x01, 0x14, 0x31, 0x48, 0x0D, 0x00, 0x55, 0x02, 0x02, 0x89,
+  0x01, 0x03, 0x81, 0x00, 0x01, 0xBC, 0x07, 0x10, 0x1C, 0xCA, 0x0A, 0x00, 0x0D, 0x00, 0x00, 0xC5,
+  0x00, 0x00, 0x92, 0x00, 0x05, 0x80, 0x00, 0x22, 0x9F, 0x9F, 0xC8, 0x00, 0x07, 0xE5, 0x10, 0x40,
+  0x1B, 0x1B, 0x1A, 0x19, 0x32, 0x07, 0x05, 0x01, 0x00, 0x00, 0x46, 0x04, 0x00, 0x18, 0x1A, 0x0F,
+  0xC7, 0x00, 0x08, 0x0C, 0x01, 0x00, 0x04, 0x99, 0x21, 0x01, 0xA6, 0x05, 0x02, 0xBA, 0x0B, 0x9E,
+  0x9E, 0x9C, 0x9C, 0xE9, 0xE9, 0x9E, 0x14, 0x12, 0x18, 0xC8, 0x00, 0x05, 0x90, 0x01, 0x05, 0xD7,
+  0x0E, 0x11, 0x1D, 0x2D, 0x06, 0x03, 0xC8, 0x00, 0x00, 0xE2, 0x03, 0x00, 0xB6, 0x00, 0x00, 0xE9,
+  0x0D, 0x20, 0x18, 0x17, 0x44, 0x03, 0x02, 0xC5, 0x00, 0x28, 0x1D, 0x1E, 0x50, 0x3A, 0x02, 0x89,
+  0x03, 0x00, 0x05, 0x00, 0x12, 0x9C, 0xA4, 0x23, 0x00, 0x01, 0x12, 0x50, 0x1A, 0x1B, 0x1D, 0x1C,
+  0xEB, 0x9C, 0x02, 0x10, 0x19, 0xD6, 0x21, 0x01, 0x66, 0x1C, 0x2F, 0x1D, 0x1E, 0x81, 0x16, 0x02,
+  0x0F, 0x93, 0x16, 0x01, 0x05, 0x87, 0x25, 0x03, 0xC8, 0x00, 0x01, 0x69, 0x00, 0x02, 0xC8, 0x00,
+  0x44, 0x9E, 0x17, 0x0F, 0x18, 0xA0, 0x0F, 0x0D, 0x90, 0x01, 0x35, 0x18, 0x11, 0x0F, 0x8C, 0x05,
+  0x12, 0x1C, 0x4D, 0x0F, 0x00, 0x48, 0x01, 0x00, 0x8E, 0x04, 0x00, 0x0E, 0x02, 0x01, 0x57, 0x10,
+  0x13, 0x1A, 0x0E, 0x00, 0x01, 0x56, 0x01, 0x01, 0xAE, 0x00, 0x03, 0x4E, 0x2C, 0x10, 0xE8, 0x24,
+  0x25, 0x03, 0x30, 0x09, 0x13, 0x9F, 0x48, 0x3E, 0x00, 0xC6, 0x0B, 0x02, 0x08, 0x04, 0x04, 0x15,
+  0x08, 0x30, 0x1D, 0x1E, 0x1E, 0x5F, 0x29, 0x0F, 0x01, 0x00, 0x10, 0x05, 0x08, 0x07, 0x01, 0xCF,
+  0x04, 0x03, 0x4F, 0x26, 0x01, 0x31, 0x01, 0x02, 0xE8, 0x32, 0x21, 0x18, 0x0F, 0x86, 0x16, 0x10,
+  0x1B, 0x6D, 0x1E, 0x0B, 0x90, 0x01, 0x25, 0x13, 0x0F, 0x5A, 0x0D, 0x01, 0xC7, 0x04, 0x06, 0x7F,
+  0x00, 0x02, 0xE5, 0x18, 0x00, 0xC4, 0x00, 0x03, 0xC5, 0x00, 0x01, 0x71, 0x01, 0x00, 0xFF, 0x3E,
+  0x23, 0x00, 0x00, 0xC7, 0x00, 0x13, 0x9E, 0x97, 0x2E, 0x01, 0xC9, 0x00, 0x03, 0xC8, 0x00, 0x02,
+  0x8A, 0x37, 0x01, 0x53, 0x1C, 0x05, 0x7F, 0x0A, 0x0F, 0xC7, 0x00, 0x14, 0x02, 0xC8, 0x00, 0x36,
+  0x00, 0xE4, 0xE4, 0xEF, 0x01, 0x01, 0x09, 0x00, 0x14, 0xE9, 0xC8, 0x00, 0x50, 0x9D, 0x1B, 0x18,
+  0x0F, 0x12, 0xB7, 0x0B, 0x1C, 0x11, 0x90, 0x01, 0x32, 0x14, 0x0F, 0x12, 0x48, 0x05, 0x01, 0x16,
+  0x18, 0x02, 0x71, 0x13, 0x03, 0x7D, 0x00, 0x00, 0x98, 0x04, 0x00, 0xEF, 0x1C, 0x01, 0xA3, 0x0C,
+  0x01, 0x19, 0x02, 0x03, 0xA8, 0x00, 0x04, 0xC8, 0x00, 0x07, 0x2F, 0x01, 0x02, 0xCB, 0x02, 0x05,
+  0x4A, 0x01, 0x01, 0xC5, 0x04, 0x05, 0xD4, 0x1A, 0x00, 0x7F, 0x2C, 0x00, 0xA8, 0x2E, 0x03, 0xF5,
+  0x3F, 0x02, 0x3D, 0x09, 0x03, 0xB8, 0x32, 0x04, 0x4A, 0x09, 0x11, 0x9C, 0x09, 0x00, 0x01, 0xC8,
+  0x00, 0x45, 0xE4, 0x00, 0xE9, 0xE4, 0x3E, 0x1F, 0x04, 0xDA, 0x20, 0x03, 0xF2, 0x2E, 0x86, 0x1F,
+  0x1F, 0x1B, 0x18, 0x12, 0x07, 0x10, 0x10, 0xC8, 0x00, 0x02, 0x90, 0x01, 0x30, 0x14, 0x0F, 0x11,
+  0xA9, 0x08, 0x02, 0x01, 0x00, 0x0C, 0x71, 0x03, 0x23, 0x1F, 0x1F, 0xC4, 0x00, 0x12, 0x1E, 0xC7,
+  0x29, 0x02, 0xC9, 0x00, 0x05, 0x4B, 0x28, 0x04, 0xF7, 0x01, 0x07, 0xC7, 0x00, 0x12, 0xE8, 0xA7,
+  0x23, 0x01, 0x95, 0x01, 0x04, 0xC9, 0x1A, 0x02, 0x04, 0x0A, 0x0F, 0xC8, 0x00, 0x17, 0x34, 0xE4,
+  0x1F, 0xE4, 0xC8, 0x00, 0x11, 0xE8, 0xE4, 0x01, 0x02, 0xFA, 0x01, 0x04, 0xC8, 0x00, 0xF7, 0x09,
+  0x1D, 0x1D, 0x29, 0x26, 0x21, 0x35, 0x23, 0x23, 0x27, 0x27, 0x04, 0x04, 0x04, 0x22, 0x36, 0x35,
+  0x34, 0x34, 0x33, 0x32, 0x07, 0x14, 0x0F, 0x11, 0xE8, 0x0E, 0x05, 0x67, 0x07, 0x03, 0xB4, 0x00,
+  0x05, 0xD7, 0x37, 0x06, 0x88, 0x03, 0x04, 0x90, 0x01, 0x07, 0x8F, 0x01, 0x06, 0x5F, 0x2F, 0x05,
+  0x90, 0x01, 0x03, 0xDB, 0x3F, 0x02, 0xD5, 0x04, 0x11, 0x9E, 0xC8, 0x00, 0x04, 0x86, 0x41, 0x01,
+  0xF5, 0x02, 0x03, 0xBB, 0x00, 0x04, 0x0F, 0x00, 0x03, 0xE0, 0x35, 0x23, 0x9E, 0x9E, 0x58, 0x02,
+  0x10, 0xE9, 0x58, 0x02, 0x04, 0x4F, 0x00, 0x04, 0x56, 0x00, 0x02, 0xEB, 0x32, 0x04, 0xBB, 0x06,
+  0x02, 0x01, 0x00, 0xB0, 0x2B, 0x2B, 0x04, 0x26, 0x22, 0x37, 0x34, 0x32, 0x31, 0x0F, 0x12, 0x8F,
+  0x0C, 0x0B, 0xC8, 0x00, 0x03, 0x0C, 0x01, 0x03, 0xBE, 0x03, 0x01, 0x97, 0x02, 0x09, 0xC7, 0x00,
+  0x01, 0x58, 0x02, 0x01, 0xDB, 0x17, 0x07, 0x8E, 0x01, 0x0A, 0xC7, 0x00, 0x01, 0xC8, 0x00, 0x04,
+  0xB9, 0x00, 0x0F, 0xC8, 0x00, 0x1D, 0x00, 0xC7, 0x00, 0x11, 0xE4, 0x92, 0x01, 0x02, 0x1D, 0x03,
+  0x02, 0x01, 0x00, 0x02, 0x9C, 0x06, 0x10, 0x16, 0xDC, 0x23, 0x00, 0xC7, 0x0E, 0x62, 0x34, 0x35,
+  0x36, 0x21, 0x22, 0x24, 0xF0, 0x0A, 0x0C, 0x01, 0x00, 0x07, 0xC5, 0x00, 0x04, 0x65, 0x01, 0x03,
+  0xC8, 0x00, 0x02, 0xC9, 0x00, 0x04, 0x9C, 0x01, 0x03, 0x8F, 0x31, 0x02, 0x6A, 0x05, 0x03, 0x1A,
+  0x00, 0x02, 0x06, 0x00, 0x04, 0x1E, 0x03, 0x02, 0x01, 0x00, 0x14, 0x1F, 0xC8, 0x00, 0x03, 0x2B,
+  0x00, 0x01, 0x0F, 0x00, 0x04, 0x4F, 0x02, 0x05, 0xED, 0x01, 0x05, 0x1A, 0x35, 0x24, 0x9D, 0x9D,
+  0x90, 0x01, 0x10, 0x00, 0xCA, 0x00, 0x05, 0x14, 0x01, 0x02, 0xC7, 0x00, 0x19, 0x18, 0x60, 0x09,
+  0x20, 0x16, 0x13, 0x20, 0x03, 0x1F, 0x08, 0xC8, 0x00, 0x14, 0x02, 0x78, 0x00, 0x05, 0x90, 0x01,
+  0x04, 0x63, 0x02, 0x05, 0xF8, 0x3B, 0x08, 0xB5, 0x00, 0x05, 0xD9, 0x00, 0x0A, 0x12, 0x00, 0x0F,
+  0xC8, 0x00, 0x22, 0x10, 0xE4, 0x18, 0x05, 0x00, 0x02, 0x00, 0x06, 0xC7, 0x00, 0x19, 0x08, 0xD8,
+  0x0E, 0x12, 0x19, 0x18, 0x15, 0x1F, 0x17, 0xC8, 0x00, 0x08, 0x04, 0x46, 0x41, 0x04, 0x68, 0x00,
+  0x01, 0x42, 0x2B, 0x07, 0xAD, 0x04, 0x21, 0xE8, 0xE8, 0x20, 0x3C, 0x0F, 0x01, 0x00, 0x12, 0x02,
+  0x51, 0x00, 0x08, 0xC8, 0x00, 0x22, 0x1F, 0x1F, 0xB2, 0x00, 0x07, 0xC8, 0x00, 0x03, 0x2B, 0x01,
+  0x01, 0x5D, 0x02, 0x04, 0x80, 0x0C, 0x0B, 0x8D, 0x01, 0x4B, 0xE9, 0xE9, 0x08, 0x18, 0xA0, 0x0F,
+  0x02, 0xB0, 0x04, 0x1F, 0x19, 0xC9, 0x00, 0x02, 0x51, 0x1F, 0x1F, 0xE9, 0x1F, 0xE9, 0x65, 0x04,
+  0x07, 0x82, 0x04, 0x0F, 0x01, 0x00, 0x01, 0x0F, 0xC8, 0x00, 0x1E, 0x00, 0x8F, 0x07, 0x00, 0x4A,
+  0x42, 0x19, 0x9C, 0xC8, 0x00, 0x04, 0x36, 0x06, 0x0E, 0xC8, 0x00, 0x0C, 0x01, 0x00, 0x2C, 0x1D,
+  0x08, 0x68, 0x10, 0x02, 0xC8, 0x00, 0x26, 0x17, 0x19, 0x06, 0x27, 0x06, 0x01, 0x00, 0x1F, 0x98,
+  0x01, 0x00, 0x14, 0x4F, 0x9A, 0x1F, 0x1F, 0x9F, 0x2C, 0x00, 0x15, 0xE2, 0x98, 0x98, 0x98, 0x1F,
+  0x1F, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x04, 0x00, 0x0F, 0x5A, 0x00, 0x08,
+  0x00, 0xEB, 0x01, 0x0F, 0x2E, 0x00, 0x00, 0x1D, 0x08, 0x58, 0x1B, 0x03, 0x40, 0x06, 0x3F, 0x17,
+  0x1D, 0x2B, 0xC8, 0x00, 0x0B, 0x04, 0x42, 0x00, 0x1B, 0x97, 0x01, 0x00, 0x60, 0x99, 0x99, 0x99,
+  0x99, 0x9A, 0x9F, 0xC8, 0x00, 0x0F, 0x9D, 0x00, 0x03, 0x0F, 0x16, 0x00, 0x00, 0x23, 0x1F, 0x1F,
+  0x63, 0x3A, 0x0F, 0xED, 0x00, 0x09, 0x02, 0xC7, 0x00, 0x10, 0x9F, 0x22, 0x01, 0x0F, 0xE8, 0x00,
+  0x00, 0x0F, 0xC8, 0x00, 0x06, 0x39, 0x07, 0x17, 0x00, 0xE2, 0x0E, 0x02, 0xC8, 0x00, 0x13, 0x99,
+  0xAA, 0x00, 0x05, 0xCC, 0x00, 0x60, 0x9B, 0x99, 0x97, 0x97, 0x9A, 0x9A, 0x16, 0x00, 0x22, 0x9A,
+  0x9A, 0xD6, 0x00, 0x01, 0x04, 0x00, 0x00, 0xC9, 0x00, 0x05, 0x03, 0x3B, 0x12, 0x9A, 0x1B, 0x00,
+  0x00, 0x0B, 0x00, 0x02, 0x3A, 0x00, 0x0C, 0x16, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x0A, 0x00, 0x17,
+  0x9A, 0x5F, 0x00, 0x0F, 0x0B, 0x00, 0x03, 0x02, 0xC8, 0x00, 0x08, 0x12, 0x00, 0x03, 0x07, 0x00,
+  0x1A, 0x08, 0xC0, 0x12, 0x17, 0x1C, 0x28, 0x0A, 0x1E, 0x00, 0xB1, 0x16, 0x02, 0xBE, 0x00, 0x30,
+  0x96, 0x96, 0x96, 0xAF, 0x00, 0x05, 0x60, 0x01, 0x20, 0x9A, 0x9A, 0xCA, 0x00, 0x01, 0x08, 0x00,
+  0x04, 0xA3, 0x01, 0x01, 0xC8, 0x00, 0x12, 0x9D, 0x9D, 0x00, 0x12, 0x9A, 0xDE, 0x00, 0x03, 0xC5,
+  0x00, 0x01, 0x77, 0x01, 0x0B, 0x16, 0x00, 0x22, 0x1F, 0x1F, 0x09, 0x00, 0x01, 0xD9, 0x00, 0x08,
+  0x5F, 0x00, 0x0C, 0x0B, 0x00, 0x01, 0xC7, 0x00, 0x04, 0xB8, 0x01, 0x03, 0x1D, 0x00, 0x02, 0x07,
+  0x00, 0x09, 0xC8, 0x00, 0x01, 0xF8, 0x11, 0x06, 0xC8, 0x00, 0x1F, 0x13, 0x90, 0x01, 0x00, 0x21,
+  0x99, 0x99, 0x0C, 0x01, 0x02, 0x50, 0x02, 0x01, 0x0B, 0x01, 0x10, 0x96, 0x4B, 0x00, 0x00, 0xC5,
+  0x00, 0x02, 0x70, 0x00, 0x02, 0x91, 0x01, 0x04, 0xC9, 0x00, 0x00, 0x76, 0x01, 0x01, 0x01, 0x00,
+  0x02, 0xC6, 0x00, 0x12, 0x99, 0xB8, 0x00, 0x0C, 0x16, 0x00, 0x20, 0x1F, 0x1F, 0x12, 0x00, 0x00,
+  0x5C, 0x00, 0x02, 0x5F, 0x00, 0x00, 0x4B, 0x00, 0x03, 0xF4, 0x01, 0x10, 0x96, 0x01, 0x00, 0x14,
+  0x98, 0x75, 0x00, 0x02, 0xC8, 0x00, 0x01, 0x98, 0x02, 0x07, 0x87, 0x00, 0x00, 0x07, 0x00, 0xFE,
+  0x0E, 0x1A, 0x9D, 0x33, 0x34, 0x1E, 0x1C, 0x19, 0x17, 0x17, 0x16, 0x13, 0x07, 0x16, 0x17, 0x19,
+  0x1C, 0x1D, 0x1E, 0x9D, 0x1D, 0x08, 0x1B, 0x1B, 0x04, 0x14, 0x07, 0x07, 0x1A, 0x11, 0xC8, 0x00,
+  0x03, 0x82, 0x00, 0x08, 0x12, 0x01, 0x12, 0x99, 0x86, 0x01, 0x00, 0x93, 0x00, 0x06, 0x9B, 0x01,
+  0x03, 0xC8, 0x00, 0x47, 0x9D, 0x9D, 0x9A, 0x9A, 0x62, 0x3D, 0x22, 0x99, 0x99, 0xB8, 0x00, 0x02,
+  0x43, 0x00, 0x06, 0x16, 0x00, 0x20, 0x1F, 0x1F, 0x12, 0x00, 0x01, 0x3F, 0x00, 0x04, 0x73, 0x02,
+  0x13, 0x9A, 0xBC, 0x00, 0x01, 0xC8, 0x00, 0x20, 0x96, 0x96, 0xAF, 0x00, 0x05, 0x56, 0x02, 0x0D,
+  0x1E, 0x01, 0x30, 0x9B, 0x99, 0x99, 0xC8, 0x00, 0x40, 0x35, 0x1E, 0x07, 0x12, 0x4A, 0x22, 0xBF,
+  0x11, 0x12, 0x13, 0x16, 0x18, 0x1A, 0x1B, 0x04, 0x04, 0x04, 0x0C, 0xC8, 0x00, 0x05, 0x04, 0x41,
+  0x00, 0x01, 0x3D, 0x01, 0x03, 0x0B, 0x01, 0x02, 0x09, 0x00, 0x00, 0x9C, 0x01, 0x08, 0x3E, 0x03,
+  0x07, 0xC9, 0x00, 0x13, 0x9A, 0x37, 0x05, 0x01, 0xEE, 0x00, 0x01, 0x40, 0x02, 0x03, 0x85, 0x00,
+  0x04, 0x32, 0x03, 0x0E, 0xB0, 0x04, 0x35, 0x9A, 0x9A, 0x98, 0x2B, 0x01, 0x01, 0x2E, 0x01, 0x01,
+  0x6C, 0x00, 0x02, 0x8F, 0x01, 0x08, 0x3E, 0x00, 0x02, 0x42, 0x00, 0x41, 0x99, 0x98, 0x98, 0x19,
+  0x70, 0x17, 0x45, 0x1E, 0x07, 0x08, 0x08, 0xC5, 0x0A, 0x41, 0x08, 0x08, 0x0C, 0x04, 0xF0, 0x0A,
+  0x1F, 0x0F, 0x58, 0x02, 0x01, 0x0B, 0x6D, 0x04, 0x04, 0x4F, 0x02, 0x01, 0x9C, 0x01, 0x01, 0x0D,
+  0x00, 0x03, 0xB7, 0x02, 0x04, 0xC8, 0x00, 0x0A, 0x01, 0x00, 0x40, 0x9B, 0x9D, 0x99, 0x9D, 0x35,
+  0x00, 0x0A, 0xC9, 0x00, 0x67, 0x1F, 0x1F, 0x9B, 0x9D, 0x97, 0x97, 0xFD, 0x03, 0x03, 0x79, 0x03,
+  0x05, 0x2B, 0x01, 0x20, 0x98, 0x98, 0xCB, 0x00, 0x01, 0xC7, 0x00, 0x01, 0x1B, 0x01, 0x0B, 0x08,
+  0x01, 0x33, 0x99, 0x99, 0x98, 0x38, 0x18, 0x20, 0x1E, 0x16, 0x41, 0x12, 0x82, 0x1E, 0x9D, 0x9D,
+  0x04, 0x04, 0x0C, 0x0C, 0x0C, 0xC8, 0x00, 0x2F, 0x11, 0x12, 0x58, 0x02, 0x00, 0x0C, 0x83, 0x04,
+  0x07, 0x9C, 0x01, 0x02, 0x0B, 0x00, 0x05, 0x7A, 0x00, 0x00, 0x76, 0x00, 0x0F, 0x01, 0x00, 0x16,
+  0x00, 0xC8, 0x00, 0x20, 0x97, 0x9B, 0xE9, 0x03, 0x01, 0x3D, 0x00, 0x02, 0x8C, 0x01, 0x01, 0x69,
+  0x02, 0x01, 0x71, 0x03, 0x02, 0x01, 0x00, 0x02, 0xCE, 0x05, 0x05, 0xC8, 0x00, 0x04, 0x56, 0x02,
+  0x01, 0x05, 0x00, 0x10, 0x18, 0x58, 0x02, 0x32, 0x36, 0x22, 0x24, 0x01, 0x18, 0x00, 0xCA, 0x00,
+  0x41, 0x00, 0x08, 0x04, 0x04, 0xE8, 0x03, 0x06, 0x96, 0x0F, 0x08, 0xC8, 0x00, 0x07, 0x83, 0x04,
+  0x01, 0x97, 0x03, 0x05, 0x6A, 0x02, 0x04, 0xD2, 0x00, 0x04, 0x5D, 0x02, 0x00, 0x76, 0x00, 0x0F,
+  0x11, 0x06, 0x0F, 0x01, 0x01, 0x00, 0x00, 0xC4, 0x07, 0x12, 0x9B, 0x35, 0x00, 0x02, 0x20, 0x01,
+  0x02, 0xE9, 0x01, 0x00, 0x4D, 0x00, 0x00, 0x19, 0x03, 0x03, 0x23, 0x03, 0x02, 0x8F, 0x01, 0x11,
+  0x9A, 0xC7, 0x00, 0x09, 0x74, 0x03, 0x00, 0x05, 0x00, 0x14, 0x17, 0xB0, 0x04, 0x19, 0x04, 0x28,
+  0x0A, 0x46, 0x14, 0x14, 0x07, 0x12, 0x96, 0x0F, 0x06, 0xC8, 0x00, 0x0C, 0x65, 0x03, 0x00, 0x7B,
+  0x00, 0x02, 0x28, 0x02, 0x05, 0x9A, 0x01, 0x05, 0x9E, 0x00, 0x01, 0xC9, 0x00, 0x08, 0xEA, 0x05,
+  0x11, 0x97, 0x0D, 0x00, 0x0C, 0x34, 0x07, 0x21, 0x9B, 0x9B, 0xC8, 0x00, 0x03, 0x3F, 0x00, 0x02,
+  0x55, 0x05, 0x11, 0x9B, 0x9B, 0x01, 0x01, 0xD0, 0x00, 0x15, 0x98, 0xEC, 0x03, 0x08, 0xAA, 0x02,
+  0x08, 0x56, 0x02, 0x01, 0x05, 0x00, 0x1B, 0x07, 0x08, 0x07, 0x03, 0x28, 0x0A, 0x4E, 0x14, 0x14,
+  0x07, 0x0F, 0x57, 0x02, 0x0E, 0x20, 0x03, 0x04, 0x85, 0x07, 0x16, 0x9B, 0x98, 0x01, 0x05, 0xBA,
+  0x00, 0x06, 0x91, 0x01, 0x04, 0x07, 0x06, 0x00, 0x02, 0x06, 0x0E, 0x34, 0x07, 0x22, 0x98, 0x97,
+  0x54, 0x09, 0x01, 0xF9, 0x04, 0x02, 0x5F, 0x06, 0x06, 0xC7, 0x05, 0x02, 0xB5, 0x02, 0x05, 0x8F,
+  0x01, 0x0F, 0x99, 0x02, 0x06, 0x4F, 0x98, 0x07, 0x08, 0x0C, 0xD0, 0x07, 0x03, 0x0F, 0x57, 0x02,
+  0x00, 0x0D, 0x20, 0x03, 0x05, 0xE0, 0x01, 0x01, 0xFE, 0x04, 0x02, 0x01, 0x00, 0x06, 0xBA, 0x00,
+  0x00, 0xC9, 0x00, 0x08, 0xD8, 0x04, 0x02, 0x2C, 0x07, 0x03, 0x5D, 0x01, 0x02, 0x08, 0x00, 0x51,
+  0x98, 0x98, 0x95, 0x95, 0x97, 0x90, 0x01, 0x01, 0xCA, 0x00, 0x07, 0xB0, 0x04, 0x03, 0xDC, 0x05,
+  0x06, 0xD2, 0x08, 0x02, 0xB4, 0x09, 0x00, 0x45, 0x01, 0x0F, 0x9D, 0x02, 0x03, 0x19, 0x07, 0xE0,
+  0x15, 0x05, 0xC8, 0x00, 0x26, 0x12, 0x0F, 0x97, 0x0F, 0x0F, 0x20, 0x03, 0x04, 0x03, 0x4E, 0x06,
+  0x02, 0x98, 0x01, 0x01, 0x60, 0x00, 0x00, 0x1B, 0x00, 0x06, 0xBA, 0x00, 0x01, 0x91, 0x01, 0x04,
+  0x84, 0x02, 0x02, 0xDF, 0x00, 0x04, 0x49, 0x05, 0x05, 0x09, 0x00, 0x24, 0x95, 0x97, 0xC8, 0x00,
+  0x22, 0x9B, 0x99, 0x31, 0x02, 0x01, 0xDF, 0x01, 0x12, 0x9B, 0x39, 0x02, 0x07, 0xBC, 0x08, 0x02,
+  0xE5, 0x03, 0x05, 0x01, 0x00, 0x05, 0xAC, 0x02, 0x06, 0x27, 0x09, 0x11, 0x07, 0xE0, 0x15, 0x03,
+  0x20, 0x03, 0x05, 0xC8, 0x00, 0x2E, 0x0F, 0x12, 0x1F, 0x03, 0x0E, 0x20, 0x03, 0x04, 0x2F, 0x04,
+  0x03, 0x73, 0x08, 0x0B, 0x1B, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xD8, 0x00, 0x01, 0x21, 0x00, 0x01,
+  0x73, 0x00, 0x03, 0x34, 0x07, 0x01, 0x8D, 0x04, 0x02, 0xC8, 0x00, 0x71, 0x95, 0x95, 0x95, 0x99,
+  0x1F, 0x1F, 0x9D, 0x00, 0x43, 0x00, 0x69, 0x06, 0x04, 0xAD, 0x08, 0x01, 0xC9, 0x00, 0x07, 0xBC,
+  0x08, 0x00, 0x8F, 0x01, 0x0B, 0xDE, 0x09, 0x03, 0xE6, 0x00, 0x05, 0xBD, 0x08, 0x25, 0x07, 0x1A,
+  0xC8, 0x00, 0x06, 0x60, 0x09, 0x0F, 0x57, 0x02, 0x01, 0x07, 0xD0, 0x07, 0x0B, 0x2F, 0x04, 0x00,
+  0xC6, 0x00, 0x0E, 0x1B, 0x00, 0x01, 0x91, 0x01, 0x0D, 0x6F, 0x02, 0x13, 0x98, 0x47, 0x09, 0x02,
+  0x1D, 0x09, 0x03, 0xC8, 0x00, 0x09, 0x01, 0x00, 0x32, 0x99, 0x99, 0x9D, 0xF5, 0x07, 0x06, 0x14,
+  0x01, 0x06, 0x8F, 0x01, 0x02, 0x44, 0x00, 0x03, 0xD0, 0x09, 0x07, 0x6F, 0x06, 0x52, 0x98, 0x98,
+  0x08, 0x18, 0x1B, 0xC8, 0x00, 0x07, 0x60, 0x09, 0x2F, 0x10, 0x31, 0xC7, 0x00, 0x00, 0x25, 0x1D,
+  0x96, 0xCE, 0x03, 0x0B, 0x2F, 0x04, 0x02, 0x1E, 0x01, 0x0C, 0x1B, 0x00, 0x02, 0x5A, 0x02, 0x02,
+  0x8C, 0x02, 0x07, 0x6F, 0x02, 0x01, 0x7E, 0x00, 0x05, 0x1D, 0x09, 0x02, 0xC8, 0x00, 0x00, 0x8B,
+  0x01, 0x10, 0x9A, 0x91, 0x09, 0x02, 0x2F, 0x07, 0x11, 0x9B, 0xC1, 0x04, 0x06, 0xD3, 0x08, 0x11,
+  0x99, 0x8F, 0x01, 0x01, 0x83, 0x03, 0x11, 0x95, 0x96, 0x02, 0x01, 0xD0, 0x00, 0x00, 0x4A, 0x00,
+  0x08, 0xA1, 0x01, 0x21, 0x08, 0x1A, 0x67, 0x16, 0x10, 0x1B, 0x75, 0x16, 0x00, 0x8F, 0x2A, 0x31,
+  0x1C, 0x18, 0x16, 0xE0, 0x2E, 0x0D, 0x01, 0x00, 0x1F, 0x19, 0xDB, 0x06, 0x18, 0x01, 0x01, 0x00,
+  0x04, 0xBF, 0x0B, 0x00, 0xDE, 0x00, 0x04, 0x5D, 0x01, 0x03, 0x46, 0x01, 0x03, 0x27, 0x03, 0x00,
+  0x63, 0x02, 0x0C, 0x90, 0x01, 0x09, 0x02, 0x08, 0x05, 0xDA, 0x01, 0x06, 0x65, 0x04, 0x08, 0x14,
+  0x01, 0x09, 0x15, 0x0B, 0x31, 0x08, 0x07, 0x11, 0x5F, 0x09, 0x04, 0x34, 0x11, 0x2F, 0x0C, 0x0C,
+  0xC7, 0x00, 0x02, 0x32, 0x1D, 0x19, 0x19, 0x7A, 0x00, 0x0F, 0x01, 0x00, 0x16, 0x06, 0xEB, 0x03,
+  0x09, 0x70, 0x02, 0x00, 0x46, 0x01, 0x01, 0xC8, 0x00, 0x02, 0x3D, 0x03, 0x0F, 0x10, 0x01, 0x11,
+  0x05, 0xC8, 0x00, 0x00, 0x7B, 0x09, 0x04, 0x6E, 0x04, 0x08, 0xBB, 0x08, 0x00, 0x48, 0x21, 0x20,
+  0x1D, 0x1E, 0xDD, 0x1D, 0x10, 0x9D, 0xBF, 0x15, 0x01, 0xC9, 0x2E, 0x01, 0x5B, 0x1D, 0xA5, 0x1C,
+  0x24, 0x25, 0x04, 0x04, 0x25, 0x23, 0x20, 0x36, 0x35, 0xD7, 0x00, 0x14, 0x19, 0xC9, 0x00, 0x07,
+  0xB8, 0x07, 0x02, 0xE2, 0x06, 0x02, 0x0F, 0x00, 0x0D, 0xE4, 0x06, 0x02, 0xBC, 0x06, 0x09, 0xC9,
+  0x00, 0x03, 0x05, 0x02, 0x02, 0x46, 0x01, 0x02, 0x32, 0x0B, 0x00, 0x80, 0x0C, 0x0F, 0x0F, 0x01,
+  0x0E, 0x00, 0x08, 0x00, 0x03, 0x4A, 0x04, 0x0F, 0x53, 0x04, 0x00, 0x20, 0x98, 0x1D, 0x26, 0x1E,
+  0x11, 0x1E, 0xC8, 0x00, 0x08, 0x01, 0x00, 0x21, 0x9D, 0x9D, 0x74, 0x21, 0x01, 0x76, 0x19, 0x33,
+  0x07, 0x11, 0x07, 0xC9, 0x00, 0x00, 0xEB, 0x17, 0x01, 0xC9, 0x00, 0x04, 0x83, 0x0E, 0x05, 0xE2,
+  0x06, 0x01, 0x30, 0x06, 0x0F, 0xE4, 0x06, 0x00, 0x02, 0x22, 0x03, 0x02, 0xE9, 0x02, 0x00, 0xCB,
+  0x00, 0x11, 0x97, 0x13, 0x06, 0x02, 0x2D, 0x07, 0x01, 0xDE, 0x02, 0x00, 0x24, 0x00, 0x31, 0x1F,
+  0x1F, 0x99, 0x4A, 0x05, 0x00, 0x94, 0x00, 0x0F, 0x07, 0x0E, 0x01, 0x04, 0x5E, 0x0E, 0x00, 0x41,
+  0x00, 0x01, 0xF2, 0x04, 0x04, 0x68, 0x06, 0x04, 0x5D, 0x06, 0x00, 0x29, 0x0A, 0x03, 0x08, 0x07,
+  0x04, 0x98, 0x08, 0x14, 0x15, 0x98, 0x08, 0x01, 0xE1, 0x15, 0x03, 0x58, 0x1B, 0x13, 0x12, 0xBD,
+  0x04, 0x01, 0xB4, 0x18, 0x00, 0xD6, 0x02, 0x03, 0x94, 0x08, 0x06, 0xE2, 0x06, 0x04, 0x40, 0x04,
+  0x0B, 0x18, 0x0E, 0x02, 0x88, 0x0C, 0x00, 0xBD, 0x03, 0x07, 0x40, 0x01, 0x03, 0x62, 0x0C, 0x02,
+  0x53, 0x01, 0x02, 0x53, 0x05, 0x00, 0xE2, 0x00, 0x21, 0x97, 0x97, 0x99, 0x06, 0x04, 0x16, 0x01,
+  0x06, 0x20, 0x0A, 0x01, 0x45, 0x00, 0x11, 0x9B, 0x21, 0x04, 0x05, 0x23, 0x05, 0x0A, 0x5D, 0x06,
+  0x2C, 0x98, 0x98, 0xC8, 0x00, 0x06, 0x98, 0x08, 0x08, 0x58, 0x1B, 0x13, 0x17, 0x1B, 0x0E, 0x01,
+  0xC8, 0x00, 0x00, 0x93, 0x01, 0x3C, 0x9D, 0x98, 0x9B, 0x77, 0x0A, 0x0F, 0x18, 0x0E, 0x03, 0x03,
+  0x4C, 0x01, 0x03, 0xB4, 0x03, 0x07, 0xCE, 0x08, 0x01, 0xD1, 0x01, 0x02, 0x25, 0x02, 0x42, 0x9A,
+  0x1F, 0x1F, 0x9D, 0xF5, 0x00, 0x07, 0xAD, 0x0B, 0x04, 0x9C, 0x02, 0x05, 0xCB, 0x0C, 0x03, 0x10,
+  0x09, 0x01, 0x41, 0x01, 0x00, 0x42, 0x00, 0x0A, 0x2F, 0x0F, 0x39, 0x1E, 0x17, 0x1A, 0xC8, 0x00,
+  0x07, 0x90, 0x1A, 0x07, 0x90, 0x01, 0x22, 0x1A, 0x13, 0x15, 0x07, 0x03, 0xC8, 0x00, 0x23, 0x19,
+  0x96, 0x21, 0x0D, 0x08, 0xBD, 0x03, 0x0F, 0x18, 0x0E, 0x03, 0x08, 0x88, 0x0C, 0x12, 0x9B, 0x7E,
+  0x04, 0x04, 0x32, 0x00, 0x06, 0x37, 0x02, 0x22, 0x1F, 0x1F, 0xF1, 0x02, 0x02, 0x02, 0x01, 0x05,
+  0x46, 0x03, 0x01, 0x22, 0x0A, 0x04, 0x0B, 0x01, 0x02, 0x42, 0x00, 0x02, 0x29, 0x0E, 0x23, 0x99,
+  0x99, 0xFF, 0x04, 0x05, 0x1E, 0x03, 0x4F, 0x98, 0x1C, 0x17, 0x18, 0xC8, 0x00, 0x05, 0x07, 0x90,
+  0x01, 0x2A, 0x19, 0x11, 0xC8, 0x00, 0x21, 0x19, 0x9A, 0xE4, 0x0D, 0x0A, 0x2D, 0x06, 0x06, 0x4A,
+  0x10, 0x08, 0x1F, 0x02, 0x09, 0x51, 0x0D, 0x00, 0x18, 0x06, 0x10, 0x9B, 0x97, 0x01, 0x04, 0x80,
+  0x0D, 0x01, 0x23, 0x00, 0x11, 0x9B, 0xD8, 0x0E, 0x01, 0x5F, 0x09, 0x06, 0xC9, 0x00, 0x00, 0x0F,
+  0x01, 0x06, 0xDF, 0x08, 0x01, 0x04, 0x01, 0x01, 0xB5, 0x08, 0x00, 0xA7, 0x0C, 0x0D, 0x19, 0x0F,
+  0x3A, 0x98, 0x98, 0x1A, 0xC8, 0x00, 0x1F, 0x1D, 0x90, 0x01, 0x04, 0x2A, 0x11, 0x16, 0xC8, 0x00,
+  0x00, 0x5B, 0x02, 0x06, 0x23, 0x01, 0x08, 0x1B, 0x01, 0x09, 0x5B, 0x0D, 0x00, 0xE3, 0x02, 0x0F,
+  0x19, 0x0E, 0x02, 0x01, 0xBD, 0x01, 0x04, 0x23, 0x00, 0x13, 0x9B, 0xF0, 0x0A, 0x00, 0x8C, 0x08,
+  0x06, 0x5C, 0x09, 0x04, 0xC6, 0x03, 0x01, 0x03, 0x07, 0x01, 0xCD, 0x01, 0x02, 0x01, 0x00, 0x05,
+  0x70, 0x07, 0x08, 0x44, 0x01, 0x46, 0x1D, 0x1A, 0x1A, 0x33, 0xC8, 0x00, 0x37, 0x00, 0x00, 0x1B,
+  0xF8, 0x11, 0x08, 0x90, 0x01, 0x12, 0x16, 0x8D, 0x0C, 0x06, 0xC8, 0x00, 0x03, 0xC9, 0x00, 0x00,
+  0x47, 0x01, 0x12, 0x9A, 0x2D, 0x01, 0x00, 0x6D, 0x01, 0x02, 0x2B, 0x01, 0x0A, 0x70, 0x02, 0x01,
+  0xC9, 0x00, 0x01, 0xA5, 0x15, 0x23, 0x9B, 0x9F, 0x5A, 0x02, 0x09, 0xE5, 0x06, 0x22, 0x9B, 0x99,
+  0xC8, 0x00, 0x00, 0xE2, 0x01, 0x10, 0x9B, 0x48, 0x00, 0x00, 0x2A, 0x0D, 0x07, 0x41, 0x00, 0x03,
+  0xBB, 0x05, 0x01, 0x6E, 0x00, 0x06, 0x9C, 0x02, 0x02, 0x02, 0x02, 0x00, 0x2F, 0x28, 0x00, 0x08,
+  0x00, 0x19, 0x1D, 0xC8, 0x00, 0x01, 0x2E, 0x35, 0x0F, 0x90, 0x01, 0x03, 0x21, 0x1A, 0x0F, 0x91,
+  0x01, 0x07, 0xC8, 0x00, 0x01, 0x24, 0x03, 0x0C, 0x66, 0x01, 0x15, 0x9D, 0x76, 0x0E, 0x07, 0x2C,
+  0x01, 0x0F, 0xE1, 0x0E, 0x11, 0x0E, 0x4C, 0x00, 0x05, 0x01, 0x00, 0x0C, 0xCF, 0x01, 0x00, 0x06,
+  0x01, 0x03, 0x8A, 0x08, 0x60, 0x1B, 0x07, 0x11, 0x11, 0x14, 0x19, 0xC7, 0x00, 0x32, 0x1E, 0x1A,
+  0x18, 0xC8, 0x00, 0x32, 0x08, 0x07, 0x07, 0x92, 0x1F, 0x07, 0x92, 0x24, 0x01, 0xE6, 0x0E, 0x00,
+  0x01, 0x00, 0x41, 0x19, 0x19, 0x1A, 0x16, 0xC9, 0x00, 0x08, 0xC8, 0x00, 0x30, 0x1D, 0x1D, 0x1D,
+  0xFE, 0x19, 0x0F, 0x01, 0x00, 0x19, 0x20, 0x9F, 0x95, 0x1D, 0x09, 0x02, 0xE7, 0x0A, 0x02, 0x99,
+  0x08, 0x05, 0x12, 0x11, 0x03, 0x14, 0x11, 0x04, 0x6B, 0x05, 0x05, 0x27, 0x00, 0x10, 0x95, 0x8F,
+  0x01, 0x0F, 0x4F, 0x00, 0x04, 0x61, 0x00, 0x07, 0x18, 0x08, 0x32, 0x17, 0xF8, 0x26, 0x22, 0x1C,
+  0x18, 0xC8, 0x00, 0xA0, 0x08, 0x07, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0xCD, 0x00,
+  0x02, 0xD7, 0x19, 0x21, 0x13, 0x13, 0x58, 0x34, 0x30, 0x0F, 0x14, 0x00, 0xE3, 0x1F, 0x10, 0x16,
+  0xC8, 0x32, 0x08, 0xC8, 0x00, 0x11, 0x19, 0xA9, 0x09, 0x04, 0xCA, 0x0E, 0x03, 0x7D, 0x04, 0x0C,
+  0xD5, 0x07, 0x07, 0xBE, 0x0E, 0x26, 0x99, 0x9D, 0xFD, 0x0A, 0x03, 0x44, 0x03, 0x08, 0x40, 0x02,
+  0x05, 0xFB, 0x10, 0x09, 0xE1, 0x06, 0x02, 0x3B, 0x06, 0x03, 0x31, 0x00, 0x05, 0xAB, 0x13, 0x05,
+  0x01, 0x00, 0x50, 0x08, 0x1C, 0x34, 0x32, 0x32, 0x69, 0x25, 0x31, 0x1A, 0x19, 0x32, 0xC8, 0x00,
+  0x38, 0x07, 0x0F, 0x14, 0x40, 0x1B, 0x08, 0x01, 0x00, 0x21, 0x28, 0x2D, 0x59, 0x02, 0x3B, 0x07,
+  0x0F, 0x0F, 0xC8, 0x00, 0x46, 0x19, 0x95, 0x95, 0x95, 0x20, 0x08, 0x02, 0x4E, 0x01, 0x03, 0xBA,
+  0x00, 0x0F, 0xDA, 0x07, 0x01, 0x22, 0x99, 0x9D, 0xD4, 0x14, 0x04, 0x06, 0x07, 0x08, 0xC0, 0x00,
+  0x04, 0xDB, 0x06, 0x05, 0x1F, 0x00, 0x04, 0xB7, 0x04, 0x27, 0x99, 0x9B, 0xFB, 0x0B, 0x0A, 0x05,
+  0x01, 0x01, 0x38, 0x00, 0xA4, 0x08, 0x08, 0x32, 0x30, 0x32, 0x08, 0x08, 0x1D, 0x1A, 0x08, 0xC8,
+  0x00, 0x0F, 0xC7, 0x00, 0x05, 0x30, 0x1D, 0x28, 0x28, 0xC7, 0x00, 0x20, 0x18, 0x0F, 0x91, 0x0C,
+  0x0A, 0xC8, 0x00, 0x02, 0xC9, 0x00, 0x06, 0x5A, 0x00, 0x04, 0x15, 0x02, 0x0F, 0xDA, 0x07, 0x03,
+  0x16, 0x97, 0x91, 0x01, 0x09, 0xC8, 0x00, 0x02, 0x5A, 0x01, 0x02, 0x85, 0x01, 0x0D, 0x10, 0x16,
+  0x08, 0xC2, 0x0C, 0x00, 0x21, 0x00, 0x02, 0x50, 0x00, 0x04, 0xA6, 0x11, 0x60, 0x99, 0x99, 0x98,
+  0x08, 0x32, 0x30, 0xC9, 0x00, 0x04, 0xC8, 0x00, 0x1F, 0x19, 0x55, 0x10, 0x00, 0x03, 0x01, 0x00,
+  0x26, 0x25, 0x25, 0x91, 0x33, 0x0B, 0xC8, 0x00, 0x06, 0xC9, 0x00, 0x04, 0x2E, 0x08, 0x02, 0x48,
+  0x0B, 0x0F, 0xDA, 0x07, 0x02, 0x07, 0xC8, 0x00, 0x0D, 0xCE, 0x00, 0x04, 0x04, 0x01, 0x0E, 0xF2,
+  0x14, 0x13, 0x9F, 0x33, 0x00, 0x08, 0xC5, 0x00, 0x04, 0x91, 0x02, 0x00, 0x0E, 0x00, 0xA1, 0x25,
+  0x32, 0x30, 0x30, 0x30, 0x34, 0x08, 0x1D, 0x07, 0x19, 0xC8, 0x00, 0x18, 0x1C, 0xFE, 0x0D, 0x00,
+  0xF0, 0x25, 0x15, 0x07, 0x11, 0x00, 0x80, 0x2A, 0x22, 0x07, 0x19, 0x1A, 0x1A, 0x15, 0x11, 0x29,
+  0x1F, 0x0C, 0xC8, 0x00, 0x31, 0x19, 0x96, 0x96, 0xDB, 0x06, 0x09, 0x01, 0x00, 0x0F, 0xDA, 0x07,
+  0x04, 0x32, 0x97, 0x9B, 0x99, 0x0F, 0x14, 0x06, 0x78, 0x05, 0x0F, 0x31, 0x02, 0x01, 0x0D, 0x74,
+  0x05, 0x09, 0x60, 0x00, 0x04, 0x53, 0x11, 0x02, 0x5C, 0x00, 0x31, 0x98, 0x98, 0x1D, 0xC8, 0x00,
+  0x20, 0x32, 0x00, 0xC9, 0x00, 0x10, 0x19, 0xB0, 0x04, 0x16, 0x1C, 0x56, 0x10, 0x01, 0x22, 0x15,
+  0x24, 0x08, 0x08, 0xAC, 0x0B, 0x71, 0x2A, 0x37, 0x07, 0x18, 0x19, 0x1A, 0x07, 0x62, 0x09, 0x0D,
+  0xC8, 0x00, 0x21, 0x19, 0x96, 0x7F, 0x05, 0x04, 0x63, 0x00, 0x02, 0x2A, 0x01, 0x02, 0x0A, 0x00,
+  0x02, 0x9D, 0x01, 0x02, 0x73, 0x00, 0x03, 0xF0, 0x03, 0x12, 0x9B, 0x91, 0x01, 0x07, 0xC7, 0x00,
+  0x06, 0x0B, 0x00, 0x06, 0xDF, 0x06, 0x06, 0xB5, 0x05, 0x15, 0x9A, 0x8F, 0x01, 0x00, 0x6B, 0x05,
+  0x04, 0x93, 0x01, 0x02, 0xAD, 0x01, 0x01, 0xBB, 0x08, 0x43, 0x1D, 0x1D, 0x25, 0x30, 0xC8, 0x00,
+  0x21, 0x1D, 0x07, 0x48, 0x26, 0x17, 0x1E, 0x00, 0x2E, 0x20, 0x08, 0x00, 0x40, 0x06, 0x06, 0xC9,
+  0x00, 0x51, 0x35, 0x07, 0x18, 0x1A, 0x18, 0xA0, 0x01, 0x0E, 0xC8, 0x00, 0x01, 0xCA, 0x00, 0x0D,
+  0x57, 0x01, 0x07, 0x8D, 0x03, 0x02, 0x8C, 0x01, 0x01, 0xBD, 0x07, 0x00, 0x91, 0x01, 0x0A, 0x1C,
+  0x06, 0x01, 0x0F, 0x00, 0x06, 0xD2, 0x01, 0x03, 0x08, 0x00, 0x04, 0x05, 0x0E, 0x01, 0xE5, 0x03,
+  0x04, 0x5D, 0x00, 0x00, 0x99, 0x06, 0x04, 0x29, 0x01, 0x03, 0xD0, 0x04, 0x55, 0x1D, 0x1D, 0x1D,
+  0x27, 0x34, 0xC8, 0x00, 0x70, 0x1D, 0x19, 0x07, 0x19, 0x08, 0x24, 0x04, 0x75, 0x35, 0x05, 0xC9,
+  0x00, 0x10, 0x08, 0x08, 0x07, 0x14, 0x0C, 0xEB, 0x1C, 0x60, 0x2A, 0x0C, 0x33, 0x07, 0x18, 0x18,
+  0x83, 0x25, 0x0F, 0xC8, 0x00, 0x01, 0x05, 0x93, 0x01, 0x03, 0xAC, 0x07, 0x04, 0x21, 0x02, 0x05,
+  0x1D, 0x05, 0x02, 0xF7, 0x10, 0x03, 0x91, 0x01, 0x04, 0x83, 0x01, 0x02, 0xFD, 0x06, 0x07, 0xD7,
+  0x00, 0x05, 0xA9, 0x01, 0x07, 0x11, 0x01, 0x00, 0x88, 0x02, 0x04, 0x18, 0x00, 0x0B, 0x2C, 0x01,
+  0x02, 0xC7, 0x00, 0x20, 0x2A, 0x27, 0x57, 0x02, 0x00, 0x20, 0x03, 0x01, 0x66, 0x01, 0x11, 0x16,
+  0x4B, 0x25, 0x08, 0x22, 0x03, 0x55, 0x18, 0x14, 0x07, 0x07, 0x04, 0xDD, 0x0E, 0x41, 0x2A, 0x28,
+  0x32, 0x30, 0x5F, 0x14, 0x0F, 0xC8, 0x00, 0x02, 0x10, 0x19, 0xBD, 0x39, 0x0F, 0x13, 0x07, 0x1D,
+  0x0F, 0x01, 0x00, 0x14, 0x05, 0x19, 0x04, 0x0D, 0xAB, 0x05, 0x00, 0xC7, 0x00, 0x23, 0x2C, 0x2C,
+  0x8F, 0x01, 0x00, 0xBF, 0x40, 0x0F, 0x01, 0x00, 0x03, 0x01, 0xC8, 0x00, 0x00, 0x95, 0x33, 0x02,
+  0x01, 0x00, 0x21, 0x00, 0x15, 0x98, 0x05, 0x0F, 0xC8, 0x00, 0x03, 0x12, 0x19, 0x48, 0x06, 0x03,
+  0x57, 0x16, 0x00, 0x7F, 0x03, 0x23, 0x97, 0x97, 0x6E, 0x05, 0x50, 0x99, 0x99, 0x9A, 0x97, 0x97,
+  0x91, 0x00, 0x01, 0x1F, 0x00, 0x05, 0xA7, 0x0E, 0x04, 0x0B, 0x00, 0x03, 0x14, 0x00, 0x00, 0x21,
+  0x00, 0x03, 0x71, 0x01, 0x21, 0x9A, 0x9A, 0x77, 0x06, 0x00, 0x46, 0x18, 0x14, 0x98, 0x8F, 0x01,
+  0x05, 0x01, 0x00, 0x05, 0x96, 0x01, 0x02, 0xC7, 0x00, 0x40, 0x1D, 0x18, 0x12, 0x0F, 0xC7, 0x00,
+  0x32, 0x34, 0x00, 0x1E, 0x93, 0x21, 0x40, 0x12, 0x0F, 0x12, 0x07, 0xC9, 0x07, 0x20, 0x08, 0x1C,
+  0xE0, 0x0E, 0x01, 0x5A, 0x36, 0x00, 0xC8, 0x00, 0x40, 0x04, 0x04, 0x04, 0x1B, 0xFB, 0x2C, 0x00,
+  0xDE, 0x07, 0x02, 0x99, 0x01, 0x0F, 0xC8, 0x00, 0x04, 0x39, 0x19, 0x95, 0x95, 0xF9, 0x01, 0x03,
+  0x43, 0x0F, 0x02, 0x5D, 0x0C, 0x10, 0x9A, 0x70, 0x1A, 0x03, 0x09, 0x03, 0x01, 0x01, 0x00, 0x00,
+  0xBA, 0x00, 0x14, 0x9D, 0x2E, 0x06, 0x03, 0xC8, 0x19, 0x00, 0x71, 0x17, 0x04, 0xA3, 0x00, 0x01,
+  0x06, 0x03, 0x00, 0x03, 0x01, 0x05, 0xDF, 0x00, 0x05, 0x7B, 0x02, 0x05, 0x40, 0x11, 0x01, 0xC7,
+  0x00, 0x40, 0x1D, 0x1D, 0x33, 0x13, 0xC9, 0x00, 0x52, 0x30, 0x30, 0x31, 0x32, 0x32, 0x40, 0x06,
+  0x03, 0xB8, 0x0B, 0x50, 0x9D, 0x00, 0x00, 0x17, 0x12, 0x28, 0x0A, 0x15, 0x07, 0x28, 0x0A, 0x02,
+  0xF0, 0x0A, 0x0F, 0xC8, 0x00, 0x0C, 0x01, 0x80, 0x05, 0x05, 0xC9, 0x02, 0x04, 0x03, 0x02, 0x05,
+  0xA6, 0x07, 0x00, 0x21, 0x09, 0x04, 0x91, 0x00, 0x03, 0x56, 0x01, 0x07, 0xDF, 0x03, 0x01, 0xB1,
+  0x00, 0x01, 0x1E, 0x00, 0x07, 0x72, 0x01, 0x01, 0x96, 0x0C, 0x0F, 0x01, 0x00, 0x04, 0x25, 0x9D,
+  0x9D, 0x01, 0x03, 0x20, 0x33, 0x33, 0xC9, 0x00, 0x10, 0x31, 0x03, 0x35, 0x08, 0xC8, 0x00, 0x0F,
+  0xD8, 0x0E, 0x00, 0x03, 0x98, 0x3A, 0x0B, 0x48, 0x0D, 0x0F, 0xC9, 0x00, 0x00, 0x0C, 0xFC, 0x08,
+  0x0B, 0x01, 0x00, 0x05, 0xEC, 0x07, 0x12, 0x99, 0xE5, 0x1B, 0x0F, 0x01, 0x00, 0x02, 0x00, 0xBB,
+  0x08, 0x03, 0x3A, 0x10, 0x02, 0x16, 0x0F, 0x02, 0x0B, 0x08, 0x03, 0x4F, 0x07, 0x00, 0xF1, 0x00,
+  0x01, 0xFE, 0x04, 0x03, 0x8E, 0x01, 0x00, 0x01, 0x00, 0x2F, 0x34, 0x15, 0x90, 0x01, 0x01, 0x0F,
+  0xD8, 0x0E, 0x00, 0x03, 0x90, 0x01, 0x02, 0xB7, 0x08, 0x0F, 0xC8, 0x00, 0x07, 0x02, 0x25, 0x03,
+  0x01, 0x9A, 0x04, 0x02, 0xA5, 0x04, 0x06, 0x24, 0x0A, 0x05, 0x3A, 0x14, 0x01, 0xC9, 0x18, 0x11,
+  0x97, 0xC8, 0x00, 0x01, 0x57, 0x10, 0x03, 0x1C, 0x00, 0x07, 0x23, 0x11, 0x00, 0x8A, 0x0C, 0x03,
+  0x5A, 0x02, 0x01, 0xAA, 0x05, 0x04, 0x2C, 0x14, 0x02, 0x4B, 0x00, 0x01, 0x67, 0x1F, 0x47, 0x97,
+  0x97, 0x98, 0x9C, 0x92, 0x04, 0x3F, 0x1D, 0x35, 0x14, 0x90, 0x01, 0x02, 0x0D, 0xD8, 0x0E, 0x02,
+  0x90, 0x01, 0x12, 0x17, 0x59, 0x02, 0x0F, 0xC8, 0x00, 0x0E, 0x01, 0xB8, 0x07, 0x01, 0x07, 0x00,
+  0x05, 0xA0, 0x0A, 0x02, 0x85, 0x01, 0x03, 0xC8, 0x00, 0x01, 0xB2, 0x00, 0x03, 0x4F, 0x18, 0x02,
+  0xCB, 0x06, 0x06, 0xA9, 0x0B, 0x42, 0x97, 0x97, 0x98, 0x9B, 0xDA, 0x03, 0x06, 0x38, 0x0A, 0x00,
+  0x14, 0x00, 0x02, 0x54, 0x03, 0x10, 0x99, 0x8E, 0x01, 0x01, 0xD6, 0x0F, 0x09, 0xC7, 0x00, 0x30,
+  0x1D, 0x1D, 0x18, 0xC9, 0x00, 0x0A, 0x90, 0x01, 0x3F, 0x2F, 0x00, 0x1E, 0x90, 0x01, 0x04, 0x12,
+  0x18, 0x59, 0x02, 0x0F, 0xC8, 0x00, 0x09, 0x04, 0x49, 0x06, 0x00, 0xE3, 0x02, 0x06, 0x89, 0x00,
+  0x01, 0xF9, 0x0A, 0x00, 0x75, 0x01, 0x07, 0x47, 0x0A, 0x00, 0x52, 0x0C, 0x04, 0x0B, 0x0E, 0x03,
+  0x7E, 0x01, 0x03, 0x7C, 0x0C, 0x14, 0x9B, 0x18, 0x00, 0x04, 0xE8, 0x00, 0x04, 0xF7, 0x0B, 0x01,
+  0x55, 0x02, 0x01, 0x7D, 0x1B, 0x07, 0x54, 0x02, 0x02, 0x01, 0x00, 0x2D, 0x22, 0x18, 0x90, 0x01,
+  0x4F, 0x00, 0x00, 0x1B, 0x13, 0x90, 0x01, 0x03, 0x2F, 0x1A, 0x17, 0x78, 0x05, 0x09, 0x08, 0xC9,
+  0x00, 0x03, 0xCD, 0x06, 0x01, 0xB1, 0x03, 0x04, 0x0D, 0x07, 0x04, 0xD7, 0x15, 0x03, 0xEE, 0x1F,
+  0x03, 0x95, 0x20, 0x08, 0xA0, 0x04, 0x01, 0x87, 0x13, 0x04, 0xA9, 0x0F, 0x04, 0x5C, 0x1B, 0x03,
+  0x34, 0x06, 0x03, 0x0D, 0x17, 0x02, 0x8D, 0x01, 0x0D, 0xC7, 0x00, 0x3C, 0x1D, 0x04, 0x08, 0x90,
+  0x01, 0x10, 0x00, 0x8F, 0x33, 0x0F, 0x90, 0x01, 0x03, 0x30, 0x1A, 0x18, 0x07, 0x35, 0x2A, 0x0F,
+  0xC8, 0x00, 0x0C, 0x04, 0xC9, 0x00, 0x06, 0x2C, 0x05, 0x02, 0xBD, 0x04, 0x02, 0xBC, 0x0F, 0x01,
+  0x9D, 0x00, 0x00, 0xB5, 0x00, 0x07, 0xC8, 0x00, 0x02, 0x77, 0x01, 0x03, 0xA3, 0x05, 0x02, 0x8F,
+  0x01, 0x02, 0xCF, 0x01, 0x08, 0x49, 0x15, 0x00, 0x9A, 0x1F, 0x21, 0x99, 0x1F, 0x74, 0x03, 0x0E,
+  0xC7, 0x00, 0x32, 0x1D, 0x28, 0x04, 0x07, 0x37, 0x01, 0x02, 0x0E, 0x00, 0xB2, 0x31, 0x02, 0xC4,
+  0x0E, 0x00, 0xE5, 0x15, 0x41, 0x08, 0x08, 0x1A, 0x14, 0x23, 0x07, 0x00, 0x80, 0x35, 0x20, 0x07,
+  0x0F, 0xF0, 0x0A, 0x20, 0x1A, 0x17, 0xC9, 0x00, 0x0F, 0xC8, 0x00, 0x0D, 0x36, 0x19, 0x96, 0x96,
+  0x6B, 0x08, 0x02, 0xA4, 0x08, 0x05, 0x09, 0x00, 0x04, 0x5B, 0x18, 0x11, 0x9B, 0x21, 0x03, 0x06,
+  0x21, 0x00, 0x04, 0xAC, 0x00, 0x01, 0x39, 0x11, 0x07, 0x7C, 0x09, 0x04, 0x1E, 0x00, 0x02, 0x7C,
+  0x02, 0x0F, 0x8E, 0x01, 0x05, 0x01, 0x99, 0x44, 0x91, 0x17, 0x07, 0x13, 0x13, 0x12, 0x11, 0x11,
+  0x10, 0x10, 0xB1, 0x4B, 0x07, 0x01, 0x00, 0x20, 0x07, 0x1C, 0xC8, 0x00, 0x82, 0x0C, 0x07, 0x14,
+  0x13, 0x12, 0x11, 0x0F, 0x04, 0x31, 0x43, 0x00, 0xCA, 0x0B, 0x0F, 0xC8, 0x00, 0x0E, 0x00, 0x49,
+  0x06, 0x02, 0x37, 0x09, 0x20, 0x1F, 0x1F, 0x03, 0x00, 0x01, 0x0C, 0x00, 0x03, 0x57, 0x06, 0x03,
+  0xB5, 0x00, 0x01, 0x91, 0x01, 0x01, 0x7C, 0x22, 0x05, 0xE9, 0x00, 0x02, 0x54, 0x03, 0x00, 0xD3,
+  0x60, 0x00, 0x48, 0x06, 0x0F, 0xC1, 0x0E, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x1C, 0x16, 0x0F, 0xC7,
+  0x00, 0x01, 0x0F, 0x01, 0x00, 0x0B, 0x01, 0xC8, 0x00, 0x01, 0x0A, 0x00, 0x21, 0x04, 0x24, 0xC7,
+  0x00, 0x2D, 0x19, 0x12, 0xD8, 0x0E, 0x0F, 0x01, 0x00, 0x02, 0x2F, 0x1C, 0x1C, 0x6C, 0x09, 0x28,
+  0x00, 0xD3, 0x16, 0x00, 0x13, 0x13, 0x00, 0xAA, 0x17, 0x01, 0xBC, 0x01, 0x02, 0xD4, 0x00, 0x30,
+  0x9D, 0x1F, 0x1F, 0xA8, 0x05, 0x0F, 0xC7, 0x00, 0x20, 0x17, 0x1E, 0xC8, 0x00, 0x11, 0x36, 0xE9,
+  0x03, 0x1F, 0x12, 0xD8, 0x0E, 0x00, 0x0F, 0x01, 0x00, 0x02, 0x20, 0x95, 0x95, 0xAC, 0x06, 0x02,
+  0x6C, 0x09, 0x00, 0x49, 0x09, 0x00, 0x81, 0x00, 0x42, 0x99, 0x99, 0x98, 0x9F, 0xB4, 0x07, 0x03,
+  0xD7, 0x03, 0x02, 0x07, 0x00, 0x00, 0x3D, 0x07, 0x03, 0x06, 0x19, 0x02, 0x8F, 0x18, 0x02, 0xD7,
+  0x07, 0x06, 0xF4, 0x07, 0x02, 0xB6, 0x01, 0x02, 0xEF, 0x07, 0x2F, 0x97, 0x99, 0xC7, 0x00, 0x1F,
+  0x62, 0x1D, 0x1D, 0x18, 0x07, 0x07, 0x18, 0xC8, 0x00, 0x20, 0x2A, 0x0C, 0xC7, 0x00, 0x1F, 0x16,
+  0xD8, 0x0E, 0x02, 0x0F, 0x01, 0x00, 0x02, 0x02, 0xA4, 0x08, 0x02, 0xC8, 0x1F, 0x05, 0xCA, 0x07,
+  0x11, 0x97, 0xC8, 0x00, 0x04, 0x63, 0x02, 0x04, 0x01, 0x00, 0x02, 0x40, 0x02, 0x02, 0x1D, 0x0D,
+  0x01, 0x7E, 0x16, 0x00, 0xB3, 0x25, 0x01, 0xD8, 0x19, 0x00, 0xB9, 0x00, 0x02, 0x04, 0x00, 0x00,
+  0x6B, 0x09, 0x01, 0x1C, 0x0F, 0x0F, 0xB2, 0x00, 0x0C, 0x04, 0x59, 0x4B, 0x71, 0x16, 0x07, 0x13,
+  0x11, 0x11, 0x13, 0x07, 0x18, 0x3B, 0x62, 0x04, 0x04, 0x00, 0x18, 0x07, 0x07, 0x6A, 0x3B, 0x20,
+  0x2A, 0x0C, 0xC9, 0x00, 0x00, 0x56, 0x02, 0x0F, 0xC8, 0x00, 0x14, 0x02, 0x25, 0x03, 0x01, 0xA7,
+  0x00, 0x01, 0xB7, 0x15, 0x02, 0x87, 0x01, 0x12, 0x97, 0x90, 0x01, 0x00, 0x87, 0x04, 0x12, 0x1F,
+  0x40, 0x11, 0x20, 0x99, 0x98, 0xB0, 0x01, 0x04, 0xD6, 0x07, 0x00, 0xB5, 0x01, 0x01, 0x2E, 0x06,
+  0x01, 0x5A, 0x09, 0x01, 0xBB, 0x05, 0x02, 0x58, 0x02, 0x03, 0xCC, 0x04, 0x0F, 0x79, 0x01, 0x0D,
+  0x01, 0x67, 0x44, 0x01, 0xE5, 0x0A, 0x00, 0x67, 0x50, 0x30, 0x17, 0x18, 0x08, 0x6E, 0x37, 0x30,
+  0x0C, 0x0C, 0x04, 0x7C, 0x47, 0x11, 0x07, 0xBD, 0x00, 0x21, 0x28, 0x0C, 0x57, 0x02, 0x0F, 0xC8,
+  0x00, 0x18, 0x12, 0x19, 0xD2, 0x2F, 0x0F, 0x01, 0x00, 0x06, 0x06, 0x91, 0x01, 0x05, 0xB8, 0x01,
+  0x02, 0xE4, 0x00, 0x01, 0x83, 0x08, 0x0F, 0x21, 0x0A, 0x01, 0x0F, 0xC6, 0x00, 0x0D, 0x00, 0xE1,
+  0x3B, 0x0F, 0xC8, 0x19, 0x01, 0x40, 0x16, 0x0C, 0x04, 0x08, 0xB8, 0x04, 0x01, 0x24, 0x00, 0x20,
+  0x34, 0x33, 0x19, 0x15, 0x0F, 0xC8, 0x00, 0x19, 0x00, 0x92, 0x01, 0x05, 0x40, 0x1B, 0x10, 0x98,
+  0xCD, 0x18, 0x02, 0x3E, 0x14, 0x01, 0x05, 0x00, 0x00, 0xC8, 0x00, 0x01, 0xA7, 0x01, 0x21, 0x9A,
+  0x9A, 0xD1, 0x18, 0x01, 0x89, 0x0F, 0x10, 0x9A, 0x4D, 0x03, 0x02, 0xA6, 0x01, 0x21, 0x1F, 0x1F,
+  0xE5, 0x18, 0x02, 0x8A, 0x01, 0x00, 0x04, 0x28, 0x0F, 0x8E, 0x01, 0x10, 0x3A, 0x1D, 0x1C, 0x1E,
+  0x60, 0x09, 0x12, 0x18, 0xF0, 0x0A, 0x15, 0x16, 0xD5, 0x0E, 0x71, 0x1D, 0x1D, 0x1D, 0x29, 0x33,
+  0x37, 0x22, 0x77, 0x05, 0x0F, 0xC8, 0x00, 0x17, 0x01, 0x12, 0x07, 0x01, 0xDB, 0x06, 0x00, 0x65,
+  0x1A, 0x11, 0x96, 0x0F, 0x15, 0x01, 0xBA, 0x18, 0x32, 0x97, 0x97, 0x96, 0x98, 0x05, 0x04, 0x77,
+  0x05, 0x02, 0xEE, 0x07, 0x02, 0xE4, 0x0B, 0x00, 0xD8, 0x00, 0x30, 0x9A, 0x9B, 0x1F, 0xE6, 0x03,
+  0x03, 0xFA, 0x11, 0x00, 0x05, 0x04, 0x0F, 0xC7, 0x00, 0x11, 0x3F, 0x1D, 0x08, 0x00, 0x28, 0x0A,
+  0x03, 0x18, 0x19, 0x98, 0x13, 0x31, 0x29, 0x31, 0x30, 0x4F, 0x14, 0x0F, 0xC8, 0x00, 0x18, 0x10,
+  0x19, 0xFE, 0x15, 0x01, 0xD7, 0x03, 0x02, 0x6E, 0x09, 0x80, 0x98, 0x98, 0x9A, 0x98, 0x96, 0x96,
+  0x9A, 0x99, 0x94, 0x01, 0x00, 0x97, 0x05, 0x00, 0xCD, 0x00, 0x00, 0x02, 0x00, 0x04, 0xD4, 0x00,
+  0x05, 0x7C, 0x17, 0x03, 0x1D, 0x03, 0x01, 0x78, 0x11, 0x04, 0x4D, 0x22, 0x0F, 0xC7, 0x00, 0x0F,
+  0x2F, 0x1D, 0x18, 0xC8, 0x00, 0x04, 0x10, 0x16, 0x8A, 0x39, 0x06, 0x01, 0x00, 0x21, 0x17, 0x0F,
+  0x6F, 0x22, 0x0F, 0xC8, 0x00, 0x18, 0x02, 0x49, 0x06, 0x01, 0x9D, 0x00, 0x03, 0x6D, 0x08, 0x41,
+  0x9B, 0x99, 0x9B, 0x9D, 0xB3, 0x0E, 0x05, 0xB6, 0x07, 0x01, 0x07, 0x0E, 0x02, 0x5B, 0x1A, 0x02,
+  0xE9, 0x03, 0x20, 0x99, 0x9B, 0x06, 0x73, 0x00, 0x22, 0x18, 0x06, 0xCD, 0x07, 0x0F, 0xC7, 0x00,
+  0x12, 0x2B, 0x1D, 0x18, 0x58, 0x02, 0x05, 0xF0, 0x0A, 0x00, 0x4F, 0x44, 0x0D, 0x01, 0x00, 0x0F,
+  0xC8, 0x00, 0x19, 0x02, 0x92, 0x01, 0x0F, 0x01, 0x00, 0x00, 0x01, 0x7E, 0x08, 0x10, 0x99, 0x18,
+  0x23, 0x00, 0x17, 0x1C, 0x41, 0x99, 0x98, 0x99, 0x98, 0xDD, 0x18, 0x00, 0x93, 0x01, 0x10, 0x97,
+  0x04, 0x73, 0x12, 0x9D, 0x66, 0x09, 0x04, 0x5D, 0x02, 0x0F, 0xFE, 0x06, 0x13, 0x2F, 0x07, 0x1C,
+  0xB8, 0x0B, 0x04, 0x0B, 0x91, 0x01, 0x0F, 0xC8, 0x00, 0x20, 0x04, 0xDA, 0x12, 0x01, 0xA5, 0x0F,
+  0x12, 0x9A, 0xD5, 0x23, 0x32, 0x98, 0x99, 0x97, 0x56, 0x02, 0x02, 0x90, 0x01, 0x02, 0xBF, 0x00,
+  0x00, 0x49, 0x0A, 0x03, 0x10, 0x00, 0x13, 0x9E, 0x92, 0x10, 0x07, 0x32, 0x2D, 0x0F, 0xC7, 0x00,
+  0x12, 0x3A, 0x1A, 0x07, 0x08, 0xB8, 0x0B, 0x06, 0x80, 0x0C, 0x0F, 0x91, 0x01, 0x01, 0x0F, 0xC8,
+  0x00, 0x1B, 0x02, 0x91, 0x0C, 0x00, 0x08, 0x06, 0x00, 0x97, 0x00, 0x20, 0x1F, 0x99, 0xFC, 0x22,
+  0x12, 0x1F, 0xFC, 0x06, 0x0D, 0xD2, 0x0E, 0x06, 0x9B, 0x08, 0x01, 0x2E, 0x03, 0x01, 0x0C, 0x1C,
+  0x01, 0x22, 0x16, 0x0F, 0xC7, 0x00, 0x12, 0x23, 0x1D, 0x18, 0xA8, 0x16, 0x03, 0xB8, 0x0B, 0x17,
+  0x1B, 0xB8, 0x0B, 0x2E, 0x16, 0x1B, 0xC9, 0x00, 0x0F, 0xC8, 0x00, 0x1C, 0x20, 0x19, 0x19, 0x24,
+  0x03, 0x03, 0x26, 0x0A, 0x01, 0x7E, 0x01, 0x1F, 0x9A, 0x7A, 0x1A, 0x02, 0x12, 0x9B, 0x17, 0x00,
+  0x00, 0x1D, 0x03, 0x27, 0x9F, 0x9F, 0x9D, 0x13, 0x1F, 0x9A, 0x52, 0x09, 0x16, 0x21, 0x07, 0x08,
+  0x48, 0x0D, 0x55, 0x23, 0x08, 0x08, 0x04, 0x28, 0xCC, 0x20, 0x03, 0x80, 0x0C, 0x01, 0xE9, 0x19,
+  0x0F, 0xC8, 0x00, 0x2C, 0x20, 0x19, 0x96, 0x2D, 0x1C, 0x10, 0x99, 0x26, 0x0D, 0x01, 0x5E, 0x08,
+  0x00, 0xA3, 0x0F, 0x03, 0x36, 0x26, 0x30, 0x99, 0x99, 0x96, 0x69, 0x09, 0x00, 0x09, 0x07, 0x00,
+  0x17, 0x0A, 0x94, 0x98, 0x98, 0x97, 0x96, 0x99, 0x96, 0x99, 0x96, 0x9A, 0x6F, 0x06, 0x2F, 0x95,
+  0x98, 0x19, 0x0A, 0x18, 0x21, 0x18, 0x1C, 0x90, 0x01, 0x40, 0x07, 0x0F, 0x0F, 0x08, 0x90, 0x01,
+  0x54, 0x0F, 0x07, 0x07, 0x08, 0x00, 0x48, 0x0D, 0x1E, 0x18, 0xE0, 0x2E, 0x0F, 0xC8, 0x00, 0x1F,
+  0x12, 0x19, 0x7F, 0x05, 0x00, 0x06, 0x03, 0x81, 0x98, 0x99, 0x9D, 0x9A, 0x98, 0x96, 0x98, 0x96,
+  0x3F, 0x02, 0x03, 0x71, 0x01, 0x01, 0x01, 0x00, 0x02, 0x2B, 0x1F, 0x01, 0xA1, 0x21, 0x00, 0x76,
+  0x02, 0x10, 0x98, 0x34, 0x0D, 0x10, 0x99, 0xF1, 0x2A, 0x0F, 0xC7, 0x00, 0x16, 0x31, 0x1E, 0x18,
+  0x1D, 0x90, 0x01, 0x70, 0x0F, 0x0F, 0x18, 0x11, 0x19, 0x2A, 0x2A, 0xBF, 0x4F, 0x15, 0x00, 0x98,
+  0x21, 0x04, 0xC5, 0x20, 0x0F, 0xC8, 0x00, 0x2B, 0x03, 0x01, 0x00, 0xBF, 0x1B, 0xFD, 0xF2, 0xF2,
+  0xEF, 0xF2, 0x7C, 0x7C, 0x7E, 0x7E, 0x7F, 0x01, 0x00, 0x0C, 0x4F, 0xFA, 0xFB, 0xFB, 0xFD, 0xC1,
+  0x00, 0x16, 0x04, 0xC8, 0x00, 0x20, 0x08, 0x1E, 0x90, 0x01, 0x01, 0x48, 0x09, 0x31, 0x0F, 0x07,
+  0x2A, 0xF8, 0x2A, 0x05, 0xD8, 0x0E, 0x01, 0xFA, 0x06, 0x0F, 0xC8, 0x00, 0x37, 0x26, 0xF4, 0xF2,
+  0x01, 0x00, 0xC1, 0xF3, 0xF3, 0xF3, 0xF3, 0xF4, 0xF4, 0xF4, 0xF5, 0xF7, 0xF7, 0xF5, 0xF6, 0x01,
+  0x00, 0xFF, 0x00, 0xF7, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF8, 0xF9, 0xF9, 0xFC, 0xFC,
+  0xF9, 0xFC, 0xC8, 0x00, 0x1E, 0x20, 0x1C, 0x00, 0x90, 0x01, 0x11, 0x18, 0x7A, 0x01, 0x10, 0x0F,
+  0xAF, 0x52, 0x25, 0x1B, 0x13, 0x30, 0x2A, 0x0E, 0xC7, 0x00, 0x0F, 0xC8, 0x00, 0x03, 0x02, 0x8F,
+  0x3E, 0x0F, 0xC8, 0x00, 0x0E, 0x28, 0xF7, 0xF8, 0xCA, 0x00, 0x02, 0xCB, 0x00, 0x43, 0xF7, 0xFA,
+  0xF7, 0xF5, 0xCA, 0x00, 0x13, 0xF6, 0xCA, 0x00, 0x4F, 0xF9, 0xFC, 0xFD, 0xFD, 0xC8, 0x00, 0x21,
+  0x00, 0x90, 0x01, 0x12, 0x1C, 0xD2, 0x03, 0x00, 0xC9, 0x00, 0x13, 0x18, 0xB0, 0x04, 0x0F, 0xC7,
+  0x00, 0x02, 0x0F, 0xC8, 0x00, 0x02, 0x04, 0x58, 0x3F, 0x0F, 0xC8, 0x00, 0x0D, 0x40, 0xF6, 0x7D,
+  0xF0, 0xF4, 0xBD, 0x00, 0x33, 0xF3, 0xF3, 0xF3, 0xCB, 0x00, 0x51, 0x79, 0xF2, 0xF3, 0xF4, 0xEF,
+  0x98, 0x01, 0x02, 0xCD, 0x00, 0x11, 0xF7, 0x97, 0x01, 0x4F, 0xFA, 0xFD, 0xF4, 0xFB, 0xC8, 0x00,
+  0x1E, 0x11, 0x1D, 0xB0, 0x04, 0x13, 0x00, 0x9A, 0x04, 0x25, 0x0F, 0x19, 0xD0, 0x07, 0x0F, 0xC7,
+  0x00, 0x02, 0x0F, 0xC8, 0x00, 0x01, 0x04, 0xE4, 0x40, 0x0F, 0xC8, 0x00, 0x0E, 0x15, 0xF4, 0x01,
+  0x00, 0x07, 0xCE, 0x00, 0x02, 0x0A, 0x00, 0x05, 0xCA, 0x00, 0x02, 0x61, 0x02, 0x1F, 0xF9, 0xC8,
+  0x00, 0x20, 0x20, 0x18, 0x08, 0xB8, 0x24, 0x04, 0x43, 0x34, 0x23, 0x11, 0x08, 0x40, 0x06, 0x0F,
+  0xC7, 0x00, 0x03, 0x0F, 0xC8, 0x00, 0x00, 0x01, 0x18, 0x60, 0x0F, 0xC9, 0x00, 0x10, 0x3F, 0x1B,
+  0xFB, 0xF8, 0x01, 0x00, 0x0F, 0x8F, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0xFB, 0xC8, 0x00,
+  0x1E, 0x30, 0x1D, 0x1E, 0x1B, 0xE0, 0x11, 0x21, 0x36, 0x22, 0x2C, 0x68, 0x02, 0xC9, 0x00, 0x00,
+  0xC8, 0x00, 0x0F, 0xC7, 0x00, 0x04, 0x0F, 0xC8, 0x00, 0x05, 0x1F, 0xEB, 0x91, 0x01, 0x10, 0x02,
+  0x91, 0x0C, 0x00, 0x5E, 0x05, 0x01, 0x88, 0x0C, 0x21, 0x98, 0x00, 0x2A, 0x1B, 0x00, 0x3E, 0x0A,
+  0x30, 0x9A, 0x9A, 0x97, 0x16, 0x0E, 0x10, 0x9F, 0x0B, 0x00, 0x11, 0x9B, 0xE1, 0x0A, 0x0F, 0xC2,
+  0x00, 0x19, 0x05, 0x01, 0x00, 0x00, 0x8A, 0x0F, 0x14, 0x18, 0xE1, 0x18, 0x91, 0x1D, 0x07, 0x08,
+  0x11, 0x12, 0x12, 0x0F, 0x07, 0x04, 0x1F, 0x43, 0x0D, 0x01, 0x00, 0x0F, 0xC8, 0x00, 0x01, 0x3F,
+  0xEB, 0x1B, 0x1B, 0x91, 0x01, 0x11, 0x32, 0x19, 0x1C, 0x1E, 0x3B, 0x10, 0x11, 0x99, 0x02, 0x0A,
+  0x71, 0x97, 0x00, 0x9A, 0x99, 0x9B, 0x9D, 0x00, 0xE9, 0x0E, 0x01, 0xED, 0x18, 0x01, 0xED, 0x38,
+  0x01, 0xBB, 0x27, 0x0F, 0xC7, 0x00, 0x23, 0x1A, 0x1D, 0x79, 0x45, 0x10, 0x1D, 0x7F, 0x13, 0x3F,
+  0x04, 0x04, 0x08, 0xC9, 0x00, 0x03, 0x0F, 0xC7, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x1F, 0x1B, 0x91,
+  0x01, 0x11, 0x02, 0x7D, 0x26, 0x30, 0x97, 0x9A, 0x98, 0xBE, 0x23, 0x22, 0x9B, 0x9D, 0x92, 0x68,
+  0x03, 0xDD, 0x12, 0x10, 0x9F, 0x05, 0x3F, 0x01, 0xD8, 0x0E, 0x05, 0xA3, 0x19, 0x0F, 0x01, 0x00,
+  0x1D, 0x10, 0x08, 0x64, 0x1E, 0x01, 0x47, 0x45, 0x60, 0x07, 0x12, 0x0F, 0x0F, 0x12, 0x07, 0xC6,
+  0x32, 0x55, 0x04, 0x08, 0x14, 0x14, 0x04, 0x45, 0x5F, 0x07, 0x01, 0x00, 0x0F, 0xC8, 0x00, 0x00,
+  0x4F, 0xEB, 0xEB, 0xEA, 0xEA, 0x91, 0x01, 0x13, 0x21, 0x19, 0x96, 0x86, 0x1A, 0x20, 0x9A, 0x97,
+  0xD5, 0x07, 0x01, 0x7E, 0x01, 0x00, 0x9C, 0x01, 0x00, 0x37, 0x15, 0x00, 0xC6, 0x07, 0x03, 0x8D,
+  0x21, 0x1F, 0x95, 0xC7, 0x00, 0x24, 0x50, 0x1D, 0x1C, 0x00, 0x0C, 0x00, 0x5A, 0x14, 0x00, 0x07,
+  0x65, 0x02, 0xC0, 0x46, 0x30, 0x08, 0x08, 0x08, 0x40, 0x06, 0x06, 0xE7, 0x1C, 0x06, 0x01, 0x00,
+  0x0F, 0xC8, 0x00, 0x01, 0x00, 0x68, 0x62, 0x0F, 0x91, 0x01, 0x13, 0x00, 0x92, 0x01, 0x02, 0x7F,
+  0x21, 0x00, 0x11, 0x18, 0x03, 0x13, 0x20, 0x02, 0xBE, 0x1A, 0x22, 0x99, 0x9F, 0x80, 0x29, 0x1F,
+  0x9B, 0xA5, 0x12, 0x22, 0x01, 0x01, 0x00, 0x10, 0x1B, 0x28, 0x0A, 0x07, 0x58, 0x1B, 0x05, 0x98,
+  0x08, 0x0F, 0x8D, 0x2C, 0x00, 0x0F, 0xC8, 0x00, 0x04, 0x00, 0x91, 0x01, 0x0F, 0xC8, 0x00, 0x11,
+  0x20, 0x19, 0x96, 0x83, 0x01, 0x00, 0xA9, 0x15, 0x01, 0x61, 0x21, 0x00, 0xA3, 0x0B, 0x41, 0x99,
+  0x97, 0x98, 0x99, 0xC5, 0x75, 0x10, 0x9A, 0x77, 0x36, 0x1F, 0x9D, 0x53, 0x09, 0x17, 0x0C, 0x01,
+  0x00, 0x01, 0xD8, 0x0E, 0x04, 0xC8, 0x00, 0x05, 0x68, 0x10, 0x01, 0xC8, 0x00, 0x0E, 0xAA, 0x2F,
+  0x0F, 0xC8, 0x00, 0x03, 0x00, 0x52, 0x5F, 0x0F, 0xC8, 0x00, 0x13, 0x10, 0x19, 0xE3, 0x0A, 0x00,
+  0xDC, 0x0A, 0x02, 0xCE, 0x6E, 0x03, 0x5F, 0x14, 0x44, 0x9F, 0x99, 0x99, 0x9C, 0x15, 0x2D, 0x0F,
+  0x01, 0x00, 0x25, 0x1B, 0x1E, 0xC8, 0x00, 0x07, 0xC8, 0x19, 0x06, 0x27, 0x43, 0x05, 0x01, 0x00,
+  0x0F, 0xC8, 0x00, 0x05, 0x1F, 0xEA, 0xC8, 0x00, 0x1D, 0x03, 0xA8, 0x16, 0x02, 0xC8, 0x00, 0x4F,
+  0x9C, 0x99, 0x99, 0x9F, 0xC8, 0x00, 0x2C, 0x3F, 0x9D, 0x1D, 0x1B, 0xC8, 0x00, 0x05, 0x14, 0x12,
+  0x45, 0x46, 0x07, 0x01, 0x00, 0x0F, 0xC8, 0x00, 0x02, 0x01, 0x7A, 0x69, 0x0F, 0x59, 0x02, 0x14,
+  0x00, 0x5A, 0x02, 0x00, 0x25, 0x06, 0x40, 0x9A, 0x97, 0x9B, 0x97, 0x02, 0x23, 0x02, 0xA8, 0x29,
+  0x01, 0x88, 0x10, 0x00, 0xF5, 0x11, 0x0F, 0xC4, 0x00, 0x22, 0x02, 0x01, 0x00, 0x01, 0x80, 0x0C,
+  0x03, 0xC8, 0x00, 0x19, 0x2F, 0x58, 0x34, 0x0F, 0x28, 0x0A, 0x11, 0x01, 0xC8, 0x00, 0x3F, 0xEC,
+  0xEC, 0xEC, 0xC8, 0x00, 0x16, 0x00, 0x70, 0x5A, 0x71, 0xD7, 0xD7, 0x9E, 0xD7, 0xD7, 0x9B, 0x00,
+  0xAF, 0x27, 0x02, 0xAB, 0x42, 0x10, 0x1F, 0x9F, 0x76, 0x2F, 0x9F, 0x9F, 0xC0, 0x00, 0x21, 0x02,
+  0x01, 0x00, 0x12, 0x07, 0xD8, 0x0E, 0x03, 0xC8, 0x00, 0x18, 0x00, 0x20, 0x1C, 0x0F, 0xC9, 0x32,
+  0x01, 0x0F, 0xC8, 0x00, 0x04, 0x1F, 0x1D, 0xC8, 0x00, 0x0F, 0x60, 0xD3, 0xD4, 0xD4, 0xDB, 0xD8,
+  0xD8, 0xCA, 0x5C, 0x00, 0xC9, 0x00, 0x45, 0xD9, 0xD7, 0xD7, 0xDC, 0x86, 0x49, 0x01, 0x59, 0x6C,
+  0x00, 0x44, 0x06, 0x0F, 0xC1, 0x00, 0x21, 0x04, 0x01, 0x00, 0x02, 0x68, 0x10, 0x02, 0xC8, 0x00,
+  0x00, 0xB7, 0x0B, 0x07, 0x20, 0x35, 0x0F, 0x68, 0x10, 0x11, 0x03, 0xC8, 0x00, 0x1F, 0x1D, 0x21,
+  0x03, 0x0D, 0x61, 0xD3, 0xD2, 0xD2, 0xD2, 0xD4, 0xDB, 0x28, 0x5F, 0x00, 0x92, 0x01, 0x00, 0xCE,
+  0x00, 0x21, 0xD8, 0xDC, 0x00, 0x39, 0x9F, 0x1F, 0x1F, 0x9E, 0x9C, 0x00, 0x1F, 0x9F, 0x1F, 0x9E,
+  0xC4, 0x15, 0x0F, 0x0F, 0x01, 0x00, 0x0A, 0x90, 0x19, 0x08, 0x0C, 0x35, 0x0F, 0x11, 0x15, 0x17,
+  0x19, 0xBD, 0x60, 0x03, 0x68, 0x10, 0x42, 0x18, 0x00, 0x1A, 0x17, 0x99, 0x16, 0x0C, 0x2D, 0x00,
+  0x0F, 0xC8, 0x00, 0x01, 0x4F, 0xEA, 0xEC, 0xEE, 0x1D, 0x21, 0x03, 0x0D, 0xA0, 0xD3, 0xD2, 0xD1,
+  0xD1, 0xD1, 0xD4, 0xDB, 0xD7, 0xD4, 0xD4, 0x00, 0x5C, 0xD2, 0xD9, 0xDB, 0xD9, 0xDA, 0xD9, 0xD8,
+  0xD7, 0xD7, 0xD6, 0xD5, 0xF3, 0xF3, 0xF4, 0xB3, 0x0B, 0x0F, 0xBA, 0x00, 0x20, 0x0C, 0x9C, 0x00,
+  0x36, 0x08, 0x35, 0x11, 0x2F, 0x23, 0x11, 0x18, 0x48, 0x0D, 0x3F, 0x18, 0x08, 0x1C, 0x3F, 0x38,
+  0x01, 0x0F, 0xC8, 0x00, 0x05, 0x2F, 0xED, 0xEE, 0x59, 0x02, 0x0D, 0x20, 0xD5, 0xD3, 0x77, 0x5A,
+  0xFF, 0x05, 0xDB, 0xD3, 0xD8, 0xD6, 0xDA, 0xD9, 0xDA, 0xDC, 0xD9, 0xDD, 0xD9, 0xDC, 0xD9, 0xD9,
+  0xD9, 0xD8, 0xD8, 0xD7, 0xD6, 0xDC, 0xB2, 0x00, 0x20, 0x0F, 0x01, 0x00, 0x02, 0x62, 0x1E, 0x08,
+  0x1A, 0x08, 0x07, 0x08, 0x7D, 0x4A, 0x10, 0x1E, 0xCA, 0x4A, 0x10, 0x16, 0x58, 0x02, 0x1B, 0x18,
+  0x76, 0x09, 0x03, 0x01, 0x00, 0x0F, 0xC8, 0x00, 0x05, 0x2B, 0xED, 0x1D, 0xC8, 0x00, 0x57, 0xDC,
+  0xD7, 0xD2, 0xD2, 0xD2, 0x10, 0x00, 0xF1, 0x03, 0xD6, 0xD5, 0xD3, 0xD8, 0xD5, 0xCF, 0xDB, 0xD8,
+  0xD8, 0xDA, 0xDC, 0xDA, 0xDC, 0xDE, 0xDC, 0xDD, 0xDA, 0xDC, 0x5E, 0x02, 0x7F, 0xD8, 0xD3, 0xD7,
+  0xDC, 0x9A, 0x1F, 0x9E, 0x18, 0x18, 0x10, 0x0F, 0x01, 0x00, 0x0E, 0x02, 0x60, 0x09, 0x00, 0x4C,
+  0x4F, 0x01, 0x99, 0x1D, 0x00, 0x93, 0x01, 0x00, 0x20, 0x03, 0x48, 0x18, 0x1F, 0x08, 0x18, 0x92,
+  0x25, 0x02, 0x01, 0x00, 0x0F, 0xC8, 0x00, 0x00, 0x1F, 0x1A, 0xC8, 0x00, 0x00, 0xF0, 0x12, 0x1A,
+  0x00, 0xDE, 0xD6, 0xD2, 0xD2, 0xCF, 0xDB, 0xDA, 0xD7, 0xD7, 0x19, 0x19, 0x19, 0xDB, 0xDB, 0xDB,
+  0x19, 0xD8, 0xD6, 0xD8, 0xD3, 0xD3, 0xCF, 0x00, 0xDC, 0xDB, 0xDC, 0xDD, 0xDC, 0xDD, 0xDE, 0xDE,
+  0xEE, 0x6E, 0x00, 0x98, 0x6C, 0x8F, 0xDA, 0xD9, 0xD7, 0xD5, 0xDC, 0x99, 0x9A, 0x99, 0x71, 0x05,
+  0x29, 0x03, 0x01, 0x00, 0x39, 0x1C, 0x1B, 0x0C, 0x89, 0x33, 0x32, 0x1E, 0x1C, 0x1C, 0xB0, 0x04,
+  0x2F, 0x1F, 0x1D, 0xC0, 0x12, 0x11, 0x01, 0xC8, 0x00, 0x46, 0x1E, 0xED, 0x1D, 0xEA, 0xC8, 0x00,
+  0x20, 0x1A, 0x1C, 0xFD, 0x5E, 0xF0, 0x0D, 0xD6, 0xD1, 0xCF, 0xCF, 0xD9, 0xD1, 0xD7, 0xD7, 0xD7,
+  0xDB, 0xD9, 0xD9, 0xD7, 0xDB, 0xDB, 0xD8, 0xDA, 0xD3, 0xCF, 0xD6, 0x00, 0x00, 0xDD, 0xDD, 0xDD,
+  0xDF, 0x00, 0x00, 0x8F, 0x73, 0x30, 0xDE, 0xDF, 0xDC, 0xE8, 0x63, 0x30, 0xD9, 0xD7, 0xD5, 0x80,
+  0x0C, 0x0F, 0xBB, 0x00, 0x22, 0x0B, 0x9C, 0x00, 0x09, 0x08, 0x07, 0x07, 0x60, 0x09, 0x02, 0x93,
+  0x28, 0x0A, 0x2C, 0x00, 0x0F, 0xC8, 0x00, 0x02, 0x20, 0x1C, 0x1E, 0x91, 0x01, 0x03, 0xC8, 0x00,
+  0x10, 0x1A, 0x30, 0x04, 0xF4, 0x04, 0xDA, 0xD8, 0xD8, 0xDB, 0xD1, 0xCE, 0xCE, 0xD5, 0xD6, 0xD0,
+  0xD4, 0xD4, 0xD9, 0xD9, 0xD5, 0xD4, 0xD7, 0xDA, 0xDA, 0xD4, 0x6A, 0x02, 0xA3, 0x6B, 0x40, 0xDD,
+  0xDD, 0xDD, 0xD8, 0xC6, 0x00, 0x01, 0xC8, 0x00, 0x1F, 0x98, 0x01, 0x07, 0x2A, 0x03, 0x01, 0x00,
+  0x0F, 0x60, 0x09, 0x07, 0x1F, 0x18, 0xF8, 0x11, 0x11, 0x04, 0xC8, 0x00, 0x01, 0xCC, 0x01, 0x13,
+  0x1B, 0xC7, 0x00, 0xF0, 0x0A, 0xDC, 0xD9, 0xD8, 0xD6, 0xD4, 0xD4, 0xD0, 0xCE, 0xCE, 0xD4, 0xD0,
+  0xD1, 0xD1, 0xD4, 0xD9, 0xD9, 0xD2, 0xD2, 0xDC, 0xD6, 0xD5, 0xD8, 0xDA, 0xDC, 0xDF, 0xB3, 0x55,
+  0x00, 0xB5, 0x76, 0x10, 0xDB, 0x2A, 0x03, 0x01, 0x4D, 0x06, 0x00, 0x71, 0x65, 0x0F, 0xC6, 0x15,
+  0x16, 0x0F, 0x01, 0x00, 0x08, 0x1F, 0x1E, 0x98, 0x08, 0x06, 0x0F, 0xF1, 0x3C, 0x01, 0x0F, 0xC8,
+  0x00, 0x06, 0x0A, 0x25, 0x36, 0x50, 0xDA, 0xD9, 0xD8, 0xD6, 0xD6, 0xC8, 0x00, 0xB1, 0xD1, 0xD1,
+  0xD0, 0xD0, 0xD1, 0xD2, 0xD9, 0xCF, 0xD2, 0xD6, 0xD2, 0xC9, 0x00, 0x00, 0xC8, 0x00, 0x10, 0xDE,
+  0x04, 0x63, 0x63, 0xD8, 0xD8, 0xD9, 0xDA, 0xD8, 0xDA, 0x8B, 0x56, 0x2F, 0x9A, 0x9B, 0x03, 0x07,
+  0x2A, 0x00, 0x01, 0x00, 0x21, 0x1F, 0x1D, 0x88, 0x2C, 0x0F, 0x60, 0x09, 0x03, 0x0F, 0x58, 0x02,
+  0x13, 0x3F, 0xEB, 0xEA, 0xEA, 0xC8, 0x00, 0x06, 0x10, 0xD0, 0x01, 0x00, 0xB1, 0xD1, 0xD2, 0xCF,
+  0xCE, 0xD3, 0xD6, 0xD2, 0xD4, 0xD2, 0xD7, 0xDA, 0xC8, 0x00, 0x30, 0xDC, 0xDA, 0xDB, 0xD5, 0x00,
+  0x24, 0xD4, 0xD9, 0x51, 0x57, 0x2F, 0x9A, 0x9C, 0x58, 0x02, 0x30, 0x0A, 0x60, 0x09, 0x07, 0x98,
+  0x08, 0x13, 0x12, 0x34, 0x51, 0x08, 0x01, 0x00, 0x0E, 0xC8, 0x00, 0x10, 0x19, 0x79, 0x05, 0x1B,
+  0xED, 0x34, 0x50, 0x03, 0xC8, 0x00, 0x03, 0x06, 0x6E, 0x11, 0xCF, 0xC8, 0x00, 0x40, 0xD1, 0xD2,
+  0xD0, 0xD5, 0x2D, 0x71, 0x97, 0xDE, 0xDA, 0xD9, 0xDB, 0xD6, 0xD4, 0xD5, 0xD9, 0xDA, 0xF6, 0x51,
+  0x02, 0x20, 0x03, 0x03, 0xF7, 0x75, 0x0F, 0x01, 0x00, 0x22, 0x0C, 0x60, 0x09, 0x07, 0x00, 0x19,
+  0x0F, 0x60, 0x09, 0x12, 0x60, 0x19, 0x19, 0x19, 0xEB, 0x1B, 0xEA, 0x56, 0x78, 0x0F, 0xC8, 0x00,
+  0x08, 0x65, 0xCF, 0xCF, 0xCE, 0xD1, 0xD6, 0xCE, 0xC8, 0x00, 0x62, 0xD8, 0xD9, 0xD6, 0xD3, 0xD5,
+  0xD9, 0x2A, 0x00, 0x10, 0xDC, 0x45, 0x62, 0x20, 0xDC, 0x00, 0x58, 0x02, 0x32, 0x1E, 0x1E, 0x1B,
+  0xC8, 0x69, 0x0F, 0x01, 0x00, 0x22, 0x0A, 0x60, 0x09, 0x07, 0x00, 0x19, 0x0F, 0x57, 0x02, 0x01,
+  0x0F, 0x50, 0x14, 0x03, 0x01, 0xE7, 0x6E, 0x00, 0x01, 0x00, 0x05, 0x2B, 0x4D, 0x3F, 0xDA, 0xD9,
+  0xD9, 0xC8, 0x00, 0x00, 0x13, 0xCF, 0xC8, 0x00, 0x61, 0xDA, 0xD7, 0xD6, 0xD5, 0xD7, 0x1C, 0x10,
+  0x04, 0x40, 0xD8, 0xD8, 0xDA, 0xDB, 0xEB, 0x05, 0x01, 0xD1, 0x61, 0x20, 0x00, 0x00, 0xC9, 0x00,
+  0x01, 0x45, 0x5D, 0x0F, 0x01, 0x00, 0x20, 0x00, 0x40, 0x38, 0x51, 0x0F, 0x12, 0x07, 0x18, 0x1A,
+  0xD7, 0x2E, 0x9F, 0x04, 0x22, 0x22, 0x35, 0x0C, 0x35, 0x22, 0x04, 0x07, 0x28, 0x0A, 0x14, 0x01,
+  0xC8, 0x00, 0x24, 0x1B, 0xEC, 0xC8, 0x00, 0x00, 0xE1, 0x87, 0x03, 0xC8, 0x00, 0x49, 0xD4, 0xD3,
+  0xD0, 0xCE, 0xC8, 0x00, 0x23, 0xCE, 0xCE, 0xC8, 0x00, 0x90, 0xD7, 0xD7, 0xD3, 0xD9, 0x00, 0x00,
+  0x1D, 0x19, 0x00, 0x00, 0x67, 0x01, 0xDA, 0x6A, 0x50, 0x1E, 0x1C, 0x1D, 0x00, 0xDD, 0x87, 0x6C,
+  0x02, 0xB2, 0x06, 0x0F, 0x60, 0x02, 0x23, 0x41, 0x18, 0x08, 0x35, 0x07, 0xCD, 0x58, 0x42, 0x17,
+  0x07, 0x12, 0x07, 0x01, 0x00, 0x4F, 0x33, 0x0C, 0x04, 0x14, 0x60, 0x09, 0x13, 0x02, 0x21, 0x03,
+  0x2A, 0xEC, 0xEE, 0xC8, 0x00, 0x10, 0xDB, 0x72, 0x08, 0x51, 0xD1, 0xCF, 0xCE, 0xCE, 0xD2, 0xE9,
+  0x03, 0x01, 0x20, 0x03, 0x07, 0xC8, 0x00, 0xB0, 0xD3, 0xD8, 0x00, 0x08, 0x00, 0x1C, 0x07, 0xD5,
+  0xD5, 0xD7, 0xD9, 0xC7, 0x00, 0x40, 0x1B, 0x19, 0x00, 0xD7, 0x7E, 0x7B, 0x40, 0xDD, 0xDB, 0xDB,
+  0x1E, 0x8C, 0x62, 0x10, 0x1C, 0xC4, 0x57, 0x0F, 0x01, 0x00, 0x20, 0x1F, 0x1A, 0x79, 0x1A, 0x00,
+  0x2F, 0x1A, 0x1A, 0x11, 0x32, 0x02, 0x0F, 0xC8, 0x00, 0x05, 0x04, 0x1D, 0x54, 0x01, 0xBD, 0x4E,
+  0xC1, 0x00, 0x00, 0xDB, 0xDA, 0xD8, 0xD6, 0xD1, 0xD0, 0xCF, 0xCE, 0xD5, 0xCF, 0xC7, 0x00, 0x90,
+  0xD2, 0xCF, 0xD1, 0xD6, 0xD3, 0xD1, 0xCE, 0xCE, 0xD2, 0xC6, 0x6A, 0x20, 0xDE, 0xDA, 0x79, 0x01,
+  0x70, 0x00, 0x08, 0x11, 0xD5, 0xD5, 0xD5, 0xD5, 0xC0, 0x00, 0x01, 0xC7, 0x00, 0x00, 0x6B, 0x69,
+  0x30, 0xD3, 0xD4, 0xDE, 0xA7, 0x15, 0x01, 0x62, 0x6A, 0x0F, 0xB8, 0x00, 0x11, 0x0F, 0x01, 0x00,
+  0x07, 0x10, 0x1C, 0x1D, 0x23, 0x74, 0x08, 0x04, 0x21, 0x36, 0x35, 0x0C, 0x21, 0x23, 0x5C, 0x09,
+  0x01, 0x00, 0x0F, 0xC8, 0x00, 0x04, 0x33, 0x1C, 0x1D, 0x1E, 0xEB, 0x03, 0x12, 0x9F, 0x63, 0x51,
+  0xB0, 0xDB, 0xD6, 0xD3, 0xD0, 0xCF, 0xCC, 0xCF, 0xD3, 0xCE, 0xD1, 0xD1, 0xED, 0x66, 0x80, 0xCF,
+  0xD2, 0xD9, 0xD0, 0xD0, 0xCE, 0xD1, 0xD5, 0x6B, 0x01, 0x30, 0xDE, 0xDA, 0xD8, 0x70, 0x05, 0x10,
+  0x1F, 0xC7, 0x00, 0x33, 0xD5, 0xD5, 0xDA, 0xC7, 0x00, 0x93, 0xD5, 0xD2, 0xD2, 0xCD, 0xCF, 0x1B,
+  0xDB, 0x1D, 0x17, 0x76, 0x0B, 0x0F, 0xBB, 0x00, 0x1E, 0x53, 0x16, 0x18, 0x1A, 0x1C, 0x1E, 0xDC,
+  0x0A, 0x30, 0x1C, 0x17, 0x13, 0x6B, 0x5D, 0x8F, 0x00, 0x04, 0x04, 0x37, 0x35, 0x0C, 0x21, 0x29,
+  0x2E, 0x00, 0x00, 0x0F, 0xC8, 0x00, 0x01, 0x30, 0x19, 0xEB, 0xEB, 0x31, 0x71, 0x10, 0xEE, 0x7A,
+  0x54, 0x01, 0x18, 0x07, 0xF1, 0x10, 0x1D, 0x1E, 0x00, 0xDB, 0xD7, 0xD2, 0xD0, 0xCC, 0xCF, 0xD3,
+  0xCF, 0xD2, 0xD5, 0xD5, 0xD5, 0xD8, 0xD8, 0xD5, 0xD2, 0xD2, 0xDA, 0xD1, 0xCE, 0xD0, 0xD0, 0xD4,
+  0x1C, 0x19, 0x19, 0x18, 0xDE, 0x45, 0x06, 0x10, 0x1F, 0x53, 0x0D, 0x00, 0x1F, 0x6A, 0xD5, 0xDC,
+  0x00, 0x00, 0xD7, 0x00, 0xD4, 0xD1, 0xCD, 0xCF, 0xCF, 0xC9, 0xCE, 0x96, 0xC8, 0x00, 0x0F, 0x63,
+  0x61, 0x08, 0x0F, 0x01, 0x00, 0x05, 0x61, 0x1A, 0x08, 0x0C, 0x25, 0x00, 0x07, 0x91, 0x02, 0x30,
+  0x17, 0x10, 0x1B, 0x78, 0x69, 0x02, 0x58, 0x4D, 0x1F, 0x0C, 0xC8, 0x00, 0x16, 0x00, 0x17, 0x6E,
+  0x10, 0xEE, 0xE6, 0x3D, 0x07, 0x55, 0x14, 0x61, 0xDF, 0xDB, 0xD2, 0xD2, 0xD7, 0xD3, 0xCA, 0x0E,
+  0xF0, 0x01, 0xDA, 0xDD, 0xD7, 0xD5, 0xD7, 0xDA, 0xDA, 0xD7, 0xD4, 0xD4, 0xD4, 0x1C, 0x19, 0x18,
+  0x17, 0xDE, 0x13, 0x03, 0x10, 0x1F, 0x65, 0x7B, 0x00, 0x5E, 0x09, 0xF1, 0x01, 0xDC, 0xDC, 0x00,
+  0xCD, 0xD1, 0x00, 0xD1, 0xCB, 0xD4, 0xCF, 0xD5, 0xD2, 0xCB, 0xDB, 0xD7, 0x1D, 0x21, 0x5B, 0x2F,
+  0x08, 0x1A, 0xC8, 0x00, 0x20, 0x61, 0x08, 0x1E, 0x0C, 0x35, 0x36, 0x08, 0xC9, 0x00, 0x17, 0x13,
+  0x18, 0x2E, 0x3F, 0x18, 0x0C, 0x21, 0xC8, 0x00, 0x17, 0x10, 0xEA, 0xAC, 0x61, 0x01, 0x59, 0x02,
+  0x00, 0xF9, 0x2F, 0x20, 0x1A, 0x1B, 0x60, 0x6C, 0x05, 0x83, 0x6F, 0x04, 0x09, 0x00, 0x70, 0xDC,
+  0xDC, 0xDC, 0x08, 0x18, 0x18, 0x17, 0x8C, 0x08, 0x20, 0x1F, 0xDC, 0x54, 0x02, 0x10, 0xD6, 0x91,
+  0x01, 0xF1, 0x00, 0xDC, 0x00, 0xD0, 0xD7, 0x00, 0xD1, 0xCB, 0xD2, 0xCF, 0xD7, 0xCF, 0xD1, 0xD1,
+  0xD3, 0x1D, 0xD3, 0x29, 0x14, 0x1A, 0x4F, 0x2F, 0x0F, 0x01, 0x00, 0x19, 0x10, 0x1C, 0xC8, 0x00,
+  0x10, 0x23, 0x33, 0x26, 0x21, 0x1C, 0x17, 0xE0, 0x60, 0x03, 0x40, 0x06, 0x05, 0x8F, 0x33, 0x0F,
+  0xC8, 0x00, 0x0E, 0x11, 0x19, 0x21, 0x03, 0x09, 0x95, 0x59, 0x02, 0xC1, 0x00, 0x22, 0xDD, 0xDD,
+  0xB1, 0x75, 0x10, 0xDD, 0xB3, 0x7D, 0x00, 0x6E, 0x0C, 0x40, 0x08, 0x18, 0x18, 0x16, 0x56, 0x02,
+  0x01, 0xC7, 0x00, 0x40, 0xD5, 0xD5, 0xD2, 0xD2, 0xC2, 0x04, 0xE1, 0xD3, 0xD7, 0x00, 0xCD, 0xCB,
+  0xD2, 0xCB, 0xD7, 0xC9, 0xC9, 0xCD, 0xD1, 0x1D, 0x07, 0x46, 0x5A, 0x0F, 0x6A, 0x0B, 0x00, 0x0F,
+  0x01, 0x00, 0x0D, 0x31, 0x1F, 0x1E, 0x00, 0xC8, 0x00, 0x58, 0x12, 0x1D, 0x1D, 0x17, 0x1B, 0x60,
+  0x09, 0x1F, 0x08, 0x71, 0x17, 0x01, 0x0F, 0xC8, 0x00, 0x05, 0x1B, 0xEA, 0x5C, 0x5A, 0x03, 0xAE,
+  0x75, 0x00, 0xC3, 0x00, 0x10, 0xDB, 0xED, 0x74, 0x01, 0xC4, 0x0E, 0x50, 0xD7, 0xD7, 0x1A, 0x18,
+  0x17, 0xC8, 0x00, 0x21, 0xDC, 0xD5, 0x70, 0x02, 0x40, 0xDA, 0xD3, 0xD2, 0xD5, 0x2D, 0x00, 0x11,
+  0xD3, 0xC8, 0x00, 0x21, 0xD3, 0xCD, 0x58, 0x02, 0x00, 0x30, 0x2C, 0x13, 0x18, 0x86, 0x2E, 0x0F,
+  0xC8, 0x00, 0x1A, 0x02, 0xB8, 0x0B, 0x59, 0x08, 0x0F, 0x1D, 0x1D, 0x17, 0x28, 0x0A, 0x25, 0x18,
+  0x24, 0x9E, 0x61, 0x0F, 0xC8, 0x00, 0x0D, 0x00, 0xB2, 0x04, 0x0A, 0x99, 0x08, 0xB5, 0xDF, 0xDD,
+  0xDF, 0xDB, 0xDE, 0xDC, 0xDE, 0xDB, 0xDB, 0xDA, 0xDC, 0xC8, 0x00, 0x21, 0xD8, 0xD8, 0x22, 0x11,
+  0xF1, 0x10, 0x1F, 0x00, 0x00, 0xD7, 0xD8, 0xD2, 0xD2, 0xD2, 0xD2, 0xD5, 0xD9, 0xCE, 0xD2, 0xD2,
+  0x00, 0x11, 0x18, 0x00, 0xD6, 0x00, 0xCD, 0xCA, 0xCA, 0xCA, 0xCB, 0xC8, 0xCC, 0x1B, 0xDB, 0x1D,
+  0x13, 0x31, 0x5A, 0x1E, 0x15, 0xF2, 0x1E, 0x0F, 0x01, 0x00, 0x0E, 0x02, 0x60, 0x09, 0x5A, 0x17,
+  0x0F, 0x1D, 0x08, 0x19, 0xF0, 0x0A, 0x0F, 0x9B, 0x53, 0x01, 0x0F, 0xC8, 0x00, 0x14, 0x30, 0xE9,
+  0xDF, 0xDF, 0x21, 0x62, 0x11, 0xDB, 0x1B, 0x6D, 0x50, 0xDC, 0xDC, 0xDD, 0xDE, 0xD9, 0x6C, 0x0C,
+  0x31, 0xD9, 0xD9, 0xDA, 0xC8, 0x00, 0x20, 0xDC, 0xD8, 0x02, 0x6E, 0xF0, 0x09, 0xD8, 0xDA, 0xD6,
+  0xCE, 0xD1, 0xD2, 0x00, 0x07, 0x11, 0x00, 0x00, 0xD2, 0xDD, 0xC9, 0xCD, 0xCE, 0xCB, 0xC8, 0xCC,
+  0x96, 0xDB, 0x1D, 0x12, 0x07, 0xC7, 0x00, 0x1F, 0x14, 0xC8, 0x00, 0x1E, 0x21, 0x07, 0x0F, 0xC8,
+  0x00, 0x5B, 0x08, 0x11, 0x17, 0x08, 0x19, 0xB8, 0x0B, 0x2E, 0x18, 0x08, 0x0A, 0x52, 0x0F, 0xC8,
+  0x00, 0x04, 0x21, 0x1A, 0x1A, 0xB0, 0x05, 0x06, 0xC8, 0x00, 0x60, 0xDE, 0xDB, 0xDA, 0xD9, 0xDA,
+  0xDB, 0xBA, 0x00, 0x80, 0xD9, 0xD8, 0xDA, 0xDC, 0xDD, 0xDE, 0xD7, 0xD7, 0x83, 0x13, 0x10, 0xDA,
+  0xC8, 0x00, 0x40, 0x00, 0x00, 0xD8, 0xD8, 0xCE, 0x12, 0xFF, 0x0E, 0xD5, 0xD9, 0xD4, 0x07, 0xD1,
+  0xCF, 0xD9, 0x00, 0x07, 0x11, 0x08, 0x00, 0xD2, 0xDD, 0xCE, 0xC9, 0xC9, 0xC8, 0xCA, 0xCE, 0xDE,
+  0x1D, 0x11, 0x07, 0x07, 0x07, 0x14, 0x13, 0x13, 0xB0, 0x04, 0x1F, 0x21, 0x07, 0x0F, 0xC8, 0x00,
+  0x34, 0x08, 0x08, 0x08, 0x80, 0x0C, 0x01, 0x5B, 0x01, 0x01, 0x60, 0x22, 0x0F, 0x80, 0x0C, 0x11,
+  0x03, 0xC9, 0x00, 0x03, 0xC8, 0x00, 0x01, 0x29, 0x0A, 0x40, 0x9F, 0x00, 0xE9, 0xDE, 0x7E, 0x01,
+  0x10, 0xD8, 0x9D, 0x72, 0x80, 0xD9, 0xD8, 0xD7, 0xDA, 0xDC, 0xDD, 0xD4, 0xD4, 0xCA, 0x00, 0x02,
+  0xC8, 0x00, 0x22, 0xDC, 0xD5, 0xC8, 0x00, 0x10, 0xD8, 0xC8, 0x00, 0x80, 0xD4, 0x00, 0x00, 0x08,
+  0x1E, 0x1E, 0x00, 0xD6, 0x1C, 0x75, 0x31, 0x00, 0xDB, 0xDB, 0xC8, 0x00, 0x20, 0x13, 0x13, 0xF3,
+  0x72, 0x0F, 0xC9, 0x00, 0x1E, 0x1B, 0x07, 0x48, 0x0D, 0x00, 0x90, 0x4C, 0x01, 0xC8, 0x00, 0x0F,
+  0xC9, 0x00, 0x00, 0x0F, 0xC8, 0x00, 0x04, 0x11, 0x19, 0xFB, 0x74, 0x03, 0x5D, 0x09, 0x00, 0xC8,
+  0x00, 0x00, 0x5C, 0x10, 0x41, 0xD5, 0xD7, 0xD6, 0xD6, 0xDE, 0x03, 0x30, 0xD8, 0xDB, 0xDD, 0x10,
+  0x03, 0x00, 0x7D, 0x68, 0x00, 0x1F, 0x00, 0x40, 0xD8, 0xD5, 0xD6, 0xD4, 0x01, 0x00, 0x00, 0x58,
+  0x02, 0x31, 0xCF, 0xCE, 0xD9, 0x6D, 0x5F, 0x91, 0x08, 0x1D, 0x1D, 0xCE, 0xCE, 0xD6, 0x00, 0x00,
+  0x1A, 0xC8, 0x00, 0x1F, 0x17, 0x74, 0x12, 0x02, 0x0F, 0x01, 0x00, 0x0C, 0x1F, 0x08, 0xC8, 0x00,
+  0x00, 0x01, 0x08, 0x39, 0x00, 0x67, 0x1B, 0x0F, 0xC8, 0x00, 0x15, 0x22, 0x19, 0x1A, 0xD2, 0x96,
+  0x02, 0xE9, 0x55, 0x90, 0x00, 0xE9, 0xDB, 0xDA, 0xD9, 0xD7, 0xD3, 0xD7, 0xD3, 0x87, 0x01, 0x00,
+  0x01, 0x00, 0x11, 0xDD, 0x2F, 0x0A, 0x12, 0xD0, 0x25, 0x74, 0x30, 0xD8, 0xD7, 0xD5, 0xDD, 0x12,
+  0x30, 0xD2, 0xD8, 0xD9, 0xC8, 0x00, 0x70, 0xD3, 0xDD, 0x00, 0x1F, 0x1C, 0xF8, 0x7D, 0x5D, 0x00,
+  0x8F, 0x00, 0x1D, 0x1C, 0x13, 0x13, 0x07, 0x07, 0x17, 0x5D, 0x09, 0x24, 0x27, 0x08, 0x18, 0xC8,
+  0x00, 0x61, 0x1E, 0x07, 0x12, 0x08, 0x1D, 0x25, 0xC8, 0x00, 0x00, 0xB7, 0x1D, 0x0C, 0x2C, 0x00,
+  0x0F, 0xC8, 0x00, 0x06, 0x11, 0x19, 0xC8, 0x00, 0x50, 0x1F, 0x1B, 0x1A, 0x1B, 0x1D, 0xC6, 0x55,
+  0x40, 0xD9, 0xD9, 0xD9, 0xD4, 0xC8, 0x00, 0xF0, 0x00, 0xD1, 0xD4, 0xD6, 0xD6, 0xD7, 0xD2, 0xD8,
+  0xD9, 0xD0, 0xD7, 0xD5, 0xD3, 0xD3, 0x00, 0xD7, 0x7D, 0x7A, 0x60, 0xDC, 0xDA, 0xD7, 0xD5, 0xD6,
+  0xD7, 0x3F, 0x06, 0xC1, 0xD8, 0xD3, 0xD2, 0xCC, 0xCC, 0xCE, 0xDD, 0x18, 0x08, 0xF6, 0xF8, 0xF5,
+  0x1B, 0x5E, 0x12, 0x13, 0x6D, 0x39, 0x0F, 0x01, 0x00, 0x24, 0x09, 0xC8, 0x00, 0x62, 0x08, 0x12,
+  0x07, 0x08, 0x1D, 0x23, 0xC8, 0x00, 0x0F, 0xA0, 0x0F, 0x12, 0x04, 0x01, 0x00, 0x10, 0x1B, 0xC9,
+  0x00, 0x00, 0xF5, 0x66, 0x00, 0x32, 0x11, 0xF2, 0x07, 0x9F, 0xD6, 0xD6, 0xD9, 0xD4, 0xD0, 0xD3,
+  0xD0, 0xD4, 0xD0, 0xD0, 0xD4, 0xD3, 0xD6, 0xD2, 0xD3, 0xD9, 0xD7, 0xD3, 0xD3, 0xCE, 0xCA, 0x03,
+  0x0E, 0x10, 0xDE, 0xB6, 0x12, 0x01, 0xA6, 0x01, 0x30, 0xD2, 0xD1, 0xD1, 0xC8, 0x00, 0x50, 0x07,
+  0x08, 0xF5, 0xF8, 0xFA, 0x5D, 0x00, 0x1F, 0x07, 0xC6, 0x00, 0x29, 0x00, 0x19, 0x15, 0x07, 0xC8,
+  0x00, 0x10, 0x1A, 0xD1, 0x35, 0x2F, 0x37, 0x37, 0x28, 0x23, 0x1A, 0x0F, 0x01, 0x00, 0x00, 0x10,
+  0xD2, 0x0F, 0x0E, 0x40, 0xD2, 0xD0, 0xD4, 0xD1, 0xB7, 0x0B, 0xB1, 0xD3, 0xD1, 0xD9, 0xD7, 0xD3,
+  0xCC, 0xCE, 0xCE, 0xCA, 0xD9, 0xD9, 0x46, 0x7B, 0x00, 0x01, 0x00, 0x20, 0xDC, 0xDA, 0xA5, 0x76,
+  0x00, 0xC8, 0x00, 0x41, 0x19, 0x16, 0x08, 0xF4, 0x90, 0x01, 0x0F, 0x01, 0x00, 0x2D, 0x35, 0x1E,
+  0x08, 0x1A, 0xA0, 0x0F, 0x21, 0x1A, 0x07, 0x77, 0x33, 0x21, 0x36, 0x0C, 0xF8, 0x11, 0x0E, 0x2C,
+  0x00, 0x0F, 0xC8, 0x00, 0x15, 0x70, 0x19, 0xD2, 0xD2, 0xD2, 0xD0, 0xD0, 0xCD, 0xC9, 0x00, 0x30,
+  0xD4, 0xD2, 0xD6, 0xC7, 0x00, 0x41, 0xCA, 0xCB, 0xCE, 0xCA, 0xC5, 0x75, 0x60, 0xDE, 0xDE, 0xD9,
+  0xDD, 0xED, 0xED, 0x92, 0x05, 0x20, 0xD2, 0xD7, 0x35, 0x03, 0x6F, 0x18, 0x08, 0xF8, 0xF4, 0xF8,
+  0x6A, 0xB9, 0x00, 0x21, 0x0C, 0x01, 0x00, 0x05, 0xC8, 0x00, 0x31, 0x1A, 0x07, 0x13, 0xC7, 0x00,
+  0x40, 0x1D, 0x1D, 0x0C, 0x22, 0xB0, 0x04, 0x0E, 0x21, 0x4E, 0x0F, 0xC8, 0x00, 0x16, 0x40, 0x19,
+  0x19, 0x19, 0xD4, 0x42, 0x0D, 0x00, 0x6B, 0x17, 0xFF, 0x16, 0xD5, 0xD9, 0xD7, 0xD3, 0xCA, 0xC8,
+  0xC7, 0xC7, 0xCE, 0xD9, 0xD4, 0xD7, 0xD8, 0xDA, 0xDC, 0xD7, 0x00, 0xD9, 0xDD, 0xDA, 0xD7, 0xD6,
+  0xD9, 0xD8, 0xD1, 0xD0, 0xD3, 0xCC, 0xCC, 0xD0, 0x08, 0x08, 0xF6, 0xF3, 0xF8, 0x5B, 0x67, 0x9C,
+  0x00, 0x04, 0x30, 0x19, 0x07, 0x12, 0x33, 0x54, 0x2F, 0x11, 0x17, 0xBD, 0x2A, 0x00, 0x0C, 0x01,
+  0x00, 0x10, 0x1E, 0xF3, 0x6A, 0x20, 0x0F, 0x0F, 0x69, 0x42, 0x03, 0xC7, 0x00, 0x40, 0x1D, 0x1D,
+  0x08, 0x26, 0xE0, 0x0E, 0x0E, 0x57, 0x00, 0x0F, 0x01, 0x00, 0x23, 0xFF, 0x14, 0xD3, 0xCC, 0xC8,
+  0xC7, 0xC7, 0xCA, 0xD1, 0xD5, 0xD0, 0xD4, 0xD4, 0xD4, 0xD7, 0xD6, 0xD3, 0xDA, 0xD3, 0xD5, 0xD1,
+  0xD1, 0xD7, 0xD3, 0xD0, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xD2, 0x19, 0xF4, 0xF3, 0xF8, 0x59, 0x61,
+  0x9B, 0x00, 0x03, 0x70, 0x16, 0x07, 0x18, 0x18, 0x17, 0x16, 0x15, 0xD4, 0x26, 0x0F, 0x8C, 0x05,
+  0x0F, 0x30, 0x1E, 0x07, 0x0F, 0xC1, 0x4B, 0x26, 0x07, 0x17, 0xF2, 0x04, 0x5F, 0x08, 0x00, 0x08,
+  0x29, 0x15, 0xCA, 0x19, 0x00, 0x0F, 0xC8, 0x00, 0x24, 0x22, 0x19, 0xCC, 0xC7, 0x00, 0xFF, 0x0D,
+  0xD0, 0xD0, 0xCC, 0xD2, 0xD3, 0xD5, 0xCF, 0xD8, 0xD1, 0xD5, 0xCE, 0xCC, 0xD1, 0xD1, 0xD0, 0xCC,
+  0xCC, 0xCE, 0xCC, 0xCF, 0xD2, 0xF5, 0xF4, 0xF3, 0xF8, 0x41, 0x61, 0x6E, 0x9A, 0x00, 0x01, 0x41,
+  0x17, 0x08, 0x18, 0x34, 0xCE, 0x2A, 0x4F, 0x26, 0x19, 0x07, 0x0F, 0x92, 0x01, 0x01, 0x3F, 0x29,
+  0x2C, 0x2C, 0x38, 0x00, 0x01, 0x05, 0x01, 0x00, 0x00, 0x4D, 0x18, 0x12, 0x0F, 0x7B, 0x45, 0x09,
+  0x01, 0x00, 0x0F, 0xC8, 0x00, 0x25, 0xF1, 0x04, 0x19, 0xCC, 0xCC, 0xD1, 0xD5, 0xD0, 0xCE, 0xCC,
+  0xCC, 0xCE, 0xD1, 0xD3, 0xD5, 0xCF, 0xD6, 0xCE, 0xD1, 0xCE, 0xCC, 0xC7, 0x00, 0xAF, 0xCF, 0xCF,
+  0xD0, 0xF7, 0xF6, 0xF6, 0xF4, 0xF8, 0x58, 0x02, 0x86, 0x00, 0x01, 0x20, 0x19, 0x08, 0x39, 0x70,
+  0x01, 0xC8, 0x00, 0x4E, 0x04, 0x00, 0x07, 0x11, 0xC9, 0x00, 0x35, 0x27, 0x29, 0x00, 0xE3, 0x0B,
+  0x2F, 0x1F, 0x1D, 0xB2, 0x01, 0x00, 0x3F, 0x18, 0x00, 0x14, 0xD6, 0x59, 0x00, 0x0F, 0xA0, 0x28,
+  0x29, 0x40, 0x19, 0xD9, 0xD6, 0xD0, 0xC9, 0x00, 0x60, 0xCC, 0xD0, 0xD1, 0xCC, 0xD3, 0xCE, 0x09,
+  0x00, 0x00, 0x0C, 0x00, 0x9F, 0xD0, 0xD0, 0xF7, 0xF7, 0xF7, 0xF6, 0xF6, 0xF8, 0x5B, 0xE9, 0x03,
+  0x01, 0x21, 0x1A, 0x00, 0x01, 0x71, 0x01, 0x26, 0x46, 0x4D, 0x08, 0x08, 0x00, 0x07, 0xFA, 0x10,
+  0x00, 0x6E, 0x33, 0x15, 0x12, 0x5D, 0x57, 0x10, 0x08, 0x12, 0x69, 0x50, 0x18, 0x17, 0x15, 0x15,
+  0x13, 0x51, 0x03, 0x30, 0x13, 0x15, 0x15, 0xC6, 0x3D, 0x4F, 0x00, 0x14, 0x07, 0x04, 0xC9, 0x00,
+  0x00, 0x0F, 0xC8, 0x00, 0x28, 0x50, 0x19, 0xD6, 0xD3, 0xD0, 0xCC, 0x6E, 0x10, 0x41, 0xCC, 0xCC,
+  0xD1, 0xCC, 0xC8, 0x00, 0x70, 0xCD, 0xD0, 0xD2, 0xF9, 0xF8, 0xF8, 0xF9, 0xC8, 0x00, 0x1F, 0x68,
+  0xC7, 0x00, 0x00, 0x34, 0x08, 0x00, 0x30, 0xC8, 0x00, 0x21, 0x08, 0x17, 0xF8, 0x02, 0x0B, 0x21,
+  0x00, 0x24, 0x25, 0x04, 0x1F, 0x78, 0x01, 0x2F, 0x00, 0x22, 0x1A, 0x0C, 0xCD, 0x74, 0x01, 0x43,
+  0x4D, 0x00, 0x4B, 0x38, 0x01, 0xDC, 0x0D, 0x01, 0x80, 0x3E, 0x0F, 0xC8, 0x00, 0x3A, 0x80, 0x19,
+  0x19, 0xD6, 0xD4, 0xD3, 0xD3, 0xD2, 0xD1, 0x92, 0x01, 0x00, 0xC5, 0x00, 0x20, 0xD0, 0xD2, 0x20,
+  0x2A, 0x42, 0xF8, 0xF9, 0xF8, 0xF7, 0xD0, 0x07, 0x0C, 0x01, 0x00, 0x10, 0x00, 0xA7, 0x39, 0x01,
+  0xC8, 0x00, 0x31, 0x08, 0x17, 0x19, 0x70, 0x7C, 0x00, 0x20, 0x69, 0x24, 0x07, 0x14, 0x20, 0x00,
+  0x20, 0x20, 0x23, 0x61, 0x4C, 0x04, 0xC4, 0x03, 0x20, 0x1F, 0x08, 0x38, 0x4A, 0x04, 0x08, 0x07,
+  0x10, 0x1D, 0xAA, 0x48, 0x05, 0xD0, 0x39, 0x0E, 0xF2, 0x23, 0x0F, 0xC8, 0x00, 0x2B, 0x00, 0xCA,
+  0x00, 0x10, 0xD4, 0x5F, 0x14, 0x3A, 0xCC, 0xCC, 0xD2, 0xD1, 0x27, 0x01, 0x60, 0x09, 0x09, 0x01,
+  0x00, 0x34, 0x1E, 0x00, 0x10, 0xC8, 0x00, 0x00, 0xC7, 0x00, 0x02, 0xC5, 0x43, 0x00, 0x01, 0x00,
+  0x13, 0x32, 0x21, 0x00, 0x75, 0x28, 0x34, 0x20, 0x18, 0x19, 0x19, 0x1B, 0x54, 0x05, 0x01, 0x70,
+  0x49, 0x06, 0x28, 0x0A, 0x18, 0x1A, 0x98, 0x3A, 0x0D, 0x84, 0x25, 0x0F, 0xC8, 0x00, 0x2D, 0x00,
+  0xCB, 0x00, 0x6A, 0xD0, 0xCF, 0xCF, 0xD0, 0xD2, 0x7E, 0x01, 0x00, 0x0D, 0x77, 0x1E, 0x34, 0x1F,
+  0x00, 0x17, 0xC8, 0x00, 0x01, 0x28, 0x6D, 0x03, 0xC9, 0x00, 0x33, 0x17, 0x13, 0x0C, 0xCA, 0x83,
+  0x30, 0x1D, 0x28, 0x34, 0x31, 0x3B, 0x14, 0x1D, 0x6D, 0x02, 0x11, 0x1E, 0xA8, 0x48, 0x06, 0xC8,
+  0x00, 0x05, 0x68, 0x10, 0x01, 0x60, 0x3B, 0x2F, 0x04, 0x36, 0xC8, 0x00, 0x32, 0x02, 0xEB, 0x7A,
+  0x05, 0x01, 0x00, 0xFC, 0x05, 0x17, 0x16, 0x1B, 0xFC, 0xFA, 0xFB, 0xFC, 0xFB, 0xFC, 0xFD, 0xFD,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFC, 0xFC, 0xFC, 0x7F, 0xC9, 0x00, 0x22, 0x12, 0x0F, 0xC8, 0x00,
+  0x14, 0x0C, 0x39, 0x1E, 0x00, 0xC8, 0x00, 0x44, 0x1A, 0x11, 0x04, 0x0C, 0xDD, 0x0D, 0x21, 0x28,
+  0x26, 0xEB, 0x68, 0x12, 0x1E, 0xE6, 0x00, 0x19, 0x1E, 0x00, 0x19, 0x0E, 0x48, 0x3F, 0x14, 0x04,
+  0xFF, 0x00, 0x0F, 0xC8, 0x00, 0x3A, 0x4A, 0x17, 0x1B, 0xF1, 0xF7, 0x20, 0x2E, 0x0D, 0x7A, 0x2C,
+  0x22, 0x18, 0x12, 0xC8, 0x00, 0x03, 0x37, 0x05, 0x20, 0x1C, 0x1A, 0xBE, 0x67, 0x27, 0x17, 0x0F,
+  0xB4, 0x03, 0x21, 0x28, 0x08, 0x69, 0x6C, 0x13, 0x1F, 0xE8, 0x00, 0x0A, 0xC8, 0x00, 0x0D, 0x80,
+  0x3E, 0x0A, 0xC9, 0x00, 0x0F, 0xC7, 0x00, 0x24, 0x00, 0xA4, 0x69, 0x09, 0x11, 0x00, 0x03, 0xB9,
+  0x36, 0x02, 0xE8, 0x4D, 0x20, 0x99, 0x00, 0xD8, 0x27, 0x0F, 0xC9, 0x00, 0x01, 0xE0, 0x31, 0x32,
+  0x00, 0x18, 0x07, 0x13, 0x12, 0x11, 0x10, 0x0F, 0x0F, 0x12, 0x16, 0x00, 0x65, 0x01, 0x14, 0x04,
+  0x9A, 0x4B, 0x00, 0x8C, 0x04, 0x00, 0xC8, 0x00, 0x21, 0x18, 0x15, 0x79, 0x05, 0x39, 0x13, 0x0F,
+  0x07, 0x90, 0x1A, 0x17, 0x1A, 0x80, 0x3E, 0x02, 0xB8, 0x3D, 0x18, 0x28, 0x37, 0x11, 0x0F, 0xC8,
+  0x00, 0x25, 0x02, 0xDD, 0x6C, 0x05, 0x01, 0x00, 0x21, 0x1B, 0x9A, 0x49, 0x31, 0x00, 0x80, 0x37,
+  0x00, 0x10, 0x27, 0x3F, 0x00, 0x9D, 0x98, 0x7A, 0x1E, 0x00, 0x4A, 0x07, 0x0F, 0x30, 0x31, 0x86,
+  0x11, 0x00, 0xE5, 0x0D, 0x08, 0x01, 0x00, 0x00, 0xC8, 0x00, 0x13, 0x15, 0x79, 0x05, 0x02, 0xA0,
+  0x0F, 0x01, 0xC8, 0x00, 0x4B, 0x2A, 0x2D, 0x00, 0x1B, 0x58, 0x4D, 0x00, 0xBE, 0x10, 0x08, 0x7F,
+  0x05, 0x0F, 0xC8, 0x00, 0x23, 0x04, 0xA5, 0x6D, 0x06, 0xC8, 0x00, 0x61, 0x9E, 0x9B, 0x9A, 0x96,
+  0x97, 0x97, 0xCC, 0x99, 0x40, 0x9B, 0x9B, 0x9B, 0x00, 0xB2, 0x28, 0x0D, 0xC8, 0x00, 0x35, 0x1D,
+  0x12, 0x15, 0x08, 0x07, 0x41, 0x26, 0x04, 0x2A, 0x2C, 0xC8, 0x00, 0x00, 0x05, 0x55, 0x02, 0xE4,
+  0x3F, 0x01, 0x89, 0x6B, 0x14, 0x19, 0xC7, 0x00, 0x02, 0xD8, 0x0E, 0x30, 0x0F, 0x12, 0x07, 0x9B,
+  0x7C, 0x40, 0x07, 0x10, 0x14, 0x16, 0x26, 0x7B, 0x01, 0x69, 0x10, 0x00, 0x9C, 0x09, 0x02, 0x01,
+  0x00, 0x07, 0x0B, 0x64, 0x0F, 0xC8, 0x00, 0x24, 0x00, 0x75, 0x00, 0x09, 0xC8, 0x00, 0xFF, 0x03,
+  0x9D, 0x98, 0x9B, 0x98, 0x99, 0x96, 0x9A, 0x9F, 0x9F, 0x9B, 0x9D, 0x9A, 0x9C, 0x9B, 0x00, 0x9D,
+  0x9C, 0x98, 0x0A, 0x20, 0x00, 0x26, 0x07, 0x17, 0xC8, 0x00, 0x1F, 0x27, 0xC8, 0x00, 0x04, 0x04,
+  0x69, 0x53, 0x01, 0x26, 0x4A, 0x30, 0x35, 0x12, 0x0F, 0xA9, 0x6E, 0x21, 0x18, 0x17, 0xCE, 0x13,
+  0x01, 0x9C, 0x21, 0x01, 0xC8, 0x00, 0x00, 0x6A, 0x4D, 0x00, 0xF8, 0x87, 0x06, 0xC6, 0x17, 0x0F,
+  0xC8, 0x00, 0x35, 0x60, 0x9C, 0x9C, 0x9D, 0x98, 0x96, 0x96, 0x90, 0x01, 0x7E, 0x9E, 0x9D, 0x9E,
+  0x9B, 0x00, 0x9E, 0x9E, 0x20, 0x03, 0x00, 0x42, 0x17, 0x0E, 0xC8, 0x00, 0x29, 0x1A, 0x18, 0xC8,
+  0x00, 0x06, 0x8F, 0x01, 0x01, 0xD2, 0x07, 0x1C, 0x15, 0x83, 0x08, 0x02, 0xC8, 0x00, 0x0E, 0x18,
+  0x60, 0x0F, 0xC8, 0x00, 0x25, 0x00, 0x74, 0x40, 0x08, 0xC8, 0x00, 0xFE, 0x04, 0x9E, 0x9B, 0x9C,
+  0x9A, 0x98, 0x97, 0x9E, 0x1F, 0x1F, 0x9E, 0x9B, 0x99, 0x98, 0x99, 0x00, 0x9C, 0x9A, 0x9E, 0x9A,
+  0xC8, 0x00, 0x2E, 0x1E, 0x19, 0xC8, 0x00, 0x38, 0x00, 0x1A, 0x15, 0xC8, 0x00, 0x06, 0x5E, 0x09,
+  0x01, 0xB6, 0x00, 0x0E, 0x4A, 0x09, 0x3F, 0x08, 0x00, 0x08, 0x08, 0x20, 0x13, 0x0F, 0xC8, 0x00,
+  0x24, 0x60, 0x9D, 0x9F, 0x9C, 0x9B, 0x9D, 0x00, 0x73, 0x41, 0x6F, 0x98, 0x95, 0x98, 0x00, 0x9F,
+  0x9D, 0xB8, 0x2B, 0x01, 0x3A, 0x1E, 0x1B, 0x18, 0xC8, 0x00, 0x10, 0x1E, 0xCD, 0x11, 0x18, 0x18,
+  0xC8, 0x00, 0x26, 0x0F, 0x15, 0x2F, 0x00, 0x0F, 0xB8, 0x3D, 0x03, 0x00, 0xEE, 0x3C, 0x0F, 0x58,
+  0x34, 0x35, 0x11, 0x17, 0x06, 0x50, 0x09, 0xC8, 0x00, 0x02, 0xD0, 0x75, 0x00, 0x0C, 0x35, 0x40,
+  0x9C, 0x9B, 0x9B, 0x00, 0x7A, 0x97, 0x0E, 0xC8, 0x00, 0x37, 0x1D, 0x1B, 0x1B, 0xC8, 0x00, 0x00,
+  0x07, 0x07, 0x10, 0x13, 0xC8, 0x00, 0x16, 0x16, 0xC8, 0x00, 0x17, 0x16, 0x57, 0x02, 0x0F, 0xB8,
+  0x3D, 0x08, 0x0F, 0x10, 0x0E, 0x35, 0x0E, 0xC8, 0x00, 0x00, 0xBC, 0x48, 0xA1, 0x9D, 0x9E, 0x00,
+  0x9D, 0x9B, 0x99, 0x9A, 0x95, 0x9D, 0x9D, 0x9A, 0x76, 0x0F, 0xC8, 0x00, 0x01, 0x16, 0x00, 0xC8,
+  0x00, 0x00, 0x55, 0x95, 0x85, 0x07, 0x10, 0x15, 0x1B, 0x00, 0x08, 0x1A, 0x16, 0xC8, 0x00, 0x02,
+  0x3C, 0x06, 0x03, 0xC7, 0x00, 0x0F, 0xB8, 0x3D, 0x05, 0x0F, 0x59, 0x00, 0x00, 0x0F, 0xC8, 0x00,
+  0x36, 0x00, 0x38, 0x5B, 0x41, 0x9C, 0x97, 0x00, 0x9C, 0x3D, 0x6D, 0x2F, 0x9E, 0x00, 0xD3, 0x3C,
+  0x04, 0x10, 0x1E, 0x15, 0x77, 0x00, 0x53, 0x85, 0x20, 0x13, 0x12, 0x52, 0x0C, 0x00, 0x4D, 0x45,
+  0xF6, 0x00, 0x1A, 0x00, 0x1F, 0x1D, 0x2C, 0x28, 0x23, 0x37, 0x35, 0x0C, 0x33, 0x33, 0x31, 0x07,
+  0x0F, 0x32, 0x02, 0x1B, 0x1C, 0x28, 0x3C, 0x0F, 0xB8, 0x3D, 0x01, 0x0F, 0xC8, 0x00, 0x3F, 0x10,
+  0x9C, 0xDD, 0x4A, 0x02, 0x45, 0x18, 0x00, 0x11, 0x7E, 0x2F, 0x9C, 0x9C, 0xF2, 0x38, 0x03, 0x04,
+  0xC9, 0x00, 0x50, 0x16, 0x07, 0x07, 0x16, 0x18, 0x29, 0x84, 0x45, 0x19, 0x18, 0x16, 0x1D, 0x7F,
+  0x6C, 0x36, 0x31, 0x07, 0x11, 0x57, 0x02, 0x0F, 0xB8, 0x3D, 0x12, 0x0F, 0xC8, 0x00, 0x3E, 0xFF,
+  0x03, 0x9E, 0x99, 0x99, 0x00, 0x98, 0x9A, 0x9B, 0x98, 0x9A, 0x99, 0x98, 0x96, 0x9C, 0x98, 0x00,
+  0x9D, 0x9A, 0x9C, 0x4A, 0x26, 0x0C, 0x8F, 0x04, 0x1C, 0x1C, 0x1C, 0x04, 0x04, 0x04, 0x21, 0x44,
+  0x69, 0x00, 0x02, 0x01, 0x00, 0x18, 0x18, 0x60, 0x3B, 0x0F, 0xB8, 0x3D, 0x07, 0x0F, 0xC8, 0x00,
+  0x3D, 0xFF, 0x02, 0x9B, 0x9A, 0x00, 0x98, 0x9D, 0x9C, 0x9B, 0x9E, 0x9D, 0x9C, 0x9A, 0x9E, 0x9D,
+  0x00, 0x9E, 0x9D, 0x9A, 0xF2, 0x23, 0x0D, 0x11, 0x04, 0xA0, 0x86, 0x2F, 0x04, 0x36, 0xD6, 0x6A,
+  0x01, 0x01, 0xC8, 0x00, 0x0F, 0xB8, 0x3D, 0x32, 0x10, 0x29, 0x01, 0x00, 0x0F, 0xC8, 0x00, 0x19,
+  0x30, 0x9E, 0x9E, 0x00, 0xD2, 0x6A, 0x00, 0x01, 0x00, 0x21, 0x9D, 0x9B, 0x07, 0x00, 0x0F, 0xC8,
+  0x00, 0x0C, 0x01, 0xC9, 0x00, 0x3F, 0x07, 0x18, 0x35, 0x25, 0x1B, 0x00, 0x01, 0x01, 0x00, 0x0F,
+  0xB8, 0x3D, 0x36, 0x2F, 0x29, 0x19, 0xC9, 0x00, 0x06, 0x0E, 0xC8, 0x00, 0x02, 0x1D, 0x03, 0x02,
+  0x63, 0x42, 0x11, 0x9B, 0x0E, 0x3D, 0x0F, 0x12, 0x27, 0x0E, 0x00, 0x26, 0x2D, 0x4F, 0x07, 0x13,
+  0x04, 0x34, 0x1E, 0x00, 0x03, 0x0A, 0xB8, 0x3D, 0x1F, 0x04, 0xB8, 0x3D, 0x25, 0x0F, 0x90, 0x01,
+  0x1D, 0xD0, 0x9B, 0x98, 0x99, 0x93, 0x96, 0x1F, 0x9E, 0x99, 0x96, 0x98, 0x9A, 0x99, 0x9A, 0x41,
+  0x3C, 0x1F, 0x96, 0xC8, 0x00, 0x13, 0x2F, 0x12, 0x04, 0xE8, 0x5F, 0x03, 0x0A, 0xB8, 0x3D, 0x01,
+  0xC7, 0x00, 0x0F, 0xB8, 0x3D, 0x3B, 0x0F, 0xC8, 0x00, 0x05, 0xFF, 0x02, 0x99, 0x9A, 0x96, 0x95,
+  0x1F, 0x9D, 0x9E, 0x9A, 0x9D, 0x9B, 0x9C, 0x9C, 0x9B, 0x9A, 0x9B, 0x9A, 0x98, 0xC1, 0x32, 0x0F,
+  0x00, 0xC8, 0x00, 0x24, 0x11, 0x04, 0x9F, 0x0F, 0x0B, 0x01, 0x00, 0x08, 0xB8, 0x3D, 0x00, 0x82,
+  0x02, 0x01, 0x01, 0x00, 0x0F, 0xB8, 0x3D, 0x1F, 0x01, 0x90, 0x01, 0x0F, 0x58, 0x02, 0x18, 0x20,
+  0x9E, 0x9D, 0x7F, 0x0C, 0x00, 0x27, 0x0A, 0x00, 0x2A, 0x0A, 0x28, 0x9D, 0x9E, 0x98, 0x08, 0x3F,
+  0x6E, 0x6A, 0x6C, 0xC8, 0x00, 0x05, 0x3F, 0x16, 0x10, 0x00, 0x92, 0x1E, 0x04, 0x09, 0xB8, 0x3D,
+  0x1F, 0x04, 0xB8, 0x3D, 0x29, 0x0F, 0x58, 0x02, 0x1A, 0x90, 0x9D, 0x9E, 0x9A, 0x9C, 0x96, 0x1F,
+  0x1F, 0x9C, 0x9C, 0x90, 0x68, 0x20, 0x98, 0x00, 0x21, 0x40, 0x05, 0x64, 0x00, 0x3F, 0x6B, 0x68,
+  0x67, 0xC9, 0x00, 0x01, 0x00, 0xB7, 0x1C, 0x2F, 0x17, 0x0F, 0xC8, 0x00, 0x04, 0x0B, 0xB8, 0x3D,
+  0x1F, 0x04, 0xB8, 0x3D, 0x25, 0x0F, 0x90, 0x01, 0x1E, 0xF6, 0x02, 0x9F, 0x9E, 0x9D, 0x99, 0x1F,
+  0x9C, 0x99, 0x99, 0x95, 0x95, 0x95, 0x96, 0x93, 0x00, 0x9C, 0x97, 0x9E, 0x90, 0x01, 0x3F, 0x64,
+  0x5B, 0x5F, 0xC9, 0x00, 0x01, 0x00, 0xC8, 0x00, 0x1F, 0x18, 0xC8, 0x00, 0x06, 0x0F, 0xB8, 0x3D,
+  0x0A, 0x0F, 0xF0, 0x0A, 0x36, 0x0C, 0xC8, 0x00, 0x04, 0x40, 0x76, 0x01, 0x2B, 0x71, 0x30, 0x9E,
+  0x9C, 0x00, 0x21, 0x71, 0x05, 0x64, 0x00, 0x5E, 0x62, 0x5B, 0x5B, 0x65, 0x69, 0xAB, 0x00, 0x01,
+  0x30, 0x11, 0x0F, 0xC8, 0x00, 0x06, 0x28, 0x1C, 0x1F, 0xB8, 0x3D, 0x19, 0x04, 0xB8, 0x3D, 0x0F,
+  0x30, 0x2A, 0x13, 0x0F, 0xC8, 0x00, 0x22, 0x00, 0x84, 0xAC, 0x22, 0x9C, 0x9A, 0x96, 0x08, 0x66,
+  0x1F, 0x00, 0x00, 0x9F, 0x1F, 0x9D, 0xC8, 0x00, 0x5E, 0x60, 0x5B, 0x59, 0x61, 0x68, 0x91, 0x01,
+  0x00, 0xC8, 0x00, 0x1F, 0x08, 0xC8, 0x00, 0x07, 0x0F, 0xB8, 0x3D, 0x07, 0x0F, 0xC7, 0x00, 0x00,
+  0x0C, 0xC8, 0x00, 0x06, 0x3D, 0x4C, 0x03, 0x3B, 0x50, 0x1F, 0x96, 0xC8, 0x00, 0x14, 0x03, 0x90,
+  0x01, 0x80, 0x1F, 0x9E, 0x1F, 0x9C, 0x9F, 0x1F, 0x9E, 0x00, 0xE0, 0x5D, 0x05, 0x64, 0x00, 0x6E,
+  0x5B, 0x59, 0x58, 0x61, 0x66, 0x6B, 0xC8, 0x00, 0x00, 0x50, 0x24, 0x0F, 0xC8, 0x00, 0x06, 0x11,
+  0x1D, 0x90, 0x01, 0x04, 0x9A, 0x04, 0x08, 0xB8, 0x3D, 0x0F, 0xC7, 0x00, 0x01, 0x0B, 0xC8, 0x00,
+  0x1D, 0x1B, 0x6F, 0x73, 0x0F, 0xC8, 0x00, 0x14, 0x60, 0x1C, 0x1F, 0x9F, 0x9E, 0x00, 0x9C, 0x16,
+  0x35, 0x10, 0x1F, 0x35, 0x31, 0x47, 0x00, 0x1F, 0x1F, 0x9E, 0xC8, 0x00, 0x4F, 0x58, 0x41, 0x61,
+  0x64, 0x80, 0x17, 0x00, 0x6F, 0x07, 0x1C, 0x1A, 0x16, 0x12, 0x0F, 0x4D, 0x70, 0x00, 0x07, 0xB8,
+  0x3D, 0x04, 0x12, 0x0E, 0x06, 0xB8, 0x3D, 0x0F, 0xC7, 0x00, 0x02, 0x0F, 0xC8, 0x00, 0x00, 0x19,
+  0x4B, 0x01, 0x00, 0x1F, 0x4C, 0xC8, 0x00, 0x13, 0x10, 0x9A, 0x11, 0x03, 0xE6, 0x9B, 0x00, 0x1F,
+  0x9C, 0x9D, 0x9A, 0x9C, 0x9C, 0x9C, 0x9A, 0x9C, 0x9A, 0x9C, 0x9C, 0xD8, 0x0E, 0x7E, 0x5B, 0x41,
+  0x0F, 0x61, 0x64, 0x6A, 0x6E, 0x2D, 0x05, 0x00, 0xAF, 0x40, 0xC9, 0x07, 0x0F, 0x0F, 0x12, 0x04,
+  0x04, 0x23, 0x20, 0x20, 0x0C, 0x0C, 0x23, 0xC9, 0x00, 0x0F, 0xB8, 0x3D, 0x04, 0x0F, 0xC7, 0x00,
+  0x03, 0x0F, 0xC8, 0x00, 0x34, 0x11, 0x1C, 0xA9, 0x36, 0xF5, 0x00, 0x9C, 0x1F, 0x00, 0x9E, 0x99,
+  0x99, 0x9A, 0x99, 0x9C, 0x9B, 0x97, 0x1F, 0x9D, 0x00, 0x1F, 0xE3, 0x2E, 0x6F, 0x5B, 0x41, 0x42,
+  0x64, 0x68, 0x6B, 0xC8, 0x00, 0x00, 0x10, 0x1D, 0xC3, 0x11, 0x30, 0x11, 0x07, 0x08, 0x79, 0x28,
+  0x3C, 0x04, 0x23, 0x23, 0x6F, 0x3A, 0x0F, 0xB8, 0x3D, 0x02, 0x0F, 0xCA, 0x1E, 0x04, 0x0F, 0xC8,
+  0x00, 0x33, 0x2F, 0x1B, 0xFD, 0x01, 0x00, 0x01, 0x05, 0xC8, 0x00, 0x4E, 0x58, 0x41, 0x02, 0x68,
+  0x20, 0x03, 0x02, 0x01, 0x00, 0x40, 0x08, 0x08, 0x00, 0x1A, 0x31, 0x1C, 0x54, 0x16, 0x16, 0x17,
+  0x37, 0x23, 0x46, 0x9B, 0x04, 0x01, 0x00, 0x27, 0x1E, 0x1D, 0x14, 0x0A, 0x00, 0x2B, 0x35, 0x2F,
+  0x07, 0x00, 0xE9, 0x67, 0x04, 0x0E, 0xC8, 0x00, 0x0F, 0x20, 0x03, 0x21, 0x30, 0x1B, 0xFC, 0xFE,
+  0xFA, 0x3F, 0xE5, 0xF8, 0xF8, 0xF7, 0xF6, 0xFA, 0xF6, 0xF5, 0xF4, 0xF4, 0xF2, 0xF0, 0xF3, 0xF4,
+  0xF7, 0x73, 0x17, 0x5F, 0x5B, 0x59, 0x58, 0x68, 0x69, 0xD3, 0x07, 0x03, 0x56, 0x1D, 0x08, 0x00,
+  0x19, 0x0F, 0x68, 0x10, 0x19, 0x04, 0xC9, 0x00, 0x0C, 0x2E, 0x11, 0x6F, 0x07, 0x07, 0x07, 0x00,
+  0x20, 0x20, 0x9F, 0x28, 0x02, 0x0F, 0x90, 0x01, 0x0B, 0x4F, 0x9F, 0x9F, 0x9F, 0x98, 0xC8, 0x00,
+  0x13, 0x40, 0xFB, 0xFA, 0xFA, 0xFA, 0xC8, 0x00, 0xD4, 0xF8, 0xF8, 0xF7, 0xF7, 0xF6, 0xF5, 0xF5,
+  0xF4, 0xF2, 0xF2, 0xF4, 0xF5, 0xF8, 0x64, 0x00, 0x6F, 0x60, 0x5B, 0x59, 0x69, 0x6A, 0x6D, 0xC8,
+  0x00, 0x03, 0x47, 0x1D, 0x07, 0x0F, 0x07, 0x30, 0x11, 0x08, 0xEB, 0x14, 0x00, 0xD3, 0x1C, 0x30,
+  0x1A, 0x18, 0x16, 0xDA, 0x72, 0x10, 0x12, 0xBD, 0x3D, 0x01, 0xC7, 0x59, 0x4F, 0x1B, 0x14, 0x16,
+  0x04, 0x68, 0x29, 0x0F, 0x0F, 0xC8, 0x00, 0x27, 0x00, 0x8B, 0x01, 0x43, 0xF4, 0xF3, 0xF2, 0xF1,
+  0x01, 0x00, 0x45, 0xF0, 0xF0, 0xF1, 0xF4, 0xC8, 0x00, 0x3F, 0x62, 0x5B, 0x5B, 0x62, 0x09, 0x04,
+  0x86, 0x1D, 0x1D, 0x15, 0x0F, 0x0F, 0x17, 0x19, 0x19, 0xF8, 0x11, 0x16, 0x00, 0xC9, 0x00, 0x30,
+  0x08, 0x27, 0x0C, 0x7B, 0x92, 0x10, 0x19, 0x96, 0x68, 0x40, 0x17, 0x08, 0x1D, 0x1F, 0xF5, 0x11,
+  0x00, 0x24, 0x12, 0x4F, 0x19, 0x04, 0x2A, 0x1D, 0x28, 0x23, 0x0C, 0x0F, 0xC8, 0x00, 0x26, 0x51,
+  0xFD, 0xF9, 0xFC, 0xFB, 0xFB, 0x93, 0x01, 0x21, 0xF7, 0xF8, 0x91, 0x01, 0x26, 0xF3, 0xF2, 0xC8,
+  0x00, 0x4F, 0x68, 0x61, 0x62, 0x6C, 0x86, 0x1E, 0x02, 0x00, 0x8E, 0x01, 0x10, 0x0F, 0x29, 0x1C,
+  0x16, 0x1A, 0x18, 0x15, 0x06, 0xC9, 0x00, 0x29, 0x1C, 0x37, 0x00, 0x19, 0x25, 0x1B, 0x14, 0x80,
+  0x0C, 0x34, 0x2A, 0x2D, 0x08, 0x70, 0x69, 0x0F, 0xC8, 0x00, 0x09, 0x03, 0x1B, 0x03, 0x0F, 0xC8,
+  0x00, 0x1A, 0x24, 0xFA, 0xFC, 0xC9, 0x00, 0x00, 0x9A, 0x01, 0x01, 0xC9, 0x00, 0x05, 0xC8, 0x00,
+  0x32, 0x6B, 0x68, 0x68, 0xC7, 0x00, 0x02, 0xBF, 0x63, 0x02, 0xC1, 0x7F, 0x02, 0x1B, 0x00, 0x02,
+  0x80, 0x04, 0x35, 0x1A, 0x07, 0x08, 0xC8, 0x00, 0x23, 0x1A, 0x00, 0xC0, 0x87, 0x0C, 0x20, 0x35,
+  0x16, 0x17, 0x20, 0x35, 0x69, 0x2D, 0x2D, 0x1D, 0x00, 0x07, 0x0C, 0x37, 0x2A, 0x0F, 0xC8, 0x00,
+  0x0D, 0x1F, 0x99, 0xC8, 0x00, 0x14, 0x24, 0xFB, 0xFD, 0xC9, 0x00, 0x01, 0xEE, 0x03, 0x27, 0xF5,
+  0xF5, 0xC8, 0x00, 0x04, 0xB8, 0x0B, 0x01, 0x3E, 0x96, 0x0F, 0x97, 0x01, 0x02, 0x35, 0x1D, 0x18,
+  0x00, 0xC8, 0x00, 0x31, 0x1A, 0x00, 0x2D, 0x13, 0x00, 0x2F, 0x1E, 0x27, 0x90, 0x1A, 0x06, 0x78,
+  0x1A, 0x2D, 0x1D, 0x08, 0x1B, 0x18, 0x37, 0x01, 0x12, 0x0F, 0xC8, 0x00, 0x01, 0x11, 0x4E, 0xC7,
+  0x00, 0x1F, 0x4E, 0xC8, 0x00, 0x17, 0x10, 0x9A, 0xB8, 0xB6, 0x30, 0x9D, 0x99, 0x9B, 0xF8, 0x66,
+  0x00, 0x3C, 0xB1, 0x67, 0x9E, 0x9E, 0x00, 0x9F, 0x9E, 0x9C, 0x62, 0x09, 0x02, 0x01, 0x00, 0x34,
+  0x13, 0x18, 0x07, 0xE0, 0x15, 0x3A, 0x22, 0x04, 0x13, 0x5C, 0x21, 0x25, 0x08, 0x00, 0xC8, 0x00,
+  0x02, 0x22, 0x06, 0x3F, 0x1F, 0x1F, 0x37, 0x20, 0x35, 0x07, 0x00, 0xCE, 0x1D, 0x00, 0x2F, 0x03,
+  0x0F, 0xC8, 0x00, 0x0B, 0x11, 0x4C, 0xC8, 0x00, 0x1F, 0x4C, 0xC8, 0x00, 0x18, 0x10, 0x9F, 0x3F,
+  0xB8, 0x10, 0x9C, 0xC0, 0x67, 0x00, 0xB8, 0x4B, 0x41, 0x9C, 0x9D, 0x9F, 0x00, 0xAC, 0x41, 0x0B,
+  0xC8, 0x00, 0x24, 0x17, 0x0F, 0xC8, 0x00, 0x2E, 0x08, 0x13, 0x0B, 0x26, 0x15, 0x00, 0xC8, 0x00,
+  0x03, 0x7B, 0x1E, 0x02, 0x10, 0x0E, 0x0F, 0xB0, 0x68, 0x00, 0x01, 0x6F, 0x17, 0x38, 0x1F, 0x08,
+  0x17, 0x0B, 0x01, 0x0E, 0xC8, 0x00, 0x70, 0x4D, 0x4B, 0x4B, 0x4B, 0x4F, 0x9F, 0x4F, 0x04, 0x07,
+  0x4F, 0x9F, 0x9F, 0x9F, 0x9A, 0xC8, 0x00, 0x10, 0x01, 0x65, 0x10, 0x00, 0x98, 0x81, 0xB0, 0x00,
+  0x9D, 0x9D, 0x1F, 0x9F, 0x9E, 0x96, 0x9D, 0x99, 0x9C, 0x9F, 0x2A, 0x0A, 0x1C, 0x1F, 0x7F, 0x3E,
+  0x22, 0x0F, 0x18, 0xC8, 0x00, 0x3F, 0x00, 0x0F, 0x07, 0x4A, 0x17, 0x00, 0x13, 0x00, 0xC8, 0x00,
+  0x11, 0x17, 0xE4, 0x00, 0x28, 0x12, 0x0F, 0xC8, 0x00, 0x0E, 0x20, 0x35, 0x1A, 0x1F, 0x0C, 0x01,
+  0x0E, 0xC8, 0x00, 0x06, 0xB1, 0x04, 0x1F, 0x4F, 0xC8, 0x00, 0x15, 0x00, 0x84, 0xAF, 0x02, 0xCB,
+  0x9D, 0x02, 0x08, 0x72, 0x23, 0x1F, 0x1F, 0x48, 0x87, 0x0B, 0xAA, 0x00, 0x14, 0x07, 0xC8, 0x00,
+  0xF0, 0x02, 0x07, 0x08, 0x2F, 0x2E, 0x2C, 0x2A, 0x28, 0x04, 0x24, 0x23, 0x20, 0x37, 0x35, 0x35,
+  0x0C, 0x0C, 0x33, 0xA1, 0x08, 0x22, 0x13, 0x1A, 0xC8, 0x00, 0x03, 0x4F, 0x82, 0x07, 0x58, 0x1B,
+  0x00, 0xB0, 0x68, 0x07, 0x20, 0x35, 0x00, 0x75, 0x14, 0x39, 0x1F, 0x00, 0x18, 0x9A, 0x02, 0x0F,
+  0xC8, 0x00, 0x00, 0x13, 0x4E, 0xC7, 0x00, 0x01, 0x27, 0x03, 0x0F, 0xC8, 0x00, 0x11, 0xA0, 0x1C,
+  0x1F, 0x9F, 0x9C, 0x9D, 0x00, 0x9B, 0x00, 0x9E, 0x9F, 0x16, 0x0E, 0x60, 0x9B, 0x9D, 0x9A, 0x1F,
+  0x9C, 0x1F, 0x3B, 0xC4, 0x1C, 0x9F, 0x21, 0x03, 0x13, 0x07, 0xC8, 0x19, 0x07, 0x12, 0x1C, 0x01,
+  0x3C, 0x35, 0x02, 0xA2, 0x8A, 0x00, 0x1D, 0x86, 0x44, 0x19, 0x19, 0x1A, 0x0C, 0xD1, 0x24, 0x41,
+  0x07, 0x0F, 0x0C, 0x35, 0x97, 0x05, 0x00, 0x4A, 0x89, 0x00, 0xB3, 0x8A, 0x30, 0x33, 0x33, 0x33,
+  0x51, 0x78, 0x02, 0x87, 0x01, 0x1A, 0x08, 0x61, 0x03, 0x0F, 0xC8, 0x00, 0x00, 0x30, 0x9F, 0x4E,
+  0x4C, 0x55, 0x02, 0x02, 0xEE, 0x03, 0x0F, 0xC8, 0x00, 0x11, 0x00, 0x43, 0x55, 0x13, 0x9F, 0x8D,
+  0x98, 0x00, 0x01, 0x00, 0x13, 0x9E, 0x9B, 0x01, 0x0D, 0x90, 0x01, 0x2C, 0x17, 0x1C, 0xC8, 0x19,
+  0x3B, 0x00, 0x19, 0x15, 0x58, 0x1B, 0x04, 0x8F, 0x01, 0x01, 0x88, 0x08, 0x10, 0x35, 0x81, 0x02,
+  0x10, 0x19, 0x41, 0x78, 0x13, 0x07, 0xD0, 0x07, 0x23, 0x04, 0x08, 0xE7, 0x35, 0x1A, 0x19, 0x28,
+  0x04, 0x0F, 0xC8, 0x00, 0x01, 0x08, 0x01, 0x00, 0x1F, 0x9B, 0xC8, 0x00, 0x10, 0x21, 0x9A, 0x9F,
+  0xA8, 0x0B, 0x50, 0x9A, 0x00, 0x1F, 0x9D, 0x9B, 0x89, 0x1A, 0x20, 0x9D, 0x9C, 0x8C, 0x0D, 0x27,
+  0x9C, 0x9B, 0xBB, 0x0B, 0x02, 0x01, 0x00, 0x2C, 0x18, 0x1D, 0xC8, 0x00, 0x10, 0x19, 0xA6, 0x6B,
+  0x09, 0xC8, 0x00, 0x17, 0x0C, 0xA0, 0x00, 0x00, 0x35, 0xA3, 0x0B, 0x43, 0x00, 0x3F, 0x00, 0x04,
+  0x0C, 0x20, 0x35, 0x10, 0x0F, 0xC8, 0x00, 0x22, 0x10, 0x1B, 0x23, 0x51, 0x34, 0x9E, 0x9C, 0x9D,
+  0x17, 0x15, 0x08, 0x01, 0x00, 0x0B, 0x6D, 0x00, 0x1E, 0x1E, 0x58, 0x1B, 0x01, 0x1D, 0x6A, 0x08,
+  0xC8, 0x00, 0x06, 0xA9, 0x07, 0x00, 0x4E, 0x02, 0x0B, 0xAF, 0x00, 0x00, 0xA8, 0x48, 0x0F, 0xF1,
+  0x0A, 0x02, 0x0B, 0xC8, 0x00, 0x0D, 0x01, 0x00, 0x0F, 0xC7, 0x00, 0x02, 0x0A, 0xC8, 0x00, 0x02,
+  0x7D, 0x0C, 0x20, 0x1F, 0x9E, 0x99, 0x81, 0x01, 0xB2, 0xB6, 0x60, 0x9A, 0x9B, 0x9C, 0x97, 0x00,
+  0x1F, 0x25, 0x03, 0x0B, 0xCC, 0x19, 0x1F, 0x1A, 0xC8, 0x00, 0x10, 0x15, 0x2A, 0x15, 0x06, 0x0F,
+  0xA8, 0x48, 0x06, 0x0F, 0xC8, 0x32, 0x17, 0x0F, 0x01, 0x00, 0x0D, 0x09, 0xC8, 0x00, 0x12, 0x1D,
+  0xCC, 0xBC, 0x00, 0x4F, 0x1B, 0x01, 0xF1, 0xBC, 0x00, 0x1B, 0x87, 0x01, 0x57, 0xC0, 0x17, 0x9E,
+  0x47, 0x62, 0x02, 0x9A, 0x00, 0x1F, 0x1F, 0xC8, 0x00, 0x0F, 0x15, 0x1C, 0xC9, 0x00, 0x0B, 0xA8,
+  0x48, 0x2F, 0x0C, 0x0C, 0xA8, 0x48, 0x1A, 0x03, 0x01, 0x00, 0x00, 0xBB, 0x12, 0x0F, 0x88, 0x13,
+  0x08, 0x08, 0xE8, 0x1C, 0x30, 0x9A, 0x9F, 0x1F, 0xAA, 0x04, 0x30, 0x9D, 0x9B, 0x9D, 0x9E, 0x0F,
+  0x01, 0xD3, 0x07, 0x02, 0x1F, 0xC1, 0x0D, 0xC0, 0x44, 0x0D, 0xC8, 0x00, 0x1E, 0x1E, 0xC8, 0x00,
+  0x25, 0x1A, 0x2C, 0x91, 0x01, 0x08, 0xA8, 0x48, 0x1F, 0x1F, 0xA8, 0x48, 0x1D, 0x06, 0xC8, 0x00,
+  0x0F, 0x70, 0x17, 0x09, 0x09, 0xC8, 0x00, 0x10, 0x9D, 0xEF, 0xBC, 0x21, 0x9B, 0x9B, 0x97, 0xB3,
+  0x80, 0x9C, 0x9C, 0x9C, 0x00, 0x9F, 0x9E, 0x9B, 0x9B, 0x3B, 0x11, 0x16, 0x9F, 0xDB, 0x0E, 0x03,
+  0x99, 0x00, 0x09, 0xE8, 0x03, 0x11, 0x2F, 0xDD, 0x06, 0x0D, 0xC8, 0x00, 0x23, 0x1A, 0x2C, 0xA6,
+  0x00, 0x0F, 0xA8, 0x48, 0x2A, 0x05, 0x48, 0x14, 0x00, 0x05, 0x00, 0x0F, 0xC8, 0x00, 0x08, 0x06,
+  0x08, 0x20, 0x14, 0x1B, 0xC6, 0x6F, 0x00, 0x4F, 0x46, 0x00, 0x86, 0x01, 0x10, 0x00, 0x10, 0x00,
+  0x0F, 0xE8, 0x03, 0x02, 0x18, 0x1C, 0xC8, 0x00, 0x11, 0x2E, 0x8F, 0x01, 0x0F, 0xC8, 0x00, 0x00,
+  0x22, 0x0F, 0x0F, 0x02, 0x8A, 0x0F, 0xA8, 0x48, 0x08, 0x0F, 0xB0, 0x1D, 0x12, 0x0F, 0x88, 0x01,
+  0x08, 0x05, 0xC8, 0x00, 0x07, 0xCF, 0x20, 0x40, 0x1C, 0x9F, 0x9B, 0x9F, 0x87, 0x1A, 0x00, 0x40,
+  0x58, 0x02, 0x93, 0x01, 0x70, 0x9A, 0x9C, 0x00, 0x9F, 0x9D, 0x9F, 0x9B, 0xD3, 0x00, 0x0A, 0x91,
+  0x01, 0x02, 0xC8, 0x00, 0x06, 0xF0, 0x7F, 0x01, 0x06, 0x07, 0x02, 0x3A, 0xA9, 0x01, 0x55, 0x00,
+  0x01, 0xC8, 0x00, 0x12, 0x0F, 0x51, 0x6D, 0x1F, 0x1F, 0xA8, 0x48, 0x09, 0x0E, 0xD5, 0x08, 0x0F,
+  0xA6, 0x00, 0x01, 0x01, 0xC7, 0x00, 0x0F, 0x00, 0x19, 0x0A, 0x08, 0xB8, 0x24, 0x40, 0x1D, 0x1F,
+  0x9F, 0x9D, 0x4A, 0x02, 0x00, 0xAA, 0xC4, 0x00, 0x56, 0x09, 0x40, 0x9C, 0x9B, 0x9B, 0x9C, 0x1E,
+  0x03, 0x20, 0x9C, 0x9D, 0xA3, 0x01, 0x0B, 0x6F, 0x00, 0x02, 0x10, 0x27, 0x10, 0x0F, 0x2F, 0x22,
+  0x00, 0xB0, 0x0A, 0x30, 0x04, 0x24, 0x21, 0xA9, 0x1D, 0x52, 0x32, 0x31, 0x31, 0x30, 0x0F, 0xC8,
+  0x00, 0x13, 0x1B, 0xC7, 0x00, 0x0F, 0xA8, 0x48, 0x2E, 0x09, 0xCC, 0x00, 0x0F, 0xC8, 0x00, 0x08,
+  0x05, 0x0C, 0x00, 0x10, 0x9A, 0x2B, 0x79, 0x00, 0x01, 0x00, 0x21, 0x9C, 0x9E, 0xC8, 0x00, 0x21,
+  0x9F, 0x9F, 0xC8, 0x00, 0x00, 0xDA, 0x87, 0x1F, 0x9B, 0xC8, 0x00, 0x03, 0x1F, 0x35, 0x19, 0x02,
+  0x01, 0x13, 0x07, 0xC8, 0x00, 0x04, 0x15, 0x7C, 0x0F, 0xA8, 0x48, 0x2C, 0x07, 0x20, 0x03, 0x0F,
+  0x90, 0x01, 0x08, 0x08, 0x10, 0x27, 0x01, 0xAD, 0x0B, 0x01, 0xF1, 0x0A, 0x22, 0x9F, 0x9B, 0xC8,
+  0x00, 0x25, 0x9D, 0x9C, 0x39, 0x02, 0x0A, 0x58, 0x02, 0x14, 0x1E, 0x20, 0x03, 0x0E, 0x32, 0x30,
+  0x21, 0x1B, 0x07, 0x9A, 0x96, 0x25, 0x19, 0x1C, 0x5E, 0x14, 0x0F, 0xA8, 0x48, 0x08, 0x0F, 0xC0,
+  0x2B, 0x13, 0x0F, 0x20, 0x03, 0x10, 0x08, 0xC8, 0x00, 0x30, 0x99, 0x9D, 0x9C, 0x3C, 0x06, 0x61,
+  0x9C, 0x00, 0x9D, 0x9A, 0x9A, 0x9C, 0x03, 0x00, 0x00, 0xA2, 0x08, 0x02, 0xA4, 0x01, 0x0B, 0x90,
+  0x01, 0x05, 0xC8, 0x00, 0x1C, 0x22, 0x6A, 0x2F, 0x33, 0x1B, 0x07, 0x1B, 0x68, 0x10, 0x06, 0x19,
+  0x00, 0x06, 0xA8, 0x48, 0x00, 0x8C, 0x96, 0x0F, 0xA8, 0x48, 0x1C, 0x00, 0x86, 0x01, 0x04, 0x8F,
+  0x01, 0x0F, 0x91, 0x01, 0x09, 0x05, 0x01, 0x00, 0x40, 0x1B, 0x9D, 0x9D, 0x9C, 0x47, 0x0D, 0x11,
+  0x00, 0x92, 0x01, 0x03, 0x21, 0x8A, 0x20, 0x00, 0x9D, 0x49, 0x51, 0x01, 0x72, 0xC5, 0x08, 0x6D,
+  0x00, 0x16, 0x1F, 0xB0, 0x04, 0x0A, 0x23, 0x22, 0x32, 0x1B, 0x17, 0x08, 0x7A, 0xAC, 0x18, 0x19,
+  0xEE, 0x15, 0x0F, 0xA8, 0x48, 0x2A, 0x07, 0xD3, 0x00, 0x0F, 0x98, 0x01, 0x10, 0x00, 0xAF, 0x04,
+  0x01, 0xA7, 0x8B, 0x10, 0x9B, 0xDB, 0x03, 0x08, 0x1E, 0x60, 0x10, 0x00, 0xA6, 0x08, 0x0B, 0xBB,
+  0x0B, 0x07, 0xC8, 0x00, 0x11, 0x26, 0xAD, 0x0F, 0x00, 0x0A, 0x9F, 0x01, 0xCE, 0xB0, 0x23, 0x08,
+  0x19, 0x78, 0x05, 0x16, 0x1D, 0xA5, 0x00, 0x0F, 0xA8, 0x48, 0x2B, 0x0F, 0x87, 0x01, 0x14, 0x05,
+  0x01, 0x00, 0x08, 0x02, 0x90, 0x02, 0xEF, 0x03, 0x52, 0x9C, 0x9D, 0x9F, 0x9E, 0x9C, 0x43, 0x1F,
+  0x0D, 0x42, 0x06, 0x07, 0x40, 0x06, 0x05, 0x7C, 0x05, 0x00, 0xCA, 0x47, 0x14, 0x18, 0x40, 0x06,
+  0x15, 0x18, 0x5E, 0x2D, 0x00, 0x32, 0x15, 0x0F, 0xA8, 0x48, 0x27, 0x09, 0xA8, 0x04, 0x0F, 0xD1,
+  0x00, 0x11, 0x30, 0x9A, 0x9E, 0x1F, 0x54, 0xC6, 0x41, 0x9A, 0x99, 0x9B, 0x9A, 0x5B, 0x02, 0x91,
+  0x9E, 0x9E, 0x9F, 0x9E, 0x9B, 0x9E, 0x9E, 0x9A, 0x00, 0xD2, 0x00, 0x0C, 0x6C, 0x10, 0x0F, 0x80,
+  0x0C, 0x0E, 0x16, 0x13, 0x13, 0x31, 0x0F, 0xA8, 0x48, 0x2B, 0x07, 0xAF, 0x04, 0x0F, 0x99, 0x01,
+  0x12, 0x40, 0x9A, 0x9F, 0x9D, 0x1F, 0x1B, 0x91, 0x31, 0x9D, 0x9D, 0x9C, 0x3E, 0x0D, 0x00, 0x6A,
+  0x09, 0x00, 0x96, 0x01, 0x10, 0x00, 0x57, 0x06, 0x0C, 0x86, 0x25, 0x3F, 0x15, 0x0F, 0x11, 0x80,
+  0x0C, 0x0B, 0x18, 0x13, 0xD7, 0x27, 0x0F, 0xA8, 0x48, 0x2B, 0x08, 0xD4, 0x00, 0x0F, 0xC7, 0x00,
+  0x0F, 0x10, 0x1B, 0xD8, 0x5C, 0x72, 0x9D, 0x9E, 0x9A, 0x9F, 0x9A, 0x9A, 0x9C, 0xAD, 0x93, 0x02,
+  0xF0, 0x03, 0x10, 0x9D, 0xC9, 0x00, 0x00, 0xD6, 0x07, 0x09, 0xC9, 0x00, 0x5F, 0x1C, 0x07, 0x13,
+  0x12, 0x0C, 0xF0, 0x0A, 0x09, 0x08, 0x1B, 0x06, 0x0F, 0xA8, 0x48, 0x2A, 0x0F, 0x88, 0x01, 0x16,
+  0x03, 0x01, 0x00, 0x22, 0x1C, 0x1E, 0x7D, 0x90, 0x00, 0x9B, 0x04, 0x03, 0x1E, 0x1C, 0x00, 0x8A,
+  0xBE, 0x11, 0x9B, 0xB7, 0x9F, 0x01, 0xF4, 0x1C, 0x0A, 0x70, 0x00, 0x3F, 0x1C, 0x07, 0x14, 0xC8,
+  0x00, 0x08, 0x08, 0x8F, 0x01, 0x0F, 0xA8, 0x48, 0x2B, 0x04, 0x20, 0x03, 0x0F, 0xD0, 0x00, 0x15,
+  0x21, 0x1C, 0x1E, 0xEA, 0x7F, 0x11, 0x9F, 0x92, 0xD4, 0x30, 0x1F, 0x9D, 0x9F, 0xAA, 0x1D, 0x61,
+  0x9D, 0x1F, 0x9E, 0x9F, 0x9C, 0x00, 0xFA, 0x11, 0x1D, 0x9E, 0xB4, 0x4F, 0x21, 0x1C, 0x07, 0x26,
+  0x91, 0x0F, 0xC8, 0x00, 0x03, 0x07, 0x8F, 0x01, 0x0F, 0xA8, 0x48, 0x2D, 0x04, 0xBF, 0x00, 0x0F,
+  0x95, 0x01, 0x14, 0x11, 0x9B, 0x4B, 0x14, 0x01, 0xF6, 0x11, 0x01, 0x1E, 0x03, 0x41, 0x00, 0x9D,
+  0x1F, 0x9E, 0xB3, 0x4F, 0x06, 0x41, 0x99, 0x0D, 0x73, 0x00, 0x1F, 0x1A, 0x80, 0x0C, 0x05, 0x08,
+  0x9E, 0x28, 0x0F, 0xA8, 0x48, 0x2F, 0x05, 0xCF, 0x00, 0x0F, 0xCB, 0x00, 0x11, 0x01, 0x03, 0x7C,
+  0x00, 0x68, 0x50, 0x03, 0x24, 0x11, 0x00, 0xCC, 0x00, 0x26, 0x1F, 0x9F, 0x3A, 0x95, 0x0D, 0x1D,
+  0x15, 0x00, 0x93, 0x01, 0x11, 0x28, 0xC8, 0x00, 0x1D, 0x2E, 0x80, 0x0C, 0x08, 0xCB, 0x11, 0x0F,
+  0xA8, 0x48, 0x2D, 0x0F, 0x20, 0x03, 0x1B, 0x00, 0x4B, 0x14, 0x63, 0x9E, 0x9D, 0x9C, 0x00, 0x9C,
+  0x9E, 0x65, 0xCD, 0x02, 0x01, 0x00, 0x01, 0x28, 0x05, 0x00, 0x71, 0x02, 0x0E, 0x21, 0x03, 0x01,
+  0xC0, 0x48, 0x03, 0x80, 0x0C, 0x00, 0x6D, 0x08, 0x07, 0xC8, 0x00, 0x0A, 0x72, 0x85, 0x0F, 0xA8,
+  0x48, 0x2B, 0x05, 0x3B, 0x06, 0x0F, 0x1F, 0x03, 0x15, 0x01, 0x86, 0x93, 0x12, 0x00, 0xFA, 0x51,
+  0x00, 0xD8, 0x0E, 0x11, 0x9F, 0xD0, 0x20, 0x10, 0x9E, 0xE9, 0x1C, 0x00, 0x4E, 0x06, 0x2F, 0x1F,
+  0x9E, 0xD2, 0x4B, 0x00, 0x08, 0xCD, 0x49, 0x02, 0xCE, 0xA9, 0x79, 0x19, 0x18, 0x07, 0x17, 0x14,
+  0x0F, 0x13, 0x30, 0x02, 0x0B, 0xA8, 0x48, 0x01, 0xD8, 0x8B, 0x1F, 0x04, 0xA8, 0x48, 0x16, 0x06,
+  0xC1, 0x00, 0x0F, 0x98, 0x08, 0x11, 0x00, 0xD8, 0xAF, 0x00, 0x47, 0x02, 0x01, 0xB7, 0x00, 0x01,
+  0xF0, 0x03, 0x00, 0x87, 0x13, 0x01, 0x13, 0x0E, 0x04, 0x97, 0x13, 0x0F, 0x00, 0x2B, 0x01, 0x00,
+  0x10, 0x9B, 0x00, 0xAF, 0x03, 0x01, 0x88, 0xA0, 0x30, 0x08, 0x1A, 0x18, 0x9D, 0x00, 0x00, 0x19,
+  0x15, 0x0A, 0x26, 0x00, 0x0F, 0xA8, 0x48, 0x2D, 0x0A, 0xCF, 0x00, 0x0F, 0x01, 0x00, 0x0A, 0x11,
+  0x9A, 0x68, 0xCC, 0x00, 0xA0, 0x0F, 0x00, 0x86, 0x13, 0x00, 0x81, 0x13, 0x10, 0x9B, 0x82, 0x25,
+  0x02, 0xB2, 0x0F, 0x30, 0x9A, 0x9A, 0x99, 0x4A, 0x1F, 0x0F, 0x76, 0x00, 0x00, 0x0F, 0x01, 0x00,
+  0x14, 0x3D, 0x1A, 0x08, 0x18, 0xC3, 0x27, 0x0F, 0xA8, 0x48, 0x15, 0x0F, 0x3F, 0x06, 0x1B, 0x40,
+  0x9A, 0x1F, 0x9E, 0x9A, 0xF3, 0xC3, 0x00, 0xF5, 0x11, 0x10, 0x00, 0x49, 0x06, 0x01, 0x4C, 0xD1,
+  0x02, 0x8B, 0xCC, 0x11, 0x9E, 0x06, 0x5D, 0x0F, 0xC8, 0x00, 0x29, 0x2F, 0x1D, 0x08, 0x85, 0x3B,
+  0x10, 0x02, 0x01, 0x00, 0x0D, 0xC7, 0x00, 0x03, 0x05, 0x00, 0x0F, 0xB0, 0x04, 0x13, 0x00, 0x4B,
+  0x14, 0x10, 0x9F, 0xE9, 0x03, 0x31, 0x9D, 0x9C, 0x9A, 0x03, 0x07, 0x21, 0x9F, 0x9E, 0xAC, 0x8B,
+  0x01, 0xE8, 0x95, 0x01, 0xC9, 0x04, 0x00, 0x29, 0x15, 0x0F, 0x8C, 0x00, 0x15, 0x0F, 0x01, 0x00,
+  0x29, 0x0F, 0xA5, 0x00, 0x08, 0x0F, 0x20, 0x03, 0x10, 0x11, 0x1C, 0x85, 0x08, 0x00, 0xB7, 0x07,
+  0x0F, 0x16, 0x15, 0x02, 0x02, 0x01, 0x00, 0x0F, 0xA3, 0x53, 0x30, 0x0F, 0x01, 0x00, 0x0F, 0x0F,
+  0xC2, 0x00, 0x04, 0x05, 0x50, 0x0D, 0x0F, 0x01, 0x00, 0x0B, 0x00, 0x43, 0x0C, 0x01, 0x02, 0x67,
+  0x60, 0x1F, 0x9D, 0x9B, 0x1F, 0x1F, 0x00, 0x3D, 0x5C, 0x01, 0x02, 0x00, 0x00, 0x7E, 0x6D, 0x10,
+  0x99, 0x64, 0xD4, 0x10, 0x00, 0xEB, 0x6B, 0x0F, 0x9F, 0x00, 0x28, 0x0F, 0xA6, 0x2C, 0x06, 0x0C,
+  0x01, 0x00, 0x0D, 0xC3, 0x00, 0x0F, 0x40, 0x06, 0x1A, 0x0B, 0x0B, 0xA0, 0x01, 0x75, 0x30, 0x00,
+  0x31, 0x23, 0x5F, 0x9A, 0x9C, 0x9B, 0x9B, 0x99, 0x90, 0x01, 0x2E, 0x3F, 0x2B, 0x2B, 0x2B, 0xC8,
+  0x00, 0x26, 0x02, 0xCD, 0x00, 0x0F, 0xD0, 0x00, 0x14, 0x30, 0x1A, 0x9B, 0x9D, 0xB4, 0x00, 0x02,
+  0x4C, 0x66, 0x51, 0x9C, 0x9D, 0x00, 0x9D, 0x9F, 0x8F, 0x33, 0x02, 0xD2, 0xCE, 0x41, 0x9B, 0x00,
+  0x9D, 0x9E, 0x18, 0x59, 0x0F, 0xE9, 0x03, 0x29, 0x0F, 0xC8, 0x00, 0x2B, 0x0F, 0x18, 0x15, 0x0E,
+  0x04, 0xC8, 0x00, 0x11, 0x9E, 0x45, 0x0D, 0x00, 0x46, 0x0D, 0x10, 0x9C, 0x79, 0x05, 0x01, 0x96,
+  0x5A, 0x60, 0x9F, 0x9B, 0x9F, 0x9E, 0x9B, 0x9C, 0x4A, 0x0D, 0x00, 0x03, 0x24, 0x0F, 0x4C, 0x0D,
+  0x00, 0x0F, 0x01, 0x00, 0x42, 0x0D, 0xC0, 0x00, 0x0F, 0x58, 0x02, 0x19, 0x30, 0x1B, 0x1F, 0x9D,
+  0xEB, 0xCD, 0x10, 0x99, 0x8D, 0x01, 0x01, 0xE5, 0x71, 0x02, 0xA5, 0x04, 0x00, 0x78, 0x0C, 0x31,
+  0x9E, 0x9D, 0x9E, 0xC5, 0x12, 0x3F, 0x9D, 0x9C, 0x9A, 0xC8, 0x00, 0x26, 0x0F, 0x58, 0x02, 0x2E,
+  0x0F, 0x01, 0x00, 0x15, 0x10, 0x1C, 0x43, 0x09, 0x01, 0x95, 0x9D, 0x30, 0x9A, 0x99, 0x9C, 0xA4,
+  0x1D, 0x03, 0xFA, 0xD9, 0x02, 0x39, 0x11, 0x01, 0x88, 0x05, 0x3A, 0x9D, 0x9F, 0x9B, 0x4B, 0x0D,
+  0x0F, 0x01, 0x00, 0x1A, 0x0F, 0xC7, 0x00, 0x16, 0x0F, 0x08, 0x07, 0x2B, 0x11, 0x1D, 0xDC, 0x0A,
+  0x20, 0x9E, 0x9C, 0x3F, 0x02, 0x12, 0x9A, 0x47, 0x0D, 0x02, 0xDA, 0x03, 0x03, 0x07, 0x32, 0x20,
+  0x9F, 0x9F, 0xE4, 0x07, 0x0F, 0x62, 0x34, 0x02, 0x0F, 0x01, 0x00, 0x12, 0x0F, 0xC7, 0x00, 0x17,
+  0x0F, 0x68, 0x10, 0x0B, 0x0F, 0xC8, 0x00, 0x0E, 0x00, 0x0D, 0x0E, 0x01, 0xF3, 0x75, 0x20, 0x1F,
+  0x9F, 0x6D, 0x37, 0x20, 0x9D, 0x9F, 0x8C, 0x01, 0x00, 0xEE, 0x11, 0x31, 0x9B, 0x9B, 0x9D, 0x61,
+  0x09, 0x01, 0x20, 0x15, 0x0F, 0x90, 0x01, 0x69, 0x0F, 0x28, 0x03, 0x11, 0x22, 0x1A, 0x1E, 0xF7,
+  0x8D, 0x01, 0xA0, 0x0B, 0x00, 0x30, 0x18, 0x00, 0x31, 0x06, 0x41, 0x9F, 0x9D, 0x9C, 0x9B, 0x5F,
+  0x1B, 0x11, 0x9D, 0xE1, 0x07, 0x01, 0xFC, 0x03, 0x0F, 0xC5, 0x56, 0x24, 0x0F, 0x20, 0x03, 0x55,
+  0x1B, 0x1A, 0x4D, 0x55, 0x00, 0xDD, 0x0A, 0x20, 0x00, 0x1F, 0xC0, 0x12, 0x01, 0xBF, 0x0B, 0x02,
+  0x74, 0x10, 0x00, 0x41, 0x11, 0x0F, 0x9A, 0x08, 0x50, 0x0C, 0x9C, 0x00, 0x04, 0x88, 0x01, 0x0F,
+  0x90, 0x01, 0x11, 0x00, 0xBD, 0x32, 0x01, 0xD5, 0x0E, 0x03, 0xAB, 0xB3, 0x01, 0x47, 0x1F, 0x40,
+  0x9D, 0x1F, 0x9E, 0x9D, 0x67, 0x77, 0x01, 0xDA, 0x0E, 0x0F, 0xDC, 0x0E, 0x06, 0x0F, 0x01, 0x00,
+  0x3E, 0x0F, 0x9F, 0x00, 0x00, 0x04, 0xBF, 0x00, 0x0F, 0xF0, 0x03, 0x0E, 0x10, 0x1C, 0x33, 0x02,
+  0x01, 0xAA, 0xE4, 0x00, 0x8F, 0x21, 0x04, 0xC2, 0xB4, 0x00, 0x49, 0x5F, 0x03, 0xCB, 0xB4, 0x05,
+  0x23, 0x0E, 0x0F, 0xA9, 0x00, 0x30, 0x0F, 0x01, 0x00, 0x0C, 0x0E, 0xC5, 0x00, 0x0F, 0x90, 0x01,
+  0x16, 0x11, 0x1A, 0xAF, 0x04, 0x00, 0x93, 0x21, 0x0F, 0x22, 0x0A, 0x06, 0x00, 0x05, 0x04, 0x00,
+  0xA6, 0x0F, 0x0F, 0xA9, 0x00, 0x30, 0x0F, 0x01, 0x00, 0x0C, 0x0F, 0xAA, 0x00, 0x0A, 0x0F, 0x01,
+  0x00, 0x0B, 0x00, 0xC8, 0x00, 0x00, 0x7D, 0xA5, 0x40, 0x9C, 0x9E, 0x9B, 0x9C, 0xD6, 0x1C, 0x00,
+  0x61, 0x62, 0x02, 0xBA, 0xD6, 0x61, 0x9C, 0x9A, 0x00, 0x9C, 0x9E, 0x9D, 0x56, 0x2D, 0x30, 0x9E,
+  0x9C, 0x9E, 0xD6, 0x07, 0x0F, 0xAA, 0x00, 0x30, 0x0F, 0x01, 0x00, 0x0B, 0x0F, 0xA6, 0x00, 0x06,
+  0x0F, 0x1F, 0x03, 0x10, 0x00, 0xAF, 0x04, 0x00, 0x4E, 0x1B, 0x00, 0xD4, 0x03, 0x01, 0x7B, 0x01,
+  0x00, 0xD6, 0x0E, 0x02, 0xC5, 0xA4, 0x10, 0x00, 0xD5, 0x07, 0x03, 0x79, 0x05, 0x00, 0x99, 0x13,
+  0x0F, 0xAA, 0x00, 0x30, 0x0F, 0x01, 0x00, 0x0B, 0x0F, 0xC7, 0x00, 0x06, 0x05, 0x05, 0x00, 0x0F,
+  0x01, 0x00, 0x06, 0x03, 0x83, 0x13, 0x00, 0x0F, 0x03, 0x02, 0x9E, 0x0F, 0x02, 0xC9, 0x00, 0x01,
+  0x8C, 0x70, 0x10, 0x00, 0x83, 0x13, 0x05, 0xE8, 0x03, 0x0F, 0xA4, 0x3A, 0x02, 0x0F, 0x01, 0x00,
+  0x3B, 0x0F, 0xAA, 0x00, 0x0A, 0x0F, 0x01, 0x00, 0x0B, 0x03, 0x7D, 0x0C, 0x01, 0xA9, 0x00, 0x0E,
+  0x1B, 0x03, 0x09, 0x10, 0xC2, 0x0F, 0x4B, 0x0D, 0x4F, 0x0F, 0xA5, 0x00, 0x05, 0x0F, 0xD3, 0x07,
+  0x10, 0x37, 0x9B, 0x9E, 0x9C, 0x9D, 0x88, 0x22, 0x00, 0x9F, 0xC3, 0x0B, 0x00, 0xF0, 0x67, 0x10,
+  0x9A, 0x72, 0x10, 0x05, 0xD4, 0x90, 0x00, 0xD4, 0x0B, 0x0F, 0xAA, 0x00, 0x30, 0x0F, 0x01, 0x00,
+  0x0B, 0x0F, 0xAF, 0x00, 0x0F, 0x0F, 0x01, 0x00, 0x06, 0x10, 0x9A, 0xC1, 0x03, 0x00, 0x5F, 0x30,
+  0x00, 0x9F, 0x36, 0x00, 0xB6, 0x0B, 0x10, 0x9D, 0xAC, 0x36, 0x30, 0x9A, 0x9C, 0x9E, 0xF0, 0x8F,
+  0x00, 0xE3, 0x00, 0x01, 0x99, 0x0C, 0x3F, 0x9B, 0x9B, 0x99, 0x34, 0x11, 0x2A, 0x0F, 0x01, 0x00,
+  0x14, 0x0F, 0xC7, 0x00, 0x27, 0x10, 0x1B, 0x6C, 0x82, 0x30, 0x9F, 0x9F, 0x9E, 0x9F, 0x04, 0x02,
+  0x66, 0x10, 0x01, 0x43, 0x18, 0x02, 0x84, 0x0C, 0x01, 0x38, 0x2A, 0x01, 0xBC, 0x36, 0x00, 0x3F,
+  0x06, 0x1F, 0x9B, 0xC9, 0x00, 0x4F, 0x0F, 0xC8, 0x00, 0x2A, 0x02, 0x25, 0x0A, 0x00, 0xAF, 0x12,
+  0x03, 0xC8, 0x00, 0x00, 0x29, 0x11, 0x03, 0x7E, 0x17, 0x01, 0xBF, 0x04, 0x00, 0x00, 0x12, 0x4F,
+  0x9C, 0x9B, 0x9C, 0x9D, 0x34, 0x11, 0x4F, 0x0F, 0xC8, 0x00, 0x27, 0x02, 0x77, 0x25, 0x21, 0x9D,
+  0x9D, 0x95, 0x21, 0x02, 0xC8, 0x00, 0x0F, 0x01, 0x00, 0x04, 0x00, 0x2D, 0x0A, 0x0F, 0xAB, 0x00,
+  0x30, 0x0F, 0x01, 0x00, 0x0A, 0x0F, 0xC8, 0x00, 0x27, 0x01, 0x96, 0x28, 0x10, 0x9F, 0xFF, 0x0D,
+  0x0F, 0xF6, 0x11, 0x0A, 0x0F, 0xB1, 0x04, 0x54, 0x0F, 0xC8, 0x00, 0x27, 0x00, 0xDB, 0x15, 0x01,
+  0xBF, 0x88, 0x00, 0x39, 0x14, 0x00, 0x67, 0x1E, 0x00, 0x32, 0x1F, 0x0A, 0x5D, 0x82, 0x20, 0x00,
+  0x9E, 0x6D, 0x34, 0x2F, 0x9F, 0x9E, 0xFC, 0x11, 0x2B, 0x0F, 0x01, 0x00, 0x12, 0x0F, 0xC7, 0x00,
+  0x2A, 0x04, 0xE7, 0x9F, 0x10, 0x9E, 0xD4, 0x27, 0x03, 0x7D, 0x93, 0x01, 0x1F, 0x7C, 0x10, 0x9A,
+  0xC9, 0x12, 0x10, 0x97, 0x6A, 0x10, 0x01, 0xEF, 0x27, 0x00, 0x5C, 0x18, 0x0F, 0xAC, 0x00, 0x30,
+  0x0F, 0x01, 0x00, 0x09, 0x0F, 0xC8, 0x00, 0x26, 0x09, 0xFE, 0x8C, 0x0F, 0x01, 0x00, 0x6F, 0x0F,
+  0xC8, 0x00, 0x27, 0x0F, 0x13, 0x35, 0x02, 0x0F, 0x01, 0x00, 0x07, 0x0F, 0xAC, 0x00, 0x30, 0x0F,
+  0x01, 0x00, 0x09, 0x0F, 0xC8, 0x00, 0x28, 0x20, 0xFC, 0xFB, 0x14, 0x35, 0x0F, 0x01, 0x00, 0x13,
+  0x1F, 0xF8, 0x31, 0x75, 0x1F, 0x0F, 0x01, 0x00, 0x1B, 0x0F, 0xC8, 0x00, 0x29, 0x50, 0x1D, 0x7E,
+  0xFA, 0xFA, 0xF9, 0xF2, 0x31, 0x22, 0xF9, 0xF8, 0x1B, 0x35, 0xF1, 0x04, 0xF8, 0xF7, 0xF7, 0xF7,
+  0x1D, 0x7D, 0xF6, 0xF6, 0xF5, 0xF5, 0xF5, 0xF4, 0xF5, 0xF4, 0xF3, 0xF3, 0xF2, 0xF1, 0xF0, 0xCB,
+  0x76, 0x3F, 0xF7, 0x1D, 0x7C, 0xC8, 0x00, 0x89, 0x21, 0x7E, 0xF7, 0xDE, 0x35, 0x02, 0xAA, 0x36,
+  0x03, 0xC7, 0x00, 0x40, 0xF6, 0x7D, 0xF0, 0xF6, 0xC9, 0x00, 0x01, 0x9E, 0x77, 0x31, 0xF2, 0xF1,
+  0xF1, 0xF6, 0x79, 0x3F, 0xF6, 0x7C, 0xF2, 0xC8, 0x00, 0x88, 0x30, 0xFB, 0xFA, 0xFA, 0xA7, 0x36,
+  0x06, 0xCA, 0x00, 0x11, 0xF7, 0xAE, 0x36, 0x11, 0xF7, 0xC8, 0x00, 0x01, 0x91, 0x01, 0x42, 0xF2,
+  0xF2, 0xF1, 0xF2, 0x5C, 0x78, 0x0F, 0x58, 0x02, 0x89, 0x00, 0x47, 0x34, 0x00, 0xC7, 0x00, 0x0B,
+  0x5A, 0x02, 0x0A, 0xC9, 0x00, 0x0F, 0xC8, 0x00, 0x8F, 0x20, 0xFE, 0xFB, 0x19, 0x79, 0x00, 0x85,
+  0x53, 0x00, 0xFA, 0x38, 0x00, 0xB3, 0x00, 0x04, 0x75, 0x37, 0x05, 0x01, 0x00, 0x11, 0xF0, 0x01,
+  0x00, 0x3F, 0x7B, 0x7D, 0xF4, 0xC8, 0x00, 0x8A, 0x53, 0xFC, 0xFC, 0xF9, 0xF8, 0xFB, 0x5B, 0x02,
+  0x05, 0x94, 0x01, 0x04, 0x92, 0x01, 0x06, 0xEB, 0x03, 0x1F, 0xF2, 0xC8, 0x00, 0x92, 0x12, 0xFB,
+  0xCA, 0x00, 0x0A, 0xEE, 0x03, 0x04, 0xC9, 0x00, 0x01, 0xEB, 0x03, 0x3F, 0xF2, 0x7C, 0x7E, 0xC8,
+  0x00, 0x8D, 0x40, 0xFA, 0xF9, 0xFB, 0xFC, 0xCA, 0x00, 0x02, 0x28, 0x03, 0x04, 0x26, 0x03, 0x00,
+  0xBE, 0x7D, 0x06, 0xC9, 0x00, 0x10, 0xF3, 0xC8, 0x00, 0x1F, 0xF4, 0xC8, 0x00, 0x89, 0x51, 0xFD,
+  0xFD, 0xFA, 0xFA, 0xFC, 0xC9, 0x00, 0x06, 0xCA, 0x00, 0x03, 0xEF, 0x03, 0x06, 0x92, 0x01, 0x6F,
+  0xF3, 0xF3, 0xF3, 0x7D, 0x7E, 0xF3, 0xC8, 0x00, 0x88, 0x0F, 0x0C, 0xA9, 0x00, 0x0F, 0x01, 0x00,
+  0x64, 0x50, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x10, 0x00, 0x01, 0x00, 0x70, 0xA8, 0x00, 0xA8,
+  0x00, 0x00, 0xA8, 0xA8, 0x05, 0x00, 0x40, 0x00, 0xA8, 0xA8, 0x54, 0x0B, 0x00, 0x10, 0x54, 0x01,
+  0x00, 0x70, 0xFC, 0x54, 0xFC, 0x54, 0x54, 0xFC, 0xFC, 0x05, 0x00, 0x01, 0x07, 0x00, 0xF1, 0x67,
+  0xFC, 0xFC, 0xFC, 0xEC, 0xEC, 0xEC, 0xDC, 0xDC, 0xDC, 0xD0, 0xD0, 0xD0, 0xC0, 0xC0, 0xC0, 0xB4,
+  0xB4, 0xB4, 0xA8, 0xA8, 0xA8, 0x98, 0x98, 0x98, 0x8C, 0x8C, 0x8C, 0x7C, 0x7C, 0x7C, 0x70, 0x70,
+  0x70, 0x64, 0x64, 0x64, 0x54, 0x54, 0x54, 0x48, 0x48, 0x48, 0x38, 0x38, 0x38, 0x2C, 0x2C, 0x2C,
+  0x20, 0x20, 0x20, 0xFC, 0x00, 0x00, 0xEC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xD4, 0x00, 0x00, 0xC8,
+  0x00, 0x00, 0xBC, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x98, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x64, 0x00, 0x00, 0x58, 0x00, 0x00, 0x4C, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0xFC, 0xD8, 0xD8, 0xFC, 0xB8, 0xB8, 0xFC, 0x9C, 0x9C, 0xFC, 0x7C, 0x7C, 0xFC,
+  0x5C, 0x5C, 0xFC, 0x40, 0x40, 0xFC, 0x45, 0x00, 0xF0, 0x67, 0xFC, 0xA8, 0x5C, 0xFC, 0x98, 0x40,
+  0xFC, 0x88, 0x20, 0xFC, 0x78, 0x00, 0xE4, 0x6C, 0x00, 0xCC, 0x60, 0x00, 0xB4, 0x54, 0x00, 0x9C,
+  0x4C, 0x00, 0xFC, 0xFC, 0xD8, 0xFC, 0xFC, 0xB8, 0xFC, 0xFC, 0x9C, 0xFC, 0xFC, 0x7C, 0xFC, 0xF8,
+  0x5C, 0xFC, 0xF4, 0x40, 0xFC, 0xF4, 0x20, 0xFC, 0xF4, 0x00, 0xE4, 0xD8, 0x00, 0xCC, 0xC4, 0x00,
+  0xB4, 0xAC, 0x00, 0x9C, 0x9C, 0x00, 0x84, 0x84, 0x00, 0x70, 0x6C, 0x00, 0x58, 0x54, 0x00, 0x40,
+  0x40, 0x00, 0xD0, 0xFC, 0x5C, 0xC4, 0xFC, 0x40, 0xB4, 0xFC, 0x20, 0xA0, 0xFC, 0x00, 0x90, 0xE4,
+  0x00, 0x80, 0xCC, 0x00, 0x74, 0xB4, 0x00, 0x60, 0x9C, 0x00, 0xD8, 0xFC, 0xD8, 0xBC, 0xFC, 0xB8,
+  0x9C, 0xFC, 0x9C, 0x80, 0xFC, 0x7C, 0x60, 0xFC, 0x5C, 0x40, 0xFC, 0x40, 0x20, 0xFC, 0x20, 0x00,
+  0x79, 0x00, 0x06, 0xC1, 0x00, 0xFA, 0x15, 0x04, 0xC8, 0x00, 0x04, 0xBC, 0x00, 0x04, 0xB0, 0x00,
+  0x04, 0xA4, 0x00, 0x04, 0x98, 0x00, 0x04, 0x88, 0x00, 0x04, 0x7C, 0x00, 0x04, 0x70, 0x00, 0x04,
+  0x64, 0x00, 0x04, 0x58, 0x00, 0x04, 0x4C, 0x00, 0x04, 0x40, 0x00, 0x8E, 0x00, 0xF4, 0x04, 0xFC,
+  0x40, 0xFC, 0xFC, 0x20, 0xFC, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0xE4, 0xE4, 0x00, 0xCC, 0xCC, 0x00,
+  0xB4, 0xB4, 0x91, 0x00, 0xF0, 0x10, 0x70, 0x00, 0x58, 0x58, 0x00, 0x40, 0x40, 0x5C, 0xBC, 0xFC,
+  0x40, 0xB0, 0xFC, 0x20, 0xA8, 0xFC, 0x00, 0x9C, 0xFC, 0x00, 0x8C, 0xE4, 0x00, 0x7C, 0xCC, 0x00,
+  0x6C, 0xB4, 0x00, 0x5C, 0x9C, 0x07, 0x01, 0x11, 0xBC, 0x07, 0x01, 0x41, 0x80, 0xFC, 0x5C, 0x60,
+  0x07, 0x01, 0x4A, 0x24, 0xFC, 0x00, 0x04, 0x91, 0x00, 0x0F, 0x52, 0x01, 0x10, 0xF8, 0x21, 0x28,
+  0x28, 0x28, 0xFC, 0xE0, 0x34, 0xFC, 0xD4, 0x24, 0xFC, 0xCC, 0x18, 0xFC, 0xC0, 0x08, 0xFC, 0xB4,
+  0x00, 0xB4, 0x20, 0xFC, 0xA8, 0x00, 0xFC, 0x98, 0x00, 0xE4, 0x80, 0x00, 0xCC, 0x74, 0x00, 0xB4,
+  0x60, 0x00, 0x9C, 0x50, 0x00, 0x84, 0x44, 0x00, 0x70, 0x34, 0x00, 0x58, 0x28, 0x00, 0x40, 0x4F,
+  0x01, 0x17, 0xFC, 0xC1, 0x00, 0xF0, 0xB4, 0xE0, 0x00, 0xE4, 0xC8, 0x00, 0xCC, 0xB4, 0x00, 0xB4,
+  0x9C, 0x00, 0x9C, 0x84, 0x00, 0x84, 0x6C, 0x00, 0x70, 0x58, 0x00, 0x58, 0x40, 0x00, 0x40, 0xFC,
+  0xE8, 0xDC, 0xFC, 0xE0, 0xD0, 0xFC, 0xD8, 0xC4, 0xFC, 0xD4, 0xBC, 0xFC, 0xCC, 0xB0, 0xFC, 0xC4,
+  0xA4, 0xFC, 0xBC, 0x9C, 0xFC, 0xB8, 0x90, 0xFC, 0xB0, 0x80, 0xFC, 0xA4, 0x70, 0xFC, 0x9C, 0x60,
+  0xF0, 0x94, 0x5C, 0xE8, 0x8C, 0x58, 0xDC, 0x88, 0x54, 0xD0, 0x80, 0x50, 0xC8, 0x7C, 0x4C, 0xBC,
+  0x78, 0x48, 0xB4, 0x70, 0x44, 0xA8, 0x68, 0x40, 0xA0, 0x64, 0x3C, 0x9C, 0x60, 0x38, 0x90, 0x5C,
+  0x34, 0x88, 0x58, 0x30, 0x80, 0x50, 0x2C, 0x74, 0x4C, 0x28, 0x6C, 0x48, 0x24, 0x5C, 0x40, 0x20,
+  0x54, 0x3C, 0x1C, 0x48, 0x38, 0x18, 0x40, 0x30, 0x18, 0x38, 0x2C, 0x14, 0x28, 0x20, 0x0C, 0x60,
+  0x00, 0x64, 0x00, 0x64, 0x64, 0x00, 0x60, 0x60, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x2C, 0x30, 0x24,
+  0x10, 0x48, 0x00, 0x48, 0x50, 0x00, 0x50, 0x00, 0x00, 0x34, 0x1C, 0x1C, 0x1C, 0x4C, 0x4C, 0x4C,
+  0x5C, 0x5C, 0x5C, 0x40, 0x40, 0x40, 0x30, 0x30, 0x30, 0x34, 0x34, 0x34, 0xD8, 0xF4, 0xF4, 0xB8,
+  0xE8, 0xE8, 0x9C, 0xDC, 0xDC, 0x74, 0xC8, 0xC8, 0x48, 0xC0, 0xC0, 0x20, 0xB4, 0xB4, 0x20, 0xB0,
+  0xB0, 0x00, 0xA4, 0xA4, 0x00, 0x98, 0x98, 0x00, 0x8C, 0x8C, 0x77, 0x01, 0xF0, 0x02, 0x7C, 0x7C,
+  0x00, 0x78, 0x78, 0x00, 0x74, 0x74, 0x00, 0x70, 0x70, 0x00, 0x6C, 0x6C, 0x98, 0x00, 0x88, 0x00,
+};
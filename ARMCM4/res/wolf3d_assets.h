@@ -0,0 +1,12 @@
+/* Generated by assetpack.py, do not edit manually.*/
+
+#ifndef _WOLF3D_ASSETS_H_
+#define _WOLF3D_ASSETS_H_
+
+#define ASSET_SPLASH                   0
+#define ASSET_PALETTE                  1
+
+#define wolf3d_assets_size 22464
+extern const uint8_t wolf3d_assets[22464];
+
+#endif /* _WOLF3D_ASSETS_H_ */
@@ -1,4005 +0,0 @@
-/* Generated by bin2c, do not edit manually */
-
-/* Contents of file chunk87.bin */
-const unsigned char wolf3d_vgagraph_chunk87[64000] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x1F, 0x1F, 0x9E, 0x9E, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x9D, 0x9D, 0xE9, 0xE9, 0x9E, 0x9E, 0xE9, 0xE9, 0x9D, 0x9D, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F,
-    0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9C, 0x9C,
-    0x9E, 0x9E, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x00, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9E,
-    0x9E, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x00, 0x00, 0x00, 0x9E, 0x9E, 0x1F,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F,
-    0xE9, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x00,
-    0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0x00, 0x00, 0xE8, 0xE9,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0x00,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0x00,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0x9E, 0x9E, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x00, 0x00, 0x00, 0x9E, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xE9, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0xE8, 0xE9,
-    0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00,
-    0xE9, 0xE8, 0xE8, 0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9,
-    0x9F, 0x9F, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x00, 0xE9, 0xE9, 0xE9, 0x00,
-    0x00, 0xE9, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9E,
-    0x9E, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x00,
-    0x00, 0x00, 0x00, 0xE9, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8,
-    0xE8, 0xE8, 0xE9, 0xE9, 0xE8, 0xE8, 0x9C, 0x9C, 0x9F, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0xE9,
-    0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0x9C, 0x9C,
-    0x9F, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x1F, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9D, 0x9C, 0x9C, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9E,
-    0xE8, 0x00, 0x00, 0xE8, 0xE8, 0x9E, 0x9E, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x1E, 0x00,
-    0x00, 0x1F, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E,
-    0x9E, 0x9F, 0x9F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E,
-    0x9C, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9E, 0xE8, 0x00, 0x00, 0xE8, 0xE8, 0x9E, 0x9E, 0xE8,
-    0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x9F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,
-    0x1F, 0x00, 0x00, 0x1F, 0x1E, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE8, 0x9E, 0x9D, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9D,
-    0x9D, 0x9C, 0x9C, 0x9D, 0x9D, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E, 0x9D, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9E, 0x9F, 0x9F, 0x9F, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9C, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9E,
-    0xE8, 0x00, 0x00, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE8, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x1D, 0x1F, 0x1E,
-    0x1F, 0x00, 0x1F, 0x1E, 0x1E, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x9D, 0x9D,
-    0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9C, 0x9C, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C,
-    0x9E, 0x9E, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E, 0x9D, 0x9C, 0x9C, 0x9D,
-    0x9D, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9E, 0xE8, 0x00, 0x00, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8,
-    0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x1F, 0x1E, 0x1F, 0x1D, 0x1F, 0x1D, 0x1F, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1F, 0x00,
-    0x1F, 0x1F, 0x00, 0x00, 0x00, 0xE8, 0x9E, 0x9E, 0x9D, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E,
-    0x9E, 0x9B, 0x9B, 0x9B, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9E, 0x9E, 0x9E, 0x9B, 0x9B, 0x9B, 0x9C, 0x9D, 0x9D, 0x9C, 0x9C, 0x99, 0x99, 0x9C, 0x9C, 0x9E,
-    0xE8, 0x00, 0x00, 0x9F, 0x9F, 0x9D, 0x9D, 0xE8, 0xE8, 0x1F, 0xED, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1E, 0x1F, 0x1F, 0x1D,
-    0x1F, 0x00, 0x1F, 0x1F, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xE8, 0x9E, 0x9D,
-    0x9C, 0x9D, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9B, 0x9B, 0x9B, 0x9B, 0x9F, 0x9F, 0x9E, 0x9F,
-    0x9F, 0x9D, 0x9D, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F,
-    0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D,
-    0x9D, 0x9C, 0x9C, 0x99, 0x99, 0x9C, 0x9C, 0x9E, 0xE8, 0x00, 0x00, 0x9F, 0x9F, 0x9D, 0x9D, 0xE8,
-    0xE8, 0x1F, 0xED, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x1D, 0x1F, 0x1D, 0x1F, 0x1F, 0x00, 0x1F, 0x1E, 0x1E, 0x1F, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0x9E, 0x9E, 0x9E, 0x9C, 0x9C, 0x9C, 0x9D, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9F,
-    0x9F, 0x9F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9E,
-    0xE8, 0x00, 0x00, 0x9F, 0x9F, 0xE9, 0xE9, 0xE8, 0xE8, 0x1F, 0xED, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1D, 0x1F,
-    0x00, 0x00, 0x1F, 0x1F, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xE9,
-    0x9E, 0x9E, 0x9E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9E, 0x9D, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9E, 0xE8, 0x00, 0x00, 0x9F, 0x9F, 0xE9, 0xE9, 0xE8,
-    0xE8, 0x1F, 0xED, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x1E, 0x1E, 0x1F, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9C, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F,
-    0x9C, 0x9C, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9D, 0x9E, 0x9E, 0x9E,
-    0xE8, 0x00, 0x00, 0x9F, 0x9F, 0x9E, 0x9E, 0xE8, 0xE8, 0x1F, 0x1E, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E,
-    0x1E, 0x00, 0x1F, 0x1F, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0xE8, 0x9D, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9E, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0xE8, 0x9F, 0x9F, 0x9C, 0x9C, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9B, 0x9B, 0x9B, 0x9D, 0x9E, 0x9E, 0x9E, 0xE8, 0x00, 0x00, 0x9F, 0x9F, 0x9E, 0x9E, 0xE8,
-    0xE8, 0x1F, 0x1E, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x00, 0x1E, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D,
-    0x9D, 0x9C, 0x9C, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9E, 0x9E, 0x9F, 0x9F,
-    0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,
-    0x1F, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1C, 0x00, 0x00, 0x00,
-    0x00, 0x9D, 0x9F, 0x9F, 0xE8, 0xE8, 0x9F, 0x9D, 0x9D, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9D,
-    0x9B, 0x9B, 0x9D, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9E, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D,
-    0x9D, 0x9B, 0x9D, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE8, 0xE8,
-    0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1F, 0x1F,
-    0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x1C, 0x00, 0x00, 0x00, 0x9D, 0x9D, 0x9F, 0xE8, 0xE8, 0x9F, 0x9F,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9D, 0x9B, 0x9B, 0x9B, 0x9D, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9F,
-    0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9E, 0x9C, 0x9C, 0x9C, 0x9F, 0x9F,
-    0x9E, 0xE9, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x1E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8, 0x9C, 0x9D, 0x9D, 0x9B,
-    0x9B, 0x9B, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0x9E, 0x9E,
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D,
-    0x9D, 0xE8, 0xE8, 0x9C, 0x9C, 0x9C, 0x9F, 0x9F, 0x9E, 0xE9, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F,
-    0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x00, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0x9C, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE9, 0xE9, 0xE8, 0xE8, 0x9F, 0x9E, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8,
-    0xE8, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9C, 0x9C,
-    0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x1D, 0x1E, 0x1D, 0x1E,
-    0x00, 0xE8, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0xE8, 0x9C, 0x9D, 0x9D, 0x9B, 0x9B,
-    0x9B, 0x9E, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE8, 0xE8, 0xE8, 0x9F, 0xE8, 0xE8,
-    0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9C, 0x9C, 0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F,
-    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDF, 0xDF, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x1E, 0x1D, 0x00, 0x1D, 0x1E, 0x1D, 0x1E, 0x00, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8,
-    0xE8, 0xE8, 0x9E, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F,
-    0x9F, 0x9E, 0x9E, 0x9C, 0x9D, 0x9D, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9C, 0x9C,
-    0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0xED, 0xED, 0xED, 0xED, 0x1E,
-    0x1F, 0x1F, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1E, 0x1F,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
-    0xDF, 0xDE, 0xDD, 0xDD, 0xDF, 0xDF, 0xDF, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1D, 0x00, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x00, 0xE8, 0x9E, 0x9C, 0x9C, 0x9E, 0xE8, 0xE8, 0x9E, 0x9D, 0x9C, 0x9C, 0x9D, 0x9C,
-    0x9C, 0x9E, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE8, 0x9F, 0xE8, 0xE8,
-    0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0xE8, 0x9D, 0x9D, 0x9E, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1E, 0x1E,
-    0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0xEE, 0xEE, 0x1E,
-    0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1F,
-    0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xDD, 0xDF, 0xDC, 0xDC, 0xDD, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE,
-    0xDF, 0x00, 0x00, 0x1E, 0x1D, 0x1E, 0x1F, 0x1F, 0x1D, 0x1D, 0x1D, 0x00, 0xE8, 0x9C, 0x9C, 0x9C,
-    0x9E, 0x9F, 0x9E, 0x9D, 0x9C, 0x9C, 0x9D, 0x9C, 0x9C, 0x9D, 0x9D, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x9E, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0xE9,
-    0xE9, 0xE9, 0x9D, 0x9E, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1E, 0x1E, 0xED, 0xED, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0xEE, 0xEE, 0x1E, 0x00, 0x00, 0xEE, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x1E, 0x1D,
-    0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDD, 0xDF, 0xDE,
-    0xDC, 0xDD, 0xDF, 0xDD, 0xDB, 0xDB, 0xDB, 0xDB, 0xDE, 0xDF, 0x00, 0x00, 0x1E, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x9D, 0x9D, 0x9C, 0x9C, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x9E,
-    0xE8, 0xE8, 0xE8, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0x9D, 0x9D, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0x9F, 0xE8,
-    0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0xED, 0x1D,
-    0x1D, 0x1D, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0x1D, 0xEE, 0x1E, 0x1F, 0x1D, 0x1C, 0xEC,
-    0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x00, 0x1E, 0x1D, 0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E,
-    0x1E, 0x00, 0x00, 0xDF, 0xDF, 0xDD, 0xDF, 0xDC, 0xDD, 0xDD, 0xDD, 0xDB, 0xDB, 0xDB, 0xDE, 0xDC,
-    0xDA, 0xDA, 0xDA, 0xDD, 0x00, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x00, 0x1F, 0x9E,
-    0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0x00, 0xE8, 0xE8, 0xE9, 0xE8, 0xE8, 0x9F, 0xE8, 0xE8, 0xE8,
-    0xE8, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D,
-    0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x1F, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0xEC, 0xEC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1D, 0x1E, 0x1F, 0x1D, 0x1C, 0x1C, 0x1C, 0xEC, 0x1D, 0x1E, 0x1F, 0x1F, 0x1E, 0x1D,
-    0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xDF, 0xDF, 0xDD, 0xDF, 0xDC, 0xDC,
-    0xDD, 0xDA, 0xD8, 0xD9, 0xDB, 0xDE, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDD, 0x00, 0x1C, 0x1C,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x00, 0x9E, 0x9E, 0x9F, 0xE8, 0xE8, 0xE8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0x00, 0x00,
-    0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0x9E,
-    0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9E, 0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x1F, 0x1F, 0x1E, 0xED, 0x1D, 0x1D, 0x1D,
-    0xEC, 0x1C, 0x1C, 0x1C, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0x1C, 0x1C, 0x1D, 0x1E, 0x1D, 0x1C, 0x1B,
-    0xEA, 0x1C, 0xEC, 0x1E, 0x1E, 0x1F, 0x1D, 0x1C, 0x1D, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xDF, 0xDD, 0xDD, 0xDC, 0xDA, 0xDA, 0xDA, 0xDA, 0xD5, 0xDB, 0xDC, 0xDA, 0xDA, 0xDA,
-    0xD5, 0xD5, 0xDA, 0xDA, 0xDA, 0x00, 0x00, 0x1E, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE8,
-    0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0xE9, 0xE9, 0xE9, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D,
-    0x9E, 0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0x9F, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D, 0xEC, 0xEC, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
-    0x1B, 0x1B, 0x1C, 0xEC, 0x1D, 0x1D, 0x1C, 0xEA, 0x1B, 0xEA, 0x1C, 0xEC, 0x1D, 0x1E, 0x1D, 0x1C,
-    0x1D, 0x1D, 0x1E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x1F,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDD, 0xDC, 0xDC, 0xDA, 0xDD,
-    0xDA, 0xD8, 0xCF, 0xDD, 0xDA, 0xDA, 0xDA, 0xDA, 0xCF, 0xDF, 0xDD, 0xDA, 0xDA, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x1C, 0x19, 0x1E, 0x1D, 0x1E, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0x9F, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
-    0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0x9E, 0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0x9E,
-    0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1F, 0xED, 0x1D, 0x1D, 0xEC, 0xEC, 0x1C,
-    0x1C, 0x1B, 0x1B, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0x1B, 0x1C, 0x1C, 0xEC, 0x1C, 0x1B,
-    0xEA, 0x1B, 0x1C, 0xEC, 0x1D, 0x1D, 0xEC, 0x1C, 0x1D, 0x1D, 0x1E, 0x00, 0x00, 0x1F, 0x1E, 0x00,
-    0x00, 0x1F, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xDF, 0xDD, 0xDC, 0xDC, 0xDA, 0xDA, 0xD8, 0xD5, 0xCF, 0xDD, 0xDA, 0xDA, 0xD5, 0xDA,
-    0xCF, 0x00, 0xDF, 0x1E, 0x1E, 0x00, 0x00, 0x1D, 0x1D, 0x00, 0x17, 0x1E, 0x08, 0x08, 0x1C, 0x1E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0x00, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8,
-    0x9F, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0x9D, 0x9D, 0x9F, 0x9F,
-    0x9E, 0xE9, 0x00, 0x00, 0xE8, 0xE8, 0x9E, 0x9E, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1F, 0x1E, 0xED, 0x1D, 0x1D, 0xEC, 0x1C, 0x1C, 0x1B, 0x1B, 0xEB, 0xEB, 0xEB, 0x1A, 0xEB, 0x1A,
-    0xEB, 0x1A, 0xEB, 0x1B, 0x1C, 0x1C, 0x1B, 0xEA, 0x1B, 0xEA, 0x1C, 0x1C, 0xEC, 0x1D, 0xEC, 0xEA,
-    0x1C, 0x1D, 0x1E, 0x00, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x00,
-    0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDE, 0xDC, 0xDC, 0xDA, 0xDA,
-    0xD8, 0xCF, 0xCF, 0xDF, 0xDA, 0xDA, 0xCF, 0xD5, 0xCF, 0x00, 0x00, 0x1D, 0x1A, 0x1D, 0x1D, 0x19,
-    0x1D, 0x00, 0x17, 0x1E, 0x17, 0x19, 0x08, 0x1C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0x00, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0x9F, 0x9F, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8,
-    0xE8, 0xE9, 0xE9, 0xE8, 0x9D, 0x9D, 0x9F, 0x9F, 0x9E, 0xE9, 0x00, 0x00, 0x9E, 0x9E, 0x9E, 0x9E,
-    0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1E, 0xED, 0x1D, 0xEC, 0xEC, 0x1C, 0xEA,
-    0x1B, 0xEB, 0xEB, 0xEB, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0xEB, 0x1A, 0xEB, 0xEB, 0xEB, 0x1B, 0x1B,
-    0xEA, 0x1B, 0xEA, 0x1C, 0xEC, 0xEC, 0xEC, 0xEA, 0x1C, 0x1D, 0x1E, 0x00, 0x1F, 0x1E, 0x1E, 0x00,
-    0x00, 0x1F, 0x1E, 0xEE, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xDE, 0xDC, 0xDC, 0xDA, 0xD8, 0xD5, 0xCF, 0xD5, 0xDF, 0xDA, 0xD5, 0xCF, 0xD4,
-    0xCF, 0xDA, 0x00, 0x00, 0x1C, 0x17, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x08,
-    0x08, 0x1D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9D, 0x9F, 0x9F,
-    0x9E, 0xE9, 0x00, 0x00, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0x1E, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1F, 0x1E, 0xED, 0x1D, 0xEC, 0xEC, 0x1C, 0xEA, 0x1B, 0xEB, 0xEB, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
-    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0xEB, 0xEB, 0xEB, 0x1B, 0xEA, 0x1B, 0xEA, 0x1C, 0xEC, 0x1C, 0xEA,
-    0x1C, 0x1C, 0x1E, 0x00, 0x1F, 0x1E, 0x1E, 0x1F, 0x00, 0x1F, 0x1E, 0xEE, 0x1E, 0x1F, 0x00, 0x00,
-    0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0xDE, 0xDC, 0xDC, 0xDA, 0xD8,
-    0xD5, 0xCF, 0xD5, 0xDF, 0xDA, 0xD5, 0xCF, 0xD4, 0xD5, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x17, 0x19, 0x08, 0x1D, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE8,
-    0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9E, 0xE9, 0x00, 0x00, 0x9E, 0x9E, 0x9F, 0x9F,
-    0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1E, 0xED, 0x1D, 0xEC, 0xEC, 0x1C, 0xEA,
-    0x1B, 0xEB, 0xEB, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0xEA, 0xEA, 0xEA,
-    0xEA, 0x1B, 0x1B, 0x1B, 0xEA, 0x1C, 0x1C, 0x1B, 0x1C, 0x1D, 0x1F, 0x00, 0x1E, 0x1E, 0x1D, 0x1F,
-    0x00, 0x1F, 0x1E, 0xEE, 0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D,
-    0x1C, 0x1C, 0x1C, 0x00, 0xDD, 0xDC, 0xD8, 0xD7, 0xCF, 0xCF, 0xD5, 0xDC, 0xDF, 0xDF, 0xDF, 0xD5,
-    0xDA, 0x00, 0xD5, 0xCF, 0xD6, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1A,
-    0x17, 0x1A, 0x1C, 0x1D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE8,
-    0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0x9E, 0xE9, 0x00, 0x00, 0x9E, 0x9E, 0x9F, 0x9F, 0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1F, 0x1E, 0xED, 0xEE, 0xEC, 0xEC, 0x1C, 0xEA, 0x1B, 0xEB, 0xEB, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
-    0x1A, 0xEB, 0x1A, 0x1B, 0x1C, 0x1C, 0xEC, 0xEC, 0x1C, 0xEA, 0xEA, 0x1B, 0x1B, 0xEA, 0xEA, 0x1B,
-    0x1C, 0x1D, 0x00, 0x1F, 0x1E, 0x1D, 0x1D, 0x1E, 0x00, 0x1F, 0x1E, 0xEE, 0x1D, 0xEE, 0x1F, 0x1F,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1C, 0x08, 0x08, 0x19, 0x19, 0x1C, 0xDC, 0xD8, 0xD5,
-    0xCF, 0xCF, 0xD5, 0xDA, 0xDA, 0xDA, 0xDA, 0x00, 0x00, 0xD6, 0xD6, 0xD6, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1A, 0x19, 0x18, 0x1C, 0x1D, 0x1F, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xE9,
-    0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0x9C, 0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1E, 0xED, 0xEE, 0xEC, 0xEC, 0x1C, 0xEA,
-    0x1B, 0xEB, 0xEB, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0xEB, 0x1A, 0x1B, 0x1C, 0x1C, 0xEC, 0x1C, 0x1C,
-    0xEA, 0x1B, 0x1B, 0xEB, 0x1B, 0x1B, 0x1B, 0x1B, 0x1C, 0x1D, 0x00, 0x1F, 0x1E, 0x1C, 0x1D, 0x1E,
-    0x00, 0x1F, 0x1E, 0xEE, 0xEC, 0x1D, 0x1E, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1C, 0x08,
-    0x08, 0x19, 0x19, 0x19, 0x19, 0x1C, 0xD8, 0xD5, 0xCF, 0xCF, 0xCF, 0xD5, 0xCF, 0xCF, 0xD2, 0xDA,
-    0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x1B, 0x1B, 0x18, 0x1E, 0x00, 0x00, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
-    0xDF, 0xDE, 0xDE, 0xDE, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0x00, 0xE8, 0x00, 0x00, 0x00, 0xE9,
-    0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9C, 0x9C,
-    0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x18,
-    0x07, 0x07, 0x07, 0x32, 0x33, 0x22, 0x28, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1F, 0x1E, 0xED, 0xEE, 0xEC, 0xEC, 0x1C, 0xEA, 0x1B, 0xEB, 0xEB, 0x1A, 0x1A, 0x1A, 0x1A, 0xEB,
-    0x1A, 0x1B, 0x1B, 0xEC, 0xEC, 0xEC, 0x1C, 0xEA, 0x1B, 0x1C, 0x1B, 0x1B, 0xEB, 0x1B, 0x1B, 0x1B,
-    0x1C, 0x1E, 0x00, 0x1F, 0x1E, 0x1C, 0x1C, 0x1D, 0x00, 0x1F, 0x1E, 0xEE, 0x1D, 0x1D, 0x1D, 0xED,
-    0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1C, 0x08, 0x08, 0x19, 0x19, 0x19, 0x17, 0x17, 0x1A, 0xD8, 0xD5,
-    0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xD2, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xED,
-    0x1E, 0x1E, 0x1F, 0xDF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x16, 0x00, 0x1E, 0xDF,
-    0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0x00, 0x00, 0x00,
-    0xE9, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9,
-    0xE9, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9C, 0x9C, 0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0x9F, 0x9F,
-    0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x17, 0x13, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x30, 0x31, 0x33, 0x35,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1E, 0xED, 0xEE, 0xEC, 0xEC, 0x1C, 0xEA,
-    0x1B, 0xEB, 0xEB, 0xEB, 0x1A, 0x1A, 0xEB, 0x1A, 0x1B, 0x1B, 0x1C, 0x1D, 0x1D, 0x1C, 0xEA, 0x1B,
-    0xEA, 0xEA, 0x1D, 0x1B, 0x1B, 0x1B, 0x1B, 0xEA, 0x1D, 0x1E, 0x00, 0x1F, 0x1E, 0x1C, 0x1C, 0x1D,
-    0x1F, 0x1F, 0x1E, 0xED, 0x1D, 0xEC, 0x1D, 0xEE, 0x1E, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1C, 0x08, 0x19,
-    0x19, 0x08, 0x08, 0x17, 0x17, 0x17, 0x1C, 0xDA, 0xD7, 0xCF, 0xCF, 0xD5, 0xD9, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1D, 0x1D, 0xED, 0x1E, 0xDE, 0xDF, 0xDF, 0xDF, 0x00, 0x00,
-    0xDF, 0x00, 0xDE, 0xDE, 0x1B, 0x1D, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE,
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDE, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9C, 0x9C,
-    0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0x9F, 0x9F, 0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x13, 0x0F, 0x0F, 0x11,
-    0x12, 0x14, 0x17, 0x17, 0x18, 0x19, 0x32, 0x32, 0x20, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1F, 0x1E, 0x1E, 0xEE, 0x1D, 0xEC, 0x1C, 0x1C, 0x1B, 0x1B, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0x1B,
-    0x1B, 0x1C, 0xEC, 0x1D, 0x1C, 0xEA, 0x1B, 0xEA, 0x1B, 0xEA, 0x1D, 0xEA, 0xEA, 0xEA, 0xEA, 0x1C,
-    0x1D, 0x1F, 0x00, 0x1F, 0x1D, 0x1C, 0x1C, 0x1D, 0x1F, 0x1F, 0x1E, 0xED, 0x1D, 0xEC, 0xEC, 0x1D,
-    0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x19, 0x08, 0x08, 0x08, 0x08, 0x08, 0x17, 0x17, 0x1A, 0x00,
-    0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1D, 0x1D,
-    0x1D, 0x1E, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0x00, 0x00, 0x00, 0xDF, 0xDF,
-    0xDA, 0xDA, 0xDC, 0xDD, 0xDF, 0xDE, 0xDE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDC, 0xDE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0x9E, 0x9E,
-    0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x17, 0x12, 0x0F, 0x12, 0x14, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x34, 0x22, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1E, 0x1E, 0xEE, 0x1D, 0xEC, 0xEC, 0x1C,
-    0x1C, 0x1B, 0x1B, 0xEB, 0xEB, 0xEB, 0x1B, 0x1B, 0x1C, 0xEC, 0x1D, 0x1D, 0x1C, 0x1B, 0xEA, 0x1B,
-    0x1B, 0x1C, 0x1E, 0x1E, 0x1C, 0x1C, 0x1D, 0x1D, 0x1E, 0x1F, 0x00, 0x1F, 0x1D, 0x1C, 0x08, 0x1C,
-    0x1E, 0x1F, 0x1E, 0x1E, 0x1D, 0xEC, 0x1C, 0x1D, 0xEE, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1C, 0x1C, 0x08, 0x08, 0x08,
-    0x1A, 0x19, 0x19, 0x1A, 0x17, 0x17, 0x17, 0x1C, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xEC, 0x1D, 0x1E, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF,
-    0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xDE, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDC, 0xDE, 0xDE, 0xDD,
-    0xDD, 0xDD, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0x9F, 0x9F, 0xE8, 0xE8, 0x9E,
-    0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0x9E, 0x9E, 0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x13, 0x14, 0x15, 0x15, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x08, 0x25, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1F, 0x1E, 0x1E, 0xED, 0xEE, 0x1D, 0xEC, 0xEC, 0x1C, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1C,
-    0xEC, 0x1D, 0x1E, 0x1D, 0x1C, 0xEA, 0x1B, 0x1B, 0x1C, 0x1D, 0x1F, 0x1E, 0x1D, 0x1D, 0x1D, 0x1E,
-    0x1F, 0x00, 0x00, 0x1F, 0x1D, 0x1C, 0x08, 0x1C, 0x1E, 0x1F, 0x1F, 0x1E, 0xEE, 0x1D, 0x1C, 0xEC,
-    0x1D, 0xED, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x1C, 0x1C, 0x08, 0x08, 0x08, 0x1A, 0x19, 0x18, 0x18, 0x18, 0x1A, 0x17, 0x17, 0x19,
-    0x00, 0x1F, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1F, 0x1F, 0x1C, 0xEC, 0xEC,
-    0x1E, 0xDE, 0xDE, 0xDF, 0xDF, 0xDE, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xDA, 0xD8, 0xDA,
-    0xDD, 0xDF, 0xDF, 0xDC, 0xDA, 0xDE, 0xDE, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE8, 0xE8,
-    0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x08, 0x07, 0x07, 0x08, 0x08, 0x1B, 0x19, 0x19, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x19, 0x1A, 0x08, 0x25, 0x1F, 0x1D, 0x1D, 0x1D, 0x1F, 0x1F, 0x1E, 0x1E, 0xED, 0x1D, 0xEC, 0xEC,
-    0xEC, 0xEC, 0x1D, 0x1D, 0x1C, 0x1B, 0x1B, 0x1C, 0x1D, 0x1E, 0x1E, 0x1D, 0x1C, 0xEA, 0xEA, 0x1C,
-    0x1D, 0x1F, 0x1E, 0x1D, 0x1D, 0x1D, 0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1D, 0x1C, 0x08, 0x1C,
-    0x1D, 0x1E, 0x1F, 0x1E, 0xED, 0x1D, 0x1C, 0xEC, 0xEC, 0xED, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1C, 0x1C, 0x08, 0x08, 0x08, 0x1A,
-    0x19, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x1F, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F,
-    0x1E, 0x1F, 0x1E, 0x1E, 0x1F, 0x1C, 0x1C, 0x1E, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDE, 0xDF,
-    0xDF, 0xDF, 0x00, 0xDF, 0x00, 0xD7, 0xD8, 0x00, 0x00, 0xDE, 0xDE, 0xDC, 0xDA, 0xDE, 0xDE, 0xDD,
-    0xDD, 0xDD, 0xDC, 0xDC, 0xDC, 0xDB, 0xDB, 0xDC, 0xDE, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0x00,
-    0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E,
-    0x9E, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x15, 0x18, 0x08, 0x36, 0x23, 0x04, 0x04, 0x2B,
-    0x19, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x08, 0x28, 0x1E, 0x1D, 0x1D,
-    0x00, 0x1F, 0x1F, 0x1E, 0x1E, 0xED, 0x1D, 0x1D, 0xEC, 0x1E, 0x1E, 0x1D, 0xEC, 0x1C, 0x1B, 0xEC,
-    0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1C, 0x1D, 0x1E, 0x1F, 0x1F, 0x1E, 0x1D, 0x1D, 0x1E, 0x1F, 0x1F,
-    0x00, 0x00, 0x00, 0x1F, 0x1D, 0x08, 0xEB, 0x08, 0x1C, 0x1E, 0x1F, 0x1F, 0x1E, 0xEE, 0xEC, 0x1C,
-    0xEC, 0x1D, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x1D, 0x1D, 0x1C, 0x08, 0x08, 0x1A, 0x19, 0x18, 0x17, 0x17, 0x17, 0x17, 0x1A, 0x18, 0x00,
-    0x1F, 0x1F, 0x1F, 0x1E, 0x1F, 0x1E, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0x1E, 0xEA, 0xEA, 0x1E,
-    0xDF, 0xDF, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF, 0xD6, 0xDE, 0xDA,
-    0xDA, 0xDD, 0xDA, 0xDA, 0xDC, 0xDE, 0xDE, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB,
-    0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0x9E, 0x9E,
-    0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x12, 0x33, 0x1D, 0x1D, 0x1D, 0x1D, 0x2B, 0x2B, 0x1E, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x19, 0x1A, 0x1B, 0x08, 0x08, 0x29, 0x1D, 0x1D, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E,
-    0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0xEC, 0xEC, 0x1D, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1E, 0x1F, 0x1F,
-    0x1E, 0x1E, 0x1D, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x08, 0xEB, 0x08,
-    0x1C, 0x1D, 0x1E, 0x1F, 0x1E, 0xED, 0x1D, 0x1C, 0x1C, 0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1E, 0x00, 0x1D, 0x08, 0x1B, 0x1A, 0x19,
-    0x18, 0x17, 0x17, 0x17, 0x17, 0x1A, 0x1A, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1E, 0xED, 0xED, 0xEE,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x08, 0x08, 0x1E, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDE,
-    0xDE, 0xDC, 0xDC, 0xDC, 0xDC, 0xDF, 0xDA, 0xDA, 0xDA, 0xDA, 0xDF, 0xDE, 0xDE, 0xDE, 0xDE, 0xDD,
-    0xDD, 0xDD, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0x9E, 0x9E, 0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x2B, 0x1E, 0x17, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x08, 0x08, 0x08, 0x2D, 0x1C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
-    0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x1F,
-    0x1F, 0x00, 0x00, 0x1F, 0x1D, 0x08, 0x1A, 0xEB, 0x1C, 0x1D, 0x1E, 0x1F, 0x1F, 0x1E, 0x1D, 0x1C,
-    0x1C, 0x1D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x1D, 0x1E, 0x00, 0x1D, 0x08, 0x08, 0x08, 0x19, 0x18, 0x17, 0x17, 0x17, 0x17, 0x1C, 0x00, 0x1F,
-    0x1F, 0x1F, 0x00, 0x1F, 0xED, 0xED, 0x1D, 0xEC, 0x1C, 0xEC, 0xEC, 0x1D, 0x1E, 0x1A, 0x1A, 0x1E,
-    0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDC, 0xDA, 0xD9, 0xD9, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDB,
-    0xDB, 0xDB, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB,
-    0xDB, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x17, 0x0F, 0x1E, 0x9F, 0x9F,
-    0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x18, 0x18, 0x19, 0x19,
-    0x19, 0x1A, 0x1B, 0x08, 0x08, 0x08, 0x08, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x1E, 0x1E, 0x1F, 0x00, 0x1F, 0x1D, 0x08, 0x1A, 0xEB,
-    0x08, 0x1C, 0x1E, 0x1E, 0x1F, 0x1E, 0x1D, 0x1C, 0xEC, 0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1E, 0x00, 0x1D, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x18, 0x17, 0x17, 0x17, 0x17, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x00, 0xED, 0xED, 0x1D, 0x1D,
-    0xEC, 0x1C, 0xEC, 0xEC, 0x1E, 0x1A, 0x1A, 0x1E, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDE, 0xDA, 0xD7,
-    0xD7, 0xD7, 0xD7, 0xD9, 0xD9, 0xDA, 0xDB, 0xDA, 0xDA, 0xD9, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDD,
-    0xDD, 0xDC, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x07, 0x07, 0x17, 0x1E, 0x9F, 0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x08, 0x08, 0x08, 0x19, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1D,
-    0x1D, 0x1F, 0x00, 0x1F, 0x1D, 0x1B, 0x1A, 0xEB, 0x08, 0x1C, 0x1E, 0x1E, 0x1F, 0x1E, 0xEE, 0x1C,
-    0x1D, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E,
-    0x00, 0x1D, 0x08, 0x08, 0x08, 0x1A, 0x1A, 0x08, 0x18, 0x17, 0x17, 0x17, 0x08, 0x00, 0x1E, 0x1D,
-    0x08, 0x1E, 0x1E, 0x1F, 0xEE, 0xED, 0xED, 0xEC, 0x1D, 0xEC, 0x1C, 0xEC, 0x1E, 0x1A, 0x1A, 0x1E,
-    0xDF, 0x00, 0x00, 0xDF, 0xDF, 0xDA, 0xD5, 0xD3, 0xD3, 0xD6, 0xD7, 0xD9, 0xD9, 0xDB, 0xDA, 0xDA,
-    0xD9, 0xD9, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDD, 0xDE, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
-    0xDB, 0xDC, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x00, 0x00, 0x07, 0x08, 0x33, 0x07, 0x08, 0x1E,
-    0xE8, 0xE8, 0x1F, 0xED, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x1B, 0x19, 0x19,
-    0x19, 0x1A, 0x1B, 0x08, 0x08, 0x19, 0x14, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1F, 0x1D, 0x08, 0x1A, 0xEB,
-    0x08, 0x1C, 0x1D, 0x1E, 0x1F, 0x1E, 0xEE, 0x1C, 0x1E, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x08, 0x1A, 0x1A, 0x18, 0x18, 0x1A,
-    0x08, 0x17, 0x17, 0x17, 0x1C, 0x1E, 0x1E, 0x00, 0x08, 0x08, 0x08, 0x1E, 0x1E, 0xEC, 0xED, 0xED,
-    0xEA, 0xEA, 0x08, 0x1C, 0x1D, 0x19, 0x19, 0x1E, 0x00, 0xDF, 0xDF, 0x00, 0xDF, 0xD7, 0xD3, 0xD3,
-    0xD3, 0xD3, 0xD6, 0xD9, 0xDA, 0xDA, 0xD8, 0xD8, 0xD9, 0xD9, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDB,
-    0xDD, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0x00, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x00, 0x00, 0x07, 0x08, 0x33, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1B, 0x1A, 0x1A, 0x19, 0x19,
-    0x18, 0x17, 0x17, 0x16, 0x16, 0x16, 0x07, 0x07, 0x14, 0x14, 0x14, 0x13, 0x12, 0x12, 0x11, 0x11,
-    0x11, 0x0F, 0x0F, 0x0F, 0x07, 0x1C, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x08, 0x19, 0x14, 0x0F, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D,
-    0x1C, 0x1D, 0x1F, 0x1F, 0x1E, 0x08, 0x1A, 0xEB, 0x08, 0x1C, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1C,
-    0x1E, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x08, 0x08, 0x1A, 0x1A, 0x18, 0x18, 0x18, 0x18, 0x08, 0x17, 0x17, 0x17, 0x1E, 0x1E, 0x00, 0x1E,
-    0x1E, 0x17, 0x08, 0x08, 0x1D, 0x1C, 0xEC, 0xED, 0xEA, 0x1A, 0x08, 0x08, 0x1D, 0x19, 0x19, 0x1E,
-    0xDF, 0xDF, 0xDF, 0xDF, 0xDA, 0xD3, 0xD0, 0xD3, 0xD6, 0xD7, 0xD7, 0xDA, 0xDA, 0xD8, 0xD7, 0xD7,
-    0xD7, 0xDA, 0xDA, 0xDE, 0xDE, 0xDC, 0xD9, 0xDA, 0xDA, 0xDE, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
-    0xDB, 0xDB, 0x00, 0x9E, 0xE8, 0xE9, 0xE9, 0x9E, 0x9E, 0x9F, 0xE8, 0xE9, 0xE9, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x00, 0x00, 0x07, 0x1C, 0x33, 0x34, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x1D, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x1E, 0x1D, 0x1C, 0x1C, 0x1A, 0x19, 0x18, 0x17, 0x07, 0x11, 0x07, 0x1A, 0x19,
-    0x19, 0x1A, 0x1B, 0x19, 0x14, 0x0F, 0x18, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1C, 0x1C, 0x1D, 0x1F, 0x1E, 0x08, 0xEB, 0x1A,
-    0x08, 0x1C, 0x1C, 0x1E, 0x1E, 0x1E, 0x1C, 0x1C, 0x1D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x08, 0x1A, 0x1A, 0x18, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x1F, 0x1F, 0x00, 0x1E, 0x1E, 0x1E, 0x17, 0x1D, 0x1D, 0x1C, 0x08, 0xEC,
-    0xED, 0x1A, 0x1A, 0x08, 0x1D, 0x17, 0x19, 0x1E, 0xDF, 0xDF, 0xDF, 0x00, 0xDA, 0xD2, 0xD0, 0xD2,
-    0xD7, 0xD9, 0xDA, 0xDA, 0xDA, 0xD8, 0xD6, 0xD6, 0xD6, 0xD9, 0xDA, 0xDA, 0xDA, 0xD9, 0xDA, 0xDA,
-    0xDA, 0xDF, 0xDE, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0x00, 0x9E, 0xE8, 0xE9, 0xE9, 0x9E,
-    0x9E, 0x9F, 0xE8, 0xE9, 0xE9, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E,
-    0x00, 0x00, 0x17, 0x1C, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x1F, 0x00, 0x00, 0x19, 0x15, 0x13, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x15, 0x16, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x19, 0x14, 0x0F, 0x18, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D, 0x1C,
-    0x1C, 0x1C, 0x1D, 0x1F, 0x1E, 0x08, 0xEB, 0x1A, 0x08, 0x1C, 0x08, 0x1C, 0x1E, 0x1C, 0x08, 0x1C,
-    0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1A,
-    0x08, 0x1A, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x08, 0x17, 0x17, 0x08, 0x00, 0x1F, 0x1F, 0x00,
-    0x1E, 0x1A, 0x1D, 0xED, 0xED, 0x1C, 0x1B, 0x08, 0xED, 0xEC, 0x1A, 0x1A, 0x1B, 0x17, 0x1A, 0x1E,
-    0xDF, 0xDF, 0xDF, 0xDC, 0xD7, 0xD0, 0xD1, 0xD2, 0xD7, 0xD9, 0xDA, 0xDA, 0xDA, 0xD8, 0xD6, 0xD4,
-    0xD2, 0xD5, 0xD7, 0xDA, 0xD9, 0xDA, 0xDA, 0xDA, 0xDA, 0xDD, 0x00, 0xDE, 0xDB, 0xDB, 0xDB, 0xDB,
-    0xDB, 0xDB, 0x00, 0x9E, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9F, 0xE8, 0xE8, 0xE9, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x00, 0x00, 0x17, 0x1D, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x18, 0x11, 0x10, 0x10, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x15, 0x15, 0x16, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x19, 0x19, 0x14, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x1F, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D, 0x1C, 0x08, 0x08, 0x1C, 0x1F, 0x1E, 0x1C, 0xEB, 0x1A,
-    0x1A, 0x08, 0x08, 0x08, 0x1C, 0x08, 0x08, 0x1D, 0x1D, 0x1E, 0x1E, 0x00, 0x00, 0x1F, 0x1E, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x19, 0x08, 0x1A, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x19, 0x1E, 0x1E, 0x1D, 0x1D, 0x00, 0x1E, 0x1E, 0x1F, 0xED, 0xED, 0xED, 0x1C, 0x1A,
-    0xEC, 0xEC, 0x1A, 0x1A, 0x08, 0x1B, 0x1A, 0x1E, 0xDF, 0xDF, 0x00, 0xDC, 0xD5, 0xCF, 0xD1, 0xD2,
-    0xD4, 0xD6, 0xDA, 0xDA, 0xD9, 0xD6, 0xD4, 0xD2, 0xD1, 0xD7, 0xD9, 0x1E, 0xD9, 0xD9, 0xDA, 0xDA,
-    0xDA, 0xDD, 0xDF, 0x00, 0xDB, 0xDA, 0xDB, 0xDB, 0xDB, 0xDB, 0x00, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E,
-    0x9E, 0x00, 0x18, 0x1D, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x15, 0x16, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x07, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D, 0x1C,
-    0x08, 0x08, 0x1C, 0x1F, 0x1E, 0x1C, 0xEB, 0x19, 0x1A, 0x1A, 0x08, 0x08, 0x08, 0x1A, 0x08, 0x1D,
-    0x1D, 0x1D, 0x1E, 0x1F, 0x00, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x18,
-    0x08, 0x1A, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x19, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E,
-    0x1E, 0x1C, 0x00, 0xEC, 0xEC, 0xED, 0xED, 0x1B, 0x08, 0x08, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1E,
-    0xDF, 0x00, 0x00, 0xDA, 0xD2, 0xD0, 0xD0, 0xD1, 0xD1, 0xD3, 0xD6, 0xD7, 0xD9, 0xD6, 0xD3, 0xD1,
-    0xD5, 0xD7, 0x2B, 0xDE, 0x1F, 0xD8, 0xD9, 0xDA, 0xD9, 0xDC, 0xDF, 0x00, 0xDE, 0xDA, 0xDA, 0xDB,
-    0xDB, 0xDB, 0x00, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x00, 0x19, 0x1E, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x10, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x15, 0x15, 0x16, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x19, 0x0F, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D, 0x1C, 0x08, 0x08, 0x08, 0x1F, 0x1E, 0x1C, 0x08, 0x19,
-    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x08, 0x1E, 0x1E, 0x1D, 0x1D, 0x1E, 0x1F, 0x1F, 0x1E, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x08, 0x17, 0x18, 0x1A, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x19, 0x08, 0x00, 0x1F, 0x1F, 0x1E, 0x1C, 0x1D, 0x1D, 0x1E, 0x00, 0x1C, 0x1C, 0xEC, 0x1C,
-    0x1A, 0x08, 0x1A, 0x19, 0x1A, 0x1D, 0x1C, 0x1D, 0x1E, 0xDF, 0xDF, 0xD7, 0xD2, 0xCF, 0xCF, 0xCF,
-    0xCF, 0xD1, 0xD3, 0xD7, 0xD9, 0xD5, 0xD3, 0xCF, 0xD9, 0xDC, 0x1C, 0xDE, 0x00, 0xD6, 0xD8, 0xDA,
-    0xD9, 0xDC, 0xDF, 0x00, 0xDE, 0xDD, 0xD9, 0xDB, 0xDB, 0xDB, 0x00, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F,
-    0x9F, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E,
-    0x9E, 0x00, 0x19, 0x1E, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x15, 0x16, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x07, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1E,
-    0x1F, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1F, 0x1F, 0x1E, 0x1E, 0x1D, 0x1C, 0x08,
-    0x08, 0x08, 0x08, 0x1F, 0x1E, 0x1D, 0x08, 0x1A, 0x19, 0x1A, 0x1A, 0x18, 0x19, 0x1D, 0x1F, 0x1F,
-    0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1D, 0x08, 0x1A,
-    0x17, 0x1A, 0x1A, 0x17, 0x17, 0x1A, 0x18, 0x17, 0x19, 0x08, 0x08, 0x00, 0x1F, 0x1F, 0x1F, 0x08,
-    0x17, 0x08, 0x1C, 0x1D, 0x1B, 0x1A, 0x1B, 0x1B, 0x19, 0x08, 0x1A, 0x19, 0x1A, 0x1D, 0x1C, 0x1D,
-    0x1E, 0xDF, 0xDF, 0xD3, 0xD0, 0xCF, 0xD1, 0xD1, 0xCF, 0xCF, 0xD1, 0xD5, 0xD5, 0xD5, 0xD2, 0xCF,
-    0xD9, 0xDC, 0x1A, 0x00, 0x00, 0xD5, 0xD7, 0xDA, 0xDB, 0xDD, 0xDF, 0x00, 0xDE, 0xDB, 0xD7, 0xDB,
-    0xDB, 0xDB, 0x00, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0xE9, 0xE9,
-    0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x00, 0x1A, 0x1F, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x10, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x15, 0x15, 0x16, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x17,
-    0x0F, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1E, 0x1F, 0x1E, 0xED, 0xED, 0x1F, 0x00, 0x00, 0x1F, 0x1E,
-    0x1E, 0x1F, 0x1F, 0x1E, 0x1E, 0x1D, 0x1C, 0x08, 0x08, 0x08, 0x08, 0x1F, 0x1E, 0x1D, 0x1C, 0x1A,
-    0x19, 0x19, 0x17, 0x19, 0x19, 0x1C, 0x1D, 0x1F, 0x1E, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1F, 0x00,
-    0x00, 0x00, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x08, 0x1A, 0x17, 0x17, 0x18, 0x17, 0x18, 0x1C, 0x1C,
-    0x1C, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x1D, 0x1D, 0x08, 0x17, 0x08, 0x1D, 0x1B, 0x1B, 0x1A, 0x1A,
-    0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x1B, 0x1D, 0x1D, 0x1E, 0x1F, 0xDF, 0xD3, 0xCF, 0xCF, 0xCF, 0xD3,
-    0xD8, 0xD6, 0xD1, 0xD2, 0xD5, 0xD4, 0xD5, 0xD1, 0xD9, 0xDC, 0x9C, 0x00, 0xDB, 0xD4, 0xD6, 0xDA,
-    0xDD, 0xDE, 0xDF, 0x00, 0xDE, 0xDA, 0xD7, 0xD9, 0xDB, 0xDB, 0x00, 0x9E, 0x9E, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x00, 0x1A, 0x1F, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2F,
-    0x00, 0x00, 0x12, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x15, 0x16, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x07, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1E,
-    0xED, 0x1D, 0x1D, 0xED, 0x1F, 0x00, 0x1F, 0x1E, 0xEE, 0x1E, 0x1F, 0x1F, 0x1E, 0x1D, 0x1C, 0x08,
-    0x08, 0x08, 0x08, 0x1E, 0x1E, 0x1D, 0x1C, 0x08, 0x19, 0x19, 0x17, 0x19, 0x1A, 0x1C, 0x1C, 0x1D,
-    0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1D, 0x1B, 0x1A, 0x08,
-    0x08, 0x08, 0x18, 0x17, 0x17, 0x18, 0x19, 0x08, 0x1D, 0x00, 0x00, 0x1F, 0x00, 0x1E, 0x1E, 0x08,
-    0x08, 0x1D, 0x1D, 0xEC, 0xEC, 0x1C, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x1A, 0x1D, 0x1D,
-    0x1E, 0x1F, 0x1F, 0xD3, 0xCF, 0xCF, 0xCF, 0xCF, 0x19, 0xD8, 0xD8, 0xD5, 0xD8, 0xD7, 0xD7, 0xD5,
-    0xD9, 0xD9, 0x1E, 0x00, 0xD3, 0xD4, 0xD8, 0xDC, 0xDE, 0xDF, 0xDF, 0xDE, 0xDA, 0xD7, 0x3F, 0xD8,
-    0xDB, 0xDB, 0x00, 0x9E, 0x9E, 0xE9, 0xE9, 0xE8, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E,
-    0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0xE8, 0xE8, 0x9F, 0x9F, 0xE9, 0x08, 0x1E, 0x35, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2F, 0x00, 0x00, 0x18, 0x0F, 0x0F, 0x10, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x15, 0x16, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x0F,
-    0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1E, 0x1E, 0xED, 0x1D, 0xEC, 0x1D, 0xED, 0x1F, 0x00, 0x1F,
-    0xEE, 0xEE, 0x1F, 0x1F, 0x1E, 0x1D, 0x1C, 0x08, 0x08, 0x08, 0x08, 0x1E, 0x1E, 0x1C, 0x1D, 0x08,
-    0x1A, 0x18, 0x17, 0x19, 0x1A, 0x08, 0x1C, 0x1D, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1F, 0x00,
-    0x00, 0x1F, 0x1F, 0x1E, 0x1D, 0x1C, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x17, 0x1A, 0x1B,
-    0x1F, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xED, 0xED, 0xED, 0xED, 0xED, 0xEC, 0x08,
-    0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x1A, 0x1C, 0x1E, 0x1E, 0x1F, 0x1F, 0xD3, 0xCF, 0xCF, 0xD2, 0xCF,
-    0x18, 0xDA, 0xD4, 0xD8, 0xD8, 0xDA, 0xD8, 0xD8, 0xD9, 0xDE, 0x2E, 0x00, 0xD1, 0xD4, 0xDA, 0xDA,
-    0xDD, 0x00, 0xDB, 0xD7, 0xD7, 0x3F, 0x3F, 0xD7, 0xDB, 0xDC, 0x00, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8,
-    0xE8, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8,
-    0x9F, 0xE9, 0x1E, 0x1C, 0x1E, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x2A, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2D, 0x2C, 0x2B, 0x29, 0x04, 0x04, 0x04, 0x04, 0x24, 0x22,
-    0x36, 0x36, 0x34, 0x0C, 0x33, 0x32, 0x31, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1E,
-    0xED, 0x1D, 0xEC, 0xEC, 0x1D, 0x1E, 0x1F, 0x1F, 0x1E, 0xEE, 0x1E, 0x1F, 0x1E, 0x1D, 0x1C, 0x08,
-    0x08, 0x08, 0x08, 0x1E, 0x1D, 0x1C, 0x1C, 0x08, 0x1A, 0x18, 0x17, 0x18, 0x1A, 0x08, 0x1C, 0x1C,
-    0x1D, 0x1E, 0x1D, 0x1C, 0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1D, 0x08, 0x17, 0x18,
-    0x1A, 0x19, 0x19, 0x19, 0x17, 0x17, 0x1C, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00,
-    0x00, 0xED, 0xED, 0xED, 0xED, 0x1E, 0x1E, 0x1E, 0x08, 0x08, 0x1A, 0x19, 0x19, 0x1A, 0x1B, 0x1E,
-    0x1E, 0x1F, 0x1F, 0xD3, 0xCF, 0xCF, 0xD2, 0xCD, 0x19, 0xDA, 0xD3, 0xD8, 0xDA, 0xDA, 0xD5, 0xD7,
-    0xDA, 0xDD, 0x00, 0xDB, 0xCF, 0xD5, 0xDA, 0xDD, 0xDE, 0xDF, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-    0xDB, 0xDD, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8,
-    0x00, 0x00, 0xE8, 0xE8, 0xE9, 0xE8, 0xE8, 0xE8, 0x9F, 0xE9, 0xE9, 0x1E, 0x1C, 0x1E, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x1F, 0x1D, 0x1C, 0x1C, 0x2D, 0x2B, 0x2A, 0x04,
-    0x25, 0x36, 0x35, 0x33, 0x32, 0x31, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x33, 0x32, 0x31, 0x0F, 0x07,
-    0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1F, 0x1F, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x1E, 0x1E, 0xED, 0xEC, 0xEC, 0x1D, 0xED, 0x1E, 0x1E,
-    0x1E, 0x1D, 0xEE, 0x1F, 0x1F, 0x1D, 0x1D, 0x1C, 0x08, 0x1A, 0x08, 0x1E, 0x1D, 0x08, 0x1C, 0x1D,
-    0x08, 0x19, 0x17, 0x18, 0x19, 0x08, 0x08, 0x1C, 0x1D, 0x1F, 0x1D, 0x1C, 0x1D, 0x1E, 0x1F, 0x00,
-    0x00, 0x1E, 0x1C, 0x1E, 0x1D, 0x08, 0x18, 0x17, 0x17, 0x18, 0x18, 0x18, 0x17, 0x19, 0x1D, 0x1F,
-    0x1F, 0xED, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xED, 0x1E, 0x1E, 0x1E, 0x1E, 0x08,
-    0x08, 0x1A, 0x08, 0x19, 0x19, 0x1A, 0x1A, 0xEC, 0x1F, 0x1F, 0x1F, 0xD8, 0xCF, 0xD1, 0xD2, 0xCD,
-    0x1A, 0xDA, 0xD3, 0xD8, 0xDA, 0xDA, 0xD1, 0xD7, 0xD7, 0xDA, 0xDE, 0xD5, 0xD1, 0xD8, 0xDC, 0xDF,
-    0xDF, 0xDF, 0xDF, 0xDD, 0x3F, 0x3F, 0x3F, 0x3F, 0xDB, 0xDE, 0x00, 0xE9, 0xE9, 0x00, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0x00, 0x00, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0x00, 0x1E, 0x1D, 0x1E, 0x26, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x1F, 0x1E,
-    0x1E, 0xED, 0x1D, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0xEE, 0x1F, 0x1E, 0x1D, 0x1D,
-    0x1C, 0x1A, 0x08, 0x1E, 0x1D, 0x08, 0x1C, 0x1E, 0x08, 0x19, 0x17, 0x17, 0x19, 0x08, 0x08, 0x1C,
-    0x1C, 0x1F, 0x1D, 0x1D, 0x1C, 0x1E, 0x1F, 0x00, 0x00, 0x1E, 0x1C, 0x1D, 0x1E, 0x08, 0x08, 0x18,
-    0x17, 0x17, 0x17, 0x17, 0x18, 0x1A, 0x08, 0x1F, 0x1F, 0xED, 0xED, 0xED, 0x1F, 0xED, 0xED, 0x1F,
-    0x1F, 0x00, 0xED, 0x1E, 0x1E, 0x1E, 0x08, 0x08, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0xEC,
-    0x1F, 0x1F, 0x1F, 0xD8, 0xD6, 0xD2, 0xD6, 0xCF, 0x1B, 0xDA, 0xD6, 0xDA, 0xDA, 0xDA, 0xD6, 0xD3,
-    0xD6, 0xD6, 0xDB, 0xD7, 0xD3, 0xD5, 0xD8, 0xDF, 0x00, 0x00, 0xDD, 0xD8, 0x3F, 0x3F, 0x3F, 0x3F,
-    0xDC, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x15, 0x17, 0x18, 0x1A, 0x1B, 0x1C,
-    0x1E, 0x29, 0x26, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x1D, 0x17, 0x08, 0x07, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0xED, 0xEE, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1C, 0xEC, 0x1D, 0x1E, 0x1E,
-    0xEE, 0x1D, 0x1C, 0x1D, 0x1E, 0x1D, 0x1D, 0x1C, 0x08, 0x1A, 0x08, 0x1E, 0x1D, 0x08, 0x1C, 0x1D,
-    0x1D, 0x1A, 0x18, 0x17, 0x19, 0x1A, 0x08, 0x08, 0x1C, 0x1D, 0x1E, 0x1D, 0x1C, 0x1D, 0x1E, 0x00,
-    0x00, 0x1E, 0x1C, 0x1C, 0x1E, 0x1C, 0x08, 0x1A, 0x18, 0x18, 0x1A, 0x18, 0x18, 0x17, 0x08, 0x1F,
-    0xED, 0xED, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0xED, 0xED, 0x1F, 0x00, 0x00, 0x1E, 0x1D, 0x08, 0x1A,
-    0x1A, 0x19, 0x19, 0x19, 0x19, 0x1A, 0xEB, 0xEC, 0x1E, 0x1F, 0x00, 0xDC, 0xD5, 0xD5, 0xDA, 0xD6,
-    0x1D, 0xDE, 0xD9, 0xD8, 0xDA, 0xDE, 0xCF, 0xD1, 0xD2, 0xD5, 0xDB, 0xD9, 0xD7, 0xD9, 0xDC, 0x00,
-    0xDB, 0xD7, 0x3F, 0x3F, 0x3F, 0xD8, 0x3F, 0xDB, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2B, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x19, 0x0F, 0x08, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x07, 0x07,
-    0x07, 0x17, 0x19, 0x1A, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x1E, 0xEE, 0xEE, 0x1E, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
-    0x1E, 0x1E, 0x1D, 0x1C, 0x1C, 0x1D, 0x1D, 0x1E, 0xEE, 0x1D, 0x1C, 0x1D, 0x1D, 0x1D, 0x1C, 0x08,
-    0x1A, 0x19, 0x08, 0x1E, 0x1D, 0x08, 0x1C, 0x1C, 0x1E, 0x1A, 0x18, 0x17, 0x18, 0x19, 0x08, 0x08,
-    0x1C, 0x1C, 0x1F, 0x1D, 0x1C, 0x1C, 0x1D, 0x00, 0x00, 0x1F, 0x1E, 0x1C, 0x1D, 0x1E, 0x08, 0x08,
-    0x08, 0x1A, 0x19, 0x18, 0x17, 0x17, 0x1C, 0xED, 0xED, 0xED, 0x08, 0x1B, 0x1C, 0x1C, 0x1B, 0x1C,
-    0x1C, 0x1D, 0x1F, 0x00, 0x00, 0x1E, 0x08, 0x1A, 0x1A, 0x1A, 0x1A, 0x18, 0x18, 0x1A, 0xEB, 0xEC,
-    0x1E, 0x1F, 0x00, 0x00, 0xDC, 0xDC, 0x00, 0xD9, 0x1E, 0xDF, 0xDC, 0xDC, 0xDE, 0xDE, 0xD1, 0xD3,
-    0xD6, 0xDA, 0x00, 0x00, 0xDD, 0xDC, 0xDE, 0xDF, 0x00, 0xDE, 0xDD, 0xDB, 0xD8, 0x3F, 0xDB, 0xDE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x17, 0x0F, 0x08, 0x17, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x08, 0x07, 0x0F, 0x0F, 0x31, 0x32, 0x32, 0x33, 0x33, 0x34, 0x35, 0x26, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x1E, 0xEE,
-    0xEE, 0x1E, 0x1E, 0x1E, 0x1E, 0xED, 0xED, 0xED, 0x1E, 0x1E, 0x1D, 0x1C, 0x08, 0x1C, 0x1D, 0x1D,
-    0x1D, 0x1C, 0x08, 0x1C, 0x1D, 0x1C, 0x08, 0x1A, 0x19, 0x19, 0x08, 0x1E, 0x1D, 0x1A, 0x08, 0x1C,
-    0x1E, 0x08, 0x18, 0x17, 0x17, 0x18, 0x1A, 0x1B, 0x1B, 0x1C, 0x1F, 0x1D, 0x1C, 0x1B, 0x1D, 0x00,
-    0x00, 0x00, 0x1E, 0x1C, 0x08, 0x19, 0x1C, 0x1A, 0x1A, 0x1A, 0x19, 0x17, 0x17, 0x1B, 0x1D, 0xED,
-    0xED, 0x1D, 0x08, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x19, 0x08, 0x1D, 0x1E, 0x00, 0x1E, 0x1D, 0x1D,
-    0x1C, 0x1A, 0x1A, 0x18, 0x17, 0x1A, 0xEB, 0xEC, 0x1E, 0x1F, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E,
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xDE, 0xD7, 0xD9, 0xDD, 0xDF, 0x9F, 0x00, 0x00, 0xDF, 0xDF, 0x00,
-    0xDE, 0xDB, 0xDA, 0xD8, 0xDB, 0xDB, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x1F, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x08, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x07, 0x0F, 0x15, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x35, 0x20, 0x24, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0xEE, 0x1D, 0xEE, 0xEE, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1E, 0x1D, 0x1C, 0x08, 0x08, 0x1C, 0x1C, 0x1C, 0x1C, 0x08, 0x08, 0x1C, 0x08, 0x08, 0x19,
-    0x18, 0x19, 0x08, 0x1E, 0x1D, 0x1A, 0x08, 0x1C, 0x1D, 0x1D, 0x1A, 0x18, 0x17, 0x18, 0x18, 0x1A,
-    0x1B, 0x1C, 0x1D, 0x1F, 0x1C, 0x1B, 0x1B, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x08, 0x08, 0x19, 0x19,
-    0x19, 0x19, 0x17, 0x18, 0x18, 0x1D, 0x1B, 0x1A, 0xED, 0x1D, 0x1B, 0x19, 0x19, 0x19, 0x1A, 0x1B,
-    0x19, 0x19, 0x1C, 0x1D, 0x08, 0x00, 0x1D, 0x1C, 0x1A, 0x18, 0x18, 0x17, 0x18, 0x1A, 0xEB, 0x1D,
-    0x1E, 0x1F, 0xE8, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0xDE, 0xDF,
-    0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x00, 0x00, 0xDE, 0xDD, 0xDB, 0xDB, 0xDB, 0xDE, 0xDE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1E, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x18, 0x1D, 0x1D,
-    0x1D, 0x08, 0x07, 0x12, 0x07, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x1A, 0x22,
-    0x27, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0xEE, 0x1D,
-    0x1D, 0x1D, 0x1D, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0x1D, 0xEC, 0xEC, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x1A, 0x08, 0x08, 0x08, 0x1B, 0x1A, 0x18, 0x18, 0x1A, 0x08, 0x1E, 0x1D, 0x19, 0x08, 0x1C,
-    0x1C, 0x1E, 0x1A, 0x18, 0x17, 0x17, 0x17, 0x19, 0x1A, 0x1B, 0x1C, 0x1F, 0x1D, 0x1B, 0x1A, 0x1D,
-    0x00, 0x1E, 0x00, 0x1F, 0x1D, 0x08, 0x19, 0x17, 0x17, 0x17, 0x18, 0x18, 0x1B, 0x1B, 0x18, 0x18,
-    0x1D, 0x08, 0x1A, 0x19, 0x17, 0x17, 0x19, 0x1B, 0x19, 0x19, 0x1C, 0x1A, 0x1A, 0x08, 0x1D, 0x1A,
-    0x18, 0x17, 0x17, 0x17, 0x19, 0x1A, 0x1B, 0x1D, 0x1E, 0x1F, 0xE8, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F,
-    0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x00, 0xDE,
-    0xDE, 0xDE, 0xDE, 0xDD, 0xDD, 0x00, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x00, 0x00, 0x00, 0x00, 0xE8,
-    0xE8, 0xE8, 0x9E, 0x9E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x1C, 0x1D, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x1C, 0x07, 0x0F, 0x08, 0x18, 0x1D, 0x1D, 0x08, 0x07, 0x13, 0x04, 0x04, 0x04, 0x19, 0x18,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x24, 0x28, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x1E, 0x1E, 0xEE, 0xEE, 0x1D, 0x1D, 0xEC, 0xEC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1D, 0x1D, 0xEC, 0x1D, 0x08, 0x08, 0x1A, 0x1A, 0x1A, 0x08, 0x08, 0x1B, 0x1B, 0x19, 0x17,
-    0x19, 0x1A, 0x08, 0x1D, 0x1F, 0x19, 0x1B, 0x1C, 0x1C, 0x1E, 0x1C, 0x1A, 0x17, 0x16, 0x16, 0x17,
-    0x1A, 0x1B, 0x08, 0x1D, 0x1F, 0x1C, 0x19, 0x08, 0x00, 0x1E, 0x1D, 0x1C, 0x1C, 0x1D, 0x08, 0x19,
-    0x18, 0x18, 0x1A, 0x19, 0x19, 0x18, 0x17, 0x17, 0x1C, 0x08, 0x19, 0x17, 0x17, 0x17, 0x17, 0x19,
-    0x19, 0x18, 0x1C, 0x1A, 0x1A, 0x1A, 0x08, 0x1A, 0x18, 0x17, 0x17, 0x17, 0x19, 0xEB, 0x1C, 0x1D,
-    0x1E, 0x1F, 0xE8, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9E, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x1C, 0x1D, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2F, 0x00, 0x1D, 0x18, 0x0F, 0x0F, 0x08, 0x19, 0x1D, 0x1D,
-    0x08, 0x00, 0x04, 0x04, 0x1D, 0x1D, 0x1D, 0x1B, 0x18, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x1A, 0x25, 0x28, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0xEE, 0xEE, 0x1D, 0x1D, 0x1D, 0xEC, 0xEC, 0x1C,
-    0x1C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x1D, 0x08, 0x1A, 0x1A, 0x19,
-    0x1A, 0x1A, 0x08, 0x08, 0x1B, 0x1A, 0x18, 0x17, 0x1A, 0x08, 0x08, 0x08, 0x1F, 0x1A, 0x1A, 0x1C,
-    0x1C, 0x1D, 0x1D, 0x1A, 0x18, 0x16, 0x16, 0x18, 0x1A, 0x1A, 0x1B, 0x1C, 0x1F, 0x1D, 0x1A, 0x19,
-    0x1D, 0x00, 0x1D, 0x1C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1A, 0x08, 0x19, 0x18, 0x17, 0x17, 0x1B,
-    0x08, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x19, 0x18, 0x17, 0x08, 0x19, 0x19, 0x18, 0x08, 0x1D,
-    0x18, 0x17, 0x17, 0x17, 0x19, 0xEB, 0x1C, 0x1D, 0x1E, 0x1F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xE9,
-    0xE9, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x00, 0x00,
-    0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8,
-    0xE8, 0xE9, 0xE9, 0xE8, 0x9E, 0x9E, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0x9C, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9C, 0x1D, 0x1C, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x2A, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x19, 0x1D, 0x1D, 0x1D, 0x04, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1B, 0x18, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x27, 0x2A, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0xEC, 0xEC, 0xEC, 0x1C, 0x1C, 0x08, 0x08, 0x08, 0x08, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB,
-    0x08, 0x1A, 0x08, 0x1A, 0x1A, 0x1A, 0x19, 0x1A, 0x1A, 0x08, 0x08, 0x08, 0x1B, 0x19, 0x17, 0x18,
-    0x1A, 0x08, 0x08, 0x1A, 0x1D, 0x1B, 0x19, 0x1B, 0x1C, 0x1D, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x18,
-    0x1A, 0x1A, 0x1B, 0x1D, 0x1E, 0x1F, 0x1C, 0x1B, 0x1C, 0x00, 0x00, 0x1D, 0x1A, 0x19, 0x19, 0x19,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x19, 0x08, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x19,
-    0x17, 0x17, 0x08, 0x19, 0x18, 0x17, 0x18, 0x08, 0x1A, 0x17, 0x17, 0x18, 0x1A, 0x1C, 0xEC, 0x1D,
-    0x1E, 0xE9, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xE9, 0xE9, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x00, 0x00, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE8, 0x1F, 0xE8, 0x9E, 0x9F, 0xE9,
-    0xE9, 0xE9, 0xE9, 0x9C, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9C, 0x1D, 0x1C, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x00, 0x07, 0x1A, 0x08, 0x08, 0x08, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x1A, 0x1B, 0x28, 0x28, 0x1D, 0x1D, 0x1D, 0x1D, 0xEC, 0xEC, 0x1C, 0x1C, 0x08, 0x08, 0x08, 0x08,
-    0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A,
-    0x08, 0x1C, 0x08, 0x08, 0x1A, 0x18, 0x17, 0x19, 0x1A, 0x08, 0x08, 0x1A, 0x1C, 0x1D, 0x19, 0x1B,
-    0x1C, 0x1D, 0x1E, 0x1C, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x00, 0x00, 0x08, 0x1A, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x19, 0x19, 0x17, 0x17, 0x18, 0x18,
-    0x1C, 0x17, 0x18, 0x18, 0xEB, 0x1C, 0x1D, 0x1E, 0x1F, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x00, 0x00,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9D, 0x9D, 0x9F, 0x9F, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE9, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0x9F, 0xE9, 0xE9, 0xE8, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9E, 0x9E, 0x08, 0x1C, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x19, 0x07, 0x17, 0x19, 0x18, 0x17, 0x16, 0x16, 0x14, 0x14, 0x13, 0x12, 0x12, 0x11, 0x11, 0x0F,
-    0x0F, 0x12, 0x15, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x26, 0x20, 0x1D, 0x1D, 0x1D, 0x1D,
-    0xEC, 0x1C, 0x08, 0x08, 0x08, 0xEB, 0xEB, 0xEB, 0xEB, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x19,
-    0x19, 0x18, 0x18, 0x18, 0x19, 0x1A, 0x1A, 0x08, 0x1C, 0x08, 0x08, 0x1A, 0x19, 0x17, 0x17, 0x19,
-    0x08, 0x08, 0x08, 0x1A, 0x08, 0x1E, 0x1B, 0x19, 0x1D, 0x1D, 0x1E, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B,
-    0x1B, 0x1C, 0x1D, 0x1D, 0x1F, 0x1F, 0x1E, 0x1D, 0x1D, 0x1E, 0x1E, 0x00, 0x00, 0x08, 0x08, 0x19,
-    0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x19, 0x17, 0x17, 0x17, 0x18, 0x19, 0x1B, 0x18, 0x18, 0x19, 0x1B, 0x1D, 0x1D, 0x1E,
-    0x1F, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9D, 0x9D, 0x9F,
-    0x9F, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0x9E, 0xE8,
-    0xE8, 0xE8, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x08, 0x08, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x1E, 0x1D, 0x1C, 0x1C, 0x1C, 0x08, 0x1A, 0x18, 0x13, 0x10, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x1A, 0x1A, 0x33, 0x37, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x08, 0x08, 0x08, 0xEB, 0x1A, 0x1A, 0x1A,
-    0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x18, 0x18, 0x17, 0x18, 0x19, 0x19, 0x1A, 0x08, 0x1C,
-    0x1D, 0x08, 0x08, 0x19, 0x18, 0x17, 0x19, 0x1A, 0x08, 0x08, 0x1A, 0x1A, 0x1A, 0x1D, 0x1F, 0x1B,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1C, 0x1C, 0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x00, 0x1D, 0x1B, 0x19, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x19, 0x17, 0x17, 0x17, 0x17, 0x18, 0x19,
-    0x1B, 0x19, 0x1A, 0x1A, 0x1C, 0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0x9E, 0xE3, 0x00, 0x00, 0x00, 0x00, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x18, 0x08, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x1C, 0x17, 0x14, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x15, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x31, 0x33, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x08, 0x08, 0xEB, 0xEB, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x18, 0x19, 0x19, 0x08, 0x08, 0x1C, 0x1D, 0x1C, 0x08, 0x19, 0x18, 0x17, 0x17, 0x19, 0x08,
-    0x08, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1E, 0x1F, 0x1F, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x1F, 0x00, 0x9E, 0x9E, 0x9F, 0x9F, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00,
-    0x1B, 0x1B, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x18, 0x1A, 0x1B, 0x1A, 0x1A, 0x1B, 0x1D, 0x1D, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0xE8, 0xE8,
-    0xE9, 0x9E, 0xE3, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0x9E, 0x9E,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9E, 0x18, 0x08,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x11, 0x10, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x31, 0x12, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0xEB, 0xEB, 0x1A, 0x1A, 0x19, 0x19, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x18, 0x19, 0x1A, 0x08, 0x1C, 0x1C, 0x1D, 0x1C,
-    0x08, 0x19, 0x18, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1D, 0x00,
-    0x00, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x00, 0xE9, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F,
-    0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x1D, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x19, 0x1A,
-    0x1B, 0x1C, 0x1C, 0x1D, 0x1D, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0xE9,
-    0xE9, 0xE8, 0x9D, 0x9C, 0x9C, 0x9E, 0x9E, 0x16, 0x08, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x15, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x31, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x08, 0xEB, 0x1A, 0x1A, 0x19, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x19,
-    0x1A, 0x1A, 0x08, 0x1C, 0x1D, 0x1D, 0x1C, 0x08, 0x08, 0x18, 0x17, 0x18, 0x19, 0x1A, 0x1A, 0x1A,
-    0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x9F, 0xE9, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x1B, 0x1B, 0x1A, 0x19, 0x1B, 0x1A, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x1B, 0xEC, 0xEC, 0x1D, 0x1D, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0x1F,
-    0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0x9E, 0x9C, 0x9C, 0xE9, 0xE9, 0x9E,
-    0x14, 0x12, 0x18, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x07, 0x0F,
-    0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1A, 0x1A, 0x19, 0x18, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x17, 0x18, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1C, 0x1D, 0x1E, 0x1D, 0x1C, 0x1A,
-    0x18, 0x17, 0x19, 0x19, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1E, 0x00, 0xE9,
-    0xE9, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F,
-    0x9E, 0x9E, 0x9F, 0x9F, 0x9C, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0x00, 0x00, 0x00, 0x1D, 0x1A,
-    0x1B, 0x1D, 0x1C, 0xEB, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0xEB, 0xEB, 0x1B, 0x1C, 0xEC,
-    0x1D, 0x1D, 0x1D, 0x1E, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0x1F, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE8, 0x9E, 0x9C, 0x9C, 0xE9, 0xE9, 0x9E, 0x9E, 0x17, 0x0F, 0x18, 0x28, 0x29, 0x2B, 0x2F,
-    0x00, 0x00, 0x12, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x15, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x18, 0x18, 0x11, 0x0F, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1C, 0x1C, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x18, 0x18, 0x18, 0x18, 0x1B, 0x1B, 0x1B, 0x1C,
-    0x1C, 0x1D, 0x1D, 0x1E, 0x1D, 0x1C, 0x1A, 0x19, 0x19, 0x1A, 0x1B, 0x1B, 0x1B, 0x1C, 0x1C, 0x1D,
-    0x1D, 0x1D, 0x1E, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0x00, 0x00, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE9, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0xE9,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x00, 0x1E, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0xE8, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9C, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F,
-    0x9E, 0x9E, 0x9E, 0x9E, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9D, 0x9F, 0x9F, 0x9D,
-    0x9D, 0x9D, 0x18, 0x0F, 0x0F, 0x18, 0x00, 0x00, 0x00, 0x1B, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x13, 0x0F, 0x17,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x1E, 0x1D, 0x1C, 0x1A, 0x1B, 0x1B,
-    0x1B, 0x1B, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1E, 0xE9, 0xE9, 0xE9, 0xE9, 0x00, 0xE9, 0x9F, 0x9F,
-    0xE9, 0x00, 0x00, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0xE9, 0xE9, 0x9E, 0x9E, 0x9E,
-    0x9E, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E,
-    0x1E, 0x1F, 0xE8, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE4, 0xE4, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE8, 0xE9, 0xE8, 0xE8, 0x9D, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x1B, 0x18, 0x0F, 0x12, 0x00,
-    0x00, 0x17, 0x0F, 0x11, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x15, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x17, 0x14, 0x0F, 0x12, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1D, 0x1C, 0x1B, 0x1B, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0xE8, 0xE8, 0xE8,
-    0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xE9, 0x00, 0x00, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8,
-    0x9E, 0x9E, 0x9E, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x00, 0x1F, 0x1F, 0x1E,
-    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x00, 0xE8, 0x9E, 0x9E, 0x9C, 0x9C, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D,
-    0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9E, 0x9E, 0x9C,
-    0x9C, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00, 0xE9, 0xE4, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0x9F, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9, 0xE9, 0xE8, 0x9E, 0x9E, 0x9E, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x1F, 0x1F, 0x1B, 0x18, 0x12, 0x07, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x14, 0x0F, 0x11, 0x19, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x1E, 0xE8, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0xE9, 0xE9,
-    0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8,
-    0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE8, 0xE9, 0xE9, 0xE9,
-    0xE9, 0x9F, 0x9F, 0x9F, 0x9F, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x9E, 0x9E, 0x9E, 0x9C, 0x9C, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9C, 0x9C,
-    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9E, 0x9E, 0x9C, 0x9C, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0xE4, 0x1F,
-    0xE4, 0xE9, 0xE4, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0xE9, 0x9F, 0x9F, 0x9F, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x1F, 0x1F, 0x1D, 0x1D, 0x29,
-    0x26, 0x21, 0x35, 0x23, 0x23, 0x27, 0x27, 0x04, 0x04, 0x04, 0x22, 0x36, 0x35, 0x34, 0x34, 0x33,
-    0x32, 0x07, 0x14, 0x0F, 0x11, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F,
-    0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xE9, 0x00, 0x00, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E,
-    0x9E, 0x9E, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9E, 0x00, 0x00, 0x9E, 0x9E, 0x9E, 0xE9, 0xE9, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E,
-    0x9E, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE4, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0x9E, 0x9E, 0x9F,
-    0x9F, 0x9D, 0x9D, 0x1F, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x2B, 0x2B, 0x04, 0x26, 0x22, 0x37, 0x34, 0x32, 0x31, 0x0F, 0x12, 0x18, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D,
-    0x9D, 0x9D, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0xE9, 0x00, 0x00, 0x9F, 0x9F, 0xE8, 0xE8, 0xE9, 0x9E, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8,
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x00,
-    0x00, 0x9E, 0x9E, 0x9E, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE9,
-    0xE4, 0xE9, 0xE9, 0xE4, 0xE4, 0xE9, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x1D, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x07, 0x07, 0x07, 0x32,
-    0x32, 0x33, 0x33, 0x34, 0x34, 0x35, 0x36, 0x21, 0x22, 0x24, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E,
-    0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0xE9, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8,
-    0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE9,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0xE4, 0xE9, 0xE9, 0xE4, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x1D, 0x18, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x00, 0x16, 0x13, 0x12, 0x12, 0x13,
-    0x13, 0x08, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8,
-    0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x00,
-    0x00, 0x9F, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9C,
-    0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE9, 0xE4, 0xE9, 0xE9, 0x00, 0xE9, 0x00, 0xE9, 0x00, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0x1D, 0x08, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x19, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x17, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0xE8, 0xE8, 0xE8, 0xE8, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xE8, 0xE8, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE9,
-    0x9F, 0x9F, 0x9F, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C,
-    0x9C, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE9, 0xE9, 0xE4, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x08, 0x18, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x19, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1F, 0xE9, 0x1F, 0xE9, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0xE8, 0xE8, 0x9E, 0x9E, 0x9E, 0x9E, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
-    0xE8, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x00,
-    0x00, 0x9F, 0x9C, 0x9C, 0xE9, 0xE9, 0xE9, 0xE9, 0x9C, 0x9C, 0x9C, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE9,
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
-    0xE9, 0xE9, 0x1D, 0x08, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x17, 0x19, 0x28, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x1F, 0x1F, 0x9F, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x1F, 0x1F, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99,
-    0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x9A, 0x00, 0x00, 0x00, 0x9F, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x9B, 0x9B,
-    0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x08, 0x1D, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x17, 0x1D, 0x2B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99,
-    0x9A, 0x9F, 0x1F, 0x9F, 0x98, 0x98, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x99,
-    0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x98, 0x98,
-    0x99, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x1F,
-    0x1F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x1F, 0x9F, 0x98, 0x99,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x08, 0x1D, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x17, 0x00, 0x08, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x98, 0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x9B, 0x9B, 0x9B, 0x99, 0x97, 0x97, 0x9A, 0x9A, 0x97, 0x97, 0x97, 0x97, 0x9A, 0x9A, 0x98, 0x98,
-    0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x97, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x98,
-    0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x1F, 0x1F, 0x9B, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x9A,
-    0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x99, 0x97, 0x97, 0x97, 0x97,
-    0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98,
-    0x98, 0x9A, 0x9F, 0x1F, 0x1F, 0x9F, 0x98, 0x98, 0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99,
-    0x98, 0x98, 0x98, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x08, 0x1E, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x1C, 0x12, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x00, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96,
-    0x96, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97,
-    0x97, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98,
-    0x97, 0x97, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x98,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x1F,
-    0x1F, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96,
-    0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x9A, 0x9F, 0x1F, 0x1F, 0x9F, 0x9B, 0x9B, 0x9B,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97,
-    0x97, 0x98, 0x08, 0x1E, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x00,
-    0x1D, 0x18, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x00, 0x13, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x98, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x99,
-    0x99, 0x99, 0x98, 0x98, 0x96, 0x98, 0x98, 0x96, 0x96, 0x99, 0x99, 0x9A, 0x9A, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x97, 0x97, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98,
-    0x99, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99, 0x1F, 0x1F, 0x9B, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x9A, 0x98, 0x98, 0x98, 0x99, 0x99, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98,
-    0x9A, 0x9F, 0x1F, 0x1F, 0x9F, 0x9B, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97,
-    0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x1A, 0x9D, 0x33, 0x34, 0x1E, 0x1C,
-    0x19, 0x17, 0x17, 0x16, 0x13, 0x07, 0x16, 0x17, 0x19, 0x1C, 0x1D, 0x1E, 0x9D, 0x1D, 0x08, 0x1B,
-    0x1B, 0x04, 0x14, 0x07, 0x07, 0x1A, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x98, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9B, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x99, 0x9A, 0x9A, 0x99,
-    0x99, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x97, 0x97, 0x99,
-    0x99, 0x97, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A, 0x9A, 0x9D, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x1F,
-    0x1F, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x98, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x98, 0x97, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x1F, 0x9F, 0x98, 0x98, 0x9B, 0x9B,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99, 0x9B,
-    0x99, 0x99, 0x1A, 0x9D, 0x33, 0x34, 0x35, 0x1E, 0x07, 0x12, 0x11, 0x0F, 0x0F, 0x0F, 0x11, 0x12,
-    0x13, 0x16, 0x18, 0x1A, 0x1B, 0x04, 0x04, 0x04, 0x0C, 0x04, 0x14, 0x07, 0x07, 0x1A, 0x11, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x98, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97,
-    0x97, 0x97, 0x98, 0x98, 0x98, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x99,
-    0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9A, 0x9A, 0x9D, 0x9A, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x99, 0x98,
-    0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x1F, 0x1F, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99,
-    0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x9A, 0x9A, 0x98, 0x9B, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x9A,
-    0x9F, 0x1F, 0x1F, 0x9F, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x98, 0x98, 0x19, 0x00, 0x33, 0x34, 0x35, 0x36,
-    0x1E, 0x07, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x0C,
-    0x04, 0x14, 0x14, 0x07, 0x07, 0x16, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x98, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99,
-    0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97,
-    0x97, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9D, 0x99, 0x9D, 0x98, 0x98, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x1F,
-    0x1F, 0x9B, 0x9D, 0x97, 0x97, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x96, 0x97, 0x97, 0x97, 0x9A, 0x9F, 0x1F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99,
-    0x99, 0x98, 0x18, 0x00, 0x33, 0x34, 0x35, 0x36, 0x22, 0x1E, 0x16, 0x18, 0x19, 0x1B, 0x1D, 0x1E,
-    0x9D, 0x9D, 0x04, 0x04, 0x0C, 0x0C, 0x0C, 0x0C, 0x04, 0x14, 0x14, 0x07, 0x07, 0x11, 0x12, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9B, 0x9D, 0x97, 0x97, 0x97, 0x9B, 0x99,
-    0x9A, 0x98, 0x98, 0x97, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99,
-    0x99, 0x9A, 0x9A, 0x98, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x9F,
-    0x1F, 0x9F, 0x98, 0x98, 0x9D, 0x9D, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B,
-    0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x98, 0x98, 0x99, 0x18, 0x9D, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x1E, 0x1D, 0x1C, 0x08, 0x08, 0x1C, 0x1D, 0x1E, 0x9D, 0x9D, 0x00, 0x08, 0x04, 0x04,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x98, 0x9B, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x9A,
-    0x9A, 0x98, 0x98, 0x97, 0x97, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97,
-    0x97, 0x99, 0x99, 0x99, 0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x1F,
-    0x1F, 0x9D, 0x9D, 0x9B, 0x97, 0x97, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98,
-    0x99, 0x98, 0x98, 0x9A, 0x9A, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x97, 0x97, 0x97, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x98, 0x9A, 0x9F, 0x1F, 0x1F, 0x9F, 0x9D, 0x9A, 0x9D, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x9B,
-    0x99, 0x99, 0x17, 0x1E, 0x33, 0x34, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x00, 0x16, 0x13, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x12, 0x0F, 0x08, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x9A, 0x98, 0x98, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x9F, 0x1F,
-    0x9F, 0x9B, 0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x97, 0x97, 0x99,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x99, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x98, 0x1F, 0x1F, 0x9D, 0x9D, 0x9A, 0x9A, 0x9A, 0x9A, 0x99,
-    0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x9A, 0x98, 0x98, 0x98, 0x98,
-    0x99, 0x98, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x9A, 0x9F, 0x1F,
-    0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x99, 0x99, 0x98, 0x98, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x07, 0x1D, 0x33, 0x34, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x19, 0x0F, 0x10, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x0F, 0x12, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x98, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99,
-    0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x98, 0x98, 0x98,
-    0x98, 0x9B, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x97, 0x97, 0x97,
-    0x97, 0x99, 0x99, 0x99, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96,
-    0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x98, 0x96, 0x97, 0x97, 0x9A, 0x9A, 0x97, 0x97, 0x97, 0x97,
-    0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x1F,
-    0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x99, 0x9A, 0x9A, 0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x9B, 0x98, 0x9B,
-    0x99, 0x99, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x97,
-    0x96, 0x96, 0x96, 0x98, 0x9A, 0x9F, 0x1F, 0x1F, 0x9F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x98, 0x07, 0x08, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x0F, 0x07, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98,
-    0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x98, 0x98, 0x99, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x9A, 0x9F,
-    0x1F, 0x9F, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x99, 0x97, 0x97,
-    0x99, 0x99, 0x9A, 0x9A, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x9A, 0x9A, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x98, 0x98, 0x95, 0x95, 0x97, 0x98, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x99,
-    0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x98, 0x98,
-    0x98, 0x98, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x1F, 0x1F, 0x9F,
-    0x98, 0x98, 0x99, 0x99, 0x99, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x07, 0x08, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x12, 0x0F, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x98, 0x9B, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x9A,
-    0x9A, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x99, 0x99,
-    0x98, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99,
-    0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9B, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x97, 0x95, 0x97, 0x98, 0x1F,
-    0x1F, 0x9D, 0x9D, 0x9D, 0x9B, 0x99, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9A, 0x9F, 0x1F, 0x9F, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x07, 0x08, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x0F, 0x12, 0x08, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99,
-    0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x9B, 0x9B,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99, 0x9A,
-    0x9F, 0x1F, 0x9F, 0x9A, 0x99, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97,
-    0x99, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x9B, 0x98, 0x98, 0x98, 0x99, 0x99, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x99, 0x1F, 0x1F, 0x9D, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A,
-    0x9D, 0x9D, 0x9D, 0x97, 0x97, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B,
-    0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x9A, 0x1F, 0x1F, 0x9F, 0x99,
-    0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x9A,
-    0x9A, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x07, 0x1A,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x1C, 0x12, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x98, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x99,
-    0x99, 0x98, 0x98, 0x98, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x9A, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x96, 0x97, 0x97, 0x98, 0x98, 0x96, 0x96, 0x95, 0x95, 0x95, 0x99, 0x1F,
-    0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x99,
-    0x99, 0x9D, 0x98, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99,
-    0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97,
-    0x97, 0x98, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x08, 0x18, 0x1B, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00,
-    0x1D, 0x18, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x10, 0x31, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x96, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x99, 0x99, 0x98, 0x98, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98,
-    0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x9B, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x97,
-    0x97, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x98,
-    0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x99, 0x1F, 0x1F, 0x9D, 0x9A, 0x9D, 0x9D, 0x9D, 0x9A, 0x9D,
-    0x9D, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9D, 0x9A, 0x9A, 0x9A, 0x9D,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x9A, 0x1F, 0x1F, 0x9F, 0x99, 0x99,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x95, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x08,
-    0x1A, 0x17, 0x18, 0x19, 0x1A, 0x1A, 0x1B, 0x08, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x00, 0x1E, 0x1C,
-    0x18, 0x16, 0x33, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x1F, 0x9F, 0x9D, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9A, 0x9A, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x1F,
-    0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x99,
-    0x99, 0x9A, 0x9F, 0x1F, 0x9F, 0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x99,
-    0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9A, 0x98, 0x98, 0x96, 0x96, 0x96,
-    0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x08, 0x07, 0x11, 0x0F, 0x0F, 0x11, 0x12, 0x13,
-    0x07, 0x07, 0x07, 0x32, 0x32, 0x33, 0x33, 0x34, 0x0C, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9A, 0x9A, 0x97, 0x97, 0x99, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x99, 0x99, 0x99, 0x98, 0x98, 0x99, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x1F, 0x1F, 0x9F, 0x98, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x9B, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x98,
-    0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x1D, 0x08, 0x1C, 0x1C,
-    0x1D, 0x1E, 0x9D, 0x00, 0x00, 0x00, 0x9D, 0x1E, 0x1D, 0x1C, 0x1C, 0x1B, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x1A, 0x1C, 0x24, 0x25, 0x04, 0x04, 0x25, 0x23, 0x20, 0x36, 0x35, 0x0C,
-    0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x96, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x97,
-    0x97, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x99, 0x1F,
-    0x1F, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x9A, 0x9F, 0x1F, 0x9F, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x98,
-    0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x98,
-    0x98, 0x99, 0x98, 0x1D, 0x1A, 0x1C, 0x1C, 0x1D, 0x1E, 0x1E, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x9D, 0x1E, 0x1E, 0x1D, 0x1C,
-    0x08, 0x1A, 0x19, 0x18, 0x17, 0x17, 0x07, 0x11, 0x07, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x96, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x9A, 0x9A,
-    0x97, 0x97, 0x97, 0x97, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x97,
-    0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9B,
-    0x9B, 0x9B, 0x97, 0x98, 0x98, 0x99, 0x9B, 0x9B, 0x9A, 0x99, 0x97, 0x97, 0x97, 0x97, 0x9A, 0x9A,
-    0x9A, 0x97, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x1F, 0x1F, 0x99, 0x98, 0x98, 0x97, 0x99, 0x99, 0x9B,
-    0x9B, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x99, 0x97, 0x97,
-    0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9A,
-    0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99,
-    0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x98, 0x18, 0x08, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x00, 0x15, 0x13, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19,
-    0x12, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x98,
-    0x98, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x99,
-    0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A,
-    0x9A, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9B,
-    0x9D, 0x9D, 0x9D, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x9B, 0x9B,
-    0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x9A, 0x1F,
-    0x1F, 0x9B, 0x9B, 0x9B, 0x97, 0x97, 0x97, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96,
-    0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x9A,
-    0x9F, 0x1F, 0x9F, 0x9B, 0x98, 0x98, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x98, 0x98, 0x98, 0x18, 0x08, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x19, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x17, 0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x98, 0x9D, 0x98, 0x9B, 0x9D, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99, 0x96, 0x98, 0x98, 0x96,
-    0x96, 0x99, 0x99, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97,
-    0x97, 0x97, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B,
-    0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x98, 0x98, 0x98, 0x98,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x9A, 0x1F, 0x1F, 0x9D, 0x98, 0x98, 0x97, 0x97, 0x97, 0x9A,
-    0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D, 0x98, 0x99, 0x99, 0x99,
-    0x9B, 0x9B, 0x99, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x98, 0x9B, 0x9B, 0x9B, 0x9A, 0x98, 0x98, 0x97,
-    0x97, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x1E, 0x17, 0x1A, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19,
-    0x1A, 0x13, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x96, 0x9D, 0x9D, 0x9D, 0x9A, 0x9A, 0x9D, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x99,
-    0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x97, 0x97, 0x99, 0x99, 0x97, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x9A, 0x1F,
-    0x1F, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x99, 0x98, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x9A, 0x9F,
-    0x1F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9A, 0x9A, 0x9A, 0x98, 0x99, 0x99, 0x99,
-    0x99, 0x9A, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99,
-    0x98, 0x98, 0x1C, 0x17, 0x18, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x11, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x9A, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A,
-    0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B,
-    0x99, 0x99, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96,
-    0x96, 0x97, 0x97, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9B, 0x9B, 0x9D, 0x9D, 0x9B, 0x9D, 0x9B, 0x99, 0x99, 0x98, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x9B, 0x1F, 0x1F, 0x9A, 0x9A, 0x9A, 0x9D, 0x9D, 0x99, 0x9B,
-    0x9B, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x97,
-    0x97, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9B, 0x9D, 0x9D, 0x9B, 0x9D, 0x9A,
-    0x9A, 0x98, 0x98, 0x97, 0x97, 0x9B, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x1A, 0x17, 0x18, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x1D, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19,
-    0x1A, 0x11, 0x16, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x96, 0x98, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x9A, 0x9F, 0x1F, 0x9F,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x99, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x9B, 0x1F,
-    0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99, 0x9A, 0x1F, 0x1F,
-    0x9F, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98,
-    0x98, 0x1D, 0x1A, 0x1A, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00,
-    0x00, 0x1B, 0x12, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x16, 0x0F, 0x08, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x98, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9A, 0x9A, 0x9D, 0x9D, 0x9A, 0x9D, 0x9B, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D,
-    0x9B, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9D, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x99, 0x99, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9B, 0x9F,
-    0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x9B, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9A, 0x9D, 0x9D, 0x9D,
-    0x9B, 0x9D, 0x9B, 0x9D, 0x9D, 0x9A, 0x9D, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x99, 0x9A, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9A, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A,
-    0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98,
-    0x1E, 0x1C, 0x1C, 0x1E, 0x98, 0x98, 0x98, 0x98, 0x1D, 0x1D, 0x1A, 0x1A, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x00, 0x00, 0x1D, 0x17, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19,
-    0x1A, 0x1A, 0x0F, 0x16, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x96, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x99, 0x9D, 0x98, 0x9D, 0x9D, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x9A, 0x9F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x1F, 0x9F, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9D,
-    0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x1B, 0x07, 0x11, 0x11, 0x14, 0x19, 0x98, 0x98, 0x1D,
-    0x1D, 0x1E, 0x1A, 0x18, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x08, 0x07, 0x07, 0x17, 0x17, 0x18,
-    0x19, 0x1A, 0x1B, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x1D, 0x1D, 0x1E,
-    0x9D, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x1A, 0x16, 0x0F, 0x16, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x9D,
-    0x9D, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F,
-    0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x98, 0x98, 0x96, 0x96, 0x96,
-    0x96, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x95, 0x95, 0x95, 0x9A, 0x9F, 0x1F, 0x9F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x07,
-    0x18, 0x08, 0x32, 0x17, 0x08, 0x18, 0x1D, 0x1D, 0x1D, 0x1C, 0x18, 0x18, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x08, 0x07, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x19,
-    0x18, 0x17, 0x16, 0x07, 0x07, 0x13, 0x13, 0x11, 0x11, 0x0F, 0x0F, 0x0F, 0x0F, 0x14, 0x00, 0x19,
-    0x1A, 0x1A, 0x1A, 0x16, 0x0F, 0x18, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x96, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98,
-    0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99,
-    0x99, 0x99, 0x9B, 0x9B, 0x99, 0x9D, 0x1F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x99,
-    0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97, 0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x08, 0x1C, 0x34, 0x32, 0x32, 0x08, 0x19, 0x1D,
-    0x1D, 0x1A, 0x19, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x07, 0x0F, 0x14, 0x18, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x28, 0x2D, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x07, 0x0F, 0x0F, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x95, 0x95,
-    0x95, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x97, 0x97, 0x97, 0x97, 0x98,
-    0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9A, 0x9A, 0x97, 0x97, 0x97, 0x97, 0x9A, 0x9A,
-    0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x99, 0x9D, 0x1F, 0x1F,
-    0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x99, 0x9B, 0x9F, 0x1F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99,
-    0x99, 0x08, 0x08, 0x32, 0x30, 0x32, 0x08, 0x08, 0x1D, 0x1A, 0x08, 0x32, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x07, 0x0F, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x28, 0x28, 0x19, 0x19,
-    0x1A, 0x1A, 0x18, 0x0F, 0x0F, 0x07, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x95, 0x95, 0x95, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x98,
-    0x98, 0x97, 0x97, 0x97, 0x97, 0x99, 0x9D, 0x1F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98,
-    0x97, 0x97, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x99,
-    0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x08, 0x32, 0x30, 0x30, 0x32, 0x08,
-    0x08, 0x1A, 0x08, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x19, 0x12, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x25, 0x25, 0x19, 0x19, 0x19, 0x1A, 0x07, 0x0F, 0x07, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x95, 0x95, 0x95, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x96, 0x96, 0x98, 0x98, 0x96, 0x96, 0x99, 0x99, 0x9A, 0x9A, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x99, 0x9D, 0x1F,
-    0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98,
-    0x99, 0x9B, 0x9F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x9A, 0x9A,
-    0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99,
-    0x98, 0x98, 0x25, 0x32, 0x30, 0x30, 0x30, 0x34, 0x08, 0x1D, 0x07, 0x19, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x1C, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x19,
-    0x19, 0x17, 0x07, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2A, 0x22, 0x07, 0x19,
-    0x1A, 0x1A, 0x15, 0x11, 0x1C, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x9B, 0x9B, 0x9D, 0x9D, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9A,
-    0x9A, 0x99, 0x99, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x97,
-    0x97, 0x99, 0x99, 0x97, 0x97, 0x9B, 0x99, 0x1F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x9A, 0x9F, 0x1F, 0x9F, 0x9B, 0x9D, 0x9D, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x1D, 0x25, 0x32, 0x30, 0x30, 0x30, 0x32,
-    0x00, 0x08, 0x1D, 0x07, 0x19, 0x19, 0x35, 0x36, 0x22, 0x24, 0x1C, 0x19, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x0C, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x2A, 0x37, 0x07, 0x18, 0x19, 0x1A, 0x07, 0x13, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x96, 0x96, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99,
-    0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x9A, 0x9A,
-    0x98, 0x98, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x9B,
-    0x1F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B,
-    0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9A,
-    0x9B, 0x9F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x99, 0x99, 0x99, 0x99, 0x9B,
-    0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x98, 0x98,
-    0x1D, 0x1D, 0x25, 0x30, 0x30, 0x30, 0x30, 0x32, 0x00, 0x08, 0x1D, 0x1D, 0x07, 0x18, 0x08, 0x36,
-    0x22, 0x24, 0x1E, 0x1A, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00,
-    0x13, 0x14, 0x14, 0x07, 0x08, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2A, 0x35, 0x07,
-    0x18, 0x1A, 0x18, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x9D, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A,
-    0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x9B, 0x9B, 0x97, 0x97, 0x99, 0x99, 0x97,
-    0x97, 0x99, 0x99, 0x99, 0x99, 0x97, 0x9B, 0x99, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D,
-    0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x9B, 0x9F, 0x1F, 0x9F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x99,
-    0x99, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x1D, 0x1D, 0x1D, 0x27, 0x34, 0x30, 0x30, 0x30, 0x30, 0x32,
-    0x00, 0x08, 0x1D, 0x1D, 0x1D, 0x19, 0x07, 0x19, 0x08, 0x24, 0x04, 0x1E, 0x1C, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x08, 0x14, 0x14, 0x07, 0x07, 0x0C, 0x04, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2A, 0x0C, 0x33, 0x07, 0x18, 0x18, 0x1A, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9D, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99,
-    0x9B, 0x1F, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x1F, 0x1F, 0x1F, 0x1F, 0x9D, 0x9D,
-    0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x1F,
-    0x1F, 0x9F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x1D, 0x1D, 0x1D,
-    0x2A, 0x27, 0x32, 0x30, 0x30, 0x30, 0x30, 0x34, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x16,
-    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x08, 0x18, 0x14, 0x07, 0x07, 0x04, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2A,
-    0x28, 0x32, 0x30, 0x0F, 0x12, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1C,
-    0x1E, 0x1E, 0x9D, 0x9D, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x99, 0x99, 0x98, 0x1D, 0x1D, 0x1D, 0x2C, 0x2C, 0x34, 0x30, 0x30, 0x30, 0x30, 0x32, 0x00,
-    0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x14, 0x07, 0x07, 0x04, 0x0C, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x15, 0x18, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x95, 0x95, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x99,
-    0x99, 0x98, 0x97, 0x97, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97,
-    0x97, 0x99, 0x99, 0x9A, 0x97, 0x97, 0x1F, 0x1F, 0x1F, 0x1F, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x1F, 0x1F, 0x1F, 0x1F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x97, 0x9A, 0x9A, 0x98, 0x98, 0x97, 0x97, 0x9B, 0x9B, 0x98, 0x1F, 0x1F,
-    0x9F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D,
-    0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x18,
-    0x12, 0x0F, 0x30, 0x30, 0x30, 0x32, 0x34, 0x00, 0x1E, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x12,
-    0x0F, 0x12, 0x07, 0x16, 0x17, 0x18, 0x19, 0x08, 0x1C, 0x1E, 0x9D, 0x00, 0x00, 0x1E, 0x1D, 0x1C,
-    0x1B, 0x08, 0x14, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x1B, 0x1B, 0x08, 0x19, 0x19, 0x18, 0x17,
-    0x16, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x95, 0x95, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A,
-    0x9A, 0x9A, 0x98, 0x98, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x98, 0x98, 0x9A, 0x9A, 0x99, 0x99, 0x1F,
-    0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x98, 0x98, 0x98,
-    0x98, 0x9D, 0x99, 0x99, 0x9B, 0x9B, 0x98, 0x98, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x1F,
-    0x1F, 0x1F, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x9A, 0x97, 0x97, 0x99, 0x99, 0x1F, 0x1F, 0x1F, 0x1F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x99,
-    0x99, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x33, 0x13, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x31, 0x32, 0x32, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x9D, 0x00, 0x00, 0x17, 0x12, 0x12, 0x12, 0x13, 0x13, 0x07, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9F, 0x1F, 0x1F, 0x1F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9D,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x1F, 0x1F, 0x1F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9B,
-    0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x97, 0x97, 0x9B, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9D, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x33, 0x33, 0x0F, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x32, 0x33, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x19, 0x0F, 0x10, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19,
-    0x1A, 0x07, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x96, 0x96, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x9F, 0x1F, 0x1F,
-    0x9F, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9D, 0x1F, 0x1F, 0x9F, 0x99, 0x99, 0x98, 0x98,
-    0x98, 0x98, 0x99, 0x98, 0x98, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x99, 0x99, 0x1F, 0x1F, 0x97, 0x99, 0x99, 0x97, 0x97, 0x98,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x34, 0x15, 0x30, 0x30, 0x30, 0x30,
-    0x31, 0x32, 0x32, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x07, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x95, 0x95, 0x9B, 0x9B,
-    0x9B, 0x98, 0x98, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x99, 0x99, 0x99, 0x97, 0x97, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96,
-    0x96, 0x96, 0x96, 0x97, 0x99, 0x9F, 0x1F, 0x1F, 0x9F, 0x9B, 0x9B, 0x97, 0x97, 0x97, 0x99, 0x99,
-    0x99, 0x97, 0x97, 0x98, 0x98, 0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98,
-    0x9B, 0x1F, 0x1F, 0x9D, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97,
-    0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x1F, 0x1F,
-    0x9B, 0x9B, 0x98, 0x97, 0x97, 0x98, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x35, 0x14, 0x30, 0x30, 0x31, 0x31, 0x31, 0x32, 0x33, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19,
-    0x1A, 0x17, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x95, 0x95, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x97, 0x97, 0x9B, 0x9B, 0x9B,
-    0x99, 0x99, 0x97, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x99,
-    0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x97, 0x97, 0x97, 0x99, 0x99, 0x9F, 0x1F,
-    0x9F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x9B, 0x1F, 0x9F, 0x9D, 0x9B, 0x9B, 0x9B, 0x99,
-    0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x97, 0x97, 0x98, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x98, 0x98, 0x99, 0x99, 0x99, 0x1F, 0x1F, 0x9B, 0x9B, 0x99, 0x97, 0x97, 0x9C, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x14, 0x30, 0x30,
-    0x31, 0x32, 0x32, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2F,
-    0x00, 0x1E, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x18, 0x07, 0x08, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9A, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x9F, 0x1F, 0x9F, 0x1F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x99, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98,
-    0x9B, 0x1F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x9B,
-    0x99, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x99, 0x99, 0x1F, 0x9D, 0x9D,
-    0x9B, 0x97, 0x97, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x22, 0x18, 0x30, 0x31, 0x31, 0x31, 0x32, 0x33, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00, 0x00, 0x1B, 0x13, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19,
-    0x1A, 0x1A, 0x17, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A,
-    0x9B, 0x9B, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9B, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x9F, 0x1F,
-    0x1F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x98, 0x98, 0x97, 0x99, 0x99, 0x98, 0x9B, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B,
-    0x9B, 0x98, 0x98, 0x98, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98,
-    0x98, 0x9B, 0x99, 0x99, 0x1F, 0x9B, 0x9B, 0x99, 0x97, 0x97, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x04, 0x08, 0x30, 0x30,
-    0x31, 0x32, 0x32, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x00, 0x00,
-    0x1C, 0x07, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x18, 0x07, 0x1B, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x96, 0x96, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B, 0x98, 0x98,
-    0x98, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x9F, 0x1F, 0x1F, 0x9F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x9B,
-    0x1F, 0x9D, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x1F, 0x99, 0x99, 0x9B, 0x97,
-    0x97, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x28, 0x04, 0x08, 0x08, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x17, 0x18, 0x19,
-    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x1E, 0x1D, 0x1C, 0x08,
-    0x08, 0x1A, 0x14, 0x07, 0x07, 0x08, 0x08, 0x08, 0x1A, 0x18, 0x18, 0x17, 0x07, 0x0F, 0x07, 0x19,
-    0x1A, 0x1A, 0x1A, 0x17, 0x07, 0x1B, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B,
-    0x9D, 0x9B, 0x9B, 0x9B, 0x98, 0x98, 0x98, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x99, 0x99, 0x9F,
-    0x1F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x99, 0x99, 0x99, 0x97, 0x98, 0x98, 0x9B, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x9B, 0x9B, 0x99,
-    0x99, 0x99, 0x1F, 0x9B, 0x9B, 0x99, 0x97, 0x97, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x19, 0x17,
-    0x07, 0x13, 0x13, 0x12, 0x11, 0x11, 0x10, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x1C, 0x14, 0x07, 0x07, 0x08, 0x0C, 0x07,
-    0x14, 0x13, 0x12, 0x11, 0x0F, 0x04, 0x1C, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x07, 0x07, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x96, 0x96, 0x9B, 0x9D, 0x9D, 0x1F, 0x9D, 0x9D, 0x9D, 0x1F, 0x1F, 0x9D, 0x1F, 0x1F,
-    0x9D, 0x9D, 0x9D, 0x1F, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9D, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x99, 0x9B, 0x9B, 0x9F,
-    0x9F, 0x1F, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x1F, 0x1F, 0x9D, 0x9B, 0x9B, 0x97, 0x98,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x14, 0x07, 0x07, 0x08, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x04, 0x24, 0x19, 0x19,
-    0x1A, 0x1A, 0x1A, 0x19, 0x12, 0x0F, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1C, 0x1E, 0x9D, 0x9D,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x9B, 0x9A,
-    0x99, 0x99, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x9D,
-    0x1F, 0x1F, 0x9B, 0x97, 0x97, 0x97, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x14, 0x07, 0x07, 0x08, 0x0C, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x04, 0x36, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x12, 0x0F, 0x07, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x95, 0x95, 0x97, 0x99, 0x99, 0x97, 0x99, 0x99, 0x99, 0x98, 0x97, 0x97,
-    0x9A, 0x99, 0x99, 0x98, 0x97, 0x97, 0x97, 0x98, 0x99, 0x99, 0x98, 0x9F, 0x1F, 0x1F, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96,
-    0x96, 0x99, 0x99, 0x96, 0x96, 0x96, 0x96, 0x99, 0x99, 0x99, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x1F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x1F, 0x1F, 0x1F, 0x9B, 0x9B, 0x9B, 0x97, 0x99, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x18, 0x07, 0x07, 0x18, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2A, 0x0C, 0x19, 0x19,
-    0x1A, 0x1A, 0x16, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x97, 0x9F, 0x1F, 0x1F, 0x9B, 0x9B, 0x9D, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A,
-    0x99, 0x99, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x9B, 0x9B, 0x9D, 0x9B, 0x98, 0x98, 0x98, 0x99, 0x1F,
-    0x1F, 0x1F, 0x9B, 0x9B, 0x9B, 0x97, 0x9B, 0x9B, 0x9B, 0x97, 0x9B, 0x9B, 0x9A, 0x97, 0x97, 0x99,
-    0x98, 0x97, 0x97, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x08, 0x08, 0x08, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x07, 0x13, 0x11,
-    0x11, 0x13, 0x07, 0x17, 0x18, 0x19, 0x08, 0x08, 0x04, 0x04, 0x00, 0x18, 0x07, 0x07, 0x08, 0x07,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x2A, 0x0C, 0x0C, 0x19, 0x19, 0x1A, 0x12, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x9B, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A,
-    0x9A, 0x9A, 0x9A, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x97, 0x1F, 0x1F, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x9B, 0x9B, 0x1F, 0x98, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x98, 0x97,
-    0x9A, 0x99, 0x99, 0x97, 0x99, 0x99, 0x99, 0x97, 0x97, 0x98, 0x98, 0x97, 0x98, 0x99, 0x99, 0x97,
-    0x97, 0x97, 0x97, 0x99, 0x97, 0x97, 0x9B, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9B, 0x9D, 0x9A, 0x9A,
-    0x9B, 0x9A, 0x9A, 0x9A, 0x9B, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x08, 0x08, 0x1D, 0x1D,
-    0x00, 0x00, 0x1E, 0x1D, 0x1C, 0x08, 0x18, 0x07, 0x07, 0x17, 0x18, 0x08, 0x1D, 0x1D, 0x1B, 0x18,
-    0x0C, 0x0C, 0x04, 0x00, 0x08, 0x08, 0x08, 0x07, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x28, 0x0C, 0x19,
-    0x1A, 0x1A, 0x12, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x1D, 0x1D, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x98, 0x98, 0x98, 0x98,
-    0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x97, 0x97, 0x9B, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1C, 0x08, 0x1C, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x00, 0x15, 0x13, 0x12, 0x12, 0x13, 0x13, 0x16, 0x0C, 0x04, 0x08, 0x0F, 0x0F, 0x0F,
-    0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x34, 0x33, 0x19, 0x1A, 0x1A, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x9B, 0x99, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x96, 0x96, 0x98, 0x97, 0x98, 0x97, 0x97, 0x98, 0x96, 0x96, 0x96, 0x96, 0x98,
-    0x96, 0x96, 0x96, 0x96, 0x98, 0x1F, 0x1F, 0x9B, 0x9B, 0x9A, 0x9D, 0x9D, 0x9B, 0x9B, 0x9A, 0x9A,
-    0x99, 0x9B, 0x9B, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x9A, 0x9B, 0x9A, 0x97, 0x97, 0x9A, 0x99, 0x97,
-    0x98, 0x98, 0x99, 0x99, 0x98, 0x1F, 0x1F, 0x99, 0x9B, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x99,
-    0x99, 0x99, 0x9B, 0x98, 0x9B, 0x9B, 0x98, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1E, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x18, 0x0F, 0x10, 0x12, 0x12, 0x13,
-    0x13, 0x16, 0x0C, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x29, 0x33,
-    0x37, 0x22, 0x1A, 0x07, 0x07, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x96, 0x96, 0x9D, 0x9D, 0x99, 0x98, 0x98, 0x98, 0x9B, 0x97, 0x9B, 0x9A, 0x9A, 0x96,
-    0x95, 0x96, 0x96, 0x96, 0x96, 0x9A, 0x98, 0x99, 0x99, 0x99, 0x97, 0x97, 0x96, 0x9D, 0x9D, 0x1F,
-    0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x9A, 0x9B, 0x9B,
-    0x99, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x9A, 0x99, 0x9B, 0x9B, 0x9A, 0x9B, 0x1F, 0x9B, 0x9D,
-    0x9D, 0x9B, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x96, 0x96, 0x96, 0x99, 0x98, 0x98, 0x98,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x08, 0x00, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x19, 0x18, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x29, 0x31, 0x30, 0x07, 0x0F, 0x0F, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D,
-    0x9B, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x9B, 0x98, 0x98, 0x9A, 0x98, 0x96, 0x96,
-    0x9A, 0x99, 0x96, 0x98, 0x96, 0x96, 0x9D, 0x1F, 0x1F, 0x1F, 0x9D, 0x9D, 0x1F, 0x9D, 0x1F, 0x9D,
-    0x1F, 0x9D, 0x9D, 0x1F, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x99, 0x9B, 0x9B, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9B, 0x9A, 0x9A, 0x9B, 0x9B, 0x9A, 0x99,
-    0x99, 0x99, 0x9B, 0x98, 0x98, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x00, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x16, 0x1B, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x17, 0x0F, 0x0F, 0x19, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1C, 0x1C, 0x1E, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0x9B,
-    0x9B, 0x9D, 0x9B, 0x9B, 0x99, 0x9B, 0x99, 0x9B, 0x9D, 0x9A, 0x98, 0x98, 0x97, 0x97, 0x1F, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x1F, 0x1F, 0x9D, 0x9D, 0x9B, 0x9A, 0x9B, 0x9B, 0x9A,
-    0x9A, 0x9A, 0x98, 0x98, 0x97, 0x98, 0x99, 0x99, 0x99, 0x9B, 0x9D, 0x1F, 0x1F, 0x9E, 0x9D, 0x9D,
-    0x9D, 0x9A, 0x9B, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x9B, 0x9B, 0x98, 0x98, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x18, 0x1E, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x19, 0x1A, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x1F, 0x9D, 0x9D, 0x9D, 0x99, 0x9D, 0x9B, 0x99, 0x9D, 0x1F,
-    0x9D, 0x98, 0x98, 0x99, 0x98, 0x99, 0x98, 0x9A, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9B,
-    0x97, 0x9E, 0x9E, 0x1F, 0x1F, 0x9D, 0x1F, 0x9D, 0x9B, 0x9B, 0x9D, 0x9B, 0x9D, 0x9D, 0x9B, 0x9A,
-    0x9A, 0x9B, 0x9B, 0x99, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x1C, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2F, 0x00, 0x1E, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x16, 0x1B, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x96, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x98, 0x98,
-    0x9A, 0x9A, 0x9A, 0x98, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x98, 0x99, 0x97, 0x9D, 0x1F, 0x1F, 0x1F,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x1F, 0x9D, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9A, 0x9B,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x1F, 0x9D, 0x9E, 0x1F, 0x1F, 0x9A, 0x9A, 0x99, 0x99,
-    0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1A, 0x07, 0x08, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00,
-    0x00, 0x1B, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x19, 0x1A, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96,
-    0x96, 0x9D, 0x9D, 0x9D, 0x9B, 0x9D, 0x9A, 0x9A, 0x99, 0x98, 0x98, 0x98, 0x1F, 0x99, 0x98, 0x99,
-    0x9A, 0x9A, 0x1F, 0x9B, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x9F, 0x9D, 0x9B, 0x9B, 0x9B, 0x9D, 0x9B, 0x9D, 0x9A, 0x9A, 0x98, 0x99, 0x9A,
-    0x9A, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x08, 0x32, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x00, 0x00, 0x1B, 0x07, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x16, 0x1B, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9B, 0x9B, 0x9D, 0x9D, 0x1F, 0x9D, 0x9D, 0x9D, 0x9A, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B,
-    0x9A, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9B, 0x9D, 0x1F, 0x1F, 0x9F, 0x9F, 0x9D, 0x1F, 0x9D, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x07, 0x08, 0x33, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x08, 0x08, 0x04, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x08, 0x18, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x96, 0x9D, 0x9A, 0x9B, 0x9B, 0x99, 0x98, 0x97, 0x99, 0x99, 0x97, 0x99, 0x98, 0x97,
-    0x97, 0x97, 0x96, 0x96, 0x96, 0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9B, 0x99, 0x99, 0x99, 0x96, 0x99,
-    0x99, 0x98, 0x99, 0x9B, 0x9A, 0x98, 0x98, 0x99, 0x99, 0x9B, 0x9A, 0x98, 0x98, 0x97, 0x96, 0x99,
-    0x96, 0x99, 0x96, 0x9A, 0x98, 0x97, 0x98, 0x97, 0x97, 0x98, 0x96, 0x96, 0x95, 0x98, 0x97, 0x98,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x1C, 0x32, 0x33, 0x0C, 0x35, 0x36,
-    0x07, 0x0F, 0x0F, 0x08, 0x28, 0x29, 0x00, 0x00, 0x0F, 0x07, 0x07, 0x08, 0x00, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x18, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x9D, 0x9D, 0x9D, 0x9B,
-    0x9D, 0x9B, 0x9D, 0x9D, 0x9A, 0x98, 0x99, 0x9D, 0x9A, 0x98, 0x96, 0x98, 0x96, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x98, 0x98,
-    0x98, 0x97, 0x97, 0x96, 0x97, 0x98, 0x98, 0x9A, 0x1F, 0x9B, 0x9A, 0x99, 0x99, 0x98, 0x99, 0x1F,
-    0x99, 0x99, 0x99, 0x9A, 0x98, 0x97, 0x97, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x18, 0x1D, 0x33, 0x33, 0x0C, 0x35, 0x36, 0x0F, 0x0F, 0x18, 0x11, 0x19, 0x2A, 0x2A, 0x00,
-    0x00, 0x07, 0x08, 0x00, 0x13, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x17, 0x13, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD, 0xF2, 0xF2, 0xEF, 0xF2,
-    0x7C, 0x7C, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-    0x7F, 0x7F, 0x7F, 0x7F, 0xFA, 0xFB, 0xFB, 0xFD, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x08, 0x1E, 0x32, 0x33, 0x0C, 0x35, 0x07,
-    0x0F, 0x1D, 0x1D, 0x1D, 0x0F, 0x07, 0x2A, 0x2D, 0x00, 0x00, 0x00, 0x16, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x0F, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1B, 0xFD, 0xF4, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
-    0xF3, 0xF3, 0xF3, 0xF3, 0xF4, 0xF4, 0xF4, 0xF5, 0xF7, 0xF7, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
-    0xF6, 0xF7, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF8, 0xF9, 0xF9, 0xFC, 0xFC, 0xF9, 0xFC,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x1C, 0x00, 0x33, 0x33, 0x0C, 0x35, 0x18, 0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x0F, 0x07, 0x00,
-    0x00, 0x00, 0x1B, 0x13, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x0F, 0x0F, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD, 0xF7, 0xF8, 0xF4, 0xF2,
-    0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF4,
-    0xF7, 0xFA, 0xF7, 0xF5, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF7, 0xF7,
-    0xF7, 0xF8, 0xF8, 0xF9, 0xFC, 0xFD, 0xFD, 0xFC, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1C, 0x00, 0x32, 0x33, 0x0C, 0x35, 0x1C,
-    0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0F, 0x07, 0x00, 0x00, 0x18, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x07, 0x0F, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x1A,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1B, 0xFD, 0xF6, 0x7D, 0xF0, 0xF4, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF2,
-    0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x79, 0xF2, 0xF3, 0xF4, 0xEF, 0xF3, 0xF4, 0xF4, 0xF4, 0xF5,
-    0xF5, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF7, 0xFA, 0xFD, 0xF4, 0xFB,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x1D, 0x08, 0x33, 0x33, 0x0C, 0x35, 0x00, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0F,
-    0x19, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x0F, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD, 0xF4, 0xF4, 0xF4, 0xF4,
-    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF2, 0xF2, 0xF2,
-    0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF4, 0xF4, 0xF5, 0xF5, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6,
-    0xF6, 0xF6, 0xF7, 0xF6, 0xF7, 0xF7, 0xF9, 0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x18, 0x08, 0x08, 0x0C, 0x35, 0x36,
-    0x00, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x11, 0x08, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x0F, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0xEB, 0xEB, 0x1A,
-    0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1B, 0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0xFB, 0xFB,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1E, 0x1B, 0x07, 0x07, 0x08, 0x08, 0x36, 0x22, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x11, 0x08, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x0F, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1A, 0x1A, 0x1A, 0xEB, 0xEB, 0xEB, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x9B, 0x99, 0x98, 0x98,
-    0x98, 0x96, 0x97, 0x98, 0x98, 0x96, 0x96, 0x98, 0x96, 0x96, 0x98, 0x00, 0x9B, 0x9D, 0x9D, 0x9A,
-    0x9A, 0x9B, 0x99, 0x9B, 0x99, 0x9A, 0x9A, 0x97, 0x99, 0x97, 0x99, 0x99, 0x9F, 0x99, 0x9B, 0x99,
-    0x9A, 0x9B, 0x99, 0x9B, 0x98, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x07, 0x07, 0x18,
-    0x18, 0x16, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x08, 0x11, 0x12, 0x12, 0x0F,
-    0x07, 0x04, 0x37, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0x1B, 0xEB,
-    0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1C, 0x1E, 0x9B, 0x9B, 0x9B, 0x9D, 0x9D, 0x9D, 0x99, 0x9B, 0x9D, 0x9D,
-    0x9B, 0x9A, 0x97, 0x00, 0x9A, 0x99, 0x9B, 0x9D, 0x00, 0x9B, 0x9B, 0x9A, 0x9A, 0x9B, 0x9A, 0x97,
-    0x97, 0x99, 0x99, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9B, 0x9B, 0x9A, 0x9B, 0x9B, 0x98, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x07, 0x08, 0x08, 0x08, 0x04, 0x04, 0x08, 0x04, 0x37, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1A, 0x1A, 0x1A, 0xEB, 0x1B, 0x1B, 0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x9D, 0x9D,
-    0x9D, 0x9A, 0x97, 0x9A, 0x98, 0x9F, 0x9D, 0x9D, 0x9A, 0x9B, 0x9D, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9F, 0x9D, 0x9D, 0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x9D, 0x9F, 0x9F, 0x9D, 0x9B, 0x9A, 0x9A,
-    0x98, 0x98, 0x99, 0x99, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x08, 0x08,
-    0x08, 0x08, 0x1A, 0x19, 0x17, 0x07, 0x12, 0x0F, 0x0F, 0x12, 0x07, 0x0C, 0x0C, 0x0C, 0x04, 0x04,
-    0x08, 0x14, 0x14, 0x04, 0x35, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0xEB, 0xEB, 0xEA, 0xEA, 0x1B,
-    0xEB, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x9D, 0x99, 0x99, 0x9B, 0x9B, 0x9A, 0x97, 0x98, 0x96,
-    0x98, 0x96, 0x9F, 0x9D, 0x9D, 0x9D, 0x9B, 0x9D, 0x99, 0x9B, 0x9D, 0x9A, 0x9A, 0x9B, 0x9D, 0x9B,
-    0x9A, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x98, 0x98, 0x95, 0x98, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1C, 0x00, 0x0C, 0x00, 0x1C, 0x19, 0x17, 0x07, 0x17, 0x19, 0x08, 0x1C, 0x1D,
-    0x1D, 0x1D, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x13, 0x14, 0x14, 0x07, 0x04, 0x0C, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0xEA, 0xEA, 0x1B, 0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96,
-    0x9D, 0x9D, 0x9B, 0x99, 0x99, 0x9B, 0x9B, 0x98, 0x9B, 0x9B, 0x97, 0x97, 0x9F, 0x9D, 0x9D, 0x9D,
-    0x9B, 0x9B, 0x9D, 0x9B, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x99, 0x9F, 0x9B, 0x9B, 0x99, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x9D, 0x00, 0x00, 0x17, 0x13, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x0C, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0xEA, 0xEA, 0xEA,
-    0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x9B, 0x9D, 0x99, 0x9B, 0x9B, 0x99, 0x97,
-    0x97, 0x99, 0x99, 0x98, 0x98, 0x99, 0x9F, 0x9D, 0x9B, 0x9B, 0x99, 0x97, 0x98, 0x99, 0x9E, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9A, 0x98, 0x99, 0x9B, 0x99, 0x9D, 0x97, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x00, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x18, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x0C, 0x07, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0xEA, 0x1C, 0xEA, 0x1B, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x96, 0x99, 0x99, 0x98, 0x9B, 0x9A, 0x98, 0x98, 0x9C, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0x99, 0x99, 0x9C, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98,
-    0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x00, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x0F, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0xEA, 0x1C, 0xEA,
-    0xEA, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x96, 0x99, 0x99, 0x98, 0x9B, 0x9A, 0x98,
-    0x98, 0x9F, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9C, 0x99,
-    0x99, 0x9F, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x9D, 0x1D, 0x1B, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x12, 0x0F, 0x1A, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0x1C, 0x1C, 0xEC, 0x1C, 0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x96, 0x9B, 0x9D, 0x9A, 0x9B, 0x99, 0x9B, 0x9A, 0x97, 0x9B, 0x97, 0x9F, 0x9B, 0x9D,
-    0x9D, 0x9D, 0x9D, 0x9B, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9D, 0x9B, 0x9B, 0x9A, 0x99, 0x9B, 0x9B,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x32, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2F, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x0F, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0x1C, 0xEC, 0xEC,
-    0xEC, 0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xDA, 0xDA, 0xDA, 0xD9, 0xD7, 0xD7,
-    0x9E, 0xD7, 0xD7, 0x9B, 0x00, 0x9F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F,
-    0x1F, 0x9F, 0x9F, 0x9E, 0x9D, 0x9F, 0x9F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x07, 0x08, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00,
-    0x00, 0x1E, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x0F, 0x07, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0x1C, 0xEC, 0x1D, 0xEC, 0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xD3, 0xD4, 0xD4, 0xDB, 0xD8, 0xD8,
-    0xD8, 0xD8, 0xD9, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xD9, 0xD7, 0xD7, 0xDC, 0x9F, 0x00, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x9F, 0x9F, 0x9D, 0x9D, 0x9E, 0x9D, 0x9D, 0x9F, 0x9D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x08, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x00, 0x00, 0x00, 0x1B, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x12, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0x1C, 0xEC, 0x1D,
-    0x1D, 0xEA, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0xD3, 0xD2, 0xD2, 0xD2, 0xD4, 0xDB, 0xD7, 0xD7, 0xD7, 0xD7, 0xD9, 0xDA, 0xDA, 0xDA, 0xD9,
-    0xD9, 0xD9, 0xDA, 0xDA, 0xD8, 0xDC, 0x1F, 0x1F, 0x1F, 0x9B, 0x9D, 0x1F, 0x1F, 0x9E, 0x9C, 0x00,
-    0x1F, 0x9F, 0x1F, 0x9E, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x19, 0x08, 0x0C, 0x35, 0x0F, 0x11, 0x15, 0x17, 0x19, 0x1C, 0x00, 0x00, 0x00,
-    0x1B, 0x07, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x18, 0x00, 0x1A, 0x17, 0x12, 0x0F, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0xEA, 0xEC, 0xEE, 0x1D, 0x1C, 0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xD3, 0xD2, 0xD1, 0xD1, 0xD1, 0xD4, 0xDB,
-    0xD7, 0xD4, 0xD4, 0xDA, 0xD9, 0xDA, 0xDA, 0xD9, 0xDB, 0xD9, 0xDA, 0xD9, 0xD8, 0xD7, 0xD7, 0xD6,
-    0xD5, 0xF3, 0xF3, 0xF4, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x08, 0x35, 0x11,
-    0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x13, 0x11, 0x12, 0x12, 0x13,
-    0x18, 0x08, 0x1C, 0x0F, 0x12, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0xEA, 0xEC, 0xED,
-    0xEE, 0xEC, 0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0xD5, 0xD3, 0xD2, 0xCF, 0xCF, 0xCF, 0xDB, 0xD3, 0xD8, 0xD6, 0xDA, 0xD9, 0xDA, 0xDC, 0xD9,
-    0xDD, 0xD9, 0xDC, 0xD9, 0xD9, 0xD9, 0xD8, 0xD8, 0xD7, 0xD6, 0xDC, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1E, 0x08, 0x1A, 0x08, 0x07, 0x08, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x1C, 0x08, 0x08, 0x18, 0x16, 0x12, 0x12, 0x13, 0x13, 0x18, 0x08, 0x08, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1A, 0x1A, 0xEB, 0x1B, 0xEA, 0xEC, 0xED, 0xED, 0x1D, 0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xDC, 0xD7, 0xD2, 0xD2, 0xD2, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xD6, 0xD5, 0xD3, 0xD8, 0xD5, 0xCF, 0xDB,
-    0xD8, 0xD8, 0xDA, 0xDC, 0xDA, 0xDC, 0xDE, 0xDC, 0xDD, 0xDA, 0xDC, 0xDA, 0xDA, 0xD9, 0xD9, 0xD9,
-    0xD8, 0xD3, 0xD7, 0xDC, 0x9A, 0x1F, 0x9E, 0x1F, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x08, 0x08,
-    0x08, 0x1A, 0x19, 0x19, 0x17, 0x07, 0x0F, 0x07, 0x19, 0x1A, 0x08, 0x08, 0x08, 0x18, 0x12, 0x13,
-    0x13, 0x14, 0x18, 0x1F, 0x08, 0x18, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x1B, 0xEA, 0xEC, 0xED,
-    0xED, 0x1D, 0x1B, 0xEB, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A,
-    0x00, 0xDE, 0xD6, 0xD2, 0xD2, 0xCF, 0xDB, 0xDA, 0xD7, 0xD7, 0x19, 0x19, 0x19, 0xDB, 0xDB, 0xDB,
-    0x19, 0xD8, 0xD6, 0xD8, 0xD3, 0xD3, 0xCF, 0x00, 0xDC, 0xDB, 0xDC, 0xDD, 0xDC, 0xDD, 0xDE, 0xDE,
-    0xDF, 0xDD, 0xDC, 0xDC, 0xDC, 0xDC, 0xDA, 0xD8, 0xDA, 0xD9, 0xD7, 0xD5, 0xDC, 0x99, 0x9A, 0x99,
-    0x9B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1C, 0x1B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x1C, 0x1C, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x1F, 0x1D, 0x18, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1A, 0x1A, 0x1B, 0xEA, 0xEC, 0x1E, 0xED, 0x1D, 0xEA, 0xEB, 0x1A, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1C, 0x00, 0xDE, 0xDB, 0xDB, 0xD6, 0xD1, 0xCF, 0xCF, 0xD9,
-    0xD1, 0xD7, 0xD7, 0xD7, 0xDB, 0xD9, 0xD9, 0xD7, 0xDB, 0xDB, 0xD8, 0xDA, 0xD3, 0xCF, 0xD6, 0x00,
-    0x00, 0xDD, 0xDD, 0xDD, 0xDF, 0x00, 0x00, 0xDE, 0xDF, 0x00, 0x00, 0xDE, 0xDF, 0xDC, 0xDC, 0xDA,
-    0xD9, 0xD9, 0xD9, 0xD7, 0xD5, 0x9A, 0x9A, 0x97, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x00, 0x17, 0x13, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x18, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1B, 0xEA, 0x1C, 0x1E,
-    0xED, 0xED, 0x1D, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1C, 0x00, 0x00, 0x00,
-    0xDA, 0xD8, 0xD8, 0xDB, 0xD1, 0xCE, 0xCE, 0xD5, 0xD6, 0xD0, 0xD4, 0xD4, 0xD9, 0xD9, 0xD5, 0xD4,
-    0xD7, 0xDA, 0xDA, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0x00, 0xDF, 0xDF, 0xDF,
-    0xDF, 0xDD, 0xDD, 0xDD, 0xD8, 0xDA, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD7, 0xD5, 0x9A, 0x98, 0x9B,
-    0x9B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x00, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x18, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x18, 0x0F, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1A, 0x1A, 0x1B, 0xEA, 0x1C, 0x1E, 0xED, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0x19, 0x19, 0x1A, 0x1C, 0x00, 0x00, 0x00, 0xDC, 0xD9, 0xD8, 0xD6, 0xD4, 0xD4, 0xD0, 0xCE, 0xCE,
-    0xD4, 0xD0, 0xD1, 0xD1, 0xD4, 0xD9, 0xD9, 0xD2, 0xD2, 0xDC, 0xD6, 0xD5, 0xD8, 0xDA, 0xDC, 0xDF,
-    0xDE, 0x00, 0x00, 0x00, 0xDF, 0xDF, 0xDE, 0xDD, 0xDB, 0xDB, 0xD8, 0xD8, 0xDA, 0xD8, 0xD8, 0xD9,
-    0xD9, 0xDA, 0xDB, 0xDE, 0xDE, 0xDE, 0x9A, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1B, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x0F, 0x12, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1B, 0xEA, 0x1C, 0x1E,
-    0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA,
-    0xD9, 0xD8, 0xD6, 0xD6, 0xD4, 0xD0, 0xCE, 0xCE, 0xD1, 0xD1, 0xD0, 0xD0, 0xD1, 0xD2, 0xD9, 0xCF,
-    0xD2, 0xD6, 0xD2, 0xD6, 0xD5, 0xD8, 0xDA, 0xDC, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0xDE, 0xDC, 0xDB,
-    0xDB, 0xD8, 0xD8, 0xD9, 0xDA, 0xD8, 0xDA, 0xDE, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x9B,
-    0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1F, 0x1D, 0x19, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x12, 0x0F, 0x07, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1A, 0x1A, 0xEB, 0xEA, 0xEA, 0x1E, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xD9, 0xD8, 0xD6, 0xD6, 0xD4, 0xD0, 0xCE, 0xCE,
-    0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD1, 0xD2, 0xCF, 0xCE, 0xD3, 0xD6, 0xD2, 0xD4, 0xD2, 0xD7, 0xDA,
-    0xDE, 0x00, 0x00, 0x00, 0xDE, 0xDC, 0xDA, 0xDB, 0xD6, 0xD5, 0xD8, 0xDA, 0xD4, 0xD9, 0xDE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x9C, 0x9B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x32, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2F, 0x00, 0x1E, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x12, 0x12, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0xEB, 0x1B, 0xEA, 0xED,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA,
-    0xD9, 0xD8, 0xD6, 0xD6, 0xD4, 0xD0, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xD2, 0xCF,
-    0xCE, 0xD3, 0xD6, 0xD1, 0xD2, 0xD0, 0xD5, 0xDA, 0x00, 0x00, 0x00, 0xDE, 0xDA, 0xD9, 0xDB, 0xD6,
-    0xD4, 0xD5, 0xD9, 0xDA, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B,
-    0x9B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x07, 0x08, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00,
-    0x00, 0x1B, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x0F, 0x07, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0xEB, 0x1B, 0xEA, 0xEE, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xD9, 0xD8, 0xD6, 0xD6, 0xD4, 0xD0, 0xCF, 0xCF,
-    0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCE, 0xD1, 0xD6, 0xCE, 0xD2, 0xD0, 0xD5, 0xDA,
-    0x00, 0x00, 0x00, 0xDE, 0xDA, 0xD8, 0xD9, 0xD6, 0xD3, 0xD5, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xDC, 0xDA, 0xDA, 0xDB, 0xDB, 0xDC, 0x00, 0x9D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1B, 0x1D,
-    0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x08, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x00, 0x00, 0x1B, 0x07, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x12, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1B, 0xEA, 0x1D,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA,
-    0xD9, 0xD9, 0xD6, 0xD6, 0xD4, 0xD0, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
-    0xCE, 0xD1, 0xD6, 0xCE, 0xD2, 0xCF, 0xD5, 0xDA, 0x00, 0x00, 0x00, 0xDE, 0xDA, 0xDA, 0xD7, 0xD6,
-    0xD5, 0xD7, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0xDC, 0xD8, 0xD8, 0xDA, 0xDB, 0x00, 0x00, 0x1E, 0x1C,
-    0x1F, 0x1D, 0x1D, 0x1D, 0x1E, 0x00, 0x00, 0x1B, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x18, 0x08, 0x0C, 0x35, 0x0F, 0x12, 0x07, 0x18, 0x1A, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x22, 0x22, 0x35, 0x0C, 0x35, 0x22, 0x04, 0x07, 0x14, 0x12, 0x0F, 0x1A, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1A, 0x1B, 0x1B, 0xEC, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xDA, 0xD9, 0xD9, 0xD6, 0xD4, 0xD3, 0xD0, 0xCE, 0xCF,
-    0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCE, 0xD1, 0xD6, 0xCE, 0xCE, 0xCE, 0xD5, 0xDA,
-    0x00, 0x00, 0x00, 0xDE, 0xDA, 0xD7, 0xD7, 0xD3, 0xD9, 0x00, 0x00, 0x1D, 0x19, 0x00, 0xD7, 0xD7,
-    0xD7, 0xDA, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1C, 0x1D, 0x00, 0xDD, 0xD7, 0xD8, 0x00, 0x00,
-    0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x08, 0x35, 0x07,
-    0x08, 0x1B, 0x1A, 0x18, 0x17, 0x17, 0x07, 0x12, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x33,
-    0x0C, 0x04, 0x14, 0x0F, 0x12, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0xEB, 0x1B, 0xEC,
-    0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xDB,
-    0xD9, 0xD9, 0xD8, 0xD3, 0xD1, 0xCF, 0xCE, 0xCE, 0xD2, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD2, 0xCF,
-    0xCE, 0xD3, 0xD6, 0xCE, 0xCE, 0xCE, 0xD5, 0xDA, 0x00, 0x00, 0x00, 0xDE, 0xDA, 0xD7, 0xD3, 0xD8,
-    0x00, 0x08, 0x00, 0x1C, 0x07, 0xD5, 0xD5, 0xD7, 0xD9, 0xDB, 0x00, 0x00, 0x00, 0x1B, 0x19, 0x00,
-    0xD7, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xDB, 0xDB, 0x1E, 0x18, 0x1C, 0x1C, 0x1C, 0x1C, 0x08, 0x1A,
-    0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1A, 0x08, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1A, 0x1A, 0x12, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1A, 0xEB, 0x1B, 0xEC, 0x1D, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xDB, 0xDA, 0xD8, 0xD6, 0xD1, 0xD0, 0xCF, 0xCE, 0xD5,
-    0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xD2, 0xD2, 0xCF, 0xD1, 0xD6, 0xD3, 0xD1, 0xCE, 0xCE, 0xD2, 0xDC,
-    0x00, 0x00, 0x00, 0xDE, 0xDA, 0xD7, 0xD8, 0x00, 0x00, 0x00, 0x08, 0x11, 0xD5, 0xD5, 0xD5, 0xD5,
-    0xD7, 0x00, 0x00, 0x00, 0x1B, 0x19, 0x00, 0xD7, 0x00, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xDE,
-    0x1D, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1A, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x18, 0x07, 0x07, 0x08, 0x08, 0x04, 0x21, 0x36,
-    0x35, 0x0C, 0x21, 0x27, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0xEB, 0x1B, 0x1C,
-    0x1D, 0x1E, 0xEE, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xDB, 0xD6, 0xD3, 0xD0, 0xCF, 0xCC, 0xCF, 0xD3, 0xCE, 0xD1, 0xD1, 0xD1, 0xD2, 0xD4, 0xD6, 0xCF,
-    0xD2, 0xD9, 0xD0, 0xD0, 0xCE, 0xD1, 0xD5, 0x1C, 0x1C, 0x08, 0x1A, 0xDE, 0xDA, 0xD8, 0xDE, 0x00,
-    0x00, 0x00, 0x1F, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xDA, 0x00, 0x1B, 0x19, 0x00, 0xD7, 0x00,
-    0xD3, 0xD5, 0xD2, 0xD2, 0xCD, 0xCF, 0x1B, 0xDB, 0x1D, 0x17, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x16, 0x18, 0x1A, 0x1C, 0x1E, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x17,
-    0x13, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x37, 0x35, 0x0C, 0x21, 0x29, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0xEB, 0xEB, 0x1C, 0x1D, 0xEE, 0x1E, 0xEE, 0x1C, 0x1B, 0x1A, 0x1A,
-    0x19, 0x19, 0x1A, 0x1A, 0x1B, 0x1D, 0x1E, 0x00, 0xDB, 0xD7, 0xD2, 0xD0, 0xCC, 0xCF, 0xD3, 0xCF,
-    0xD2, 0xD5, 0xD5, 0xD5, 0xD8, 0xD8, 0xD5, 0xD2, 0xD2, 0xDA, 0xD1, 0xCE, 0xD0, 0xD0, 0xD4, 0x1C,
-    0x19, 0x19, 0x18, 0xDE, 0xDA, 0xDE, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
-    0xDA, 0xDA, 0xDC, 0x00, 0x00, 0xD7, 0x00, 0xD4, 0xD1, 0xCD, 0xCF, 0xCF, 0xC9, 0xCE, 0x96, 0xDB,
-    0x1D, 0x17, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1A, 0x08, 0x0C, 0x25, 0x00,
-    0x07, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x10, 0x1B, 0x00, 0x00, 0x19, 0x15, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x17, 0x0C, 0x29, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0xEB, 0x1C,
-    0x1D, 0xEE, 0x1E, 0x1E, 0x1D, 0x1C, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0xDF, 0xDB, 0xD2, 0xD2, 0xD7, 0xD3, 0xDB, 0xD8, 0xD8, 0xD8, 0xD8, 0xDA, 0xDD, 0xD7, 0xD5,
-    0xD7, 0xDA, 0xDA, 0xD7, 0xD4, 0xD4, 0xD4, 0x1C, 0x19, 0x18, 0x17, 0xDE, 0xDB, 0x00, 0x00, 0x00,
-    0x1F, 0xDC, 0xDA, 0xDA, 0xDA, 0xD9, 0xD9, 0xD9, 0xD9, 0xDC, 0xDC, 0x00, 0xCD, 0xD1, 0x00, 0xD1,
-    0xCB, 0xD4, 0xCF, 0xD5, 0xD2, 0xCB, 0xDB, 0xD7, 0x1D, 0x07, 0x1A, 0x08, 0x08, 0x08, 0x08, 0x1A,
-    0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x08, 0x1E, 0x0C, 0x35, 0x36, 0x08, 0x07, 0x1C, 0x1D, 0x1D, 0x1D, 0x13, 0x2D,
-    0x00, 0x00, 0x19, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x14, 0x18, 0x0C, 0x21, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0xEB, 0xEA, 0xEC, 0x1D, 0x1E, 0x1E, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x1B, 0x1A, 0x19, 0x1A, 0x1B, 0x1E, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
-    0xDF, 0xDF, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDE, 0xDC, 0xDC, 0xDC, 0x08,
-    0x18, 0x18, 0x17, 0xDE, 0xDE, 0x00, 0x00, 0x1F, 0xDC, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD7, 0xD7,
-    0xD7, 0xDA, 0xDC, 0x00, 0xD0, 0xD7, 0x00, 0xD1, 0xCB, 0xD2, 0xCF, 0xD7, 0xCF, 0xD1, 0xD1, 0xD3,
-    0x1D, 0x07, 0x19, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1E, 0x0C, 0x35, 0x36,
-    0x23, 0x08, 0x07, 0x1D, 0x1D, 0x1C, 0x17, 0x2D, 0x00, 0x00, 0x17, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x08, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xEB, 0x1B,
-    0x1C, 0x1D, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xDF, 0xDF, 0xDF, 0xDE, 0xDE, 0xDF, 0xDD, 0xDD, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDD, 0xDD,
-    0xDF, 0xDC, 0xDC, 0xDC, 0xDA, 0xD8, 0xDA, 0x08, 0x18, 0x18, 0x16, 0xDE, 0x00, 0x00, 0x00, 0xDC,
-    0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD2, 0xD2, 0xD5, 0xDA, 0x00, 0x00, 0xD3, 0xD7, 0x00, 0xCD,
-    0xCB, 0xD2, 0xCB, 0xD7, 0xC9, 0xC9, 0xCD, 0xD1, 0x1D, 0x07, 0x18, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1F, 0x1E, 0x00, 0x0C, 0x35, 0x36, 0x23, 0x08, 0x12, 0x1D, 0x1D, 0x17, 0x1B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x08, 0x37, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xEB, 0x1B, 0xEA, 0x1D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE, 0xDD, 0xDE,
-    0xDE, 0xDD, 0xDD, 0xDB, 0xDD, 0xDD, 0xDD, 0xDD, 0xD9, 0xD9, 0xD8, 0xD8, 0xD7, 0xD7, 0xD7, 0x1A,
-    0x18, 0x17, 0x16, 0xDE, 0x00, 0x00, 0xDC, 0xD5, 0xD8, 0xD8, 0xD8, 0xD8, 0xDA, 0xDA, 0xD3, 0xD2,
-    0xD5, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xCD, 0xCB, 0xD2, 0xCB, 0xD3, 0xCD, 0xCB, 0xDB, 0xD7,
-    0x1D, 0x07, 0x17, 0x18, 0x18, 0x18, 0x18, 0x17, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x00, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x08, 0x0F, 0x1D, 0x1D, 0x17, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x18, 0x24, 0x24, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0xEB,
-    0x1B, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xDF, 0xDD, 0xDF, 0xDB, 0xDE, 0xDC, 0xDE, 0xDB, 0xDB, 0xDA, 0xDC, 0xDB, 0xDD, 0xDD, 0xDD, 0xDD,
-    0xD9, 0xD9, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xDC, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0xD7, 0xD8,
-    0xD2, 0xD2, 0xD2, 0xD2, 0xD5, 0xD9, 0xCE, 0xD2, 0xD2, 0x00, 0x11, 0x18, 0x00, 0xD6, 0x00, 0xCD,
-    0xCA, 0xCA, 0xCA, 0xCB, 0xC8, 0xCC, 0x1B, 0xDB, 0x1D, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15,
-    0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x17, 0x0F, 0x1D, 0x08, 0x19, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x08, 0x04, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0xEB, 0x1B, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xDF, 0xDF, 0xDB, 0xDB, 0xDB, 0xDE, 0xDB, 0xD9,
-    0xDA, 0xDA, 0xDA, 0xDA, 0xDC, 0xDC, 0xDD, 0xDE, 0xD9, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xD9, 0xDA,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0xDC, 0xD8, 0xD8, 0xD6, 0xD6, 0xD6, 0xD8, 0xDA, 0xD6, 0xCE, 0xD1,
-    0xD2, 0x00, 0x07, 0x11, 0x00, 0x00, 0xD2, 0xDD, 0xC9, 0xCD, 0xCE, 0xCB, 0xC8, 0xCC, 0x96, 0xDB,
-    0x1D, 0x12, 0x07, 0x17, 0x17, 0x17, 0x15, 0x14, 0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x0F, 0x32, 0x33, 0x0C, 0x35, 0x36,
-    0x08, 0x11, 0x17, 0x08, 0x19, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x18, 0x08, 0x28, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A,
-    0x1A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9,
-    0xDE, 0xDB, 0xDA, 0xD9, 0xDA, 0xDB, 0xD9, 0xD9, 0xD9, 0xDA, 0xD9, 0xD8, 0xDA, 0xDC, 0xDD, 0xDE,
-    0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD9, 0xDA, 0xDA, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0xD8, 0xD8, 0xD3,
-    0xD2, 0xD2, 0xD2, 0xD5, 0xD9, 0xD4, 0x07, 0xD1, 0xCF, 0xD9, 0x00, 0x07, 0x11, 0x08, 0x00, 0xD2,
-    0xDD, 0xCE, 0xC9, 0xC9, 0xC8, 0xCA, 0xCE, 0xDE, 0x1D, 0x11, 0x07, 0x07, 0x07, 0x14, 0x13, 0x13,
-    0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x07, 0x0F, 0x33, 0x0C, 0x35, 0x36, 0x08, 0x08, 0x08, 0x08, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x07, 0x07, 0x08, 0x07, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0xE9, 0xDE, 0xD9, 0xD9, 0xD9, 0xD9, 0xD8, 0xD7, 0xD7,
-    0xD9, 0xD9, 0xD9, 0xD8, 0xD7, 0xDA, 0xDC, 0xDD, 0xD4, 0xD4, 0xD7, 0xD7, 0xD8, 0xD8, 0xDA, 0xDA,
-    0x1F, 0x1F, 0x1F, 0x00, 0xDC, 0xD5, 0xD8, 0xD3, 0xD2, 0xD2, 0xD2, 0xD5, 0xD8, 0xD4, 0x07, 0xD1,
-    0xCF, 0xD4, 0x00, 0x00, 0x08, 0x1E, 0x1E, 0x00, 0xD6, 0xD6, 0xDE, 0xDA, 0xDA, 0x00, 0xDB, 0xDB,
-    0x1D, 0x11, 0x07, 0x07, 0x07, 0x13, 0x13, 0x17, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x07, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x08, 0x04, 0x04,
-    0x00, 0x14, 0x14, 0x07, 0x07, 0x07, 0x08, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x1A, 0x1A, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0xE9,
-    0xDB, 0xD9, 0xD9, 0xD7, 0xD5, 0xD7, 0xD6, 0xD6, 0xD8, 0xD8, 0xD7, 0xD7, 0xD7, 0xD8, 0xDB, 0xDD,
-    0xD2, 0xD2, 0xD2, 0xD2, 0xD7, 0xD7, 0xDA, 0xDE, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xD5, 0xD6, 0xD4,
-    0xD4, 0xD4, 0xD4, 0xD4, 0xDA, 0xD6, 0xCE, 0xD1, 0xCF, 0xCE, 0xD9, 0x00, 0x1E, 0x1E, 0x1E, 0x1E,
-    0x08, 0x1D, 0x1D, 0xCE, 0xCE, 0xD6, 0x00, 0x00, 0x1A, 0x11, 0x07, 0x07, 0x07, 0x13, 0x17, 0x08,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x08, 0x07, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x00, 0x08, 0x04, 0x00, 0x13, 0x14, 0x14, 0x07, 0x07, 0x12, 0x0F, 0x0F,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x00,
-    0x9F, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x00, 0xE9, 0xDB, 0xDA, 0xD9, 0xD7, 0xD3, 0xD7, 0xD3, 0xD4,
-    0xD4, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xDD, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xDC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xD8, 0xD7, 0xD5, 0xD7, 0xD2, 0xD2, 0xD2, 0xD2, 0xD8, 0xD9, 0xCE, 0xD1,
-    0xCF, 0xCE, 0xD3, 0xDD, 0x00, 0x1F, 0x1C, 0xF8, 0x7D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x1D, 0x1C,
-    0x13, 0x13, 0x07, 0x07, 0x17, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x18, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x1E, 0x07, 0x12, 0x08, 0x1D, 0x25, 0x00,
-    0x13, 0x14, 0x14, 0x07, 0x12, 0x12, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x1F, 0x1B, 0x1A, 0x1B, 0x1D, 0x9F, 0x9F, 0x9F, 0xE9,
-    0xD9, 0xD9, 0xD9, 0xD4, 0xD3, 0xD7, 0xD3, 0xD4, 0xD1, 0xD4, 0xD6, 0xD6, 0xD7, 0xD2, 0xD8, 0xD9,
-    0xD0, 0xD7, 0xD5, 0xD3, 0xD3, 0x00, 0xD7, 0xDF, 0x00, 0x00, 0x00, 0xDC, 0xDA, 0xD7, 0xD5, 0xD6,
-    0xD7, 0xD5, 0xD5, 0xD5, 0xD5, 0xD8, 0xD3, 0xD2, 0xCC, 0xCC, 0xCE, 0xDD, 0x18, 0x08, 0xF6, 0xF8,
-    0xF5, 0x1D, 0x1D, 0x1D, 0x08, 0x1A, 0x13, 0x18, 0x18, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x18, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x08, 0x12, 0x07, 0x08, 0x1D, 0x23, 0x00, 0x13, 0x14, 0x14, 0x07, 0x12, 0x0F, 0x07, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x00, 0x00, 0x9F, 0x9F, 0x1B,
-    0x19, 0x19, 0x19, 0x19, 0x1A, 0x1C, 0x00, 0x9F, 0xD6, 0xD6, 0xD9, 0xD4, 0xD0, 0xD3, 0xD0, 0xD4,
-    0xD0, 0xD0, 0xD4, 0xD3, 0xD6, 0xD2, 0xD3, 0xD9, 0xD7, 0xD3, 0xD3, 0xCE, 0xCA, 0xD9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xDE, 0xDC, 0xDA, 0xD9, 0xD9, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD2, 0xD1, 0xD1,
-    0xCC, 0xCC, 0xCE, 0xDD, 0x07, 0x08, 0xF5, 0xF8, 0xFA, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x18, 0x1A,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x08, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x1A, 0x07, 0x18, 0x1D, 0x1D, 0x37, 0x37,
-    0x13, 0x14, 0x14, 0x07, 0x0F, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0xD2, 0xD6, 0xD6, 0xD4, 0xD0, 0xD2, 0xD0, 0xD4, 0xD1, 0xD0, 0xD0, 0xD0, 0xD2, 0xD3, 0xD1, 0xD9,
-    0xD7, 0xD3, 0xCC, 0xCE, 0xCE, 0xCA, 0xD9, 0xD9, 0xDF, 0xDF, 0xDF, 0x00, 0xDE, 0xDE, 0xDE, 0xDE,
-    0xDE, 0xDC, 0xDA, 0xDA, 0xD7, 0xD7, 0xD7, 0xD1, 0xCC, 0xCC, 0xCE, 0x19, 0x16, 0x08, 0xF4, 0xF8,
-    0xF5, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x08, 0x1A, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00,
-    0x1A, 0x07, 0x07, 0x1B, 0x1D, 0x1D, 0x1D, 0x36, 0x0C, 0x14, 0x14, 0x07, 0x07, 0x0F, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xD2, 0xD2, 0xD2, 0xD0, 0xD0, 0xCD, 0xD0,
-    0xD4, 0xD1, 0xD0, 0xD4, 0xD2, 0xD6, 0xD9, 0xD7, 0xD3, 0xCC, 0xCA, 0xCB, 0xCE, 0xCA, 0xD9, 0xDC,
-    0xDC, 0xDC, 0xDC, 0xDE, 0xDE, 0xD9, 0xDD, 0xED, 0xED, 0xD9, 0xD9, 0xDA, 0xD9, 0xD2, 0xD7, 0xD0,
-    0xD0, 0xD0, 0xD0, 0x18, 0x08, 0xF8, 0xF4, 0xF8, 0x6A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1A, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x1A, 0x07, 0x13, 0x07, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x0C, 0x22, 0x14, 0x07, 0x07, 0x07, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0xD4, 0xD0, 0xD0, 0xD2, 0xD2, 0x19, 0x19, 0x19, 0xD5, 0xD5, 0xD9, 0xD7,
-    0xD3, 0xCA, 0xC8, 0xC7, 0xC7, 0xCE, 0xD9, 0xD4, 0xD7, 0xD8, 0xDA, 0xDC, 0xD7, 0x00, 0xD9, 0xDD,
-    0xDA, 0xD7, 0xD6, 0xD9, 0xD8, 0xD1, 0xD0, 0xD3, 0xCC, 0xCC, 0xD0, 0x08, 0x08, 0xF6, 0xF3, 0xF8,
-    0x5B, 0x67, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x07, 0x12, 0x12, 0x11, 0x0F, 0x0F,
-    0x11, 0x17, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x08, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0x11, 0x12,
-    0x07, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x26, 0x07, 0x07, 0x07, 0x07, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xD3, 0xCC, 0xC8, 0xC7, 0xC7, 0xCA, 0xD1, 0xD5, 0xD0,
-    0xD4, 0xD4, 0xD4, 0xD7, 0xD6, 0xD3, 0xDA, 0xD3, 0xD5, 0xD1, 0xD1, 0xD7, 0xD3, 0xD0, 0xCC, 0xCC,
-    0xCC, 0xCC, 0xCF, 0xD2, 0x19, 0xF4, 0xF3, 0xF8, 0x59, 0x61, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x16, 0x07, 0x18, 0x18, 0x17, 0x16, 0x15, 0x07, 0x07, 0x0F, 0x0F, 0x08, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x07, 0x0F,
-    0x13, 0x07, 0x07, 0x07, 0x07, 0x17, 0x17, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x08, 0x00, 0x08, 0x29, 0x15, 0x12, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0xCC, 0xC7, 0xC7, 0xCA, 0xD1, 0xD5, 0xD0, 0xD0, 0xD0, 0xCC, 0xD2, 0xD3, 0xD5, 0xCF, 0xD8, 0xD1,
-    0xD5, 0xCE, 0xCC, 0xD1, 0xD1, 0xD0, 0xCC, 0xCC, 0xCE, 0xCC, 0xCF, 0xD2, 0xF5, 0xF4, 0xF3, 0xF8,
-    0x41, 0x61, 0x6E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x08, 0x18, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x19, 0x07, 0x0F, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x29, 0x2C, 0x2C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x08, 0x0F, 0x0F, 0x16, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xCC, 0xCC, 0xD1, 0xD5, 0xD0, 0xCE, 0xCC,
-    0xCC, 0xCE, 0xD1, 0xD3, 0xD5, 0xCF, 0xD6, 0xCE, 0xD1, 0xCE, 0xCC, 0xD1, 0xD0, 0xCC, 0xCC, 0xCE,
-    0xCF, 0xCF, 0xD0, 0xF7, 0xF6, 0xF6, 0xF4, 0xF8, 0x58, 0x02, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x08,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x04, 0x00, 0x07, 0x11, 0x1B, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x27,
-    0x29, 0x00, 0x18, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1D, 0x08, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x18, 0x00, 0x14, 0x00, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0xD9, 0xD6, 0xD0, 0xD0, 0xCE, 0xCC, 0xCC, 0xCC, 0xD0, 0xD1, 0xCC, 0xD3, 0xCE,
-    0xCE, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xD0, 0xD0, 0xD0, 0xF7, 0xF7, 0xF7, 0xF6, 0xF6, 0xF8,
-    0x5B, 0x6A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1A, 0x00, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x08, 0x08, 0x08, 0x00, 0x07, 0x12, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x04, 0x04, 0x00, 0x18, 0x12, 0x11, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x08, 0x1A, 0x19, 0x18, 0x17, 0x15, 0x15, 0x13, 0x11, 0x0F,
-    0x0F, 0x11, 0x13, 0x15, 0x15, 0x12, 0x0F, 0x12, 0x07, 0x00, 0x14, 0x07, 0x04, 0x08, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xD6, 0xD3, 0xD0, 0xCC,
-    0xD0, 0xD0, 0xCE, 0xD1, 0xCC, 0xCC, 0xD1, 0xCC, 0xCE, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 0xD0, 0xD2,
-    0xF9, 0xF8, 0xF8, 0xF9, 0xF7, 0xF6, 0xF6, 0xF8, 0x68, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x30, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x08, 0x17, 0x07, 0x07, 0x07, 0x07, 0x17, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x25, 0x04, 0x19,
-    0x19, 0x14, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1A, 0x0C, 0x00, 0x1F,
-    0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1D, 0x1E, 0x1F,
-    0x00, 0x00, 0x14, 0x07, 0x07, 0x04, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xD6, 0xD4, 0xD3, 0xD3, 0xD2, 0xD1, 0xCC, 0xD0, 0xD1, 0xCC,
-    0xCC, 0xCC, 0xCD, 0xD0, 0xD0, 0xD2, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xF7, 0xF6, 0xF8,
-    0xF5, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x30, 0x30, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x08, 0x17,
-    0x19, 0x1D, 0x08, 0x08, 0x08, 0x1A, 0x19, 0x18, 0x18, 0x17, 0x07, 0x14, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x20, 0x23, 0x18, 0x19, 0x19, 0x17, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1F, 0x08, 0x18, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x1D, 0x00, 0x1D, 0x17, 0x0F, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x04, 0x0C,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0xD6, 0xD4, 0xD4, 0xCF, 0xCF, 0xCF, 0xCF, 0xCC, 0xCC, 0xD2, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x7D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x00, 0x10, 0x30, 0x30, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x08, 0x17, 0x19, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x32, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x28, 0x34, 0x20, 0x18, 0x19,
-    0x19, 0x1B, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1A, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x1A, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x04, 0x35, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xD6, 0xD0, 0xCF, 0xCF, 0xD0,
-    0xD2, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
-    0xF7, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1F, 0x00, 0x17, 0x10, 0x30, 0x30, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x08, 0x19, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x00, 0x00, 0x17, 0x13, 0x0C, 0x22, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x28, 0x34, 0x18, 0x18, 0x19, 0x19, 0x1D, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1E, 0x18, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x17, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16,
-    0x04, 0x36, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x16, 0x1B, 0xFC, 0xFA, 0xFB, 0xFC, 0xFB, 0xFC, 0xFD,
-    0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFC, 0xFC, 0xFC, 0x7F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x12, 0x0F, 0x10, 0x30, 0x30, 0x31,
-    0x32, 0x33, 0x0C, 0x08, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x00, 0x1A,
-    0x11, 0x04, 0x0C, 0x28, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x28, 0x26, 0x18, 0x18, 0x19,
-    0x19, 0x1A, 0x1E, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x32, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16, 0x16, 0x04, 0x22, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x17,
-    0x1B, 0xF1, 0xF7, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-    0x7F, 0xFC, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x18, 0x12, 0x10, 0x30, 0x30, 0x31, 0x32, 0x33, 0x00, 0x08, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1C, 0x1A, 0x18, 0x00, 0x00, 0x00, 0x17, 0x0F, 0x04, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x28, 0x08, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x1F, 0x08, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x1E, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16,
-    0x16, 0x17, 0x04, 0x22, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x17, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x98, 0x96, 0x96, 0x96, 0x96, 0x98, 0x1F, 0x99,
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x99, 0x00, 0x9B, 0x9A, 0x99, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x12, 0x10, 0x30, 0x31,
-    0x32, 0x00, 0x18, 0x07, 0x13, 0x12, 0x11, 0x10, 0x0F, 0x0F, 0x12, 0x16, 0x00, 0x00, 0x00, 0x07,
-    0x0F, 0x04, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x00, 0x00, 0x18, 0x19,
-    0x19, 0x1A, 0x18, 0x15, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x13, 0x0F, 0x07, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2F, 0x00, 0x1A, 0x13, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16, 0x16, 0x17, 0x17, 0x28, 0x24, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x17,
-    0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9A, 0x98, 0x97, 0x99, 0x99, 0x97, 0x1F, 0x9B, 0x9B, 0x9A, 0x99, 0x97, 0x98, 0x99, 0x00, 0x9D,
-    0x98, 0x97, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x0F, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x19, 0x19, 0x1A, 0x15, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x07, 0x0F, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x2A, 0x2D, 0x00,
-    0x1B, 0x17, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x07, 0x16, 0x16,
-    0x07, 0x17, 0x17, 0x17, 0x04, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9E, 0x9B, 0x9A, 0x96, 0x97, 0x97, 0x9C, 0x9E,
-    0x9E, 0x9D, 0x9D, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x98, 0x9B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x12, 0x15, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x04, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07,
-    0x0F, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x19, 0x15, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x07, 0x0C, 0x35, 0x0F,
-    0x12, 0x07, 0x17, 0x18, 0x1A, 0x18, 0x07, 0x10, 0x14, 0x16, 0x19, 0x1C, 0x1D, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x19, 0x04, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x16,
-    0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9D, 0x98, 0x9B, 0x98, 0x99, 0x96, 0x9A, 0x9F, 0x9F, 0x9B, 0x9D, 0x9A, 0x9C, 0x9B, 0x00, 0x9D,
-    0x9C, 0x98, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x17, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x12, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x19, 0x35, 0x12, 0x0F, 0x08, 0x1A, 0x1A, 0x1A, 0x18, 0x17, 0x07,
-    0x17, 0x18, 0x18, 0x18, 0x19, 0x1A, 0x08, 0x08, 0x08, 0x00, 0x14, 0x07, 0x07, 0x0F, 0x10, 0x11,
-    0x12, 0x13, 0x13, 0x14, 0x15, 0x15, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x16, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9C, 0x9C, 0x9D, 0x98, 0x96, 0x96, 0x9C, 0x9E,
-    0x9E, 0x9D, 0x9E, 0x9D, 0x9E, 0x9B, 0x00, 0x9E, 0x9E, 0x99, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1A, 0x08, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07,
-    0x0F, 0x1A, 0x18, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x15, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1A, 0x15,
-    0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x08, 0x00, 0x14, 0x07, 0x07, 0x0F, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x16,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9E, 0x9B, 0x9C, 0x9A, 0x98, 0x97, 0x9E, 0x1F, 0x1F, 0x9E, 0x9B, 0x99, 0x98, 0x99, 0x00, 0x9C,
-    0x9A, 0x9E, 0x9A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x19, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x1A, 0x15, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x12, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x08, 0x07, 0x0F, 0x12, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x16, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9E, 0x9D, 0x9F, 0x9C, 0x9B, 0x9D, 0x00, 0x99,
-    0x99, 0x9B, 0x97, 0x98, 0x95, 0x98, 0x00, 0x9F, 0x9D, 0x9B, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1B, 0x18,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x1E, 0x07,
-    0x0F, 0x00, 0x08, 0x18, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x0F, 0x15, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x08, 0x08, 0x08,
-    0x1A, 0x19, 0x18, 0x17, 0x16, 0x07, 0x13, 0x11, 0x11, 0x13, 0x07, 0x17, 0x18, 0x19, 0x08, 0x08,
-    0x04, 0x04, 0x08, 0x08, 0x08, 0x07, 0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x00, 0x99, 0x99, 0x98, 0x99, 0x9C, 0x9B, 0x9B, 0x00, 0x9C,
-    0x9D, 0x9C, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x1B, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2A, 0x00, 0x00, 0x00, 0x1A, 0x13, 0x0F, 0x00, 0x08, 0x18, 0x16, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x16, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1C, 0x08, 0x08, 0x1D, 0x1D, 0x00, 0x00, 0x1E, 0x1D, 0x1C, 0x08, 0x18, 0x07,
-    0x07, 0x17, 0x18, 0x08, 0x1D, 0x1D, 0x1B, 0x18, 0x0C, 0x0C, 0x04, 0x00, 0x08, 0x08, 0x07, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9A, 0x99, 0x99, 0x1F, 0x9D, 0x9E, 0x00, 0x9D,
-    0x9B, 0x99, 0x9A, 0x95, 0x9D, 0x9D, 0x00, 0x9E, 0x9E, 0x9E, 0x9E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x00,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x00, 0x00, 0x1E, 0x1A, 0x07, 0x10,
-    0x15, 0x1B, 0x00, 0x08, 0x1A, 0x16, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x15,
-    0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x08, 0x1C, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x00, 0x15, 0x13, 0x12, 0x12, 0x13,
-    0x13, 0x16, 0x0C, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9B, 0x99, 0x9A, 0x1F, 0x9C, 0x97, 0x00, 0x9C, 0x9D, 0x9E, 0x9E, 0x9C, 0x9C, 0x9E, 0x00, 0x99,
-    0x98, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x08, 0x08, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x07, 0x13,
-    0x12, 0x0F, 0x0F, 0x11, 0x13, 0x16, 0x17, 0x17, 0x17, 0x1A, 0x00, 0x1F, 0x1D, 0x2C, 0x28, 0x23,
-    0x37, 0x35, 0x0C, 0x33, 0x33, 0x31, 0x07, 0x0F, 0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1C, 0x00, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x18, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x16, 0x0C, 0x04, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9C, 0x9B, 0x98, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x9C, 0x9C, 0x9A, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E,
-    0x08, 0x08, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x07, 0x07, 0x16, 0x18, 0x1A, 0x08, 0x1B, 0x1A,
-    0x19, 0x18, 0x16, 0x1D, 0x1D, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x07, 0x07, 0x31, 0x07, 0x11,
-    0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x19, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9E, 0x99, 0x99, 0x00, 0x98, 0x9A, 0x9B, 0x98, 0x9A, 0x99, 0x98, 0x96, 0x9C, 0x98, 0x00, 0x9D,
-    0x9A, 0x9C, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x04, 0x1C, 0x1C, 0x1C, 0x04, 0x04, 0x04, 0x21, 0x2B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x18, 0x08, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x16, 0x1B, 0x1B, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9E, 0x9B, 0x9A, 0x00, 0x98, 0x9D, 0x9C, 0x9B,
-    0x9E, 0x9D, 0x9C, 0x9A, 0x9E, 0x9D, 0x00, 0x9E, 0x9D, 0x9A, 0x9B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x04, 0x00, 0x00, 0x00, 0x08, 0x1A,
-    0x04, 0x36, 0x28, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x1E, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x19, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9E, 0x9E, 0x9E, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x9B, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x04, 0x00, 0x00, 0x00, 0x07, 0x18, 0x35, 0x24, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x07, 0x1C, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2F,
-    0x00, 0x1E, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x16, 0x1B, 0x1B, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9A, 0x98,
-    0x98, 0x98, 0x98, 0x99, 0x9B, 0x9A, 0x99, 0x98, 0x98, 0x98, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x29, 0x00, 0x00, 0x00, 0x07,
-    0x13, 0x04, 0x34, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1A, 0x07, 0x08, 0x33, 0x0C, 0x35, 0x36,
-    0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x04, 0x00, 0x1B, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x19, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9B, 0x98, 0x99, 0x93, 0x96, 0x1F, 0x9E, 0x99, 0x96, 0x98, 0x9A, 0x99, 0x9A, 0x97, 0x99, 0x98,
-    0x97, 0x96, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x29, 0x00, 0x00, 0x00, 0x07, 0x12, 0x04, 0x33, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x18, 0x08, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x25, 0x04, 0x28, 0x29, 0x04, 0x00,
-    0x1B, 0x07, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x16, 0x1B, 0x1A, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9B, 0x99, 0x9A, 0x96, 0x95, 0x1F, 0x9D, 0x9E,
-    0x9A, 0x9D, 0x9B, 0x9C, 0x9C, 0x9B, 0x9A, 0x9B, 0x9A, 0x98, 0x97, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x07,
-    0x11, 0x04, 0x32, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x08, 0x33, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x08, 0x08, 0x04, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x08, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9E, 0x9D, 0x99, 0x99, 0x97, 0x1F, 0x9E, 0x9E, 0x9D, 0x9E, 0x9E, 0x9D, 0x9E, 0x9D, 0x9D, 0x9E,
-    0x9D, 0x9B, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x6E, 0x6A, 0x6C, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x16, 0x10, 0x00, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x18, 0x1C, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x07, 0x0F, 0x0F, 0x08, 0x28, 0x29, 0x04, 0x00,
-    0x0F, 0x07, 0x07, 0x08, 0x00, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x18, 0x17, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9D, 0x9E, 0x9A, 0x9C, 0x96, 0x1F, 0x1F, 0x9C,
-    0x9C, 0x9A, 0x9A, 0x98, 0x97, 0x98, 0x00, 0x99, 0x99, 0x99, 0x98, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x6B, 0x68, 0x67, 0x6C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x00, 0x00, 0x00, 0x17,
-    0x0F, 0x00, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x18, 0x1D, 0x33, 0x33, 0x0C, 0x35, 0x36,
-    0x0F, 0x0F, 0x18, 0x11, 0x19, 0x2A, 0x2A, 0x04, 0x00, 0x07, 0x08, 0x00, 0x13, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x17, 0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
-    0x9E, 0x9F, 0x9E, 0x9D, 0x99, 0x1F, 0x9C, 0x99, 0x99, 0x95, 0x95, 0x95, 0x96, 0x93, 0x00, 0x9C,
-    0x97, 0x9E, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x64, 0x5B, 0x5F, 0x67,
-    0x6C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1C, 0x00, 0x00, 0x00, 0x18, 0x0F, 0x00, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x08, 0x1E, 0x32, 0x33, 0x0C, 0x35, 0x07, 0x0F, 0x1D, 0x1D, 0x1D, 0x0F, 0x07, 0x2A, 0x2D,
-    0x00, 0x00, 0x00, 0x16, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x0F, 0x12, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E,
-    0x9E, 0x9E, 0x9E, 0x9C, 0x9E, 0x9C, 0x00, 0x9D, 0x9C, 0x9C, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x62, 0x5B, 0x5B, 0x65, 0x69, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x00, 0x1A,
-    0x0F, 0x00, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1C, 0x1F, 0x33, 0x33, 0x0C, 0x35, 0x18,
-    0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x0F, 0x07, 0x04, 0x00, 0x00, 0x1B, 0x13, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x0F, 0x12, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D,
-    0x9F, 0x9F, 0x9E, 0x9F, 0x9C, 0x9A, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x9F,
-    0x1F, 0x9D, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x60, 0x5B, 0x59, 0x61,
-    0x68, 0x6C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x00, 0x08, 0x0F, 0x00, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x1C, 0x00, 0x32, 0x33, 0x0C, 0x35, 0x1C, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0F, 0x07,
-    0x00, 0x00, 0x18, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x07, 0x0F, 0x12, 0x1A, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9B,
-    0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96,
-    0x96, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x9E, 0x1F, 0x9C, 0x9F, 0x1F, 0x9E, 0x00, 0x1F, 0x9F, 0x9F, 0x9F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x5B, 0x59, 0x58, 0x61, 0x66, 0x6B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1E, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1F, 0x33, 0x33, 0x0C, 0x35, 0x08,
-    0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0F, 0x19, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x0F, 0x12, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x96, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C,
-    0x1F, 0x9F, 0x9E, 0x00, 0x9C, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x1F, 0x9E, 0x1F, 0x1F, 0x00, 0x1F,
-    0x1F, 0x9E, 0x9F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x5B, 0x58, 0x41, 0x61,
-    0x64, 0x6A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x1C, 0x1A, 0x16, 0x12, 0x0F, 0x00, 0x13, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1E, 0x1D, 0x18, 0x08, 0x08, 0x0C, 0x35, 0x36, 0x08, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x11, 0x08, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x0F, 0x12, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F,
-    0x9F, 0x9F, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
-    0x4C, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x9D, 0x9C, 0x9C, 0x9C, 0x9B, 0x00, 0x1F, 0x9C,
-    0x9D, 0x9A, 0x9C, 0x9C, 0x9C, 0x9A, 0x9C, 0x9A, 0x9C, 0x9C, 0x9A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x5B, 0x41, 0x0F, 0x61, 0x64, 0x6A, 0x6E, 0x17, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x00, 0x00,
-    0x00, 0x07, 0x0F, 0x0F, 0x12, 0x04, 0x04, 0x23, 0x20, 0x20, 0x0C, 0x0C, 0x23, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1B, 0x07, 0x07, 0x08, 0x08, 0x36,
-    0x22, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x11, 0x08, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x0F, 0x12, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F, 0x9F, 0x9F, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
-    0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x9F, 0x9C, 0x1F, 0x00, 0x9E, 0x99, 0x99, 0x9A, 0x99, 0x9C, 0x9B, 0x97, 0x1F,
-    0x9D, 0x00, 0x1F, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x5B, 0x41, 0x42, 0x64,
-    0x68, 0x6B, 0x6E, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x07, 0x0F, 0x0F, 0x11, 0x07, 0x08, 0x00, 0x00, 0x04,
-    0x04, 0x04, 0x23, 0x23, 0x0C, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x07, 0x07, 0x18, 0x18, 0x16, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x07, 0x08, 0x11, 0x12, 0x12, 0x0F, 0x07, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F,
-    0x9F, 0x9F, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
-    0x4C, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x5B, 0x58, 0x41, 0x02, 0x68, 0x6B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x08, 0x08, 0x00, 0x1A, 0x17, 0x16, 0x15, 0x07, 0x16, 0x16, 0x17, 0x37, 0x23, 0x20, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D,
-    0x1B, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x08, 0x08, 0x08, 0x07,
-    0x00, 0x0C, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x96, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFC,
-    0xFE, 0xF9, 0xF9, 0xF9, 0xF9, 0xF8, 0xF8, 0xF7, 0xF6, 0xFA, 0xF6, 0xF5, 0xF4, 0xF4, 0xF2, 0xF0,
-    0xF3, 0xF4, 0xF7, 0xF7, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x5B, 0x59, 0x58, 0x68,
-    0x69, 0x6C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x19, 0x0F, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x04, 0x20, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x07, 0x07, 0x00, 0x20, 0x20, 0x0C, 0x21, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F,
-    0x9F, 0x9F, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x9F, 0x9F, 0x9F,
-    0x98, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFB, 0xFA, 0xFA, 0xFA, 0xF9, 0xF9, 0xF8, 0xF8, 0xF8,
-    0xF8, 0xF7, 0xF7, 0xF6, 0xF5, 0xF5, 0xF4, 0xF2, 0xF2, 0xF4, 0xF5, 0xF8, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x60, 0x5B, 0x59, 0x69, 0x6A, 0x6D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x07, 0x0F, 0x07, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x04,
-    0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x08, 0x1A,
-    0x18, 0x16, 0x07, 0x12, 0x11, 0x0F, 0x12, 0x07, 0x17, 0x19, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x1B, 0x14, 0x16, 0x04, 0x21, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F, 0x9F, 0x9F, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
-    0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x9F, 0x9F, 0x9F, 0x98, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFB,
-    0xF8, 0xF8, 0xF7, 0xF6, 0xF4, 0xF3, 0xF2, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0,
-    0xF0, 0xF1, 0xF4, 0xF8, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x62, 0x5B, 0x5B, 0x6A,
-    0x6C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x15, 0x0F, 0x0F, 0x17, 0x19, 0x19, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x00, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x08, 0x27, 0x0C, 0x00, 0x00, 0x1D, 0x08, 0x19, 0x17, 0x07, 0x11, 0x07, 0x17,
-    0x08, 0x1D, 0x1F, 0x08, 0x08, 0x04, 0x04, 0x18, 0x13, 0x14, 0x14, 0x19, 0x04, 0x2A, 0x1D, 0x07,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F,
-    0x9F, 0x9F, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x9F, 0x9F, 0x9F,
-    0x98, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD, 0xF9, 0xFC, 0xFB, 0xFB, 0xFA, 0xFA, 0xF9, 0xF9,
-    0xF8, 0xF7, 0xF8, 0xF7, 0xF6, 0xF5, 0xF5, 0xF4, 0xF3, 0xF2, 0xF4, 0xF8, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x68, 0x61, 0x62, 0x6C, 0x6E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07,
-    0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x1A, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x19, 0x00, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x37, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x1B, 0x14, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x19, 0x2A, 0x2D, 0x08, 0x07, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F, 0x9F, 0x9F, 0x4B, 0x4B, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x4B, 0x4B, 0x9F, 0x9F, 0x9F, 0x98, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD,
-    0xFA, 0xFC, 0xFC, 0xFB, 0xFB, 0xFA, 0xFA, 0xF9, 0xF9, 0xF8, 0xF8, 0xF8, 0xF7, 0xF6, 0xF5, 0xF5,
-    0xF4, 0xF3, 0xF2, 0xF8, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x6B, 0x68, 0x68, 0x6E,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F,
-    0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0F, 0x07, 0x1A, 0x1D, 0x1D, 0x1D, 0x1A, 0x07, 0x08,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x00, 0x2A, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x00, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x17, 0x0F, 0x10, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x2D, 0x2D, 0x1D,
-    0x00, 0x07, 0x0C, 0x37, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F,
-    0x9F, 0x9F, 0x4B, 0x4B, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x4B, 0x4B, 0x9F, 0x9F, 0x9F,
-    0x99, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD, 0xFB, 0xFD, 0xFC, 0xFC, 0xFB, 0xFB, 0xFA, 0xFA,
-    0xF9, 0xF9, 0xF9, 0xF8, 0xF8, 0xF7, 0xF6, 0xF5, 0xF5, 0xF3, 0xF2, 0xF8, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x6E, 0x6A, 0x6C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1C, 0x1D, 0x1E,
-    0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x00, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x19, 0x1A, 0x1A, 0x00, 0x2D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x27, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x1A, 0x2D, 0x1D, 0x08, 0x1B, 0x18, 0x37, 0x04, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F, 0x9F, 0x9F, 0x4B, 0x4B, 0x4E, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x4E, 0x4B, 0x4B, 0x9F, 0x9F, 0x9F, 0x99, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x9E, 0x9E,
-    0x9D, 0x9C, 0x9D, 0x99, 0x9B, 0x9A, 0x1F, 0x1F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9B, 0x9E, 0x9E, 0x00,
-    0x9F, 0x9E, 0x9C, 0x9D, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x13, 0x18, 0x07, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x22,
-    0x04, 0x13, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x08, 0x00, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1F, 0x1F, 0x37, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x12, 0x0F, 0x1D, 0x1D,
-    0x1F, 0x08, 0x08, 0x08, 0x04, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F,
-    0x9F, 0x9F, 0x4B, 0x4B, 0x4C, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x4C, 0x4B, 0x4B, 0x9F, 0x9F, 0x9F,
-    0x99, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x9F, 0x9E, 0x9C, 0x9C, 0x9D, 0x9C, 0x99, 0x9A, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x9F, 0x9F, 0x9C, 0x9D, 0x9F, 0x00, 0x9F, 0x9D, 0x9D, 0x9D, 0x9B, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x0F, 0x07, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x08, 0x13, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x19, 0x1A, 0x1A, 0x1A, 0x17, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x33, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x1D, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x0F, 0x11, 0x1D, 0x1D, 0x1D, 0x1F, 0x08, 0x17, 0x13, 0x0F, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F, 0x9F, 0x9F, 0x4D, 0x4B, 0x4B, 0x4B, 0x4F, 0x9F,
-    0x4F, 0x4B, 0x4B, 0x4B, 0x4C, 0x9F, 0x9F, 0x9F, 0x9A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x9F, 0x9F, 0x9C, 0x9C, 0x00, 0x9D, 0x9D, 0x1F, 0x9F, 0x9E, 0x96, 0x9D, 0x99, 0x9C, 0x9F,
-    0x00, 0x1F, 0x9F, 0x9F, 0x1F, 0x9F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0F, 0x18, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x00, 0x0F, 0x07,
-    0x08, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x00, 0x17, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x17, 0x0F, 0x07, 0x1D, 0x1D,
-    0x1D, 0x12, 0x0F, 0x33, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00,
-    0x00, 0x1B, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x0F, 0x07, 0x1D, 0x1D,
-    0x1D, 0x1F, 0x08, 0x13, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4F, 0x9F, 0x9F, 0x9F,
-    0x9A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1B, 0x9E, 0x9E, 0x9C, 0x9D, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x1F,
-    0x1F, 0x9D, 0x9B, 0x9D, 0x9D, 0x1F, 0x1F, 0x9F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x18, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x00, 0x07, 0x08, 0x2F, 0x2E, 0x2C, 0x2A, 0x28, 0x04, 0x24, 0x23,
-    0x20, 0x37, 0x35, 0x35, 0x0C, 0x0C, 0x33, 0x07, 0x07, 0x0F, 0x0F, 0x13, 0x1A, 0x18, 0x18, 0x19,
-    0x19, 0x1A, 0x1A, 0x11, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x0F, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x00, 0x00, 0x1D, 0x07, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x12, 0x11, 0x1A, 0x1D, 0x1D, 0x1F, 0x00, 0x18, 0x13, 0x0F, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F, 0x9F, 0x9F, 0x9F, 0x4E, 0x4B, 0x4B, 0x4B, 0x4B,
-    0x4B, 0x4B, 0x4B, 0x4E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1F, 0x9F, 0x9C,
-    0x9D, 0x00, 0x9B, 0x00, 0x9E, 0x9F, 0x9E, 0x9F, 0x9E, 0x9D, 0x9B, 0x9D, 0x9A, 0x1F, 0x9C, 0x1F,
-    0x1F, 0x1F, 0x9E, 0x9E, 0x9F, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x08, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1C, 0x1C, 0x1B,
-    0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x0C, 0x0F, 0x08, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x07, 0x0F, 0x0C, 0x35, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x19, 0x19, 0x08, 0x08,
-    0x08, 0x08, 0x19, 0x19, 0x33, 0x33, 0x33, 0x0C, 0x0C, 0x04, 0x14, 0x0F, 0x07, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x08, 0x13, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x4E, 0x4C, 0x4B, 0x4B, 0x4B, 0x4C, 0x4E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1D, 0x1F, 0x1F, 0x1F, 0x9F, 0x00, 0x1F, 0x00, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x9E, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x1C, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x15, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x19, 0x1A, 0x11, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x07, 0x35, 0x0F,
-    0x07, 0x08, 0x08, 0x19, 0x07, 0x07, 0x0F, 0x07, 0x07, 0x19, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x08, 0x12, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x9F, 0x9C, 0x9A,
-    0x9C, 0x9C, 0x9A, 0x9A, 0x00, 0x1F, 0x9D, 0x9B, 0x9C, 0x9A, 0x9E, 0x9A, 0x9D, 0x9C, 0x9A, 0x9A,
-    0x9A, 0x9A, 0x9C, 0x9B, 0x9C, 0x9A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x1D, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x19, 0x12, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x0C, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x07, 0x07, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x04, 0x0C, 0x12, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x9B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x1B, 0x1F, 0x1F, 0x9F, 0x9D, 0x9E, 0x9C, 0x9D, 0x9A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x1E, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07,
-    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x19, 0x0C, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x08, 0x08, 0x08,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x04,
-    0x04, 0x08, 0x04, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
-    0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x9F, 0x1F, 0x9E, 0x9C, 0x1F, 0x1F, 0x9D, 0x9E, 0x9D, 0x9B, 0x9B, 0x9B, 0x9A, 0x9B, 0x9C, 0x97,
-    0x00, 0x1F, 0x1F, 0x9C, 0x1F, 0x1F, 0x9E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1A, 0x1E, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x2A, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x1A, 0x19, 0x17, 0x07, 0x12, 0x0F,
-    0x0F, 0x12, 0x07, 0x0C, 0x0C, 0x0C, 0x04, 0x04, 0x08, 0x14, 0x14, 0x04, 0x0C, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x1D, 0x9E, 0x9E, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9B, 0x9B, 0x00, 0x9F, 0x9E,
-    0x9F, 0x9F, 0x9D, 0x9F, 0x9F, 0x9F, 0x9C, 0x9F, 0x00, 0x9F, 0x9F, 0x9F, 0x9E, 0x9D, 0x9D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1F, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07,
-    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x19, 0x1C, 0x2A, 0x04, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x00, 0x0C, 0x00, 0x1C,
-    0x19, 0x17, 0x07, 0x17, 0x19, 0x08, 0x1C, 0x1D, 0x1D, 0x1D, 0x0C, 0x0C, 0x08, 0x08, 0x08, 0x08,
-    0x13, 0x14, 0x14, 0x07, 0x04, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x16,
-    0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x9F, 0x1F, 0x9E, 0x9F,
-    0x9E, 0x9F, 0x9D, 0x9B, 0x9D, 0x9F, 0x9F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F,
-    0x00, 0x9F, 0x9F, 0x9F, 0x9D, 0x9F, 0x9F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1F, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x1E, 0x07, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x2C, 0x04, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x1F, 0x00, 0x00, 0x17, 0x13, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x0C, 0x0C, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x29, 0x19, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x16, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x9A, 0x9D, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x00, 0x9D, 0x9D, 0x9C, 0x9C,
-    0x9C, 0x9C, 0x9C, 0x00, 0x9F, 0x9E, 0x9B, 0x9B, 0x00, 0x00, 0x1F, 0x9E, 0x9F, 0x1F, 0x9D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x1D, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2F, 0x00, 0x00, 0x1B, 0x07,
-    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x19, 0x1A, 0x1A, 0x2C, 0x0C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x18, 0x0F, 0x10, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x0C, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x29, 0x29, 0x19, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x16,
-    0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9A, 0x9F, 0x1F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9F, 0x00, 0x9F, 0x1F, 0x1F, 0x9F, 0x9F, 0x9F, 0x9D, 0x00, 0x9F, 0x1F, 0x9F, 0x9F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1D, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2E, 0x00, 0x00, 0x1E, 0x07, 0x0F, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x0F, 0x0F, 0x1C, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1E, 0x00, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x0F, 0x07, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x29, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1C, 0x9F, 0x9B, 0x9F, 0x9B, 0x9E, 0x9D, 0x9C, 0x9D, 0x9B, 0x9A, 0x9B, 0x00, 0x9D,
-    0x9D, 0x9C, 0x9C, 0x9C, 0x9A, 0x9C, 0x00, 0x9F, 0x9D, 0x9F, 0x9B, 0x9F, 0x9F, 0x9D, 0x00, 0x9D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1D, 0x31,
-    0x32, 0x33, 0x34, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E,
-    0x1D, 0x1D, 0x1C, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x19, 0x1A, 0x0F, 0x0F, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1D, 0x1B, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x12, 0x0F, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x17,
-    0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1F, 0x9F, 0x9D, 0x9F, 0x9E,
-    0x9B, 0x9B, 0x9D, 0x9D, 0x9C, 0x9D, 0x00, 0x1F, 0x9F, 0x9F, 0x9C, 0x9B, 0x9B, 0x9C, 0x00, 0x9F,
-    0x9F, 0x9F, 0x9C, 0x9D, 0x9F, 0x9F, 0x00, 0x9F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x08, 0x0F, 0x07, 0x17,
-    0x18, 0x18, 0x08, 0x08, 0x04, 0x04, 0x04, 0x24, 0x21, 0x37, 0x35, 0x0C, 0x33, 0x32, 0x31, 0x31,
-    0x30, 0x0F, 0x19, 0x17, 0x17, 0x18, 0x18, 0x19, 0x1B, 0x0F, 0x0F, 0x18, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2F,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x0F, 0x0F, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x9A, 0x1F, 0x9F, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9C, 0x9E, 0x9D, 0x00, 0x1F,
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9B, 0x9C, 0x00, 0x9F, 0x9F, 0x9E, 0x9F, 0x9F, 0x9F, 0x9B, 0x00, 0x9F,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x07, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x19, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x1B, 0x12, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x08, 0x32, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00, 0x00, 0x1E, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x9F, 0x9F, 0x9F, 0x9B, 0x00, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x07, 0x0F,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1B, 0x07, 0x18, 0x17, 0x17, 0x18, 0x18, 0x19, 0x1C, 0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x07, 0x08, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x00, 0x00,
-    0x00, 0x1B, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x12, 0x0F, 0x08, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x29, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x99, 0x9D, 0x9C, 0x9B, 0x9C, 0x9B, 0x9B, 0x9C, 0x00, 0x9D, 0x9A, 0x9A, 0x9C, 0x9A,
-    0x9A, 0x9C, 0x9A, 0x9A, 0x9A, 0x9A, 0x00, 0x1F, 0x9F, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x00, 0x9F,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x07, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x07, 0x1B, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x00, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x08, 0x0C, 0x35, 0x0F,
-    0x11, 0x15, 0x17, 0x19, 0x1C, 0x08, 0x08, 0x08, 0x1B, 0x07, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x18,
-    0x00, 0x1A, 0x17, 0x12, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x19, 0x29, 0x19, 0x19, 0x19,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9D, 0x9D, 0x9C, 0x9F, 0x9E, 0x9C,
-    0x9C, 0x00, 0x1F, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x00, 0x9D,
-    0x9D, 0x00, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1D, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x08, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x17,
-    0x08, 0x19, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x00, 0x13, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x08, 0x35, 0x11, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x18, 0x13, 0x11, 0x12, 0x12, 0x13, 0x18, 0x08, 0x1C, 0x0F, 0x12, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1C, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9B, 0x00, 0x9F, 0x9F, 0x9F, 0x9B, 0x9B, 0x9B,
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x00, 0x1F, 0x1F, 0x9D, 0x9E, 0x9E, 0x9F,
-    0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1D, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x08, 0x1C, 0x1D, 0x1E, 0x1F, 0x1F, 0x00,
-    0x1F, 0x1E, 0x1D, 0x1C, 0x08, 0x08, 0x19, 0x08, 0x19, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x1D, 0x12, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x08, 0x1A, 0x08, 0x07,
-    0x08, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1C, 0x08, 0x08, 0x18, 0x16, 0x12, 0x12, 0x13,
-    0x13, 0x18, 0x08, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9C, 0x9C, 0x9D, 0x9F, 0x9E, 0x9C,
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x31, 0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1D, 0x1D, 0x1C, 0x1B, 0x18,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x18, 0x14, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x1A, 0x19, 0x19, 0x17, 0x07, 0x0F, 0x07,
-    0x19, 0x1A, 0x08, 0x08, 0x08, 0x18, 0x12, 0x13, 0x13, 0x14, 0x18, 0x1F, 0x08, 0x18, 0x1C, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x9A, 0x9E, 0x1F, 0x9C, 0x9D, 0x9C, 0x9D, 0x9A, 0x99, 0x9B, 0x9A, 0x00, 0x1F, 0x1F, 0x9F,
-    0x9F, 0x9E, 0x9E, 0x9F, 0x9E, 0x9B, 0x9E, 0x9E, 0x9A, 0x00, 0x9F, 0x9F, 0x9C, 0x9C, 0x9D, 0x9D,
-    0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x31,
-    0x32, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x15, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x19,
-    0x13, 0x16, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1B, 0x0C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1C, 0x1C, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x1F, 0x1D, 0x18, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x9F, 0x9D, 0x1F, 0x9C, 0x9C, 0x9C,
-    0x9E, 0x9D, 0x9D, 0x9C, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x9F, 0x9E, 0x9F, 0x9D, 0x9F, 0x9F, 0x9F,
-    0x9C, 0x00, 0x1F, 0x9F, 0x9D, 0x9F, 0x9D, 0x9C, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x15, 0x0F, 0x11, 0x33, 0x34, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x19, 0x12, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x13, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x00, 0x17, 0x13, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x18, 0x07, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x1B, 0x1F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9E, 0x9A, 0x9F, 0x9A, 0x9A, 0x9C, 0x9F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x1F, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x9C, 0x00, 0x1F, 0x9F, 0x9F, 0x9D, 0x9F,
-    0x9B, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x07,
-    0x13, 0x12, 0x0C, 0x0C, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07,
-    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x0F,
-    0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x18, 0x0F, 0x10, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x07, 0x18, 0x0F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1E, 0x9F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9F,
-    0x9C, 0x9C, 0x9C, 0x9C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x9F, 0x9E, 0x9D, 0x9C, 0x9B,
-    0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x9E, 0x9E, 0x9C, 0x9E, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x07, 0x14, 0x0C, 0x35, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x13, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1E, 0x1B, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D,
-    0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x07, 0x0F, 0x12, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x1C, 0x1E, 0x1F, 0x9F, 0x1F, 0x1F, 0x9F, 0x9F, 0x1F, 0x9E, 0x9E, 0x9E, 0x00, 0x1F, 0x9D, 0x9F,
-    0x00, 0x9D, 0x9C, 0x9C, 0x9D, 0x1F, 0x9E, 0x9F, 0x9C, 0x00, 0x00, 0x1F, 0x9F, 0x9F, 0x1F, 0x9E,
-    0x9F, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1C, 0x07, 0x18, 0x35, 0x36, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x07,
-    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x18, 0x0F, 0x07,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1D, 0x19, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2D, 0x00, 0x00, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x12, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9B, 0x9E, 0x9E, 0x9D, 0x9C, 0x9D, 0x9D, 0x00,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x9F, 0x00, 0x9D, 0x1F, 0x9E, 0x9B, 0x9D, 0x1F, 0x1F,
-    0x9E, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x1A, 0x36, 0x22, 0x24,
-    0x26, 0x27, 0x2A, 0x2C, 0x00, 0x00, 0x1E, 0x07, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x17, 0x16, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x32, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x2F,
-    0x00, 0x1E, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x07, 0x12, 0x12, 0x1A, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x9A, 0x1F, 0x1F, 0x9F, 0x9D, 0x9E, 0x9C, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x1F,
-    0x00, 0x1F, 0x1F, 0x9F, 0x1F, 0x9F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x9E, 0x9E, 0x9C, 0x9C,
-    0x9D, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x28, 0x22, 0x24, 0x26, 0x27, 0x2A, 0x2E, 0x00, 0x00, 0x1B, 0x07,
-    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07, 0x07, 0x16, 0x16, 0x17, 0x17, 0x13, 0x0F, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x07, 0x08, 0x32, 0x33, 0x0C, 0x35, 0x36,
-    0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x2B, 0x00, 0x00, 0x1B, 0x07, 0x0F, 0x11, 0x12, 0x12, 0x13,
-    0x13, 0x14, 0x14, 0x07, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1F, 0x1F, 0x1F, 0x9E, 0x9D, 0x9C, 0x00, 0x9C,
-    0x9E, 0x00, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x9F, 0x1F, 0x1F, 0x9E, 0x9C, 0x9E, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x22, 0x24,
-    0x26, 0x27, 0x2E, 0x00, 0x00, 0x1B, 0x07, 0x0F, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x07,
-    0x07, 0x16, 0x16, 0x17, 0x14, 0x0F, 0x07, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x07, 0x08, 0x33, 0x0C, 0x35, 0x36, 0x23, 0x24, 0x25, 0x04, 0x28, 0x29, 0x00, 0x00,
-    0x1B, 0x07, 0x0F, 0x0F, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x12, 0x0F, 0x07, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C,
-    0x1E, 0x9F, 0x9F, 0x9D, 0x9D, 0x9C, 0x00, 0x9E, 0x9C, 0x00, 0x1F, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F,
-    0x1F, 0x9F, 0x9E, 0x9C, 0x9E, 0x9C, 0x00, 0x9E, 0x1F, 0x9D, 0x00, 0x1F, 0x1F, 0x9F, 0x9F, 0x9E,
-    0x1F, 0x9E, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x1D, 0x1C, 0x1B, 0x08, 0x1A, 0x19, 0x18, 0x07, 0x17, 0x14, 0x0F, 0x13, 0x1A, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x08, 0x0C, 0x35, 0x0F,
-    0x12, 0x07, 0x18, 0x1A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0C, 0x0C, 0x0C, 0x04,
-    0x04, 0x07, 0x14, 0x12, 0x0F, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x29, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x9F, 0x1F, 0x00, 0x1F,
-    0x9D, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x9F, 0x1F, 0x1F, 0x1F, 0x9E, 0x1F, 0x9D, 0x00, 0x9F,
-    0x1F, 0x9F, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1A,
-    0x18, 0x17, 0x07, 0x12, 0x0F, 0x07, 0x17, 0x18, 0x1A, 0x08, 0x08, 0x08, 0x1A, 0x18, 0x07, 0x14,
-    0x12, 0x0F, 0x0F, 0x0F, 0x13, 0x1A, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x18, 0x08, 0x35, 0x07, 0x08, 0x1B, 0x1A, 0x18, 0x17, 0x17, 0x07, 0x12,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x33, 0x0C, 0x04, 0x14, 0x0F, 0x12, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A,
-    0x9F, 0x9F, 0x9D, 0x9B, 0x9B, 0x9C, 0x9B, 0x9B, 0x9B, 0x9A, 0x00, 0x1F, 0x9D, 0x9D, 0x9C, 0x9A,
-    0x9A, 0x9B, 0x9A, 0x9D, 0x9B, 0x9C, 0x9D, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x9A,
-    0x9C, 0x9A, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1A, 0x08, 0x18,
-    0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1A, 0x1A, 0x12, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x1F, 0x9E, 0x9A, 0x9C, 0x9F, 0x9D, 0x9D, 0x9C,
-    0x9B, 0x9B, 0x00, 0x00, 0x9F, 0x9F, 0x1F, 0x9F, 0x9D, 0x9E, 0x9E, 0x9D, 0x9D, 0x9F, 0x9F, 0x9E,
-    0x9D, 0x9D, 0x9D, 0x9E, 0x9D, 0x9A, 0x9A, 0x9B, 0x99, 0x9A, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1F,
-    0x1F, 0x9F, 0x9F, 0x1F, 0x9E, 0x9D, 0x9C, 0x9D, 0x9C, 0x9A, 0x00, 0x00, 0x1F, 0x1F, 0x9F, 0x9F,
-    0x9E, 0x9F, 0x1F, 0x1F, 0x9F, 0x1F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9D, 0x9E, 0x9C,
-    0x9B, 0x9C, 0x9A, 0x9E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x29, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1F, 0x1F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9E,
-    0x9D, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x29, 0x29, 0x29, 0x19, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1E,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x9D, 0x1F, 0x9D, 0x9B, 0x1F, 0x1F, 0x00, 0x9D, 0x9D, 0x9B,
-    0x99, 0x9B, 0x99, 0x9B, 0x99, 0x9B, 0x9B, 0x99, 0x99, 0x97, 0x99, 0x00, 0x9F, 0x9E, 0x9D, 0x00,
-    0x1F, 0x1F, 0x9B, 0x9B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2B,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9C, 0x9C, 0x9C, 0x9B, 0x9A, 0x9C,
-    0x9B, 0x9B, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x2B, 0x2B, 0x2B, 0x2B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x9B, 0x9D,
-    0x9C, 0x9B, 0x9A, 0x9C, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9C, 0x9D, 0x00, 0x9D, 0x9F, 0x9E,
-    0x9D, 0x9E, 0x9D, 0x9E, 0x9F, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9B, 0x00, 0x9D, 0x9E, 0x9F, 0x9D,
-    0x9D, 0x9E, 0x9D, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2B,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x19, 0x19, 0x29, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x9E, 0x9E, 0x1F, 0x9C, 0x9D, 0x9C, 0x9C, 0x9D, 0x9A, 0x99,
-    0x9C, 0x9B, 0x9A, 0x00, 0x1F, 0x9F, 0x1F, 0x9F, 0x9F, 0x9E, 0x9F, 0x9B, 0x9F, 0x9E, 0x9B, 0x9C,
-    0x9E, 0x9E, 0x9A, 0x00, 0x1F, 0x1F, 0x9F, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9C, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1F, 0x9D,
-    0x9C, 0x9F, 0x9F, 0x9E, 0x99, 0x9A, 0x9A, 0x9C, 0x9D, 0x9B, 0x9B, 0x1F, 0x1F, 0x1F, 0x9F, 0x9F,
-    0x1F, 0x9F, 0x9D, 0x9E, 0x9F, 0x9F, 0x9D, 0x9F, 0x9E, 0x9D, 0x9E, 0x00, 0x9F, 0x9F, 0x9E, 0x9F,
-    0x9D, 0x9C, 0x9A, 0x9D, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2B, 0x2B, 0x2B, 0x2B,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1F, 0x9F, 0x1F, 0x1F, 0x9D, 0x9D, 0x9E, 0x9E, 0x9C, 0x9A,
-    0x99, 0x9C, 0x9C, 0x9F, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x9F, 0x9F, 0x9F,
-    0x9F, 0x9F, 0x9D, 0x00, 0x1F, 0x1F, 0x9F, 0x9F, 0x9D, 0x9F, 0x9B, 0x9B, 0x9C, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1F, 0x9F,
-    0x1F, 0x9F, 0x1F, 0x9E, 0x9C, 0x9F, 0x9C, 0x9C, 0x9C, 0x9A, 0x9C, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0x9F, 0x1F,
-    0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2B, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1E, 0x9F, 0x9F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9D, 0x9D, 0x1F,
-    0x9F, 0x9E, 0x9B, 0x00, 0x9E, 0x9D, 0x9F, 0x1F, 0x00, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9C, 0x9B,
-    0x9B, 0x9D, 0x9F, 0x00, 0x1F, 0x1F, 0x1F, 0x9F, 0x9F, 0x9E, 0x9F, 0x9F, 0x9C, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2B, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1E, 0x1F, 0x1F,
-    0x9F, 0x1F, 0x1F, 0x9F, 0x9F, 0x1F, 0x1F, 0x9E, 0x9C, 0x9F, 0x9D, 0x00, 0x9F, 0x9F, 0x9E, 0x9D,
-    0x00, 0x9F, 0x9D, 0x9C, 0x9B, 0x9D, 0x9E, 0x9D, 0x9B, 0x9B, 0x9D, 0x00, 0x00, 0x1F, 0x1F, 0x9F,
-    0x1F, 0x9F, 0x1F, 0x9F, 0x9F, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x2B, 0x2B, 0x2B, 0x2B,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1A, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x9E, 0x00, 0x1F, 0x9C, 0x9C, 0x9D, 0x9F, 0x1F, 0x1F,
-    0x9F, 0x9E, 0x9C, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x9F, 0x1F, 0x9F, 0x9E, 0x9F, 0x9E, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x9E, 0x9E, 0x9E,
-    0x9D, 0x9C, 0x9D, 0x9D, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x9F,
-    0x00, 0x9D, 0x1F, 0x9E, 0x9D, 0x99, 0x9D, 0x1F, 0x1F, 0x1F, 0x9E, 0x00, 0x00, 0x1F, 0x00, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x29, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1C, 0x1F, 0x9F, 0x9F, 0x9D, 0x9C, 0x9E, 0x9E, 0x00, 0x00, 0x1F, 0x1F,
-    0x9D, 0x9B, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x9F, 0x1F, 0x9E, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x00, 0x1F, 0x00, 0x00, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1D, 0x1F, 0x9F, 0x1F,
-    0x9F, 0x9F, 0x9C, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0x9F,
-    0x1F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x1A, 0x1D, 0x1F, 0x9F, 0x9F, 0x9C, 0x9C, 0x9E, 0x9C, 0x9E, 0x9B, 0x9C, 0x00,
-    0x1F, 0x9E, 0x9F, 0x9F, 0x9E, 0x9D, 0x9F, 0x9E, 0x9E, 0x9D, 0x9B, 0x9B, 0x9D, 0x9C, 0x9A, 0x00,
-    0x9C, 0x9E, 0x9D, 0x1F, 0x00, 0x1F, 0x1F, 0x9E, 0x9E, 0x9C, 0x9E, 0x1F, 0x9F, 0x9C, 0x9C, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x29, 0x29, 0x29, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1E, 0x1F, 0x1F, 0x9F,
-    0x9D, 0x9D, 0x9C, 0x9D, 0x9F, 0x9E, 0x9C, 0x00, 0x1F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x1F,
-    0x1F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9C, 0x00, 0x9E, 0x9F, 0x9F, 0x9D, 0x00, 0x1F, 0x1F, 0x1F,
-    0x9F, 0x9F, 0x9E, 0x1F, 0x9F, 0x9E, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x19, 0x19, 0x19, 0x19, 0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x1C, 0x1E, 0x1F, 0x9F, 0x1F, 0x1F, 0x9F, 0x1F, 0x9E, 0x1F, 0x1F, 0x9D, 0x00,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x9F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9D, 0x00,
-    0x9F, 0x1F, 0x9E, 0x9F, 0x00, 0x1F, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9E, 0x9E, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1E, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x29, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x9B, 0x9E, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x00, 0x9F, 0x9C, 0x9B, 0x9A, 0x9C, 0x9A, 0x9A, 0x9C, 0x9D, 0x9D, 0x9B, 0x9A, 0x9D, 0x9D,
-    0x9C, 0x9A, 0x9D, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9C, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x9A, 0x1F, 0x9F, 0x9C, 0x9C,
-    0x9A, 0x9C, 0x9C, 0x9C, 0x9B, 0x9A, 0x9B, 0x9A, 0x9A, 0x00, 0x1F, 0x9F, 0x9D, 0x9D, 0x9B, 0x9C,
-    0x9C, 0x9A, 0x9C, 0x9E, 0x9A, 0x9A, 0x9D, 0x9A, 0x9C, 0x9B, 0x9B, 0x9A, 0x9C, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x9B, 0x9B, 0x99, 0x9C, 0x9A, 0x9C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1B, 0x1F, 0x9F, 0x1F, 0x9D, 0x9F, 0x9F, 0x9E, 0x9B, 0x9D, 0x9C, 0x9A, 0x9C, 0x9A,
-    0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x9F, 0x9F, 0x9D, 0x9D, 0x9F, 0x1F, 0x9F, 0x9F, 0x9E, 0x9F, 0x1F,
-    0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9E, 0x9E, 0x9D, 0x9E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9A, 0x9C,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F,
-    0x1F, 0x9F, 0x9D, 0x9B, 0x9C, 0x9D, 0x9C, 0x9A, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x9F, 0x1F, 0x9E,
-    0x9E, 0x9F, 0x1F, 0x1F, 0x9F, 0x9F, 0x1F, 0x9E, 0x9E, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9E,
-    0x9D, 0x9D, 0x9C, 0x9B, 0x9C, 0x9D, 0x9A, 0x9E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1C, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9F, 0x9B, 0x9E, 0x9D, 0x9C, 0x9A,
-    0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x1F, 0x9F, 0x1F,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1F, 0x1F, 0x1F, 0x9F, 0x9F,
-    0x9F, 0x9D, 0x9E, 0x9F, 0x9C, 0x9E, 0x9D, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1C, 0x1E, 0x1F, 0x1F, 0x9F, 0x1F, 0x1F, 0x1F, 0x9D, 0x9D, 0x9E, 0x9D, 0x9A, 0x9B,
-    0x00, 0x1F, 0x1F, 0x00, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x9E, 0x9C, 0x9C, 0x9B, 0x00, 0x9F, 0x9E, 0x1F, 0x9B, 0x9B,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9E, 0x9E, 0x9C, 0x1F, 0x1F, 0x1F, 0x9F, 0x9D, 0x9D, 0x9D, 0x9D,
-    0x9D, 0x9B, 0x9D, 0x9B, 0x9B, 0x9B, 0x9A, 0x9D, 0x9B, 0x99, 0x9B, 0x97, 0x9A, 0x00, 0x1F, 0x1F,
-    0x1F, 0x9E, 0x9C, 0x1F, 0x1F, 0x1F, 0x1F, 0x9E, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1B, 0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1B, 0xFD, 0xFC, 0xFB, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
-    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
-    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF8,
-    0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD, 0xFC, 0x1D, 0x7E, 0xFA, 0xFA,
-    0xF9, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xF7, 0xF7,
-    0xF7, 0x1D, 0x7D, 0xF6, 0xF6, 0xF5, 0xF5, 0xF5, 0xF4, 0xF5, 0xF4, 0xF3, 0xF3, 0xF2, 0xF1, 0xF0,
-    0xF3, 0xF3, 0xF4, 0xF4, 0xF5, 0xF7, 0x1D, 0x7C, 0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1B, 0xFD, 0xFC, 0x7E, 0xF7, 0xFA, 0xFA, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF8,
-    0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xF7, 0xF7, 0xF7, 0xF6, 0x7D, 0xF0, 0xF6, 0xF6, 0xF6, 0xF5, 0xF5,
-    0xF4, 0xF4, 0xF4, 0xF4, 0xF3, 0xF2, 0xF1, 0xF1, 0xF3, 0xF3, 0xF4, 0xF4, 0xF4, 0xF6, 0x7C, 0xF2,
-    0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFD, 0xFB, 0xFA, 0xFA, 0xFB, 0xFA,
-    0xFA, 0xFA, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xF8, 0xF7,
-    0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 0xF6, 0xF5, 0xF5, 0xF5, 0xF4, 0xF5, 0xF4, 0xF3, 0xF2, 0xF2, 0xF1,
-    0xF2, 0xF3, 0xF3, 0xF4, 0xF4, 0xF5, 0xF5, 0xF8, 0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1B, 0xFD, 0xFB, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9,
-    0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xF7, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 0xF6, 0xF5,
-    0xF5, 0xF5, 0xF4, 0xF5, 0xF4, 0xF3, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF4, 0xF4, 0xF5, 0xF5, 0xF8,
-    0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFE, 0xFB, 0xFB, 0xF8, 0xF8, 0xF8,
-    0xF7, 0xF7, 0xF6, 0xF6, 0xF6, 0xF5, 0xF4, 0xF4, 0xF3, 0xF2, 0xF2, 0xF2, 0xF1, 0xF1, 0xF1, 0xF1,
-    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0,
-    0xF0, 0xF0, 0xF0, 0x7B, 0x7D, 0xF4, 0xF5, 0xF8, 0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1B, 0xFE, 0xFC, 0xFC, 0xF9, 0xF8, 0xFB, 0xFA, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xFA,
-    0xF9, 0xF9, 0xF9, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF7, 0xF8, 0xF7, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6,
-    0xF5, 0xF5, 0xF5, 0xF4, 0xF5, 0xF4, 0xF3, 0xF3, 0xF2, 0xF1, 0xF2, 0x7B, 0x7D, 0xF4, 0xF5, 0xF8,
-    0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFE, 0xFC, 0xFC, 0xF9, 0xF8, 0xFB,
-    0xFB, 0xFB, 0xFA, 0xFB, 0xFA, 0xFA, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF8, 0xF8, 0xF8,
-    0xF8, 0xF7, 0xF8, 0xF7, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 0xF5, 0xF5, 0xF5, 0xF4, 0xF4, 0xF4, 0xF3,
-    0xF2, 0xF1, 0xF2, 0x7C, 0x7E, 0xF4, 0xF5, 0xF8, 0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1B, 0xFE, 0xFC, 0xFC, 0xFA, 0xF9, 0xFB, 0xFC, 0xFB, 0xFB, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA,
-    0xFA, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
-    0xF6, 0xF6, 0xF5, 0xF5, 0xF5, 0xF4, 0xF4, 0xF4, 0xF3, 0xF3, 0xF2, 0x7C, 0x7E, 0xF4, 0xF4, 0xF8,
-    0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0xFE, 0xFD, 0xFD, 0xFA, 0xFA, 0xFC,
-    0xFB, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xF9, 0xF9, 0xF8,
-    0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 0xF5, 0xF5, 0xF5, 0xF4, 0xF4,
-    0xF3, 0xF3, 0xF3, 0x7D, 0x7E, 0xF3, 0xF4, 0xF8, 0xFB, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D
-};
@@ -0,0 +1,650 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    sdram.c
+ * @brief   SDRAM fill, verify and test utilities.
+ * @note    Sizes are in bytes and must be multiples of 4, buffers must be
+ *          word aligned.
+ */
+
+#include "ch.h"
+#include "hal.h"
+#include "sdram.h"
+
+/**
+ * @addtogroup sdram
+ * @{
+ */
+
+/*===========================================================================*/
+/* Module local definitions.                                                 */
+/*===========================================================================*/
+
+/**
+ * @brief   Alignment of the DMA bursts, they must not cross 1kB boundaries.
+ */
+#define SDRAM_DMA_BURST_BYTES           16
+
+/*===========================================================================*/
+/* Module exported variables.                                                */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Module local variables and types.                                         */
+/*===========================================================================*/
+
+#if SDRAM_USE_DMA || defined(__DOXYGEN__)
+/**
+ * @brief   DMA fill source word.
+ * @note    Static because the stacks may be in CCM, not reachable by DMA.
+ */
+static uint32_t sdram_dma_pattern;
+
+/**
+ * @brief   Thread waiting for the DMA transfer end.
+ */
+static Thread *sdram_dma_thread;
+#endif /* SDRAM_USE_DMA */
+
+/*===========================================================================*/
+/* Module local functions.                                                   */
+/*===========================================================================*/
+
+/**
+ * @brief   Records a mismatching word.
+ *
+ * @param[in] rp        pointer to the @p SDRAMReport object, or @p NULL
+ * @param[in] p         failing word address
+ * @param[in] expected  expected value
+ * @param[in] actual    read value
+ *
+ * @notapi
+ */
+static void sdram_error(SDRAMReport *rp, const volatile uint32_t *p,
+                        uint32_t expected, uint32_t actual) {
+
+  if (rp == NULL)
+    return;
+
+  if (rp->errors < SDRAM_MAX_ERRORS) {
+    rp->first[rp->errors].addressp = p;
+    rp->first[rp->errors].expected = expected;
+    rp->first[rp->errors].actual = actual;
+  }
+  rp->errors++;
+}
+
+/**
+ * @brief   Fills words with the CPU.
+ * @details Eight words are stored per iteration, the compiler emits paired
+ *          or multiple stores filling the FMC write FIFO.
+ *
+ * @param[out] p        first word
+ * @param[in] words     words count
+ * @param[in] pattern   fill pattern
+ *
+ * @notapi
+ */
+static void sdram_fill_cpu(uint32_t *p, size_t words, uint32_t pattern) {
+
+  uint32_t *end = p + (words & ~(size_t)7);
+
+  while (p < end) {
+    p[0] = pattern;
+    p[1] = pattern;
+    p[2] = pattern;
+    p[3] = pattern;
+    p[4] = pattern;
+    p[5] = pattern;
+    p[6] = pattern;
+    p[7] = pattern;
+    p += 8;
+  }
+  words &= 7;
+  while (words-- > 0)
+    *p++ = pattern;
+}
+
+#if SDRAM_USE_DMA || defined(__DOXYGEN__)
+/**
+ * @brief   DMA stream interrupt handler.
+ *
+ * @param[in] p         unused
+ * @param[in] flags     pre-shifted content of the ISR register
+ *
+ * @notapi
+ */
+static void sdram_dma_serve_interrupt(void *p, uint32_t flags) {
+
+  (void)p;
+
+  chSysLockFromIsr();
+  if (sdram_dma_thread != NULL) {
+    Thread *tp = sdram_dma_thread;
+    sdram_dma_thread = NULL;
+    tp->p_u.rdymsg = (flags & (STM32_DMA_ISR_TEIF | STM32_DMA_ISR_DMEIF)) ?
+                     RDY_RESET : RDY_OK;
+    chSchReadyI(tp);
+  }
+  chSysUnlockFromIsr();
+}
+
+/**
+ * @brief   Fills words with the DMA2 memory-to-memory stream.
+ * @details The source address is not incremented, so the stream repeats the
+ *          same word. The FIFO turns it into 4-beat bursts on the memory
+ *          side. The invoking thread sleeps during the transfers.
+ * @pre     The first word is aligned to @p SDRAM_DMA_BURST_BYTES and the
+ *          words count is a multiple of 4.
+ *
+ * @param[out] p        first word
+ * @param[in] words     words count
+ * @param[in] pattern   fill pattern
+ *
+ * @return              The operation result.
+ * @retval RDY_OK       if the fill succeeded.
+ * @retval RDY_RESET    if a DMA error occurred.
+ *
+ * @notapi
+ */
+static msg_t sdram_fill_dma(uint32_t *p, size_t words, uint32_t pattern) {
+
+  const stm32_dma_stream_t *dmastp = STM32_DMA_STREAM(SDRAM_DMA_STREAM);
+  msg_t msg = RDY_OK;
+  bool_t b;
+
+  b = dmaStreamAllocate(dmastp, SDRAM_DMA_IRQ_PRIORITY,
+                        sdram_dma_serve_interrupt, NULL);
+  chDbgAssert(!b, "sdram_fill_dma(), #1", "stream already allocated");
+  (void)b;
+
+  sdram_dma_pattern = pattern;
+  while (words > 0 && msg == RDY_OK) {
+    size_t n = words < SDRAM_DMA_MAX_WORDS ? words : SDRAM_DMA_MAX_WORDS;
+
+    dmaStreamSetPeripheral(dmastp, &sdram_dma_pattern);
+    dmaStreamSetMemory0(dmastp, p);
+    dmaStreamSetTransactionSize(dmastp, n);
+    dmaStreamSetFIFO(dmastp, STM32_DMA_FCR_DMDIS | STM32_DMA_FCR_FTH_FULL);
+
+    chSysLock();
+    dmaStreamSetMode(dmastp, STM32_DMA_CR_PL(SDRAM_DMA_PRIORITY) |
+                             STM32_DMA_CR_DIR_M2M | STM32_DMA_CR_MINC |
+                             STM32_DMA_CR_PSIZE_WORD | STM32_DMA_CR_MSIZE_WORD |
+                             STM32_DMA_CR_MBURST_INCR4 | STM32_DMA_CR_TCIE |
+                             STM32_DMA_CR_TEIE | STM32_DMA_CR_DMEIE |
+                             STM32_DMA_CR_EN);
+    sdram_dma_thread = chThdSelf();
+    chSchGoSleepS(THD_STATE_SUSPENDED);
+    msg = chThdSelf()->p_u.rdymsg;
+    chSysUnlock();
+
+    dmaStreamDisable(dmastp);
+    p += n;
+    words -= n;
+  }
+
+  dmaStreamRelease(dmastp);
+  return msg;
+}
+#endif /* SDRAM_USE_DMA */
+
+#if SDRAM_USE_DMA2D || defined(__DOXYGEN__)
+/**
+ * @brief   Fills words with DMA2D constant color jobs.
+ * @details The area is seen as ARGB-8888 lines of
+ *          @p SDRAM_DMA2D_LINE_WORDS pixels, the remainder is a last
+ *          shorter line.
+ * @pre     The DMA2D driver is started.
+ *
+ * @param[out] p        first word
+ * @param[in] words     words count
+ * @param[in] pattern   fill pattern
+ *
+ * @return              The operation result.
+ * @retval RDY_OK       if the fill succeeded.
+ * @retval RDY_RESET    if a DMA2D job failed.
+ *
+ * @notapi
+ */
+static msg_t sdram_fill_dma2d(uint32_t *p, size_t words, uint32_t pattern) {
+
+  DMA2DDriver *dma2dp = &DMA2DD1;
+  msg_t msg;
+
+#if DMA2D_USE_MUTUAL_EXCLUSION
+  dma2dAcquireBus(dma2dp);
+#endif
+  while (words > 0) {
+    dma2d_job_t *jobp = dma2dJobAlloc(dma2dp);
+    size_t width = SDRAM_DMA2D_LINE_WORDS;
+    size_t height = words / SDRAM_DMA2D_LINE_WORDS;
+
+    if (height > 0xFFFF)
+      height = 0xFFFF;
+    else if (height == 0) {
+      width = words;
+      height = 1;
+    }
+
+    jobp->mode = DMA2D_JOB_CONST;
+    jobp->width = (uint16_t)width;
+    jobp->height = (uint16_t)height;
+    jobp->out.bufferp = p;
+    jobp->out.wrap_offset = 0;
+    jobp->out.fmt = DMA2D_FMT_ARGB8888;
+    jobp->out.def_color = pattern;
+    jobp->out.const_alpha = 0xFF;
+    jobp->out.palettep = NULL;
+    jobp->callback = NULL;
+    jobp->arg = NULL;
+#if CH_USE_EVENTS
+    jobp->esp = NULL;
+#endif
+    dma2dJobSubmit(dma2dp, jobp);
+
+    p += width * height;
+    words -= width * height;
+  }
+  msg = dma2dQueueWait(dma2dp);
+#if DMA2D_USE_MUTUAL_EXCLUSION
+  dma2dReleaseBus(dma2dp);
+#endif
+  return msg;
+}
+#endif /* SDRAM_USE_DMA2D */
+
+/**
+ * @brief   Fills words with the selected engine.
+ * @details The CPU handles the parts the engine cannot.
+ *
+ * @param[out] p        first word
+ * @param[in] words     words count
+ * @param[in] pattern   fill pattern
+ * @param[in] engine    fill engine
+ *
+ * @return              The operation result.
+ *
+ * @notapi
+ */
+static msg_t sdram_fill(uint32_t *p, size_t words, uint32_t pattern,
+                        sdramengine_t engine) {
+
+  switch (engine) {
+#if SDRAM_USE_DMA
+  case SDRAM_ENGINE_DMA: {
+    size_t head = ((uint32_t)-(uint32_t)p % SDRAM_DMA_BURST_BYTES) / 4;
+    size_t bulk;
+
+    if (head > words)
+      head = words;
+    sdram_fill_cpu(p, head, pattern);
+    p += head;
+    words -= head;
+    bulk = words & ~(size_t)3;
+    if (bulk > 0) {
+      msg_t msg = sdram_fill_dma(p, bulk, pattern);
+      if (msg != RDY_OK)
+        return msg;
+    }
+    sdram_fill_cpu(p + bulk, words - bulk, pattern);
+    return RDY_OK;
+  }
+#endif
+#if SDRAM_USE_DMA2D
+  case SDRAM_ENGINE_DMA2D:
+    if (words == 0)
+      return RDY_OK;
+    return sdram_fill_dma2d(p, words, pattern);
+#endif
+  default:
+    sdram_fill_cpu(p, words, pattern);
+    return RDY_OK;
+  }
+}
+
+/**
+ * @brief   Verifies words against a pattern.
+ *
+ * @param[in] p         first word
+ * @param[in] words     words count
+ * @param[in] pattern   expected pattern
+ * @param[in] rp        pointer to the @p SDRAMReport object, or @p NULL
+ *
+ * @return              The number of mismatching words.
+ *
+ * @notapi
+ */
+static uint32_t sdram_verify(const volatile uint32_t *p, size_t words,
+                             uint32_t pattern, SDRAMReport *rp) {
+
+  uint32_t errors = 0;
+
+  while (words-- > 0) {
+    uint32_t w = *p;
+    if (w != pattern) {
+      sdram_error(rp, p, pattern, w);
+      errors++;
+    }
+    p++;
+  }
+  return errors;
+}
+
+/**
+ * @brief   Walking ones and zeros on the first word.
+ *
+ * @notapi
+ */
+static uint32_t sdram_test_data_bus(volatile uint32_t *p, SDRAMReport *rp) {
+
+  uint32_t errors = 0;
+  unsigned i;
+
+  for (i = 0; i < 32; i++) {
+    uint32_t pattern = 1U << i;
+
+    *p = pattern;
+    if (*p != pattern) {
+      sdram_error(rp, p, pattern, *p);
+      errors++;
+    }
+    *p = ~pattern;
+    if (*p != ~pattern) {
+      sdram_error(rp, p, ~pattern, *p);
+      errors++;
+    }
+  }
+  return errors;
+}
+
+/**
+ * @brief   Checks the address lines at power of two word offsets.
+ * @details Detects address lines stuck high, stuck low or shorted together.
+ *
+ * @notapi
+ */
+static uint32_t sdram_test_address_bus(volatile uint32_t *p, size_t words,
+                                       SDRAMReport *rp) {
+
+  const uint32_t pattern = 0xAAAAAAAA, antipattern = 0x55555555;
+  uint32_t errors = 0;
+  size_t offset, test;
+
+  for (offset = 1; offset < words; offset <<= 1)
+    p[offset] = pattern;
+  p[0] = pattern;
+
+  /* Stuck high lines alias to the first word.*/
+  p[0] = antipattern;
+  for (offset = 1; offset < words; offset <<= 1) {
+    if (p[offset] != pattern) {
+      sdram_error(rp, &p[offset], pattern, p[offset]);
+      errors++;
+    }
+  }
+  p[0] = pattern;
+
+  /* Stuck low or shorted lines alias to another offset.*/
+  for (test = 1; test < words; test <<= 1) {
+    p[test] = antipattern;
+    if (p[0] != pattern) {
+      sdram_error(rp, &p[0], pattern, p[0]);
+      errors++;
+    }
+    for (offset = 1; offset < words; offset <<= 1) {
+      if (offset != test && p[offset] != pattern) {
+        sdram_error(rp, &p[offset], pattern, p[offset]);
+        errors++;
+      }
+    }
+    p[test] = pattern;
+  }
+  return errors;
+}
+
+/**
+ * @brief   Writes each word address into the word, then its complement.
+ * @details Detects any aliasing between two words of the area.
+ *
+ * @notapi
+ */
+static uint32_t sdram_test_address(volatile uint32_t *p, size_t words,
+                                   SDRAMReport *rp) {
+
+  uint32_t errors = 0;
+  uint32_t invert;
+  size_t i;
+
+  for (invert = 0; invert <= 1; invert++) {
+    uint32_t mask = invert ? 0xFFFFFFFF : 0;
+
+    for (i = 0; i < words; i++)
+      p[i] = (uint32_t)&p[i] ^ mask;
+    for (i = 0; i < words; i++) {
+      uint32_t expected = (uint32_t)&p[i] ^ mask;
+      uint32_t w = p[i];
+      if (w != expected) {
+        sdram_error(rp, &p[i], expected, w);
+        errors++;
+      }
+    }
+  }
+  return errors;
+}
+
+/**
+ * @brief   Word-wide March C- test.
+ * @details Up(w0), up(r0,w1), up(r1,w0), down(r0,w1), down(r1,w0), up(r0),
+ *          the first and last elements use the fill engine and the verify
+ *          loop.
+ *
+ * @notapi
+ */
+static uint32_t sdram_test_march(volatile uint32_t *p, size_t words,
+                                 sdramengine_t engine, SDRAMReport *rp) {
+
+  const uint32_t zero = 0, one = 0xFFFFFFFF;
+  uint32_t errors = 0;
+  size_t i;
+
+  if (sdram_fill((uint32_t *)p, words, zero, engine) != RDY_OK)
+    return 1;
+
+#define MARCH_STEP(r, w) {                                                  \
+  uint32_t v = p[i];                                                        \
+  if (v != (r)) {                                                           \
+    sdram_error(rp, &p[i], (r), v);                                         \
+    errors++;                                                               \
+  }                                                                         \
+  p[i] = (w);                                                               \
+}
+  for (i = 0; i < words; i++)
+    MARCH_STEP(zero, one);
+  for (i = 0; i < words; i++)
+    MARCH_STEP(one, zero);
+  for (i = words; i-- > 0; )
+    MARCH_STEP(zero, one);
+  for (i = words; i-- > 0; )
+    MARCH_STEP(one, zero);
+#undef MARCH_STEP
+
+  return errors + sdram_verify(p, words, zero, rp);
+}
+
+/*===========================================================================*/
+/* Module exported functions.                                                */
+/*===========================================================================*/
+
+/**
+ * @brief   Clears a report.
+ *
+ * @param[out] rp       pointer to the @p SDRAMReport object
+ *
+ * @api
+ */
+void sdramReportInit(SDRAMReport *rp) {
+
+  chDbgCheck(rp != NULL, "sdramReportInit");
+
+  rp->bytes = 0;
+  rp->ticks = 0;
+  rp->errors = 0;
+}
+
+/**
+ * @brief   Returns the throughput of the reported operations.
+ *
+ * @param[in] rp        pointer to the @p SDRAMReport object
+ *
+ * @return              The throughput in kB/s, zero if nothing was timed.
+ *
+ * @api
+ */
+uint32_t sdramGetRate(const SDRAMReport *rp) {
+
+  chDbgCheck(rp != NULL, "sdramGetRate");
+
+  if (rp->ticks == 0)
+    return 0;
+  return (uint32_t)((uint64_t)rp->bytes * halGetCounterFrequency() /
+                    rp->ticks / 1000);
+}
+
+/**
+ * @brief   Fills an area with a word pattern.
+ * @note    The DMA and DMA2D engines cannot reach the CCM.
+ *
+ * @param[out] p        area start
+ * @param[in] n         area size in bytes
+ * @param[in] pattern   fill pattern
+ * @param[in] engine    fill engine
+ * @param[in,out] rp    pointer to the @p SDRAMReport object, or @p NULL
+ *
+ * @return              The operation result.
+ * @retval RDY_OK       if the fill succeeded.
+ * @retval RDY_RESET    if an engine error occurred.
+ *
+ * @api
+ */
+msg_t sdramFill(uint32_t *p, size_t n, uint32_t pattern,
+                sdramengine_t engine, SDRAMReport *rp) {
+
+  TimeMeasurement tm;
+  msg_t msg;
+
+  chDbgCheck(p != NULL && ((uint32_t)p & 3) == 0 && (n & 3) == 0,
+             "sdramFill");
+
+  tmObjectInit(&tm);
+  tmStartMeasurement(&tm);
+  msg = sdram_fill(p, n / 4, pattern, engine);
+  tmStopMeasurement(&tm);
+
+  if (rp != NULL) {
+    rp->bytes += n;
+    rp->ticks += tm.last;
+  }
+  return msg;
+}
+
+/**
+ * @brief   Verifies an area against a word pattern.
+ *
+ * @param[in] p         area start
+ * @param[in] n         area size in bytes
+ * @param[in] pattern   expected pattern
+ * @param[in,out] rp    pointer to the @p SDRAMReport object, or @p NULL
+ *
+ * @return              The number of mismatching words.
+ *
+ * @api
+ */
+uint32_t sdramVerify(const uint32_t *p, size_t n, uint32_t pattern,
+                     SDRAMReport *rp) {
+
+  TimeMeasurement tm;
+  uint32_t errors;
+
+  chDbgCheck(p != NULL && ((uint32_t)p & 3) == 0 && (n & 3) == 0,
+             "sdramVerify");
+
+  tmObjectInit(&tm);
+  tmStartMeasurement(&tm);
+  errors = sdram_verify(p, n / 4, pattern, rp);
+  tmStopMeasurement(&tm);
+
+  if (rp != NULL) {
+    rp->bytes += n;
+    rp->ticks += tm.last;
+  }
+  return errors;
+}
+
+/**
+ * @brief   Runs a destructive memory test on an area.
+ *
+ * @param[in,out] p     area start
+ * @param[in] n         area size in bytes
+ * @param[in] test      test to be run
+ * @param[in] engine    engine for the bulk fills
+ * @param[in,out] rp    pointer to the @p SDRAMReport object, or @p NULL
+ *
+ * @return              The number of errors found by the test.
+ *
+ * @api
+ */
+uint32_t sdramTest(uint32_t *p, size_t n, sdramtest_t test,
+                   sdramengine_t engine, SDRAMReport *rp) {
+
+  TimeMeasurement tm;
+  uint32_t errors, bytes;
+  size_t words = n / 4;
+
+  chDbgCheck(p != NULL && ((uint32_t)p & 3) == 0 && (n & 3) == 0 && n > 0,
+             "sdramTest");
+
+  tmObjectInit(&tm);
+  tmStartMeasurement(&tm);
+  switch (test) {
+  case SDRAM_TEST_DATA_BUS:
+    errors = sdram_test_data_bus(p, rp);
+    bytes = 32 * 4 * 4;
+    break;
+  case SDRAM_TEST_ADDRESS_BUS:
+    errors = sdram_test_address_bus(p, words, rp);
+    bytes = 0;
+    break;
+  case SDRAM_TEST_ADDRESS:
+    errors = sdram_test_address(p, words, rp);
+    bytes = 4 * n;
+    break;
+  default:
+    errors = sdram_test_march(p, words, engine, rp);
+    bytes = 10 * n;
+    break;
+  }
+  tmStopMeasurement(&tm);
+
+  if (rp != NULL) {
+    rp->bytes += bytes;
+    rp->ticks += tm.last;
+  }
+  return errors;
+}
+
+/** @} */
@@ -0,0 +1,181 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    sdram.h
+ * @brief   SDRAM fill, verify and test utilities.
+ */
+
+#ifndef _SDRAM_H_
+#define _SDRAM_H_
+
+#include "stm32_dma2d.h"
+
+/**
+ * @addtogroup sdram
+ * @{
+ */
+
+/*===========================================================================*/
+/* Module constants.                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief   Words per DMA2D line in constant fills.
+ */
+#define SDRAM_DMA2D_LINE_WORDS          4096
+
+/**
+ * @brief   Maximum words per DMA transfer, a multiple of the burst length.
+ */
+#define SDRAM_DMA_MAX_WORDS             65532
+
+/*===========================================================================*/
+/* Module pre-compile time settings.                                         */
+/*===========================================================================*/
+
+/**
+ * @name    SDRAM utilities configuration options
+ * @{
+ */
+
+/**
+ * @brief   Enables the DMA memory-to-memory fill engine.
+ */
+#if !defined(SDRAM_USE_DMA) || defined(__DOXYGEN__)
+#define SDRAM_USE_DMA                       TRUE
+#endif
+
+/**
+ * @brief   DMA stream used by the fill engine.
+ * @note    Memory-to-memory transfers are only possible on DMA2.
+ */
+#if !defined(SDRAM_DMA_STREAM) || defined(__DOXYGEN__)
+#define SDRAM_DMA_STREAM                    STM32_DMA_STREAM_ID(2, 0)
+#endif
+
+/**
+ * @brief   DMA stream priority.
+ */
+#if !defined(SDRAM_DMA_PRIORITY) || defined(__DOXYGEN__)
+#define SDRAM_DMA_PRIORITY                  0
+#endif
+
+/**
+ * @brief   DMA stream interrupt priority.
+ */
+#if !defined(SDRAM_DMA_IRQ_PRIORITY) || defined(__DOXYGEN__)
+#define SDRAM_DMA_IRQ_PRIORITY              12
+#endif
+
+/**
+ * @brief   Enables the DMA2D constant fill engine.
+ */
+#if !defined(SDRAM_USE_DMA2D) || defined(__DOXYGEN__)
+#define SDRAM_USE_DMA2D                     TRUE
+#endif
+
+/**
+ * @brief   Number of errors recorded with their address.
+ */
+#if !defined(SDRAM_MAX_ERRORS) || defined(__DOXYGEN__)
+#define SDRAM_MAX_ERRORS                    8
+#endif
+
+/** @} */
+
+/*===========================================================================*/
+/* Derived constants and error checks.                                       */
+/*===========================================================================*/
+
+#if SDRAM_USE_DMA && (SDRAM_DMA_STREAM < STM32_DMA_STREAM_ID(2, 0) ||        \
+                      SDRAM_DMA_STREAM > STM32_DMA_STREAM_ID(2, 7))
+#error "SDRAM_DMA_STREAM must be a DMA2 stream"
+#endif
+
+#if SDRAM_USE_DMA2D && (!STM32_DMA2D_USE_DMA2D || !DMA2D_USE_QUEUE)
+#error "SDRAM_USE_DMA2D requires the DMA2D driver and DMA2D_USE_QUEUE"
+#endif
+
+/*===========================================================================*/
+/* Module data structures and types.                                         */
+/*===========================================================================*/
+
+/**
+ * @brief   Fill engine.
+ */
+typedef enum sdramengine_t {
+  SDRAM_ENGINE_CPU   = 0,               /**< Unrolled word stores.*/
+  SDRAM_ENGINE_DMA   = 1,               /**< DMA2 memory-to-memory stream.*/
+  SDRAM_ENGINE_DMA2D = 2,               /**< DMA2D register-to-memory.*/
+} sdramengine_t;
+
+/**
+ * @brief   Memory test.
+ */
+typedef enum sdramtest_t {
+  SDRAM_TEST_DATA_BUS    = 0,           /**< Walking ones and zeros.*/
+  SDRAM_TEST_ADDRESS_BUS = 1,           /**< Power of two offsets.*/
+  SDRAM_TEST_ADDRESS     = 2,           /**< Own address as data.*/
+  SDRAM_TEST_MARCH       = 3,           /**< Word-wide March C-.*/
+} sdramtest_t;
+
+/**
+ * @brief   Recorded error.
+ */
+typedef struct SDRAMError {
+  const volatile uint32_t *addressp;    /**< Failing word.*/
+  uint32_t              expected;       /**< Expected value.*/
+  uint32_t              actual;         /**< Read value.*/
+} SDRAMError;
+
+/**
+ * @brief   Operations report.
+ * @details Reports accumulate over operations until reinitialized.
+ */
+typedef struct SDRAMReport {
+  uint32_t              bytes;          /**< Bytes written and read.*/
+  halrtcnt_t            ticks;          /**< Elapsed realtime counter ticks.*/
+  uint32_t              errors;         /**< Mismatching words.*/
+  SDRAMError            first[SDRAM_MAX_ERRORS]; /**< First errors.*/
+} SDRAMReport;
+
+/*===========================================================================*/
+/* Module macros.                                                            */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* External declarations.                                                    */
+/*===========================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void sdramReportInit(SDRAMReport *rp);
+  uint32_t sdramGetRate(const SDRAMReport *rp);
+  msg_t sdramFill(uint32_t *p, size_t n, uint32_t pattern,
+                  sdramengine_t engine, SDRAMReport *rp);
+  uint32_t sdramVerify(const uint32_t *p, size_t n, uint32_t pattern,
+                       SDRAMReport *rp);
+  uint32_t sdramTest(uint32_t *p, size_t n, sdramtest_t test,
+                     sdramengine_t engine, SDRAMReport *rp);
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* _SDRAM_H_ */
@@ -25,6 +25,8 @@
  * @{
  */
 
+#include <new>
+
 #include "ch.hpp"
 #include "fs.hpp"
 #include "fatfs_fsimpl.hpp"
@@ -35,6 +37,15 @@
 #define ERR_OK                          (msg_t)0
 #define ERR_TERMINATING                 (msg_t)1
 #define ERR_UNKNOWN_MSG                 (msg_t)2
+#define ERR_FAILED                      (msg_t)3
+
+#define REQ_READ                        (uint8_t)0
+#define REQ_WRITE                       (uint8_t)1
+#define REQ_SEEK                        (uint8_t)2
+#define REQ_OPEN                        (uint8_t)3
+#define REQ_CLOSE                       (uint8_t)4
+#define REQ_SYNC                        (uint8_t)5
+#define REQ_REMOVE                      (uint8_t)6
 
 using namespace chibios_rt;
 using namespace chibios_fs;
@@ -44,64 +55,163 @@ using namespace chibios_fs;
  */
 namespace chibios_fatfs {
 
-  typedef struct {
-    uint32_t            msg_code;
-    union {
-      struct {
+  /*------------------------------------------------------------------------*
+   * chibios_fatfs::FatFSRequest                                            *
+   *------------------------------------------------------------------------*/
+  FatFSRequest::FatFSRequest(void) : next(NULL), sender(NULL), file(NULL),
+                                     fname(NULL), bp(NULL), result(0),
+                                     error(FR_OK), callback(NULL) {
+
+  }
+
+  FatFSRequest::FatFSRequest(fatfscallback_t cb) : next(NULL), sender(NULL),
+                                                   file(NULL), fname(NULL),
+                                                   bp(NULL), result(0),
+                                                   error(FR_OK),
+                                                   callback(cb) {
+
+  }
 
-      };
-    } op;
-  } wmsg_t;
+#if CH_USE_MESSAGES_ASYNC
+  bool FatFSRequest::isCompleted(void) {
+    bool b;
+
+    chSysLock();
+    b = (bool)chMsgIsAnsweredI(&mr);
+    chSysUnlock();
+    return b;
+  }
+
+  msg_t FatFSRequest::waitCompletion(systime_t time) {
+
+    if (chMsgWaitAnswer(&mr, time) == RDY_TIMEOUT)
+      return RDY_TIMEOUT;
+    return RDY_OK;
+  }
+#endif /* CH_USE_MESSAGES_ASYNC */
+
+  size_t FatFSRequest::getResult(void) {
+
+    return result;
+  }
+
+  uint32_t FatFSRequest::getError(void) {
+
+    return (uint32_t)error;
+  }
 
   /*------------------------------------------------------------------------*
    * chibios_fatfs::FatFSFileWrapper                                        *
    *------------------------------------------------------------------------*/
-  FatFSFileWrapper::FatFSFileWrapper(void) : fs(NULL) {
+  FatFSFileWrapper::FatFSFileWrapper(void) : fs(NULL), next(NULL),
+                                             error(FR_OK) {
+
+  }
+
+  FatFSFileWrapper::FatFSFileWrapper(FatFSWrapper *fsref) : fs(fsref),
+                                                            next(NULL),
+                                                            error(FR_OK) {
+
+  }
+
+  size_t FatFSFileWrapper::request(uint8_t op, uint8_t *bp, uint32_t arg) {
+    FatFSRequest req;
+
+    req.op   = op;
+    req.prio = chThdGetPriority();
+    req.file = this;
+    req.bp   = bp;
+    req.arg  = arg;
+    fs->server.sendMessage((msg_t)&req);
+    return req.result;
+  }
+
+#if CH_USE_MESSAGES_ASYNC
+  void FatFSFileWrapper::startRequest(FatFSRequest *rp, uint8_t op,
+                                      uint8_t *bp, uint32_t arg,
+                                      tprio_t prio, eventmask_t mask) {
+
+    chDbgCheck(rp != NULL, "FatFSFileWrapper::startRequest");
+
+    rp->op   = op;
+    rp->prio = prio;
+    rp->file = this;
+    rp->bp   = bp;
+    rp->arg  = arg;
+    chMsgSendAsync(fs->server.thread_ref, &rp->mr, (msg_t)rp, mask);
+  }
+
+  void FatFSFileWrapper::startRead(FatFSRequest *rp, uint8_t *bp, size_t n,
+                                   tprio_t prio, eventmask_t mask) {
 
+    startRequest(rp, REQ_READ, bp, n, prio, mask);
   }
 
-  FatFSFileWrapper::FatFSFileWrapper(FatFSWrapper *fsref) : fs(fsref) {
+  void FatFSFileWrapper::startWrite(FatFSRequest *rp, const uint8_t *bp,
+                                    size_t n, tprio_t prio,
+                                    eventmask_t mask) {
 
+    startRequest(rp, REQ_WRITE, (uint8_t *)bp, n, prio, mask);
   }
 
+  void FatFSFileWrapper::startSetPosition(FatFSRequest *rp,
+                                          fileoffset_t offset,
+                                          tprio_t prio, eventmask_t mask) {
+
+    startRequest(rp, REQ_SEEK, NULL, offset, prio, mask);
+  }
+#endif /* CH_USE_MESSAGES_ASYNC */
+
   size_t FatFSFileWrapper::write(const uint8_t *bp, size_t n) {
 
-    return 0;
+    return request(REQ_WRITE, (uint8_t *)bp, n);
   }
 
   size_t FatFSFileWrapper::read(uint8_t *bp, size_t n) {
 
-    return 0;
+    return request(REQ_READ, bp, n);
   }
 
   msg_t FatFSFileWrapper::put(uint8_t b) {
 
-    return 0;
+    if (write(&b, 1) != 1)
+      return Q_RESET;
+    return Q_OK;
   }
 
   msg_t FatFSFileWrapper::get(void) {
+    uint8_t b;
 
-    return 0;
+    if (read(&b, 1) != 1)
+      return Q_RESET;
+    return b;
   }
 
   uint32_t FatFSFileWrapper::getAndClearLastError(void) {
+    uint32_t err;
 
-    return 0;
+    chSysLock();
+    err = (uint32_t)error;
+    error = FR_OK;
+    chSysUnlock();
+    return err;
   }
 
   fileoffset_t FatFSFileWrapper::getSize(void) {
 
-    return 0;
+    /* Updated by the server thread only, a word read is atomic.*/
+    return f_size(&file);
   }
 
   fileoffset_t FatFSFileWrapper::getPosition(void) {
 
-    return 0;
+    /* Updated by the server thread only, a word read is atomic.*/
+    return f_tell(&file);
   }
 
   uint32_t FatFSFileWrapper::setPosition(fileoffset_t offset) {
 
-    return 0;
+    return (uint32_t)request(REQ_SEEK, NULL, offset);
   }
 
   /*------------------------------------------------------------------------*
@@ -116,27 +226,171 @@ namespace chibios_fatfs {
    * chibios_fatfs::FatFSServerThread                                       *
    *------------------------------------------------------------------------*/
   FatFSServerThread::FatFSServerThread(void) :
-      BaseStaticThread<FATFS_THREAD_STACK_SIZE>() {
+      BaseStaticThread<FATFS_THREAD_STACK_SIZE>(), pending(NULL),
+      opened(NULL) {
+  }
+
+  /**
+   * @brief   Inserts a request in the pending list.
+   * @details The request is placed after the requests with the same or
+   *          higher priority and after any request on the same file.
+   */
+  void FatFSServerThread::enqueue(FatFSRequest *rp) {
+    FatFSRequest **pp = &pending, **ins = NULL;
+
+    while (*pp != NULL) {
+      if ((*pp)->file == rp->file)
+        ins = NULL;
+      else if ((ins == NULL) && ((*pp)->prio < rp->prio))
+        ins = pp;
+      pp = &(*pp)->next;
+    }
+    if (ins == NULL)
+      ins = pp;
+    rp->next = *ins;
+    *ins = rp;
+  }
+
+  /**
+   * @brief   Releases the sender of a served request.
+   * @note    The request must not be accessed after this call.
+   */
+  void FatFSServerThread::complete(FatFSRequest *rp) {
+
+    if ((rp->error != FR_OK) && (rp->file != NULL)) {
+      chSysLock();
+      rp->file->error = rp->error;
+      chSysUnlock();
+    }
+    if (rp->callback != NULL)
+      rp->callback(rp);
+    ThreadReference(rp->sender).releaseMessage(rp->error == FR_OK ? ERR_OK :
+                                                                  ERR_FAILED);
+  }
+
+  /**
+   * @brief   Serves a read or write request.
+   * @details The pending requests continuing the same transfer are served
+   *          together with it, runs of requests with contiguous buffers are
+   *          served by a single FatFS call.
+   */
+  void FatFSServerThread::transfer(FatFSRequest *rp) {
+    FatFSRequest *run[FATFS_MAX_MERGED_REQUESTS];
+    FatFSRequest **pp = &pending;
+    unsigned i, j, n = 0;
+
+    run[n++] = rp;
+    while ((*pp != NULL) && (n < FATFS_MAX_MERGED_REQUESTS)) {
+      FatFSRequest *qp = *pp;
+      if (qp->file == rp->file) {
+        if (qp->op != rp->op)
+          break;
+        *pp = qp->next;
+        run[n++] = qp;
+      }
+      else
+        pp = &qp->next;
+    }
+
+    i = 0;
+    while (i < n) {
+      uint8_t *bp = run[i]->bp;
+      UINT size = run[i]->arg, done = 0;
+      FRESULT err;
+
+      for (j = i + 1; (j < n) && (run[j]->bp == bp + size); j++)
+        size += run[j]->arg;
+      if (rp->op == REQ_READ)
+        err = f_read(&rp->file->file, bp, size, &done);
+      else
+        err = f_write(&rp->file->file, bp, size, &done);
+
+      /* The transferred bytes are accounted to the requests in order.*/
+      while (i < j) {
+        FatFSRequest *qp = run[i++];
+        qp->result = qp->arg < done ? qp->arg : done;
+        qp->error  = err;
+        done -= qp->result;
+        complete(qp);
+      }
+    }
+  }
+
+  /**
+   * @brief   Serves a request.
+   */
+  void FatFSServerThread::serve(FatFSRequest *rp) {
+    FatFSFileWrapper **fpp;
+
+    switch (rp->op) {
+    case REQ_READ:
+    case REQ_WRITE:
+      transfer(rp);
+      return;
+    case REQ_SEEK:
+      rp->error = f_lseek(&rp->file->file, rp->arg);
+      rp->result = rp->error == FR_OK ? FILE_OK : FILE_ERROR;
+      break;
+    case REQ_OPEN:
+      rp->error = f_open(&rp->file->file, rp->fname, (BYTE)rp->arg);
+      if (rp->error == FR_OK) {
+        rp->file->next = opened;
+        opened = rp->file;
+      }
+      break;
+    case REQ_CLOSE:
+      for (fpp = &opened; *fpp != NULL; fpp = &(*fpp)->next) {
+        if (*fpp == rp->file) {
+          *fpp = rp->file->next;
+          break;
+        }
+      }
+      rp->error = f_close(&rp->file->file);
+      break;
+    case REQ_SYNC:
+      rp->error = FR_OK;
+      for (FatFSFileWrapper *fp = opened; fp != NULL; fp = fp->next) {
+        FRESULT err = f_sync(&fp->file);
+        if (err != FR_OK)
+          rp->error = err;
+      }
+      break;
+    case REQ_REMOVE:
+      rp->error = f_unlink(rp->fname);
+      break;
+    default:
+      rp->error = FR_INVALID_PARAMETER;
+    }
+    complete(rp);
   }
 
   msg_t FatFSServerThread::main() {
-    msg_t sts;
 
     setName("fatfs");
 
-    /* Synchronous messages processing loop.*/
+    /* Requests processing loop, all the incoming requests are moved in the
+       pending list before serving the one with the highest priority.*/
     while (true) {
-      ThreadReference tr = waitMessage();
-      msg_t msg = tr.getMessage();
-      switch (msg) {
-      case MSG_TERMINATE:
-        /* The server object is being destroyed, terminating.*/
-        tr.releaseMessage(ERR_TERMINATING);
-        return 0;
-      default:
-        sts = ERR_UNKNOWN_MSG;
+      while ((pending == NULL) || isPendingMessage()) {
+        ThreadReference tr = waitMessage();
+        FatFSRequest *rp = (FatFSRequest *)tr.getMessage();
+        if (rp == (FatFSRequest *)MSG_TERMINATE) {
+          /* The server object is being destroyed, serving the queued
+             requests then terminating.*/
+          while (pending != NULL) {
+            rp = pending;
+            pending = rp->next;
+            serve(rp);
+          }
+          tr.releaseMessage(ERR_TERMINATING);
+          return 0;
+        }
+        rp->sender = tr.thread_ref;
+        enqueue(rp);
       }
-      tr.releaseMessage(sts);
+      FatFSRequest *rp = pending;
+      pending = rp->next;
+      serve(rp);
     }
   }
 
@@ -149,61 +403,107 @@ namespace chibios_fatfs {
   /*------------------------------------------------------------------------*
    * chibios_fatfs::FatFSWrapper                                            *
    *------------------------------------------------------------------------*/
-  FatFSWrapper::FatFSWrapper(void) {
+  FatFSWrapper::FatFSWrapper(void) : error(FR_OK) {
+
+  }
+
+  FRESULT FatFSWrapper::request(uint8_t op, FatFSFileWrapper *fp,
+                                const char *fname, uint32_t arg) {
+    FatFSRequest req;
+
+    req.op    = op;
+    req.prio  = chThdGetPriority();
+    req.file  = fp;
+    req.fname = fname;
+    req.arg   = arg;
+    server.sendMessage((msg_t)&req);
+    if (req.error != FR_OK) {
+      chSysLock();
+      error = req.error;
+      chSysUnlock();
+    }
+    return req.error;
+  }
 
+  BaseFileStreamInterface *FatFSWrapper::openMode(const char *fname,
+                                                  uint32_t mode) {
+    void *p;
+
+    p = server.files.alloc();
+    if (p == NULL) {
+      chSysLock();
+      error = FR_TOO_MANY_OPEN_FILES;
+      chSysUnlock();
+      return NULL;
+    }
+    FatFSFileWrapper *fp = new (p) FatFSFileWrapper(this);
+    if (request(REQ_OPEN, fp, fname, mode) != FR_OK) {
+      server.files.free(p);
+      return NULL;
+    }
+    return fp;
   }
 
   void FatFSWrapper::mount(void) {
 
+    f_mount(0, &fatfs);
     server.start(FATFS_THREAD_PRIORITY);
   }
 
   void FatFSWrapper::unmount(void) {
 
     server.stop();
+    f_mount(0, NULL);
   }
 
   uint32_t FatFSWrapper::getAndClearLastError(void) {
+    uint32_t err;
 
-    return 0;
+    chSysLock();
+    err = (uint32_t)error;
+    error = FR_OK;
+    chSysUnlock();
+    return err;
   }
 
   void FatFSWrapper::synchronize(void) {
 
+    request(REQ_SYNC, NULL, NULL, 0);
   }
 
   void FatFSWrapper::remove(const char *fname) {
 
-    (void)fname;
+    request(REQ_REMOVE, NULL, fname, 0);
   }
 
   BaseFileStreamInterface *FatFSWrapper::open(const char *fname) {
 
-    (void)fname;
-    return NULL;
+    return openMode(fname, FA_READ | FA_WRITE | FA_OPEN_EXISTING);
   }
 
   BaseFileStreamInterface *FatFSWrapper::openForRead(const char *fname) {
 
-    (void)fname;
-    return NULL;
+    return openMode(fname, FA_READ | FA_OPEN_EXISTING);
   }
 
   BaseFileStreamInterface *FatFSWrapper::openForWrite(const char *fname) {
 
-    (void)fname;
-    return NULL;
+    return openMode(fname, FA_WRITE | FA_OPEN_EXISTING);
   }
 
   BaseFileStreamInterface *FatFSWrapper::create(const char *fname) {
 
-    (void)fname;
-    return NULL;
+    return openMode(fname, FA_WRITE | FA_CREATE_ALWAYS);
   }
 
   void FatFSWrapper::close(BaseFileStreamInterface *file) {
+    FatFSFileWrapper *fp = static_cast<FatFSFileWrapper *>(file);
+
+    chDbgCheck(fp != NULL, "FatFSWrapper::close");
 
-    (void)file;
+    request(REQ_CLOSE, fp, NULL, 0);
+    fp->~FatFSFileWrapper();
+    server.files.free(fp);
   }
 }
 
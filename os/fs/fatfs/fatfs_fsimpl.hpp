@@ -28,6 +28,7 @@
 
 #include "ch.hpp"
 #include "fs.hpp"
+#include "ff.h"
 
 #ifndef _FS_FATFS_IMPL_HPP_
 #define _FS_FATFS_IMPL_HPP_
@@ -53,6 +54,16 @@
 #define FATFS_MAX_FILES                 16
 #endif
 
+/**
+ * @brief   Maximum number of requests merged in a single transfer.
+ * @details Queued read or write requests that continue a transfer on the
+ *          same file are served together with it, requests with contiguous
+ *          buffers are served by a single FatFS call.
+ */
+#if !defined(FATFS_MAX_MERGED_REQUESTS) || defined(__DOXYGEN__)
+#define FATFS_MAX_MERGED_REQUESTS       8
+#endif
+
 using namespace chibios_rt;
 using namespace chibios_fs;
 
@@ -62,15 +73,143 @@ using namespace chibios_fs;
 namespace chibios_fatfs {
 
   class FatFSWrapper;
+  class FatFSFileWrapper;
+  class FatFSRequest;
+
+  /**
+   * @brief   Request completion callback type.
+   * @note    The callback is invoked by the server thread.
+   */
+  typedef void (*fatfscallback_t)(FatFSRequest *rp);
+
+  /*------------------------------------------------------------------------*
+   * chibios_fatfs::FatFSRequest                                            *
+   *------------------------------------------------------------------------*/
+  /**
+   * @brief   Class of a request to the server thread.
+   * @details Queued requests are served in order of priority, requests on
+   *          the same file are always served in submission order.
+   */
+  class FatFSRequest {
+    friend class FatFSServerThread;
+    friend class FatFSFileWrapper;
+    friend class FatFSWrapper;
+
+  protected:
+#if CH_USE_MESSAGES_ASYNC || defined(__DOXYGEN__)
+    /**
+     * @brief   Asynchronous message carrying the request.
+     */
+    MsgRequest                  mr;
+#endif
+    /**
+     * @brief   Next request in the server queue.
+     */
+    FatFSRequest                *next;
+    /**
+     * @brief   Sender thread, or its proxy, to be released on completion.
+     */
+    ::Thread                    *sender;
+    /**
+     * @brief   Requested operation.
+     */
+    uint8_t                     op;
+    /**
+     * @brief   Request priority.
+     */
+    tprio_t                     prio;
+    /**
+     * @brief   Target file or @p NULL for file system operations.
+     */
+    FatFSFileWrapper            *file;
+    /**
+     * @brief   File name for open and remove operations.
+     */
+    const char                  *fname;
+    /**
+     * @brief   Transfer buffer.
+     */
+    uint8_t                     *bp;
+    /**
+     * @brief   Transfer size, file offset or open mode.
+     */
+    uint32_t                    arg;
+    /**
+     * @brief   Transferred bytes or operation status.
+     */
+    size_t                      result;
+    /**
+     * @brief   FatFS result code.
+     */
+    FRESULT                     error;
+
+  public:
+    /**
+     * @brief   Completion callback or @p NULL.
+     */
+    fatfscallback_t             callback;
+
+    FatFSRequest(void);
+    FatFSRequest(fatfscallback_t cb);
+
+#if CH_USE_MESSAGES_ASYNC || defined(__DOXYGEN__)
+    /**
+     * @brief   Returns @p true if the request has been served.
+     */
+    bool isCompleted(void);
+
+    /**
+     * @brief   Waits for the request to be served.
+     *
+     * @param[in] time      the number of ticks before the operation timeouts,
+     *                      the special values are handled as follow:
+     *                      - @a TIME_INFINITE no timeout.
+     *                      - @a TIME_IMMEDIATE immediate timeout.
+     *                      .
+     * @return              The wakeup message.
+     * @retval RDY_OK       if the request has been served.
+     * @retval RDY_TIMEOUT  if a timeout occurred.
+     */
+    msg_t waitCompletion(systime_t time);
+#endif
+
+    /**
+     * @brief   Returns the result of a completed request.
+     * @details The number of transferred bytes for read and write requests,
+     *          @p FILE_OK or @p FILE_ERROR for position requests.
+     */
+    size_t getResult(void);
+
+    /**
+     * @brief   Returns the FatFS result code of a completed request.
+     */
+    uint32_t getError(void);
+  };
 
   /*------------------------------------------------------------------------*
    * chibios_fatfs::FatFSFileWrapper                                        *
    *------------------------------------------------------------------------*/
+  /**
+   * @brief   Class of a file handled by the server thread.
+   * @note    Each file has its own FatFS file object, if @p _FS_TINY is
+   *          disabled it includes a private sector buffer so interleaved
+   *          accesses to different files do not evict each other data.
+   */
   class FatFSFileWrapper : public BaseFileStreamInterface {
     friend class FatFSWrapper;
+    friend class FatFSServerThread;
 
   protected:
     FatFSWrapper *fs;
+    FatFSFileWrapper *next;
+    FIL file;
+    FRESULT error;
+
+    size_t request(uint8_t op, uint8_t *bp, uint32_t arg);
+#if CH_USE_MESSAGES_ASYNC
+    void startRequest(FatFSRequest *rp, uint8_t op, uint8_t *bp, uint32_t arg,
+                      tprio_t prio, eventmask_t mask);
+#endif
 
   public:
     FatFSFileWrapper(void);
@@ -84,6 +223,52 @@ namespace chibios_fatfs {
     virtual fileoffset_t getSize(void);
     virtual fileoffset_t getPosition(void);
     virtual uint32_t setPosition(fileoffset_t offset);
+
+#if CH_USE_MESSAGES_ASYNC || defined(__DOXYGEN__)
+    /**
+     * @brief   Queues a read request.
+     * @note    The request and the buffer must not be reused until the
+     *          request has been served.
+     *
+     * @param[in] rp        the request object
+     * @param[out] bp       pointer to the data buffer
+     * @param[in] n         the number of bytes to be read
+     * @param[in] prio      the request priority
+     * @param[in] mask      events signaled to the calling thread on
+     *                      completion, zero if not required
+     */
+    void startRead(FatFSRequest *rp, uint8_t *bp, size_t n,
+                   tprio_t prio, eventmask_t mask);
+
+    /**
+     * @brief   Queues a write request.
+     * @note    The request and the buffer must not be reused until the
+     *          request has been served.
+     *
+     * @param[in] rp        the request object
+     * @param[in] bp        pointer to the data buffer
+     * @param[in] n         the number of bytes to be written
+     * @param[in] prio      the request priority
+     * @param[in] mask      events signaled to the calling thread on
+     *                      completion, zero if not required
+     */
+    void startWrite(FatFSRequest *rp, const uint8_t *bp, size_t n,
+                    tprio_t prio, eventmask_t mask);
+
+    /**
+     * @brief   Queues a file pointer position request.
+     * @note    The request must not be reused until the request has been
+     *          served.
+     *
+     * @param[in] rp        the request object
+     * @param[in] offset    new absolute position
+     * @param[in] prio      the request priority
+     * @param[in] mask      events signaled to the calling thread on
+     *                      completion, zero if not required
+     */
+    void startSetPosition(FatFSRequest *rp, fileoffset_t offset,
+                          tprio_t prio, eventmask_t mask);
+#endif
   };
 
   /*------------------------------------------------------------------------*
@@ -105,8 +290,17 @@ namespace chibios_fatfs {
    * @brief   Class of the internal server thread.
    */
   class FatFSServerThread : public BaseStaticThread<FATFS_THREAD_STACK_SIZE> {
+    friend class FatFSWrapper;
+
   private:
     FatFSFilesPool files;
+    FatFSRequest *pending;
+    FatFSFileWrapper *opened;
+
+    void enqueue(FatFSRequest *rp);
+    void serve(FatFSRequest *rp);
+    void transfer(FatFSRequest *rp);
+    void complete(FatFSRequest *rp);
   protected:
     virtual msg_t main(void);
   public:
@@ -125,6 +319,12 @@ namespace chibios_fatfs {
 
   protected:
     FatFSServerThread server;
+    FATFS fatfs;
+    FRESULT error;
+
+    FRESULT request(uint8_t op, FatFSFileWrapper *fp, const char *fname,
+                    uint32_t arg);
+    BaseFileStreamInterface *openMode(const char *fname, uint32_t mode);
 
   public:
     FatFSWrapper(void);
@@ -59,6 +59,36 @@
 #if !defined(MMC_NICE_WAITING) || defined(__DOXYGEN__)
 #define MMC_NICE_WAITING            TRUE
 #endif
+
+/**
+ * @brief   Enables the fast transfers path.
+ * @details If enabled the data token and the card busy condition are
+ *          polled in windows of @p MMC_TOKEN_WINDOW bytes, each block is
+ *          transferred with its CRC in a single operation and multiple
+ *          blocks operations copy a block while the next one is being
+ *          transferred.
+ * @note    Each driver instance requires two staging buffers, they must
+ *          be accessible by the SPI DMA.
+ */
+#if !defined(MMC_USE_FAST_PATH) || defined(__DOXYGEN__)
+#define MMC_USE_FAST_PATH           FALSE
+#endif
+
+/**
+ * @brief   Size of the polling windows used by the fast transfers path.
+ */
+#if !defined(MMC_TOKEN_WINDOW) || defined(__DOXYGEN__)
+#define MMC_TOKEN_WINDOW            16
+#endif
+
+/**
+ * @brief   Enables the data blocks CRC.
+ * @details If enabled the CRC-16 of the read blocks is verified and the
+ *          written blocks carry a valid CRC-16.
+ */
+#if !defined(MMC_USE_DATA_CRC) || defined(__DOXYGEN__)
+#define MMC_USE_DATA_CRC            FALSE
+#endif
 /** @} */
 
 /*===========================================================================*/
@@ -69,6 +99,10 @@
 #error "MMC_SPI driver requires HAL_USE_SPI and SPI_USE_WAIT"
 #endif
 
+#if MMC_USE_FAST_PATH && ((MMC_TOKEN_WINDOW < 2) || (MMC_TOKEN_WINDOW > 64))
+#error "invalid MMC_TOKEN_WINDOW value"
+#endif
+
 /*===========================================================================*/
 /* Driver data structures and types.                                         */
 /*===========================================================================*/
@@ -125,6 +159,12 @@ typedef struct {
    * @brief Addresses use blocks instead of bytes.
    */
   bool_t                block_addresses;
+#if MMC_USE_FAST_PATH || defined(__DOXYGEN__)
+  /**
+   * @brief Staging buffers, polling window, block and CRC.
+   */
+  uint8_t               buf[2][MMC_TOKEN_WINDOW + MMCSD_BLOCK_SIZE + 2];
+#endif
 } MMCDriver;
 
 /*===========================================================================*/
@@ -96,16 +96,56 @@
 #if !defined(SDC_NICE_WAITING) || defined(__DOXYGEN__)
 #define SDC_NICE_WAITING                TRUE
 #endif
+
+/**
+ * @brief   Enables the asynchronous transfers API.
+ * @details The API allows to start a transfer, do other work and then
+ *          collect the result, the end of the transfer is signaled by an
+ *          event source.
+ */
+#if !defined(SDC_USE_ASYNC) || defined(__DOXYGEN__)
+#define SDC_USE_ASYNC                   FALSE
+#endif
 /** @} */
 
 /*===========================================================================*/
 /* Derived constants and error checks.                                       */
 /*===========================================================================*/
 
+#if SDC_USE_ASYNC && !CH_USE_EVENTS
+#error "SDC_USE_ASYNC requires CH_USE_EVENTS"
+#endif
+
 /*===========================================================================*/
 /* Driver data structures and types.                                         */
 /*===========================================================================*/
 
+#if SDC_USE_ASYNC || defined(__DOXYGEN__)
+#define _sdc_driver_event_data                                              \
+  /* Transfer completion event.*/                                           \
+  EventSource               event;
+#else
+#define _sdc_driver_event_data
+#endif
+
+/**
+ * @brief   @p SDCDriver specific data.
+ * @details Mandatory fields of the @p SDCDriver structure, they are used by
+ *          the high level driver and must be placed by all the low level
+ *          drivers after the virtual methods table pointer.
+ */
+#define _sdc_driver_data                                                    \
+  _mmcsd_block_device_data                                                  \
+  /* Current configuration data.*/                                          \
+  const SDCConfig           *config;                                        \
+  /* Various flags regarding the mounted card.*/                            \
+  sdcmode_t                 cardmode;                                       \
+  /* Errors flags.*/                                                        \
+  sdcflags_t                errors;                                         \
+  /* Card RCA.*/                                                            \
+  uint32_t                  rca;                                            \
+  _sdc_driver_event_data
+
 #include "sdc_lld.h"
 
 /*===========================================================================*/
@@ -147,6 +187,21 @@
  * @api
  */
 #define sdcIsWriteProtected(sdcp) (sdc_lld_is_write_protected(sdcp))
+
+/**
+ * @brief   Returns the transfer completion event source.
+ * @details The event is broadcasted at the end of every data transfer,
+ *          asynchronous transfers are then completed by calling
+ *          @p sdcWaitTransfer().
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ * @return              The pointer to the @p EventSource structure.
+ *
+ * @api
+ */
+#if SDC_USE_ASYNC || defined(__DOXYGEN__)
+#define sdcGetEventSource(sdcp) (&(sdcp)->event)
+#endif
 /** @} */
 
 /*===========================================================================*/
@@ -166,6 +221,13 @@ extern "C" {
                  uint8_t *buffer, uint32_t n);
   bool_t sdcWrite(SDCDriver *sdcp, uint32_t startblk,
                   const uint8_t *buffer, uint32_t n);
+#if SDC_USE_ASYNC
+  bool_t sdcStartRead(SDCDriver *sdcp, uint32_t startblk,
+                      uint8_t *buf, uint32_t n);
+  bool_t sdcStartWrite(SDCDriver *sdcp, uint32_t startblk,
+                       const uint8_t *buf, uint32_t n);
+  bool_t sdcWaitTransfer(SDCDriver *sdcp);
+#endif
   sdcflags_t sdcGetAndClearErrors(SDCDriver *sdcp);
   bool_t sdcSync(SDCDriver *sdcp);
   bool_t sdcGetInfo(SDCDriver *sdcp, BlockDeviceInfo *bdip);
@@ -0,0 +1,46 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    Linux/console.h
+ * @brief   Simulator console driver header.
+ * @details The console is a @p BaseChannel mapped synchronously on the
+ *          process standard input and output, it does not depend on the
+ *          kernel scheduling and is meant for test and log output.
+ *
+ * @addtogroup HAL
+ * @{
+ */
+
+#ifndef _CONSOLE_H_
+#define _CONSOLE_H_
+
+/**
+ * @brief   Console driver.
+ */
+extern BaseChannel CD1;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void conInit(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CONSOLE_H_ */
+
+/** @} */
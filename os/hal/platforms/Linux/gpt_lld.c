@@ -0,0 +1,214 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    Linux/gpt_lld.c
+ * @brief   Linux simulator low level GPT driver code.
+ *
+ * @addtogroup GPT
+ * @{
+ */
+
+#include "ch.h"
+#include "hal.h"
+
+#if HAL_USE_GPT || defined(__DOXYGEN__)
+
+/*===========================================================================*/
+/* Driver local definitions.                                                 */
+/*===========================================================================*/
+
+/**
+ * @brief   Converts timer ticks in nanoseconds.
+ */
+#define TICKS2NS(gptp, n)                                                   \
+  (((uint64_t)(n) * 1000000000ULL) / (gptp)->config->frequency)
+
+/*===========================================================================*/
+/* Driver exported variables.                                                */
+/*===========================================================================*/
+
+/**
+ * @brief   GPTD1 driver identifier.
+ */
+#if LINUX_GPT_USE_GPT1 || defined(__DOXYGEN__)
+GPTDriver GPTD1;
+#endif
+
+/**
+ * @brief   GPTD2 driver identifier.
+ */
+#if LINUX_GPT_USE_GPT2 || defined(__DOXYGEN__)
+GPTDriver GPTD2;
+#endif
+
+/*===========================================================================*/
+/* Driver local variables and types.                                         */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Driver local functions.                                                   */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Driver interrupt handlers.                                                */
+/*===========================================================================*/
+
+/**
+ * @brief   Simulated timer interrupt.
+ *
+ * @param[in] gptp      pointer to a @p GPTDriver object
+ * @return              @p TRUE if the interrupt has been served.
+ */
+static bool_t serve_interrupt(GPTDriver *gptp) {
+
+  if ((gptp->period == 0) || (_sim_get_time_ns() < gptp->deadline))
+    return FALSE;
+
+  CH_IRQ_PROLOGUE();
+
+  if (gptp->state == GPT_ONESHOT) {
+    gptp->state = GPT_READY;
+    gpt_lld_stop_timer(gptp);
+  }
+  else
+    gptp->deadline += gptp->period;
+  gptp->config->callback(gptp);
+
+  CH_IRQ_EPILOGUE();
+
+  return TRUE;
+}
+
+/*===========================================================================*/
+/* Driver exported functions.                                                */
+/*===========================================================================*/
+
+/**
+ * @brief   Low level GPT driver initialization.
+ *
+ * @notapi
+ */
+void gpt_lld_init(void) {
+
+#if LINUX_GPT_USE_GPT1
+  gptObjectInit(&GPTD1);
+  GPTD1.period = 0;
+#endif
+
+#if LINUX_GPT_USE_GPT2
+  gptObjectInit(&GPTD2);
+  GPTD2.period = 0;
+#endif
+}
+
+/**
+ * @brief   Configures and activates the GPT peripheral.
+ *
+ * @param[in] gptp      pointer to the @p GPTDriver object
+ *
+ * @notapi
+ */
+void gpt_lld_start(GPTDriver *gptp) {
+
+  chDbgAssert((gptp->config->frequency > 0) &&
+              (gptp->config->frequency <= 1000000000),
+              "gpt_lld_start(), #1", "invalid frequency");
+
+  gptp->period = 0;
+}
+
+/**
+ * @brief   Deactivates the GPT peripheral.
+ *
+ * @param[in] gptp      pointer to the @p GPTDriver object
+ *
+ * @notapi
+ */
+void gpt_lld_stop(GPTDriver *gptp) {
+
+  gptp->period = 0;
+}
+
+/**
+ * @brief   Starts the timer in continuous mode.
+ *
+ * @param[in] gptp      pointer to the @p GPTDriver object
+ * @param[in] interval  period in ticks
+ *
+ * @notapi
+ */
+void gpt_lld_start_timer(GPTDriver *gptp, gptcnt_t interval) {
+
+  gptp->period   = TICKS2NS(gptp, interval);
+  gptp->deadline = _sim_get_time_ns() + gptp->period;
+}
+
+/**
+ * @brief   Stops the timer.
+ *
+ * @param[in] gptp      pointer to the @p GPTDriver object
+ *
+ * @notapi
+ */
+void gpt_lld_stop_timer(GPTDriver *gptp) {
+
+  gptp->period = 0;
+}
+
+/**
+ * @brief   Starts the timer in one shot mode and waits for completion.
+ * @details This function specifically polls the timer waiting for completion
+ *          in order to not have extra delays caused by interrupt servicing,
+ *          this function is only recommended for short delays.
+ *
+ * @param[in] gptp      pointer to the @p GPTDriver object
+ * @param[in] interval  time interval in ticks
+ *
+ * @notapi
+ */
+void gpt_lld_polled_delay(GPTDriver *gptp, gptcnt_t interval) {
+  uint64_t deadline = _sim_get_time_ns() + TICKS2NS(gptp, interval);
+
+  while (_sim_get_time_ns() < deadline)
+    ;
+}
+
+/**
+ * @brief   GPT interrupts simulation.
+ * @details Invoked by @p ChkIntSources().
+ *
+ * @return              @p TRUE if an interrupt has been served.
+ *
+ * @notapi
+ */
+bool_t gpt_lld_interrupt_pending(void) {
+  bool_t served = FALSE;
+
+#if LINUX_GPT_USE_GPT1
+  if (serve_interrupt(&GPTD1))
+    served = TRUE;
+#endif
+#if LINUX_GPT_USE_GPT2
+  if (serve_interrupt(&GPTD2))
+    served = TRUE;
+#endif
+  return served;
+}
+
+#endif /* HAL_USE_GPT */
+
+/** @} */
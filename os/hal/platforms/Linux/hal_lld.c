@@ -0,0 +1,243 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    Linux/hal_lld.c
+ * @brief   Linux simulator HAL subsystem low level driver code.
+ *
+ * @addtogroup HAL
+ * @{
+ */
+
+#include <time.h>
+
+#include "ch.h"
+#include "hal.h"
+
+/*===========================================================================*/
+/* Driver local definitions.                                                 */
+/*===========================================================================*/
+
+#define NS_PER_SECOND                       1000000000ULL
+
+#if CH_TIMEDELTA == 0
+/**
+ * @brief   System tick period in nanoseconds.
+ */
+#define SIM_TICK_NS                         (NS_PER_SECOND / CH_FREQUENCY)
+#endif
+
+/*===========================================================================*/
+/* Driver exported variables.                                                */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Driver local variables and types.                                         */
+/*===========================================================================*/
+
+#if CH_TIMEDELTA == 0
+/**
+ * @brief   Time of the next system tick.
+ */
+static uint64_t nexttick;
+#else
+/**
+ * @brief   Host time of the system timer zero.
+ */
+static uint64_t origin;
+
+/**
+ * @brief   System timer alarm enable.
+ */
+static bool_t alarm_enabled;
+
+/**
+ * @brief   System timer alarm time.
+ */
+static systime_t alarm_time;
+#endif
+
+/*===========================================================================*/
+/* Driver local functions.                                                   */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Driver interrupt handlers.                                                */
+/*===========================================================================*/
+
+/**
+ * @brief   System timer simulated interrupt.
+ * @details Periodic tick or tick-less alarm depending on @p CH_TIMEDELTA.
+ *
+ * @return              @p TRUE if the interrupt has been served.
+ *
+ * @notapi
+ */
+static bool_t systimer_interrupt_pending(void) {
+
+#if CH_TIMEDELTA == 0
+  /* Ticks lost while the process was not running are recovered one per
+     invocation, the system time stays in sync with the host time.*/
+  if (_sim_get_time_ns() < nexttick)
+    return FALSE;
+  nexttick += SIM_TICK_NS;
+#else
+  if (!alarm_enabled ||
+      ((systime_t)(port_timer_get_time() - alarm_time) >
+       (systime_t)((systime_t)-1 / 2)))
+    return FALSE;
+#endif
+
+  CH_IRQ_PROLOGUE();
+
+  chSysLockFromIsr();
+  chSysTimerHandlerI();
+  chSysUnlockFromIsr();
+
+  CH_IRQ_EPILOGUE();
+
+  return TRUE;
+}
+
+/*===========================================================================*/
+/* Driver exported functions.                                                */
+/*===========================================================================*/
+
+/**
+ * @brief   Low level HAL driver initialization.
+ *
+ * @notapi
+ */
+void hal_lld_init(void) {
+
+#if CH_TIMEDELTA == 0
+  nexttick = _sim_get_time_ns() + SIM_TICK_NS;
+#else
+  origin = _sim_get_time_ns();
+  alarm_enabled = FALSE;
+#endif
+}
+
+/**
+ * @brief   Returns the host monotonic time.
+ *
+ * @return              The time in nanoseconds.
+ *
+ * @notapi
+ */
+uint64_t _sim_get_time_ns(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * NS_PER_SECOND + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief   Reschedules after a simulated interrupt.
+ * @details This is the equivalent of the preemption performed on exit
+ *          from an interrupt handler on a real target.
+ *
+ * @notapi
+ */
+void _sim_check_preemption(void) {
+
+  chSysLock();
+  if (chSchIsPreemptionRequired())
+    chSchDoReschedule();
+  chSysUnlock();
+}
+
+/**
+ * @brief   Interrupt simulation.
+ * @details Polls all the simulated interrupt sources and serves the pending
+ *          ones, a reschedule is then performed if required. This function
+ *          is invoked by the idle thread and must be invoked periodically
+ *          by any code busy looping outside the kernel.
+ *
+ * @special
+ */
+void ChkIntSources(void) {
+  bool_t served = FALSE;
+
+#if HAL_USE_SERIAL
+  if (sd_lld_interrupt_pending())
+    served = TRUE;
+#endif
+#if HAL_USE_GPT
+  if (gpt_lld_interrupt_pending())
+    served = TRUE;
+#endif
+  if (systimer_interrupt_pending())
+    served = TRUE;
+
+  if (served)
+    _sim_check_preemption();
+}
+
+#if (CH_TIMEDELTA > 0) || defined(__DOXYGEN__)
+/**
+ * @brief   Starts the system timer alarm.
+ *
+ * @param[in] time      the absolute time of the alarm
+ *
+ * @notapi
+ */
+void port_timer_start_alarm(systime_t time) {
+
+  alarm_time    = time;
+  alarm_enabled = TRUE;
+}
+
+/**
+ * @brief   Stops the system timer alarm.
+ *
+ * @notapi
+ */
+void port_timer_stop_alarm(void) {
+
+  alarm_enabled = FALSE;
+}
+
+/**
+ * @brief   Changes the time of the system timer alarm.
+ *
+ * @param[in] time      the new absolute time of the alarm
+ *
+ * @notapi
+ */
+void port_timer_set_alarm(systime_t time) {
+
+  alarm_time = time;
+}
+
+/**
+ * @brief   Returns the current system time.
+ * @details The host time elapsed since the HAL initialization is scaled to
+ *          @p CH_FREQUENCY.
+ *
+ * @return              The value of the free running counter.
+ *
+ * @notapi
+ */
+systime_t port_timer_get_time(void) {
+  uint64_t t = _sim_get_time_ns() - origin;
+
+  return (systime_t)((t / NS_PER_SECOND) * CH_FREQUENCY +
+                     ((t % NS_PER_SECOND) * CH_FREQUENCY) / NS_PER_SECOND);
+}
+#endif /* CH_TIMEDELTA > 0 */
+
+/** @} */
@@ -0,0 +1,76 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    Linux/pal_lld.c
+ * @brief   Linux simulator low level PAL driver code.
+ *
+ * @addtogroup PAL
+ * @{
+ */
+
+#include "ch.h"
+#include "hal.h"
+
+#if HAL_USE_PAL || defined(__DOXYGEN__)
+
+/**
+ * @brief   VIO1 simulated port.
+ */
+sim_vio_port_t vio_port_1;
+
+/**
+ * @brief   VIO2 simulated port.
+ */
+sim_vio_port_t vio_port_2;
+
+/**
+ * @brief   Pads mode setup.
+ * @details This function programs a pads group belonging to the same port
+ *          with the specified mode.
+ * @note    The pull-up and pull-down modes are treated as inputs, the open
+ *          drain mode is treated as push-pull.
+ *
+ * @param[in] port      the port identifier
+ * @param[in] mask      the group mask
+ * @param[in] mode      the mode
+ *
+ * @notapi
+ */
+void _pal_lld_setgroupmode(ioportid_t port,
+                           ioportmask_t mask,
+                           iomode_t mode) {
+
+  switch (mode) {
+  case PAL_MODE_RESET:
+  case PAL_MODE_INPUT:
+  case PAL_MODE_INPUT_PULLUP:
+  case PAL_MODE_INPUT_PULLDOWN:
+    port->dir &= ~mask;
+    break;
+  case PAL_MODE_UNCONNECTED:
+    port->latch |= mask;
+    /* Falls through.*/
+  case PAL_MODE_OUTPUT_PUSHPULL:
+  case PAL_MODE_OUTPUT_OPENDRAIN:
+    port->dir |= mask;
+    break;
+  }
+}
+
+#endif /* HAL_USE_PAL */
+
+/** @} */
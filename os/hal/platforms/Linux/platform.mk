@@ -0,0 +1,8 @@
+# List of all the Linux simulator platform files.
+PLATFORMSRC = ${CHIBIOS}/os/hal/platforms/Linux/hal_lld.c \
+              ${CHIBIOS}/os/hal/platforms/Linux/gpt_lld.c \
+              ${CHIBIOS}/os/hal/platforms/Linux/pal_lld.c \
+              ${CHIBIOS}/os/hal/platforms/Linux/serial_lld.c
+
+# Required include directories
+PLATFORMINC = ${CHIBIOS}/os/hal/platforms/Linux
@@ -0,0 +1,205 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    Linux/serial_lld.c
+ * @brief   Linux simulator low level serial driver code.
+ *
+ * @addtogroup SERIAL
+ * @{
+ */
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#if HAL_USE_SERIAL || defined(__DOXYGEN__)
+
+/*===========================================================================*/
+/* Driver local definitions.                                                 */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Driver exported variables.                                                */
+/*===========================================================================*/
+
+/**
+ * @brief   SD1 driver identifier.
+ */
+#if LINUX_SERIAL_USE_SD1 || defined(__DOXYGEN__)
+SerialDriver SD1;
+#endif
+
+/*===========================================================================*/
+/* Driver local variables and types.                                         */
+/*===========================================================================*/
+
+/**
+ * @brief   Driver default configuration, standard input and output.
+ */
+static const SerialConfig default_config = {
+  SERIAL_DEFAULT_BITRATE,
+  STDIN_FILENO,
+  STDOUT_FILENO
+};
+
+/*===========================================================================*/
+/* Driver local functions.                                                   */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Driver interrupt handlers.                                                */
+/*===========================================================================*/
+
+/**
+ * @brief   Simulated serial interrupt.
+ * @details The input descriptor is polled without blocking and the
+ *          received data is pushed in the input queue, the output queue
+ *          is then drained into the output descriptor.
+ *
+ * @param[in] sdp       pointer to a @p SerialDriver object
+ * @return              @p TRUE if the interrupt has been served.
+ */
+static bool_t serve_interrupt(SerialDriver *sdp) {
+  uint8_t buf[SERIAL_BUFFERS_SIZE];
+  bool_t served = FALSE;
+  ssize_t i, n;
+
+  if (sdp->state != SD_READY)
+    return FALSE;
+
+  if (sdp->infd >= 0) {
+    struct pollfd pfd;
+
+    pfd.fd      = sdp->infd;
+    pfd.events  = POLLIN;
+    pfd.revents = 0;
+    if (poll(&pfd, 1, 0) > 0) {
+      n = read(sdp->infd, buf, sizeof(buf));
+
+      CH_IRQ_PROLOGUE();
+      chSysLockFromIsr();
+      if (n > 0) {
+        for (i = 0; i < n; i++)
+          sdIncomingDataI(sdp, buf[i]);
+      }
+      else {
+        /* End of file or error, the descriptor is no more polled.*/
+        chnAddFlagsI(sdp, CHN_DISCONNECTED);
+        sdp->infd = -1;
+      }
+      chSysUnlockFromIsr();
+      CH_IRQ_EPILOGUE();
+      served = TRUE;
+    }
+  }
+
+  if ((sdp->outfd >= 0) && !chOQIsEmptyI(&sdp->oqueue)) {
+    n = 0;
+
+    CH_IRQ_PROLOGUE();
+    chSysLockFromIsr();
+    while (n < (ssize_t)sizeof(buf)) {
+      msg_t b = sdRequestDataI(sdp);
+
+      if (b < Q_OK)
+        break;
+      buf[n++] = (uint8_t)b;
+    }
+    chSysUnlockFromIsr();
+    CH_IRQ_EPILOGUE();
+
+    if (write(sdp->outfd, buf, (size_t)n) < 0)
+      sdp->outfd = -1;
+    served = TRUE;
+  }
+  return served;
+}
+
+/*===========================================================================*/
+/* Driver exported functions.                                                */
+/*===========================================================================*/
+
+/**
+ * @brief   Low level serial driver initialization.
+ *
+ * @notapi
+ */
+void sd_lld_init(void) {
+
+#if LINUX_SERIAL_USE_SD1
+  sdObjectInit(&SD1, NULL, NULL);
+  SD1.infd  = -1;
+  SD1.outfd = -1;
+#endif /* LINUX_SERIAL_USE_SD1 */
+}
+
+/**
+ * @brief   Low level serial driver configuration and (re)start.
+ *
+ * @param[in] sdp       pointer to a @p SerialDriver object
+ * @param[in] config    the architecture-dependent serial driver configuration.
+ *                      If this parameter is set to @p NULL then a default
+ *                      configuration is used.
+ *
+ * @notapi
+ */
+void sd_lld_start(SerialDriver *sdp, const SerialConfig *config) {
+
+  if (config == NULL)
+    config = &default_config;
+
+  sdp->infd  = config->sc_infd;
+  sdp->outfd = config->sc_outfd;
+  chnAddFlagsI(sdp, CHN_CONNECTED);
+}
+
+/**
+ * @brief   Low level serial driver stop.
+ *
+ * @param[in] sdp       pointer to a @p SerialDriver object
+ *
+ * @notapi
+ */
+void sd_lld_stop(SerialDriver *sdp) {
+
+  sdp->infd  = -1;
+  sdp->outfd = -1;
+}
+
+/**
+ * @brief   Serial interrupts simulation.
+ * @details Invoked by @p ChkIntSources().
+ *
+ * @return              @p TRUE if an interrupt has been served.
+ *
+ * @notapi
+ */
+bool_t sd_lld_interrupt_pending(void) {
+  bool_t served = FALSE;
+
+#if LINUX_SERIAL_USE_SD1
+  if (serve_interrupt(&SD1))
+    served = TRUE;
+#endif
+  return served;
+}
+
+#endif /* HAL_USE_SERIAL */
+
+/** @} */
@@ -101,6 +101,154 @@ static const uint8_t dma2d_bpp[DMA2D_MAX_PIXFMT_ID + 1] = {
 /* Driver local functions.                                                   */
 /*===========================================================================*/
 
+#if DMA2D_USE_QUEUE || defined(__DOXYGEN__)
+
+/**
+ * @brief   Returns a job to the pool.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ * @param[in] jobp      pointer to the job
+ *
+ * @notapi
+ */
+static void dma2d_job_release(DMA2DDriver *dma2dp, dma2d_job_t *jobp) {
+
+  chPoolFreeI(&dma2dp->jobpool, jobp);
+  chSemSignalI(&dma2dp->jobsem);
+}
+
+/**
+ * @brief   Programs the transfer of a queued job.
+ * @details All the registers used by the job mode are written at once,
+ *          bypassing the per-field methods.
+ *
+ * @param[in] jobp      pointer to the job
+ *
+ * @notapi
+ */
+static void dma2d_job_load(const dma2d_job_t *jobp) {
+
+  DMA2D->CR = (DMA2D->CR & ~DMA2D_CR_MODE) |
+              ((uint32_t)jobp->mode & DMA2D_CR_MODE);
+  DMA2D->NLR = (((uint32_t)jobp->width  << 16) & DMA2D_NLR_PL) |
+               (((uint32_t)jobp->height <<  0) & DMA2D_NLR_NL);
+
+  if (jobp->mode == DMA2D_JOB_BLEND) {
+    DMA2D->BGMAR = (uint32_t)jobp->bg.bufferp;
+    DMA2D->BGOR = (uint32_t)jobp->bg.wrap_offset & DMA2D_BGOR_LO;
+    DMA2D->BGPFCCR = (DMA2D->BGPFCCR & (DMA2D_BGPFCCR_CS | DMA2D_BGPFCCR_CCM)) |
+                     (((uint32_t)jobp->bg.const_alpha << 24) &
+                      DMA2D_BGPFCCR_ALPHA) |
+                     ((uint32_t)jobp->bg_amode & DMA2D_BGPFCCR_AM) |
+                     ((uint32_t)jobp->bg.fmt & DMA2D_BGPFCCR_CM);
+    DMA2D->BGCOLR = (uint32_t)jobp->bg.def_color & 0x00FFFFFF;
+  }
+
+  if (jobp->mode != DMA2D_JOB_CONST) {
+    DMA2D->FGMAR = (uint32_t)jobp->fg.bufferp;
+    DMA2D->FGOR = (uint32_t)jobp->fg.wrap_offset & DMA2D_FGOR_LO;
+    DMA2D->FGPFCCR = (DMA2D->FGPFCCR & (DMA2D_FGPFCCR_CS | DMA2D_FGPFCCR_CCM)) |
+                     (((uint32_t)jobp->fg.const_alpha << 24) &
+                      DMA2D_FGPFCCR_ALPHA) |
+                     ((uint32_t)jobp->fg_amode & DMA2D_FGPFCCR_AM) |
+                     ((uint32_t)jobp->fg.fmt & DMA2D_FGPFCCR_CM);
+    DMA2D->FGCOLR = (uint32_t)jobp->fg.def_color & 0x00FFFFFF;
+  }
+
+  DMA2D->OMAR = (uint32_t)jobp->out.bufferp;
+  DMA2D->OOR = (uint32_t)jobp->out.wrap_offset & DMA2D_OOR_LO;
+  DMA2D->OPFCCR = (DMA2D->OPFCCR & ~DMA2D_OPFCCR_CM) |
+                  ((uint32_t)jobp->out.fmt & DMA2D_OPFCCR_CM);
+  /* Output format color, alpha included for ARGB-8888 constant fills.*/
+  DMA2D->OCOLR = (uint32_t)jobp->out.def_color;
+}
+
+/**
+ * @brief   Runs the job queue.
+ * @details Advances the running job to its next stage and starts it, a
+ *          completed job is notified and the next queued job is started in
+ *          its place. When the queue is drained the driver goes back to the
+ *          ready state and the waiting thread, if any, is woken up.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ *
+ * @notapi
+ */
+static void dma2d_queue_run(DMA2DDriver *dma2dp) {
+  dma2d_job_t *jobp;
+  const dma2d_palcfg_t *palettep;
+
+  dma2dp->state = DMA2D_ACTIVE;
+  while ((jobp = dma2dp->qhead) != NULL) {
+    switch (jobp->stage) {
+    case DMA2D_JOBSTAGE_BGCLUT:
+      jobp->stage = DMA2D_JOBSTAGE_FGCLUT;
+      palettep = jobp->bg.palettep;
+      if ((jobp->mode == DMA2D_JOB_BLEND) && (palettep != NULL) &&
+          (palettep != dma2dp->bgpalp)) {
+        dma2dp->bgpalp = palettep;
+        DMA2D->BGCMAR = (uint32_t)palettep->colorsp;
+        DMA2D->BGPFCCR = (DMA2D->BGPFCCR &
+                          ~(DMA2D_BGPFCCR_CS | DMA2D_BGPFCCR_CCM)) |
+                         ((((uint32_t)palettep->length - 1) << 8) &
+                          DMA2D_BGPFCCR_CS) |
+                         ((uint32_t)palettep->fmt << 4);
+        DMA2D->BGPFCCR |= DMA2D_BGPFCCR_START;
+        return;
+      }
+      break;
+    case DMA2D_JOBSTAGE_FGCLUT:
+      jobp->stage = DMA2D_JOBSTAGE_TRANSFER;
+      palettep = jobp->fg.palettep;
+      if ((jobp->mode != DMA2D_JOB_CONST) && (palettep != NULL) &&
+          (palettep != dma2dp->fgpalp)) {
+        dma2dp->fgpalp = palettep;
+        DMA2D->FGCMAR = (uint32_t)palettep->colorsp;
+        DMA2D->FGPFCCR = (DMA2D->FGPFCCR &
+                          ~(DMA2D_FGPFCCR_CS | DMA2D_FGPFCCR_CCM)) |
+                         ((((uint32_t)palettep->length - 1) << 8) &
+                          DMA2D_FGPFCCR_CS) |
+                         ((uint32_t)palettep->fmt << 4);
+        DMA2D->FGPFCCR |= DMA2D_FGPFCCR_START;
+        return;
+      }
+      break;
+    case DMA2D_JOBSTAGE_TRANSFER:
+      jobp->stage = DMA2D_JOBSTAGE_DONE;
+      dma2d_job_load(jobp);
+      DMA2D->CR |= DMA2D_CR_START;
+      return;
+    default:
+      /* Job completed, notifying it and chaining into the next one.*/
+      dma2dp->qhead = jobp->next;
+      if (jobp->status != RDY_OK)
+        dma2dp->qstatus = jobp->status;
+      if (jobp->callback != NULL)
+        jobp->callback(dma2dp, jobp);
+#if CH_USE_EVENTS
+      if (jobp->esp != NULL)
+        chEvtBroadcastFlagsI(jobp->esp, jobp->flags);
+#endif /* CH_USE_EVENTS */
+      dma2d_job_release(dma2dp, jobp);
+      break;
+    }
+  }
+
+  /* Queue drained, the palettes cache is no more valid.*/
+  dma2dp->qtail = NULL;
+  dma2dp->bgpalp = NULL;
+  dma2dp->fgpalp = NULL;
+  dma2dp->state = DMA2D_READY;
+  if (dma2dp->qthread != NULL) {
+    Thread *tp = dma2dp->qthread;
+    dma2dp->qthread = NULL;
+    tp->p_u.rdymsg = RDY_OK;
+    chSchReadyI(tp);
+  }
+}
+
+#endif /* DMA2D_USE_QUEUE */
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -119,6 +267,7 @@ CH_IRQ_HANDLER(DMA2D_IRQHandler) {
 
   DMA2DDriver *const dma2dp = &DMA2DD1;
   bool_t job_done = FALSE;
+  bool_t job_failed = FALSE;
 
   CH_IRQ_PROLOGUE();
 
@@ -127,6 +276,7 @@ CH_IRQ_HANDLER(DMA2D_IRQHandler) {
     if (dma2dp->config->cfgerr_isr != NULL)
       dma2dp->config->cfgerr_isr(dma2dp);
     job_done = TRUE;
+    job_failed = TRUE;
     DMA2D->IFCR |= DMA2D_IFSR_CCEIF;
   }
 
@@ -143,6 +293,7 @@ CH_IRQ_HANDLER(DMA2D_IRQHandler) {
     if (dma2dp->config->palacserr_isr != NULL)
       dma2dp->config->palacserr_isr(dma2dp);
     job_done = TRUE;
+    job_failed = TRUE;
     DMA2D->IFCR |= DMA2D_IFSR_CCAEIF;
   }
 
@@ -166,6 +317,7 @@ CH_IRQ_HANDLER(DMA2D_IRQHandler) {
     if (dma2dp->config->trferr_isr != NULL)
       dma2dp->config->trferr_isr(dma2dp);
     job_done = TRUE;
+    job_failed = TRUE;
     DMA2D->IFCR |= DMA2D_IFSR_CTEIF;
   }
 
@@ -185,6 +337,21 @@ CH_IRQ_HANDLER(DMA2D_IRQHandler) {
   #endif /* DMA2D_USE_WAIT */
 
     dma2dp->state = DMA2D_READY;
+
+#if DMA2D_USE_QUEUE
+    /* Chaining into the next stage or job, a failed job is completed.*/
+    if (dma2dp->qhead != NULL) {
+      if (job_failed) {
+        dma2dp->qhead->status = RDY_RESET;
+        dma2dp->qhead->stage = DMA2D_JOBSTAGE_DONE;
+        dma2dp->bgpalp = NULL;
+        dma2dp->fgpalp = NULL;
+      }
+      dma2d_queue_run(dma2dp);
+    }
+#else
+    (void)job_failed;
+#endif /* DMA2D_USE_QUEUE */
     chSysUnlockFromIsr();
   }
 
@@ -241,6 +408,16 @@ void dma2dObjectInit(DMA2DDriver *dma2dp) {
   chSemInit(&dma2dp->lock, 1);
 #endif
 #endif /* DMA2D_USE_MUTUAL_EXCLUSION */
+#if DMA2D_USE_QUEUE
+  chPoolInit(&dma2dp->jobpool, sizeof(dma2d_job_t), NULL);
+  chSemInit(&dma2dp->jobsem, 0);
+  dma2dp->qhead = NULL;
+  dma2dp->qtail = NULL;
+  dma2dp->qthread = NULL;
+  dma2dp->qstatus = RDY_OK;
+  dma2dp->bgpalp = NULL;
+  dma2dp->fgpalp = NULL;
+#endif /* DMA2D_USE_QUEUE */
 }
 
 /**
@@ -288,6 +465,9 @@ dma2d_state_t dma2dGetState(DMA2DDriver *dma2dp) {
  * @api
  */
 void dma2dStart(DMA2DDriver *dma2dp, const DMA2DConfig *configp) {
+#if DMA2D_USE_QUEUE
+  size_t n;
+#endif /* DMA2D_USE_QUEUE */
 
   chSysLock();
 
@@ -298,6 +478,17 @@ void dma2dStart(DMA2DDriver *dma2dp, const DMA2DConfig *configp) {
 
   dma2dp->config = configp;
 
+#if DMA2D_USE_QUEUE
+  /* Loading the jobs pool, if any.*/
+  chPoolInit(&dma2dp->jobpool, sizeof(dma2d_job_t), NULL);
+  n = 0;
+  if (configp->jobsp != NULL) {
+    while (n < configp->jobs)
+      chPoolFreeI(&dma2dp->jobpool, &configp->jobsp[n++]);
+  }
+  chSemResetI(&dma2dp->jobsem, (cnt_t)n);
+#endif /* DMA2D_USE_QUEUE */
+
   /* Turn off the controller and its interrupts.*/
   DMA2D->CR = 0;
 
@@ -331,6 +522,10 @@ void dma2dStop(DMA2DDriver *dma2dp) {
   chDbgAssert(dma2dp->thread == NULL,
               "dma2dStop(), #2", "still waiting");
 #endif /* DMA2D_USE_WAIT */
+#if DMA2D_USE_QUEUE
+  chDbgAssert(dma2dp->qhead == NULL,
+              "dma2dStop(), #3", "jobs queued");
+#endif /* DMA2D_USE_QUEUE */
 
   dma2dp->state = DMA2D_STOP;
   chSysUnlock();
@@ -1199,6 +1394,240 @@ void dma2dJobAbort(DMA2DDriver *dma2dp) {
 
 /** @} */
 
+#if DMA2D_USE_QUEUE || defined(__DOXYGEN__)
+
+/**
+ * @name    DMA2D job queue methods
+ * @{
+ */
+
+/**
+ * @brief   Allocates a job.
+ * @details Takes a job from the pool configured in @p DMA2DConfig, waiting
+ *          for a queued job to complete if the pool is empty.
+ * @pre     In order to use this function the option @p DMA2D_USE_QUEUE must
+ *          be enabled.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ *
+ * @return              pointer to the job
+ *
+ * @sclass
+ */
+dma2d_job_t *dma2dJobAllocS(DMA2DDriver *dma2dp) {
+
+  chDbgCheckClassS();
+  chDbgCheck(dma2dp == &DMA2DD1, "dma2dJobAllocS");
+  chDbgAssert(dma2dp->config->jobsp != NULL,
+              "dma2dJobAllocS(), #1", "no jobs pool");
+
+  chSemWaitS(&dma2dp->jobsem);
+  return (dma2d_job_t *)chPoolAllocI(&dma2dp->jobpool);
+}
+
+/**
+ * @brief   Allocates a job.
+ * @details Takes a job from the pool configured in @p DMA2DConfig, waiting
+ *          for a queued job to complete if the pool is empty.
+ * @pre     In order to use this function the option @p DMA2D_USE_QUEUE must
+ *          be enabled.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ *
+ * @return              pointer to the job
+ *
+ * @api
+ */
+dma2d_job_t *dma2dJobAlloc(DMA2DDriver *dma2dp) {
+
+  dma2d_job_t *jobp;
+  chSysLock();
+  jobp = dma2dJobAllocS(dma2dp);
+  chSysUnlock();
+  return jobp;
+}
+
+/**
+ * @brief   Releases a job.
+ * @details Returns to the pool a job that has not been submitted, submitted
+ *          jobs are released automatically on completion.
+ * @pre     In order to use this function the option @p DMA2D_USE_QUEUE must
+ *          be enabled.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ * @param[in] jobp      pointer to the job
+ *
+ * @iclass
+ */
+void dma2dJobFreeI(DMA2DDriver *dma2dp, dma2d_job_t *jobp) {
+
+  chDbgCheckClassI();
+  chDbgCheck(dma2dp == &DMA2DD1, "dma2dJobFreeI");
+  chDbgCheck(jobp != NULL, "dma2dJobFreeI");
+
+  dma2d_job_release(dma2dp, jobp);
+}
+
+/**
+ * @brief   Releases a job.
+ * @details Returns to the pool a job that has not been submitted, submitted
+ *          jobs are released automatically on completion.
+ * @pre     In order to use this function the option @p DMA2D_USE_QUEUE must
+ *          be enabled.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ * @param[in] jobp      pointer to the job
+ *
+ * @api
+ */
+void dma2dJobFree(DMA2DDriver *dma2dp, dma2d_job_t *jobp) {
+
+  chSysLock();
+  dma2dJobFreeI(dma2dp, jobp);
+  chSchRescheduleS();
+  chSysUnlock();
+}
+
+/**
+ * @brief   Submits a job.
+ * @details Appends the job to the queue, the job is started immediately if
+ *          the queue is empty. Once started, the queued jobs are chained by
+ *          the interrupt handler without any thread intervention.
+ * @note    The job is owned by the driver until its completion, it must not
+ *          be modified after submission.
+ * @pre     In order to use this function the option @p DMA2D_USE_QUEUE must
+ *          be enabled.
+ * @pre     DMA2D is ready or already running queued jobs.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ * @param[in] jobp      pointer to the job
+ *
+ * @iclass
+ */
+void dma2dJobSubmitI(DMA2DDriver *dma2dp, dma2d_job_t *jobp) {
+
+  chDbgCheckClassI();
+  chDbgCheck(dma2dp == &DMA2DD1, "dma2dJobSubmitI");
+  chDbgCheck(jobp != NULL, "dma2dJobSubmitI");
+  chDbgAssert((dma2dp->state == DMA2D_READY) ||
+              ((dma2dp->state == DMA2D_ACTIVE) && (dma2dp->qhead != NULL)),
+              "dma2dJobSubmitI(), #1", "not ready");
+  chDbgAssert((jobp->mode & ~DMA2D_CR_MODE) == 0,
+              "dma2dJobSubmitI(), #2", "invalid mode");
+  chDbgAssert(jobp->width <= DMA2D_MAX_WIDTH,
+              "dma2dJobSubmitI(), #3", "outside range");
+  chDbgAssert(jobp->out.fmt <= DMA2D_MAX_OUTPIXFMT_ID,
+              "dma2dJobSubmitI(), #4", "outside range");
+  chDbgAssert(jobp->out.wrap_offset <= DMA2D_MAX_OFFSET,
+              "dma2dJobSubmitI(), #5", "outside range");
+  chDbgCheck(dma2dIsAligned(jobp->out.bufferp, jobp->out.fmt),
+             "dma2dJobSubmitI");
+  chDbgAssert((jobp->mode == DMA2D_JOB_CONST) ||
+              ((jobp->fg.fmt <= DMA2D_MAX_PIXFMT_ID) &&
+               (jobp->fg.wrap_offset <= DMA2D_MAX_OFFSET)),
+              "dma2dJobSubmitI(), #6", "outside range");
+  chDbgAssert((jobp->mode != DMA2D_JOB_BLEND) ||
+              ((jobp->bg.fmt <= DMA2D_MAX_PIXFMT_ID) &&
+               (jobp->bg.wrap_offset <= DMA2D_MAX_OFFSET)),
+              "dma2dJobSubmitI(), #7", "outside range");
+
+  jobp->next = NULL;
+  jobp->status = RDY_OK;
+  jobp->stage = DMA2D_JOBSTAGE_BGCLUT;
+  if (dma2dp->qhead == NULL) {
+    dma2dp->qhead = jobp;
+    dma2dp->qtail = jobp;
+    dma2d_queue_run(dma2dp);
+  }
+  else {
+    dma2dp->qtail->next = jobp;
+    dma2dp->qtail = jobp;
+  }
+}
+
+/**
+ * @brief   Submits a job.
+ * @details Appends the job to the queue, the job is started immediately if
+ *          the queue is empty. Once started, the queued jobs are chained by
+ *          the interrupt handler without any thread intervention.
+ * @note    The job is owned by the driver until its completion, it must not
+ *          be modified after submission.
+ * @pre     In order to use this function the option @p DMA2D_USE_QUEUE must
+ *          be enabled.
+ * @pre     DMA2D is ready or already running queued jobs.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ * @param[in] jobp      pointer to the job
+ *
+ * @api
+ */
+void dma2dJobSubmit(DMA2DDriver *dma2dp, dma2d_job_t *jobp) {
+
+  chSysLock();
+  dma2dJobSubmitI(dma2dp, jobp);
+  chSysUnlock();
+}
+
+/**
+ * @brief   Waits for the job queue to be drained.
+ * @details The invoking thread is woken up once, after the last queued job
+ *          has been completed.
+ * @pre     In order to use this function the option @p DMA2D_USE_QUEUE must
+ *          be enabled.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ *
+ * @return              The jobs outcome since the previous wait.
+ * @retval RDY_OK       if all the jobs completed successfully.
+ * @retval RDY_RESET    if at least one job failed.
+ *
+ * @sclass
+ */
+msg_t dma2dQueueWaitS(DMA2DDriver *dma2dp) {
+  msg_t msg;
+
+  chDbgCheckClassS();
+  chDbgCheck(dma2dp == &DMA2DD1, "dma2dQueueWaitS");
+  chDbgAssert(dma2dp->qthread == NULL,
+              "dma2dQueueWaitS(), #1", "already waiting");
+
+  if (dma2dp->qhead != NULL) {
+    dma2dp->qthread = chThdSelf();
+    chSchGoSleepS(THD_STATE_SUSPENDED);
+  }
+  msg = dma2dp->qstatus;
+  dma2dp->qstatus = RDY_OK;
+  return msg;
+}
+
+/**
+ * @brief   Waits for the job queue to be drained.
+ * @details The invoking thread is woken up once, after the last queued job
+ *          has been completed.
+ * @pre     In order to use this function the option @p DMA2D_USE_QUEUE must
+ *          be enabled.
+ *
+ * @param[in] dma2dp    pointer to the @p DMA2DDriver object
+ *
+ * @return              The jobs outcome since the previous wait.
+ * @retval RDY_OK       if all the jobs completed successfully.
+ * @retval RDY_RESET    if at least one job failed.
+ *
+ * @api
+ */
+msg_t dma2dQueueWait(DMA2DDriver *dma2dp) {
+
+  msg_t msg;
+  chSysLock();
+  msg = dma2dQueueWaitS(dma2dp);
+  chSysUnlock();
+  return msg;
+}
+
+/** @} */
+
+#endif /* DMA2D_USE_QUEUE */
+
 /**
  * @name    DMA2D background layer methods
  * @{
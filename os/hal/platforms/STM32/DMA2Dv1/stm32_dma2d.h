@@ -119,6 +119,16 @@
 #define DMA2D_ALPHA_MODULATE    0x00020000  /**< Modulate with constant.*/
 /** @} */
 
+/**
+ * @name    DMA2D queued job stages
+ * @{
+ */
+#define DMA2D_JOBSTAGE_BGCLUT   0           /**< Background palette load.*/
+#define DMA2D_JOBSTAGE_FGCLUT   1           /**< Foreground palette load.*/
+#define DMA2D_JOBSTAGE_TRANSFER 2           /**< Pixel transfer.*/
+#define DMA2D_JOBSTAGE_DONE     3           /**< Job completed.*/
+/** @} */
+
 /**
  * @name    DMA2D parameter bounds
  * @{
@@ -223,6 +233,16 @@
 #define DMA2D_USE_MUTUAL_EXCLUSION          TRUE
 #endif
 
+/**
+ * @brief   Enables the asynchronous job queue APIs.
+ * @details Queued jobs are chained by the interrupt handler, the submitting
+ *          thread is only woken when the whole queue has been drained.
+ * @note    Disabling this option saves both code and data space.
+ */
+#if !defined(DMA2D_USE_QUEUE) || defined(__DOXYGEN__)
+#define DMA2D_USE_QUEUE                     TRUE
+#endif
+
 /**
  * @brief   Provides software color conversion functions.
  * @note    Disabling this option saves both code and data space.
@@ -262,6 +282,10 @@
 #error "DMA2D_USE_MUTUAL_EXCLUSION requires CH_USE_MUTEXES and/or CH_USE_SEMAPHORES"
 #endif
 
+#if DMA2D_USE_QUEUE && (!CH_USE_MEMPOOLS || !CH_USE_SEMAPHORES)
+#error "DMA2D_USE_QUEUE requires CH_USE_MEMPOOLS and CH_USE_SEMAPHORES"
+#endif
+
 /*===========================================================================*/
 /* Driver data structures and types.                                         */
 /*===========================================================================*/
@@ -270,6 +294,7 @@
 typedef union dma2d_coloralias_t dma2d_coloralias_t;
 typedef struct dma2d_palcfg_t dma2d_palcfg_t;
 typedef struct dma2d_laycfg_t dma2d_layercfg_t;
+typedef struct dma2d_job_t dma2d_job_t;
 typedef struct DMA2DConfig DMA2DConfig;
 typedef enum dma2d_state_t dma2d_state_t;
 typedef struct DMA2DDriver DMA2DDriver;
@@ -408,6 +433,46 @@ typedef struct dma2d_layercfg_t {
   const dma2d_palcfg_t  *palettep;      /**< Palette specs, or @p NULL.*/
 } dma2d_laycfg_t;
 
+#if DMA2D_USE_QUEUE || defined(__DOXYGEN__)
+/**
+ * @brief   DMA2D queued job callback.
+ * @note    Invoked from the interrupt handler, the job is returned to the
+ *          pool as soon as the callback returns.
+ */
+typedef void (*dma2d_jobcb_t)(DMA2DDriver *dma2dp, dma2d_job_t *jobp);
+
+/**
+ * @brief   DMA2D queued job.
+ * @details Fully describes a transfer, including the palettes to be loaded
+ *          before it. Only the layers used by the job mode are considered,
+ *          the background layer is used by blend jobs only and the foreground
+ *          layer is ignored by constant color jobs.
+ * @note    A palette is not reloaded if the previous queued job already loaded
+ *          the same palette on the same layer, its contents must not change
+ *          while the queue is running.
+ */
+typedef struct dma2d_job_t {
+  dma2d_job_t           *next;          /**< Next queued job.*/
+  dma2d_jobmode_t       mode;           /**< Job mode.*/
+  uint16_t              width;          /**< Area width, in pixels.*/
+  uint16_t              height;         /**< Area height, in pixels.*/
+  dma2d_laycfg_t        bg;             /**< Background layer.*/
+  dma2d_amode_t         bg_amode;       /**< Background alpha mode.*/
+  dma2d_laycfg_t        fg;             /**< Foreground layer.*/
+  dma2d_amode_t         fg_amode;       /**< Foreground alpha mode.*/
+  dma2d_laycfg_t        out;            /**< Output layer.*/
+  dma2d_jobcb_t         callback;       /**< Completion callback, or @p NULL.*/
+  void                  *arg;           /**< Callback argument.*/
+#if CH_USE_EVENTS || defined(__DOXYGEN__)
+  EventSource           *esp;           /**< Completion event, or @p NULL.*/
+  flagsmask_t           flags;          /**< Flags broadcast on completion.*/
+#endif /* CH_USE_EVENTS */
+  msg_t                 status;         /**< @p RDY_OK, or @p RDY_RESET if
+                                             the job failed.*/
+  uint8_t               stage;          /**< Current job stage.*/
+} dma2d_job_t;
+#endif /* DMA2D_USE_QUEUE */
+
 /**
  * @brief   DMA2D driver configuration.
  */
@@ -419,6 +484,11 @@ typedef struct DMA2DConfig {
   dma2d_isrcb_t     trfwmark_isr;   /**< Transfer watermark, or @p NULL.*/
   dma2d_isrcb_t     trfdone_isr;    /**< Transfer complete, or @p NULL.*/
   dma2d_isrcb_t     trferr_isr;     /**< Transfer error, or @p NULL.*/
+#if DMA2D_USE_QUEUE || defined(__DOXYGEN__)
+  /* Job queue.*/
+  dma2d_job_t       *jobsp;         /**< Job pool storage, or @p NULL.*/
+  size_t            jobs;           /**< Number of jobs in the pool.*/
+#endif /* DMA2D_USE_QUEUE */
 } DMA2DConfig;
 
 /**
@@ -450,6 +520,17 @@ typedef struct DMA2DDriver {
   Semaphore         lock;           /**< Multithreading lock.*/
 #endif
 #endif /* DMA2D_USE_MUTUAL_EXCLUSION */
+#if DMA2D_USE_QUEUE || defined(__DOXYGEN__)
+  /* Job queue.*/
+  MemoryPool        jobpool;        /**< Free jobs pool.*/
+  Semaphore         jobsem;         /**< Free jobs counter.*/
+  dma2d_job_t       *qhead;         /**< Running job, or @p NULL.*/
+  dma2d_job_t       *qtail;         /**< Last queued job.*/
+  Thread            *qthread;       /**< Thread waiting for the queue.*/
+  msg_t             qstatus;        /**< Queue outcome since last wait.*/
+  const dma2d_palcfg_t *bgpalp;     /**< Loaded background palette.*/
+  const dma2d_palcfg_t *fgpalp;     /**< Loaded foreground palette.*/
+#endif /* DMA2D_USE_QUEUE */
 } DMA2DDriver;
 
 /** @} */
@@ -578,6 +659,18 @@ extern "C" {
   void dma2dJobAbortI(DMA2DDriver *dma2dp);
   void dma2dJobAbort(DMA2DDriver *dma2dp);
 
+#if DMA2D_USE_QUEUE
+  /* Job queue methods.*/
+  dma2d_job_t *dma2dJobAllocS(DMA2DDriver *dma2dp);
+  dma2d_job_t *dma2dJobAlloc(DMA2DDriver *dma2dp);
+  void dma2dJobFreeI(DMA2DDriver *dma2dp, dma2d_job_t *jobp);
+  void dma2dJobFree(DMA2DDriver *dma2dp, dma2d_job_t *jobp);
+  void dma2dJobSubmitI(DMA2DDriver *dma2dp, dma2d_job_t *jobp);
+  void dma2dJobSubmit(DMA2DDriver *dma2dp, dma2d_job_t *jobp);
+  msg_t dma2dQueueWaitS(DMA2DDriver *dma2dp);
+  msg_t dma2dQueueWait(DMA2DDriver *dma2dp);
+#endif /* DMA2D_USE_QUEUE */
+
   /* Background layer methods.*/
   void *dma2dBgGetAddressI(DMA2DDriver *dma2dp);
   void *dma2dBgGetAddress(DMA2DDriver *dma2dp);
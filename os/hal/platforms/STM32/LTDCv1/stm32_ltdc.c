@@ -160,6 +160,148 @@ static void ltdc_force_reload_s(LTDCDriver *ltdcp) {
     chSchDoYieldS();
 }
 
+#if LTDC_USE_SWAPCHAIN || defined(__DOXYGEN__)
+
+/**
+ * @brief   Sets the swap chain layer frame address.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ * @param[in] index     swap chain buffer index
+ *
+ * @iclass
+ * @notapi
+ */
+static void ltdc_swap_set_address_i(LTDCDriver *ltdcp, int8_t index) {
+
+  uint32_t address = (uint32_t)ltdcp->swapcfg->buffers[index];
+
+  if (ltdcp->swapcfg->layer == LTDC_L1)
+    LTDC_Layer1->CFBAR = address;
+  else
+    LTDC_Layer2->CFBAR = address;
+}
+
+/**
+ * @brief   Flips a swap chain buffer onto the screen upon next vsync.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ * @param[in] index     swap chain buffer index
+ *
+ * @iclass
+ * @notapi
+ */
+static void ltdc_swap_flip_i(LTDCDriver *ltdcp, int8_t index) {
+
+  ltdc_swap_set_address_i(ltdcp, index);
+  ltdcp->pending = index;
+  ltdcStartReloadI(ltdcp, FALSE);
+}
+
+/**
+ * @brief   Finds a swap chain buffer not in use.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @return              swap chain buffer index, or @p -1 if none is free
+ *
+ * @iclass
+ * @notapi
+ */
+static int8_t ltdc_swap_find_free_i(LTDCDriver *ltdcp) {
+
+  int8_t i;
+
+  for (i = 0; i < (int8_t)ltdcp->swapcfg->count; ++i) {
+    if ((i != ltdcp->front) && (i != ltdcp->pending) &&
+        (i != ltdcp->queued) && (i != ltdcp->back))
+      return i;
+  }
+  return -1;
+}
+
+/**
+ * @brief   Pending flip can be retargeted.
+ * @details Tells whether the pending flip is still at least one scanline away
+ *          from being latched, so that its frame address can be replaced.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @return              retargetable
+ *
+ * @iclass
+ * @notapi
+ */
+static bool_t ltdc_swap_can_retarget_i(LTDCDriver *ltdcp) {
+
+  uint16_t x, y;
+
+  if (ltdcp->pending < 0)
+    return FALSE;
+
+  /* The position is sampled before the reload flag, the shadow registers
+     are latched at the end of the active area.*/
+  ltdcGetCurrentPosI(ltdcp, &x, &y);
+  return (y < ltdcp->active_window.vstop) &&
+         ((LTDC->SRCR & LTDC_SRCR_VBR) != 0);
+}
+
+/**
+ * @brief   Wakes up the thread waiting on the swap chain, if any.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @iclass
+ * @notapi
+ */
+static void ltdc_swap_wakeup_i(LTDCDriver *ltdcp) {
+
+  if (ltdcp->swapthread != NULL) {
+    Thread *tp = ltdcp->swapthread;
+    ltdcp->swapthread = NULL;
+    tp->p_u.rdymsg = RDY_OK;
+    chSchReadyI(tp);
+  }
+}
+
+/**
+ * @brief   Swap chain vsync handler.
+ * @details Completes the pending flip, accounting for its frame time, then
+ *          requests the flip of the queued buffer, if any.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @iclass
+ * @notapi
+ */
+static void ltdc_swap_vsync_i(LTDCDriver *ltdcp) {
+
+  if (ltdcp->pending >= 0) {
+    halrtcnt_t now = halGetCounterValue();
+
+    /* The first flip after a reset has no previous one to compare with.*/
+    if (ltdcp->swapstats.flipped > 0) {
+      halrtcnt_t bin = (now - ltdcp->lastflip) / ltdcp->binticks;
+      if (bin >= LTDC_SWAP_HISTOGRAM_BINS)
+        bin = LTDC_SWAP_HISTOGRAM_BINS - 1;
+      ++ltdcp->swapstats.histogram[bin];
+    }
+    ltdcp->lastflip = now;
+    ++ltdcp->swapstats.flipped;
+
+    ltdcp->front = ltdcp->pending;
+    ltdcp->pending = -1;
+  }
+
+  if (ltdcp->queued >= 0) {
+    ltdc_swap_flip_i(ltdcp, ltdcp->queued);
+    ltdcp->queued = -1;
+  }
+
+  ltdc_swap_wakeup_i(ltdcp);
+}
+
+#endif /* LTDC_USE_SWAPCHAIN */
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -206,6 +348,10 @@ CH_IRQ_HANDLER(LTDC_EV_IRQHandler) {
     }
 #endif /* LTDC_USE_WAIT */
     ltdcp->state = LTDC_READY;
+#if LTDC_USE_SWAPCHAIN
+    if (ltdcp->swapcfg != NULL)
+      ltdc_swap_vsync_i(ltdcp);
+#endif /* LTDC_USE_SWAPCHAIN */
     chSysUnlockFromIsr();
 
     LTDC->ICR |= LTDC_ICR_CRRIF;
@@ -296,6 +442,10 @@ void ltdcObjectInit(LTDCDriver *ltdcp) {
   chSemInit(&ltdcp->lock, 1);
 #endif
 #endif /* LTDC_USE_MUTUAL_EXCLUSION */
+#if LTDC_USE_SWAPCHAIN
+  ltdcp->swapcfg = NULL;
+  ltdcp->swapthread = NULL;
+#endif /* LTDC_USE_SWAPCHAIN */
 }
 
 /**
@@ -1204,6 +1354,292 @@ void ltdcGetCurrentPos(LTDCDriver *ltdcp, uint16_t *xp, uint16_t *yp) {
 
 /** @} */
 
+#if LTDC_USE_SWAPCHAIN || defined(__DOXYGEN__)
+
+/**
+ * @name    LTDC swap chain methods
+ * @{
+ */
+
+/**
+ * @brief   Starts a swap chain.
+ * @details The first buffer is flipped onto the layer upon next vsync. The
+ *          layer must already be configured with the frame specifications
+ *          shared by all the buffers.
+ * @pre     In order to use this function the option @p LTDC_USE_SWAPCHAIN
+ *          must be enabled.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ * @param[in] cfgp      pointer to the swap chain specifications
+ *
+ * @api
+ */
+void ltdcSwapStart(LTDCDriver *ltdcp, const ltdc_swapcfg_t *cfgp) {
+
+  chDbgCheck(ltdcp == &LTDCD1, "ltdcSwapStart");
+  chDbgCheck(cfgp != NULL, "ltdcSwapStart");
+  chDbgCheck(cfgp->buffers != NULL, "ltdcSwapStart");
+  chDbgCheck(cfgp->layer == LTDC_L1 || cfgp->layer == LTDC_L2,
+             "ltdcSwapStart");
+  chDbgAssert(cfgp->count >= LTDC_MIN_SWAP_BUFFERS,
+              "ltdcSwapStart(), #1", "outside range");
+  chDbgAssert(cfgp->count <= LTDC_MAX_SWAP_BUFFERS,
+              "ltdcSwapStart(), #2", "outside range");
+  chDbgAssert(cfgp->mode == LTDC_SWAP_FIFO ||
+              cfgp->count == LTDC_MAX_SWAP_BUFFERS,
+              "ltdcSwapStart(), #3", "mailbox requires triple buffering");
+
+  chSysLock();
+  chDbgAssert(ltdcp->state == LTDC_READY,
+              "ltdcSwapStart(), #4", "not ready");
+  chDbgAssert(ltdcp->swapcfg == NULL,
+              "ltdcSwapStart(), #5", "already started");
+
+  ltdcp->swapcfg = cfgp;
+  ltdcp->front = -1;
+  ltdcp->pending = -1;
+  ltdcp->queued = -1;
+  ltdcp->back = -1;
+  ltdcp->swapthread = NULL;
+  ltdcp->binticks = US2RTT(LTDC_SWAP_HISTOGRAM_STEP);
+  ltdcSwapResetStatsI(ltdcp);
+
+  ltdc_swap_flip_i(ltdcp, 0);
+  chSysUnlock();
+}
+
+/**
+ * @brief   Stops the swap chain.
+ * @details Waits until the presented buffers have been flipped, the last one
+ *          is left on the screen.
+ * @pre     No buffer must be acquired.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @api
+ */
+void ltdcSwapStop(LTDCDriver *ltdcp) {
+
+  chDbgCheck(ltdcp == &LTDCD1, "ltdcSwapStop");
+
+  chSysLock();
+  chDbgAssert(ltdcp->swapcfg != NULL,
+              "ltdcSwapStop(), #1", "not started");
+  chDbgAssert(ltdcp->back < 0,
+              "ltdcSwapStop(), #2", "buffer still acquired");
+  chDbgAssert(ltdcp->swapthread == NULL,
+              "ltdcSwapStop(), #3", "already waiting");
+
+  while ((ltdcp->pending >= 0) || (ltdcp->queued >= 0)) {
+    ltdcp->swapthread = chThdSelf();
+    chSchGoSleepS(THD_STATE_SUSPENDED);
+  }
+  ltdcp->swapcfg = NULL;
+  chSysUnlock();
+}
+
+/**
+ * @brief   Acquires the back buffer.
+ * @details Returns a buffer which is neither shown nor waiting to be shown.
+ *          In FIFO mode the invoking thread sleeps until a flip releases one.
+ *          In mailbox mode the queued buffer is taken back instead, so this
+ *          function never blocks.
+ * @pre     The previously acquired buffer must have been presented.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @return              back buffer address
+ *
+ * @sclass
+ */
+void *ltdcSwapAcquireS(LTDCDriver *ltdcp) {
+
+  int8_t index;
+
+  chDbgCheckClassS();
+  chDbgCheck(ltdcp == &LTDCD1, "ltdcSwapAcquireS");
+  chDbgAssert(ltdcp->swapcfg != NULL,
+              "ltdcSwapAcquireS(), #1", "not started");
+  chDbgAssert(ltdcp->back < 0,
+              "ltdcSwapAcquireS(), #2", "already acquired");
+
+  while ((index = ltdc_swap_find_free_i(ltdcp)) < 0) {
+    if ((ltdcp->swapcfg->mode == LTDC_SWAP_MAILBOX) && (ltdcp->queued >= 0)) {
+      /* The queued frame is superseded by the one about to be rendered.*/
+      index = ltdcp->queued;
+      ltdcp->queued = -1;
+      ++ltdcp->swapstats.dropped;
+      break;
+    }
+    chDbgAssert(ltdcp->swapthread == NULL,
+                "ltdcSwapAcquireS(), #3", "already waiting");
+    ltdcp->swapthread = chThdSelf();
+    chSchGoSleepS(THD_STATE_SUSPENDED);
+  }
+
+  ltdcp->back = index;
+  return ltdcp->swapcfg->buffers[index];
+}
+
+/**
+ * @brief   Acquires the back buffer.
+ * @details Returns a buffer which is neither shown nor waiting to be shown.
+ *          In FIFO mode the invoking thread sleeps until a flip releases one.
+ *          In mailbox mode the queued buffer is taken back instead, so this
+ *          function never blocks.
+ * @pre     The previously acquired buffer must have been presented.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @return              back buffer address
+ *
+ * @api
+ */
+void *ltdcSwapAcquire(LTDCDriver *ltdcp) {
+
+  void *bufferp;
+  chSysLock();
+  bufferp = ltdcSwapAcquireS(ltdcp);
+  chSysUnlock();
+  return bufferp;
+}
+
+/**
+ * @brief   Presents the back buffer.
+ * @details Queues the back buffer for a flip upon vsync, the flip itself is
+ *          performed by the register reload interrupt. In mailbox mode a
+ *          flip which has not been latched yet is retargeted to the new
+ *          buffer, so that the newest frame is always the next one shown.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @iclass
+ */
+void ltdcSwapPresentI(LTDCDriver *ltdcp) {
+
+  int8_t index;
+
+  chDbgCheckClassI();
+  chDbgCheck(ltdcp == &LTDCD1, "ltdcSwapPresentI");
+  chDbgAssert(ltdcp->swapcfg != NULL,
+              "ltdcSwapPresentI(), #1", "not started");
+  chDbgAssert(ltdcp->back >= 0,
+              "ltdcSwapPresentI(), #2", "not acquired");
+
+  index = ltdcp->back;
+  ltdcp->back = -1;
+  ++ltdcp->swapstats.presented;
+
+  if ((ltdcp->pending < 0) && (ltdcp->state == LTDC_READY)) {
+    ltdc_swap_flip_i(ltdcp, index);
+  }
+  else if ((ltdcp->swapcfg->mode == LTDC_SWAP_MAILBOX) &&
+           ltdc_swap_can_retarget_i(ltdcp)) {
+    ltdc_swap_set_address_i(ltdcp, index);
+    ltdcp->pending = index;
+    ++ltdcp->swapstats.dropped;
+  }
+  else {
+    if (ltdcp->queued >= 0) {
+      chDbgAssert(ltdcp->swapcfg->mode == LTDC_SWAP_MAILBOX,
+                  "ltdcSwapPresentI(), #3", "queue overflow");
+      ++ltdcp->swapstats.dropped;
+    }
+    ltdcp->queued = index;
+  }
+}
+
+/**
+ * @brief   Presents the back buffer.
+ * @details Queues the back buffer for a flip upon vsync, the flip itself is
+ *          performed by the register reload interrupt. In mailbox mode a
+ *          flip which has not been latched yet is retargeted to the new
+ *          buffer, so that the newest frame is always the next one shown.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @api
+ */
+void ltdcSwapPresent(LTDCDriver *ltdcp) {
+
+  chSysLock();
+  ltdcSwapPresentI(ltdcp);
+  chSysUnlock();
+}
+
+/**
+ * @brief   Get swap chain statistics.
+ * @details Copies the frame counters and the frame time histogram.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ * @param[out] statsp   pointer to the statistics
+ *
+ * @iclass
+ */
+void ltdcSwapGetStatsI(LTDCDriver *ltdcp, ltdc_swapstats_t *statsp) {
+
+  chDbgCheckClassI();
+  chDbgCheck(ltdcp == &LTDCD1, "ltdcSwapGetStatsI");
+  chDbgCheck(statsp != NULL, "ltdcSwapGetStatsI");
+
+  *statsp = ltdcp->swapstats;
+}
+
+/**
+ * @brief   Get swap chain statistics.
+ * @details Copies the frame counters and the frame time histogram.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ * @param[out] statsp   pointer to the statistics
+ *
+ * @api
+ */
+void ltdcSwapGetStats(LTDCDriver *ltdcp, ltdc_swapstats_t *statsp) {
+
+  chSysLock();
+  ltdcSwapGetStatsI(ltdcp, statsp);
+  chSysUnlock();
+}
+
+/**
+ * @brief   Reset swap chain statistics.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @iclass
+ */
+void ltdcSwapResetStatsI(LTDCDriver *ltdcp) {
+
+  unsigned i;
+
+  chDbgCheckClassI();
+  chDbgCheck(ltdcp == &LTDCD1, "ltdcSwapResetStatsI");
+
+  ltdcp->swapstats.presented = 0;
+  ltdcp->swapstats.flipped = 0;
+  ltdcp->swapstats.dropped = 0;
+  for (i = 0; i < LTDC_SWAP_HISTOGRAM_BINS; ++i)
+    ltdcp->swapstats.histogram[i] = 0;
+}
+
+/**
+ * @brief   Reset swap chain statistics.
+ *
+ * @param[in] ltdcp     pointer to the @p LTDCDriver object
+ *
+ * @api
+ */
+void ltdcSwapResetStats(LTDCDriver *ltdcp) {
+
+  chSysLock();
+  ltdcSwapResetStatsI(ltdcp);
+  chSysUnlock();
+}
+
+/** @} */
+
+#endif /* LTDC_USE_SWAPCHAIN */
+
 /**
  * @name    LTDC background layer (layer 1) methods
  * @{
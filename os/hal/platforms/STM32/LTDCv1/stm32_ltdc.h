@@ -66,6 +66,23 @@
   (LTDC_LEF_ENABLE | LTDC_LEF_KEYING | LTDC_LEF_PALETTE)
 /** @} */
 
+/**
+ * @name    LTDC layer identifiers
+ * @{
+ */
+#define LTDC_L1                 0           /**< Background, layer 1.*/
+#define LTDC_L2                 1           /**< Foreground, layer 2.*/
+/** @} */
+
+/**
+ * @name    LTDC swap chain modes
+ * @{
+ */
+#define LTDC_SWAP_FIFO          0           /**< Every frame is shown.*/
+#define LTDC_SWAP_MAILBOX       1           /**< Newest frame replaces the
+                                                 queued one.*/
+/** @} */
+
 /**
  * @name    LTDC pixel formats
  * @{
@@ -174,6 +191,9 @@
 
 #define LTDC_MAX_PALETTE_LENGTH         256
 
+#define LTDC_MIN_SWAP_BUFFERS           2
+#define LTDC_MAX_SWAP_BUFFERS           3
+
 /** @} */
 
 /**
@@ -276,6 +296,31 @@
 #define LTDC_USE_MUTUAL_EXCLUSION           TRUE
 #endif
 
+/**
+ * @brief   Enables the swap chain APIs.
+ * @details Frame buffers are flipped by the register reload interrupt upon
+ *          vertical blanking, the presenting thread never waits for it.
+ * @note    Disabling this option saves both code and data space.
+ */
+#if !defined(LTDC_USE_SWAPCHAIN) || defined(__DOXYGEN__)
+#define LTDC_USE_SWAPCHAIN                  TRUE
+#endif
+
+/**
+ * @brief   Number of bins of the swap chain frame time histogram.
+ * @note    The last bin collects all the longer frame times.
+ */
+#if !defined(LTDC_SWAP_HISTOGRAM_BINS) || defined(__DOXYGEN__)
+#define LTDC_SWAP_HISTOGRAM_BINS            16
+#endif
+
+/**
+ * @brief   Width of a swap chain frame time histogram bin, in microseconds.
+ */
+#if !defined(LTDC_SWAP_HISTOGRAM_STEP) || defined(__DOXYGEN__)
+#define LTDC_SWAP_HISTOGRAM_STEP            2500
+#endif
+
 /**
  * @brief   Provides software color conversion functions.
  * @note    Disabling this option saves both code and data space.
@@ -315,6 +360,14 @@
 #error "LTDC_USE_MUTUAL_EXCLUSION requires CH_USE_MUTEXES and/or CH_USE_SEMAPHORES"
 #endif
 
+#if LTDC_USE_SWAPCHAIN && !HAL_IMPLEMENTS_COUNTERS
+#error "LTDC_USE_SWAPCHAIN requires HAL_IMPLEMENTS_COUNTERS"
+#endif
+
+#if LTDC_USE_SWAPCHAIN && (LTDC_SWAP_HISTOGRAM_BINS < 1)
+#error "LTDC_SWAP_HISTOGRAM_BINS must be at least 1"
+#endif
+
 /*===========================================================================*/
 /* Driver data structures and types.                                         */
 /*===========================================================================*/
@@ -324,6 +377,8 @@ typedef union ltdc_coloralias_t ltdc_coloralias_t;
 typedef struct ltdc_window_t ltdc_window_t;
 typedef struct ltdc_frame_t ltdc_frame_t;
 typedef struct ltdc_laycfg_t ltdc_laycfg_t;
+typedef struct ltdc_swapcfg_t ltdc_swapcfg_t;
+typedef struct ltdc_swapstats_t ltdc_swapstats_t;
 typedef struct LTDCConfig LTDCConfig;
 typedef enum ltdc_state_t ltdc_state_t;
 typedef struct LTDCDriver LTDCDriver;
@@ -467,6 +522,33 @@ typedef struct ltdc_laycfg_t {
   ltdc_flags_t        flags;        /**< Layer configuration flags.*/
 } ltdc_laycfg_t;
 
+#if LTDC_USE_SWAPCHAIN || defined(__DOXYGEN__)
+/**
+ * @brief   LTDC swap chain specifications.
+ * @details The frame buffers share the frame specifications of the layer,
+ *          only their addresses are swapped.
+ * @note    The mailbox mode requires three buffers.
+ */
+typedef struct ltdc_swapcfg_t {
+  void *const         *buffers;     /**< Frame buffer addresses.*/
+  uint8_t             count;        /**< Number of frame buffers.*/
+  ltdc_layerid_t      layer;        /**< Presenting layer.*/
+  uint8_t             mode;         /**< Swap mode.*/
+} ltdc_swapcfg_t;
+
+/**
+ * @brief   LTDC swap chain statistics.
+ */
+typedef struct ltdc_swapstats_t {
+  uint32_t      presented;          /**< Frames presented.*/
+  uint32_t      flipped;            /**< Frames shown on the screen.*/
+  uint32_t      dropped;            /**< Frames replaced before being shown.*/
+  uint32_t      histogram[LTDC_SWAP_HISTOGRAM_BINS];
+                                    /**< Time between flips, in steps of
+                                         @p LTDC_SWAP_HISTOGRAM_STEP.*/
+} ltdc_swapstats_t;
+#endif /* LTDC_USE_SWAPCHAIN */
+
 /**
  * @brief   LTDC driver configuration.
  */
@@ -525,6 +607,18 @@ typedef struct LTDCDriver {
   Semaphore         lock;           /**< Multithreading lock.*/
 #endif
 #endif /* LTDC_USE_MUTUAL_EXCLUSION */
+#if LTDC_USE_SWAPCHAIN || defined(__DOXYGEN__)
+  /* Swap chain.*/
+  const ltdc_swapcfg_t *swapcfg;    /**< Running swap chain, or @p NULL.*/
+  int8_t            front;          /**< Shown buffer.*/
+  int8_t            pending;        /**< Buffer flipped at next vsync.*/
+  int8_t            queued;         /**< Buffer waiting for a flip.*/
+  int8_t            back;           /**< Buffer being rendered.*/
+  Thread            *swapthread;    /**< Thread waiting for a buffer.*/
+  halrtcnt_t        lastflip;       /**< Counter value of the last flip.*/
+  halrtcnt_t        binticks;       /**< Counter ticks per histogram bin.*/
+  ltdc_swapstats_t  swapstats;      /**< Swap chain statistics.*/
+#endif /* LTDC_USE_SWAPCHAIN */
 } LTDCDriver;
 
 /** @} */
@@ -622,6 +716,20 @@ extern "C" {
   void ltdcGetCurrentPosI(LTDCDriver *ltdcp, uint16_t *xp, uint16_t *yp);
   void ltdcGetCurrentPos(LTDCDriver *ltdcp, uint16_t *xp, uint16_t *yp);
 
+#if LTDC_USE_SWAPCHAIN
+  /* Swap chain methods.*/
+  void ltdcSwapStart(LTDCDriver *ltdcp, const ltdc_swapcfg_t *cfgp);
+  void ltdcSwapStop(LTDCDriver *ltdcp);
+  void *ltdcSwapAcquireS(LTDCDriver *ltdcp);
+  void *ltdcSwapAcquire(LTDCDriver *ltdcp);
+  void ltdcSwapPresentI(LTDCDriver *ltdcp);
+  void ltdcSwapPresent(LTDCDriver *ltdcp);
+  void ltdcSwapGetStatsI(LTDCDriver *ltdcp, ltdc_swapstats_t *statsp);
+  void ltdcSwapGetStats(LTDCDriver *ltdcp, ltdc_swapstats_t *statsp);
+  void ltdcSwapResetStatsI(LTDCDriver *ltdcp);
+  void ltdcSwapResetStats(LTDCDriver *ltdcp);
+#endif /* LTDC_USE_SWAPCHAIN */
+
   /* Background layer methods.*/
   ltdc_flags_t ltdcBgGetEnableFlagsI(LTDCDriver *ltdcp);
   ltdc_flags_t ltdcBgGetEnableFlags(LTDCDriver *ltdcp);
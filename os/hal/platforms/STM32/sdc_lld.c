@@ -41,6 +41,23 @@
   STM32_DMA_GETCHANNEL(STM32_SDC_SDIO_DMA_STREAM,                           \
                        STM32_SDC_SDIO_DMA_CHN)
 
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
+/*
+ * DMA mode for unaligned transfers, the stream loops on the two bounce
+ * buffers. The circular mode is not allowed with the peripheral flow
+ * control so the DMA is the flow controller in this case.
+ */
+#if (defined(STM32F4XX) || defined(STM32F2XX))
+#define DMA_BOUNCE_MODE(sdcp)                                               \
+  (((sdcp)->dmamode & ~STM32_DMA_CR_PFCTRL) | STM32_DMA_CR_CIRC |           \
+   STM32_DMA_CR_HTIE | STM32_DMA_CR_TCIE | STM32_DMA_CR_TEIE)
+#else
+#define DMA_BOUNCE_MODE(sdcp)                                               \
+  ((sdcp)->dmamode | STM32_DMA_CR_CIRC |                                    \
+   STM32_DMA_CR_HTIE | STM32_DMA_CR_TCIE | STM32_DMA_CR_TEIE)
+#endif
+#endif /* STM32_SDC_SDIO_UNALIGNED_SUPPORT */
+
 /*===========================================================================*/
 /* Driver exported variables.                                                */
 /*===========================================================================*/
@@ -54,11 +71,13 @@ SDCDriver SDCD1;
 
 #if STM32_SDC_SDIO_UNALIGNED_SUPPORT
 /**
- * @brief   Buffer for temporary storage during unaligned transfers.
+ * @brief   Bounce buffers for unaligned transfers.
+ * @details The DMA fills or empties one buffer while the other one is
+ *          copied.
  */
 static union {
   uint32_t  alignment;
-  uint8_t   buf[MMCSD_BLOCK_SIZE];
+  uint8_t   buf[2][MMCSD_BLOCK_SIZE];
 } u;
 #endif /* STM32_SDC_SDIO_UNALIGNED_SUPPORT */
 
@@ -142,6 +161,63 @@ static bool_t sdc_lld_prepare_write(SDCDriver *sdcp, uint32_t startblk,
   return CH_SUCCESS;
 }
 
+/**
+ * @brief   Checks for the end of the data transaction.
+ * @details The transaction ends when the SDIO interrupt has been served,
+ *          unaligned reads also require the last block to be copied out of
+ *          the bounce buffers unless the SDIO reported an error.
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ * @return              The transaction state.
+ * @retval FALSE        transaction in progress.
+ * @retval TRUE         transaction ended.
+ *
+ * @notapi
+ */
+static bool_t sdc_lld_is_transaction_end(SDCDriver *sdcp) {
+
+  if (SDIO->MASK != 0)
+    return FALSE;
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
+  if ((sdcp->ubuf != NULL) && (sdcp->state == BLK_READING) &&
+      (sdcp->ucount > 0) &&
+      ((SDIO->STA & (STM32_SDIO_STA_ERROR_MASK | SDIO_STA_STBITERR)) == 0))
+    return FALSE;
+#else
+  (void)sdcp;
+#endif
+  return TRUE;
+}
+
+/**
+ * @brief   Signals the end of the data transaction.
+ * @details The waiting thread, if any, is resumed and the completion event
+ *          is broadcasted.
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ *
+ * @notapi
+ */
+static void sdc_lld_serve_transaction_end_i(SDCDriver *sdcp) {
+
+  if (!sdc_lld_is_transaction_end(sdcp))
+    return;
+
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
+  /* The bounce buffers stream is circular and never stops by itself.*/
+  if (sdcp->ubuf != NULL)
+    dmaStreamDisable(sdcp->dma);
+#endif
+
+  if (sdcp->thread != NULL) {
+    chSchReadyI(sdcp->thread);
+    sdcp->thread = NULL;
+  }
+#if SDC_USE_ASYNC
+  chEvtBroadcastI(&sdcp->event);
+#endif
+}
+
 /**
  * @brief   Wait end of data transaction and performs finalizations.
  *
@@ -156,10 +232,10 @@ static bool_t sdc_lld_prepare_write(SDCDriver *sdcp, uint32_t startblk,
 static bool_t sdc_lld_wait_transaction_end(SDCDriver *sdcp, uint32_t n,
                                            uint32_t *resp) {
 
-  /* Note the mask is checked before going to sleep because the interrupt
-     may have occurred before reaching the critical zone.*/
+  /* Note the end condition is checked before going to sleep because the
+     interrupt may have occurred before reaching the critical zone.*/
   chSysLock();
-  if (SDIO->MASK != 0) {
+  if (!sdc_lld_is_transaction_end(sdcp)) {
     chDbgAssert(sdcp->thread == NULL,
                 "sdc_lld_start_data_transaction(), #1", "not NULL");
     sdcp->thread = chThdSelf();
@@ -189,8 +265,12 @@ static bool_t sdc_lld_wait_transaction_end(SDCDriver *sdcp, uint32_t n,
     dmaStreamClearInterrupt(sdcp->dma);*/
 #else
   /* Waits for transfer completion at DMA level, the the stream is
-     disabled and cleared.*/
-  dmaWaitCompletion(sdcp->dma);
+     disabled and cleared. The bounce buffers stream is circular, it has
+     already been stopped by the ISR.*/
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
+  if (sdcp->ubuf == NULL)
+#endif
+    dmaWaitCompletion(sdcp->dma);
 
   SDIO->ICR = STM32_SDIO_ICR_ALL_FLAGS;
   SDIO->DCTRL = 0;
@@ -261,6 +341,56 @@ static void sdc_lld_error_cleanup(SDCDriver *sdcp,
 /* Driver interrupt handlers.                                                */
 /*===========================================================================*/
 
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT || defined(__DOXYGEN__)
+/**
+ * @brief   Bounce buffers DMA ISR service routine.
+ * @details The half transfer and transfer complete interrupts mark the
+ *          first and second bounce buffer as done, the buffer is copied to
+ *          the destination when reading or refilled with the next block
+ *          when writing while the DMA works on the other one.
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ * @param[in] flags     pre-shifted content of the ISR register
+ */
+static void sdc_lld_serve_dma_interrupt(SDCDriver *sdcp, uint32_t flags) {
+  uint32_t late, half, mask;
+
+  chSysLockFromIsr();
+
+  /* Both buffers done means that the DMA is already working on a buffer
+     not yet served. Stopping the stream makes the SDIO fail with an overrun
+     or underrun error which terminates the transaction, a DMA error is
+     handled the same way.*/
+  late = sdcp->state == BLK_READING ? 2 : 0;
+  if (((flags & STM32_DMA_ISR_TEIF) != 0) ||
+      (((flags & STM32_DMA_ISR_HTIF) != 0) &&
+       ((flags & STM32_DMA_ISR_TCIF) != 0) && (sdcp->ucount > late))) {
+    dmaStreamDisable(sdcp->dma);
+  }
+  else if (sdcp->ucount > 0) {
+    do {
+      half = (sdcp->blocks - sdcp->ucount) & 1;
+      mask = half ? STM32_DMA_ISR_TCIF : STM32_DMA_ISR_HTIF;
+      if ((flags & mask) == 0)
+        break;
+      flags &= ~mask;
+      if (sdcp->state == BLK_READING)
+        memcpy(sdcp->ubuf, u.buf[half], MMCSD_BLOCK_SIZE);
+      else
+        memcpy(u.buf[half], sdcp->ubuf, MMCSD_BLOCK_SIZE);
+      sdcp->ubuf += MMCSD_BLOCK_SIZE;
+      sdcp->ucount--;
+    } while (sdcp->ucount > 0);
+
+    /* A read ends when the last block is out of the bounce buffers.*/
+    if ((sdcp->ucount == 0) && (sdcp->state == BLK_READING))
+      sdc_lld_serve_transaction_end_i(sdcp);
+  }
+
+  chSysUnlockFromIsr();
+}
+#endif /* STM32_SDC_SDIO_UNALIGNED_SUPPORT */
+
 #if !defined(STM32_SDIO_HANDLER)
 #error "STM32_SDIO_HANDLER not defined"
 #endif
@@ -281,10 +411,7 @@ CH_IRQ_HANDLER(STM32_SDIO_HANDLER) {
      read/write functions needs to check them.*/
   SDIO->MASK = 0;
 
-  if (SDCD1.thread != NULL) {
-    chSchReadyI(SDCD1.thread);
-    SDCD1.thread = NULL;
-  }
+  sdc_lld_serve_transaction_end_i(&SDCD1);
 
   chSysUnlockFromIsr();
 
@@ -305,6 +432,9 @@ void sdc_lld_init(void) {
   sdcObjectInit(&SDCD1);
   SDCD1.thread = NULL;
   SDCD1.dma    = STM32_DMA_STREAM(STM32_SDC_SDIO_DMA_STREAM);
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
+  SDCD1.ubuf   = NULL;
+#endif
 #if CH_DBG_ENABLE_ASSERTS
   SDCD1.sdio   = SDIO;
 #endif
@@ -334,7 +464,13 @@ void sdc_lld_start(SDCDriver *sdcp) {
   if (sdcp->state == BLK_STOP) {
     /* Note, the DMA must be enabled before the IRQs.*/
     bool_t b;
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
+    b = dmaStreamAllocate(sdcp->dma, STM32_SDC_SDIO_IRQ_PRIORITY,
+                          (stm32_dmaisr_t)sdc_lld_serve_dma_interrupt,
+                          (void *)sdcp);
+#else
     b = dmaStreamAllocate(sdcp->dma, STM32_SDC_SDIO_IRQ_PRIORITY, NULL, NULL);
+#endif
     chDbgAssert(!b, "sdc_lld_start(), #1", "stream already allocated");
     dmaStreamSetPeripheral(sdcp->dma, &SDIO->FIFO);
 #if (defined(STM32F4XX) || defined(STM32F2XX))
@@ -577,7 +713,10 @@ bool_t sdc_lld_send_cmd_long_crc(SDCDriver *sdcp, uint8_t cmd, uint32_t arg,
 }
 
 /**
- * @brief   Reads one or more blocks.
+ * @brief   Starts reading one or more blocks.
+ * @details Unaligned buffers are served in a single multiple blocks
+ *          transaction through two bounce buffers, each block is copied
+ *          by the DMA interrupt while the following one is received.
  *
  * @param[in] sdcp      pointer to the @p SDCDriver object
  * @param[in] startblk  first block to read
@@ -585,13 +724,13 @@ bool_t sdc_lld_send_cmd_long_crc(SDCDriver *sdcp, uint8_t cmd, uint32_t arg,
  * @param[in] n         number of blocks to read
  *
  * @return              The operation status.
- * @retval CH_SUCCESS   operation succeeded.
+ * @retval CH_SUCCESS   operation started.
  * @retval CH_FAILED    operation failed.
  *
  * @notapi
  */
-bool_t sdc_lld_read_aligned(SDCDriver *sdcp, uint32_t startblk,
-                            uint8_t *buf, uint32_t n) {
+bool_t sdc_lld_start_read(SDCDriver *sdcp, uint32_t startblk,
+                          uint8_t *buf, uint32_t n) {
   uint32_t resp[1];
 
   chDbgCheck((n < (0x1000000 / MMCSD_BLOCK_SIZE)), "max transaction size");
@@ -602,11 +741,28 @@ bool_t sdc_lld_read_aligned(SDCDriver *sdcp, uint32_t startblk,
   if (_sdc_wait_for_transfer_state(sdcp))
     return CH_FAILED;
 
-  /* Prepares the DMA channel for writing.*/
-  dmaStreamSetMemory0(sdcp->dma, buf);
-  dmaStreamSetTransactionSize(sdcp->dma,
-                              (n * MMCSD_BLOCK_SIZE) / sizeof (uint32_t));
-  dmaStreamSetMode(sdcp->dma, sdcp->dmamode | STM32_DMA_CR_DIR_P2M);
+  sdcp->blocks = n;
+
+  /* Prepares the DMA channel for reading.*/
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
+  sdcp->ubuf = NULL;
+  if (((unsigned)buf & 3) != 0) {
+    sdcp->ubuf   = buf;
+    sdcp->ucount = n;
+    dmaStreamSetMemory0(sdcp->dma, u.buf);
+    dmaStreamSetTransactionSize(sdcp->dma,
+                                sizeof (u.buf) / sizeof (uint32_t));
+    dmaStreamSetMode(sdcp->dma,
+                     DMA_BOUNCE_MODE(sdcp) | STM32_DMA_CR_DIR_P2M);
+  }
+  else
+#endif
+  {
+    dmaStreamSetMemory0(sdcp->dma, buf);
+    dmaStreamSetTransactionSize(sdcp->dma,
+                                (n * MMCSD_BLOCK_SIZE) / sizeof (uint32_t));
+    dmaStreamSetMode(sdcp->dma, sdcp->dmamode | STM32_DMA_CR_DIR_P2M);
+  }
   dmaStreamEnable(sdcp->dma);
 
   /* Setting up data transfer.*/
@@ -628,9 +784,6 @@ bool_t sdc_lld_read_aligned(SDCDriver *sdcp, uint32_t startblk,
                 SDIO_DCTRL_DBLOCKSIZE_0 |
                 SDIO_DCTRL_DMAEN |
                 SDIO_DCTRL_DTEN;
-  if (sdc_lld_wait_transaction_end(sdcp, n, resp) == TRUE)
-    goto error;
-
   return CH_SUCCESS;
 
 error:
@@ -639,7 +792,10 @@ error:
 }
 
 /**
- * @brief   Writes one or more blocks.
+ * @brief   Starts writing one or more blocks.
+ * @details Unaligned buffers are served in a single multiple blocks
+ *          transaction through two bounce buffers, each buffer is refilled
+ *          by the DMA interrupt while the other one is sent.
  *
  * @param[in] sdcp      pointer to the @p SDCDriver object
  * @param[in] startblk  first block to write
@@ -647,13 +803,13 @@ error:
  * @param[in] n         number of blocks to write
  *
  * @return              The operation status.
- * @retval CH_SUCCESS   operation succeeded.
+ * @retval CH_SUCCESS   operation started.
  * @retval CH_FAILED    operation failed.
  *
  * @notapi
  */
-bool_t sdc_lld_write_aligned(SDCDriver *sdcp, uint32_t startblk,
-                             const uint8_t *buf, uint32_t n) {
+bool_t sdc_lld_start_write(SDCDriver *sdcp, uint32_t startblk,
+                           const uint8_t *buf, uint32_t n) {
   uint32_t resp[1];
 
   chDbgCheck((n < (0x1000000 / MMCSD_BLOCK_SIZE)), "max transaction size");
@@ -664,11 +820,32 @@ bool_t sdc_lld_write_aligned(SDCDriver *sdcp, uint32_t startblk,
   if (_sdc_wait_for_transfer_state(sdcp))
     return CH_FAILED;
 
+  sdcp->blocks = n;
+
   /* Prepares the DMA channel for writing.*/
-  dmaStreamSetMemory0(sdcp->dma, buf);
-  dmaStreamSetTransactionSize(sdcp->dma,
-                              (n * MMCSD_BLOCK_SIZE) / sizeof (uint32_t));
-  dmaStreamSetMode(sdcp->dma, sdcp->dmamode | STM32_DMA_CR_DIR_M2P);
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
+  sdcp->ubuf = NULL;
+  if (((unsigned)buf & 3) != 0) {
+    /* Both bounce buffers are filled before starting, the source is only
+       read so dropping the const qualifier is safe.*/
+    uint32_t staged = n > 1 ? 2 : 1;
+    memcpy(u.buf, buf, staged * MMCSD_BLOCK_SIZE);
+    sdcp->ubuf   = (uint8_t *)buf + staged * MMCSD_BLOCK_SIZE;
+    sdcp->ucount = n - staged;
+    dmaStreamSetMemory0(sdcp->dma, u.buf);
+    dmaStreamSetTransactionSize(sdcp->dma,
+                                sizeof (u.buf) / sizeof (uint32_t));
+    dmaStreamSetMode(sdcp->dma,
+                     DMA_BOUNCE_MODE(sdcp) | STM32_DMA_CR_DIR_M2P);
+  }
+  else
+#endif
+  {
+    dmaStreamSetMemory0(sdcp->dma, buf);
+    dmaStreamSetTransactionSize(sdcp->dma,
+                                (n * MMCSD_BLOCK_SIZE) / sizeof (uint32_t));
+    dmaStreamSetMode(sdcp->dma, sdcp->dmamode | STM32_DMA_CR_DIR_M2P);
+  }
   dmaStreamEnable(sdcp->dma);
 
   /* Setting up data transfer.*/
@@ -689,9 +866,6 @@ bool_t sdc_lld_write_aligned(SDCDriver *sdcp, uint32_t startblk,
                 SDIO_DCTRL_DBLOCKSIZE_0 |
                 SDIO_DCTRL_DMAEN |
                 SDIO_DCTRL_DTEN;
-  if (sdc_lld_wait_transaction_end(sdcp, n, resp) == TRUE)
-    goto error;
-
   return CH_SUCCESS;
 
 error:
@@ -699,6 +873,28 @@ error:
   return CH_FAILED;
 }
 
+/**
+ * @brief   Waits for the end of the transaction started by
+ *          @p sdc_lld_start_read() or @p sdc_lld_start_write().
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ *
+ * @return              The operation status.
+ * @retval CH_SUCCESS   operation succeeded.
+ * @retval CH_FAILED    operation failed.
+ *
+ * @notapi
+ */
+bool_t sdc_lld_wait_transfer(SDCDriver *sdcp) {
+  uint32_t resp[1];
+
+  if (sdc_lld_wait_transaction_end(sdcp, sdcp->blocks, resp) == TRUE) {
+    sdc_lld_error_cleanup(sdcp, sdcp->blocks, resp);
+    return CH_FAILED;
+  }
+  return CH_SUCCESS;
+}
+
 /**
  * @brief   Reads one or more blocks.
  *
@@ -716,20 +912,9 @@ error:
 bool_t sdc_lld_read(SDCDriver *sdcp, uint32_t startblk,
                     uint8_t *buf, uint32_t n) {
 
-#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
-  if (((unsigned)buf & 3) != 0) {
-    uint32_t i;
-    for (i = 0; i < n; i++) {
-      if (sdc_lld_read_aligned(sdcp, startblk, u.buf, 1))
-        return CH_FAILED;
-      memcpy(buf, u.buf, MMCSD_BLOCK_SIZE);
-      buf += MMCSD_BLOCK_SIZE;
-      startblk++;
-    }
-    return CH_SUCCESS;
-  }
-#endif /* STM32_SDC_SDIO_UNALIGNED_SUPPORT */
-  return sdc_lld_read_aligned(sdcp, startblk, buf, n);
+  if (sdc_lld_start_read(sdcp, startblk, buf, n))
+    return CH_FAILED;
+  return sdc_lld_wait_transfer(sdcp);
 }
 
 /**
@@ -749,20 +934,9 @@ bool_t sdc_lld_read(SDCDriver *sdcp, uint32_t startblk,
 bool_t sdc_lld_write(SDCDriver *sdcp, uint32_t startblk,
                      const uint8_t *buf, uint32_t n) {
 
-#if STM32_SDC_SDIO_UNALIGNED_SUPPORT
-  if (((unsigned)buf & 3) != 0) {
-    uint32_t i;
-    for (i = 0; i < n; i++) {
-      memcpy(u.buf, buf, MMCSD_BLOCK_SIZE);
-      buf += MMCSD_BLOCK_SIZE;
-      if (sdc_lld_write_aligned(sdcp, startblk, u.buf, 1))
-        return CH_FAILED;
-      startblk++;
-    }
-    return CH_SUCCESS;
-  }
-#endif /* STM32_SDC_SDIO_UNALIGNED_SUPPORT */
-  return sdc_lld_write_aligned(sdcp, startblk, buf, n);
+  if (sdc_lld_start_write(sdcp, startblk, buf, n))
+    return CH_FAILED;
+  return sdc_lld_wait_transfer(sdcp);
 }
 
 /**
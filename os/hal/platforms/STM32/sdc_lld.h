@@ -87,7 +87,10 @@
 
 /**
  * @brief   Support for unaligned transfers.
- * @note    Unaligned transfers are much slower.
+ * @details Unaligned buffers are transferred through two bounce buffers in
+ *          a single multiple blocks transaction, the copies are performed
+ *          by the DMA interrupt.
+ * @note    Unaligned transfers are slower and use 1kB of RAM.
  */
 #if !defined(STM32_SDC_SDIO_UNALIGNED_SUPPORT) || defined(__DOXYGEN__)
 #define STM32_SDC_SDIO_UNALIGNED_SUPPORT    TRUE
@@ -224,28 +227,27 @@ struct SDCDriver {
    * @brief Virtual Methods Table.
    */
   const struct SDCDriverVMT *vmt;
-  _mmcsd_block_device_data
+  _sdc_driver_data
+  /* End of the mandatory fields.*/
   /**
-   * @brief Current configuration data.
+   * @brief Thread waiting for I/O completion IRQ.
    */
-  const SDCConfig           *config;
+  Thread                    *thread;
   /**
-   * @brief Various flags regarding the mounted card.
+   * @brief Number of blocks of the current transaction.
    */
-  sdcmode_t                 cardmode;
+  uint32_t                  blocks;
+#if STM32_SDC_SDIO_UNALIGNED_SUPPORT || defined(__DOXYGEN__)
   /**
-   * @brief Errors flags.
+   * @brief Next block to be copied through the bounce buffers, @p NULL
+   *        if the transaction is aligned.
    */
-  sdcflags_t                errors;
+  uint8_t                   *ubuf;
   /**
-   * @brief Card RCA.
+   * @brief Number of blocks still to be copied.
    */
-  uint32_t                  rca;
-  /* End of the mandatory fields.*/
-  /**
-   * @brief Thread waiting for I/O completion IRQ.
-   */
-  Thread                    *thread;
+  uint32_t                  ucount;
+#endif
   /**
    * @brief     DMA mode bit mask.
    */
@@ -292,6 +294,11 @@ extern "C" {
                                     uint32_t *resp);
   bool_t sdc_lld_send_cmd_long_crc(SDCDriver *sdcp, uint8_t cmd, uint32_t arg,
                                    uint32_t *resp);
+  bool_t sdc_lld_start_read(SDCDriver *sdcp, uint32_t startblk,
+                            uint8_t *buf, uint32_t n);
+  bool_t sdc_lld_start_write(SDCDriver *sdcp, uint32_t startblk,
+                             const uint8_t *buf, uint32_t n);
+  bool_t sdc_lld_wait_transfer(SDCDriver *sdcp);
   bool_t sdc_lld_read(SDCDriver *sdcp, uint32_t startblk,
                       uint8_t *buf, uint32_t n);
   bool_t sdc_lld_write(SDCDriver *sdcp, uint32_t startblk,
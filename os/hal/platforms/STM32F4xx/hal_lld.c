@@ -27,10 +27,35 @@
 #include "ch.h"
 #include "hal.h"
 
+#if CH_TIMEDELTA > 0
+#include "stm32_tim.h"
+#endif
+
 /*===========================================================================*/
 /* Driver local definitions.                                                 */
 /*===========================================================================*/
 
+#if CH_TIMEDELTA > 0
+/**
+ * @brief   Timer used as free running system timer in tick-less mode.
+ * @note    TIM5 is a 32 bits timer, it can cover the whole @p systime_t
+ *          range without software extensions.
+ */
+#define STM32_ST_TIM                        STM32_TIM5
+
+#if STM32_GPT_USE_TIM5 || STM32_PWM_USE_TIM5 || STM32_ICU_USE_TIM5
+#error "TIM5 is reserved as system timer in tick-less mode"
+#endif
+
+#if (STM32_TIMCLK1 % CH_FREQUENCY) != 0
+#error "CH_FREQUENCY is not an exact divider of STM32_TIMCLK1"
+#endif
+
+#if ((STM32_TIMCLK1 / CH_FREQUENCY) - 1) > 0xFFFF
+#error "CH_FREQUENCY too low for the TIM5 prescaler"
+#endif
+#endif /* CH_TIMEDELTA > 0 */
+
 /*===========================================================================*/
 /* Driver exported variables.                                                */
 /*===========================================================================*/
@@ -93,6 +118,28 @@ static void hal_lld_backup_domain_init(void) {
 /* Driver interrupt handlers.                                                */
 /*===========================================================================*/
 
+#if (CH_TIMEDELTA > 0) || defined(__DOXYGEN__)
+/**
+ * @brief   TIM5 interrupt handler.
+ * @details The compare channel 1 is used as system timer alarm in
+ *          tick-less mode.
+ *
+ * @isr
+ */
+CH_IRQ_HANDLER(STM32_TIM5_HANDLER) {
+
+  CH_IRQ_PROLOGUE();
+
+  STM32_ST_TIM->SR = 0;
+
+  chSysLockFromIsr();
+  chSysTimerHandlerI();
+  chSysUnlockFromIsr();
+
+  CH_IRQ_EPILOGUE();
+}
+#endif /* CH_TIMEDELTA > 0 */
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -111,12 +158,29 @@ void hal_lld_init(void) {
   rccResetAPB1(~RCC_APB1RSTR_PWRRST);
   rccResetAPB2(~0);
 
+#if CH_TIMEDELTA == 0
   /* SysTick initialization using the system clock.*/
   SysTick->LOAD = STM32_HCLK / CH_FREQUENCY - 1;
   SysTick->VAL = 0;
   SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk |
                   SysTick_CTRL_ENABLE_Msk |
                   SysTick_CTRL_TICKINT_Msk;
+#else
+  /* TIM5 initialization as free running system timer, the compare
+     channel 1 is the alarm and it is initially disabled.*/
+  rccEnableTIM5(FALSE);
+  STM32_ST_TIM->PSC  = (STM32_TIMCLK1 / CH_FREQUENCY) - 1;
+  STM32_ST_TIM->ARR  = 0xFFFFFFFF;
+  STM32_ST_TIM->CCMR1 = 0;
+  STM32_ST_TIM->CCR[0] = 0;
+  STM32_ST_TIM->DIER = 0;
+  STM32_ST_TIM->CR2  = 0;
+  STM32_ST_TIM->EGR  = STM32_TIM_EGR_UG;
+  STM32_ST_TIM->SR   = 0;
+  STM32_ST_TIM->CR1  = STM32_TIM_CR1_CEN;
+  nvicEnableVector(STM32_TIM5_NUMBER,
+                   CORTEX_PRIORITY_MASK(CORTEX_PRIORITY_SYSTICK));
+#endif
 
   /* DWT cycle counter enable.*/
   SCS_DEMCR |= SCS_DEMCR_TRCENA;
@@ -138,6 +202,56 @@ void hal_lld_init(void) {
 #endif /* STM32_PVD_ENABLE */
 }
 
+#if (CH_TIMEDELTA > 0) || defined(__DOXYGEN__)
+/**
+ * @brief   Starts the system timer alarm.
+ *
+ * @param[in] time      the absolute time of the alarm
+ *
+ * @notapi
+ */
+void port_timer_start_alarm(systime_t time) {
+
+  STM32_ST_TIM->CCR[0] = (uint32_t)time;
+  STM32_ST_TIM->SR     = 0;
+  STM32_ST_TIM->DIER   = STM32_TIM_DIER_CC1IE;
+}
+
+/**
+ * @brief   Stops the system timer alarm.
+ *
+ * @notapi
+ */
+void port_timer_stop_alarm(void) {
+
+  STM32_ST_TIM->DIER = 0;
+}
+
+/**
+ * @brief   Changes the time of the system timer alarm.
+ *
+ * @param[in] time      the new absolute time of the alarm
+ *
+ * @notapi
+ */
+void port_timer_set_alarm(systime_t time) {
+
+  STM32_ST_TIM->CCR[0] = (uint32_t)time;
+}
+
+/**
+ * @brief   Returns the current system time.
+ *
+ * @return              The value of the free running counter.
+ *
+ * @notapi
+ */
+systime_t port_timer_get_time(void) {
+
+  return (systime_t)STM32_ST_TIM->CNT;
+}
+#endif /* CH_TIMEDELTA > 0 */
+
 /**
  * @brief   STM32F2xx clocks and PLL initialization.
  * @note    All the involved constants come from the file @p board.h.
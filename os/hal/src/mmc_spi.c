@@ -96,21 +96,72 @@ static const uint8_t crc7_lookup_table[256] = {
   0x62, 0x6b, 0x70, 0x79
 };
 
+#if MMC_USE_DATA_CRC || defined(__DOXYGEN__)
+/**
+ * @brief   Lookup table for CRC-16 (based on polynomial x^16 + x^12 + x^5 + 1).
+ */
+static const uint16_t crc16_lookup_table[256] = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+  0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+  0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6,
+  0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
+  0x2462, 0x3443, 0x0420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485,
+  0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d,
+  0x3653, 0x2672, 0x1611, 0x0630, 0x76d7, 0x66f6, 0x5695, 0x46b4,
+  0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc,
+  0x48c4, 0x58e5, 0x6886, 0x78a7, 0x0840, 0x1861, 0x2802, 0x3823,
+  0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b,
+  0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0x0a50, 0x3a33, 0x2a12,
+  0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
+  0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0x0c60, 0x1c41,
+  0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49,
+  0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0x0e70,
+  0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78,
+  0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f,
+  0x1080, 0x00a1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
+  0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e,
+  0x02b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256,
+  0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d,
+  0x34e2, 0x24c3, 0x14a0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+  0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c,
+  0x26d3, 0x36f2, 0x0691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634,
+  0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab,
+  0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x08e1, 0x3882, 0x28a3,
+  0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a,
+  0x4a75, 0x5a54, 0x6a37, 0x7a16, 0x0af1, 0x1ad0, 0x2ab3, 0x3a92,
+  0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9,
+  0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0x0cc1,
+  0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8,
+  0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0
+};
+#endif /* MMC_USE_DATA_CRC */
+
 /*===========================================================================*/
 /* Driver local functions.                                                   */
 /*===========================================================================*/
 
+#if MMC_USE_FAST_PATH
+static bool_t fast_read_blocks(MMCDriver *mmcp, uint8_t *buffer, uint32_t n);
+static bool_t fast_write_blocks(MMCDriver *mmcp,
+                                const uint8_t *buffer, uint32_t n);
+#endif
+
 static bool_t mmc_read(void *instance, uint32_t startblk,
                 uint8_t *buffer, uint32_t n) {
 
   if (mmcStartSequentialRead((MMCDriver *)instance, startblk))
     return CH_FAILED;
+#if MMC_USE_FAST_PATH
+  if ((n > 0) && fast_read_blocks((MMCDriver *)instance, buffer, n))
+    return CH_FAILED;
+#else
   while (n > 0) {
     if (mmcSequentialRead((MMCDriver *)instance, buffer))
       return CH_FAILED;
     buffer += MMCSD_BLOCK_SIZE;
     n--;
   }
+#endif
   if (mmcStopSequentialRead((MMCDriver *)instance))
       return CH_FAILED;
   return CH_SUCCESS;
@@ -121,12 +172,17 @@ static bool_t mmc_write(void *instance, uint32_t startblk,
 
   if (mmcStartSequentialWrite((MMCDriver *)instance, startblk))
       return CH_FAILED;
+#if MMC_USE_FAST_PATH
+  if ((n > 0) && fast_write_blocks((MMCDriver *)instance, buffer, n))
+      return CH_FAILED;
+#else
   while (n > 0) {
       if (mmcSequentialWrite((MMCDriver *)instance, buffer))
           return CH_FAILED;
       buffer += MMCSD_BLOCK_SIZE;
       n--;
   }
+#endif
   if (mmcStopSequentialWrite((MMCDriver *)instance))
       return CH_FAILED;
   return CH_SUCCESS;
@@ -147,6 +203,23 @@ static uint8_t crc7(uint8_t crc, const uint8_t *buffer, size_t len) {
   return crc;
 }
 
+#if MMC_USE_DATA_CRC || defined(__DOXYGEN__)
+/**
+ * @brief Calculate the CRC-16 of data blocks based on a lookup table.
+ *
+ * @param[in] crc       start value for CRC
+ * @param[in] buffer    pointer to data buffer
+ * @param[in] len       length of data
+ * @return              Calculated CRC
+ */
+static uint16_t crc16(uint16_t crc, const uint8_t *buffer, size_t len) {
+
+  while (len--)
+    crc = (uint16_t)(crc << 8) ^ crc16_lookup_table[(crc >> 8) ^ *buffer++];
+  return crc;
+}
+#endif /* MMC_USE_DATA_CRC */
+
 /**
  * @brief   Waits an idle condition.
  *
@@ -156,17 +229,25 @@ static uint8_t crc7(uint8_t crc, const uint8_t *buffer, size_t len) {
  */
 static void wait(MMCDriver *mmcp) {
   int i;
+#if MMC_USE_FAST_PATH
+  /* The card keeps the line high once idle, only the last byte of each
+     window is checked.*/
+  const size_t n = MMC_TOKEN_WINDOW;
+  uint8_t buf[MMC_TOKEN_WINDOW];
+#else
+  const size_t n = 1;
   uint8_t buf[4];
+#endif
 
   for (i = 0; i < 16; i++) {
-    spiReceive(mmcp->config->spip, 1, buf);
-    if (buf[0] == 0xFF)
+    spiReceive(mmcp->config->spip, n, buf);
+    if (buf[n - 1] == 0xFF)
       return;
   }
   /* Looks like it is a long wait.*/
   while (TRUE) {
-    spiReceive(mmcp->config->spip, 1, buf);
-    if (buf[0] == 0xFF)
+    spiReceive(mmcp->config->spip, n, buf);
+    if (buf[n - 1] == 0xFF)
       break;
 #ifdef MMC_NICE_WAITING
     /* Trying to be nice with the other threads.*/
@@ -355,6 +436,208 @@ static void sync(MMCDriver *mmcp) {
   spiUnselect(mmcp->config->spip);
 }
 
+#if MMC_USE_FAST_PATH || defined(__DOXYGEN__)
+/**
+ * @brief   Waits for the end of an operation started asynchronously.
+ *
+ * @param[in] spip      pointer to the @p SPIDriver object
+ *
+ * @notapi
+ */
+static void spi_wait(SPIDriver *spip) {
+
+  chSysLock();
+  if (spip->state == SPI_ACTIVE)
+    _spi_wait_s(spip);
+  chSysUnlock();
+}
+
+/**
+ * @brief   Waits for the data token and starts receiving a block.
+ * @details The token is searched in windows of @p MMC_TOKEN_WINDOW bytes,
+ *          the bytes following the token already belong to the block. The
+ *          rest of the block and its CRC are received asynchronously in a
+ *          single operation.
+ *
+ * @param[in] mmcp      pointer to the @p MMCDriver object
+ * @param[out] sp       pointer to a staging buffer
+ * @return              The offset of the block into the staging buffer.
+ * @retval 0            timeout or error token.
+ *
+ * @notapi
+ */
+static size_t fast_start_read(MMCDriver *mmcp, uint8_t *sp) {
+  unsigned i, j;
+
+  for (i = 0; i < MMC_WAIT_DATA; i += MMC_TOKEN_WINDOW) {
+    spiReceive(mmcp->config->spip, MMC_TOKEN_WINDOW, sp);
+    for (j = 0; j < MMC_TOKEN_WINDOW; j++) {
+      if (sp[j] != 0xFF) {
+        if (sp[j] != 0xFE)
+          return 0;
+        spiStartReceive(mmcp->config->spip,
+                        j + MMCSD_BLOCK_SIZE + 3 - MMC_TOKEN_WINDOW,
+                        sp + MMC_TOKEN_WINDOW);
+        return j + 1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief   Copies a received block out of its staging buffer.
+ *
+ * @param[in] sp        pointer to the staging buffer
+ * @param[in] offset    offset of the block into the staging buffer
+ * @param[out] buffer   pointer to the read buffer
+ * @return              The operation status.
+ * @retval CH_SUCCESS   the operation succeeded.
+ * @retval CH_FAILED    CRC error.
+ *
+ * @notapi
+ */
+static bool_t fast_end_read(const uint8_t *sp, size_t offset,
+                            uint8_t *buffer) {
+
+  memcpy(buffer, sp + offset, MMCSD_BLOCK_SIZE);
+#if MMC_USE_DATA_CRC
+  /* The CRC of a block followed by its own CRC is zero.*/
+  if (crc16(0, sp + offset, MMCSD_BLOCK_SIZE + 2) != 0)
+    return CH_FAILED;
+#endif
+  return CH_SUCCESS;
+}
+
+/**
+ * @brief   Reads blocks within a sequential read operation.
+ * @details Each block is copied and checked while the following one is
+ *          being received.
+ *
+ * @param[in] mmcp      pointer to the @p MMCDriver object
+ * @param[out] buffer   pointer to the read buffer
+ * @param[in] n         number of blocks, at least one
+ * @return              The operation status.
+ * @retval CH_SUCCESS   the operation succeeded.
+ * @retval CH_FAILED    the operation failed.
+ *
+ * @notapi
+ */
+static bool_t fast_read_blocks(MMCDriver *mmcp, uint8_t *buffer, uint32_t n) {
+  size_t offset, prev;
+  unsigned i = 0;
+  bool_t err;
+
+  if (mmcp->state != BLK_READING)
+    return CH_FAILED;
+
+  if ((prev = fast_start_read(mmcp, mmcp->buf[0])) == 0)
+    goto failed;
+  spi_wait(mmcp->config->spip);
+  while (--n > 0) {
+    offset = fast_start_read(mmcp, mmcp->buf[i ^ 1]);
+    err = fast_end_read(mmcp->buf[i], prev, buffer);
+    if (offset == 0)
+      goto failed;
+    spi_wait(mmcp->config->spip);
+    if (err)
+      goto failed;
+    prev = offset;
+    buffer += MMCSD_BLOCK_SIZE;
+    i ^= 1;
+  }
+  if (fast_end_read(mmcp->buf[i], prev, buffer) == CH_SUCCESS)
+    return CH_SUCCESS;
+
+  /* Timeout or CRC error.*/
+failed:
+  spiUnselect(mmcp->config->spip);
+  spiStop(mmcp->config->spip);
+  mmcp->state = BLK_READY;
+  return CH_FAILED;
+}
+
+/**
+ * @brief   Stages a block for writing, data prologue, data and CRC.
+ *
+ * @param[out] sp       pointer to the staging buffer
+ * @param[in] buffer    pointer to the write buffer
+ *
+ * @notapi
+ */
+static void fast_prepare_write(uint8_t *sp, const uint8_t *buffer) {
+  uint16_t crc = 0xFFFF;
+
+  sp[0] = 0xFF;
+  sp[1] = 0xFC;
+  memcpy(sp + 2, buffer, MMCSD_BLOCK_SIZE);
+#if MMC_USE_DATA_CRC
+  crc = crc16(0, buffer, MMCSD_BLOCK_SIZE);
+#endif
+  sp[MMCSD_BLOCK_SIZE + 2] = (uint8_t)(crc >> 8);
+  sp[MMCSD_BLOCK_SIZE + 3] = (uint8_t)crc;
+}
+
+/**
+ * @brief   Checks the data response and waits for the end of programming.
+ *
+ * @param[in] mmcp      pointer to the @p MMCDriver object
+ * @return              The operation status.
+ * @retval CH_SUCCESS   the operation succeeded.
+ * @retval CH_FAILED    the block has been rejected.
+ *
+ * @notapi
+ */
+static bool_t fast_end_write(MMCDriver *mmcp) {
+  uint8_t b[1];
+
+  spiReceive(mmcp->config->spip, 1, b);
+  if ((b[0] & 0x1F) != 0x05)
+    return CH_FAILED;
+  wait(mmcp);
+  return CH_SUCCESS;
+}
+
+/**
+ * @brief   Writes blocks within a sequential write operation.
+ * @details Each block is staged while the previous one is being sent.
+ *
+ * @param[in] mmcp      pointer to the @p MMCDriver object
+ * @param[in] buffer    pointer to the write buffer
+ * @param[in] n         number of blocks, at least one
+ * @return              The operation status.
+ * @retval CH_SUCCESS   the operation succeeded.
+ * @retval CH_FAILED    the operation failed.
+ *
+ * @notapi
+ */
+static bool_t fast_write_blocks(MMCDriver *mmcp,
+                                const uint8_t *buffer, uint32_t n) {
+  unsigned i = 0;
+
+  if (mmcp->state != BLK_WRITING)
+    return CH_FAILED;
+
+  fast_prepare_write(mmcp->buf[0], buffer);
+  while (n > 0) {
+    spiStartSend(mmcp->config->spip, MMCSD_BLOCK_SIZE + 4, mmcp->buf[i]);
+    if (--n > 0) {
+      buffer += MMCSD_BLOCK_SIZE;
+      fast_prepare_write(mmcp->buf[i ^ 1], buffer);
+    }
+    spi_wait(mmcp->config->spip);
+    if (fast_end_write(mmcp)) {
+      spiUnselect(mmcp->config->spip);
+      spiStop(mmcp->config->spip);
+      mmcp->state = BLK_READY;
+      return CH_FAILED;
+    }
+    i ^= 1;
+  }
+  return CH_SUCCESS;
+}
+#endif /* MMC_USE_FAST_PATH */
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -619,23 +902,47 @@ bool_t mmcStartSequentialRead(MMCDriver *mmcp, uint32_t startblk) {
  * @api
  */
 bool_t mmcSequentialRead(MMCDriver *mmcp, uint8_t *buffer) {
+#if MMC_USE_FAST_PATH
+  size_t offset;
+#else
   int i;
+#if MMC_USE_DATA_CRC
+  uint8_t crc[2];
+#endif
+#endif
 
   chDbgCheck((mmcp != NULL) && (buffer != NULL), "mmcSequentialRead");
 
   if (mmcp->state != BLK_READING)
     return CH_FAILED;
 
+#if MMC_USE_FAST_PATH
+  offset = fast_start_read(mmcp, mmcp->buf[0]);
+  if (offset != 0) {
+    spi_wait(mmcp->config->spip);
+    if (fast_end_read(mmcp->buf[0], offset, buffer) == CH_SUCCESS)
+      return CH_SUCCESS;
+  }
+#else
   for (i = 0; i < MMC_WAIT_DATA; i++) {
     spiReceive(mmcp->config->spip, 1, buffer);
     if (buffer[0] == 0xFE) {
       spiReceive(mmcp->config->spip, MMCSD_BLOCK_SIZE, buffer);
+#if MMC_USE_DATA_CRC
+      spiReceive(mmcp->config->spip, 2, crc);
+      if (crc16(0, buffer, MMCSD_BLOCK_SIZE) ==
+          (((uint16_t)crc[0] << 8) | crc[1]))
+        return CH_SUCCESS;
+      break;
+#else
       /* CRC ignored. */
       spiIgnore(mmcp->config->spip, 2);
       return CH_SUCCESS;
+#endif
     }
   }
-  /* Timeout.*/
+#endif
+  /* Timeout or CRC error.*/
   spiUnselect(mmcp->config->spip);
   spiStop(mmcp->config->spip);
   mmcp->state = BLK_READY;
@@ -723,22 +1030,42 @@ bool_t mmcStartSequentialWrite(MMCDriver *mmcp, uint32_t startblk) {
  * @api
  */
 bool_t mmcSequentialWrite(MMCDriver *mmcp, const uint8_t *buffer) {
+#if !MMC_USE_FAST_PATH
   static const uint8_t start[] = {0xFF, 0xFC};
-  uint8_t b[1];
+  uint8_t b[2];
+#if MMC_USE_DATA_CRC
+  uint16_t crc;
+#endif
+#endif
 
   chDbgCheck((mmcp != NULL) && (buffer != NULL), "mmcSequentialWrite");
 
   if (mmcp->state != BLK_WRITING)
     return CH_FAILED;
 
+#if MMC_USE_FAST_PATH
+  /* Prologue, data and CRC in a single operation.*/
+  fast_prepare_write(mmcp->buf[0], buffer);
+  spiSend(mmcp->config->spip, MMCSD_BLOCK_SIZE + 4, mmcp->buf[0]);
+  if (fast_end_write(mmcp) == CH_SUCCESS)
+    return CH_SUCCESS;
+#else
   spiSend(mmcp->config->spip, sizeof(start), start);    /* Data prologue.   */
   spiSend(mmcp->config->spip, MMCSD_BLOCK_SIZE, buffer);/* Data.            */
+#if MMC_USE_DATA_CRC
+  crc = crc16(0, buffer, MMCSD_BLOCK_SIZE);
+  b[0] = (uint8_t)(crc >> 8);
+  b[1] = (uint8_t)crc;
+  spiSend(mmcp->config->spip, 2, b);                    /* CRC.             */
+#else
   spiIgnore(mmcp->config->spip, 2);                     /* CRC ignored.     */
+#endif
   spiReceive(mmcp->config->spip, 1, b);
   if ((b[0] & 0x1F) == 0x05) {
     wait(mmcp);
     return CH_SUCCESS;
   }
+#endif
 
   /* Error.*/
   spiUnselect(mmcp->config->spip);
@@ -130,6 +130,9 @@ void sdcObjectInit(SDCDriver *sdcp) {
   sdcp->errors   = SDC_NO_ERROR;
   sdcp->config   = NULL;
   sdcp->capacity = 0;
+#if SDC_USE_ASYNC
+  chEvtInit(&sdcp->event);
+#endif
 }
 
 /**
@@ -434,6 +437,120 @@ bool_t sdcWrite(SDCDriver *sdcp, uint32_t startblk,
   return status;
 }
 
+#if SDC_USE_ASYNC || defined(__DOXYGEN__)
+/**
+ * @brief   Starts reading one or more blocks.
+ * @details The function returns as soon as the transfer is started, the
+ *          end of the transfer is signaled by the event source returned by
+ *          @p sdcGetEventSource().
+ * @pre     The driver must be in the @p BLK_READY state after a successful
+ *          sdcConnect() invocation.
+ * @post    The transfer must be completed by calling @p sdcWaitTransfer(),
+ *          the buffer must not be accessed before.
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ * @param[in] startblk  first block to read
+ * @param[out] buf      pointer to the read buffer
+ * @param[in] n         number of blocks to read
+ *
+ * @return              The operation status.
+ * @retval CH_SUCCESS   operation started.
+ * @retval CH_FAILED    operation failed, there is no transfer to complete.
+ *
+ * @api
+ */
+bool_t sdcStartRead(SDCDriver *sdcp, uint32_t startblk,
+                    uint8_t *buf, uint32_t n) {
+
+  chDbgCheck((sdcp != NULL) && (buf != NULL) && (n > 0), "sdcStartRead");
+  chDbgAssert(sdcp->state == BLK_READY, "sdcStartRead(), #1", "invalid state");
+
+  if ((startblk + n - 1) > sdcp->capacity){
+    sdcp->errors |= SDC_OVERFLOW_ERROR;
+    return CH_FAILED;
+  }
+
+  /* Read operation in progress until sdcWaitTransfer().*/
+  sdcp->state = BLK_READING;
+
+  if (sdc_lld_start_read(sdcp, startblk, buf, n)) {
+    sdcp->state = BLK_READY;
+    return CH_FAILED;
+  }
+  return CH_SUCCESS;
+}
+
+/**
+ * @brief   Starts writing one or more blocks.
+ * @details The function returns as soon as the transfer is started, the
+ *          end of the transfer is signaled by the event source returned by
+ *          @p sdcGetEventSource().
+ * @pre     The driver must be in the @p BLK_READY state after a successful
+ *          sdcConnect() invocation.
+ * @post    The transfer must be completed by calling @p sdcWaitTransfer(),
+ *          the buffer must not be modified before.
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ * @param[in] startblk  first block to write
+ * @param[in] buf       pointer to the write buffer
+ * @param[in] n         number of blocks to write
+ *
+ * @return              The operation status.
+ * @retval CH_SUCCESS   operation started.
+ * @retval CH_FAILED    operation failed, there is no transfer to complete.
+ *
+ * @api
+ */
+bool_t sdcStartWrite(SDCDriver *sdcp, uint32_t startblk,
+                     const uint8_t *buf, uint32_t n) {
+
+  chDbgCheck((sdcp != NULL) && (buf != NULL) && (n > 0), "sdcStartWrite");
+  chDbgAssert(sdcp->state == BLK_READY, "sdcStartWrite(), #1", "invalid state");
+
+  if ((startblk + n - 1) > sdcp->capacity){
+    sdcp->errors |= SDC_OVERFLOW_ERROR;
+    return CH_FAILED;
+  }
+
+  /* Write operation in progress until sdcWaitTransfer().*/
+  sdcp->state = BLK_WRITING;
+
+  if (sdc_lld_start_write(sdcp, startblk, buf, n)) {
+    sdcp->state = BLK_READY;
+    return CH_FAILED;
+  }
+  return CH_SUCCESS;
+}
+
+/**
+ * @brief   Completes a transfer started by @p sdcStartRead() or
+ *          @p sdcStartWrite().
+ * @details The function waits for the end of the transfer if it is still
+ *          in progress.
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ *
+ * @return              The transfer status.
+ * @retval CH_SUCCESS   transfer succeeded.
+ * @retval CH_FAILED    transfer failed.
+ *
+ * @api
+ */
+bool_t sdcWaitTransfer(SDCDriver *sdcp) {
+  bool_t status;
+
+  chDbgCheck(sdcp != NULL, "sdcWaitTransfer");
+  chDbgAssert((sdcp->state == BLK_READING) || (sdcp->state == BLK_WRITING),
+              "sdcWaitTransfer(), #1", "no transfer in progress");
+
+  status = sdc_lld_wait_transfer(sdcp);
+
+  /* Operation finished.*/
+  sdcp->state = BLK_READY;
+  return status;
+}
+#endif /* SDC_USE_ASYNC */
+
 /**
  * @brief   Returns the errors mask associated to the previous operation.
  *
@@ -261,6 +261,26 @@
 #if !defined(MMC_NICE_WAITING) || defined(__DOXYGEN__)
 #define MMC_NICE_WAITING            TRUE
 #endif
+
+/**
+ * @brief   Enables the fast transfers path.
+ * @details If enabled the data token and the card busy condition are
+ *          polled in windows of bytes, each block is transferred with its
+ *          CRC in a single operation and multiple blocks operations copy a
+ *          block while the next one is being transferred.
+ */
+#if !defined(MMC_USE_FAST_PATH) || defined(__DOXYGEN__)
+#define MMC_USE_FAST_PATH           FALSE
+#endif
+
+/**
+ * @brief   Enables the data blocks CRC.
+ * @details If enabled the CRC-16 of the read blocks is verified and the
+ *          written blocks carry a valid CRC-16.
+ */
+#if !defined(MMC_USE_DATA_CRC) || defined(__DOXYGEN__)
+#define MMC_USE_DATA_CRC            FALSE
+#endif
 /** @} */
 
 /*===========================================================================*/
@@ -296,6 +316,13 @@
 #if !defined(SDC_NICE_WAITING) || defined(__DOXYGEN__)
 #define SDC_NICE_WAITING            TRUE
 #endif
+
+/**
+ * @brief   Enables the asynchronous transfers API.
+ */
+#if !defined(SDC_USE_ASYNC) || defined(__DOXYGEN__)
+#define SDC_USE_ASYNC               FALSE
+#endif
 /** @} */
 
 /*===========================================================================*/
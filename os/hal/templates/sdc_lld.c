@@ -249,6 +249,81 @@ bool_t sdc_lld_send_cmd_long_crc(SDCDriver *sdcp, uint8_t cmd, uint32_t arg,
   return CH_SUCCESS;
 }
 
+#if SDC_USE_ASYNC || defined(__DOXYGEN__)
+/**
+ * @brief   Starts reading one or more blocks.
+ * @details The function returns once the transfer is started, the end of
+ *          the transfer is signaled by broadcasting @p sdcp->event.
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ * @param[in] startblk  first block to read
+ * @param[out] buf      pointer to the read buffer
+ * @param[in] n         number of blocks to read
+ *
+ * @return              The operation status.
+ * @retval CH_SUCCESS   operation started.
+ * @retval CH_FAILED    operation failed.
+ *
+ * @notapi
+ */
+bool_t sdc_lld_start_read(SDCDriver *sdcp, uint32_t startblk,
+                          uint8_t *buf, uint32_t n) {
+
+  (void)sdcp;
+  (void)startblk;
+  (void)buf;
+  (void)n;
+
+  return CH_SUCCESS;
+}
+
+/**
+ * @brief   Starts writing one or more blocks.
+ * @details The function returns once the transfer is started, the end of
+ *          the transfer is signaled by broadcasting @p sdcp->event.
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ * @param[in] startblk  first block to write
+ * @param[in] buf       pointer to the write buffer
+ * @param[in] n         number of blocks to write
+ *
+ * @return              The operation status.
+ * @retval CH_SUCCESS   operation started.
+ * @retval CH_FAILED    operation failed.
+ *
+ * @notapi
+ */
+bool_t sdc_lld_start_write(SDCDriver *sdcp, uint32_t startblk,
+                           const uint8_t *buf, uint32_t n) {
+
+  (void)sdcp;
+  (void)startblk;
+  (void)buf;
+  (void)n;
+
+  return CH_SUCCESS;
+}
+
+/**
+ * @brief   Waits for the end of a transfer started by
+ *          @p sdc_lld_start_read() or @p sdc_lld_start_write().
+ *
+ * @param[in] sdcp      pointer to the @p SDCDriver object
+ *
+ * @return              The transfer status.
+ * @retval CH_SUCCESS   transfer succeeded.
+ * @retval CH_FAILED    transfer failed.
+ *
+ * @notapi
+ */
+bool_t sdc_lld_wait_transfer(SDCDriver *sdcp) {
+
+  (void)sdcp;
+
+  return CH_SUCCESS;
+}
+#endif /* SDC_USE_ASYNC */
+
 /**
  * @brief   Reads one or more blocks.
  *
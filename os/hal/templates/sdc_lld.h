@@ -111,23 +111,7 @@ struct SDCDriver {
    * @brief Virtual Methods Table.
    */
   const struct SDCDriverVMT *vmt;
-  _mmcsd_block_device_data
-  /**
-   * @brief Current configuration data.
-   */
-  const SDCConfig           *config;
-  /**
-   * @brief Various flags regarding the mounted card.
-   */
-  sdcmode_t                 cardmode;
-  /**
-   * @brief Errors flags.
-   */
-  sdcflags_t                errors;
-  /**
-   * @brief Card RCA.
-   */
-  uint32_t                  rca;
+  _sdc_driver_data
   /* End of the mandatory fields.*/
 };
 
@@ -186,6 +170,13 @@ extern "C" {
                                     uint32_t *resp);
   bool_t sdc_lld_send_cmd_long_crc(SDCDriver *sdcp, uint8_t cmd, uint32_t arg,
                                    uint32_t *resp);
+#if SDC_USE_ASYNC
+  bool_t sdc_lld_start_read(SDCDriver *sdcp, uint32_t startblk,
+                            uint8_t *buf, uint32_t n);
+  bool_t sdc_lld_start_write(SDCDriver *sdcp, uint32_t startblk,
+                             const uint8_t *buf, uint32_t n);
+  bool_t sdc_lld_wait_transfer(SDCDriver *sdcp);
+#endif
   bool_t sdc_lld_read(SDCDriver *sdcp, uint32_t startblk,
                       uint8_t *buf, uint32_t n);
   bool_t sdc_lld_write(SDCDriver *sdcp, uint32_t startblk,
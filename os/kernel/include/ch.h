@@ -112,12 +112,14 @@
 #include "chmtx.h"
 #include "chcond.h"
 #include "chevents.h"
-#include "chmsg.h"
 #include "chmboxes.h"
 #include "chmemcore.h"
 #include "chheap.h"
 #include "chmempools.h"
+#include "chslab.h"
+#include "chtopics.h"
 #include "chthreads.h"
+#include "chmsg.h"
 #include "chdynamic.h"
 #include "chregistry.h"
 #include "chinline.h"
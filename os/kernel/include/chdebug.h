@@ -52,6 +52,25 @@
 #define CH_TRACE_BUFFER_SIZE        64
 #endif
 
+/**
+ * @brief   Events tracer buffer entries.
+ * @note    Must be a power of two.
+ */
+#ifndef CH_TRACE_EVENTS_SIZE
+#define CH_TRACE_EVENTS_SIZE        256
+#endif
+
+/**
+ * @brief   Events tracer initial recording mask.
+ * @note    The default records everything except the kernel lock and
+ *          unlock operations.
+ */
+#ifndef CH_TRACE_EVENTS_MASK
+#define CH_TRACE_EVENTS_MASK        (CH_TRACE_ALL &                         \
+                                     ~(CH_TRACE_MASK(CH_TRACE_LOCK) |       \
+                                       CH_TRACE_MASK(CH_TRACE_UNLOCK)))
+#endif
+
 /**
  * @brief   Fill value for thread stack area in debug mode.
  */
@@ -95,6 +114,20 @@
 #define dbg_leave_lock() (dbg_lock_cnt = 0)
 #endif
 
+/*===========================================================================*/
+/* Realtime counter.                                                         */
+/*===========================================================================*/
+
+/*
+ * Timestamp source of the events tracer and of the threads statistics, the
+ * port can provide a free running cycle counter, the system time is used
+ * otherwise.
+ */
+#if !defined(port_rt_get_counter_value) || defined(__DOXYGEN__)
+#define port_rt_get_counter_value() ((uint32_t)chTimeNow())
+#define port_rt_init()
+#endif
+
 /*===========================================================================*/
 /* Trace related structures and macros.                                      */
 /*===========================================================================*/
@@ -126,12 +159,173 @@ extern ch_trace_buffer_t dbg_trace_buffer;
 
 #endif /* CH_DBG_ENABLE_TRACE */
 
-#if !CH_DBG_ENABLE_TRACE
+#if CH_DBG_TRACE_EVENTS || defined(__DOXYGEN__)
+#if (CH_TRACE_EVENTS_SIZE & (CH_TRACE_EVENTS_SIZE - 1)) != 0
+#error "CH_TRACE_EVENTS_SIZE must be a power of two"
+#endif
+
+/**
+ * @name    Traced event types
+ * @{
+ */
+#define CH_TRACE_SWITCH         0   /**< @brief Context switch, the object
+                                         is the switched in thread, the info
+                                         is the switched out thread state.  */
+#define CH_TRACE_ISR_ENTER      1   /**< @brief ISR entry, the object is the
+                                         port specific ISR identifier.      */
+#define CH_TRACE_ISR_LEAVE      2   /**< @brief ISR exit.                   */
+#define CH_TRACE_LOCK           3   /**< @brief Kernel lock, the info is 1
+                                         from ISR context.                  */
+#define CH_TRACE_UNLOCK         4   /**< @brief Kernel unlock.              */
+#define CH_TRACE_SEM_WAIT       5   /**< @brief Semaphore wait.             */
+#define CH_TRACE_SEM_SIGNAL     6   /**< @brief Semaphore signal.           */
+#define CH_TRACE_MTX_LOCK       7   /**< @brief Mutex lock.                 */
+#define CH_TRACE_MTX_UNLOCK     8   /**< @brief Mutex unlock.               */
+#define CH_TRACE_EVT_SIGNAL     9   /**< @brief Events signaled to a thread.*/
+#define CH_TRACE_EVT_BROADCAST  10  /**< @brief Event source broadcast.     */
+#define CH_TRACE_EVT_WAIT       11  /**< @brief Events wait, the object is
+                                         the events mask.                   */
+#define CH_TRACE_MARKER         12  /**< @brief User marker, the info is the
+                                         marker identifier.                 */
+#define CH_TRACE_LOST           13  /**< @brief Records lost, the object is
+                                         the number of lost records.        */
+#define CH_TRACE_NAME           14  /**< @brief Thread name, the info is the
+                                         length of the name following the
+                                         record, only used in streams.      */
+/** @} */
+
+/**
+ * @brief   Recording mask of an event type.
+ */
+#define CH_TRACE_MASK(type)     (1U << (type))
+
+/**
+ * @brief   Recording mask of all the event types.
+ */
+#define CH_TRACE_ALL            0xFFFFFFFFU
+
+/**
+ * @brief   Events tracer record.
+ */
+typedef struct {
+  uint32_t              te_time;    /**< @brief Event timestamp.            */
+  uint32_t              te_obj;     /**< @brief Event object or value.      */
+  uint8_t               te_type;    /**< @brief Event type.                 */
+  uint8_t               te_info;    /**< @brief Event type dependent info.  */
+  uint16_t              te_seq;     /**< @brief Record sequence number, it
+                                         is written last and marks the
+                                         record as complete.                */
+} ch_trace_event_t;
+
+/**
+ * @brief   Events tracer ring buffer.
+ */
+typedef struct {
+  volatile uint32_t     tr_head;    /**< @brief Records written.            */
+  volatile uint32_t     tr_tail;    /**< @brief Records read.               */
+  volatile uint32_t     tr_lost;    /**< @brief Records lost.               */
+  uint32_t              tr_reported;/**< @brief Records lost already
+                                         reported to the reader.            */
+  uint32_t              tr_mask;    /**< @brief Recording mask.             */
+  bool_t                tr_stream;  /**< @brief Streaming mode, records are
+                                         dropped when the buffer is full
+                                         instead of being overwritten.      */
+  /** @brief Ring buffer.*/
+  ch_trace_event_t      tr_buffer[CH_TRACE_EVENTS_SIZE];
+} ch_trace_events_t;
+
+#if !defined(__DOXYGEN__)
+extern ch_trace_events_t dbg_trace_events;
+#endif
+
+/*
+ * ISR identifier, the port can provide the current exception number.
+ */
+#if !defined(port_trace_isr_id) || defined(__DOXYGEN__)
+#define port_trace_isr_id() 0
+#endif
+
+/**
+ * @name    Macro Functions
+ * @{
+ */
+/**
+ * @brief   Records a user marker.
+ *
+ * @param[in] id        marker identifier
+ * @param[in] value     marker value
+ *
+ * @special
+ */
+#define chDbgTraceMarker(id, value)                                         \
+  dbg_trace_event(CH_TRACE_MARKER, (uint8_t)(id), (uint32_t)(value))
+
+/**
+ * @brief   Changes the recording mask.
+ *
+ * @param[in] mask      recording mask, see @p CH_TRACE_MASK()
+ *
+ * @special
+ */
+#define chDbgTraceSetMask(mask) (dbg_trace_events.tr_mask = (mask))
+
+/**
+ * @brief   Enables or disables the streaming mode.
+ * @details In streaming mode the records are dropped when the buffer is
+ *          full, the buffer is meant to be drained using
+ *          @p chDbgTraceRead(). Outside streaming mode the oldest records
+ *          are overwritten, the buffer can be inspected post-mortem.
+ *
+ * @param[in] b         @p TRUE enables the streaming mode
+ *
+ * @special
+ */
+#define chDbgTraceSetStreaming(b) (dbg_trace_events.tr_stream = (b))
+/** @} */
+
+#define dbg_trace_event_obj(type, info, p)                                  \
+  dbg_trace_event(type, info, (uint32_t)(size_t)(p))
+#define dbg_trace_enter_isr()                                               \
+  dbg_trace_event(CH_TRACE_ISR_ENTER, 0, port_trace_isr_id())
+#define dbg_trace_leave_isr()                                               \
+  dbg_trace_event(CH_TRACE_ISR_LEAVE, 0, port_trace_isr_id())
+#define dbg_trace_lock()            dbg_trace_event(CH_TRACE_LOCK, 0, 0)
+#define dbg_trace_unlock()          dbg_trace_event(CH_TRACE_UNLOCK, 0, 0)
+#define dbg_trace_lock_from_isr()   dbg_trace_event(CH_TRACE_LOCK, 1, 0)
+#define dbg_trace_unlock_from_isr() dbg_trace_event(CH_TRACE_UNLOCK, 1, 0)
+#else /* !CH_DBG_TRACE_EVENTS */
+/* When the events tracer is disabled the hooks are replaced by empty
+   macros.*/
+#define chDbgTraceMarker(id, value)
+#define dbg_trace_event_obj(type, info, p)
+#define dbg_trace_enter_isr()
+#define dbg_trace_leave_isr()
+#define dbg_trace_lock()
+#define dbg_trace_unlock()
+#define dbg_trace_lock_from_isr()
+#define dbg_trace_unlock_from_isr()
+#endif /* !CH_DBG_TRACE_EVENTS */
+
+#if !CH_DBG_ENABLE_TRACE && !CH_DBG_TRACE_EVENTS
 /* When the trace feature is disabled this function is replaced by an empty
    macro.*/
 #define dbg_trace(otp)
 #endif
 
+/*===========================================================================*/
+/* Threads statistics related macros.                                        */
+/*===========================================================================*/
+
+#if CH_DBG_THREADS_STATISTICS || defined(__DOXYGEN__)
+#define dbg_stats_ready(tp)                                                 \
+  ((tp)->p_stats.ts_ready = port_rt_get_counter_value())
+#else
+/* When the statistics are disabled the hooks are replaced by empty
+   macros.*/
+#define dbg_stats_ready(tp)
+#define dbg_stats_switch(ntp, otp)
+#endif
+
 /*===========================================================================*/
 /* Parameters checking related macros.                                       */
 /*===========================================================================*/
@@ -230,10 +424,17 @@ extern "C" {
   void chDbgCheckClassI(void);
   void chDbgCheckClassS(void);
 #endif
-#if CH_DBG_ENABLE_TRACE || defined(__DOXYGEN__)
+#if CH_DBG_ENABLE_TRACE || CH_DBG_TRACE_EVENTS || defined(__DOXYGEN__)
   void _trace_init(void);
   void dbg_trace(Thread *otp);
 #endif
+#if CH_DBG_TRACE_EVENTS || defined(__DOXYGEN__)
+  void dbg_trace_event(uint8_t type, uint8_t info, uint32_t obj);
+  size_t chDbgTraceRead(ch_trace_event_t *buf, size_t n);
+#endif
+#if CH_DBG_THREADS_STATISTICS || defined(__DOXYGEN__)
+  void dbg_stats_switch(Thread *ntp, Thread *otp);
+#endif
 #if CH_DBG_ENABLED
   extern const char *dbg_panic_msg;
   void chDbgPanic(const char *msg);
@@ -42,6 +42,57 @@
 #error "CH_USE_HEAP requires CH_USE_MUTEXES and/or CH_USE_SEMAPHORES"
 #endif
 
+#if CH_USE_HEAP_TLSF || defined(__DOXYGEN__)
+/**
+ * @name    TLSF allocator parameters
+ * @{
+ */
+/**
+ * @brief   Log2 of the number of second level lists for each first level.
+ */
+#if !defined(HEAP_TLSF_SL_LOG2) || defined(__DOXYGEN__)
+#define HEAP_TLSF_SL_LOG2       3
+#endif
+
+/**
+ * @brief   Log2 of the largest size class managed by a TLSF heap.
+ * @note    Blocks must be smaller than 2^(HEAP_TLSF_MAX_LOG2+1) bytes.
+ */
+#if !defined(HEAP_TLSF_MAX_LOG2) || defined(__DOXYGEN__)
+#define HEAP_TLSF_MAX_LOG2      24
+#endif
+/** @} */
+
+/**
+ * @brief   Log2 of the allocation granularity.
+ */
+#define HEAP_TLSF_ALIGN_LOG2    (MEM_ALIGN_SIZE >= 16 ? 4 :                 \
+                                 MEM_ALIGN_SIZE >= 8 ? 3 : 2)
+
+/**
+ * @brief   Number of second level lists.
+ */
+#define HEAP_TLSF_SL            (1 << HEAP_TLSF_SL_LOG2)
+
+/**
+ * @brief   Number of first level lists.
+ * @details Blocks smaller than @p HEAP_TLSF_SL allocation units are
+ *          all in the first level zero, with exact size classes. The last
+ *          first level holds the sizes whose top bit is
+ *          @p HEAP_TLSF_MAX_LOG2.
+ */
+#define HEAP_TLSF_FL            (HEAP_TLSF_MAX_LOG2 - HEAP_TLSF_SL_LOG2 -    \
+                                 HEAP_TLSF_ALIGN_LOG2 + 2)
+
+#if (HEAP_TLSF_SL_LOG2 < 1) || (HEAP_TLSF_SL_LOG2 > 5)
+#error "HEAP_TLSF_SL_LOG2 must be within 1 and 5"
+#endif
+
+#if (HEAP_TLSF_MAX_LOG2 < HEAP_TLSF_SL_LOG2 + 4) || (HEAP_TLSF_MAX_LOG2 > 31)
+#error "HEAP_TLSF_MAX_LOG2 out of range"
+#endif
+#endif /* CH_USE_HEAP_TLSF */
+
 typedef struct memory_heap MemoryHeap;
 
 /**
@@ -55,16 +106,41 @@ union heap_header {
       MemoryHeap        *heap;      /**< @brief Block owner heap.           */
     } u;                            /**< @brief Overlapped fields.          */
     size_t              size;       /**< @brief Size of the memory block.   */
+#if CH_USE_HEAP_TLSF || defined(__DOXYGEN__)
+    union heap_header   *prev;      /**< @brief Previous block in free list,
+                                                free blocks only.           */
+    union heap_header   *phys;      /**< @brief Previous physical block or
+                                                @p NULL if first.           */
+#endif
   } h;
 };
 
+/**
+ * @brief   Heap status descriptor.
+ */
+typedef struct {
+  size_t                hs_fragments;/**< @brief Number of free blocks.     */
+  size_t                hs_free;    /**< @brief Total free space.           */
+  size_t                hs_largest; /**< @brief Size of the largest free
+                                                block.                      */
+} HeapStatus;
+
 /**
  * @brief   Structure describing a memory heap.
  */
 struct memory_heap {
   memgetfunc_t          h_provider; /**< @brief Memory blocks provider for
                                                 this heap.                  */
+#if !CH_USE_HEAP_TLSF || defined(__DOXYGEN__)
   union heap_header     h_free;     /**< @brief Free blocks list header.    */
+#endif
+#if CH_USE_HEAP_TLSF || defined(__DOXYGEN__)
+  uint32_t              h_flmap;    /**< @brief Non-empty first levels.     */
+  uint32_t              h_slmap[HEAP_TLSF_FL];
+                                    /**< @brief Non-empty second levels.    */
+  union heap_header     *h_lists[HEAP_TLSF_FL][HEAP_TLSF_SL];
+                                    /**< @brief Segregated free lists.      */
+#endif
 #if CH_USE_MUTEXES
   Mutex                 h_mtx;      /**< @brief Heap access mutex.          */
 #else
@@ -82,6 +158,7 @@ extern "C" {
   void *chHeapAlloc(MemoryHeap *heapp, size_t size);
   void chHeapFree(void *p);
   size_t chHeapStatus(MemoryHeap *heapp, size_t *sizep);
+  size_t chHeapGetStatus(MemoryHeap *heapp, HeapStatus *hsp);
 #ifdef __cplusplus
 }
 #endif
@@ -31,6 +31,24 @@
 
 #if CH_USE_MESSAGES || defined(__DOXYGEN__)
 
+#if CH_USE_MESSAGES_ASYNC || defined(__DOXYGEN__)
+/**
+ * @brief   Asynchronous message request.
+ * @details The request is queued in the receiver messages queue in place of
+ *          the sender thread, the receiver handles it using the normal
+ *          @p chMsgWait(), @p chMsgGet() and @p chMsgRelease() calls.
+ */
+typedef struct {
+  Thread                mr_proxy;       /**< @brief Proxy queued in place of
+                                                    the sender.             */
+  Thread                *mr_sender;     /**< @brief Sender thread.          */
+  Thread                *mr_waiting;    /**< @brief Thread waiting for the
+                                                    answer or @p NULL.      */
+  eventmask_t           mr_events;      /**< @brief Events signaled to the
+                                                    sender on answer.       */
+} MsgRequest;
+#endif /* CH_USE_MESSAGES_ASYNC */
+
 /**
  * @name    Macro Functions
  * @{
@@ -65,7 +83,31 @@
  *
  * @sclass
  */
+#if !CH_USE_MESSAGES_ASYNC || defined(__DOXYGEN__)
 #define chMsgReleaseS(tp, msg) chSchWakeupS(tp, msg)
+#endif
+
+#if CH_USE_MESSAGES_ASYNC || defined(__DOXYGEN__)
+/**
+ * @brief   Evaluates to TRUE if an asynchronous request has been answered.
+ *
+ * @param[in] mrp       pointer to a @p MsgRequest structure
+ *
+ * @iclass
+ */
+#define chMsgIsAnsweredI(mrp) ((mrp)->mr_proxy.p_state == THD_STATE_FINAL)
+
+/**
+ * @brief   Returns the answer to an asynchronous request.
+ * @pre     The request must have been answered.
+ *
+ * @param[in] mrp       pointer to a @p MsgRequest structure
+ * @return              The answer message from @p chMsgRelease().
+ *
+ * @api
+ */
+#define chMsgGetAnswer(mrp) ((mrp)->mr_proxy.p_u.rdymsg)
+#endif /* CH_USE_MESSAGES_ASYNC */
 /** @} */
 
 #ifdef __cplusplus
@@ -74,6 +116,12 @@ extern "C" {
   msg_t chMsgSend(Thread *tp, msg_t msg);
   Thread * chMsgWait(void);
   void chMsgRelease(Thread *tp, msg_t msg);
+#if CH_USE_MESSAGES_ASYNC
+  void chMsgReleaseS(Thread *tp, msg_t msg);
+  void chMsgSendAsync(Thread *tp, MsgRequest *mrp, msg_t msg,
+                      eventmask_t mask);
+  msg_t chMsgWaitAnswer(MsgRequest *mrp, systime_t time);
+#endif
 #ifdef __cplusplus
 }
 #endif
@@ -31,6 +31,10 @@
 
 #if CH_USE_QUEUES || defined(__DOXYGEN__)
 
+#if CH_QUEUES_CHUNK_SIZE < 1
+#error "invalid CH_QUEUES_CHUNK_SIZE value"
+#endif
+
 /**
  * @name    Queue functions returned status value
  * @{
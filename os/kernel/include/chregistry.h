@@ -119,6 +119,11 @@ extern "C" {
   extern ROMCONST chdebug_t ch_debug;
   Thread *chRegFirstThread(void);
   Thread *chRegNextThread(Thread *tp);
+#if CH_DBG_THREADS_STATISTICS
+  void chRegGetThreadStats(Thread *tp, ThreadStats *tsp);
+  void chRegResetThreadStats(Thread *tp);
+  size_t chRegGetStackHighWater(Thread *tp);
+#endif
 #ifdef __cplusplus
 }
 #endif
@@ -71,6 +71,21 @@
 #define TIME_INFINITE   ((systime_t)-1)
 /** @} */
 
+/**
+ * @name    Ready list bitmap constants
+ * @{
+ */
+/**
+ * @brief   Number of priority levels tracked by the ready list bitmap.
+ */
+#define RL_PRIO_LEVELS  (ABSPRIO + 1)
+
+/**
+ * @brief   Number of 32 bits words composing the ready list bitmap.
+ */
+#define RL_BITMAP_WORDS (RL_PRIO_LEVELS / 32)
+/** @} */
+
 /**
  * @brief   Returns the priority of the first thread on the given ready list.
  *
@@ -97,6 +112,16 @@ typedef struct {
   /* End of the fields shared with the Thread structure.*/
   Thread                *r_current; /**< @brief The currently running
                                                 thread.                     */
+#if CH_USE_READYLIST_BITMAP || defined(__DOXYGEN__)
+  uint32_t              r_summary;  /**< @brief Mask of the non-empty
+                                                @p r_bitmap words.          */
+  uint32_t              r_bitmap[RL_BITMAP_WORDS];
+                                    /**< @brief Mask of the non-empty
+                                                priority levels.            */
+  Thread                *r_heads[RL_PRIO_LEVELS];
+                                    /**< @brief First thread of each
+                                                non-empty priority level.   */
+#endif
 } ReadyList;
 #endif /* !defined(PORT_OPTIMIZED_READYLIST_STRUCT) */
 
@@ -136,6 +161,9 @@ extern "C" {
 #if !defined(PORT_OPTIMIZED_READYI)
   Thread *chSchReadyI(Thread *tp);
 #endif
+#if CH_USE_READYLIST_BITMAP
+  Thread *chSchDequeueI(Thread *tp, tprio_t prio);
+#endif
 #if !defined(PORT_OPTIMIZED_GOSLEEPS)
   void chSchGoSleepS(tstate_t newstate);
 #endif
@@ -168,6 +196,23 @@ extern "C" {
  * @name    Macro Functions
  * @{
  */
+/**
+ * @brief   Removes a thread from the ready list.
+ * @details The thread is removed regardless of its position in the ready
+ *          list, it is used when a ready thread must be re-enqueued because
+ *          a priority change.
+ *
+ * @param[in] tp        the thread to be removed from the ready list
+ * @param[in] prio      the priority the thread had when it was inserted in
+ *                      the ready list
+ * @return              The thread pointer.
+ *
+ * @iclass
+ */
+#if !CH_USE_READYLIST_BITMAP || defined(__DOXYGEN__)
+#define chSchDequeueI(tp, prio) ((void)(prio), dequeue(tp))
+#endif /* !CH_USE_READYLIST_BITMAP */
+
 /**
  * @brief   Determines if the current thread must reschedule.
  * @details This function returns @p TRUE if there is a ready thread with
@@ -0,0 +1,142 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006,2007,2008,2009,2010,
+                 2011,2012,2013 Giovanni Di Sirio.
+
+    This file is part of ChibiOS/RT.
+
+    ChibiOS/RT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    ChibiOS/RT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file    chslab.h
+ * @brief   Slab allocator macros and structures.
+ *
+ * @addtogroup slabs
+ * @{
+ */
+
+#ifndef _CHSLAB_H_
+#define _CHSLAB_H_
+
+#if CH_USE_SLABS || defined(__DOXYGEN__)
+
+/*
+ * Module dependencies check.
+ */
+#if !CH_USE_MEMPOOLS
+#error "CH_USE_SLABS requires CH_USE_MEMPOOLS"
+#endif
+
+typedef struct slab_class SlabClass;
+
+/**
+ * @brief   Slab object header.
+ * @details The header precedes each object and records the owner class
+ *          while the object is allocated.
+ */
+union slab_header {
+  stkalign_t            align;
+  SlabClass             *sh_class;      /**< @brief Owner class.            */
+};
+
+/**
+ * @brief   Slab size class descriptor.
+ */
+struct slab_class {
+  SlabClass             *sc_next;       /**< @brief Next larger class.      */
+  MemoryPool            sc_pool;        /**< @brief Objects of this class,
+                                                    headers included.       */
+  volatile uint32_t     sc_used;        /**< @brief Allocated objects.      */
+  volatile uint32_t     sc_hwm;         /**< @brief Allocated objects high
+                                                    water mark.             */
+};
+
+/**
+ * @brief   Slab allocator descriptor.
+ */
+typedef struct {
+  SlabClass             *sa_classes;    /**< @brief Classes list, ordered by
+                                                    increasing size.        */
+} SlabAllocator;
+
+/**
+ * @brief   Size of a slab object including its header.
+ *
+ * @param[in] size      usable size of the object
+ */
+#define SLAB_OBJECT_SIZE(size)                                              \
+  (sizeof(union slab_header) + MEM_ALIGN_NEXT(size))
+
+/**
+ * @brief   Declares a buffer for the objects of a slab class.
+ *
+ * @param[in] name      the name of the buffer variable
+ * @param[in] size      usable size of the objects
+ * @param[in] n         number of objects
+ */
+#define SLAB_BUFFER_DECL(name, size, n)                                     \
+  stkalign_t name[(SLAB_OBJECT_SIZE(size) * (n)) / sizeof(stkalign_t)]
+
+/**
+ * @name    Macro Functions
+ * @{
+ */
+/**
+ * @brief   Returns the usable size of the objects of a slab class.
+ *
+ * @param[in] scp       pointer to a @p SlabClass structure
+ *
+ * @special
+ */
+#define chSlabGetSize(scp)                                                  \
+  ((scp)->sc_pool.mp_object_size - sizeof(union slab_header))
+
+/**
+ * @brief   Returns the number of allocated objects of a slab class.
+ *
+ * @param[in] scp       pointer to a @p SlabClass structure
+ *
+ * @special
+ */
+#define chSlabGetUsed(scp) ((scp)->sc_used)
+
+/**
+ * @brief   Returns the allocated objects high water mark of a slab class.
+ *
+ * @param[in] scp       pointer to a @p SlabClass structure
+ *
+ * @special
+ */
+#define chSlabGetHighWater(scp) ((scp)->sc_hwm)
+/** @} */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void chSlabInit(SlabAllocator *sap);
+  void chSlabClassInit(SlabClass *scp, size_t size, void *p, size_t n);
+  void chSlabAddClass(SlabAllocator *sap, SlabClass *scp);
+  void *chSlabAllocI(SlabAllocator *sap, size_t size);
+  void *chSlabAlloc(SlabAllocator *sap, size_t size);
+  void chSlabFreeI(void *objp);
+  void chSlabFree(void *objp);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CH_USE_SLABS */
+
+#endif /* _CHSLAB_H_ */
+
+/** @} */
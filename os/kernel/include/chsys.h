@@ -80,6 +80,7 @@
  */
 #define chSysSwitch(ntp, otp) {                                             \
   dbg_trace(otp);                                                           \
+  dbg_stats_switch(ntp, otp);                                               \
   THREAD_CONTEXT_SWITCH_HOOK(ntp, otp);                                     \
   port_switch(ntp, otp);                                                    \
 }
@@ -135,6 +136,7 @@
 #define chSysLock()  {                                                      \
   port_lock();                                                              \
   dbg_check_lock();                                                         \
+  dbg_trace_lock();                                                         \
 }
 
 /**
@@ -143,6 +145,7 @@
  * @special
  */
 #define chSysUnlock() {                                                     \
+  dbg_trace_unlock();                                                       \
   dbg_check_unlock();                                                       \
   port_unlock();                                                            \
 }
@@ -162,6 +165,7 @@
 #define chSysLockFromIsr() {                                                \
   port_lock_from_isr();                                                     \
   dbg_check_lock_from_isr();                                                \
+  dbg_trace_lock_from_isr();                                                \
 }
 
 /**
@@ -178,6 +182,7 @@
  * @special
  */
 #define chSysUnlockFromIsr() {                                              \
+  dbg_trace_unlock_from_isr();                                              \
   dbg_check_unlock_from_isr();                                              \
   port_unlock_from_isr();                                                   \
 }
@@ -195,7 +200,8 @@
  */
 #define CH_IRQ_PROLOGUE()                                                   \
   PORT_IRQ_PROLOGUE();                                                      \
-  dbg_check_enter_isr();
+  dbg_check_enter_isr();                                                    \
+  dbg_trace_enter_isr();
 
 /**
  * @brief   IRQ handler exit code.
@@ -206,6 +212,7 @@
  * @special
  */
 #define CH_IRQ_EPILOGUE()                                                   \
+  dbg_trace_leave_isr();                                                    \
   dbg_check_leave_isr();                                                    \
   PORT_IRQ_EPILOGUE();
 
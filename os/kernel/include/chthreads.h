@@ -74,8 +74,34 @@
 #define THD_MEM_MODE_MEMPOOL    2   /**< @brief Thread allocated from a
                                          Memory Pool.                       */
 #define THD_TERMINATE           4   /**< @brief Termination requested flag. */
+#define THD_MSG_PROXY           8   /**< @brief Asynchronous message proxy,
+                                         not a real thread.                 */
 /** @} */
 
+#if CH_DBG_THREADS_STATISTICS || defined(__DOXYGEN__)
+/**
+ * @brief   Thread statistics.
+ * @details Times are expressed in realtime counter cycles, see
+ *          @p port_rt_get_counter_value().
+ */
+typedef struct {
+  uint64_t              ts_runtime; /**< @brief Accumulated run time, the
+                                         interrupts served in the thread
+                                         context are included.              */
+  uint32_t              ts_switches;/**< @brief Number of times the thread
+                                         has been switched in.              */
+  uint32_t              ts_maxlatency;/**< @brief Worst time between the
+                                         thread becoming ready and being
+                                         switched in.                       */
+  uint32_t              ts_ready;   /**< @brief Last time the thread became
+                                         ready.                             */
+  uint32_t              ts_last;    /**< @brief Last time the thread was
+                                         switched in.                       */
+  size_t                ts_stksize; /**< @brief Stack size, zero if not
+                                         known.                             */
+} ThreadStats;
+#endif
+
 /**
  * @extends ThreadsQueue
  *
@@ -134,6 +160,12 @@ struct Thread {
    * @note  This field can overflow.
    */
   volatile systime_t    p_time;
+#endif
+#if CH_DBG_THREADS_STATISTICS || defined(__DOXYGEN__)
+  /**
+   * @brief Thread statistics.
+   */
+  ThreadStats           p_stats;
 #endif
   /**
    * @brief State-specific fields.
@@ -0,0 +1,182 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006,2007,2008,2009,2010,
+                 2011,2012,2013 Giovanni Di Sirio.
+
+    This file is part of ChibiOS/RT.
+
+    ChibiOS/RT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    ChibiOS/RT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file    chtopics.h
+ * @brief   Publish/subscribe topics macros and structures.
+ *
+ * @addtogroup topics
+ * @{
+ */
+
+#ifndef _CHTOPICS_H_
+#define _CHTOPICS_H_
+
+#if CH_USE_TOPICS || defined(__DOXYGEN__)
+
+/*
+ * Module dependencies check.
+ */
+#if !CH_USE_MEMPOOLS
+#error "CH_USE_TOPICS requires CH_USE_MEMPOOLS"
+#endif
+#if !CH_USE_MAILBOXES
+#error "CH_USE_TOPICS requires CH_USE_MAILBOXES"
+#endif
+#if !CH_USE_EVENTS
+#error "CH_USE_TOPICS requires CH_USE_EVENTS"
+#endif
+
+/**
+ * @name    Subscriber overflow policies
+ * @{
+ */
+/** @brief The oldest queued message is discarded.*/
+#define TOPIC_DROP_OLDEST       0
+/** @brief The newly published message is discarded.*/
+#define TOPIC_DROP_NEWEST       1
+/** @} */
+
+typedef struct topic Topic;
+typedef struct topic_subscriber TopicSubscriber;
+
+/**
+ * @brief   Topic message header.
+ * @details The header precedes the payload of each message buffer.
+ */
+union topic_header {
+  stkalign_t            align;
+  struct {
+    Topic               *th_topic;      /**< @brief Owner topic.            */
+    cnt_t               th_refs;        /**< @brief References counter.     */
+  } h;
+};
+
+/**
+ * @brief   Topic subscriber structure.
+ */
+struct topic_subscriber {
+  TopicSubscriber       *ts_next;       /**< @brief Next subscriber of the
+                                                    same topic.             */
+  Topic                 *ts_topic;      /**< @brief Subscribed topic.       */
+  Mailbox               ts_mbox;        /**< @brief Pending messages queue. */
+  int                   ts_policy;      /**< @brief Overflow policy.        */
+  cnt_t                 ts_dropped;     /**< @brief Dropped messages
+                                                    counter.                */
+};
+
+/**
+ * @brief   Topic structure.
+ */
+struct topic {
+  TopicSubscriber       *t_subscribers; /**< @brief Subscribers list.       */
+  MemoryPool            t_pool;         /**< @brief Message buffers, headers
+                                                    included.               */
+  EventSource           t_event;        /**< @brief Broadcast on each
+                                                    publication.            */
+};
+
+/**
+ * @name    Macro Functions
+ * @{
+ */
+/**
+ * @brief   Size of a topic message buffer including its header.
+ *
+ * @param[in] size      payload size
+ */
+#define TOPIC_OBJECT_SIZE(size)                                             \
+  (sizeof(union topic_header) + MEM_ALIGN_NEXT(size))
+
+/**
+ * @brief   Declares a message buffers array for a topic.
+ *
+ * @param[in] name      name of the array
+ * @param[in] type      type of the topic payload
+ * @param[in] n         number of message buffers
+ */
+#define TOPIC_BUFFER_DECL(name, type, n)                                    \
+  stkalign_t name[(TOPIC_OBJECT_SIZE(sizeof(type)) * (n)) /                 \
+                  sizeof(stkalign_t)]
+
+/**
+ * @brief   Returns the payload size of a topic.
+ *
+ * @param[in] tp        pointer to a @p Topic structure
+ *
+ * @special
+ */
+#define chTopicGetSize(tp)                                                  \
+  ((tp)->t_pool.mp_object_size - sizeof(union topic_header))
+
+/**
+ * @brief   Returns the event source of a topic.
+ * @details The event source is broadcasted after each publication, it
+ *          allows a thread to wait on several topics at once.
+ *
+ * @param[in] tp        pointer to a @p Topic structure
+ *
+ * @special
+ */
+#define chTopicGetEventSource(tp) (&(tp)->t_event)
+
+/**
+ * @brief   Returns the number of messages pending for a subscriber.
+ *
+ * @param[in] tsp       pointer to a @p TopicSubscriber structure
+ *
+ * @iclass
+ */
+#define chTopicGetPendingI(tsp) chMBGetUsedCountI(&(tsp)->ts_mbox)
+
+/**
+ * @brief   Returns the number of messages dropped for a subscriber.
+ *
+ * @param[in] tsp       pointer to a @p TopicSubscriber structure
+ *
+ * @iclass
+ */
+#define chTopicGetDroppedI(tsp) ((tsp)->ts_dropped)
+/** @} */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void chTopicInit(Topic *tp, size_t size, void *p, size_t n);
+  void chTopicSubscribe(Topic *tp, TopicSubscriber *tsp,
+                        msg_t *buf, cnt_t n, int policy);
+  void chTopicUnsubscribe(TopicSubscriber *tsp);
+  void *chTopicBorrowI(Topic *tp);
+  void *chTopicBorrow(Topic *tp);
+  void chTopicPublishI(void *msgp);
+  void chTopicPublish(void *msgp);
+  void *chTopicReceiveI(TopicSubscriber *tsp);
+  void *chTopicReceive(TopicSubscriber *tsp, systime_t time);
+  void chTopicReleaseI(void *msgp);
+  void chTopicRelease(void *msgp);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CH_USE_TOPICS */
+
+#endif /* _CHTOPICS_H_ */
+
+/** @} */
@@ -29,6 +29,25 @@
 #ifndef _CHVT_H_
 #define _CHVT_H_
 
+#if CH_TIMEDELTA > 0
+#if CH_TIME_QUANTUM > 0
+#error "CH_TIME_QUANTUM not supported in tick-less mode"
+#endif
+#if CH_DBG_THREADS_PROFILING
+#error "CH_DBG_THREADS_PROFILING not supported in tick-less mode"
+#endif
+#endif /* CH_TIMEDELTA > 0 */
+
+#if CH_USE_TIMER_WHEEL
+#if CH_TIMEDELTA > 0
+#error "CH_USE_TIMER_WHEEL requires the periodic tick"
+#endif
+#if (CH_TIMER_WHEEL_SLOTS < 2) ||                                           \
+    ((CH_TIMER_WHEEL_SLOTS & (CH_TIMER_WHEEL_SLOTS - 1)) != 0)
+#error "CH_TIMER_WHEEL_SLOTS must be a power of two"
+#endif
+#endif /* CH_USE_TIMER_WHEEL */
+
 /**
  * @name    Time conversion utilities
  * @{
@@ -95,13 +114,40 @@ struct VirtualTimer {
                                                 list.                       */
   VirtualTimer          *vt_prev;   /**< @brief Previous timer in the delta
                                                 list.                       */
-  systime_t             vt_time;    /**< @brief Time delta before timeout.  */
+  systime_t             vt_time;    /**< @brief Time delta before timeout,
+                                                absolute expiration time
+                                                if the timer wheel is
+                                                used.                       */
   vtfunc_t              vt_func;    /**< @brief Timer callback function
                                                 pointer.                    */
   void                  *vt_par;    /**< @brief Timer callback function
                                                 parameter.                  */
 };
 
+#if CH_USE_TIMER_WHEEL || defined(__DOXYGEN__)
+/**
+ * @brief   Timer wheel slot header.
+ * @note    Layout compatible with the first two fields of
+ *          @p VirtualTimer.
+ */
+typedef struct {
+  VirtualTimer          *vt_next;   /**< @brief First timer in the slot.    */
+  VirtualTimer          *vt_prev;   /**< @brief Last timer in the slot.     */
+} VTSlot;
+
+/**
+ * @brief   Virtual timers wheel header.
+ * @details Timers are hashed on their absolute expiration time into
+ *          @p CH_TIMER_WHEEL_SLOTS unordered lists, arming and disarming
+ *          a timer are constant time operations, each tick scans the
+ *          only slot matching the current time.
+ */
+typedef struct {
+  VTSlot                vt_wheel[CH_TIMER_WHEEL_SLOTS];
+                                    /**< @brief Wheel slots.                */
+  volatile systime_t    vt_systime; /**< @brief System Time counter.        */
+} VTList;
+#else /* !CH_USE_TIMER_WHEEL */
 /**
  * @brief   Virtual timers list header.
  * @note    The delta list is implemented as a double link bidirectional list
@@ -114,8 +160,17 @@ typedef struct {
   VirtualTimer          *vt_prev;   /**< @brief Last timer in the delta
                                                 list.                       */
   systime_t             vt_time;    /**< @brief Must be initialized to -1.  */
+#if (CH_TIMEDELTA == 0) || defined(__DOXYGEN__)
   volatile systime_t    vt_systime; /**< @brief System Time counter.        */
+#endif
+#if (CH_TIMEDELTA > 0) || defined(__DOXYGEN__)
+  systime_t             vt_lasttime;/**< @brief System time of the last
+                                                processed event, the delta
+                                                of the first timer is
+                                                relative to this time.      */
+#endif
 } VTList;
+#endif /* !CH_USE_TIMER_WHEEL */
 
 /**
  * @name    Macro Functions
@@ -127,9 +182,13 @@ typedef struct {
  *          re-acquired immediately after. It is callback's responsibility
  *          to acquire the lock if needed. This is done in order to reduce
  *          interrupts jitter when many timers are in use.
+ * @note    In tick-less mode this is a function invoked from the alarm
+ *          interrupt instead of the periodic tick.
+ * @note    When the timer wheel is used this is a function.
  *
  * @iclass
  */
+#if ((CH_TIMEDELTA == 0) && !CH_USE_TIMER_WHEEL) || defined(__DOXYGEN__)
 #define chVTDoTickI() {                                                     \
   vtlist.vt_systime++;                                                      \
   if (&vtlist != (VTList *)vtlist.vt_next) {                                \
@@ -147,6 +206,7 @@ typedef struct {
     }                                                                       \
   }                                                                         \
 }
+#endif /* (CH_TIMEDELTA == 0) && !CH_USE_TIMER_WHEEL */
 
 /**
  * @brief   Returns @p TRUE if the specified timer is armed.
@@ -201,12 +261,18 @@ typedef struct {
  *          invocation.
  * @note    The counter can reach its maximum and then restart from zero.
  * @note    This function is designed to work with the @p chThdSleepUntil().
+ * @note    In tick-less mode the free running system timer counter is
+ *          read directly.
  *
  * @return              The system time in ticks.
  *
  * @api
  */
+#if (CH_TIMEDELTA == 0) || defined(__DOXYGEN__)
 #define chTimeNow() (vtlist.vt_systime)
+#else
+#define chTimeNow() port_timer_get_time()
+#endif
 
 /**
  * @brief   Returns the elapsed time since the specified start time.
@@ -246,6 +312,9 @@ extern "C" {
   void _vt_init(void);
   void chVTSetI(VirtualTimer *vtp, systime_t time, vtfunc_t vtfunc, void *par);
   void chVTResetI(VirtualTimer *vtp);
+#if (CH_TIMEDELTA > 0) || CH_USE_TIMER_WHEEL
+  void chVTDoTickI(void);
+#endif
 #ifdef __cplusplus
 }
 #endif
@@ -17,7 +17,9 @@ KERNSRC = ${CHIBIOS}/os/kernel/src/chsys.c \
           ${CHIBIOS}/os/kernel/src/chqueues.c \
           ${CHIBIOS}/os/kernel/src/chmemcore.c \
           ${CHIBIOS}/os/kernel/src/chheap.c \
-          ${CHIBIOS}/os/kernel/src/chmempools.c
+          ${CHIBIOS}/os/kernel/src/chmempools.c \
+          ${CHIBIOS}/os/kernel/src/chslab.c \
+          ${CHIBIOS}/os/kernel/src/chtopics.c
 
 # Required include directories
 KERNINC = ${CHIBIOS}/os/kernel/include
@@ -39,6 +39,7 @@
  *            - SV#11, misplaced S-class function.
  *            .
  *          - Trace buffer.
+ *          - Kernel events tracer.
  *          - Parameters check.
  *          - Kernel assertions.
  *          - Kernel panics.
@@ -214,15 +215,75 @@ void chDbgCheckClassS(void) {
  * @brief   Public trace buffer.
  */
 ch_trace_buffer_t dbg_trace_buffer;
+#endif
 
+#if CH_DBG_TRACE_EVENTS || defined(__DOXYGEN__)
+/**
+ * @brief   Public events tracer buffer.
+ */
+ch_trace_events_t dbg_trace_events;
+
+#if PORT_SUPPORTS_EXCLUSIVE || defined(__DOXYGEN__)
+/*
+ * Lock-free records reservation, the tracer hooks are invoked from within
+ * the kernel lock primitives and from ISRs so it cannot use a lock.
+ */
+static bool_t trace_reserve(uint32_t *idxp) {
+  uint32_t idx;
+
+  do {
+    idx = port_ldrex(&dbg_trace_events.tr_head);
+    if (dbg_trace_events.tr_stream &&
+        (idx - dbg_trace_events.tr_tail >= CH_TRACE_EVENTS_SIZE)) {
+      port_clrex();
+      do {
+        idx = port_ldrex(&dbg_trace_events.tr_lost);
+      } while (port_strex(&dbg_trace_events.tr_lost, idx + 1) != 0);
+      return FALSE;
+    }
+  } while (port_strex(&dbg_trace_events.tr_head, idx + 1) != 0);
+  *idxp = idx;
+  return TRUE;
+}
+#else /* !PORT_SUPPORTS_EXCLUSIVE */
+/*
+ * Without exclusive access support the reservation is not atomic, a record
+ * can be corrupted if an ISR preempts the reservation of another record.
+ */
+static bool_t trace_reserve(uint32_t *idxp) {
+  uint32_t idx = dbg_trace_events.tr_head;
+
+  if (dbg_trace_events.tr_stream &&
+      (idx - dbg_trace_events.tr_tail >= CH_TRACE_EVENTS_SIZE)) {
+    dbg_trace_events.tr_lost++;
+    return FALSE;
+  }
+  dbg_trace_events.tr_head = idx + 1;
+  *idxp = idx;
+  return TRUE;
+}
+#endif /* !PORT_SUPPORTS_EXCLUSIVE */
+#endif /* CH_DBG_TRACE_EVENTS */
+
+#if CH_DBG_ENABLE_TRACE || CH_DBG_TRACE_EVENTS || defined(__DOXYGEN__)
 /**
  * @brief   Trace circular buffer subsystem initialization.
  * @note    Internal use only.
  */
 void _trace_init(void) {
 
+#if CH_DBG_ENABLE_TRACE
   dbg_trace_buffer.tb_size = CH_TRACE_BUFFER_SIZE;
   dbg_trace_buffer.tb_ptr = &dbg_trace_buffer.tb_buffer[0];
+#endif
+#if CH_DBG_TRACE_EVENTS
+  dbg_trace_events.tr_head = 0;
+  dbg_trace_events.tr_tail = 0;
+  dbg_trace_events.tr_lost = 0;
+  dbg_trace_events.tr_reported = 0;
+  dbg_trace_events.tr_stream = FALSE;
+  dbg_trace_events.tr_mask = CH_TRACE_EVENTS_MASK;
+#endif
 }
 
 /**
@@ -234,6 +295,7 @@ void _trace_init(void) {
  */
 void dbg_trace(Thread *otp) {
 
+#if CH_DBG_ENABLE_TRACE
   dbg_trace_buffer.tb_ptr->se_time   = chTimeNow();
   dbg_trace_buffer.tb_ptr->se_tp     = currp;
   dbg_trace_buffer.tb_ptr->se_wtobjp = otp->p_u.wtobjp;
@@ -241,8 +303,118 @@ void dbg_trace(Thread *otp) {
   if (++dbg_trace_buffer.tb_ptr >=
       &dbg_trace_buffer.tb_buffer[CH_TRACE_BUFFER_SIZE])
     dbg_trace_buffer.tb_ptr = &dbg_trace_buffer.tb_buffer[0];
+#endif
+#if CH_DBG_TRACE_EVENTS
+  dbg_trace_event_obj(CH_TRACE_SWITCH, (uint8_t)otp->p_state, currp);
+#endif
+}
+#endif /* CH_DBG_ENABLE_TRACE || CH_DBG_TRACE_EVENTS */
+
+#if CH_DBG_THREADS_STATISTICS || defined(__DOXYGEN__)
+/**
+ * @brief   Updates the threads statistics on a context switch.
+ *
+ * @param[in] ntp       the thread being switched in
+ * @param[in] otp       the thread being switched out
+ *
+ * @notapi
+ */
+void dbg_stats_switch(Thread *ntp, Thread *otp) {
+  uint32_t now = port_rt_get_counter_value();
+  uint32_t latency = now - ntp->p_stats.ts_ready;
+
+  otp->p_stats.ts_runtime += now - otp->p_stats.ts_last;
+  ntp->p_stats.ts_last = now;
+  ntp->p_stats.ts_switches++;
+  if (latency > ntp->p_stats.ts_maxlatency)
+    ntp->p_stats.ts_maxlatency = latency;
+}
+#endif /* CH_DBG_THREADS_STATISTICS */
+
+#if CH_DBG_TRACE_EVENTS || defined(__DOXYGEN__)
+/**
+ * @brief   Inserts a record in the events tracer buffer.
+ * @note    This function can be invoked from any context, it does not use
+ *          the kernel lock.
+ *
+ * @param[in] type      event type
+ * @param[in] info      event type dependent info
+ * @param[in] obj       event object or value
+ *
+ * @notapi
+ */
+void dbg_trace_event(uint8_t type, uint8_t info, uint32_t obj) {
+  volatile ch_trace_event_t *tep;
+  uint32_t time, idx;
+
+  if ((dbg_trace_events.tr_mask & CH_TRACE_MASK(type)) == 0)
+    return;
+
+  time = port_rt_get_counter_value();
+  if (!trace_reserve(&idx))
+    return;
+  tep = &dbg_trace_events.tr_buffer[idx & (CH_TRACE_EVENTS_SIZE - 1)];
+  tep->te_time = time;
+  tep->te_obj  = obj;
+  tep->te_type = type;
+  tep->te_info = info;
+  /* The sequence number is written last, it commits the record.*/
+  tep->te_seq  = (uint16_t)(idx + 1);
+}
+
+/**
+ * @brief   Reads records from the events tracer buffer.
+ * @details The records are removed from the buffer, if records have been
+ *          lost since the previous invocation then a @p CH_TRACE_LOST
+ *          record is returned first.
+ * @note    Only a single reader is allowed, the buffer should be in
+ *          streaming mode, see @p chDbgTraceSetStreaming().
+ *
+ * @param[out] buf      pointer to the records buffer
+ * @param[in] n         maximum number of records to be read
+ * @return              The number of records read.
+ *
+ * @api
+ */
+size_t chDbgTraceRead(ch_trace_event_t *buf, size_t n) {
+  uint32_t head = dbg_trace_events.tr_head;
+  uint32_t tail = dbg_trace_events.tr_tail;
+  uint32_t lost;
+  size_t i = 0;
+
+  chDbgCheck((buf != NULL) && (n > 0), "chDbgTraceRead");
+
+  lost = dbg_trace_events.tr_lost - dbg_trace_events.tr_reported;
+  dbg_trace_events.tr_reported += lost;
+
+  /* Records overwritten outside streaming mode are accounted as lost.*/
+  if (head - tail > CH_TRACE_EVENTS_SIZE) {
+    lost += head - tail - CH_TRACE_EVENTS_SIZE;
+    tail = head - CH_TRACE_EVENTS_SIZE;
+  }
+
+  if (lost > 0) {
+    buf[i].te_time = port_rt_get_counter_value();
+    buf[i].te_obj  = lost;
+    buf[i].te_type = CH_TRACE_LOST;
+    buf[i].te_info = 0;
+    buf[i].te_seq  = 0;
+    i++;
+  }
+
+  while ((i < n) && (tail != head)) {
+    volatile ch_trace_event_t *tep;
+
+    tep = &dbg_trace_events.tr_buffer[tail & (CH_TRACE_EVENTS_SIZE - 1)];
+    if (tep->te_seq != (uint16_t)(tail + 1))
+      break;                    /* Record still being written.*/
+    buf[i++] = *tep;
+    tail++;
+  }
+  dbg_trace_events.tr_tail = tail;
+  return i;
 }
-#endif /* CH_DBG_ENABLE_TRACE */
+#endif /* CH_DBG_TRACE_EVENTS */
 
 /*===========================================================================*/
 /* Panic related code and variables.                                         */
@@ -179,6 +179,7 @@ void chEvtBroadcastFlagsI(EventSource *esp, flagsmask_t flags) {
 
   chDbgCheckClassI();
   chDbgCheck(esp != NULL, "chEvtBroadcastMaskI");
+  dbg_trace_event_obj(CH_TRACE_EVT_BROADCAST, 0, esp);
 
   elp = esp->es_next;
   while (elp != (EventListener *)esp) {
@@ -245,6 +246,7 @@ void chEvtSignalI(Thread *tp, eventmask_t mask) {
 
   chDbgCheckClassI();
   chDbgCheck(tp != NULL, "chEvtSignalI");
+  dbg_trace_event_obj(CH_TRACE_EVT_SIGNAL, 0, tp);
 
   tp->p_epending |= mask;
   /* Test on the AND/OR conditions wait states.*/
@@ -345,6 +347,7 @@ eventmask_t chEvtWaitOne(eventmask_t mask) {
   eventmask_t m;
 
   chSysLock();
+  dbg_trace_event_obj(CH_TRACE_EVT_WAIT, 0, mask);
 
   if ((m = (ctp->p_epending & mask)) == 0) {
     ctp->p_u.ewmask = mask;
@@ -374,6 +377,7 @@ eventmask_t chEvtWaitAny(eventmask_t mask) {
   eventmask_t m;
 
   chSysLock();
+  dbg_trace_event_obj(CH_TRACE_EVT_WAIT, 0, mask);
 
   if ((m = (ctp->p_epending & mask)) == 0) {
     ctp->p_u.ewmask = mask;
@@ -401,6 +405,7 @@ eventmask_t chEvtWaitAll(eventmask_t mask) {
   Thread *ctp = currp;
 
   chSysLock();
+  dbg_trace_event_obj(CH_TRACE_EVT_WAIT, 0, mask);
 
   if ((ctp->p_epending & mask) != mask) {
     ctp->p_u.ewmask = mask;
@@ -441,6 +446,7 @@ eventmask_t chEvtWaitOneTimeout(eventmask_t mask, systime_t time) {
   eventmask_t m;
 
   chSysLock();
+  dbg_trace_event_obj(CH_TRACE_EVT_WAIT, 0, mask);
 
   if ((m = (ctp->p_epending & mask)) == 0) {
     if (TIME_IMMEDIATE == time) {
@@ -484,6 +490,7 @@ eventmask_t chEvtWaitAnyTimeout(eventmask_t mask, systime_t time) {
   eventmask_t m;
 
   chSysLock();
+  dbg_trace_event_obj(CH_TRACE_EVT_WAIT, 0, mask);
 
   if ((m = (ctp->p_epending & mask)) == 0) {
     if (TIME_IMMEDIATE == time) {
@@ -524,6 +531,7 @@ eventmask_t chEvtWaitAllTimeout(eventmask_t mask, systime_t time) {
   Thread *ctp = currp;
 
   chSysLock();
+  dbg_trace_event_obj(CH_TRACE_EVT_WAIT, 0, mask);
 
   if ((ctp->p_epending & mask) != mask) {
     if (TIME_IMMEDIATE == time) {
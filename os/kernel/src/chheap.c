@@ -29,6 +29,11 @@
  *          are functionally equivalent to the usual @p malloc() and @p free()
  *          library functions. The main difference is that the OS heap APIs
  *          are guaranteed to be thread safe.<br>
+ *          By enabling the @p CH_USE_HEAP_TLSF option the first-fit free
+ *          list is replaced by a Two-Level Segregated Fit allocator, the
+ *          free blocks are kept in lists segregated by size and located
+ *          using bitmaps, allocation and release take a bounded constant
+ *          time regardless of the heap fragmentation.<br>
  *          By enabling the @p CH_USE_MALLOC_HEAP option the heap manager
  *          will use the runtime-provided @p malloc() and @p free() as
  *          back end for the heap APIs instead of the system provided
@@ -60,6 +65,153 @@
  */
 static MemoryHeap default_heap;
 
+#if CH_USE_HEAP_TLSF || defined(__DOXYGEN__)
+/*
+ * TLSF blocks layout. Each block header contains the payload size and a
+ * pointer to the previous physical block, the end of each memory area is
+ * marked by a zero sized allocated block. The lowest bit of the size field
+ * marks the free blocks, free blocks are also double linked in the list of
+ * their size class.
+ */
+#define HEAP_FREE           ((size_t)1)
+#define HSIZE(hp)           ((hp)->h.size & ~HEAP_FREE)
+#define ISFREE(hp)          (((hp)->h.size & HEAP_FREE) != 0)
+#define NEXTPHYS(hp)        ((union heap_header *)((uint8_t *)((hp) + 1) +  \
+                                                   HSIZE(hp)))
+#define HEAP_TLSF_SMALL     ((size_t)HEAP_TLSF_SL << HEAP_TLSF_ALIGN_LOG2)
+#define HEAP_TLSF_FITS(n)   (((n) >> (HEAP_TLSF_MAX_LOG2 + 1)) == 0)
+
+#if !defined(port_clz) || defined(__DOXYGEN__)
+/**
+ * @brief   Counts the leading zeros of a non-zero 32 bits word.
+ * @note    Ports can provide their own @p port_clz() macro, usually mapped on
+ *          a dedicated instruction.
+ */
+static INLINE unsigned tlsf_clz(uint32_t n) {
+  unsigned c = 0;
+
+  if ((n & 0xFFFF0000) == 0) {c += 16; n <<= 16;}
+  if ((n & 0xFF000000) == 0) {c += 8;  n <<= 8;}
+  if ((n & 0xF0000000) == 0) {c += 4;  n <<= 4;}
+  if ((n & 0xC0000000) == 0) {c += 2;  n <<= 2;}
+  if ((n & 0x80000000) == 0) {c += 1;}
+  return c;
+}
+#define port_clz(n) tlsf_clz(n)
+#endif /* !defined(port_clz) */
+
+#define tlsf_fls(n)         (31 - port_clz((uint32_t)(n)))
+#define tlsf_ffs(n)         tlsf_fls((n) & (0 - (n)))
+
+/*
+ * Size class of a block, sizes below HEAP_TLSF_SMALL are in the first level
+ * zero with one list for each allocation unit.
+ */
+static INLINE void tlsf_mapping(size_t size, unsigned *flp, unsigned *slp) {
+
+  if (size < HEAP_TLSF_SMALL) {
+    *flp = 0;
+    *slp = (unsigned)(size >> HEAP_TLSF_ALIGN_LOG2);
+  }
+  else {
+    unsigned f = tlsf_fls(size);
+
+    *flp = f - (HEAP_TLSF_SL_LOG2 + HEAP_TLSF_ALIGN_LOG2) + 1;
+    *slp = (unsigned)(size >> (f - HEAP_TLSF_SL_LOG2)) - HEAP_TLSF_SL;
+  }
+}
+
+/*
+ * Empties all the lists of a heap.
+ */
+static void tlsf_reset(MemoryHeap *heapp) {
+  unsigned fl, sl;
+
+  heapp->h_flmap = 0;
+  for (fl = 0; fl < HEAP_TLSF_FL; fl++) {
+    heapp->h_slmap[fl] = 0;
+    for (sl = 0; sl < HEAP_TLSF_SL; sl++)
+      heapp->h_lists[fl][sl] = NULL;
+  }
+}
+
+/*
+ * Marks a block as free and inserts it in the list of its size class.
+ */
+static void tlsf_insert(MemoryHeap *heapp, union heap_header *hp) {
+  union heap_header **headp;
+  unsigned fl, sl;
+
+  tlsf_mapping(HSIZE(hp), &fl, &sl);
+  headp = &heapp->h_lists[fl][sl];
+  hp->h.size |= HEAP_FREE;
+  hp->h.prev = NULL;
+  if ((hp->h.u.next = *headp) != NULL)
+    (*headp)->h.prev = hp;
+  *headp = hp;
+  heapp->h_slmap[fl] |= 1U << sl;
+  heapp->h_flmap |= 1U << fl;
+}
+
+/*
+ * Removes a free block from the list of its size class.
+ */
+static void tlsf_remove(MemoryHeap *heapp, union heap_header *hp) {
+  unsigned fl, sl;
+
+  hp->h.size &= ~HEAP_FREE;
+  if (hp->h.u.next != NULL)
+    hp->h.u.next->h.prev = hp->h.prev;
+  if (hp->h.prev != NULL) {
+    hp->h.prev->h.u.next = hp->h.u.next;
+    return;
+  }
+  tlsf_mapping(hp->h.size, &fl, &sl);
+  if ((heapp->h_lists[fl][sl] = hp->h.u.next) == NULL) {
+    if ((heapp->h_slmap[fl] &= ~(1U << sl)) == 0)
+      heapp->h_flmap &= ~(1U << fl);
+  }
+}
+
+/*
+ * Finds a free block of at least the specified size. The size is rounded
+ * up to the next size class so that any block in the first non-empty list
+ * is large enough, if that fails the head of the exact size class list is
+ * also checked.
+ */
+static union heap_header *tlsf_find(MemoryHeap *heapp, size_t size) {
+  union heap_header *hp;
+  size_t rsize = size;
+  uint32_t map;
+  unsigned fl, sl;
+
+  if (!HEAP_TLSF_FITS(size))
+    return NULL;
+
+  if (size >= HEAP_TLSF_SMALL)
+    rsize += ((size_t)1 << (tlsf_fls(size) - HEAP_TLSF_SL_LOG2)) - 1;
+  if (HEAP_TLSF_FITS(rsize)) {
+    tlsf_mapping(rsize, &fl, &sl);
+    map = heapp->h_slmap[fl] & (~0U << sl);
+    if (map == 0) {
+      map = heapp->h_flmap & (~0U << fl) & ~(1U << fl);
+      if (map != 0) {
+        fl = tlsf_ffs(map);
+        map = heapp->h_slmap[fl];
+      }
+    }
+    if (map != 0)
+      return heapp->h_lists[fl][tlsf_ffs(map)];
+  }
+
+  tlsf_mapping(size, &fl, &sl);
+  hp = heapp->h_lists[fl][sl];
+  if ((hp != NULL) && (HSIZE(hp) >= size))
+    return hp;
+  return NULL;
+}
+#endif /* CH_USE_HEAP_TLSF */
+
 /**
  * @brief   Initializes the default heap.
  *
@@ -67,8 +219,12 @@ static MemoryHeap default_heap;
  */
 void _heap_init(void) {
   default_heap.h_provider = chCoreAlloc;
+#if CH_USE_HEAP_TLSF
+  tlsf_reset(&default_heap);
+#else
   default_heap.h_free.h.u.next = (union heap_header *)NULL;
   default_heap.h_free.h.size = 0;
+#endif
 #if CH_USE_MUTEXES || defined(__DOXYGEN__)
   chMtxInit(&default_heap.h_mtx);
 #else
@@ -95,10 +251,25 @@ void chHeapInit(MemoryHeap *heapp, void *buf, size_t size) {
   chDbgCheck(MEM_IS_ALIGNED(buf) && MEM_IS_ALIGNED(size), "chHeapInit");
 
   heapp->h_provider = (memgetfunc_t)NULL;
+#if CH_USE_HEAP_TLSF
+  chDbgCheck(HEAP_TLSF_FITS(size) &&
+             (size >= 2 * sizeof(union heap_header)), "chHeapInit");
+
+  tlsf_reset(heapp);
+  hp = buf;
+  hp->h.size = size - 2 * sizeof(union heap_header);
+  hp->h.phys = NULL;
+  /* End marker, an allocated zero sized block.*/
+  NEXTPHYS(hp)->h.u.heap = heapp;
+  NEXTPHYS(hp)->h.size = 0;
+  NEXTPHYS(hp)->h.phys = hp;
+  tlsf_insert(heapp, hp);
+#else
   heapp->h_free.h.u.next = hp = buf;
   heapp->h_free.h.size = 0;
   hp->h.u.next = NULL;
   hp->h.size = size - sizeof(union heap_header);
+#endif
 #if CH_USE_MUTEXES || defined(__DOXYGEN__)
   chMtxInit(&heapp->h_mtx);
 #else
@@ -106,6 +277,150 @@ void chHeapInit(MemoryHeap *heapp, void *buf, size_t size) {
 #endif
 }
 
+#if CH_USE_HEAP_TLSF || defined(__DOXYGEN__)
+/**
+ * @brief   Allocates a block of memory from the heap by using the TLSF
+ *          algorithm.
+ * @details The allocated block is guaranteed to be properly aligned for a
+ *          pointer data type (@p stkalign_t).
+ *
+ * @param[in] heapp     pointer to a heap descriptor or @p NULL in order to
+ *                      access the default heap.
+ * @param[in] size      the size of the block to be allocated. Note that the
+ *                      allocated block may be a bit bigger than the requested
+ *                      size for alignment and fragmentation reasons.
+ * @return              A pointer to the allocated block.
+ * @retval NULL         if the block cannot be allocated.
+ *
+ * @api
+ */
+void *chHeapAlloc(MemoryHeap *heapp, size_t size) {
+  union heap_header *hp, *fp;
+
+  if (heapp == NULL)
+    heapp = &default_heap;
+
+  size = MEM_ALIGN_NEXT(size);
+  H_LOCK(heapp);
+
+  hp = tlsf_find(heapp, size);
+  if (hp != NULL) {
+    tlsf_remove(heapp, hp);
+    if (hp->h.size >= size + sizeof(union heap_header)) {
+      /* Block bigger enough, the remaining part goes back in the lists.*/
+      fp = (void *)((uint8_t *)(hp + 1) + size);
+      fp->h.size = hp->h.size - sizeof(union heap_header) - size;
+      fp->h.phys = hp;
+      NEXTPHYS(fp)->h.phys = fp;
+      hp->h.size = size;
+      tlsf_insert(heapp, fp);
+    }
+    hp->h.u.heap = heapp;
+
+    H_UNLOCK(heapp);
+    return (void *)(hp + 1);
+  }
+
+  H_UNLOCK(heapp);
+
+  /* More memory is required, tries to get it from the associated provider
+     else fails. The block is followed by its own end marker.*/
+  if (heapp->h_provider && HEAP_TLSF_FITS(size)) {
+    hp = heapp->h_provider(size + 2 * sizeof(union heap_header));
+    if (hp != NULL) {
+      hp->h.u.heap = heapp;
+      hp->h.size = size;
+      hp->h.phys = NULL;
+      fp = NEXTPHYS(hp);
+      fp->h.u.heap = heapp;
+      fp->h.size = 0;
+      fp->h.phys = hp;
+      return (void *)(hp + 1);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @brief   Frees a previously allocated memory block.
+ * @details The block is merged with its physical neighbors if they are free.
+ *
+ * @param[in] p         pointer to the memory block to be freed
+ *
+ * @api
+ */
+void chHeapFree(void *p) {
+  union heap_header *hp, *np;
+  MemoryHeap *heapp;
+
+  chDbgCheck(p != NULL, "chHeapFree");
+
+  hp = (union heap_header *)p - 1;
+  heapp = hp->h.u.heap;
+  H_LOCK(heapp);
+
+  chDbgAssert(!ISFREE(hp), "chHeapFree(), #1", "block already free");
+
+  np = NEXTPHYS(hp);
+  if (ISFREE(np)) {
+    /* Merge with the next block.*/
+    tlsf_remove(heapp, np);
+    hp->h.size += np->h.size + sizeof(union heap_header);
+    NEXTPHYS(hp)->h.phys = hp;
+  }
+  np = hp->h.phys;
+  if ((np != NULL) && ISFREE(np)) {
+    /* Merge with the previous block.*/
+    tlsf_remove(heapp, np);
+    np->h.size += hp->h.size + sizeof(union heap_header);
+    NEXTPHYS(np)->h.phys = np;
+    hp = np;
+  }
+  tlsf_insert(heapp, hp);
+
+  H_UNLOCK(heapp);
+}
+
+/**
+ * @brief   Reports the heap status and fragmentation.
+ * @note    This function scans all the free blocks, its execution time is
+ *          not bounded.
+ *
+ * @param[in] heapp     pointer to a heap descriptor or @p NULL in order to
+ *                      access the default heap.
+ * @param[out] hsp      pointer to a @p HeapStatus structure
+ * @return              The number of fragments in the heap.
+ *
+ * @api
+ */
+size_t chHeapGetStatus(MemoryHeap *heapp, HeapStatus *hsp) {
+  union heap_header *hp;
+  unsigned fl, sl;
+
+  chDbgCheck(hsp != NULL, "chHeapGetStatus");
+
+  if (heapp == NULL)
+    heapp = &default_heap;
+
+  H_LOCK(heapp);
+
+  hsp->hs_fragments = hsp->hs_free = hsp->hs_largest = 0;
+  for (fl = 0; fl < HEAP_TLSF_FL; fl++) {
+    for (sl = 0; sl < HEAP_TLSF_SL; sl++) {
+      for (hp = heapp->h_lists[fl][sl]; hp != NULL; hp = hp->h.u.next) {
+        hsp->hs_fragments++;
+        hsp->hs_free += HSIZE(hp);
+        if (HSIZE(hp) > hsp->hs_largest)
+          hsp->hs_largest = HSIZE(hp);
+      }
+    }
+  }
+
+  H_UNLOCK(heapp);
+  return hsp->hs_fragments;
+}
+
+#else /* !CH_USE_HEAP_TLSF */
 /**
  * @brief   Allocates a block of memory from the heap by using the first-fit
  *          algorithm.
@@ -225,6 +540,39 @@ void chHeapFree(void *p) {
   return;
 }
 
+/**
+ * @brief   Reports the heap status and fragmentation.
+ *
+ * @param[in] heapp     pointer to a heap descriptor or @p NULL in order to
+ *                      access the default heap.
+ * @param[out] hsp      pointer to a @p HeapStatus structure
+ * @return              The number of fragments in the heap.
+ *
+ * @api
+ */
+size_t chHeapGetStatus(MemoryHeap *heapp, HeapStatus *hsp) {
+  union heap_header *qp;
+
+  chDbgCheck(hsp != NULL, "chHeapGetStatus");
+
+  if (heapp == NULL)
+    heapp = &default_heap;
+
+  H_LOCK(heapp);
+
+  hsp->hs_fragments = hsp->hs_free = hsp->hs_largest = 0;
+  for (qp = heapp->h_free.h.u.next; qp != NULL; qp = qp->h.u.next) {
+    hsp->hs_fragments++;
+    hsp->hs_free += qp->h.size;
+    if (qp->h.size > hsp->hs_largest)
+      hsp->hs_largest = qp->h.size;
+  }
+
+  H_UNLOCK(heapp);
+  return hsp->hs_fragments;
+}
+#endif /* !CH_USE_HEAP_TLSF */
+
 /**
  * @brief   Reports the heap status.
  * @note    This function is meant to be used in the test suite, it should
@@ -241,22 +589,12 @@ void chHeapFree(void *p) {
  * @api
  */
 size_t chHeapStatus(MemoryHeap *heapp, size_t *sizep) {
-  union heap_header *qp;
-  size_t n, sz;
-
-  if (heapp == NULL)
-    heapp = &default_heap;
-
-  H_LOCK(heapp);
+  HeapStatus hs;
 
-  sz = 0;
-  for (n = 0, qp = &heapp->h_free; qp->h.u.next; n++, qp = qp->h.u.next)
-    sz += qp->h.u.next->h.size;
+  (void)chHeapGetStatus(heapp, &hs);
   if (sizep)
-    *sizep = sz;
-
-  H_UNLOCK(heapp);
-  return n;
+    *sizep = hs.hs_free;
+  return hs.hs_fragments;
 }
 
 #else /* CH_USE_MALLOC_HEAP */
@@ -311,6 +649,14 @@ size_t chHeapStatus(MemoryHeap *heapp, size_t *sizep) {
   return 0;
 }
 
+size_t chHeapGetStatus(MemoryHeap *heapp, HeapStatus *hsp) {
+
+  chDbgCheck((heapp == NULL) && (hsp != NULL), "chHeapGetStatus");
+
+  hsp->hs_fragments = hsp->hs_free = hsp->hs_largest = 0;
+  return 0;
+}
+
 #endif /* CH_USE_MALLOC_HEAP */
 
 #endif /* CH_USE_HEAP */
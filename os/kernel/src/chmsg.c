@@ -37,6 +37,12 @@
  *          Messages are usually processed in FIFO order but it is possible to
  *          process them in priority order by enabling the
  *          @p CH_USE_MESSAGES_PRIORITY option in @p chconf.h.<br>
+ *          If the @p CH_USE_MESSAGES_ASYNC option is enabled then messages
+ *          can also be sent without waiting for the answer, the sender
+ *          provides a @p MsgRequest structure that is queued in place of
+ *          the sender thread. A sender can have multiple outstanding
+ *          requests, the answer can be polled, waited for or notified
+ *          using an event mask.<br>
  * @pre     In order to use the message APIs the @p CH_USE_MESSAGES option
  *          must be enabled in @p chconf.h.
  * @post    Enabling messages requires 6-12 (depending on the architecture)
@@ -127,6 +133,120 @@ void chMsgRelease(Thread *tp, msg_t msg) {
   chSysUnlock();
 }
 
+#if CH_USE_MESSAGES_ASYNC || defined(__DOXYGEN__)
+/**
+ * @brief   Releases a sender thread specifying a response message.
+ * @details If the message has been sent asynchronously then the answer is
+ *          stored into the @p MsgRequest structure and the sender is
+ *          notified, else the sender thread is resumed.
+ * @pre     Invoke this function only after a message has been received
+ *          using @p chMsgWait().
+ *
+ * @param[in] tp        pointer to the thread
+ * @param[in] msg       message to be returned to the sender
+ *
+ * @sclass
+ */
+void chMsgReleaseS(Thread *tp, msg_t msg) {
+  MsgRequest *mrp;
+
+  chDbgCheckClassS();
+
+  if ((tp->p_flags & THD_MSG_PROXY) == 0) {
+    chSchWakeupS(tp, msg);
+    return;
+  }
+
+  /* The proxy is the first field of the request structure.*/
+  mrp = (MsgRequest *)tp;
+  tp->p_u.rdymsg = msg;
+  tp->p_state = THD_STATE_FINAL;
+#if CH_USE_EVENTS
+  if (mrp->mr_events != 0)
+    chEvtSignalI(mrp->mr_sender, mrp->mr_events);
+#endif
+  if (mrp->mr_waiting != NULL) {
+    chSchReadyI(mrp->mr_waiting)->p_u.rdymsg = RDY_OK;
+    mrp->mr_waiting = NULL;
+  }
+  chSchRescheduleS();
+}
+
+/**
+ * @brief   Sends a message to the specified thread without waiting.
+ * @details The request is queued into the receiver messages queue using the
+ *          sender priority, the answer can later be polled using
+ *          @p chMsgIsAnsweredI() or waited using @p chMsgWaitAnswer().
+ * @note    The request structure must not be reused or released until the
+ *          message has been answered.
+ * @note    The receiver sees a proxy thread structure in place of the
+ *          sender thread.
+ *
+ * @param[in] tp        the pointer to the thread
+ * @param[out] mrp      pointer to a @p MsgRequest structure
+ * @param[in] msg       the message
+ * @param[in] mask      events to be signaled to the sender when the message
+ *                      is answered, zero if not required, ignored if
+ *                      @p CH_USE_EVENTS is disabled
+ *
+ * @api
+ */
+void chMsgSendAsync(Thread *tp, MsgRequest *mrp, msg_t msg,
+                    eventmask_t mask) {
+  Thread *ctp = currp;
+
+  chDbgCheck((tp != NULL) && (mrp != NULL), "chMsgSendAsync");
+
+  mrp->mr_proxy.p_prio = ctp->p_prio;
+  mrp->mr_proxy.p_state = THD_STATE_SNDMSGQ;
+  mrp->mr_proxy.p_flags = THD_MSG_PROXY;
+  mrp->mr_proxy.p_msg = msg;
+  mrp->mr_proxy.p_u.wtobjp = &tp->p_msgqueue;
+  mrp->mr_sender = ctp;
+  mrp->mr_waiting = NULL;
+  mrp->mr_events = mask;
+
+  chSysLock();
+  msg_insert(&mrp->mr_proxy, &tp->p_msgqueue);
+  if (tp->p_state == THD_STATE_WTMSG)
+    chSchWakeupS(tp, RDY_OK);
+  chSysUnlock();
+}
+
+/**
+ * @brief   Waits for the answer to an asynchronous request.
+ *
+ * @param[in] mrp       pointer to a @p MsgRequest structure
+ * @param[in] time      the number of ticks before the operation timeouts,
+ *                      the following special values are allowed:
+ *                      - @a TIME_IMMEDIATE immediate timeout.
+ *                      - @a TIME_INFINITE no timeout.
+ *                      .
+ * @return              The answer message from @p chMsgRelease().
+ * @retval RDY_TIMEOUT  if the request has not been answered within the
+ *                      specified time, use @p chMsgIsAnsweredI() in order
+ *                      to distinguish it from an answer having the same
+ *                      value.
+ *
+ * @api
+ */
+msg_t chMsgWaitAnswer(MsgRequest *mrp, systime_t time) {
+  msg_t msg;
+
+  chDbgCheck(mrp != NULL, "chMsgWaitAnswer");
+
+  chSysLock();
+  if (!chMsgIsAnsweredI(mrp) && (time != TIME_IMMEDIATE)) {
+    mrp->mr_waiting = currp;
+    if (chSchGoSleepTimeoutS(THD_STATE_SUSPENDED, time) == RDY_TIMEOUT)
+      mrp->mr_waiting = NULL;
+  }
+  msg = chMsgIsAnsweredI(mrp) ? chMsgGetAnswer(mrp) : RDY_TIMEOUT;
+  chSysUnlock();
+  return msg;
+}
+#endif /* CH_USE_MESSAGES_ASYNC */
+
 #endif /* CH_USE_MESSAGES */
 
 /** @} */
@@ -116,6 +116,7 @@ void chMtxLockS(Mutex *mp) {
 
   chDbgCheckClassS();
   chDbgCheck(mp != NULL, "chMtxLockS");
+  dbg_trace_event_obj(CH_TRACE_MTX_LOCK, 0, mp);
 
   /* Is the mutex already locked? */
   if (mp->m_owner != NULL) {
@@ -126,6 +127,10 @@ void chMtxLockS(Mutex *mp) {
     /* Does the running thread have higher priority than the mutex
        owning thread? */
     while (tp->p_prio < ctp->p_prio) {
+      /* Previous priority of thread tp, required in order to remove it from
+         the ready list.*/
+      tprio_t prio = tp->p_prio;
+
       /* Make priority of thread tp match the running thread's priority.*/
       tp->p_prio = ctp->p_prio;
       /* The following states need priority queues reordering.*/
@@ -157,7 +162,7 @@ void chMtxLockS(Mutex *mp) {
         tp->p_state = THD_STATE_CURRENT;
 #endif
         /* Re-enqueues tp with its new priority on the ready list.*/
-        chSchReadyI(dequeue(tp));
+        chSchReadyI(chSchDequeueI(tp, prio));
         break;
       }
       break;
@@ -228,6 +233,7 @@ bool_t chMtxTryLockS(Mutex *mp) {
 
   chDbgCheckClassS();
   chDbgCheck(mp != NULL, "chMtxTryLockS");
+  dbg_trace_event_obj(CH_TRACE_MTX_LOCK, 1, mp);
 
   if (mp->m_owner != NULL)
     return FALSE;
@@ -258,6 +264,7 @@ Mutex *chMtxUnlock(void) {
   chDbgAssert(ctp->p_mtxlist->m_owner == ctp,
               "chMtxUnlock(), #2",
               "ownership failure");
+  dbg_trace_event_obj(CH_TRACE_MTX_UNLOCK, 0, ctp->p_mtxlist);
   /* Removes the top Mutex from the Thread's owned mutexes list and marks it
      as not owned.*/
   ump = ctp->p_mtxlist;
@@ -318,6 +325,7 @@ Mutex *chMtxUnlockS(void) {
   chDbgAssert(ctp->p_mtxlist->m_owner == ctp,
               "chMtxUnlockS(), #2",
               "ownership failure");
+  dbg_trace_event_obj(CH_TRACE_MTX_UNLOCK, 0, ctp->p_mtxlist);
 
   /* Removes the top Mutex from the owned mutexes list and marks it as not
      owned.*/
@@ -41,6 +41,8 @@
  * @{
  */
 
+#include <string.h>
+
 #include "ch.h"
 
 #if CH_USE_QUEUES || defined(__DOXYGEN__)
@@ -69,6 +71,76 @@ static msg_t qwait(GenericQueue *qp, systime_t time) {
   return chSchGoSleepTimeoutS(THD_STATE_WTQUEUE, time);
 }
 
+/**
+ * @brief   Copies a contiguous run of data out of an input queue.
+ * @details Up to @p n bytes, limited by the queue content and by
+ *          @p CH_QUEUES_CHUNK_SIZE, are copied using at most two
+ *          @p memcpy() invocations, one for each side of the buffer
+ *          wrap point.
+ *
+ * @param[in] iqp       pointer to an @p InputQueue structure
+ * @param[out] bp       pointer to the data buffer
+ * @param[in] n         the maximum amount of data to be transferred
+ * @return              The number of bytes transferred.
+ *
+ * @notapi
+ */
+static size_t iq_read(InputQueue *iqp, uint8_t *bp, size_t n) {
+  size_t s1;
+
+  if (n > (size_t)chQSpaceI(iqp))
+    n = (size_t)chQSpaceI(iqp);
+  if (n > CH_QUEUES_CHUNK_SIZE)
+    n = CH_QUEUES_CHUNK_SIZE;
+  s1 = (size_t)(iqp->q_top - iqp->q_rdptr);
+  if (n < s1) {
+    memcpy(bp, iqp->q_rdptr, n);
+    iqp->q_rdptr += n;
+  }
+  else {
+    memcpy(bp, iqp->q_rdptr, s1);
+    memcpy(bp + s1, iqp->q_buffer, n - s1);
+    iqp->q_rdptr = iqp->q_buffer + (n - s1);
+  }
+  iqp->q_counter -= (cnt_t)n;
+  return n;
+}
+
+/**
+ * @brief   Copies a contiguous run of data into an output queue.
+ * @details Up to @p n bytes, limited by the queue free space and by
+ *          @p CH_QUEUES_CHUNK_SIZE, are copied using at most two
+ *          @p memcpy() invocations, one for each side of the buffer
+ *          wrap point.
+ *
+ * @param[in] oqp       pointer to an @p OutputQueue structure
+ * @param[in] bp        pointer to the data buffer
+ * @param[in] n         the maximum amount of data to be transferred
+ * @return              The number of bytes transferred.
+ *
+ * @notapi
+ */
+static size_t oq_write(OutputQueue *oqp, const uint8_t *bp, size_t n) {
+  size_t s1;
+
+  if (n > (size_t)chQSpaceI(oqp))
+    n = (size_t)chQSpaceI(oqp);
+  if (n > CH_QUEUES_CHUNK_SIZE)
+    n = CH_QUEUES_CHUNK_SIZE;
+  s1 = (size_t)(oqp->q_top - oqp->q_wrptr);
+  if (n < s1) {
+    memcpy(oqp->q_wrptr, bp, n);
+    oqp->q_wrptr += n;
+  }
+  else {
+    memcpy(oqp->q_wrptr, bp, s1);
+    memcpy(oqp->q_buffer, bp + s1, n - s1);
+    oqp->q_wrptr = oqp->q_buffer + (n - s1);
+  }
+  oqp->q_counter -= (cnt_t)n;
+  return n;
+}
+
 /**
  * @brief   Initializes an input queue.
  * @details A Semaphore is internally initialized and works as a counter of
@@ -200,7 +272,10 @@ msg_t chIQGetTimeout(InputQueue *iqp, systime_t time) {
  *          been reset.
  * @note    The function is not atomic, if you need atomicity it is suggested
  *          to use a semaphore or a mutex for mutual exclusion.
- * @note    The callback is invoked before reading each character from the
+ * @note    Data is copied in chunks of up to @p CH_QUEUES_CHUNK_SIZE bytes,
+ *          the kernel lock is released between chunks in order to give
+ *          a preemption chance.
+ * @note    The callback is invoked before reading each chunk from the
  *          buffer or before entering the state @p THD_STATE_WTQUEUE.
  *
  * @param[in] iqp       pointer to an @p InputQueue structure
@@ -219,7 +294,7 @@ msg_t chIQGetTimeout(InputQueue *iqp, systime_t time) {
 size_t chIQReadTimeout(InputQueue *iqp, uint8_t *bp,
                        size_t n, systime_t time) {
   qnotify_t nfy = iqp->q_notify;
-  size_t r = 0;
+  size_t r = 0, done;
 
   chDbgCheck(n > 0, "chIQReadTimeout");
 
@@ -235,14 +310,13 @@ size_t chIQReadTimeout(InputQueue *iqp, uint8_t *bp,
       }
     }
 
-    iqp->q_counter--;
-    *bp++ = *iqp->q_rdptr++;
-    if (iqp->q_rdptr >= iqp->q_top)
-      iqp->q_rdptr = iqp->q_buffer;
+    done = iq_read(iqp, bp, n);
 
     chSysUnlock(); /* Gives a preemption chance in a controlled point.*/
-    r++;
-    if (--n == 0)
+    bp += done;
+    r += done;
+    n -= done;
+    if (n == 0)
       return r;
 
     chSysLock();
@@ -380,7 +454,10 @@ msg_t chOQGetI(OutputQueue *oqp) {
  *          been reset.
  * @note    The function is not atomic, if you need atomicity it is suggested
  *          to use a semaphore or a mutex for mutual exclusion.
- * @note    The callback is invoked after writing each character into the
+ * @note    Data is copied in chunks of up to @p CH_QUEUES_CHUNK_SIZE bytes,
+ *          the kernel lock is released between chunks in order to give
+ *          a preemption chance.
+ * @note    The callback is invoked after writing each chunk into the
  *          buffer.
  *
  * @param[in] oqp       pointer to an @p OutputQueue structure
@@ -399,7 +476,7 @@ msg_t chOQGetI(OutputQueue *oqp) {
 size_t chOQWriteTimeout(OutputQueue *oqp, const uint8_t *bp,
                         size_t n, systime_t time) {
   qnotify_t nfy = oqp->q_notify;
-  size_t w = 0;
+  size_t w = 0, done;
 
   chDbgCheck(n > 0, "chOQWriteTimeout");
 
@@ -411,17 +488,16 @@ size_t chOQWriteTimeout(OutputQueue *oqp, const uint8_t *bp,
         return w;
       }
     }
-    oqp->q_counter--;
-    *oqp->q_wrptr++ = *bp++;
-    if (oqp->q_wrptr >= oqp->q_top)
-      oqp->q_wrptr = oqp->q_buffer;
+    done = oq_write(oqp, bp, n);
 
     if (nfy)
       nfy(oqp);
 
     chSysUnlock(); /* Gives a preemption chance in a controlled point.*/
-    w++;
-    if (--n == 0)
+    bp += done;
+    w += done;
+    n -= done;
+    if (n == 0)
       return w;
     chSysLock();
   }
@@ -33,6 +33,9 @@
  *            in the system.
  *          - <b>Next</b>, returns the next, in creation order, active thread
  *            in the system.
+ *          - <b>Statistics</b>, returns the run time, switches count, worst
+ *            latency and stack usage of a thread, this requires the
+ *            @p CH_DBG_THREADS_STATISTICS option.
  *          .
  *          The registry is meant to be mainly a debug feature, for example,
  *          using the registry a debugger can enumerate the active threads
@@ -151,6 +154,82 @@ Thread *chRegNextThread(Thread *tp) {
   return ntp;
 }
 
+#if CH_DBG_THREADS_STATISTICS || defined(__DOXYGEN__)
+/**
+ * @brief   Returns a snapshot of the thread statistics.
+ * @details The run time of the current thread includes the time elapsed
+ *          since it was switched in.
+ *
+ * @param[in] tp        pointer to the thread
+ * @param[out] tsp      pointer to a @p ThreadStats structure
+ *
+ * @api
+ */
+void chRegGetThreadStats(Thread *tp, ThreadStats *tsp) {
+
+  chDbgCheck((tp != NULL) && (tsp != NULL), "chRegGetThreadStats");
+
+  chSysLock();
+  *tsp = tp->p_stats;
+  if (tp == currp)
+    tsp->ts_runtime += port_rt_get_counter_value() - tp->p_stats.ts_last;
+  chSysUnlock();
+}
+
+/**
+ * @brief   Resets the thread statistics.
+ * @details The run time, the switches count and the worst latency are
+ *          cleared, this allows to measure over a defined time window.
+ *
+ * @param[in] tp        pointer to the thread
+ *
+ * @api
+ */
+void chRegResetThreadStats(Thread *tp) {
+
+  chDbgCheck(tp != NULL, "chRegResetThreadStats");
+
+  chSysLock();
+  tp->p_stats.ts_runtime = 0;
+  tp->p_stats.ts_switches = 0;
+  tp->p_stats.ts_maxlatency = 0;
+  if (tp == currp)
+    tp->p_stats.ts_last = port_rt_get_counter_value();
+  chSysUnlock();
+}
+
+/**
+ * @brief   Returns the stack high-water mark of the thread.
+ * @details The unused part of the stack is found by scanning the stack
+ *          area, starting from its lower end, for the fill pattern.
+ * @pre     The thread stack must have been filled on creation, this
+ *          requires the @p CH_DBG_FILL_THREADS option.
+ *
+ * @param[in] tp        pointer to the thread
+ * @return              The maximum stack usage in bytes.
+ * @retval 0            if the stack size is not known, the main thread
+ *                      stack is not in its working area.
+ *
+ * @api
+ */
+size_t chRegGetStackHighWater(Thread *tp) {
+#if CH_DBG_FILL_THREADS
+  const uint8_t *p, *end;
+
+  chDbgCheck(tp != NULL, "chRegGetStackHighWater");
+
+  p = (const uint8_t *)(tp + 1);
+  end = p + tp->p_stats.ts_stksize;
+  while ((p < end) && (*p == CH_STACK_FILL_VALUE))
+    p++;
+  return (size_t)(end - p);
+#else
+  (void)tp;
+  return 0;
+#endif
+}
+#endif /* CH_DBG_THREADS_STATISTICS */
+
 #endif /* CH_USE_REGISTRY */
 
 /** @} */
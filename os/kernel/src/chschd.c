@@ -40,6 +40,90 @@
 ReadyList rlist;
 #endif /* !defined(PORT_OPTIMIZED_RLIST_VAR) */
 
+#if CH_USE_READYLIST_BITMAP || defined(__DOXYGEN__)
+/*
+ * The ready list is still a single priority ordered queue, each priority
+ * level is a contiguous FIFO segment of it. The bitmap records the non-empty
+ * levels and r_heads[] points to the first thread of each level so the
+ * insertion point is found in constant time instead of scanning the queue.
+ * The level NOPRIO is always marked and its head is the list header itself,
+ * this way a lower level always exists for any valid thread priority.
+ */
+
+#if !defined(port_clz) || defined(__DOXYGEN__)
+/**
+ * @brief   Counts the leading zeros of a non-zero 32 bits word.
+ * @note    Ports can provide their own @p port_clz() macro, usually mapped on
+ *          a dedicated instruction.
+ */
+static INLINE unsigned rl_clz(uint32_t n) {
+  unsigned c = 0;
+
+  if ((n & 0xFFFF0000) == 0) {c += 16; n <<= 16;}
+  if ((n & 0xFF000000) == 0) {c += 8;  n <<= 8;}
+  if ((n & 0xF0000000) == 0) {c += 4;  n <<= 4;}
+  if ((n & 0xC0000000) == 0) {c += 2;  n <<= 2;}
+  if ((n & 0x80000000) == 0) {c += 1;}
+  return c;
+}
+#define port_clz(n) rl_clz(n)
+#endif /* !defined(port_clz) */
+
+#define rl_word(prio)   ((prio) >> 5)
+#define rl_bit(prio)    (1U << ((prio) & 31))
+#define rl_isset(prio)  ((rlist.r_bitmap[rl_word(prio)] & rl_bit(prio)) != 0)
+
+/*
+ * Returns the highest non-empty priority level lower than the specified one.
+ */
+static INLINE tprio_t rl_lower(tprio_t prio) {
+  uint32_t w = rl_word(prio);
+  uint32_t m = rlist.r_bitmap[w] & (rl_bit(prio) - 1U);
+
+  if (m == 0) {
+    /* The NOPRIO level is always marked so a lower word always exists.*/
+    w = 31 - port_clz(rlist.r_summary & ((1U << w) - 1U));
+    m = rlist.r_bitmap[w];
+  }
+  return (tprio_t)((w << 5) + (31 - port_clz(m)));
+}
+
+/*
+ * Marks a priority level as non-empty.
+ */
+static INLINE void rl_set(tprio_t prio) {
+
+  rlist.r_bitmap[rl_word(prio)] |= rl_bit(prio);
+  rlist.r_summary |= 1U << rl_word(prio);
+}
+
+/*
+ * Updates the level of a thread that is leaving the ready list, the thread
+ * links must still point to its old neighbors.
+ */
+static INLINE void rl_leave(Thread *tp, tprio_t prio) {
+
+  if (rlist.r_heads[prio] == tp) {
+    if (tp->p_next->p_prio == prio)
+      rlist.r_heads[prio] = tp->p_next;
+    else if ((rlist.r_bitmap[rl_word(prio)] &= ~rl_bit(prio)) == 0)
+      rlist.r_summary &= ~(1U << rl_word(prio));
+  }
+}
+
+/*
+ * Removes the first thread from the ready list.
+ */
+static INLINE Thread *rl_fetch(void) {
+  Thread *tp = fifo_remove(&rlist.r_queue);
+
+  rl_leave(tp, tp->p_prio);
+  return tp;
+}
+#else /* !CH_USE_READYLIST_BITMAP */
+#define rl_fetch() fifo_remove(&rlist.r_queue)
+#endif /* !CH_USE_READYLIST_BITMAP */
+
 /**
  * @brief   Scheduler initialization.
  *
@@ -52,6 +136,10 @@ void _scheduler_init(void) {
 #if CH_USE_REGISTRY
   rlist.r_newer = rlist.r_older = (Thread *)&rlist;
 #endif
+#if CH_USE_READYLIST_BITMAP
+  rl_set(NOPRIO);
+  rlist.r_heads[NOPRIO] = (Thread *)&rlist.r_queue;
+#endif
 }
 
 /**
@@ -83,10 +171,20 @@ Thread *chSchReadyI(Thread *tp) {
               "invalid state");
 
   tp->p_state = THD_STATE_READY;
+  dbg_stats_ready(tp);
+#if CH_USE_READYLIST_BITMAP
+  /* The thread goes in front of the first thread having lower priority.*/
+  cp = rlist.r_heads[rl_lower(tp->p_prio)];
+  if (!rl_isset(tp->p_prio)) {
+    rl_set(tp->p_prio);
+    rlist.r_heads[tp->p_prio] = tp;
+  }
+#else /* !CH_USE_READYLIST_BITMAP */
   cp = (Thread *)&rlist.r_queue;
   do {
     cp = cp->p_next;
   } while (cp->p_prio >= tp->p_prio);
+#endif /* !CH_USE_READYLIST_BITMAP */
   /* Insertion on p_prev.*/
   tp->p_next = cp;
   tp->p_prev = cp->p_prev;
@@ -95,6 +193,29 @@ Thread *chSchReadyI(Thread *tp) {
 }
 #endif /* !defined(PORT_OPTIMIZED_READYI) */
 
+#if CH_USE_READYLIST_BITMAP || defined(__DOXYGEN__)
+/**
+ * @brief   Removes a thread from the ready list.
+ * @details The thread is removed regardless of its position in the ready
+ *          list, it is used when a ready thread must be re-enqueued because
+ *          a priority change.
+ *
+ * @param[in] tp        the thread to be removed from the ready list
+ * @param[in] prio      the priority the thread had when it was inserted in
+ *                      the ready list
+ * @return              The thread pointer.
+ *
+ * @iclass
+ */
+Thread *chSchDequeueI(Thread *tp, tprio_t prio) {
+
+  chDbgCheckClassI();
+
+  rl_leave(tp, prio);
+  return dequeue(tp);
+}
+#endif /* CH_USE_READYLIST_BITMAP */
+
 /**
  * @brief   Puts the current thread to sleep into the specified state.
  * @details The thread goes into a sleeping state. The possible
@@ -116,7 +237,7 @@ void chSchGoSleepS(tstate_t newstate) {
      time quantum when it will wakeup.*/
   otp->p_preempt = CH_TIME_QUANTUM;
 #endif
-  setcurrp(fifo_remove(&rlist.r_queue));
+  setcurrp(rl_fetch());
   currp->p_state = THD_STATE_CURRENT;
   chSysSwitch(currp, otp);
 }
@@ -230,6 +351,7 @@ void chSchWakeupS(Thread *ntp, msg_t msg) {
     Thread *otp = chSchReadyI(currp);
     setcurrp(ntp);
     ntp->p_state = THD_STATE_CURRENT;
+    dbg_stats_ready(ntp);
     chSysSwitch(ntp, otp);
   }
 }
@@ -299,7 +421,7 @@ void chSchDoRescheduleBehind(void) {
 
   otp = currp;
   /* Picks the first thread from the ready queue and makes it current.*/
-  setcurrp(fifo_remove(&rlist.r_queue));
+  setcurrp(rl_fetch());
   currp->p_state = THD_STATE_CURRENT;
 #if CH_TIME_QUANTUM > 0
   otp->p_preempt = CH_TIME_QUANTUM;
@@ -324,14 +446,27 @@ void chSchDoRescheduleAhead(void) {
 
   otp = currp;
   /* Picks the first thread from the ready queue and makes it current.*/
-  setcurrp(fifo_remove(&rlist.r_queue));
+  setcurrp(rl_fetch());
   currp->p_state = THD_STATE_CURRENT;
 
   otp->p_state = THD_STATE_READY;
+  dbg_stats_ready(otp);
+#if CH_USE_READYLIST_BITMAP
+  /* The thread goes in front of the first thread having the same or lower
+     priority and becomes the new head of its level.*/
+  if (rl_isset(otp->p_prio))
+    cp = rlist.r_heads[otp->p_prio];
+  else {
+    cp = rlist.r_heads[rl_lower(otp->p_prio)];
+    rl_set(otp->p_prio);
+  }
+  rlist.r_heads[otp->p_prio] = otp;
+#else /* !CH_USE_READYLIST_BITMAP */
   cp = (Thread *)&rlist.r_queue;
   do {
     cp = cp->p_next;
   } while (cp->p_prio > otp->p_prio);
+#endif /* !CH_USE_READYLIST_BITMAP */
   /* Insertion on p_prev.*/
   otp->p_next = cp;
   otp->p_prev = cp->p_prev;
@@ -183,6 +183,7 @@ msg_t chSemWaitS(Semaphore *sp) {
               ((sp->s_cnt < 0) && notempty(&sp->s_queue)),
               "chSemWaitS(), #1",
               "inconsistent semaphore");
+  dbg_trace_event_obj(CH_TRACE_SEM_WAIT, 0, sp);
 
   if (--sp->s_cnt < 0) {
     currp->p_u.wtobjp = sp;
@@ -248,6 +249,7 @@ msg_t chSemWaitTimeoutS(Semaphore *sp, systime_t time) {
               ((sp->s_cnt < 0) && notempty(&sp->s_queue)),
               "chSemWaitTimeoutS(), #1",
               "inconsistent semaphore");
+  dbg_trace_event_obj(CH_TRACE_SEM_WAIT, 0, sp);
 
   if (--sp->s_cnt < 0) {
     if (TIME_IMMEDIATE == time) {
@@ -277,6 +279,7 @@ void chSemSignal(Semaphore *sp) {
               "inconsistent semaphore");
 
   chSysLock();
+  dbg_trace_event_obj(CH_TRACE_SEM_SIGNAL, 0, sp);
   if (++sp->s_cnt <= 0)
     chSchWakeupS(fifo_remove(&sp->s_queue), RDY_OK);
   chSysUnlock();
@@ -301,6 +304,7 @@ void chSemSignalI(Semaphore *sp) {
               ((sp->s_cnt < 0) && notempty(&sp->s_queue)),
               "chSemSignalI(), #1",
               "inconsistent semaphore");
+  dbg_trace_event_obj(CH_TRACE_SEM_SIGNAL, 0, sp);
 
   if (++sp->s_cnt <= 0) {
     /* Note, it is done this way in order to allow a tail call on
@@ -328,6 +332,7 @@ void chSemAddCounterI(Semaphore *sp, cnt_t n) {
 
   chDbgCheckClassI();
   chDbgCheck((sp != NULL) && (n > 0), "chSemAddCounterI");
+  dbg_trace_event_obj(CH_TRACE_SEM_SIGNAL, 0, sp);
   chDbgAssert(((sp->s_cnt >= 0) && isempty(&sp->s_queue)) ||
               ((sp->s_cnt < 0) && notempty(&sp->s_queue)),
               "chSemAddCounterI(), #1",
@@ -370,6 +375,8 @@ msg_t chSemSignalWait(Semaphore *sps, Semaphore *spw) {
               "inconsistent semaphore");
 
   chSysLock();
+  dbg_trace_event_obj(CH_TRACE_SEM_SIGNAL, 0, sps);
+  dbg_trace_event_obj(CH_TRACE_SEM_WAIT, 0, spw);
   if (++sps->s_cnt <= 0)
     chSchReadyI(fifo_remove(&sps->s_queue))->p_u.rdymsg = RDY_OK;
   if (--spw->s_cnt < 0) {
@@ -0,0 +1,287 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006,2007,2008,2009,2010,
+                 2011,2012,2013 Giovanni Di Sirio.
+
+    This file is part of ChibiOS/RT.
+
+    ChibiOS/RT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    ChibiOS/RT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file    chslab.c
+ * @brief   Slab allocator code.
+ *
+ * @addtogroup slabs
+ * @details Variable size allocator built on memory pools.
+ *          <h2>Operation mode</h2>
+ *          A slab allocator is a list of size classes, each class is a
+ *          memory pool of fixed size objects. An allocation is served by
+ *          the smallest class able to contain the requested size, larger
+ *          classes are tried if that class is empty. Each object is
+ *          preceded by an header recording its class so objects are
+ *          released without specifying the size or the allocator.<br>
+ *          If the port supports exclusive access instructions
+ *          (@p PORT_SUPPORTS_EXCLUSIVE) the classes free lists and counters
+ *          are updated lock-free, objects can then be allocated and released
+ *          from any context, including interrupts above the kernel priority,
+ *          without entering a critical zone. Without exclusive access
+ *          support the I-class functions must be called from within a
+ *          critical zone like any other I-class function.<br>
+ *          Each class keeps the number of allocated objects and its high
+ *          water mark, these can be used for sizing the classes buffers.
+ * @pre     In order to use the slab allocator APIs the @p CH_USE_SLABS
+ *          option must be enabled in @p chconf.h.
+ * @{
+ */
+
+#include "ch.h"
+
+#if CH_USE_SLABS || defined(__DOXYGEN__)
+
+#if PORT_SUPPORTS_EXCLUSIVE || defined(__DOXYGEN__)
+/*
+ * Lock-free pool operations. The exclusive monitor is cleared by any
+ * exception entry or exit so an interleaved allocation or release makes
+ * the store fail and the operation is retried, this also protects the pop
+ * operation from the ABA problem.
+ */
+static void *slab_pop(MemoryPool *mp) {
+  volatile uint32_t *headp = (volatile uint32_t *)&mp->mp_next;
+  struct pool_header *php;
+
+  do {
+    php = (struct pool_header *)port_ldrex(headp);
+    if (php == NULL) {
+      port_clrex();
+      return NULL;
+    }
+  } while (port_strex(headp, (uint32_t)php->ph_next) != 0);
+  return php;
+}
+
+static void slab_push(MemoryPool *mp, void *objp) {
+  volatile uint32_t *headp = (volatile uint32_t *)&mp->mp_next;
+  struct pool_header *php = objp;
+
+  do {
+    php->ph_next = (struct pool_header *)port_ldrex(headp);
+  } while (port_strex(headp, (uint32_t)php) != 0);
+}
+
+static void slab_taken(SlabClass *scp) {
+  uint32_t n, hwm;
+
+  do {
+    n = port_ldrex(&scp->sc_used) + 1;
+  } while (port_strex(&scp->sc_used, n) != 0);
+  do {
+    hwm = port_ldrex(&scp->sc_hwm);
+    if (n <= hwm) {
+      port_clrex();
+      return;
+    }
+  } while (port_strex(&scp->sc_hwm, n) != 0);
+}
+
+static void slab_released(SlabClass *scp) {
+  uint32_t n;
+
+  do {
+    n = port_ldrex(&scp->sc_used) - 1;
+  } while (port_strex(&scp->sc_used, n) != 0);
+}
+#else /* !PORT_SUPPORTS_EXCLUSIVE */
+#define slab_pop(mp)            chPoolAllocI(mp)
+#define slab_push(mp, objp)     chPoolFreeI(mp, objp)
+
+static void slab_taken(SlabClass *scp) {
+
+  if (++scp->sc_used > scp->sc_hwm)
+    scp->sc_hwm = scp->sc_used;
+}
+
+#define slab_released(scp)      ((scp)->sc_used--)
+#endif /* !PORT_SUPPORTS_EXCLUSIVE */
+
+/**
+ * @brief   Initializes an empty slab allocator.
+ *
+ * @param[out] sap      pointer to a @p SlabAllocator structure
+ *
+ * @init
+ */
+void chSlabInit(SlabAllocator *sap) {
+
+  chDbgCheck(sap != NULL, "chSlabInit");
+
+  sap->sa_classes = NULL;
+}
+
+/**
+ * @brief   Initializes a slab class and loads it with an array of objects.
+ * @pre     The buffer must be aligned to the @p stkalign_t type size and
+ *          be large enough for @p n objects of @p SLAB_OBJECT_SIZE(size)
+ *          bytes, see @p SLAB_BUFFER_DECL().
+ *
+ * @param[out] scp      pointer to a @p SlabClass structure
+ * @param[in] size      usable size of the objects
+ * @param[in] p         pointer to the objects buffer
+ * @param[in] n         number of objects in the buffer
+ *
+ * @init
+ */
+void chSlabClassInit(SlabClass *scp, size_t size, void *p, size_t n) {
+
+  chDbgCheck((scp != NULL) && (p != NULL) && (n != 0) && MEM_IS_ALIGNED(p),
+             "chSlabClassInit");
+
+  scp->sc_next = NULL;
+  scp->sc_used = 0;
+  scp->sc_hwm = 0;
+  chPoolInit(&scp->sc_pool, SLAB_OBJECT_SIZE(size), NULL);
+  chPoolLoadArray(&scp->sc_pool, p, n);
+}
+
+/**
+ * @brief   Adds a size class to a slab allocator.
+ * @details The class is inserted in the list by increasing size.
+ * @note    Classes must be added before the allocator is used.
+ *
+ * @param[in] sap       pointer to a @p SlabAllocator structure
+ * @param[in] scp       pointer to an initialized @p SlabClass structure
+ *
+ * @init
+ */
+void chSlabAddClass(SlabAllocator *sap, SlabClass *scp) {
+  SlabClass **scpp;
+
+  chDbgCheck((sap != NULL) && (scp != NULL), "chSlabAddClass");
+
+  scpp = &sap->sa_classes;
+  while ((*scpp != NULL) &&
+         ((*scpp)->sc_pool.mp_object_size <= scp->sc_pool.mp_object_size))
+    scpp = &(*scpp)->sc_next;
+  scp->sc_next = *scpp;
+  *scpp = scp;
+}
+
+/**
+ * @brief   Allocates an object from a slab allocator.
+ * @details The object is taken from the smallest class able to contain the
+ *          requested size, if that class is empty the larger classes are
+ *          tried in order.
+ * @note    If the port supports exclusive access this function is lock-free
+ *          and can be called from any context without entering a critical
+ *          zone.
+ *
+ * @param[in] sap       pointer to a @p SlabAllocator structure
+ * @param[in] size      the size of the object to be allocated
+ * @return              The pointer to the allocated object.
+ * @retval NULL         if no suitable object is available.
+ *
+ * @iclass
+ */
+void *chSlabAllocI(SlabAllocator *sap, size_t size) {
+  SlabClass *scp;
+  union slab_header *shp;
+
+#if !PORT_SUPPORTS_EXCLUSIVE
+  chDbgCheckClassI();
+#endif
+  chDbgCheck(sap != NULL, "chSlabAllocI");
+
+  for (scp = sap->sa_classes; scp != NULL; scp = scp->sc_next) {
+    if (chSlabGetSize(scp) < size)
+      continue;
+    if ((shp = slab_pop(&scp->sc_pool)) != NULL) {
+      shp->sh_class = scp;
+      slab_taken(scp);
+      return (void *)(shp + 1);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @brief   Allocates an object from a slab allocator.
+ * @details The object is taken from the smallest class able to contain the
+ *          requested size, if that class is empty the larger classes are
+ *          tried in order.
+ *
+ * @param[in] sap       pointer to a @p SlabAllocator structure
+ * @param[in] size      the size of the object to be allocated
+ * @return              The pointer to the allocated object.
+ * @retval NULL         if no suitable object is available.
+ *
+ * @api
+ */
+void *chSlabAlloc(SlabAllocator *sap, size_t size) {
+  void *objp;
+
+#if PORT_SUPPORTS_EXCLUSIVE
+  objp = chSlabAllocI(sap, size);
+#else
+  chSysLock();
+  objp = chSlabAllocI(sap, size);
+  chSysUnlock();
+#endif
+  return objp;
+}
+
+/**
+ * @brief   Releases an object into its slab class.
+ * @note    If the port supports exclusive access this function is lock-free
+ *          and can be called from any context without entering a critical
+ *          zone.
+ *
+ * @param[in] objp      pointer to an object allocated from a slab allocator
+ *
+ * @iclass
+ */
+void chSlabFreeI(void *objp) {
+  union slab_header *shp;
+  SlabClass *scp;
+
+#if !PORT_SUPPORTS_EXCLUSIVE
+  chDbgCheckClassI();
+#endif
+  chDbgCheck(objp != NULL, "chSlabFreeI");
+
+  shp = (union slab_header *)objp - 1;
+  scp = shp->sh_class;
+  slab_released(scp);
+  slab_push(&scp->sc_pool, shp);
+}
+
+/**
+ * @brief   Releases an object into its slab class.
+ *
+ * @param[in] objp      pointer to an object allocated from a slab allocator
+ *
+ * @api
+ */
+void chSlabFree(void *objp) {
+
+#if PORT_SUPPORTS_EXCLUSIVE
+  chSlabFreeI(objp);
+#else
+  chSysLock();
+  chSlabFreeI(objp);
+  chSysUnlock();
+#endif
+}
+
+#endif /* CH_USE_SLABS */
+
+/** @} */
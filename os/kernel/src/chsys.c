@@ -81,6 +81,9 @@ void chSysInit(void) {
 #endif
 
   port_init();
+#if CH_DBG_TRACE_EVENTS || CH_DBG_THREADS_STATISTICS
+  port_rt_init();
+#endif
   _scheduler_init();
   _vt_init();
 #if CH_USE_MEMCORE
@@ -89,7 +92,7 @@ void chSysInit(void) {
 #if CH_USE_HEAP
   _heap_init();
 #endif
-#if CH_DBG_ENABLE_TRACE
+#if CH_DBG_ENABLE_TRACE || CH_DBG_TRACE_EVENTS
   _trace_init();
 #endif
 
@@ -100,6 +103,10 @@ void chSysInit(void) {
   /* This is a special case because the main thread Thread structure is not
      adjacent to its stack area.*/
   currp->p_stklimit = &__main_thread_stack_base__;
+#endif
+#if CH_DBG_THREADS_STATISTICS
+  /* The main thread stack size is not known.*/
+  currp->p_stats.ts_stksize = 0;
 #endif
   chSysEnable();
 
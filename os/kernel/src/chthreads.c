@@ -84,6 +84,12 @@ Thread *_thread_init(Thread *tp, tprio_t prio) {
 #if CH_DBG_THREADS_PROFILING
   tp->p_time = 0;
 #endif
+#if CH_DBG_THREADS_STATISTICS
+  tp->p_stats.ts_runtime = 0;
+  tp->p_stats.ts_switches = 0;
+  tp->p_stats.ts_maxlatency = 0;
+  tp->p_stats.ts_ready = tp->p_stats.ts_last = port_rt_get_counter_value();
+#endif
 #if CH_USE_DYNAMIC
   tp->p_refs = 1;
 #endif
@@ -158,6 +164,9 @@ Thread *chThdCreateI(void *wsp, size_t size,
              (prio <= HIGHPRIO) && (pf != NULL),
              "chThdCreateI");
   SETUP_CONTEXT(wsp, size, pf, arg);
+#if CH_DBG_THREADS_STATISTICS
+  tp->p_stats.ts_stksize = size - sizeof(Thread);
+#endif
   return _thread_init(tp, prio);
 }
 
@@ -0,0 +1,335 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006,2007,2008,2009,2010,
+                 2011,2012,2013 Giovanni Di Sirio.
+
+    This file is part of ChibiOS/RT.
+
+    ChibiOS/RT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    ChibiOS/RT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file    chtopics.c
+ * @brief   Publish/subscribe topics code.
+ *
+ * @addtogroup topics
+ * @details Zero-copy publish/subscribe services built on memory pools,
+ *          mailboxes and event sources.
+ *          <h2>Operation mode</h2>
+ *          A topic owns a pool of fixed size message buffers. A publisher
+ *          borrows a buffer from the topic, fills it and publishes it, the
+ *          buffer pointer is then posted into the mailbox of each
+ *          subscriber, no data is copied. Buffers are reference counted and
+ *          return to the pool when the last subscriber releases them.<br>
+ *          Each subscriber has its own bounded queue and an overflow policy,
+ *          when the queue is full either the oldest queued message or the
+ *          newly published message is discarded for that subscriber, a
+ *          publisher is never blocked by a slow subscriber.<br>
+ *          The topic event source is broadcasted after each publication,
+ *          this allows a thread to wait on multiple topics.
+ * @pre     In order to use the topics APIs the @p CH_USE_TOPICS option
+ *          must be enabled in @p chconf.h.
+ * @{
+ */
+
+#include "ch.h"
+
+#if CH_USE_TOPICS || defined(__DOXYGEN__)
+
+/**
+ * @brief   Initializes a topic.
+ * @note    The buffers array must be declared using
+ *          @p TOPIC_BUFFER_DECL().
+ *
+ * @param[out] tp       pointer to a @p Topic structure
+ * @param[in] size      size of the messages payload
+ * @param[in] p         pointer to the message buffers array
+ * @param[in] n         number of message buffers in the array
+ *
+ * @init
+ */
+void chTopicInit(Topic *tp, size_t size, void *p, size_t n) {
+
+  chDbgCheck((tp != NULL) && (size > 0) && (p != NULL) && (n > 0),
+             "chTopicInit");
+
+  tp->t_subscribers = NULL;
+  chPoolInit(&tp->t_pool, TOPIC_OBJECT_SIZE(size), NULL);
+  chPoolLoadArray(&tp->t_pool, p, n);
+  chEvtInit(&tp->t_event);
+}
+
+/**
+ * @brief   Subscribes to a topic.
+ *
+ * @param[in] tp        pointer to a @p Topic structure
+ * @param[out] tsp      pointer to a @p TopicSubscriber structure
+ * @param[in] buf       pointer to the subscriber queue buffer
+ * @param[in] n         number of elements in the queue buffer
+ * @param[in] policy    the policy applied when the queue is full:
+ *                      - @a TOPIC_DROP_OLDEST the oldest queued message is
+ *                        discarded.
+ *                      - @a TOPIC_DROP_NEWEST the published message is
+ *                        discarded.
+ *                      .
+ *
+ * @api
+ */
+void chTopicSubscribe(Topic *tp, TopicSubscriber *tsp,
+                      msg_t *buf, cnt_t n, int policy) {
+
+  chDbgCheck((tp != NULL) && (tsp != NULL) && (buf != NULL) && (n > 0) &&
+             ((policy == TOPIC_DROP_OLDEST) || (policy == TOPIC_DROP_NEWEST)),
+             "chTopicSubscribe");
+
+  chMBInit(&tsp->ts_mbox, buf, n);
+  tsp->ts_topic = tp;
+  tsp->ts_policy = policy;
+  tsp->ts_dropped = 0;
+  chSysLock();
+  tsp->ts_next = tp->t_subscribers;
+  tp->t_subscribers = tsp;
+  chSysUnlock();
+}
+
+/**
+ * @brief   Unsubscribes from a topic.
+ * @details The messages still queued for the subscriber are released.
+ * @pre     No thread must be waiting on the subscriber queue.
+ *
+ * @param[in] tsp       pointer to a @p TopicSubscriber structure
+ *
+ * @api
+ */
+void chTopicUnsubscribe(TopicSubscriber *tsp) {
+  TopicSubscriber **tspp;
+  void *msgp;
+
+  chDbgCheck(tsp != NULL, "chTopicUnsubscribe");
+
+  chSysLock();
+  tspp = &tsp->ts_topic->t_subscribers;
+  while (*tspp != tsp) {
+    chDbgAssert(*tspp != NULL,
+                "chTopicUnsubscribe(), #1",
+                "not subscribed");
+    tspp = &(*tspp)->ts_next;
+  }
+  *tspp = tsp->ts_next;
+  while ((msgp = chTopicReceiveI(tsp)) != NULL)
+    chTopicReleaseI(msgp);
+  chSysUnlock();
+}
+
+/**
+ * @brief   Borrows a message buffer from a topic.
+ * @details The returned buffer is owned by the caller until it is
+ *          published or released.
+ *
+ * @param[in] tp        pointer to a @p Topic structure
+ * @return              The pointer to the message payload.
+ * @retval NULL         if all the message buffers are in use.
+ *
+ * @iclass
+ */
+void *chTopicBorrowI(Topic *tp) {
+  union topic_header *thp;
+
+  chDbgCheckClassI();
+  chDbgCheck(tp != NULL, "chTopicBorrowI");
+
+  thp = chPoolAllocI(&tp->t_pool);
+  if (thp == NULL)
+    return NULL;
+  thp->h.th_topic = tp;
+  thp->h.th_refs = 1;
+  return thp + 1;
+}
+
+/**
+ * @brief   Borrows a message buffer from a topic.
+ * @details The returned buffer is owned by the caller until it is
+ *          published or released.
+ *
+ * @param[in] tp        pointer to a @p Topic structure
+ * @return              The pointer to the message payload.
+ * @retval NULL         if all the message buffers are in use.
+ *
+ * @api
+ */
+void *chTopicBorrow(Topic *tp) {
+  void *msgp;
+
+  chSysLock();
+  msgp = chTopicBorrowI(tp);
+  chSysUnlock();
+  return msgp;
+}
+
+/**
+ * @brief   Publishes a message.
+ * @details The message pointer is queued to all the topic subscribers and
+ *          the topic event source is broadcasted. The caller loses the
+ *          ownership of the buffer.
+ * @post    This function does not reschedule so a call to a rescheduling
+ *          function must be performed before unlocking the kernel. Note that
+ *          interrupt handlers always reschedule on exit so an explicit
+ *          reschedule must not be performed in ISRs.
+ *
+ * @param[in] msgp      pointer to a message borrowed using
+ *                      @p chTopicBorrow()
+ *
+ * @iclass
+ */
+void chTopicPublishI(void *msgp) {
+  union topic_header *thp;
+  TopicSubscriber *tsp;
+  Topic *tp;
+  msg_t msg;
+
+  chDbgCheckClassI();
+  chDbgCheck(msgp != NULL, "chTopicPublishI");
+
+  thp = (union topic_header *)msgp - 1;
+  tp = thp->h.th_topic;
+  for (tsp = tp->t_subscribers; tsp != NULL; tsp = tsp->ts_next) {
+    if (chMBGetFreeCountI(&tsp->ts_mbox) <= 0) {
+      tsp->ts_dropped++;
+      /* The oldest message cannot be fetched if it has already been taken
+         by a waiting subscriber thread, the new one is dropped instead.*/
+      if ((tsp->ts_policy == TOPIC_DROP_NEWEST) ||
+          (chMBFetchI(&tsp->ts_mbox, &msg) != RDY_OK))
+        continue;
+      chTopicReleaseI((void *)msg);
+    }
+    if (chMBPostI(&tsp->ts_mbox, (msg_t)msgp) == RDY_OK)
+      thp->h.th_refs++;
+  }
+  chEvtBroadcastI(&tp->t_event);
+
+  /* Publisher reference.*/
+  chTopicReleaseI(msgp);
+}
+
+/**
+ * @brief   Publishes a message.
+ * @details The message pointer is queued to all the topic subscribers and
+ *          the topic event source is broadcasted. The caller loses the
+ *          ownership of the buffer.
+ *
+ * @param[in] msgp      pointer to a message borrowed using
+ *                      @p chTopicBorrow()
+ *
+ * @api
+ */
+void chTopicPublish(void *msgp) {
+
+  chSysLock();
+  chTopicPublishI(msgp);
+  chSchRescheduleS();
+  chSysUnlock();
+}
+
+/**
+ * @brief   Receives a message without waiting.
+ * @details The caller owns a reference to the returned message, the
+ *          message must be released using @p chTopicRelease() when no
+ *          more needed.
+ *
+ * @param[in] tsp       pointer to a @p TopicSubscriber structure
+ * @return              The pointer to the message payload.
+ * @retval NULL         if the subscriber queue is empty.
+ *
+ * @iclass
+ */
+void *chTopicReceiveI(TopicSubscriber *tsp) {
+  msg_t msg;
+
+  chDbgCheckClassI();
+  chDbgCheck(tsp != NULL, "chTopicReceiveI");
+
+  if (chMBFetchI(&tsp->ts_mbox, &msg) != RDY_OK)
+    return NULL;
+  return (void *)msg;
+}
+
+/**
+ * @brief   Receives a message.
+ * @details The caller owns a reference to the returned message, the
+ *          message must be released using @p chTopicRelease() when no
+ *          more needed.
+ *
+ * @param[in] tsp       pointer to a @p TopicSubscriber structure
+ * @param[in] time      the number of ticks before the operation timeouts,
+ *                      the following special values are allowed:
+ *                      - @a TIME_IMMEDIATE immediate timeout.
+ *                      - @a TIME_INFINITE no timeout.
+ *                      .
+ * @return              The pointer to the message payload.
+ * @retval NULL         if the operation timed out or the queue has been
+ *                      reset.
+ *
+ * @api
+ */
+void *chTopicReceive(TopicSubscriber *tsp, systime_t time) {
+  msg_t msg;
+
+  chDbgCheck(tsp != NULL, "chTopicReceive");
+
+  if (chMBFetch(&tsp->ts_mbox, &msg, time) != RDY_OK)
+    return NULL;
+  return (void *)msg;
+}
+
+/**
+ * @brief   Releases a message reference.
+ * @details The message buffer is returned to its topic when the last
+ *          reference is released.
+ *
+ * @param[in] msgp      pointer to a message payload
+ *
+ * @iclass
+ */
+void chTopicReleaseI(void *msgp) {
+  union topic_header *thp;
+
+  chDbgCheckClassI();
+  chDbgCheck(msgp != NULL, "chTopicReleaseI");
+
+  thp = (union topic_header *)msgp - 1;
+  chDbgAssert(thp->h.th_refs > 0,
+              "chTopicReleaseI(), #1",
+              "not referenced");
+  if (--thp->h.th_refs == 0)
+    chPoolFreeI(&thp->h.th_topic->t_pool, thp);
+}
+
+/**
+ * @brief   Releases a message reference.
+ * @details The message buffer is returned to its topic when the last
+ *          reference is released.
+ *
+ * @param[in] msgp      pointer to a message payload
+ *
+ * @api
+ */
+void chTopicRelease(void *msgp) {
+
+  chSysLock();
+  chTopicReleaseI(msgp);
+  chSysUnlock();
+}
+
+#endif /* CH_USE_TOPICS */
+
+/** @} */
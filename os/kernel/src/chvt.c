@@ -34,6 +34,14 @@
  */
 VTList vtlist;
 
+#if CH_USE_TIMER_WHEEL || defined(__DOXYGEN__)
+/**
+ * @brief   Wheel slot of the specified absolute time.
+ */
+#define vt_slot(t)                                                          \
+  ((VirtualTimer *)&vtlist.vt_wheel[(t) & (CH_TIMER_WHEEL_SLOTS - 1)])
+#endif
+
 /**
  * @brief   Virtual Timers initialization.
  * @note    Internal use only.
@@ -41,10 +49,24 @@ VTList vtlist;
  * @notapi
  */
 void _vt_init(void) {
+#if CH_USE_TIMER_WHEEL
+  unsigned i;
 
+  for (i = 0; i < CH_TIMER_WHEEL_SLOTS; i++) {
+    VirtualTimer *slotp = vt_slot(i);
+
+    slotp->vt_next = slotp->vt_prev = slotp;
+  }
+  vtlist.vt_systime = 0;
+#else /* !CH_USE_TIMER_WHEEL */
   vtlist.vt_next = vtlist.vt_prev = (void *)&vtlist;
   vtlist.vt_time = (systime_t)-1;
+#if CH_TIMEDELTA == 0
   vtlist.vt_systime = 0;
+#else
+  vtlist.vt_lasttime = 0;
+#endif
+#endif /* !CH_USE_TIMER_WHEEL */
 }
 
 /**
@@ -75,6 +97,36 @@ void chVTSetI(VirtualTimer *vtp, systime_t time, vtfunc_t vtfunc, void *par) {
 
   vtp->vt_par = par;
   vtp->vt_func = vtfunc;
+#if CH_USE_TIMER_WHEEL
+  /* The timer is appended to the slot of its expiration time.*/
+  vtp->vt_time = vtlist.vt_systime + time;
+  p = vt_slot(vtp->vt_time);
+  vtp->vt_prev = (vtp->vt_next = p)->vt_prev;
+  vtp->vt_prev->vt_next = p->vt_prev = vtp;
+#else /* !CH_USE_TIMER_WHEEL */
+#if CH_TIMEDELTA > 0
+  {
+    systime_t now = port_timer_get_time();
+
+    /* An alarm closer than CH_TIMEDELTA could be missed by the hardware.*/
+    if (time < CH_TIMEDELTA)
+      time = CH_TIMEDELTA;
+
+    if (&vtlist == (VTList *)vtlist.vt_next) {
+      /* The delta list is empty, the current time becomes the new list
+         base time and the alarm is started.*/
+      vtlist.vt_lasttime = now;
+      port_timer_start_alarm(now + time);
+    }
+    else {
+      /* The delay is made relative to the list base time, if the new timer
+         expires before the first one then the alarm is moved earlier.*/
+      time += now - vtlist.vt_lasttime;
+      if (time < vtlist.vt_next->vt_time)
+        port_timer_set_alarm(vtlist.vt_lasttime + time);
+    }
+  }
+#endif /* CH_TIMEDELTA > 0 */
   p = vtlist.vt_next;
   while (p->vt_time < time) {
     time -= p->vt_time;
@@ -86,6 +138,7 @@ void chVTSetI(VirtualTimer *vtp, systime_t time, vtfunc_t vtfunc, void *par) {
   vtp->vt_time = time;
   if (p != (void *)&vtlist)
     p->vt_time -= time;
+#endif /* !CH_USE_TIMER_WHEEL */
 }
 
 /**
@@ -104,11 +157,146 @@ void chVTResetI(VirtualTimer *vtp) {
               "chVTResetI(), #1",
               "timer not set or already triggered");
 
+#if !CH_USE_TIMER_WHEEL
   if (vtp->vt_next != (void *)&vtlist)
     vtp->vt_next->vt_time += vtp->vt_time;
+#endif
   vtp->vt_prev->vt_next = vtp->vt_next;
   vtp->vt_next->vt_prev = vtp->vt_prev;
   vtp->vt_func = (vtfunc_t)NULL;
+
+#if CH_TIMEDELTA > 0
+  /* Removing a timer that is not the first does not affect the alarm.*/
+  if (vtp->vt_prev != (void *)&vtlist)
+    return;
+
+  /* If the list became empty then the alarm is stopped.*/
+  if (&vtlist == (VTList *)vtlist.vt_next) {
+    port_timer_stop_alarm();
+    return;
+  }
+
+  /* If the new first timer already expired then the alarm interrupt is
+     already pending, else the alarm is moved to its expiration time.*/
+  {
+    systime_t now = port_timer_get_time();
+    systime_t nowdelta = now - vtlist.vt_lasttime;
+
+    if (nowdelta < vtlist.vt_next->vt_time) {
+      systime_t delta = vtlist.vt_next->vt_time - nowdelta;
+
+      if (delta < CH_TIMEDELTA)
+        delta = CH_TIMEDELTA;
+      port_timer_set_alarm(now + delta);
+    }
+  }
+#endif /* CH_TIMEDELTA > 0 */
+}
+
+#if (CH_TIMEDELTA > 0) || defined(__DOXYGEN__)
+/**
+ * @brief   Virtual timers alarm handler.
+ * @details All the timers expired since the last alarm are triggered then
+ *          the alarm is programmed for the next timer in the list, if any.
+ * @note    The system lock is released before entering the callback and
+ *          re-acquired immediately after. It is callback's responsibility
+ *          to acquire the lock if needed. This is done in order to reduce
+ *          interrupts jitter when many timers are in use.
+ * @note    The loop is stopped by the list header having a delta of
+ *          @p (systime_t)-1, greater than any possible time window.
+ *
+ * @iclass
+ */
+void chVTDoTickI(void) {
+  VirtualTimer *vtp;
+  systime_t now, delta;
+
+  chDbgCheckClassI();
+
+  vtp = vtlist.vt_next;
+  now = port_timer_get_time();
+  while (vtp->vt_time <= (systime_t)(now - vtlist.vt_lasttime)) {
+    vtfunc_t fn = vtp->vt_func;
+
+    /* The list base time becomes the expiration time of this timer.*/
+    vtlist.vt_lasttime += vtp->vt_time;
+    vtp->vt_func = (vtfunc_t)NULL;
+    vtp->vt_next->vt_prev = (void *)&vtlist;
+    vtlist.vt_next = vtp->vt_next;
+    if (&vtlist == (VTList *)vtlist.vt_next)
+      port_timer_stop_alarm();
+    chSysUnlockFromIsr();
+    fn(vtp->vt_par);
+    chSysLockFromIsr();
+
+    /* The callback could have taken time, the window is recalculated.*/
+    vtp = vtlist.vt_next;
+    now = port_timer_get_time();
+  }
+
+  if (&vtlist == (VTList *)vtlist.vt_next)
+    return;
+
+  /* Next alarm, not closer than CH_TIMEDELTA ticks from now.*/
+  delta = vtp->vt_time - (now - vtlist.vt_lasttime);
+  if (delta < CH_TIMEDELTA)
+    delta = CH_TIMEDELTA;
+  port_timer_set_alarm(now + delta);
+}
+#endif /* CH_TIMEDELTA > 0 */
+
+#if CH_USE_TIMER_WHEEL || defined(__DOXYGEN__)
+/**
+ * @brief   Virtual timers ticker.
+ * @details The system time is incremented and the timers expiring at the
+ *          new time are triggered, only the matching wheel slot is scanned.
+ * @note    The expired timers are first moved in a local list, a callback
+ *          can then safely reset or re-arm any timer, including the ones
+ *          still pending in the local list.
+ * @note    The system lock is released before entering the callback and
+ *          re-acquired immediately after. It is callback's responsibility
+ *          to acquire the lock if needed. This is done in order to reduce
+ *          interrupts jitter when many timers are in use.
+ *
+ * @iclass
+ */
+void chVTDoTickI(void) {
+  VirtualTimer expired, *slotp, *vtp;
+  systime_t now;
+
+  chDbgCheckClassI();
+
+  now = ++vtlist.vt_systime;
+  slotp = vt_slot(now);
+  vtp = slotp->vt_next;
+  if (vtp == slotp)
+    return;
+
+  expired.vt_next = expired.vt_prev = &expired;
+  while (vtp != slotp) {
+    VirtualTimer *next = vtp->vt_next;
+
+    if (vtp->vt_time == now) {
+      vtp->vt_prev->vt_next = next;
+      next->vt_prev = vtp->vt_prev;
+      vtp->vt_next = &expired;
+      vtp->vt_prev = expired.vt_prev;
+      expired.vt_prev->vt_next = vtp;
+      expired.vt_prev = vtp;
+    }
+    vtp = next;
+  }
+
+  while ((vtp = expired.vt_next) != &expired) {
+    vtfunc_t fn = vtp->vt_func;
+    vtp->vt_func = (vtfunc_t)NULL;
+    vtp->vt_next->vt_prev = &expired;
+    expired.vt_next = vtp->vt_next;
+    chSysUnlockFromIsr();
+    fn(vtp->vt_par);
+    chSysLockFromIsr();
+  }
 }
+#endif /* CH_USE_TIMER_WHEEL */
 
 /** @} */
@@ -131,4 +131,45 @@ void port_halt(void) {
 void port_switch(Thread *ntp, Thread *otp) {
 }
 
+#if (CH_TIMEDELTA > 0) || defined(__DOXYGEN__)
+/**
+ * @brief   Starts the alarm.
+ * @details The system timer alarm is enabled and programmed to trigger at
+ *          the specified absolute time, the alarm interrupt must invoke
+ *          @p chSysTimerHandlerI().
+ * @note    Only required in tick-less mode.
+ *
+ * @param[in] time      the absolute time of the alarm
+ */
+void port_timer_start_alarm(systime_t time) {
+}
+
+/**
+ * @brief   Stops the alarm.
+ * @note    Only required in tick-less mode.
+ */
+void port_timer_stop_alarm(void) {
+}
+
+/**
+ * @brief   Changes the time of an already started alarm.
+ * @note    Only required in tick-less mode.
+ *
+ * @param[in] time      the new absolute time of the alarm
+ */
+void port_timer_set_alarm(systime_t time) {
+}
+
+/**
+ * @brief   Returns the current value of the free running system timer.
+ * @note    Only required in tick-less mode.
+ *
+ * @return              The system time in ticks.
+ */
+systime_t port_timer_get_time(void) {
+
+  return 0;
+}
+#endif /* CH_TIMEDELTA > 0 */
+
 /** @} */
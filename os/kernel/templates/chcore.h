@@ -204,6 +204,12 @@ extern "C" {
   void port_wait_for_interrupt(void);
   void port_halt(void);
   void port_switch(Thread *ntp, Thread *otp);
+#if CH_TIMEDELTA > 0
+  void port_timer_start_alarm(systime_t time);
+  void port_timer_stop_alarm(void);
+  void port_timer_set_alarm(systime_t time);
+  systime_t port_timer_get_time(void);
+#endif
 #ifdef __cplusplus
 }
 #endif
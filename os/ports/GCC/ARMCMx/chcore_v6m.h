@@ -152,6 +152,10 @@
 /* Port implementation part.                                                 */
 /*===========================================================================*/
 
+#if CH_TIMEDELTA > 0
+#error "tick-less mode not supported by the ARMv6-M port"
+#endif
+
 #if !defined(_FROM_ASM_)
 
 /**
@@ -28,14 +28,29 @@
 
 #include "ch.h"
 
+#if CORTEX_USE_FPU
+/**
+ * @brief   EXC_RETURN bit set when the exception frame has no FPU part.
+ */
+#define EXC_RETURN_BASIC        0x00000010U
+
+/**
+ * @brief   Size of an exception frame without FPU part.
+ */
+#define EXTCTX_BASIC_SIZE       (8 * sizeof (regarm_t))
+#endif
+
 /*===========================================================================*/
 /* Port interrupt handlers.                                                  */
 /*===========================================================================*/
 
+#if (CH_TIMEDELTA == 0) || defined(__DOXYGEN__)
 /**
  * @brief   System Timer vector.
  * @details This interrupt is used as system tick.
  * @note    The timer must be initialized in the startup code.
+ * @note    In tick-less mode the SysTick is not used, the alarm interrupt
+ *          is handled by the platform layer.
  */
 CH_IRQ_HANDLER(SysTickVector) {
 
@@ -47,6 +62,7 @@ CH_IRQ_HANDLER(SysTickVector) {
 
   CH_IRQ_EPILOGUE();
 }
+#endif /* CH_TIMEDELTA == 0 */
 
 #if !CORTEX_SIMPLIFIED_PRIORITY || defined(__DOXYGEN__)
 /**
@@ -63,12 +79,17 @@ void SVCallVector(void) {
 
   /* Discarding the current exception context and positioning the stack to
      point to the real one.*/
-  ctxp++;
-
 #if CORTEX_USE_FPU
-  /* Restoring the special register SCB_FPCCR.*/
-  SCB_FPCCR = (uint32_t)ctxp->fpccr;
-  SCB_FPCAR = SCB_FPCAR + sizeof (struct extctx);
+  if (((uint32_t)__builtin_return_address(0) & EXC_RETURN_BASIC) == 0) {
+    /* Extended frames, restoring the special register SCB_FPCCR.*/
+    ctxp++;
+    SCB_FPCCR = (uint32_t)ctxp->fpccr;
+    SCB_FPCAR = SCB_FPCAR + sizeof (struct extctx);
+  }
+  else
+    ctxp = (struct extctx *)((uint8_t *)ctxp + EXTCTX_BASIC_SIZE);
+#else
+  ctxp++;
 #endif
   asm volatile ("msr     PSP, %0" : : "r" (ctxp) : "memory");
   port_unlock_from_isr();
@@ -90,12 +111,17 @@ void PendSVVector(void) {
 
   /* Discarding the current exception context and positioning the stack to
      point to the real one.*/
-  ctxp++;
-
 #if CORTEX_USE_FPU
-  /* Restoring the special register SCB_FPCCR.*/
-  SCB_FPCCR = (uint32_t)ctxp->fpccr;
-  SCB_FPCAR = SCB_FPCAR + sizeof (struct extctx);
+  if (((uint32_t)__builtin_return_address(0) & EXC_RETURN_BASIC) == 0) {
+    /* Extended frames, restoring the special register SCB_FPCCR.*/
+    ctxp++;
+    SCB_FPCCR = (uint32_t)ctxp->fpccr;
+    SCB_FPCAR = SCB_FPCAR + sizeof (struct extctx);
+  }
+  else
+    ctxp = (struct extctx *)((uint8_t *)ctxp + EXTCTX_BASIC_SIZE);
+#else
+  ctxp++;
 #endif
   asm volatile ("msr     PSP, %0" : : "r" (ctxp) : "memory");
 }
@@ -137,19 +163,40 @@ void _port_unlock(void) {
 
 /**
  * @brief   Exception exit redirection to _port_switch_from_isr().
+ * @note    When the FPU is enabled the artificial exception return context
+ *          has the same size of the frame stacked for the interrupted
+ *          thread, the FPU part is only present if the thread has an active
+ *          FPU context.
+ *
+ * @param[in] lr        the EXC_RETURN value of the exception, only when the
+ *                      FPU is enabled
  */
+#if CORTEX_USE_FPU || defined(__DOXYGEN__)
+void _port_irq_epilogue(regarm_t lr) {
+#else
 void _port_irq_epilogue(void) {
+#endif
 
   port_lock_from_isr();
   if ((SCB_ICSR & ICSR_RETTOBASE) != 0) {
     struct extctx *ctxp;
+#if CORTEX_USE_FPU
+    bool_t extended = ((uint32_t)lr & EXC_RETURN_BASIC) == 0;
+#endif
 
     /* Current PSP value.*/
     asm volatile ("mrs     %0, PSP" : "=r" (ctxp) : : "memory");
 
     /* Adding an artificial exception return context, there is no need to
        populate it fully.*/
+#if CORTEX_USE_FPU
+    if (extended)
+      ctxp--;
+    else
+      ctxp = (struct extctx *)((uint8_t *)ctxp - EXTCTX_BASIC_SIZE);
+#else
     ctxp--;
+#endif
     asm volatile ("msr     PSP, %0" : : "r" (ctxp) : "memory");
     ctxp->xpsr = (regarm_t)0x01000000;
 
@@ -160,7 +207,8 @@ void _port_irq_epilogue(void) {
       ctxp->pc = (void *)_port_switch_from_isr;
 #if CORTEX_USE_FPU
       /* Triggering a lazy FPU state save.*/
-      asm volatile ("vmrs    APSR_nzcv, FPSCR" : : : "memory");
+      if (extended)
+        asm volatile ("vmrs    APSR_nzcv, FPSCR" : : : "memory");
 #endif
     }
     else {
@@ -170,7 +218,7 @@ void _port_irq_epilogue(void) {
     }
 
 #if CORTEX_USE_FPU
-    {
+    if (extended) {
       uint32_t fpccr;
 
       /* Saving the special register SCB_FPCCR into the reserved offset of
@@ -199,9 +247,21 @@ __attribute__((naked))
 #endif
 void _port_switch_from_isr(void) {
 
+#if CORTEX_USE_FPU
+  /* The FPCA flag describes the exception frame left by the interrupted
+     thread, it is saved because kernel code could activate an FPU context
+     before the frame is restored.*/
+  asm volatile ("mrs     r0, CONTROL                            \n\t"
+                "push    {r0, r1}" : : : "memory");
+#endif
   dbg_check_lock();
   chSchDoReschedule();
   dbg_check_unlock();
+#if CORTEX_USE_FPU
+  asm volatile ("pop     {r0, r1}                               \n\t"
+                "msr     CONTROL, r0                            \n\t"
+                "isb" : : : "memory");
+#endif
   asm volatile ("_port_exit_from_isr:" : : : "memory");
 #if !CORTEX_SIMPLIFIED_PRIORITY || defined(__DOXYGEN__)
   asm volatile ("svc     #0");
@@ -231,14 +291,28 @@ void _port_switch(Thread *ntp, Thread *otp) {
   asm volatile ("push    {r4, r5, r6, r7, r8, r9, r10, r11, lr}"
                 : : : "memory");
 #if CORTEX_USE_FPU
-  asm volatile ("vpush   {s16-s31}" : : : "memory");
+  /* The FPU registers are saved only if the thread has an active FPU
+     context, the FPCA flag is saved along with them.*/
+  asm volatile ("mrs     r3, CONTROL                            \n\t"
+                "ands    r3, r3, #4                             \n\t"
+                "it      ne                                     \n\t"
+                "vpushne {s16-s31}                              \n\t"
+                "push    {r3}" : : : "memory");
 #endif
 
   asm volatile ("str     sp, [%1, #12]                          \n\t"
                 "ldr     sp, [%0, #12]" : : "r" (ntp), "r" (otp));
 
 #if CORTEX_USE_FPU
-  asm volatile ("vpop    {s16-s31}" : : : "memory");
+  asm volatile ("pop     {r3}                                   \n\t"
+                "cmp     r3, #0                                 \n\t"
+                "it      ne                                     \n\t"
+                "vpopne  {s16-s31}                              \n\t"
+                "mrs     r2, CONTROL                            \n\t"
+                "bic     r2, r2, #4                             \n\t"
+                "orr     r2, r2, r3                             \n\t"
+                "msr     CONTROL, r2                            \n\t"
+                "isb" : : : "memory");
 #endif
   asm volatile ("pop     {r4, r5, r6, r7, r8, r9, r10, r11, pc}"
                 : : : "memory");
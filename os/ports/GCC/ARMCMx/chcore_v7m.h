@@ -94,6 +94,10 @@
 /**
  * @brief   FPU support in context switch.
  * @details Activating this option activates the FPU support in the kernel.
+ * @note    The FPU context is switched lazily, the s16-s31 registers are
+ *          saved and restored only for threads with an active FPU context
+ *          (CONTROL.FPCA set), threads that never executed an FPU
+ *          instruction switch as fast as on a core without FPU.
  */
 #if !defined(CORTEX_USE_FPU)
 #define CORTEX_USE_FPU                  CORTEX_HAS_FPU
@@ -258,24 +262,11 @@ struct extctx {
 #endif /* CORTEX_USE_FPU */
 };
 
+/* When the saved FPCA flag is set the s16-s31 registers are stacked between
+   the fpca and r4 fields.*/
 struct intctx {
 #if CORTEX_USE_FPU
-  regarm_t      s16;
-  regarm_t      s17;
-  regarm_t      s18;
-  regarm_t      s19;
-  regarm_t      s20;
-  regarm_t      s21;
-  regarm_t      s22;
-  regarm_t      s23;
-  regarm_t      s24;
-  regarm_t      s25;
-  regarm_t      s26;
-  regarm_t      s27;
-  regarm_t      s28;
-  regarm_t      s29;
-  regarm_t      s30;
-  regarm_t      s31;
+  regarm_t      fpca;
 #endif /* CORTEX_USE_FPU */
   regarm_t      r4;
   regarm_t      r5;
@@ -288,6 +279,12 @@ struct intctx {
   regarm_t      lr;
 };
 
+#if CORTEX_USE_FPU
+#define INTCTX_FPU_SIZE                 (16 * sizeof (regarm_t))
+#else
+#define INTCTX_FPU_SIZE                 0
+#endif
+
 #endif /* !defined(__DOXYGEN__) */
 
 /**
@@ -303,15 +300,28 @@ struct context {
  * @brief   Platform dependent part of the @p chThdCreateI() API.
  * @details This code usually setup the context switching frame represented
  *          by an @p intctx structure.
+ * @note    Threads are started without an FPU context.
  */
+#if CORTEX_USE_FPU || defined(__DOXYGEN__)
 #define SETUP_CONTEXT(workspace, wsize, pf, arg) {                          \
   tp->p_ctx.r13 = (struct intctx *)((uint8_t *)workspace +                  \
                                      wsize -                                \
                                      sizeof(struct intctx));                \
+  tp->p_ctx.r13->fpca = (void *)0;                                          \
   tp->p_ctx.r13->r4 = (void *)(pf);                                         \
   tp->p_ctx.r13->r5 = (void *)(arg);                                        \
   tp->p_ctx.r13->lr = (void *)(_port_thread_start);                         \
 }
+#else
+#define SETUP_CONTEXT(workspace, wsize, pf, arg) {                          \
+  tp->p_ctx.r13 = (struct intctx *)((uint8_t *)workspace +                  \
+                                     wsize -                                \
+                                     sizeof(struct intctx));                \
+  tp->p_ctx.r13->r4 = (void *)(pf);                                         \
+  tp->p_ctx.r13->r5 = (void *)(arg);                                        \
+  tp->p_ctx.r13->lr = (void *)(_port_thread_start);                         \
+}
+#endif
 
 /**
  * @brief   Enforces a correct alignment for a stack area size value.
@@ -323,6 +333,7 @@ struct context {
  */
 #define THD_WA_SIZE(n) STACK_ALIGN(sizeof(Thread) +                         \
                                    sizeof(struct intctx) +                  \
+                                   INTCTX_FPU_SIZE +                        \
                                    sizeof(struct extctx) +                  \
                                    (n) + (PORT_INT_REQUIRED_STACK))
 
@@ -337,15 +348,26 @@ struct context {
  * @brief   IRQ prologue code.
  * @details This macro must be inserted at the start of all IRQ handlers
  *          enabled to invoke system APIs.
+ * @note    The EXC_RETURN value is saved in order to know the size of the
+ *          exception frame stacked for the interrupted thread.
  */
+#if CORTEX_USE_FPU || defined(__DOXYGEN__)
+#define PORT_IRQ_PROLOGUE()                                                 \
+  regarm_t _saved_lr = (regarm_t)__builtin_return_address(0)
+#else
 #define PORT_IRQ_PROLOGUE()
+#endif
 
 /**
  * @brief   IRQ epilogue code.
  * @details This macro must be inserted at the end of all IRQ handlers
  *          enabled to invoke system APIs.
  */
+#if CORTEX_USE_FPU || defined(__DOXYGEN__)
+#define PORT_IRQ_EPILOGUE() _port_irq_epilogue(_saved_lr)
+#else
 #define PORT_IRQ_EPILOGUE() _port_irq_epilogue()
+#endif
 
 /**
  * @brief   IRQ handler function declaration.
@@ -479,6 +501,91 @@ struct context {
 #define port_wait_for_interrupt()
 #endif
 
+/**
+ * @brief   Counts the leading zeros of a non-zero 32 bits word.
+ * @note    Implemented as an inlined @p CLZ instruction.
+ */
+#define port_clz(n) ((unsigned)__builtin_clz(n))
+
+/**
+ * @brief   Exclusive access instructions support.
+ * @details The port provides @p port_ldrex(), @p port_strex() and
+ *          @p port_clrex(), used by the kernel lock-free code paths.
+ */
+#define PORT_SUPPORTS_EXCLUSIVE TRUE
+
+/**
+ * @brief   Loads a 32 bits word and marks its address for exclusive access.
+ * @note    Implemented as an inlined @p LDREX instruction.
+ *
+ * @param[in] p         pointer to the word
+ * @return              The word value.
+ */
+static INLINE uint32_t port_ldrex(volatile uint32_t *p) {
+  uint32_t v;
+
+  asm volatile ("ldrex   %0, [%1]" : "=r" (v) : "r" (p) : "memory");
+  return v;
+}
+
+/**
+ * @brief   Conditionally stores a 32 bits word.
+ * @details The store is performed only if the exclusive access marked by the
+ *          last @p port_ldrex() is still valid, any exception entry or exit
+ *          invalidates it.
+ * @note    Implemented as an inlined @p STREX instruction.
+ *
+ * @param[in] p         pointer to the word
+ * @param[in] v         value to be stored
+ * @return              The operation status.
+ * @retval 0            if the store has been performed.
+ */
+static INLINE uint32_t port_strex(volatile uint32_t *p, uint32_t v) {
+  uint32_t res;
+
+  asm volatile ("strex   %0, %2, [%1]" : "=&r" (res) : "r" (p), "r" (v)
+                                       : "memory");
+  return res;
+}
+
+/**
+ * @brief   Clears the exclusive access mark.
+ * @note    Implemented as an inlined @p CLREX instruction.
+ */
+#define port_clrex() asm volatile ("clrex" : : : "memory")
+
+/**
+ * @brief   Realtime counter value.
+ * @details The DWT cycle counter is used as realtime counter, it is the
+ *          timestamp source of the events tracer and of the threads
+ *          statistics.
+ */
+#define port_rt_get_counter_value() DWT_CYCCNT
+
+/**
+ * @brief   Realtime counter initialization.
+ */
+#define port_rt_init() {                                                    \
+  SCS_DEMCR |= SCS_DEMCR_TRCENA;                                            \
+  DWT_CTRL  |= DWT_CTRL_CYCCNTENA;                                          \
+}
+
+/**
+ * @brief   Returns the current exception number.
+ * @note    Implemented as an inlined read of the @p IPSR register.
+ */
+static INLINE uint32_t port_get_ipsr(void) {
+  uint32_t ipsr;
+
+  asm volatile ("mrs     %0, ipsr" : "=r" (ipsr));
+  return ipsr;
+}
+
+/**
+ * @brief   Events tracer ISR identifier, the current exception number.
+ */
+#define port_trace_isr_id() port_get_ipsr()
+
 /**
  * @brief   Performs a context switch between two threads.
  * @details This is the most critical code in any port, this function
@@ -494,7 +601,8 @@ struct context {
 #else
 #define port_switch(ntp, otp) {                                             \
   register struct intctx *r13 asm ("r13");                                  \
-  if ((stkalign_t *)(r13 - 1) < otp->p_stklimit)                            \
+  if ((stkalign_t *)((uint8_t *)(r13 - 1) - INTCTX_FPU_SIZE) <              \
+      otp->p_stklimit)                                                      \
     chDbgPanic("stack overflow");                                           \
   _port_switch(ntp, otp);                                                   \
 }
@@ -504,8 +612,19 @@ struct context {
 extern "C" {
 #endif
   void port_halt(void);
+#if CH_TIMEDELTA > 0
+  /* Tick-less mode system timer, implemented in the platform layer.*/
+  void port_timer_start_alarm(systime_t time);
+  void port_timer_stop_alarm(void);
+  void port_timer_set_alarm(systime_t time);
+  systime_t port_timer_get_time(void);
+#endif
   void _port_init(void);
+#if CORTEX_USE_FPU
+  void _port_irq_epilogue(regarm_t lr);
+#else
   void _port_irq_epilogue(void);
+#endif
   void _port_switch_from_isr(void);
   void _port_exit_from_isr(void);
   void _port_switch(Thread *ntp, Thread *otp);
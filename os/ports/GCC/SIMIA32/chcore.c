@@ -0,0 +1,163 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006,2007,2008,2009,2010,
+                 2011,2012,2013 Giovanni Di Sirio.
+
+    This file is part of ChibiOS/RT.
+
+    ChibiOS/RT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    ChibiOS/RT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file    SIMIA32/chcore.c
+ * @brief   Simulator on x86/x86-64 port code.
+ *
+ * @addtogroup SIMIA32_CORE
+ * @{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ch.h"
+
+/**
+ * @brief   Performs a context switch between two threads.
+ * @details The callee-saved registers are pushed on the current stack, the
+ *          stack pointer is saved in @p *ospp and the stack pointer of the
+ *          thread being switched in is loaded from @p *nspp.
+ *
+ * @param[in] nspp      pointer to the saved stack pointer of the thread to
+ *                      be switched in
+ * @param[in] ospp      pointer to the saved stack pointer of the thread to
+ *                      be switched out
+ */
+#if !defined(__DOXYGEN__)
+#if defined(__x86_64__)
+asm (".text                                                             \n"
+     ".globl _port_switch                                               \n"
+     ".type _port_switch, @function                                     \n"
+     "_port_switch:                                                     \n"
+     "        push    %rbp                                              \n"
+     "        push    %rbx                                              \n"
+     "        push    %r12                                              \n"
+     "        push    %r13                                              \n"
+     "        push    %r14                                              \n"
+     "        push    %r15                                              \n"
+     "        mov     %rsp, (%rsi)                                      \n"
+     "        mov     (%rdi), %rsp                                      \n"
+     "        pop     %r15                                              \n"
+     "        pop     %r14                                              \n"
+     "        pop     %r13                                              \n"
+     "        pop     %r12                                              \n"
+     "        pop     %rbx                                              \n"
+     "        pop     %rbp                                              \n"
+     "        ret                                                       \n"
+     ".size _port_switch, .-_port_switch                                \n");
+#else
+asm (".text                                                             \n"
+     ".globl _port_switch                                               \n"
+     ".type _port_switch, @function                                     \n"
+     "_port_switch:                                                     \n"
+     "        movl    4(%esp), %ecx                                     \n"
+     "        movl    8(%esp), %edx                                     \n"
+     "        push    %ebp                                              \n"
+     "        push    %esi                                              \n"
+     "        push    %edi                                              \n"
+     "        push    %ebx                                              \n"
+     "        movl    %esp, (%edx)                                      \n"
+     "        movl    (%ecx), %esp                                      \n"
+     "        pop     %ebx                                              \n"
+     "        pop     %edi                                              \n"
+     "        pop     %esi                                              \n"
+     "        pop     %ebp                                              \n"
+     "        ret                                                       \n"
+     ".size _port_switch, .-_port_switch                                \n");
+#endif
+#endif /* !defined(__DOXYGEN__) */
+
+/**
+ * @brief   Start a thread by invoking its work function.
+ * @details If the work function returns @p chThdExit() is automatically
+ *          invoked. The thread function and its argument are found in the
+ *          callee-saved registers loaded by @p SETUP_CONTEXT().
+ */
+#if !defined(__DOXYGEN__)
+#if defined(__x86_64__)
+asm (".text                                                             \n"
+     ".globl _port_thread_start                                         \n"
+     ".type _port_thread_start, @function                               \n"
+     "_port_thread_start:                                               \n"
+     "        and     $-16, %rsp                                        \n"
+     "        call    _port_thread_start_unlock                         \n"
+     "        mov     %r13, %rdi                                        \n"
+     "        call    *%r12                                             \n"
+     "        mov     %rax, %rdi                                        \n"
+     "        call    chThdExit                                         \n"
+     ".size _port_thread_start, .-_port_thread_start                    \n");
+#else
+asm (".text                                                             \n"
+     ".globl _port_thread_start                                         \n"
+     ".type _port_thread_start, @function                               \n"
+     "_port_thread_start:                                               \n"
+     "        andl    $-16, %esp                                        \n"
+     "        call    _port_thread_start_unlock                         \n"
+     "        subl    $12, %esp                                         \n"
+     "        push    %edi                                              \n"
+     "        call    *%ebx                                             \n"
+     "        movl    %eax, (%esp)                                      \n"
+     "        call    chThdExit                                         \n"
+     ".size _port_thread_start, .-_port_thread_start                    \n");
+#endif
+#endif /* !defined(__DOXYGEN__) */
+
+/**
+ * @brief   Leaves the kernel lock on thread start.
+ * @note    Not meant to be used from application code.
+ */
+void _port_thread_start_unlock(void) {
+
+  chSysUnlock();
+}
+
+/**
+ * @brief   Halts the system.
+ * @details The panic message, if any, is printed and the host process is
+ *          terminated with exit code 2.
+ */
+void port_halt(void) {
+
+#if CH_DBG_ENABLED
+  if (dbg_panic_msg != NULL)
+    fprintf(stderr, "\nHalted: %s\n", dbg_panic_msg);
+  else
+#endif
+    fprintf(stderr, "\nHalted\n");
+  fflush(stdout);
+  exit(2);
+}
+
+/**
+ * @brief   Realtime counter value.
+ *
+ * @return              The host monotonic clock in nanoseconds.
+ */
+uint32_t _port_rt_get_counter_value(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + ts.tv_nsec);
+}
+
+/** @} */
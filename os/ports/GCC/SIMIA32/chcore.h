@@ -0,0 +1,324 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006,2007,2008,2009,2010,
+                 2011,2012,2013 Giovanni Di Sirio.
+
+    This file is part of ChibiOS/RT.
+
+    ChibiOS/RT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    ChibiOS/RT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file    SIMIA32/chcore.h
+ * @brief   Simulator on x86/x86-64 port macros and structures.
+ *
+ * @addtogroup SIMIA32_CORE
+ * @{
+ */
+
+#ifndef _CHCORE_H_
+#define _CHCORE_H_
+
+#if !defined(__i386__) && !defined(__x86_64__)
+#error "this port only supports x86 and x86-64 hosts"
+#endif
+
+/*===========================================================================*/
+/* Port constants.                                                           */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Port macros.                                                              */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Port configurable parameters.                                             */
+/*===========================================================================*/
+
+/**
+ * @brief   Stack size for the system idle thread.
+ * @details The idle thread polls the simulated interrupt sources, this
+ *          involves host library calls.
+ */
+#ifndef PORT_IDLE_THREAD_STACK_SIZE
+#define PORT_IDLE_THREAD_STACK_SIZE     1024
+#endif
+
+/**
+ * @brief   Per-thread stack overhead for interrupts servicing.
+ * @details The simulated interrupt handlers run on the stack of the
+ *          interrupted thread and call into the host C library, the
+ *          overhead is large compared to a real target.
+ */
+#ifndef PORT_INT_REQUIRED_STACK
+#define PORT_INT_REQUIRED_STACK         16384
+#endif
+
+/*===========================================================================*/
+/* Port derived parameters.                                                  */
+/*===========================================================================*/
+
+/*===========================================================================*/
+/* Port exported info.                                                       */
+/*===========================================================================*/
+
+/**
+ * @brief   Unique macro for the implemented architecture.
+ */
+#define CH_ARCHITECTURE_SIMIA32
+
+/**
+ * @brief   Name of the implemented architecture.
+ */
+#define CH_ARCHITECTURE_NAME            "Simulator"
+
+/**
+ * @brief   Name of the architecture variant (optional).
+ */
+#if defined(__x86_64__) || defined(__DOXYGEN__)
+#define CH_ARCHITECTURE_VARIANT_NAME    "x86-64 (POSIX host)"
+#else
+#define CH_ARCHITECTURE_VARIANT_NAME    "x86 (POSIX host)"
+#endif
+
+/**
+ * @brief   Name of the compiler supported by this port.
+ */
+#define CH_COMPILER_NAME                "GCC " __VERSION__
+
+/**
+ * @brief   Port-specific information string.
+ */
+#define CH_PORT_INFO                    "No preemption"
+
+/*===========================================================================*/
+/* Port implementation part.                                                 */
+/*===========================================================================*/
+
+/**
+ * @brief   Base type for stack and memory alignment.
+ * @note    The host ABI requires 16 bytes aligned stacks.
+ */
+typedef struct {
+  uint8_t a[16];
+} __attribute__((aligned(16))) stkalign_t;
+
+/**
+ * @brief   Interrupt saved context.
+ * @details The simulated interrupts do not save any context, they are
+ *          served synchronously from the interrupted thread.
+ */
+struct extctx {
+  void          *dummy;
+};
+
+/**
+ * @brief   System saved context.
+ * @details This structure represents the inner stack frame during a context
+ *          switching, the callee-saved registers and the return address.
+ */
+#if defined(__x86_64__) || defined(__DOXYGEN__)
+struct intctx {
+  void          *r15;
+  void          *r14;
+  void          *r13;
+  void          *r12;
+  void          *rbx;
+  void          *rbp;
+  void          *rip;
+};
+#else
+struct intctx {
+  void          *ebx;
+  void          *edi;
+  void          *esi;
+  void          *ebp;
+  void          *eip;
+};
+#endif
+
+/**
+ * @brief   Platform dependent part of the @p Thread structure.
+ * @details This structure usually contains just the saved stack pointer
+ *          defined as a pointer to a @p intctx structure.
+ */
+struct context {
+  struct intctx *sp;
+};
+
+/**
+ * @brief   Platform dependent part of the @p chThdCreateI() API.
+ * @details The frame is built below the 16 bytes aligned top of the working
+ *          area, the thread function and its argument are loaded in two
+ *          callee-saved registers and picked by @p _port_thread_start().
+ */
+#if defined(__x86_64__) || defined(__DOXYGEN__)
+#define SETUP_CONTEXT(workspace, wsize, pf, arg) {                          \
+  uint8_t *top = (uint8_t *)(((uintptr_t)(workspace) + (wsize)) &           \
+                             ~(uintptr_t)15);                               \
+  tp->p_ctx.sp = (struct intctx *)(top - sizeof(struct intctx) - 8);        \
+  tp->p_ctx.sp->r12 = (void *)(pf);                                         \
+  tp->p_ctx.sp->r13 = (void *)(arg);                                        \
+  tp->p_ctx.sp->rbp = NULL;                                                 \
+  tp->p_ctx.sp->rip = (void *)_port_thread_start;                           \
+}
+#else
+#define SETUP_CONTEXT(workspace, wsize, pf, arg) {                          \
+  uint8_t *top = (uint8_t *)(((uintptr_t)(workspace) + (wsize)) &           \
+                             ~(uintptr_t)15);                               \
+  tp->p_ctx.sp = (struct intctx *)(top - sizeof(struct intctx) - 12);       \
+  tp->p_ctx.sp->ebx = (void *)(pf);                                         \
+  tp->p_ctx.sp->edi = (void *)(arg);                                        \
+  tp->p_ctx.sp->ebp = NULL;                                                 \
+  tp->p_ctx.sp->eip = (void *)_port_thread_start;                           \
+}
+#endif
+
+/**
+ * @brief   Enforces a correct alignment for a stack area size value.
+ */
+#define STACK_ALIGN(n) ((((n) - 1) | (sizeof(stkalign_t) - 1)) + 1)
+
+/**
+ * @brief   Computes the thread working area global size.
+ */
+#define THD_WA_SIZE(n) STACK_ALIGN(sizeof(Thread) +                         \
+                                   sizeof(struct intctx) +                  \
+                                   sizeof(struct extctx) +                  \
+                                   (n) + (PORT_INT_REQUIRED_STACK))
+
+/**
+ * @brief   Static working area allocation.
+ * @details This macro is used to allocate a static thread working area
+ *          aligned as both position and size.
+ */
+#define WORKING_AREA(s, n) stkalign_t s[THD_WA_SIZE(n) / sizeof(stkalign_t)]
+
+/**
+ * @brief   IRQ prologue code.
+ * @details This macro must be inserted at the start of all IRQ handlers
+ *          enabled to invoke system APIs.
+ */
+#define PORT_IRQ_PROLOGUE()
+
+/**
+ * @brief   IRQ epilogue code.
+ * @details This macro must be inserted at the end of all IRQ handlers
+ *          enabled to invoke system APIs.
+ */
+#define PORT_IRQ_EPILOGUE()
+
+/**
+ * @brief   IRQ handler function declaration.
+ * @note    @p id can be a function name or a vector number depending on the
+ *          port implementation.
+ */
+#define PORT_IRQ_HANDLER(id) void id(void)
+
+/**
+ * @brief   Fast IRQ handler function declaration.
+ * @note    @p id can be a function name or a vector number depending on the
+ *          port implementation.
+ */
+#define PORT_FAST_IRQ_HANDLER(id) void id(void)
+
+/**
+ * @brief   Port-related initialization code.
+ * @note    This function is empty in this port.
+ */
+#define port_init()
+
+/**
+ * @brief   Kernel-lock action.
+ * @details The simulated interrupts are only served when the running code
+ *          polls them, the critical zones do not need any action.
+ */
+#define port_lock()
+
+/**
+ * @brief   Kernel-unlock action.
+ */
+#define port_unlock()
+
+/**
+ * @brief   Kernel-lock action from an interrupt handler.
+ */
+#define port_lock_from_isr()
+
+/**
+ * @brief   Kernel-unlock action from an interrupt handler.
+ */
+#define port_unlock_from_isr()
+
+/**
+ * @brief   Disables all the interrupt sources.
+ */
+#define port_disable()
+
+/**
+ * @brief   Disables the interrupt sources below kernel-level priority.
+ */
+#define port_suspend()
+
+/**
+ * @brief   Enables all the interrupt sources.
+ */
+#define port_enable()
+
+/**
+ * @brief   Enters an architecture-dependent IRQ-waiting mode.
+ * @details The simulated interrupt sources are polled.
+ */
+#define port_wait_for_interrupt() ChkIntSources()
+
+/**
+ * @brief   Performs a context switch between two threads.
+ *
+ * @param[in] ntp       the thread to be switched in
+ * @param[in] otp       the thread to be switched out
+ */
+#define port_switch(ntp, otp) _port_switch(&(ntp)->p_ctx.sp, &(otp)->p_ctx.sp)
+
+/**
+ * @brief   Realtime counter value.
+ * @details The host monotonic clock in nanoseconds, truncated to 32 bits.
+ */
+#define port_rt_get_counter_value() _port_rt_get_counter_value()
+
+/**
+ * @brief   Realtime counter initialization.
+ */
+#define port_rt_init()
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void port_halt(void);
+  void _port_switch(struct intctx **nspp, struct intctx **ospp);
+  void _port_thread_start(void);
+  void _port_thread_start_unlock(void);
+  uint32_t _port_rt_get_counter_value(void);
+  void ChkIntSources(void);
+#if CH_TIMEDELTA > 0
+  void port_timer_start_alarm(systime_t time);
+  void port_timer_stop_alarm(void);
+  void port_timer_set_alarm(systime_t time);
+  systime_t port_timer_get_time(void);
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CHCORE_H_ */
+
+/** @} */
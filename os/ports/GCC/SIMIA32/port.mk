@@ -0,0 +1,6 @@
+# List of the ChibiOS/RT simulator port files.
+PORTSRC = ${CHIBIOS}/os/ports/GCC/SIMIA32/chcore.c
+
+PORTASM =
+
+PORTINC = ${CHIBIOS}/os/ports/GCC/SIMIA32
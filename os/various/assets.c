@@ -0,0 +1,347 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    assets.c
+ * @brief   Compressed assets archive code.
+ *
+ * @addtogroup assets
+ * @{
+ */
+
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "assets.h"
+
+/*
+ * Output cursor, the decoded stream is laid out in rows of @p width bytes
+ * spaced by @p pitch bytes.
+ */
+typedef struct {
+  uint8_t               *base;
+  size_t                width;
+  size_t                pitch;
+  size_t                pos;
+  size_t                size;
+} out_t;
+
+static uint8_t *out_addr(const out_t *op, size_t pos, size_t *leftp) {
+  size_t row = pos / op->width;
+  size_t col = pos - row * op->width;
+
+  *leftp = op->width - col;
+  return op->base + row * op->pitch + col;
+}
+
+static bool_t out_write(out_t *op, const uint8_t *src, size_t n) {
+  size_t seg;
+  uint8_t *p;
+
+  if (n > op->size - op->pos)
+    return CH_FAILED;
+  while (n > 0) {
+    p = out_addr(op, op->pos, &seg);
+    if (seg > n)
+      seg = n;
+    memcpy(p, src, seg);
+    src += seg;
+    op->pos += seg;
+    n -= seg;
+  }
+  return CH_SUCCESS;
+}
+
+static bool_t out_fill(out_t *op, uint8_t b, size_t n) {
+  size_t seg;
+  uint8_t *p;
+
+  if (n > op->size - op->pos)
+    return CH_FAILED;
+  while (n > 0) {
+    p = out_addr(op, op->pos, &seg);
+    if (seg > n)
+      seg = n;
+    memset(p, b, seg);
+    op->pos += seg;
+    n -= seg;
+  }
+  return CH_SUCCESS;
+}
+
+/*
+ * Copies already decoded data, the source may overlap the destination in
+ * which case the pattern repeats, segments never exceed the distance so
+ * each one can be a plain memcpy().
+ */
+static bool_t out_match(out_t *op, size_t distance, size_t n) {
+  size_t seg, left;
+  uint8_t *s, *d;
+
+  if ((distance == 0) || (distance > op->pos) || (n > op->size - op->pos))
+    return CH_FAILED;
+  if (distance == 1) {
+    s = out_addr(op, op->pos - 1, &left);
+    return out_fill(op, *s, n);
+  }
+  while (n > 0) {
+    s = out_addr(op, op->pos - distance, &seg);
+    d = out_addr(op, op->pos, &left);
+    if (seg > left)
+      seg = left;
+    if (seg > distance)
+      seg = distance;
+    if (seg > n)
+      seg = n;
+    memcpy(d, s, seg);
+    op->pos += seg;
+    n -= seg;
+  }
+  return CH_SUCCESS;
+}
+
+static bool_t decode_rle(out_t *op, const uint8_t *ip, const uint8_t *iend) {
+  size_t n;
+  uint8_t c;
+
+  while (ip < iend) {
+    c = *ip++;
+    if (c < 0x80) {
+      n = (size_t)c + 1;
+      if ((n > (size_t)(iend - ip)) || out_write(op, ip, n))
+        return CH_FAILED;
+      ip += n;
+    }
+    else {
+      if ((ip >= iend) || out_fill(op, *ip++, (size_t)c - 0x80 + 3))
+        return CH_FAILED;
+    }
+  }
+  return CH_SUCCESS;
+}
+
+static bool_t lz4_length(const uint8_t **ipp, const uint8_t *iend,
+                         size_t *np) {
+  const uint8_t *ip = *ipp;
+  uint8_t b;
+
+  do {
+    if (ip >= iend)
+      return CH_FAILED;
+    b = *ip++;
+    *np += b;
+  } while (b == 255);
+  *ipp = ip;
+  return CH_SUCCESS;
+}
+
+static bool_t decode_lz4(out_t *op, const uint8_t *ip, const uint8_t *iend) {
+  size_t n, distance;
+  uint8_t token;
+
+  while (TRUE) {
+    if (ip >= iend)
+      return CH_FAILED;
+    token = *ip++;
+
+    /* Literals.*/
+    n = token >> 4;
+    if ((n == 15) && lz4_length(&ip, iend, &n))
+      return CH_FAILED;
+    if ((n > (size_t)(iend - ip)) || out_write(op, ip, n))
+      return CH_FAILED;
+    ip += n;
+
+    /* The last sequence has no match.*/
+    if (ip == iend)
+      return CH_SUCCESS;
+
+    /* Match.*/
+    if (iend - ip < 2)
+      return CH_FAILED;
+    distance = (size_t)ip[0] | ((size_t)ip[1] << 8);
+    ip += 2;
+    n = token & 15;
+    if ((n == 15) && lz4_length(&ip, iend, &n))
+      return CH_FAILED;
+    if (out_match(op, distance, n + 4))
+      return CH_FAILED;
+  }
+}
+
+/**
+ * @brief   Returns an archive entry.
+ *
+ * @param[in] archive   pointer to the archive, 4 bytes aligned
+ * @param[in] id        asset index
+ * @return              The asset entry.
+ * @retval NULL         if the archive is invalid or the index out of range.
+ *
+ * @api
+ */
+const AssetEntry *assetGet(const uint8_t *archive, unsigned id) {
+  const AssetHeader *ahp = (const AssetHeader *)archive;
+
+  chDbgCheck((archive != NULL) && (((size_t)archive & 3) == 0), "assetGet");
+
+  if ((ahp->ah_magic != ASSET_MAGIC) || (ahp->ah_version != ASSET_VERSION) ||
+      (id >= ahp->ah_count))
+    return NULL;
+  return (const AssetEntry *)(archive + sizeof(AssetHeader)) + id;
+}
+
+/**
+ * @brief   Decodes an asset.
+ * @details The packed data is decoded in a single pass straight into the
+ *          destination, no intermediate buffer is used. Rows are written
+ *          @p pitch bytes apart so an image can be decoded into a portion
+ *          of a larger frame buffer.
+ * @note    Corrupted data is detected and never written out of the
+ *          destination rows, the destination content is undefined then.
+ *
+ * @param[in] archive   pointer to the archive, 4 bytes aligned
+ * @param[in] id        asset index
+ * @param[out] dstp     destination of the first row
+ * @param[in] pitch     bytes between rows, zero if the rows are contiguous
+ * @return              The operation status.
+ * @retval CH_SUCCESS   if the asset has been decoded.
+ * @retval CH_FAILED    if the asset is missing or corrupted.
+ *
+ * @api
+ */
+bool_t assetDecode(const uint8_t *archive, unsigned id,
+                   void *dstp, size_t pitch) {
+  const AssetEntry *aep;
+  const uint8_t *ip;
+  out_t out;
+
+  chDbgCheck(dstp != NULL, "assetDecode");
+
+  aep = assetGet(archive, id);
+  if ((aep == NULL) || (aep->ae_height == 0) ||
+      (aep->ae_size % aep->ae_height != 0))
+    return CH_FAILED;
+
+  out.base = (uint8_t *)dstp;
+  out.width = aep->ae_size / aep->ae_height;
+  out.pitch = pitch == 0 ? out.width : pitch;
+  out.pos = 0;
+  out.size = aep->ae_size;
+  if (out.pitch < out.width)
+    return CH_FAILED;
+  if (out.size == 0)
+    return CH_SUCCESS;
+
+  ip = archive + aep->ae_offset;
+  switch (aep->ae_codec) {
+  case ASSET_CODEC_STORE:
+    if (aep->ae_packed != aep->ae_size)
+      return CH_FAILED;
+    (void)out_write(&out, ip, aep->ae_packed);
+    break;
+  case ASSET_CODEC_RLE:
+    if (decode_rle(&out, ip, ip + aep->ae_packed))
+      return CH_FAILED;
+    break;
+  case ASSET_CODEC_LZ4:
+    if (decode_lz4(&out, ip, ip + aep->ae_packed))
+      return CH_FAILED;
+    break;
+  default:
+    return CH_FAILED;
+  }
+  return out.pos == out.size ? CH_SUCCESS : CH_FAILED;
+}
+
+/**
+ * @brief   Decodes a palette asset into ARGB-8888 colors.
+ * @details The RGB-888 entries are decoded into the tail of the colors
+ *          array and expanded in place, opaque.
+ *
+ * @param[in] archive   pointer to the archive, 4 bytes aligned
+ * @param[in] id        asset index
+ * @param[out] colors   colors array
+ * @param[in] n         colors array size, in entries
+ * @return              The operation status.
+ * @retval CH_SUCCESS   if the palette has been decoded.
+ * @retval CH_FAILED    if the asset is missing, corrupted, not a palette
+ *                      or larger than the array.
+ *
+ * @api
+ */
+bool_t assetDecodePalette(const uint8_t *archive, unsigned id,
+                          uint32_t *colors, size_t n) {
+  const AssetEntry *aep;
+  const uint8_t *rgbp;
+  size_t i, entries;
+
+  chDbgCheck(colors != NULL, "assetDecodePalette");
+
+  aep = assetGet(archive, id);
+  if ((aep == NULL) || (aep->ae_format != ASSET_FMT_PALETTE))
+    return CH_FAILED;
+  entries = aep->ae_width;
+  if ((entries > n) || (aep->ae_size != entries * 3))
+    return CH_FAILED;
+
+  /* Entry i is read from byte entries + 3i before bytes 4i..4i+3 are
+     written, the reads always stay ahead of the writes.*/
+  rgbp = (const uint8_t *)colors + entries;
+  if (assetDecode(archive, id, (uint8_t *)colors + entries, 0))
+    return CH_FAILED;
+  for (i = 0; i < entries; i++, rgbp += 3)
+    colors[i] = 0xFF000000 | ((uint32_t)rgbp[0] << 16) |
+                ((uint32_t)rgbp[1] << 8) | (uint32_t)rgbp[2];
+  return CH_SUCCESS;
+}
+
+#if ASSETS_USE_DMA2D || defined(__DOXYGEN__)
+/**
+ * @brief   Decodes a palette asset for DMA2D CLUT loading.
+ * @details The palette specification is filled for use in a layer
+ *          configuration, the CLUT is then loaded by the DMA2D along with
+ *          the first queued job that uses the layer.
+ * @note    The DMA2D reloads a CLUT only when a job refers to a different
+ *          palette specification.
+ *
+ * @param[in] archive   pointer to the archive, 4 bytes aligned
+ * @param[in] id        asset index
+ * @param[out] colors   colors array, must stay valid while in use
+ * @param[in] n         colors array size, in entries
+ * @param[out] palcfgp  palette specification
+ * @return              The operation status.
+ * @retval CH_SUCCESS   if the palette has been decoded.
+ * @retval CH_FAILED    if the asset is missing, corrupted, not a palette
+ *                      or larger than the array.
+ *
+ * @api
+ */
+bool_t assetLoadClut(const uint8_t *archive, unsigned id,
+                     uint32_t *colors, size_t n, dma2d_palcfg_t *palcfgp) {
+
+  chDbgCheck(palcfgp != NULL, "assetLoadClut");
+
+  if (assetDecodePalette(archive, id, colors, n))
+    return CH_FAILED;
+  palcfgp->colorsp = colors;
+  palcfgp->length = assetGet(archive, id)->ae_width;
+  palcfgp->fmt = DMA2D_FMT_ARGB8888;
+  return CH_SUCCESS;
+}
+#endif /* ASSETS_USE_DMA2D */
+
+/** @} */
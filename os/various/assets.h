@@ -0,0 +1,119 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    assets.h
+ * @brief   Compressed assets archive macros and structures.
+ *
+ * @addtogroup assets
+ * @{
+ */
+
+#ifndef _ASSETS_H_
+#define _ASSETS_H_
+
+/**
+ * @brief   Enables the DMA2D CLUT loading helper.
+ */
+#if !defined(ASSETS_USE_DMA2D) || defined(__DOXYGEN__)
+#define ASSETS_USE_DMA2D            TRUE
+#endif
+
+#if ASSETS_USE_DMA2D
+#include "stm32_dma2d.h"
+
+/*
+ * Module dependencies check.
+ */
+#if !STM32_DMA2D_USE_DMA2D
+#error "ASSETS_USE_DMA2D requires the DMA2D driver"
+#endif
+#endif /* ASSETS_USE_DMA2D */
+
+/**
+ * @name    Archive identification
+ * @{
+ */
+#define ASSET_MAGIC                 0x54455341  /**< @brief "ASET".         */
+#define ASSET_VERSION               1
+/** @} */
+
+/**
+ * @name    Asset codecs
+ * @{
+ */
+#define ASSET_CODEC_STORE           0   /**< @brief Uncompressed.           */
+#define ASSET_CODEC_RLE             1   /**< @brief Byte run length.        */
+#define ASSET_CODEC_LZ4             2   /**< @brief LZ4 block.              */
+/** @} */
+
+/**
+ * @name    Asset formats
+ * @{
+ */
+#define ASSET_FMT_RAW               0   /**< @brief Opaque bytes.           */
+#define ASSET_FMT_L8                1   /**< @brief 8 bits indexed pixels.  */
+#define ASSET_FMT_RGB888            2   /**< @brief 24 bits pixels.         */
+#define ASSET_FMT_ARGB8888          3   /**< @brief 32 bits pixels.         */
+#define ASSET_FMT_PALETTE           4   /**< @brief RGB-888 entries, the
+                                             width is the entries count.    */
+/** @} */
+
+/**
+ * @brief   Archive header.
+ * @details The header is followed by the entries table, packed data is
+ *          aligned to 4 bytes.
+ */
+typedef struct {
+  uint32_t              ah_magic;           /**< @brief @p ASSET_MAGIC.     */
+  uint16_t              ah_version;         /**< @brief @p ASSET_VERSION.   */
+  uint16_t              ah_count;           /**< @brief Number of assets.   */
+} AssetHeader;
+
+/**
+ * @brief   Archive entry.
+ */
+typedef struct {
+  uint32_t              ae_offset;          /**< @brief Packed data offset
+                                                 from the archive start.    */
+  uint32_t              ae_packed;          /**< @brief Packed size.        */
+  uint32_t              ae_size;            /**< @brief Unpacked size.      */
+  uint16_t              ae_width;           /**< @brief Width, in pixels.   */
+  uint16_t              ae_height;          /**< @brief Height, in pixels.  */
+  uint8_t               ae_codec;           /**< @brief Codec.              */
+  uint8_t               ae_format;          /**< @brief Format.             */
+  uint16_t              ae_reserved;        /**< @brief Reserved, zero.     */
+} AssetEntry;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  const AssetEntry *assetGet(const uint8_t *archive, unsigned id);
+  bool_t assetDecode(const uint8_t *archive, unsigned id,
+                     void *dstp, size_t pitch);
+  bool_t assetDecodePalette(const uint8_t *archive, unsigned id,
+                            uint32_t *colors, size_t n);
+#if ASSETS_USE_DMA2D
+  bool_t assetLoadClut(const uint8_t *archive, unsigned id,
+                       uint32_t *colors, size_t n, dma2d_palcfg_t *palcfgp);
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ASSETS_H_ */
+
+/** @} */
@@ -0,0 +1,530 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    blkcache.c
+ * @brief   Block cache code.
+ *
+ * @addtogroup blkcache
+ * @{
+ */
+
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "blkcache.h"
+
+#define DEVICE(bcp) ((bcp)->config->blkp)
+#define LRU_END(bcp) (&(bcp)->lru)
+#define LRU_FIRST(bcp) ((bcp)->lru.ce_next)
+#define LRU_LAST(bcp) ((bcp)->lru.ce_prev)
+
+/*
+ * Moves an entry in front of the LRU list.
+ */
+static void lru_touch(BlockCache *bcp, BlockCacheEntry *ep) {
+
+  ep->ce_prev->ce_next = ep->ce_next;
+  ep->ce_next->ce_prev = ep->ce_prev;
+  ep->ce_next = LRU_FIRST(bcp);
+  ep->ce_prev = LRU_END(bcp);
+  LRU_FIRST(bcp)->ce_prev = ep;
+  LRU_FIRST(bcp) = ep;
+}
+
+static BlockCacheEntry *lookup(BlockCache *bcp, uint32_t block) {
+  BlockCacheEntry *ep;
+
+  for (ep = LRU_FIRST(bcp); ep != LRU_END(bcp); ep = ep->ce_next)
+    if (ep->ce_block == block)
+      return ep;
+  return NULL;
+}
+
+static bool_t is_pinned(BlockCache *bcp, uint32_t block) {
+  unsigned i;
+
+  for (i = 0; i < BLKCACHE_PIN_RANGES; i++)
+    if (block - bcp->pins[i][0] < bcp->pins[i][1])
+      return TRUE;
+  return FALSE;
+}
+
+static bool_t in_window(BlockCache *bcp, uint32_t block) {
+
+  return block - bcp->ra_start < bcp->ra_count;
+}
+
+/*
+ * Returns the device size, it is read the first time the device is found
+ * ready. Zero means that the size is not known yet.
+ */
+static uint32_t device_blocks(BlockCache *bcp) {
+  BlockDeviceInfo bdi;
+
+  if ((bcp->blocks == 0) && (blkGetDriverState(DEVICE(bcp)) == BLK_READY) &&
+      !blkGetInfo(DEVICE(bcp), &bdi) && (bdi.blk_size == BLKCACHE_BLOCK_SIZE))
+    bcp->blocks = bdi.blk_num;
+  return bcp->blocks;
+}
+
+/*
+ * Drops the window if it holds any of the specified blocks.
+ */
+static void window_invalidate(BlockCache *bcp, uint32_t startblk, uint32_t n) {
+
+  if ((bcp->ra_count > 0) && (startblk < bcp->ra_start + bcp->ra_count) &&
+      (bcp->ra_start < startblk + n))
+    bcp->ra_count = 0;
+}
+
+/*
+ * Writes a dirty entry along with the adjacent dirty blocks, the run is
+ * staged in the window and written with a single operation.
+ */
+static bool_t flush_run(BlockCache *bcp, BlockCacheEntry *ep) {
+  const BlockCacheConfig *cfgp = bcp->config;
+  BlockCacheEntry *np;
+  uint32_t first, n;
+
+  /* Without a window the entry is written alone.*/
+  if ((cfgp->window == NULL) || (cfgp->window_n < 2)) {
+    bcp->stats.bs_writes++;
+    bcp->stats.bs_written++;
+    if (blkWrite(DEVICE(bcp), ep->ce_block, ep->ce_data, 1))
+      return CH_FAILED;
+    ep->ce_dirty = FALSE;
+    return CH_SUCCESS;
+  }
+
+  /* Searching the first block of the run.*/
+  first = ep->ce_block;
+  while ((first > 0) && ((np = lookup(bcp, first - 1)) != NULL) &&
+         np->ce_dirty && (ep->ce_block - (first - 1) < cfgp->window_n))
+    first--;
+
+  /* Staging the run.*/
+  bcp->ra_count = 0;
+  n = 0;
+  while ((n < cfgp->window_n) && ((np = lookup(bcp, first + n)) != NULL) &&
+         np->ce_dirty) {
+    memcpy(cfgp->window + n * BLKCACHE_BLOCK_SIZE, np->ce_data,
+           BLKCACHE_BLOCK_SIZE);
+    n++;
+  }
+
+  bcp->stats.bs_writes++;
+  bcp->stats.bs_written += n;
+  bcp->stats.bs_coalesced += n - 1;
+  if (blkWrite(DEVICE(bcp), first, cfgp->window, n))
+    return CH_FAILED;
+  while (n > 0) {
+    n--;
+    lookup(bcp, first + n)->ce_dirty = FALSE;
+  }
+  return CH_SUCCESS;
+}
+
+/*
+ * Returns an entry for a block not in cache, the least recently used entry
+ * not pinned is reused, pinned entries only if there is no other choice.
+ */
+static BlockCacheEntry *allocate(BlockCache *bcp, uint32_t block) {
+  BlockCacheEntry *ep;
+
+  for (ep = LRU_LAST(bcp); ep != LRU_END(bcp); ep = ep->ce_prev)
+    if ((ep->ce_block == BLKCACHE_NO_BLOCK) || !is_pinned(bcp, ep->ce_block))
+      break;
+  if (ep == LRU_END(bcp))
+    ep = LRU_LAST(bcp);
+  if (ep->ce_block != BLKCACHE_NO_BLOCK) {
+    if (ep->ce_dirty && flush_run(bcp, ep))
+      return NULL;
+    bcp->stats.bs_evictions++;
+  }
+  ep->ce_block = block;
+  ep->ce_dirty = FALSE;
+  lru_touch(bcp, ep);
+  return ep;
+}
+
+static bool_t bc_is_inserted(void *ip) {
+
+  return blkIsInserted(DEVICE((BlockCache *)ip));
+}
+
+static bool_t bc_is_protected(void *ip) {
+
+  return blkIsWriteProtected(DEVICE((BlockCache *)ip));
+}
+
+static bool_t bc_connect(void *ip) {
+  BlockCache *bcp = (BlockCache *)ip;
+
+  bcacheInvalidate(bcp);
+  /* The device could have been replaced, its size is read again.*/
+  bcp->blocks = 0;
+  return blkConnect(DEVICE(bcp));
+}
+
+static bool_t bc_disconnect(void *ip) {
+  BlockCache *bcp = (BlockCache *)ip;
+  bool_t err;
+
+  err = bcacheFlush(bcp);
+  bcacheInvalidate(bcp);
+  return blkDisconnect(DEVICE(bcp)) || err;
+}
+
+static bool_t bc_read(void *ip, uint32_t startblk, uint8_t *buf, uint32_t n) {
+  BlockCache *bcp = (BlockCache *)ip;
+  const BlockCacheConfig *cfgp = bcp->config;
+  BlockCacheEntry *ep;
+  bool_t sequential;
+  uint32_t run;
+
+  sequential = startblk == bcp->next_read;
+  bcp->next_read = startblk + n;
+  while (n > 0) {
+    ep = lookup(bcp, startblk);
+    if (ep != NULL) {
+      memcpy(buf, ep->ce_data, BLKCACHE_BLOCK_SIZE);
+      lru_touch(bcp, ep);
+      bcp->stats.bs_hits++;
+      run = 1;
+    }
+    else if (in_window(bcp, startblk)) {
+      memcpy(buf, cfgp->window +
+                  (startblk - bcp->ra_start) * BLKCACHE_BLOCK_SIZE,
+             BLKCACHE_BLOCK_SIZE);
+      bcp->stats.bs_ra_hits++;
+      run = 1;
+    }
+    else {
+      /* Runs of uncached blocks are read straight into the buffer.*/
+      run = 1;
+      while ((run < n) && (lookup(bcp, startblk + run) == NULL) &&
+             !in_window(bcp, startblk + run))
+        run++;
+      bcp->stats.bs_reads++;
+      if (run > 1) {
+        bcp->stats.bs_misses += run;
+        if (blkRead(DEVICE(bcp), startblk, buf, run))
+          return CH_FAILED;
+      }
+      else if (sequential && (cfgp->window != NULL) &&
+               !is_pinned(bcp, startblk) &&
+               (device_blocks(bcp) > startblk)) {
+        /* Sequential access, the window is filled ahead without crossing
+           the device end.*/
+        bcp->stats.bs_misses++;
+        bcp->ra_count = 0;
+        bcp->ra_start = startblk;
+        run = cfgp->window_n;
+        if (run > bcp->blocks - startblk)
+          run = bcp->blocks - startblk;
+        if (blkRead(DEVICE(bcp), startblk, cfgp->window, run))
+          return CH_FAILED;
+        bcp->ra_count = run;
+        memcpy(buf, cfgp->window, BLKCACHE_BLOCK_SIZE);
+        run = 1;
+      }
+      else {
+        bcp->stats.bs_misses++;
+        ep = allocate(bcp, startblk);
+        if (ep == NULL)
+          return CH_FAILED;
+        if (blkRead(DEVICE(bcp), startblk, ep->ce_data, 1)) {
+          ep->ce_block = BLKCACHE_NO_BLOCK;
+          return CH_FAILED;
+        }
+        memcpy(buf, ep->ce_data, BLKCACHE_BLOCK_SIZE);
+      }
+    }
+    startblk += run;
+    buf += run * BLKCACHE_BLOCK_SIZE;
+    n -= run;
+  }
+  return CH_SUCCESS;
+}
+
+static bool_t bc_write(void *ip, uint32_t startblk,
+                       const uint8_t *buf, uint32_t n) {
+  BlockCache *bcp = (BlockCache *)ip;
+  BlockCacheEntry *ep;
+  bool_t err;
+  uint32_t i;
+
+  window_invalidate(bcp, startblk, n);
+
+  /* Multiple blocks are written through, cached copies are updated and
+     stay dirty only if the write failed.*/
+  if (n > 1) {
+    bcp->stats.bs_writes++;
+    bcp->stats.bs_written += n;
+    err = blkWrite(DEVICE(bcp), startblk, buf, n);
+    for (i = 0; i < n; i++) {
+      ep = lookup(bcp, startblk + i);
+      if (ep != NULL) {
+        memcpy(ep->ce_data, buf + i * BLKCACHE_BLOCK_SIZE,
+               BLKCACHE_BLOCK_SIZE);
+        ep->ce_dirty = err;
+      }
+    }
+    return err;
+  }
+
+  /* Single blocks are written back later.*/
+  ep = lookup(bcp, startblk);
+  if (ep != NULL)
+    lru_touch(bcp, ep);
+  else if ((ep = allocate(bcp, startblk)) == NULL)
+    return CH_FAILED;
+  memcpy(ep->ce_data, buf, BLKCACHE_BLOCK_SIZE);
+  ep->ce_dirty = TRUE;
+  return CH_SUCCESS;
+}
+
+static bool_t bc_sync(void *ip) {
+  BlockCache *bcp = (BlockCache *)ip;
+
+  if (bcacheFlush(bcp))
+    return CH_FAILED;
+  return blkSync(DEVICE(bcp));
+}
+
+static bool_t bc_get_info(void *ip, BlockDeviceInfo *bdip) {
+
+  return blkGetInfo(DEVICE((BlockCache *)ip), bdip);
+}
+
+/*
+ * Virtual methods table.
+ */
+static const struct BlockCacheVMT bcache_vmt = {
+  bc_is_inserted,
+  bc_is_protected,
+  bc_connect,
+  bc_disconnect,
+  bc_read,
+  bc_write,
+  bc_sync,
+  bc_get_info
+};
+
+/**
+ * @brief   Initializes a @p BlockCache object.
+ *
+ * @param[out] bcp      pointer to the @p BlockCache object
+ *
+ * @init
+ */
+void bcacheObjectInit(BlockCache *bcp) {
+
+  bcp->vmt = &bcache_vmt;
+  bcp->state = BLK_STOP;
+  bcp->config = NULL;
+  LRU_FIRST(bcp) = LRU_LAST(bcp) = LRU_END(bcp);
+  bcacheUnpinAll(bcp);
+  bcacheResetStats(bcp);
+}
+
+/**
+ * @brief   Starts caching a block device.
+ * @details The cache starts empty, the device size is read if the device
+ *          is ready in order to clamp the read-ahead. Otherwise it is read
+ *          once the device becomes ready, there is no read-ahead until
+ *          then.
+ *
+ * @param[in] bcp       pointer to the @p BlockCache object
+ * @param[in] config    pointer to the @p BlockCacheConfig object
+ * @return              The operation status.
+ * @retval CH_SUCCESS   operation succeeded.
+ * @retval CH_FAILED    the device block size is not
+ *                      @p BLKCACHE_BLOCK_SIZE.
+ *
+ * @api
+ */
+bool_t bcacheStart(BlockCache *bcp, const BlockCacheConfig *config) {
+  BlockDeviceInfo bdi;
+  uint32_t i;
+
+  chDbgCheck((bcp != NULL) && (config != NULL) && (config->blkp != NULL) &&
+             (config->entries != NULL) && (config->buffer != NULL) &&
+             (config->n > 0), "bcacheStart");
+
+  bcp->config = config;
+  LRU_FIRST(bcp) = LRU_LAST(bcp) = LRU_END(bcp);
+  for (i = 0; i < config->n; i++) {
+    BlockCacheEntry *ep = &config->entries[i];
+
+    ep->ce_data = config->buffer + i * BLKCACHE_BLOCK_SIZE;
+    ep->ce_next = LRU_END(bcp);
+    ep->ce_prev = LRU_LAST(bcp);
+    LRU_LAST(bcp)->ce_next = ep;
+    LRU_LAST(bcp) = ep;
+  }
+  bcacheInvalidate(bcp);
+  bcp->blocks = 0;
+  if (blkGetDriverState(config->blkp) == BLK_READY) {
+    if (blkGetInfo(config->blkp, &bdi) ||
+        (bdi.blk_size != BLKCACHE_BLOCK_SIZE))
+      return CH_FAILED;
+    bcp->blocks = bdi.blk_num;
+  }
+  bcp->state = BLK_READY;
+  return CH_SUCCESS;
+}
+
+/**
+ * @brief   Stops caching.
+ * @details The dirty blocks are written before stopping.
+ *
+ * @param[in] bcp       pointer to the @p BlockCache object
+ * @return              The operation status.
+ * @retval CH_SUCCESS   operation succeeded.
+ * @retval CH_FAILED    a dirty block could not be written, the cache is
+ *                      stopped anyway.
+ *
+ * @api
+ */
+bool_t bcacheStop(BlockCache *bcp) {
+  bool_t err;
+
+  chDbgCheck(bcp != NULL, "bcacheStop");
+
+  err = bcacheFlush(bcp);
+  bcacheInvalidate(bcp);
+  bcp->state = BLK_STOP;
+  return err;
+}
+
+/**
+ * @brief   Pins a range of blocks.
+ * @details Pinned blocks are evicted only when all the entries are pinned,
+ *          file systems metadata like the FAT and directories should be
+ *          pinned. Pinned blocks are never read ahead.
+ *
+ * @param[in] bcp       pointer to the @p BlockCache object
+ * @param[in] startblk  first block of the range
+ * @param[in] n         number of blocks
+ * @return              The operation status.
+ * @retval CH_SUCCESS   operation succeeded.
+ * @retval CH_FAILED    all the @p BLKCACHE_PIN_RANGES ranges are in use.
+ *
+ * @api
+ */
+bool_t bcachePin(BlockCache *bcp, uint32_t startblk, uint32_t n) {
+  unsigned i;
+
+  chDbgCheck(bcp != NULL, "bcachePin");
+
+  for (i = 0; i < BLKCACHE_PIN_RANGES; i++) {
+    if (bcp->pins[i][1] == 0) {
+      bcp->pins[i][0] = startblk;
+      bcp->pins[i][1] = n;
+      return CH_SUCCESS;
+    }
+  }
+  return CH_FAILED;
+}
+
+/**
+ * @brief   Removes all the pinned ranges.
+ *
+ * @param[in] bcp       pointer to the @p BlockCache object
+ *
+ * @api
+ */
+void bcacheUnpinAll(BlockCache *bcp) {
+
+  chDbgCheck(bcp != NULL, "bcacheUnpinAll");
+
+  memset(bcp->pins, 0, sizeof bcp->pins);
+}
+
+/**
+ * @brief   Writes all the dirty blocks.
+ * @details Blocks are written in ascending order, adjacent dirty blocks
+ *          are coalesced in multiple blocks writes.
+ * @note    The device is not synchronized, @p blkSync() on the cache also
+ *          does that.
+ *
+ * @param[in] bcp       pointer to the @p BlockCache object
+ * @return              The operation status.
+ * @retval CH_SUCCESS   operation succeeded.
+ * @retval CH_FAILED    a write operation failed, the blocks not written are
+ *                      still dirty.
+ *
+ * @api
+ */
+bool_t bcacheFlush(BlockCache *bcp) {
+  BlockCacheEntry *ep, *first;
+
+  chDbgCheck(bcp != NULL, "bcacheFlush");
+
+  if (bcp->config == NULL)
+    return CH_SUCCESS;
+  while (TRUE) {
+    first = NULL;
+    for (ep = LRU_FIRST(bcp); ep != LRU_END(bcp); ep = ep->ce_next)
+      if (ep->ce_dirty && ((first == NULL) || (ep->ce_block < first->ce_block)))
+        first = ep;
+    if (first == NULL)
+      return CH_SUCCESS;
+    if (flush_run(bcp, first))
+      return CH_FAILED;
+  }
+}
+
+/**
+ * @brief   Discards the cached blocks.
+ * @note    Dirty blocks are lost, use @p bcacheFlush() before.
+ *
+ * @param[in] bcp       pointer to the @p BlockCache object
+ *
+ * @api
+ */
+void bcacheInvalidate(BlockCache *bcp) {
+  BlockCacheEntry *ep;
+
+  chDbgCheck(bcp != NULL, "bcacheInvalidate");
+
+  for (ep = LRU_FIRST(bcp); ep != LRU_END(bcp); ep = ep->ce_next) {
+    ep->ce_block = BLKCACHE_NO_BLOCK;
+    ep->ce_dirty = FALSE;
+  }
+  bcp->next_read = BLKCACHE_NO_BLOCK;
+  bcp->ra_start = 0;
+  bcp->ra_count = 0;
+}
+
+/**
+ * @brief   Clears the statistics.
+ *
+ * @param[in] bcp       pointer to the @p BlockCache object
+ *
+ * @api
+ */
+void bcacheResetStats(BlockCache *bcp) {
+
+  chDbgCheck(bcp != NULL, "bcacheResetStats");
+
+  memset(&bcp->stats, 0, sizeof bcp->stats);
+}
+
+/** @} */
@@ -0,0 +1,208 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    blkcache.h
+ * @brief   Block cache macros and structures.
+ *
+ * @addtogroup blkcache
+ * @{
+ */
+
+#ifndef _BLKCACHE_H_
+#define _BLKCACHE_H_
+
+/**
+ * @brief   Cached block size.
+ * @note    The underlying device must have the same block size.
+ */
+#if !defined(BLKCACHE_BLOCK_SIZE) || defined(__DOXYGEN__)
+#define BLKCACHE_BLOCK_SIZE         512
+#endif
+
+/**
+ * @brief   Maximum number of pinned ranges.
+ */
+#if !defined(BLKCACHE_PIN_RANGES) || defined(__DOXYGEN__)
+#define BLKCACHE_PIN_RANGES         2
+#endif
+
+/**
+ * @brief   Block number of an unused entry.
+ */
+#define BLKCACHE_NO_BLOCK           0xFFFFFFFFU
+
+/**
+ * @brief   Type of a cache entry.
+ */
+typedef struct BlockCacheEntry BlockCacheEntry;
+
+/**
+ * @brief   Cache entry structure.
+ * @note    Entries are linked in LRU order, the most recently used first.
+ */
+struct BlockCacheEntry {
+  BlockCacheEntry       *ce_next;           /**< @brief Next entry.         */
+  BlockCacheEntry       *ce_prev;           /**< @brief Previous entry.     */
+  uint32_t              ce_block;           /**< @brief Cached block or
+                                                 @p BLKCACHE_NO_BLOCK.      */
+  bool_t                ce_dirty;           /**< @brief Not yet written.    */
+  uint8_t               *ce_data;           /**< @brief Block data.         */
+};
+
+/**
+ * @brief   Block cache configuration structure.
+ */
+typedef struct {
+  /**
+   * @brief   Underlying block device.
+   */
+  BaseBlockDevice       *blkp;
+  /**
+   * @brief   Array of @p n cache entries.
+   */
+  BlockCacheEntry       *entries;
+  /**
+   * @brief   Blocks buffer, @p n blocks.
+   */
+  uint8_t               *buffer;
+  /**
+   * @brief   Number of cached blocks.
+   */
+  uint32_t              n;
+  /**
+   * @brief   Window buffer, @p window_n blocks.
+   * @details The window holds the blocks read ahead of a sequential read
+   *          and stages the adjacent dirty blocks written in a single
+   *          operation. It can be @p NULL, read-ahead and write coalescing
+   *          are disabled then.
+   */
+  uint8_t               *window;
+  /**
+   * @brief   Number of window blocks.
+   */
+  uint32_t              window_n;
+} BlockCacheConfig;
+
+/**
+ * @brief   Block cache statistics.
+ */
+typedef struct {
+  uint32_t              bs_hits;            /**< @brief Blocks read from the
+                                                 cache.                     */
+  uint32_t              bs_ra_hits;         /**< @brief Blocks read from the
+                                                 read-ahead window.         */
+  uint32_t              bs_misses;          /**< @brief Blocks read from the
+                                                 device.                    */
+  uint32_t              bs_reads;           /**< @brief Device read
+                                                 operations.                */
+  uint32_t              bs_writes;          /**< @brief Device write
+                                                 operations.                */
+  uint32_t              bs_written;         /**< @brief Blocks written to the
+                                                 device.                    */
+  uint32_t              bs_coalesced;       /**< @brief Dirty blocks written
+                                                 along with a neighbour.    */
+  uint32_t              bs_evictions;       /**< @brief Entries reused.     */
+} BlockCacheStats;
+
+/**
+ * @brief   @p BlockCache specific methods.
+ */
+#define _block_cache_methods                                                \
+  _base_block_device_methods
+
+/**
+ * @brief   @p BlockCache virtual methods table.
+ */
+struct BlockCacheVMT {
+  _block_cache_methods
+};
+
+/**
+ * @brief   Block cache object.
+ * @details The cache is itself a block device and can be used in place of
+ *          the device it caches.
+ * @note    Accesses are not serialized, the cache must be used by a single
+ *          thread or under an external lock.
+ */
+typedef struct {
+  /**
+   * @brief   Virtual Methods Table.
+   */
+  const struct BlockCacheVMT *vmt;
+  _base_block_device_data
+  /**
+   * @brief   Current configuration data.
+   */
+  const BlockCacheConfig *config;
+  /**
+   * @brief   Entries list header, only the links are used.
+   */
+  BlockCacheEntry       lru;
+  /**
+   * @brief   Underlying device size, in blocks.
+   */
+  uint32_t              blocks;
+  /**
+   * @brief   Block following the last read operation.
+   */
+  uint32_t              next_read;
+  /**
+   * @brief   First block held by the window.
+   */
+  uint32_t              ra_start;
+  /**
+   * @brief   Number of blocks held by the window.
+   */
+  uint32_t              ra_count;
+  /**
+   * @brief   Pinned ranges, first block and number of blocks.
+   */
+  uint32_t              pins[BLKCACHE_PIN_RANGES][2];
+  /**
+   * @brief   Statistics.
+   */
+  BlockCacheStats       stats;
+} BlockCache;
+
+/**
+ * @brief   Returns the cache statistics.
+ *
+ * @param[in] bcp       pointer to the @p BlockCache object
+ * @return              Pointer to the @p BlockCacheStats structure.
+ *
+ * @special
+ */
+#define bcacheGetStats(bcp) (&(bcp)->stats)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void bcacheObjectInit(BlockCache *bcp);
+  bool_t bcacheStart(BlockCache *bcp, const BlockCacheConfig *config);
+  bool_t bcacheStop(BlockCache *bcp);
+  bool_t bcachePin(BlockCache *bcp, uint32_t startblk, uint32_t n);
+  void bcacheUnpinAll(BlockCache *bcp);
+  bool_t bcacheFlush(BlockCache *bcp);
+  void bcacheInvalidate(BlockCache *bcp);
+  void bcacheResetStats(BlockCache *bcp);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BLKCACHE_H_ */
+
+/** @} */
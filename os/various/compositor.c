@@ -0,0 +1,422 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    compositor.c
+ * @brief   Dirty rectangles compositor code.
+ *
+ * @addtogroup compositor
+ * @{
+ */
+
+#include "ch.h"
+#include "hal.h"
+#include "compositor.h"
+
+static uint32_t rect_area(const CompRect *rp) {
+
+  return (uint32_t)(rp->cr_x2 - rp->cr_x1) * (rp->cr_y2 - rp->cr_y1);
+}
+
+static void rect_union(CompRect *dp, const CompRect *rp) {
+
+  if (rp->cr_x1 < dp->cr_x1) dp->cr_x1 = rp->cr_x1;
+  if (rp->cr_y1 < dp->cr_y1) dp->cr_y1 = rp->cr_y1;
+  if (rp->cr_x2 > dp->cr_x2) dp->cr_x2 = rp->cr_x2;
+  if (rp->cr_y2 > dp->cr_y2) dp->cr_y2 = rp->cr_y2;
+}
+
+static bool_t rect_intersect(CompRect *dp, const CompRect *rp) {
+
+  if (rp->cr_x1 > dp->cr_x1) dp->cr_x1 = rp->cr_x1;
+  if (rp->cr_y1 > dp->cr_y1) dp->cr_y1 = rp->cr_y1;
+  if (rp->cr_x2 < dp->cr_x2) dp->cr_x2 = rp->cr_x2;
+  if (rp->cr_y2 < dp->cr_y2) dp->cr_y2 = rp->cr_y2;
+  return (dp->cr_x1 < dp->cr_x2) && (dp->cr_y1 < dp->cr_y2);
+}
+
+static bool_t rect_contains(const CompRect *rp, const CompRect *ip) {
+
+  return (ip->cr_x1 >= rp->cr_x1) && (ip->cr_y1 >= rp->cr_y1) &&
+         (ip->cr_x2 <= rp->cr_x2) && (ip->cr_y2 <= rp->cr_y2);
+}
+
+static void layer_rect(const CompLayer *lp, CompRect *rp) {
+
+  rp->cr_x1 = lp->cl_x;
+  rp->cr_y1 = lp->cl_y;
+  rp->cr_x2 = lp->cl_x + lp->cl_width;
+  rp->cr_y2 = lp->cl_y + lp->cl_height;
+}
+
+/*
+ * Adds a rectangle to a damaged area. Rectangles are merged as long as
+ * their bounding box does not cost more than redrawing them apart.
+ */
+static void damage_add(CompDamage *dp, CompRect r) {
+  uint8_t i, best;
+  uint32_t growth, least;
+
+  i = 0;
+  while (i < dp->cd_count) {
+    CompRect u = dp->cd_rects[i];
+
+    rect_union(&u, &r);
+    if (rect_area(&u) <= rect_area(&dp->cd_rects[i]) + rect_area(&r) +
+                         COMP_MERGE_SLACK) {
+      /* The merged rectangle could now absorb rectangles already
+         skipped, scanning again.*/
+      r = u;
+      dp->cd_rects[i] = dp->cd_rects[--dp->cd_count];
+      i = 0;
+    }
+    else
+      i++;
+  }
+
+  if (dp->cd_count < COMP_MAX_RECTS) {
+    dp->cd_rects[dp->cd_count++] = r;
+    return;
+  }
+
+  /* No room left, merging with the rectangle that grows the least.*/
+  best = 0;
+  least = 0xFFFFFFFF;
+  for (i = 0; i < dp->cd_count; i++) {
+    CompRect u = dp->cd_rects[i];
+
+    rect_union(&u, &r);
+    growth = rect_area(&u) - rect_area(&dp->cd_rects[i]);
+    if (growth < least) {
+      least = growth;
+      best = i;
+    }
+  }
+  rect_union(&r, &dp->cd_rects[best]);
+  dp->cd_rects[best] = dp->cd_rects[--dp->cd_count];
+  damage_add(dp, r);
+}
+
+/*
+ * Clips a screen rectangle and adds it to the damaged area of all the
+ * frame buffers.
+ */
+static void damage_screen(Compositor *compp, const CompRect *rp) {
+  const CompConfig *ccp = compp->co_config;
+  CompRect r = *rp;
+  CompRect screen = {0, 0, ccp->cc_width, ccp->cc_height};
+  uint8_t i;
+
+  if (!rect_intersect(&r, &screen))
+    return;
+
+  /* Output addresses must be aligned to the screen pixel format.*/
+  r.cr_x1 -= r.cr_x1 % compp->co_xalign;
+
+  for (i = 0; i < ccp->cc_nbuffers; i++)
+    damage_add(&compp->co_damage[i], r);
+}
+
+static uint32_t surface_bytes(dma2d_pixfmt_t fmt, uint32_t pixels) {
+
+  return (uint32_t)((pixels * dma2dBitsPerPixel(fmt) + 7) >> 3);
+}
+
+/*
+ * Accounts for a DMA2D job and submits it, nothing is submitted if the
+ * buffer is NULL.
+ */
+static void draw_job(Compositor *compp, void *bufferp, dma2d_jobmode_t mode,
+                     const CompLayer *lp, const CompRect *rp, CompStats *sp) {
+  const CompConfig *ccp = compp->co_config;
+  uint16_t width = rp->cr_x2 - rp->cr_x1;
+  uint16_t height = rp->cr_y2 - rp->cr_y1;
+  uint32_t pixels = (uint32_t)width * height;
+  dma2d_job_t *jobp;
+
+  sp->cs_jobs++;
+  sp->cs_bytes += surface_bytes(ccp->cc_fmt, pixels);
+  if (mode != DMA2D_JOB_CONST)
+    sp->cs_bytes += surface_bytes(lp->cl_source.fmt, pixels);
+  if (mode == DMA2D_JOB_BLEND)
+    sp->cs_bytes += surface_bytes(ccp->cc_fmt, pixels);
+  if (bufferp == NULL)
+    return;
+
+  jobp = dma2dJobAlloc(ccp->cc_dma2dp);
+  jobp->mode = mode;
+  jobp->width = width;
+  jobp->height = height;
+
+  jobp->out.bufferp = dma2dComputeAddress(
+    bufferp, ccp->cc_width * dma2dBytesPerPixel(ccp->cc_fmt), ccp->cc_fmt,
+    rp->cr_x1, rp->cr_y1
+  );
+  jobp->out.wrap_offset = ccp->cc_width - width;
+  jobp->out.fmt = ccp->cc_fmt;
+  jobp->out.def_color = ccp->cc_clear;
+  jobp->out.const_alpha = 0xFF;
+  jobp->out.palettep = NULL;
+
+  if (mode != DMA2D_JOB_CONST) {
+    size_t pitch = (lp->cl_width + lp->cl_source.wrap_offset) *
+                   dma2dBitsPerPixel(lp->cl_source.fmt) / 8;
+
+    jobp->fg = lp->cl_source;
+    jobp->fg.bufferp = dma2dComputeAddress(
+      lp->cl_source.bufferp, pitch, lp->cl_source.fmt,
+      rp->cr_x1 - lp->cl_x, rp->cr_y1 - lp->cl_y
+    );
+    jobp->fg.wrap_offset = lp->cl_source.wrap_offset + lp->cl_width - width;
+    jobp->fg_amode = lp->cl_amode;
+  }
+
+  if (mode == DMA2D_JOB_BLEND) {
+    /* The layers below are read back from the frame buffer.*/
+    jobp->bg = jobp->out;
+    jobp->bg_amode = DMA2D_ALPHA_KEEP;
+  }
+
+  jobp->callback = NULL;
+  jobp->arg = NULL;
+#if CH_USE_EVENTS
+  jobp->esp = NULL;
+#endif
+  dma2dJobSubmit(ccp->cc_dma2dp, jobp);
+}
+
+/*
+ * Redraws a screen rectangle with the minimal set of jobs, the layers
+ * below the topmost opaque layer covering the whole rectangle are skipped.
+ */
+static void draw_rect(Compositor *compp, void *bufferp, const CompRect *rp,
+                      CompStats *sp) {
+  uint8_t i, first = 0;
+  bool_t covered = FALSE;
+  CompRect r;
+
+  i = compp->co_nlayers;
+  while (i-- > 0) {
+    const CompLayer *lp = &compp->co_layers[i];
+
+    layer_rect(lp, &r);
+    if (lp->cl_visible && !lp->cl_blend && rect_contains(&r, rp)) {
+      first = i;
+      covered = TRUE;
+      break;
+    }
+  }
+  if (!covered)
+    draw_job(compp, bufferp, DMA2D_JOB_CONST, NULL, rp, sp);
+
+  for (i = first; i < compp->co_nlayers; i++) {
+    const CompLayer *lp = &compp->co_layers[i];
+    dma2d_jobmode_t mode;
+
+    if (!lp->cl_visible)
+      continue;
+    layer_rect(lp, &r);
+    if (!rect_intersect(&r, rp))
+      continue;
+    if (lp->cl_blend)
+      mode = DMA2D_JOB_BLEND;
+    else if (lp->cl_source.fmt != compp->co_config->cc_fmt)
+      mode = DMA2D_JOB_CONVERT;
+    else
+      mode = DMA2D_JOB_COPY;
+    draw_job(compp, bufferp, mode, lp, &r, sp);
+  }
+  sp->cs_rects++;
+}
+
+/**
+ * @brief   Initializes a @p Compositor object.
+ * @details All the frame buffers are marked as entirely damaged.
+ * @note    Layers must be horizontally positioned on multiples of the
+ *          screen format alignment, 4 pixels for RGB-888.
+ *
+ * @param[out] compp    pointer to the @p Compositor object
+ * @param[in] ccp       pointer to the @p CompConfig object
+ * @param[in] layers    layers stack, bottom first
+ * @param[in] n         number of layers
+ */
+void compObjectInit(Compositor *compp, const CompConfig *ccp,
+                    CompLayer *layers, uint8_t n) {
+  CompRect screen = {0, 0, ccp->cc_width, ccp->cc_height};
+  uint8_t i;
+
+  chDbgCheck((compp != NULL) && (ccp != NULL) && (layers != NULL) &&
+             (ccp->cc_nbuffers > 0) &&
+             (ccp->cc_nbuffers <= COMP_MAX_BUFFERS), "compObjectInit");
+
+  compp->co_config = ccp;
+  compp->co_layers = layers;
+  compp->co_nlayers = n;
+  compp->co_xalign = ccp->cc_fmt == DMA2D_FMT_RGB888 ? 4 : 1;
+  for (i = 0; i < n; i++)
+    chDbgAssert(layers[i].cl_x % compp->co_xalign == 0,
+                "compObjectInit(), #1", "not aligned");
+  for (i = 0; i < COMP_MAX_BUFFERS; i++)
+    compp->co_damage[i].cd_count = 0;
+  compp->co_stats.cs_rects = 0;
+  compp->co_stats.cs_jobs = 0;
+  compp->co_stats.cs_bytes = 0;
+  compp->co_stats.cs_full_bytes = 0;
+  damage_screen(compp, &screen);
+}
+
+/**
+ * @brief   Marks a screen area as damaged.
+ *
+ * @param[in] compp     pointer to the @p Compositor object
+ * @param[in] rp        screen rectangle, or @p NULL for the whole screen
+ */
+void compInvalidate(Compositor *compp, const CompRect *rp) {
+  CompRect screen = {0, 0, compp->co_config->cc_width,
+                     compp->co_config->cc_height};
+
+  damage_screen(compp, rp != NULL ? rp : &screen);
+}
+
+/**
+ * @brief   Marks a layer area as damaged.
+ * @details Used when the source image of the layer has been modified.
+ *
+ * @param[in] compp     pointer to the @p Compositor object
+ * @param[in] layer     layer index
+ * @param[in] rp        rectangle in layer coordinates, or @p NULL for the
+ *                      whole layer
+ */
+void compLayerInvalidate(Compositor *compp, uint8_t layer,
+                         const CompRect *rp) {
+  const CompLayer *lp;
+  CompRect r;
+
+  chDbgCheck((compp != NULL) && (layer < compp->co_nlayers),
+             "compLayerInvalidate");
+
+  lp = &compp->co_layers[layer];
+  if (!lp->cl_visible)
+    return;
+  layer_rect(lp, &r);
+  if (rp != NULL) {
+    CompRect s = {lp->cl_x + rp->cr_x1, lp->cl_y + rp->cr_y1,
+                  lp->cl_x + rp->cr_x2, lp->cl_y + rp->cr_y2};
+
+    if (!rect_intersect(&r, &s))
+      return;
+  }
+  damage_screen(compp, &r);
+}
+
+/**
+ * @brief   Moves a layer.
+ * @details Both the old and the new layer areas are marked as damaged.
+ *
+ * @param[in] compp     pointer to the @p Compositor object
+ * @param[in] layer     layer index
+ * @param[in] x         new horizontal screen position, aligned
+ * @param[in] y         new vertical screen position
+ */
+void compLayerMove(Compositor *compp, uint8_t layer, uint16_t x, uint16_t y) {
+  CompLayer *lp;
+
+  chDbgCheck((compp != NULL) && (layer < compp->co_nlayers),
+             "compLayerMove");
+  chDbgAssert(x % compp->co_xalign == 0,
+              "compLayerMove(), #1", "not aligned");
+
+  lp = &compp->co_layers[layer];
+  if ((lp->cl_x == x) && (lp->cl_y == y))
+    return;
+  compLayerInvalidate(compp, layer, NULL);
+  lp->cl_x = x;
+  lp->cl_y = y;
+  compLayerInvalidate(compp, layer, NULL);
+}
+
+/**
+ * @brief   Shows or hides a layer.
+ *
+ * @param[in] compp     pointer to the @p Compositor object
+ * @param[in] layer     layer index
+ * @param[in] visible   layer visibility
+ */
+void compLayerSetVisible(Compositor *compp, uint8_t layer, bool_t visible) {
+  CompLayer *lp;
+
+  chDbgCheck((compp != NULL) && (layer < compp->co_nlayers),
+             "compLayerSetVisible");
+
+  lp = &compp->co_layers[layer];
+  if (lp->cl_visible == visible)
+    return;
+  /* Invalidating while the layer is visible.*/
+  lp->cl_visible = TRUE;
+  compLayerInvalidate(compp, layer, NULL);
+  lp->cl_visible = visible;
+}
+
+/**
+ * @brief   Composes a frame buffer.
+ * @details Redraws the area damaged since the buffer was last composed and
+ *          waits for the queued DMA2D jobs to complete. The statistics of
+ *          the frame are updated.
+ * @pre     The DMA2D driver must be started with a jobs pool, if shared it
+ *          must be owned by the invoking thread.
+ *
+ * @param[in] compp     pointer to the @p Compositor object
+ * @param[in] bufferp   frame buffer, one of the configured ones
+ * @return              The DMA2D queue outcome.
+ * @retval RDY_OK       if all the jobs completed.
+ * @retval RDY_RESET    if a job failed.
+ */
+msg_t compRender(Compositor *compp, void *bufferp) {
+  const CompConfig *ccp;
+  CompRect screen;
+  CompDamage *dp;
+  CompStats full = {0, 0, 0, 0};
+  uint8_t i;
+
+  chDbgCheck((compp != NULL) && (bufferp != NULL), "compRender");
+
+  ccp = compp->co_config;
+  for (i = 0; i < ccp->cc_nbuffers; i++)
+    if (ccp->cc_buffers[i] == bufferp)
+      break;
+  chDbgAssert(i < ccp->cc_nbuffers, "compRender(), #1", "unknown buffer");
+  dp = &compp->co_damage[i];
+
+  screen.cr_x1 = 0;
+  screen.cr_y1 = 0;
+  screen.cr_x2 = ccp->cc_width;
+  screen.cr_y2 = ccp->cc_height;
+  draw_rect(compp, NULL, &screen, &full);
+
+  compp->co_stats.cs_rects = 0;
+  compp->co_stats.cs_jobs = 0;
+  compp->co_stats.cs_bytes = 0;
+  compp->co_stats.cs_full_bytes = full.cs_bytes;
+  for (i = 0; i < dp->cd_count; i++)
+    draw_rect(compp, bufferp, &dp->cd_rects[i], &compp->co_stats);
+  dp->cd_count = 0;
+
+  if (compp->co_stats.cs_jobs == 0)
+    return RDY_OK;
+  return dma2dQueueWait(ccp->cc_dma2dp);
+}
+
+/** @} */
@@ -0,0 +1,161 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    compositor.h
+ * @brief   Dirty rectangles compositor macros and structures.
+ *
+ * @addtogroup compositor
+ * @{
+ */
+
+#ifndef _COMPOSITOR_H_
+#define _COMPOSITOR_H_
+
+#include "stm32_dma2d.h"
+
+/*
+ * Module dependencies check.
+ */
+#if !STM32_DMA2D_USE_DMA2D || !DMA2D_USE_QUEUE
+#error "The compositor requires the DMA2D driver and DMA2D_USE_QUEUE"
+#endif
+
+/**
+ * @brief   Maximum number of damaged rectangles tracked per frame buffer.
+ * @details When the limit is reached the new rectangle is merged with the
+ *          one it grows the least.
+ */
+#if !defined(COMP_MAX_RECTS) || defined(__DOXYGEN__)
+#define COMP_MAX_RECTS              8
+#endif
+
+/**
+ * @brief   Maximum number of frame buffers composed in rotation.
+ */
+#if !defined(COMP_MAX_BUFFERS) || defined(__DOXYGEN__)
+#define COMP_MAX_BUFFERS            3
+#endif
+
+/**
+ * @brief   Pixels that may be redrawn needlessly to save a DMA2D job.
+ * @details Two rectangles are merged if their bounding box is not larger
+ *          than their areas plus this slack.
+ */
+#if !defined(COMP_MERGE_SLACK) || defined(__DOXYGEN__)
+#define COMP_MERGE_SLACK            512
+#endif
+
+/**
+ * @brief   Compositor rectangle.
+ * @note    The right and bottom edges are excluded.
+ */
+typedef struct {
+  uint16_t              cr_x1;              /**< @brief Left edge.          */
+  uint16_t              cr_y1;              /**< @brief Top edge.           */
+  uint16_t              cr_x2;              /**< @brief Right edge.         */
+  uint16_t              cr_y2;              /**< @brief Bottom edge.        */
+} CompRect;
+
+/**
+ * @brief   Compositor layer.
+ * @details Layers are stacked in array order, the first one is the bottom.
+ *          An opaque layer replaces what is below it, a blended layer is
+ *          blended over it using its alpha mode.
+ */
+typedef struct {
+  dma2d_laycfg_t        cl_source;          /**< @brief Source image, the
+                                                 wrap offset is in addition
+                                                 to the layer width.        */
+  dma2d_amode_t         cl_amode;           /**< @brief Source alpha mode.  */
+  uint16_t              cl_x;               /**< @brief Screen position.    */
+  uint16_t              cl_y;               /**< @brief Screen position.    */
+  uint16_t              cl_width;           /**< @brief Width, in pixels.   */
+  uint16_t              cl_height;          /**< @brief Height, in pixels.  */
+  bool_t                cl_blend;           /**< @brief Blended, otherwise
+                                                 opaque.                    */
+  bool_t                cl_visible;         /**< @brief Visible layer.      */
+} CompLayer;
+
+/**
+ * @brief   Damaged area of a frame buffer.
+ */
+typedef struct {
+  CompRect              cd_rects[COMP_MAX_RECTS]; /**< @brief Rectangles.   */
+  uint8_t               cd_count;           /**< @brief Used rectangles.    */
+} CompDamage;
+
+/**
+ * @brief   Statistics of the last composed frame.
+ */
+typedef struct {
+  uint32_t              cs_rects;           /**< @brief Redrawn rectangles. */
+  uint32_t              cs_jobs;            /**< @brief DMA2D jobs.         */
+  uint32_t              cs_bytes;           /**< @brief Bytes moved.        */
+  uint32_t              cs_full_bytes;      /**< @brief Bytes a full redraw
+                                                 would have moved.          */
+} CompStats;
+
+/**
+ * @brief   Compositor configuration.
+ */
+typedef struct {
+  DMA2DDriver           *cc_dma2dp;         /**< @brief DMA2D driver.       */
+  uint16_t              cc_width;           /**< @brief Screen width.       */
+  uint16_t              cc_height;          /**< @brief Screen height.      */
+  dma2d_pixfmt_t        cc_fmt;             /**< @brief Screen format.      */
+  dma2d_color_t         cc_clear;           /**< @brief Color of the areas
+                                                 not covered by any opaque
+                                                 layer, in screen format.   */
+  void                  *const *cc_buffers; /**< @brief Frame buffers.      */
+  uint8_t               cc_nbuffers;        /**< @brief Number of frame
+                                                 buffers.                   */
+} CompConfig;
+
+/**
+ * @brief   Compositor object.
+ */
+typedef struct {
+  const CompConfig      *co_config;         /**< @brief Configuration.      */
+  CompLayer             *co_layers;         /**< @brief Layers stack.       */
+  uint8_t               co_nlayers;         /**< @brief Number of layers.   */
+  uint16_t              co_xalign;          /**< @brief Horizontal pixels
+                                                 granularity of the output
+                                                 addresses.                 */
+  CompDamage            co_damage[COMP_MAX_BUFFERS]; /**< @brief Damaged area
+                                                 of each frame buffer.      */
+  CompStats             co_stats;           /**< @brief Last frame stats.   */
+} Compositor;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void compObjectInit(Compositor *compp, const CompConfig *ccp,
+                      CompLayer *layers, uint8_t n);
+  void compInvalidate(Compositor *compp, const CompRect *rp);
+  void compLayerInvalidate(Compositor *compp, uint8_t layer,
+                           const CompRect *rp);
+  void compLayerMove(Compositor *compp, uint8_t layer,
+                     uint16_t x, uint16_t y);
+  void compLayerSetVisible(Compositor *compp, uint8_t layer, bool_t visible);
+  msg_t compRender(Compositor *compp, void *bufferp);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _COMPOSITOR_H_ */
+
+/** @} */
@@ -860,6 +860,41 @@ namespace chibios_rt {
 
     chPoolFreeI(&pool, objp);
   }
+
+#if CH_USE_SLABS
+  /*------------------------------------------------------------------------*
+   * chibios_rt::SlabAllocator                                              *
+   *------------------------------------------------------------------------*/
+  SlabAllocator::SlabAllocator(void) {
+
+    chSlabInit(&slab);
+  }
+
+  void SlabAllocator::addClass(::SlabClass *scp) {
+
+    chSlabAddClass(&slab, scp);
+  }
+
+  void *SlabAllocator::allocI(size_t size) {
+
+    return chSlabAllocI(&slab, size);
+  }
+
+  void *SlabAllocator::alloc(size_t size) {
+
+    return chSlabAlloc(&slab, size);
+  }
+
+  void SlabAllocator::freeI(void *objp) {
+
+    chSlabFreeI(objp);
+  }
+
+  void SlabAllocator::free(void *objp) {
+
+    chSlabFree(objp);
+  }
+#endif /* CH_USE_SLABS */
 #endif /* CH_USE_MEMPOOLS */
 }
 
@@ -2207,6 +2207,149 @@ namespace chibios_rt {
       loadArray(pool_buf, N);
     }
   };
+
+#if CH_USE_SLABS
+  /*------------------------------------------------------------------------*
+   * chibios_rt::SlabAllocator                                              *
+   *------------------------------------------------------------------------*/
+  /**
+   * @brief   Class encapsulating a slab allocator.
+   */
+  class SlabAllocator {
+  public:
+    /**
+     * @brief   Embedded @p ::SlabAllocator structure.
+     */
+    ::SlabAllocator slab;
+
+    /**
+     * @brief   SlabAllocator constructor.
+     *
+     * @init
+     */
+    SlabAllocator(void);
+
+    /**
+     * @brief   Adds a size class to the slab allocator.
+     * @pre     The size class must be already been initialized.
+     *
+     * @param[in] scp       pointer to the @p ::SlabClass structure
+     *
+     * @init
+     */
+    void addClass(::SlabClass *scp);
+
+    /**
+     * @brief   Allocates an object from the smallest fitting size class.
+     *
+     * @param[in] size      size of the object to be allocated
+     * @return              The pointer to the allocated object.
+     * @retval NULL         if no size class can satisfy the request.
+     *
+     * @iclass
+     */
+    void *allocI(size_t size);
+
+    /**
+     * @brief   Allocates an object from the smallest fitting size class.
+     *
+     * @param[in] size      size of the object to be allocated
+     * @return              The pointer to the allocated object.
+     * @retval NULL         if no size class can satisfy the request.
+     *
+     * @api
+     */
+    void *alloc(size_t size);
+
+    /**
+     * @brief   Releases an object into its size class.
+     *
+     * @param[in] objp      the pointer to the object to be released
+     *
+     * @iclass
+     */
+    static void freeI(void *objp);
+
+    /**
+     * @brief   Releases an object into its size class.
+     *
+     * @param[in] objp      the pointer to the object to be released
+     *
+     * @api
+     */
+    static void free(void *objp);
+  };
+
+  /*------------------------------------------------------------------------*
+   * chibios_rt::SlabObjectsPool                                            *
+   *------------------------------------------------------------------------*/
+  /**
+   * @brief   Template class encapsulating a slab size class and its
+   *          elements.
+   */
+  template<class T, size_t N>
+  class SlabObjectsPool {
+  private:
+    /* Objects storage, each element is prefixed by the slab header.*/
+    SLAB_BUFFER_DECL(slab_buf, sizeof (T), N);
+
+  public:
+    /**
+     * @brief   Embedded @p ::SlabClass structure.
+     */
+    ::SlabClass sc;
+
+    /**
+     * @brief   SlabObjectsPool constructor.
+     *
+     * @init
+     */
+    SlabObjectsPool(void) {
+
+      chSlabClassInit(&sc, sizeof (T), slab_buf, N);
+    }
+
+    /**
+     * @brief   SlabObjectsPool constructor.
+     * @details The size class is also added to the specified slab
+     *          allocator.
+     *
+     * @param[in] sa        the slab allocator
+     *
+     * @init
+     */
+    SlabObjectsPool(SlabAllocator &sa) {
+
+      chSlabClassInit(&sc, sizeof (T), slab_buf, N);
+      sa.addClass(&sc);
+    }
+
+    /**
+     * @brief   Returns the number of allocated objects.
+     *
+     * @return              The allocated objects count.
+     *
+     * @iclass
+     */
+    uint32_t getUsedI(void) {
+
+      return chSlabGetUsed(&sc);
+    }
+
+    /**
+     * @brief   Returns the allocated objects high water mark.
+     *
+     * @return              The maximum number of objects allocated at the
+     *                      same time.
+     *
+     * @iclass
+     */
+    uint32_t getHighWaterI(void) {
+
+      return chSlabGetHighWater(&sc);
+    }
+  };
+#endif /* CH_USE_SLABS */
 #endif /* CH_USE_MEMPOOLS */
 
   /*------------------------------------------------------------------------*
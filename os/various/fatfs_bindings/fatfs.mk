@@ -2,6 +2,9 @@
 FATFSSRC = ${CHIBIOS}/os/various/fatfs_bindings/fatfs_diskio.c \
            ${CHIBIOS}/os/various/fatfs_bindings/fatfs_syscall.c \
            ${CHIBIOS}/ext/fatfs/src/ff.c \
-           ${CHIBIOS}/ext/fatfs/src/option/ccsbcs.c
+           ${CHIBIOS}/ext/fatfs/src/option/ccsbcs.c \
+           ${CHIBIOS}/os/various/blkcache.c
 
-FATFSINC = ${CHIBIOS}/ext/fatfs/src
+FATFSINC = ${CHIBIOS}/ext/fatfs/src \
+           ${CHIBIOS}/os/various/fatfs_bindings \
+           ${CHIBIOS}/os/various
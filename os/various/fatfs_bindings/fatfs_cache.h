@@ -0,0 +1,74 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    fatfs_cache.h
+ * @brief   FatFs sectors cache settings.
+ * @details The settings can be overridden in ffconf.h.
+ *
+ * @addtogroup blkcache
+ * @{
+ */
+
+#ifndef _FATFS_CACHE_H_
+#define _FATFS_CACHE_H_
+
+#include "ff.h"
+
+/**
+ * @brief   Enables the sectors cache between FatFs and the card driver.
+ */
+#if !defined(FATFS_USE_CACHE) || defined(__DOXYGEN__)
+#define FATFS_USE_CACHE             FALSE
+#endif
+
+/**
+ * @brief   Number of cached sectors.
+ */
+#if !defined(FATFS_CACHE_BLOCKS) || defined(__DOXYGEN__)
+#define FATFS_CACHE_BLOCKS          16
+#endif
+
+/**
+ * @brief   Number of sectors read ahead and written in a single operation.
+ */
+#if !defined(FATFS_CACHE_WINDOW) || defined(__DOXYGEN__)
+#define FATFS_CACHE_WINDOW          8
+#endif
+
+#if FATFS_USE_CACHE || defined(__DOXYGEN__)
+#include "blkcache.h"
+
+#if FATFS_CACHE_BLOCKS < 1
+#error "FATFS_CACHE_BLOCKS must be at least 1"
+#endif
+
+#if !defined(__DOXYGEN__)
+extern BlockCache FATFSCache;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void fatfsCachePinMetadata(const FATFS *fsp);
+#ifdef __cplusplus
+}
+#endif
+#endif /* FATFS_USE_CACHE */
+
+#endif /* _FATFS_CACHE_H_ */
+
+/** @} */
@@ -9,6 +9,7 @@
 #include "hal.h"
 #include "ffconf.h"
 #include "diskio.h"
+#include "fatfs_cache.h"
 
 #if HAL_USE_MMC_SPI && HAL_USE_SDC
 #error "cannot specify both MMC_SPI and SDC drivers"
@@ -33,6 +34,64 @@ extern RTCDriver RTCD1;
 #define MMC     0
 #define SDC     0
 
+#if FATFS_USE_CACHE
+/*-----------------------------------------------------------------------*/
+/* Sectors cache in front of the physical drive.                         */
+
+BlockCache FATFSCache;
+
+static BlockCacheEntry cache_entries[FATFS_CACHE_BLOCKS];
+static uint8_t cache_buffer[FATFS_CACHE_BLOCKS * MMCSD_BLOCK_SIZE];
+#if FATFS_CACHE_WINDOW > 1
+static uint8_t cache_window[FATFS_CACHE_WINDOW * MMCSD_BLOCK_SIZE];
+#endif
+
+static const BlockCacheConfig cache_cfg = {
+#if HAL_USE_MMC_SPI
+  (BaseBlockDevice *)&MMCD1,
+#else
+  (BaseBlockDevice *)&SDCD1,
+#endif
+  cache_entries,
+  cache_buffer,
+  FATFS_CACHE_BLOCKS,
+#if FATFS_CACHE_WINDOW > 1
+  cache_window,
+  FATFS_CACHE_WINDOW
+#else
+  NULL,
+  0
+#endif
+};
+
+/*
+ * Pins the FAT and, on FAT12/16 volumes, the root directory. FAT32 root
+ * directories are cluster chains and are cached like the other sectors.
+ */
+void fatfsCachePinMetadata(const FATFS *fsp) {
+
+  bcacheUnpinAll(&FATFSCache);
+  bcachePin(&FATFSCache, fsp->fatbase, fsp->fsize * fsp->n_fats);
+  if (fsp->fs_type != FS_FAT32)
+    bcachePin(&FATFSCache, fsp->dirbase,
+              (uint32_t)fsp->n_rootdir * 32 / MMCSD_BLOCK_SIZE);
+}
+
+/*
+ * Restarts the cache, called on each mount because the device could have
+ * been reconnected or the card replaced since the previous one. The dirty
+ * blocks are written back, then the cached blocks and the device size are
+ * discarded.
+ */
+static bool_t cache_restart(void) {
+
+  if (blkGetDriverState(&FATFSCache) == BLK_READY)
+    (void)bcacheStop(&FATFSCache);
+  bcacheObjectInit(&FATFSCache);
+  return bcacheStart(&FATFSCache, &cache_cfg);
+}
+#endif /* FATFS_USE_CACHE */
+
 
 
 /*-----------------------------------------------------------------------*/
@@ -51,6 +110,10 @@ DSTATUS disk_initialize (
     /* It is initialized externally, just reads the status.*/
     if (blkGetDriverState(&MMCD1) != BLK_READY)
       stat |= STA_NOINIT;
+#if FATFS_USE_CACHE
+    else if (cache_restart())
+      stat |= STA_NOINIT;
+#endif
     if (mmcIsWriteProtected(&MMCD1))
       stat |=  STA_PROTECT;
     return stat;
@@ -60,6 +123,10 @@ DSTATUS disk_initialize (
     /* It is initialized externally, just reads the status.*/
     if (blkGetDriverState(&SDCD1) != BLK_READY)
       stat |= STA_NOINIT;
+#if FATFS_USE_CACHE
+    else if (cache_restart())
+      stat |= STA_NOINIT;
+#endif
     if (sdcIsWriteProtected(&SDCD1))
       stat |=  STA_PROTECT;
     return stat;
@@ -120,6 +187,10 @@ DRESULT disk_read (
   case MMC:
     if (blkGetDriverState(&MMCD1) != BLK_READY)
       return RES_NOTRDY;
+#if FATFS_USE_CACHE
+    if (blkRead(&FATFSCache, sector, buff, count))
+      return RES_ERROR;
+#else
     if (mmcStartSequentialRead(&MMCD1, sector))
       return RES_ERROR;
     while (count > 0) {
@@ -130,13 +201,19 @@ DRESULT disk_read (
     }
     if (mmcStopSequentialRead(&MMCD1))
         return RES_ERROR;
+#endif
     return RES_OK;
 #else
   case SDC:
     if (blkGetDriverState(&SDCD1) != BLK_READY)
       return RES_NOTRDY;
+#if FATFS_USE_CACHE
+    if (blkRead(&FATFSCache, sector, buff, count))
+      return RES_ERROR;
+#else
     if (sdcRead(&SDCD1, sector, buff, count))
       return RES_ERROR;
+#endif
     return RES_OK;
 #endif
   }
@@ -163,6 +240,10 @@ DRESULT disk_write (
         return RES_NOTRDY;
     if (mmcIsWriteProtected(&MMCD1))
         return RES_WRPRT;
+#if FATFS_USE_CACHE
+    if (blkWrite(&FATFSCache, sector, buff, count))
+        return RES_ERROR;
+#else
     if (mmcStartSequentialWrite(&MMCD1, sector))
         return RES_ERROR;
     while (count > 0) {
@@ -173,13 +254,19 @@ DRESULT disk_write (
     }
     if (mmcStopSequentialWrite(&MMCD1))
         return RES_ERROR;
+#endif
     return RES_OK;
 #else
   case SDC:
     if (blkGetDriverState(&SDCD1) != BLK_READY)
       return RES_NOTRDY;
+#if FATFS_USE_CACHE
+    if (blkWrite(&FATFSCache, sector, buff, count))
+      return RES_ERROR;
+#else
     if (sdcWrite(&SDCD1, sector, buff, count))
       return RES_ERROR;
+#endif
     return RES_OK;
 #endif
   }
@@ -203,12 +290,20 @@ DRESULT disk_ioctl (
   case MMC:
     switch (ctrl) {
     case CTRL_SYNC:
+#if FATFS_USE_CACHE
+        if (blkSync(&FATFSCache))
+            return RES_ERROR;
+#endif
         return RES_OK;
     case GET_SECTOR_SIZE:
         *((WORD *)buff) = MMCSD_BLOCK_SIZE;
         return RES_OK;
 #if _USE_ERASE
     case CTRL_ERASE_SECTOR:
+#if FATFS_USE_CACHE
+        bcacheFlush(&FATFSCache);
+        bcacheInvalidate(&FATFSCache);
+#endif
         mmcErase(&MMCD1, *((DWORD *)buff), *((DWORD *)buff + 1));
         return RES_OK;
 #endif
@@ -219,6 +314,10 @@ DRESULT disk_ioctl (
   case SDC:
     switch (ctrl) {
     case CTRL_SYNC:
+#if FATFS_USE_CACHE
+        if (blkSync(&FATFSCache))
+            return RES_ERROR;
+#endif
         return RES_OK;
     case GET_SECTOR_COUNT:
         *((DWORD *)buff) = mmcsdGetCardCapacity(&SDCD1);
@@ -231,6 +330,10 @@ DRESULT disk_ioctl (
         return RES_OK;
 #if _USE_ERASE
     case CTRL_ERASE_SECTOR:
+#if FATFS_USE_CACHE
+        bcacheFlush(&FATFSCache);
+        bcacheInvalidate(&FATFSCache);
+#endif
         sdcErase(&SDCD1, *((DWORD *)buff), *((DWORD *)buff + 1));
         return RES_OK;
 #endif
@@ -0,0 +1,325 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    probes.c
+ * @brief   Time probes code.
+ *
+ * @addtogroup probes
+ * @{
+ */
+
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "chprintf.h"
+#include "probes.h"
+
+/*
+ * Registered probes, most recently registered first.
+ */
+static TimeProbe *probes_list;
+
+/*
+ * Overhead of an empty sample, subtracted from the samples.
+ */
+static halrtcnt_t probes_offset;
+
+#if PROBES_USE_HISTOGRAM
+/*
+ * Histogram bucket of a sample, values below four have their own bucket,
+ * the others are split in four buckets per power of two using the two
+ * bits below the most significant one.
+ */
+static unsigned hist_bucket(halrtcnt_t sample) {
+  unsigned msb, b;
+
+  if (sample < 4)
+    return (unsigned)sample;
+  msb = 31 - __builtin_clz((uint32_t)sample);
+  b = (msb - 1) * 4 + (((uint32_t)sample >> (msb - 2)) & 3);
+  return b < PROBES_HIST_BUCKETS ? b : PROBES_HIST_BUCKETS - 1;
+}
+
+/*
+ * Largest sample accounted in a bucket.
+ */
+static halrtcnt_t hist_limit(unsigned b) {
+  unsigned shift;
+
+  if (b < 4)
+    return (halrtcnt_t)b;
+  shift = b / 4 - 1;
+  return (halrtcnt_t)((((uint32_t)(b % 4) + 5) << shift) - 1);
+}
+#endif /* PROBES_USE_HISTOGRAM */
+
+/**
+ * @brief   Time probes subsystem initialization.
+ * @details Calibrates the overhead of an empty sample, the value is then
+ *          subtracted from all samples.
+ *
+ * @init
+ */
+void probesInit(void) {
+  halrtcnt_t start;
+
+  start = probeStart();
+  probes_offset = halGetCounterValue() - start;
+}
+
+/**
+ * @brief   Initializes a @p TimeProbe object.
+ * @note    Only probes that are not statically initialized require this
+ *          function. The probe is registered on its first sample.
+ * @pre     The probe must not be registered yet.
+ *
+ * @param[out] pp       pointer to the @p TimeProbe object
+ * @param[in] name      the probe name
+ *
+ * @init
+ */
+void probeObjectInit(TimeProbe *pp, const char *name) {
+
+  chDbgCheck((pp != NULL) && (name != NULL), "probeObjectInit");
+
+  pp->tp_name = name;
+  pp->tp_next = NULL;
+  pp->tp_linked = FALSE;
+  probeReset(pp);
+}
+
+/**
+ * @brief   Adds a sample to a probe.
+ *
+ * @param[in] pp        pointer to the @p TimeProbe object
+ * @param[in] sample    sample duration in realtime counter ticks
+ *
+ * @iclass
+ */
+void probeAddI(TimeProbe *pp, halrtcnt_t sample) {
+
+  chDbgCheckClassI();
+  chDbgCheck(pp != NULL, "probeAddI");
+
+  if (!pp->tp_linked) {
+    pp->tp_next = probes_list;
+    pp->tp_linked = TRUE;
+    probes_list = pp;
+  }
+  sample = sample > probes_offset ? sample - probes_offset : 0;
+  if (sample < pp->tp_min)
+    pp->tp_min = sample;
+  if (sample > pp->tp_max)
+    pp->tp_max = sample;
+  pp->tp_sum += sample;
+  pp->tp_count++;
+#if PROBES_USE_HISTOGRAM
+  pp->tp_hist[hist_bucket(sample)]++;
+#endif
+}
+
+/**
+ * @brief   Adds a sample to a probe.
+ *
+ * @param[in] pp        pointer to the @p TimeProbe object
+ * @param[in] sample    sample duration in realtime counter ticks
+ *
+ * @api
+ */
+void probeAdd(TimeProbe *pp, halrtcnt_t sample) {
+
+  chSysLock();
+  probeAddI(pp, sample);
+  chSysUnlock();
+}
+
+/**
+ * @brief   Clears the samples of a probe.
+ *
+ * @param[in] pp        pointer to the @p TimeProbe object
+ *
+ * @api
+ */
+void probeReset(TimeProbe *pp) {
+
+  chDbgCheck(pp != NULL, "probeReset");
+
+  chSysLock();
+  pp->tp_count = 0;
+  pp->tp_min = (halrtcnt_t)-1;
+  pp->tp_max = 0;
+  pp->tp_sum = 0;
+#if PROBES_USE_HISTOGRAM
+  memset(pp->tp_hist, 0, sizeof pp->tp_hist);
+#endif
+  chSysUnlock();
+}
+
+/**
+ * @brief   Takes a consistent copy of a probe.
+ * @details The statistics functions are meant to be used on the copy
+ *          while the probe keeps collecting samples.
+ *
+ * @param[in] pp        pointer to the @p TimeProbe object
+ * @param[out] dstp     pointer to the copy
+ *
+ * @api
+ */
+void probeSnapshot(TimeProbe *pp, TimeProbe *dstp) {
+
+  chDbgCheck((pp != NULL) && (dstp != NULL), "probeSnapshot");
+
+  chSysLock();
+  *dstp = *pp;
+  chSysUnlock();
+}
+
+/**
+ * @brief   Returns the mean sample.
+ *
+ * @param[in] pp        pointer to the @p TimeProbe object
+ * @return              The mean sample, zero if there are no samples.
+ *
+ * @api
+ */
+halrtcnt_t probeGetMean(const TimeProbe *pp) {
+
+  chDbgCheck(pp != NULL, "probeGetMean");
+
+  if (pp->tp_count == 0)
+    return 0;
+  return (halrtcnt_t)(pp->tp_sum / pp->tp_count);
+}
+
+#if PROBES_USE_HISTOGRAM || defined(__DOXYGEN__)
+/**
+ * @brief   Returns a percentile of the samples.
+ * @details The result is the upper limit of the histogram bucket holding
+ *          the percentile, it is an overestimate by at most a quarter of
+ *          a power of two and never exceeds the longest sample.
+ *
+ * @param[in] pp        pointer to the @p TimeProbe object
+ * @param[in] permille  the percentile in thousandths, 500 is the median
+ * @return              The percentile, zero if there are no samples.
+ *
+ * @api
+ */
+halrtcnt_t probeGetPercentile(const TimeProbe *pp, unsigned permille) {
+  uint32_t rank, n;
+  unsigned b;
+
+  chDbgCheck((pp != NULL) && (permille <= 1000), "probeGetPercentile");
+
+  if (pp->tp_count == 0)
+    return 0;
+  rank = (uint32_t)(((uint64_t)pp->tp_count * permille + 999) / 1000);
+  if (rank == 0)
+    rank = 1;
+  n = 0;
+  for (b = 0; b < PROBES_HIST_BUCKETS - 1; b++) {
+    n += pp->tp_hist[b];
+    if (n >= rank)
+      break;
+  }
+  if ((b == PROBES_HIST_BUCKETS - 1) || (hist_limit(b) > pp->tp_max))
+    return pp->tp_max;
+  return hist_limit(b) < pp->tp_min ? pp->tp_min : hist_limit(b);
+}
+#endif /* PROBES_USE_HISTOGRAM */
+
+/**
+ * @brief   Returns a registered probe.
+ *
+ * @param[in] name      the probe name
+ * @return              The probe.
+ * @retval NULL         if there is no registered probe with that name.
+ *
+ * @api
+ */
+TimeProbe *probeFind(const char *name) {
+  TimeProbe *pp;
+
+  chDbgCheck(name != NULL, "probeFind");
+
+  /* Probes are only ever prepended, the list after the head can be
+     scanned without locking.*/
+  chSysLock();
+  pp = probes_list;
+  chSysUnlock();
+  while ((pp != NULL) && (strcmp(pp->tp_name, name) != 0))
+    pp = pp->tp_next;
+  return pp;
+}
+
+/**
+ * @brief   Clears the samples of all the registered probes.
+ *
+ * @api
+ */
+void probesReset(void) {
+  TimeProbe *pp;
+
+  chSysLock();
+  pp = probes_list;
+  chSysUnlock();
+  while (pp != NULL) {
+    probeReset(pp);
+    pp = pp->tp_next;
+  }
+}
+
+/**
+ * @brief   Prints the statistics of all the registered probes.
+ * @details Times are in realtime counter ticks, the counter frequency is
+ *          printed in the header line.
+ *
+ * @param[in] chp       pointer to a @p BaseSequentialStream object
+ *
+ * @api
+ */
+void probesDump(BaseSequentialStream *chp) {
+  TimeProbe *pp;
+  TimeProbe snap;
+
+  chDbgCheck(chp != NULL, "probesDump");
+
+  chprintf(chp, "counter %U Hz\r\n", halGetCounterFrequency());
+#if PROBES_USE_HISTOGRAM
+  chprintf(chp, "name             count        min       mean"
+                "        p50        p90        p99        max\r\n");
+#else
+  chprintf(chp, "name             count        min       mean"
+                "        max\r\n");
+#endif
+  chSysLock();
+  pp = probes_list;
+  chSysUnlock();
+  while (pp != NULL) {
+    probeSnapshot(pp, &snap);
+    chprintf(chp, "%-12s %9U %10U %10U", snap.tp_name, snap.tp_count,
+             snap.tp_count > 0 ? snap.tp_min : 0, probeGetMean(&snap));
+#if PROBES_USE_HISTOGRAM
+    chprintf(chp, " %10U %10U %10U", probeGetPercentile(&snap, 500),
+             probeGetPercentile(&snap, 900), probeGetPercentile(&snap, 990));
+#endif
+    chprintf(chp, " %10U\r\n", snap.tp_max);
+    pp = pp->tp_next;
+  }
+}
+
+/** @} */
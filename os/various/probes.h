@@ -0,0 +1,174 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    probes.h
+ * @brief   Time probes macros and structures.
+ *
+ * @addtogroup probes
+ * @{
+ */
+
+#ifndef _PROBES_H_
+#define _PROBES_H_
+
+/*
+ * Module dependencies check.
+ */
+#if !HAL_IMPLEMENTS_COUNTERS
+#error "Time probes require the HAL realtime counter"
+#endif
+
+/**
+ * @brief   Enables the per-probe histogram.
+ * @details The histogram is required for the percentiles, without it a
+ *          sample only updates the count, sum, minimum and maximum.
+ */
+#if !defined(PROBES_USE_HISTOGRAM) || defined(__DOXYGEN__)
+#define PROBES_USE_HISTOGRAM        TRUE
+#endif
+
+/**
+ * @brief   Number of histogram buckets.
+ * @details Buckets are logarithmic with four buckets per power of two, the
+ *          default covers samples below 2^17 counter ticks, longer ones
+ *          are accounted in the last bucket.
+ * @note    Must be a multiple of four, 124 buckets cover the whole counter
+ *          range.
+ */
+#if !defined(PROBES_HIST_BUCKETS) || defined(__DOXYGEN__)
+#define PROBES_HIST_BUCKETS         64
+#endif
+
+#if (PROBES_HIST_BUCKETS < 8) || ((PROBES_HIST_BUCKETS % 4) != 0) ||        \
+    (PROBES_HIST_BUCKETS > 124)
+#error "invalid PROBES_HIST_BUCKETS value"
+#endif
+
+/**
+ * @brief   Type of a time probe.
+ */
+typedef struct TimeProbe TimeProbe;
+
+/**
+ * @brief   Time probe structure.
+ * @note    Probes link themselves in the registry when the first sample is
+ *          added, there is no need to initialize them at runtime.
+ */
+struct TimeProbe {
+  const char            *tp_name;           /**< @brief Probe name.         */
+  TimeProbe             *tp_next;           /**< @brief Next registered
+                                                 probe.                     */
+  bool_t                tp_linked;          /**< @brief Probe registered.   */
+  uint32_t              tp_count;           /**< @brief Number of samples.  */
+  halrtcnt_t            tp_min;             /**< @brief Shortest sample.    */
+  halrtcnt_t            tp_max;             /**< @brief Longest sample.     */
+  uint64_t              tp_sum;             /**< @brief Samples sum.        */
+#if PROBES_USE_HISTOGRAM || defined(__DOXYGEN__)
+  uint32_t              tp_hist[PROBES_HIST_BUCKETS];
+                                            /**< @brief Samples histogram.  */
+#endif
+};
+
+/**
+ * @brief   Data part of a static time probe initializer.
+ * @details This macro should be used when statically initializing a
+ *          time probe that is part of a bigger structure.
+ *
+ * @param[in] name      the probe name
+ */
+#if PROBES_USE_HISTOGRAM || defined(__DOXYGEN__)
+#define _TIME_PROBE_DATA(name) {(name), NULL, FALSE, 0, (halrtcnt_t)-1, 0, 0,  \
+                                {0}}
+#else
+#define _TIME_PROBE_DATA(name) {(name), NULL, FALSE, 0, (halrtcnt_t)-1, 0, 0}
+#endif
+
+/**
+ * @brief   Static time probe initializer.
+ * @details Statically initialized probes require no explicit
+ *          initialization.
+ *
+ * @param[in] p         the probe variable
+ * @param[in] name      the probe name
+ */
+#define TIME_PROBE_DECL(p, name) TimeProbe p = _TIME_PROBE_DATA(name)
+
+/**
+ * @brief   Starts a sample.
+ * @details The returned value is the start time to be passed to
+ *          @p probeStop(), samples can be nested freely.
+ * @note    This function can be invoked in any context.
+ *
+ * @return              The start time.
+ *
+ * @special
+ */
+#define probeStart() halGetCounterValue()
+
+/**
+ * @brief   Stops a sample and adds it to a probe.
+ *
+ * @param[in] pp        pointer to the @p TimeProbe object
+ * @param[in] start     start time returned by @p probeStart()
+ *
+ * @api
+ */
+#define probeStop(pp, start) probeAdd(pp, halGetCounterValue() - (start))
+
+/**
+ * @brief   Stops a sample and adds it to a probe.
+ *
+ * @param[in] pp        pointer to the @p TimeProbe object
+ * @param[in] start     start time returned by @p probeStart()
+ *
+ * @iclass
+ */
+#define probeStopI(pp, start) probeAddI(pp, halGetCounterValue() - (start))
+
+/**
+ * @brief   Returns the number of samples.
+ *
+ * @param[in] pp        pointer to the @p TimeProbe object
+ * @return              The number of samples.
+ *
+ * @special
+ */
+#define probeGetCount(pp) ((pp)->tp_count)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void probesInit(void);
+  void probeObjectInit(TimeProbe *pp, const char *name);
+  void probeAddI(TimeProbe *pp, halrtcnt_t sample);
+  void probeAdd(TimeProbe *pp, halrtcnt_t sample);
+  void probeReset(TimeProbe *pp);
+  void probeSnapshot(TimeProbe *pp, TimeProbe *dstp);
+  halrtcnt_t probeGetMean(const TimeProbe *pp);
+#if PROBES_USE_HISTOGRAM
+  halrtcnt_t probeGetPercentile(const TimeProbe *pp, unsigned permille);
+#endif
+  TimeProbe *probeFind(const char *name);
+  void probesReset(void);
+  void probesDump(BaseSequentialStream *chp);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PROBES_H_ */
+
+/** @} */
@@ -0,0 +1,166 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    ramdisk.c
+ * @brief   RAM block device code.
+ *
+ * @addtogroup ramdisk
+ * @{
+ */
+
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "ramdisk.h"
+
+static bool_t rd_is_inserted(void *ip) {
+
+  (void)ip;
+  return TRUE;
+}
+
+static bool_t rd_is_protected(void *ip) {
+
+  return ((RamDisk *)ip)->readonly;
+}
+
+static bool_t rd_connect(void *ip) {
+  RamDisk *rdp = (RamDisk *)ip;
+
+  if (rdp->state == BLK_STOP)
+    return CH_FAILED;
+  rdp->state = BLK_READY;
+  return CH_SUCCESS;
+}
+
+static bool_t rd_disconnect(void *ip) {
+  RamDisk *rdp = (RamDisk *)ip;
+
+  if (rdp->state != BLK_STOP)
+    rdp->state = BLK_ACTIVE;
+  return CH_SUCCESS;
+}
+
+static bool_t rd_read(void *ip, uint32_t startblk, uint8_t *buf, uint32_t n) {
+  RamDisk *rdp = (RamDisk *)ip;
+
+  if ((rdp->state != BLK_READY) || (startblk >= rdp->blk_num) ||
+      (n > rdp->blk_num - startblk))
+    return CH_FAILED;
+  rdp->reads++;
+  memcpy(buf, rdp->storage + startblk * rdp->blk_size, n * rdp->blk_size);
+  return CH_SUCCESS;
+}
+
+static bool_t rd_write(void *ip, uint32_t startblk,
+                       const uint8_t *buf, uint32_t n) {
+  RamDisk *rdp = (RamDisk *)ip;
+
+  if ((rdp->state != BLK_READY) || rdp->readonly ||
+      (startblk >= rdp->blk_num) || (n > rdp->blk_num - startblk))
+    return CH_FAILED;
+  rdp->writes++;
+  memcpy(rdp->storage + startblk * rdp->blk_size, buf, n * rdp->blk_size);
+  return CH_SUCCESS;
+}
+
+static bool_t rd_sync(void *ip) {
+
+  (void)ip;
+  return CH_SUCCESS;
+}
+
+static bool_t rd_get_info(void *ip, BlockDeviceInfo *bdip) {
+  RamDisk *rdp = (RamDisk *)ip;
+
+  if (rdp->state != BLK_READY)
+    return CH_FAILED;
+  bdip->blk_size = rdp->blk_size;
+  bdip->blk_num = rdp->blk_num;
+  return CH_SUCCESS;
+}
+
+/*
+ * Virtual methods table.
+ */
+static const struct RamDiskVMT ramdisk_vmt = {
+  rd_is_inserted,
+  rd_is_protected,
+  rd_connect,
+  rd_disconnect,
+  rd_read,
+  rd_write,
+  rd_sync,
+  rd_get_info
+};
+
+/**
+ * @brief   Initializes a @p RamDisk object.
+ *
+ * @param[out] rdp      pointer to the @p RamDisk object
+ *
+ * @init
+ */
+void ramdiskObjectInit(RamDisk *rdp) {
+
+  rdp->vmt = &ramdisk_vmt;
+  rdp->state = BLK_STOP;
+  rdp->reads = 0;
+  rdp->writes = 0;
+}
+
+/**
+ * @brief   Starts a RAM block device.
+ * @details The device is then connected with @p blkConnect().
+ *
+ * @param[in] rdp       pointer to the @p RamDisk object
+ * @param[in] storage   blocks storage, @p blksize times @p blknum bytes
+ * @param[in] blksize   block size in bytes
+ * @param[in] blknum    number of blocks
+ * @param[in] readonly  write protection
+ *
+ * @api
+ */
+void ramdiskStart(RamDisk *rdp, uint8_t *storage, uint32_t blksize,
+                  uint32_t blknum, bool_t readonly) {
+
+  chDbgCheck((rdp != NULL) && (storage != NULL) && (blksize > 0),
+             "ramdiskStart");
+
+  rdp->storage = storage;
+  rdp->blk_size = blksize;
+  rdp->blk_num = blknum;
+  rdp->readonly = readonly;
+  rdp->state = BLK_ACTIVE;
+}
+
+/**
+ * @brief   Stops a RAM block device.
+ *
+ * @param[in] rdp       pointer to the @p RamDisk object
+ *
+ * @api
+ */
+void ramdiskStop(RamDisk *rdp) {
+
+  chDbgCheck(rdp != NULL, "ramdiskStop");
+
+  rdp->state = BLK_STOP;
+}
+
+/** @} */
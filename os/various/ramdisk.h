@@ -0,0 +1,89 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    ramdisk.h
+ * @brief   RAM block device macros and structures.
+ *
+ * @addtogroup ramdisk
+ * @{
+ */
+
+#ifndef _RAMDISK_H_
+#define _RAMDISK_H_
+
+/**
+ * @brief   @p RamDisk specific methods.
+ */
+#define _ramdisk_methods                                                    \
+  _base_block_device_methods
+
+/**
+ * @brief   @p RamDisk virtual methods table.
+ */
+struct RamDiskVMT {
+  _ramdisk_methods
+};
+
+/**
+ * @brief   RAM block device object.
+ */
+typedef struct {
+  /**
+   * @brief   Virtual Methods Table.
+   */
+  const struct RamDiskVMT *vmt;
+  _base_block_device_data
+  /**
+   * @brief   Blocks storage.
+   */
+  uint8_t               *storage;
+  /**
+   * @brief   Block size in bytes.
+   */
+  uint32_t              blk_size;
+  /**
+   * @brief   Number of blocks.
+   */
+  uint32_t              blk_num;
+  /**
+   * @brief   Write protection.
+   */
+  bool_t                readonly;
+  /**
+   * @brief   Read operations counter.
+   */
+  uint32_t              reads;
+  /**
+   * @brief   Write operations counter.
+   */
+  uint32_t              writes;
+} RamDisk;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void ramdiskObjectInit(RamDisk *rdp);
+  void ramdiskStart(RamDisk *rdp, uint8_t *storage, uint32_t blksize,
+                    uint32_t blknum, bool_t readonly);
+  void ramdiskStop(RamDisk *rdp);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RAMDISK_H_ */
+
+/** @} */
@@ -0,0 +1,793 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    raster.c
+ * @brief   CPU raster kernels code.
+ * @details Each kernel exists in two versions, the reference one processes
+ *          a pixel at time and is meant to be obviously correct, the other
+ *          one moves whole words and must produce identical results.
+ *
+ * @addtogroup raster
+ * @{
+ */
+
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "raster.h"
+
+#if RASTER_USE_SIMD
+#if defined(__CORTEX_M) && (__CORTEX_M == 0x04)
+/* DSP instructions from core_cm4_simd.h.*/
+#define uxtb16(x)           __UXTB16(x)
+#define ror(x, n)           __ROR(x, n)
+
+/*
+ * Picks the bytes of a where t is not zero and those of b elsewhere, the
+ * USUB8 sets a GE flag for each non zero byte and SEL uses them.
+ */
+static INLINE uint32_t select_nonzero(uint32_t t, uint32_t a, uint32_t b) {
+
+  (void)__USUB8(t, 0x01010101U);
+  return __SEL(a, b);
+}
+#else
+/* Portable equivalents, the same kernels run on any core and on the host.*/
+static INLINE uint32_t uxtb16(uint32_t x) {
+
+  return x & 0x00FF00FFU;
+}
+
+static INLINE uint32_t ror(uint32_t x, uint32_t n) {
+
+  return (x >> n) | (x << (32 - n));
+}
+
+static INLINE uint32_t select_nonzero(uint32_t t, uint32_t a, uint32_t b) {
+  uint32_t m = ((t & 0x7F7F7F7FU) + 0x7F7F7F7FU) | t;
+
+  m = ((m & 0x80808080U) >> 7) * 0xFFU;
+  return (a & m) | (b & ~m);
+}
+#endif
+#endif /* RASTER_USE_SIMD */
+
+static const uint8_t bytes_per_pixel[] = {4, 3, 2, 2, 2, 1, 1, 2, 0, 1, 0};
+
+static uint32_t pixel_load(const uint8_t *p, unsigned bpp) {
+
+  switch (bpp) {
+  case 4:
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+  case 3:
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+  case 2:
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+  default:
+    return p[0];
+  }
+}
+
+static void pixel_store(uint8_t *p, unsigned bpp, uint32_t v) {
+
+  p[0] = (uint8_t)v;
+  if (bpp > 1)
+    p[1] = (uint8_t)(v >> 8);
+  if (bpp > 2)
+    p[2] = (uint8_t)(v >> 16);
+  if (bpp > 3)
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/* Scales a 5 bits channel to 8 bits, the MSBs are replicated as the DMA2D
+   does.*/
+static INLINE uint32_t expand5(uint32_t c) {
+
+  return (c << 3) | (c >> 2);
+}
+
+static INLINE uint32_t expand6(uint32_t c) {
+
+  return (c << 2) | (c >> 4);
+}
+
+static INLINE uint32_t encode_rgb565(uint32_t c) {
+
+  return ((c >> 8) & 0xF800U) | ((c >> 5) & 0x07E0U) | ((c >> 3) & 0x001FU);
+}
+
+#if RASTER_USE_SIMD
+/* Packs four colors into three RGB-888 words.*/
+static INLINE void pack_rgb888(uint32_t *wp, uint32_t c0, uint32_t c1,
+                               uint32_t c2, uint32_t c3) {
+
+  wp[0] = (c0 & 0x00FFFFFFU) | (c1 << 24);
+  wp[1] = ((c1 >> 8) & 0x0000FFFFU) | (c2 << 16);
+  wp[2] = ((c2 >> 16) & 0x000000FFU) | (c3 << 8);
+}
+
+/* Effective source opacity, 0 to 256.*/
+static INLINE uint32_t blend_weight(uint32_t s, uint32_t alpha1) {
+  uint32_t a = ((s >> 24) * alpha1) >> 8;
+
+  return a + (a >> 7);
+}
+
+/*
+ * Blends a color over another one, a channel pair at time. Each 16 bits
+ * lane holds at most 255 * 256 so there are no carries between lanes. The
+ * source alpha lane is forced to 255, the output alpha is then the usual
+ * src + dst - src * dst.
+ */
+static INLINE uint32_t blend_word(uint32_t s, uint32_t d, uint32_t a) {
+  uint32_t srb = uxtb16(s);
+  uint32_t sag = uxtb16(ror(s, 8)) | 0x00FF0000U;
+  uint32_t drb = uxtb16(d);
+  uint32_t dag = uxtb16(ror(d, 8));
+  uint32_t rb = ((srb * a + drb * (256 - a)) >> 8) & 0x00FF00FFU;
+  uint32_t ag = (sag * a + dag * (256 - a)) & 0xFF00FF00U;
+
+  return rb | ag;
+}
+
+/*
+ * Fills a row with a 12 bytes pattern, a whole number of pixels of any
+ * size, using word stores once the destination is aligned.
+ */
+static void fill_row(uint8_t *p, size_t n, const uint8_t *pat) {
+  union {
+    uint32_t w[3];
+    uint8_t b[12];
+  } u;
+  uint32_t *wp;
+  unsigned i, phase = 0;
+
+  while ((n > 0) && (((size_t)p & 3) != 0)) {
+    *p++ = pat[phase];
+    phase = phase == 11 ? 0 : phase + 1;
+    n--;
+  }
+  for (i = 0; i < 12; i++)
+    u.b[i] = pat[(phase + i) % 12];
+
+  wp = (uint32_t *)p;
+  while (n >= 12) {
+    wp[0] = u.w[0];
+    wp[1] = u.w[1];
+    wp[2] = u.w[2];
+    wp += 3;
+    n -= 12;
+  }
+  p = (uint8_t *)wp;
+  for (i = 0; i < n; i++)
+    p[i] = u.b[i];
+}
+
+static void keyed_row(uint8_t *d, const uint8_t *s, size_t n, uint8_t key) {
+  uint32_t key4 = key * 0x01010101U;
+  uint32_t sw;
+
+  while ((n > 0) && (((size_t)d & 3) != 0)) {
+    if (*s != key)
+      *d = *s;
+    d++;
+    s++;
+    n--;
+  }
+  while (n >= 4) {
+    memcpy(&sw, s, 4);
+    *(uint32_t *)d = select_nonzero(sw ^ key4, sw, *(uint32_t *)d);
+    d += 4;
+    s += 4;
+    n -= 4;
+  }
+  while (n > 0) {
+    if (*s != key)
+      *d = *s;
+    d++;
+    s++;
+    n--;
+  }
+}
+
+static void blend_row(uint8_t *d, rasterfmt_t fmt, const uint32_t *s,
+                      size_t n, uint32_t alpha1) {
+  uint32_t *dp = (uint32_t *)d;
+  unsigned bpp = bytes_per_pixel[fmt];
+  uint32_t c, a;
+
+  while (n > 0) {
+    c = *s++;
+    a = blend_weight(c, alpha1);
+    if (a != 0) {
+      if (fmt == RASTER_FMT_ARGB8888)
+        *dp = a == 256 ? c | 0xFF000000U : blend_word(c, *dp, a);
+      else if (fmt == RASTER_FMT_RGB888)
+        pixel_store(d, 3,
+                    a == 256 ? c : blend_word(c, pixel_load(d, 3), a));
+      else
+        pixel_store(d, bpp, rasterFromARGB8888(
+          blend_word(c, rasterToARGB8888(pixel_load(d, bpp), fmt), a), fmt));
+    }
+    dp++;
+    d += bpp;
+    n--;
+  }
+}
+
+static void expand_row(uint8_t *d, rasterfmt_t fmt, const uint8_t *s,
+                       size_t n, const uint32_t *pal) {
+  uint32_t *dp;
+  unsigned bpp = bytes_per_pixel[fmt];
+
+  switch (fmt) {
+  case RASTER_FMT_ARGB8888:
+    dp = (uint32_t *)d;
+    while (n >= 4) {
+      dp[0] = pal[s[0]];
+      dp[1] = pal[s[1]];
+      dp[2] = pal[s[2]];
+      dp[3] = pal[s[3]];
+      dp += 4;
+      s += 4;
+      n -= 4;
+    }
+    while (n-- > 0)
+      *dp++ = pal[*s++];
+    return;
+  case RASTER_FMT_RGB888:
+    while ((n > 0) && (((size_t)d & 3) != 0)) {
+      pixel_store(d, 3, pal[*s++]);
+      d += 3;
+      n--;
+    }
+    while (n >= 4) {
+      pack_rgb888((uint32_t *)d, pal[s[0]], pal[s[1]], pal[s[2]], pal[s[3]]);
+      d += 12;
+      s += 4;
+      n -= 4;
+    }
+    break;
+  default:
+    break;
+  }
+  while (n-- > 0) {
+    pixel_store(d, bpp, rasterFromARGB8888(pal[*s++], fmt));
+    d += bpp;
+  }
+}
+
+static void convert_row(uint8_t *d, rasterfmt_t dfmt,
+                        const uint8_t *s, rasterfmt_t sfmt, size_t n) {
+  unsigned dbpp = bytes_per_pixel[dfmt];
+  unsigned sbpp = bytes_per_pixel[sfmt];
+  const uint32_t *sp;
+  uint32_t *dp;
+  uint32_t w0, w1, w2;
+
+  if ((sfmt == RASTER_FMT_ARGB8888) && (dfmt == RASTER_FMT_RGB888)) {
+    sp = (const uint32_t *)s;
+    while ((n > 0) && (((size_t)d & 3) != 0)) {
+      pixel_store(d, 3, *sp++);
+      d += 3;
+      n--;
+    }
+    while (n >= 4) {
+      pack_rgb888((uint32_t *)d, sp[0], sp[1], sp[2], sp[3]);
+      d += 12;
+      sp += 4;
+      n -= 4;
+    }
+    s = (const uint8_t *)sp;
+  }
+  else if ((sfmt == RASTER_FMT_RGB888) && (dfmt == RASTER_FMT_ARGB8888)) {
+    dp = (uint32_t *)d;
+    while ((n > 0) && (((size_t)s & 3) != 0)) {
+      *dp++ = pixel_load(s, 3) | 0xFF000000U;
+      s += 3;
+      n--;
+    }
+    while (n >= 4) {
+      w0 = ((const uint32_t *)s)[0];
+      w1 = ((const uint32_t *)s)[1];
+      w2 = ((const uint32_t *)s)[2];
+      dp[0] = w0 | 0xFF000000U;
+      dp[1] = (w0 >> 24) | (w1 << 8) | 0xFF000000U;
+      dp[2] = (w1 >> 16) | (w2 << 16) | 0xFF000000U;
+      dp[3] = (w2 >> 8) | 0xFF000000U;
+      dp += 4;
+      s += 12;
+      n -= 4;
+    }
+    d = (uint8_t *)dp;
+  }
+  else if ((sfmt == RASTER_FMT_ARGB8888) && (dfmt == RASTER_FMT_RGB565) &&
+           (((size_t)d & 1) == 0)) {
+    sp = (const uint32_t *)s;
+    if ((n > 0) && (((size_t)d & 3) != 0)) {
+      pixel_store(d, 2, encode_rgb565(*sp++));
+      d += 2;
+      n--;
+    }
+    while (n >= 2) {
+      *(uint32_t *)d = encode_rgb565(sp[0]) | (encode_rgb565(sp[1]) << 16);
+      d += 4;
+      sp += 2;
+      n -= 2;
+    }
+    s = (const uint8_t *)sp;
+  }
+  while (n-- > 0) {
+    pixel_store(d, dbpp, rasterFromARGB8888(
+      rasterToARGB8888(pixel_load(s, sbpp), sfmt), dfmt));
+    d += dbpp;
+    s += sbpp;
+  }
+}
+#endif /* RASTER_USE_SIMD */
+
+/**
+ * @brief   Returns the size of a pixel.
+ *
+ * @param[in] fmt       pixel format
+ * @return              The pixel size in bytes, zero for the formats with
+ *                      less than 8 bits per pixel.
+ *
+ * @api
+ */
+unsigned rasterBytesPerPixel(rasterfmt_t fmt) {
+
+  chDbgCheck(fmt < sizeof(bytes_per_pixel), "rasterBytesPerPixel");
+
+  return bytes_per_pixel[fmt];
+}
+
+/**
+ * @brief   Converts a pixel to ARGB-8888.
+ * @details Channels are scaled up replicating their MSBs, as the DMA2D does.
+ *
+ * @param[in] pixel     pixel value
+ * @param[in] fmt       pixel format, a direct color one
+ * @return              The ARGB-8888 color.
+ *
+ * @api
+ */
+uint32_t rasterToARGB8888(uint32_t pixel, rasterfmt_t fmt) {
+
+  chDbgCheck(RASTER_IS_DIRECT(fmt), "rasterToARGB8888");
+
+  switch (fmt) {
+  case RASTER_FMT_RGB888:
+    return pixel | 0xFF000000U;
+  case RASTER_FMT_RGB565:
+    return 0xFF000000U | (expand5((pixel >> 11) & 0x1F) << 16) |
+           (expand6((pixel >> 5) & 0x3F) << 8) |
+           expand5(pixel & 0x1F);
+  case RASTER_FMT_ARGB1555:
+    return (pixel & 0x8000 ? 0xFF000000U : 0) |
+           (expand5((pixel >> 10) & 0x1F) << 16) |
+           (expand5((pixel >> 5) & 0x1F) << 8) | expand5(pixel & 0x1F);
+  case RASTER_FMT_ARGB4444:
+    return (((pixel >> 12) & 0x0F) * 0x11000000U) |
+           (((pixel >> 8) & 0x0F) * 0x00110000U) |
+           (((pixel >> 4) & 0x0F) * 0x00001100U) |
+           ((pixel & 0x0F) * 0x00000011U);
+  default:
+    return pixel;
+  }
+}
+
+/**
+ * @brief   Converts an ARGB-8888 color to a pixel.
+ * @details Channels are truncated.
+ *
+ * @param[in] color     ARGB-8888 color
+ * @param[in] fmt       pixel format, a direct color one
+ * @return              The pixel value.
+ *
+ * @api
+ */
+uint32_t rasterFromARGB8888(uint32_t color, rasterfmt_t fmt) {
+
+  chDbgCheck(RASTER_IS_DIRECT(fmt), "rasterFromARGB8888");
+
+  switch (fmt) {
+  case RASTER_FMT_RGB888:
+    return color & 0x00FFFFFFU;
+  case RASTER_FMT_RGB565:
+    return encode_rgb565(color);
+  case RASTER_FMT_ARGB1555:
+    return ((color >> 16) & 0x8000U) | ((color >> 9) & 0x7C00U) |
+           ((color >> 6) & 0x03E0U) | ((color >> 3) & 0x001FU);
+  case RASTER_FMT_ARGB4444:
+    return ((color >> 16) & 0xF000U) | ((color >> 12) & 0x0F00U) |
+           ((color >> 8) & 0x00F0U) | ((color >> 4) & 0x000FU);
+  default:
+    return color;
+  }
+}
+
+/**
+ * @brief   Fills a rectangle with a color.
+ *
+ * @param[out] dstp     first pixel of the rectangle
+ * @param[in] pitch     bytes between rows
+ * @param[in] fmt       pixel format, byte sized
+ * @param[in] width     rectangle width, in pixels
+ * @param[in] height    rectangle height, in pixels
+ * @param[in] color     color, in the pixel format
+ *
+ * @api
+ */
+void rasterFill(void *dstp, size_t pitch, rasterfmt_t fmt,
+                uint16_t width, uint16_t height, uint32_t color) {
+#if RASTER_USE_SIMD
+  uint8_t pat[12];
+  uint8_t *d = (uint8_t *)dstp;
+  size_t n;
+  unsigned i, bpp;
+
+  chDbgCheck((dstp != NULL) && (rasterBytesPerPixel(fmt) > 0), "rasterFill");
+
+  bpp = bytes_per_pixel[fmt];
+  for (i = 0; i < 12; i++)
+    pat[i] = (uint8_t)(color >> (8 * (i % bpp)));
+
+  n = (size_t)width * bpp;
+  if (pitch == n) {
+    fill_row(d, n * height, pat);
+    return;
+  }
+  while (height-- > 0) {
+    fill_row(d, n, pat);
+    d += pitch;
+  }
+#else
+  rasterRefFill(dstp, pitch, fmt, width, height, color);
+#endif
+}
+
+/**
+ * @brief   Copies a rectangle.
+ *
+ * @param[out] dstp     first pixel of the destination rectangle
+ * @param[in] dpitch    bytes between destination rows
+ * @param[in] srcp      first pixel of the source rectangle
+ * @param[in] spitch    bytes between source rows
+ * @param[in] fmt       pixel format, byte sized
+ * @param[in] width     rectangle width, in pixels
+ * @param[in] height    rectangle height, in pixels
+ *
+ * @api
+ */
+void rasterCopy(void *dstp, size_t dpitch,
+                const void *srcp, size_t spitch, rasterfmt_t fmt,
+                uint16_t width, uint16_t height) {
+#if RASTER_USE_SIMD
+  uint8_t *d = (uint8_t *)dstp;
+  const uint8_t *s = (const uint8_t *)srcp;
+  size_t n;
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL) &&
+             (rasterBytesPerPixel(fmt) > 0), "rasterCopy");
+
+  /* The library memcpy() already moves words, or multiple words.*/
+  n = (size_t)width * bytes_per_pixel[fmt];
+  if ((dpitch == n) && (spitch == n)) {
+    memcpy(d, s, n * height);
+    return;
+  }
+  while (height-- > 0) {
+    memcpy(d, s, n);
+    d += dpitch;
+    s += spitch;
+  }
+#else
+  rasterRefCopy(dstp, dpitch, srcp, spitch, fmt, width, height);
+#endif
+}
+
+/**
+ * @brief   Copies a rectangle with a transparent color.
+ * @details The source pixels equal to the key are not copied, which the
+ *          DMA2D cannot do.
+ *
+ * @param[out] dstp     first pixel of the destination rectangle
+ * @param[in] dpitch    bytes between destination rows
+ * @param[in] srcp      first pixel of the source rectangle
+ * @param[in] spitch    bytes between source rows
+ * @param[in] width     rectangle width, in pixels
+ * @param[in] height    rectangle height, in pixels
+ * @param[in] key       transparent color, in any 8 bits format
+ *
+ * @api
+ */
+void rasterCopyKeyed(void *dstp, size_t dpitch,
+                     const void *srcp, size_t spitch,
+                     uint16_t width, uint16_t height, uint8_t key) {
+#if RASTER_USE_SIMD
+  uint8_t *d = (uint8_t *)dstp;
+  const uint8_t *s = (const uint8_t *)srcp;
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL), "rasterCopyKeyed");
+
+  while (height-- > 0) {
+    keyed_row(d, s, width, key);
+    d += dpitch;
+    s += spitch;
+  }
+#else
+  rasterRefCopyKeyed(dstp, dpitch, srcp, spitch, width, height, key);
+#endif
+}
+
+/**
+ * @brief   Blends an ARGB-8888 rectangle over another one.
+ * @details The source opacity is its alpha channel scaled by @p alpha.
+ *          Each channel becomes <tt>(s * a + d * (256 - a)) / 256</tt>
+ *          with @p a the opacity scaled to 0..256, the source alpha
+ *          channel counting as 255.
+ * @note    ARGB-8888 rectangles must be word aligned.
+ *
+ * @param[in,out] dstp  first pixel of the destination rectangle
+ * @param[in] dpitch    bytes between destination rows
+ * @param[in] fmt       destination format, a direct color one
+ * @param[in] srcp      first pixel of the ARGB-8888 source rectangle
+ * @param[in] spitch    bytes between source rows
+ * @param[in] width     rectangle width, in pixels
+ * @param[in] height    rectangle height, in pixels
+ * @param[in] alpha     constant alpha
+ *
+ * @api
+ */
+void rasterBlend(void *dstp, size_t dpitch, rasterfmt_t fmt,
+                 const uint32_t *srcp, size_t spitch,
+                 uint16_t width, uint16_t height, uint8_t alpha) {
+#if RASTER_USE_SIMD
+  uint8_t *d = (uint8_t *)dstp;
+  const uint8_t *s = (const uint8_t *)srcp;
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL) && RASTER_IS_DIRECT(fmt) &&
+             ((fmt != RASTER_FMT_ARGB8888) || ((size_t)dstp & 3) == 0),
+             "rasterBlend");
+
+  while (height-- > 0) {
+    blend_row(d, fmt, (const uint32_t *)s, width, (uint32_t)alpha + 1);
+    d += dpitch;
+    s += spitch;
+  }
+#else
+  rasterRefBlend(dstp, dpitch, fmt, srcp, spitch, width, height, alpha);
+#endif
+}
+
+/**
+ * @brief   Expands an L-8 rectangle through a palette.
+ * @note    ARGB-8888 rectangles must be word aligned.
+ *
+ * @param[out] dstp     first pixel of the destination rectangle
+ * @param[in] dpitch    bytes between destination rows
+ * @param[in] fmt       destination format, a direct color one
+ * @param[in] srcp      first pixel of the L-8 source rectangle
+ * @param[in] spitch    bytes between source rows
+ * @param[in] palette   ARGB-8888 palette
+ * @param[in] width     rectangle width, in pixels
+ * @param[in] height    rectangle height, in pixels
+ *
+ * @api
+ */
+void rasterExpand(void *dstp, size_t dpitch, rasterfmt_t fmt,
+                  const uint8_t *srcp, size_t spitch,
+                  const uint32_t *palette, uint16_t width, uint16_t height) {
+#if RASTER_USE_SIMD
+  uint8_t *d = (uint8_t *)dstp;
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL) && (palette != NULL) &&
+             RASTER_IS_DIRECT(fmt) &&
+             ((fmt != RASTER_FMT_ARGB8888) || ((size_t)dstp & 3) == 0),
+             "rasterExpand");
+
+  while (height-- > 0) {
+    expand_row(d, fmt, srcp, width, palette);
+    d += dpitch;
+    srcp += spitch;
+  }
+#else
+  rasterRefExpand(dstp, dpitch, fmt, srcp, spitch, palette, width, height);
+#endif
+}
+
+/**
+ * @brief   Converts a rectangle between direct color formats.
+ * @note    ARGB-8888 rectangles must be word aligned.
+ *
+ * @param[out] dstp     first pixel of the destination rectangle
+ * @param[in] dpitch    bytes between destination rows
+ * @param[in] dfmt      destination format, a direct color one
+ * @param[in] srcp      first pixel of the source rectangle
+ * @param[in] spitch    bytes between source rows
+ * @param[in] sfmt      source format, a direct color one
+ * @param[in] width     rectangle width, in pixels
+ * @param[in] height    rectangle height, in pixels
+ *
+ * @api
+ */
+void rasterConvert(void *dstp, size_t dpitch, rasterfmt_t dfmt,
+                   const void *srcp, size_t spitch, rasterfmt_t sfmt,
+                   uint16_t width, uint16_t height) {
+#if RASTER_USE_SIMD
+  uint8_t *d = (uint8_t *)dstp;
+  const uint8_t *s = (const uint8_t *)srcp;
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL) &&
+             RASTER_IS_DIRECT(dfmt) && RASTER_IS_DIRECT(sfmt) &&
+             ((dfmt != RASTER_FMT_ARGB8888) || ((size_t)dstp & 3) == 0) &&
+             ((sfmt != RASTER_FMT_ARGB8888) || ((size_t)srcp & 3) == 0),
+             "rasterConvert");
+
+  if (dfmt == sfmt) {
+    rasterCopy(dstp, dpitch, srcp, spitch, dfmt, width, height);
+    return;
+  }
+  while (height-- > 0) {
+    convert_row(d, dfmt, s, sfmt, width);
+    d += dpitch;
+    s += spitch;
+  }
+#else
+  rasterRefConvert(dstp, dpitch, dfmt, srcp, spitch, sfmt, width, height);
+#endif
+}
+
+/**
+ * @brief   Reference version of @p rasterFill().
+ *
+ * @api
+ */
+void rasterRefFill(void *dstp, size_t pitch, rasterfmt_t fmt,
+                   uint16_t width, uint16_t height, uint32_t color) {
+  unsigned x, y, bpp = rasterBytesPerPixel(fmt);
+
+  chDbgCheck((dstp != NULL) && (bpp > 0), "rasterRefFill");
+
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++)
+      pixel_store((uint8_t *)dstp + y * pitch + x * bpp, bpp, color);
+}
+
+/**
+ * @brief   Reference version of @p rasterCopy().
+ *
+ * @api
+ */
+void rasterRefCopy(void *dstp, size_t dpitch,
+                   const void *srcp, size_t spitch, rasterfmt_t fmt,
+                   uint16_t width, uint16_t height) {
+  unsigned x, y, bpp = rasterBytesPerPixel(fmt);
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL) && (bpp > 0), "rasterRefCopy");
+
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width * bpp; x++)
+      ((uint8_t *)dstp)[y * dpitch + x] =
+        ((const uint8_t *)srcp)[y * spitch + x];
+}
+
+/**
+ * @brief   Reference version of @p rasterCopyKeyed().
+ *
+ * @api
+ */
+void rasterRefCopyKeyed(void *dstp, size_t dpitch,
+                        const void *srcp, size_t spitch,
+                        uint16_t width, uint16_t height, uint8_t key) {
+  unsigned x, y;
+  uint8_t c;
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL), "rasterRefCopyKeyed");
+
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++) {
+      c = ((const uint8_t *)srcp)[y * spitch + x];
+      if (c != key)
+        ((uint8_t *)dstp)[y * dpitch + x] = c;
+    }
+}
+
+/**
+ * @brief   Reference version of @p rasterBlend().
+ *
+ * @api
+ */
+void rasterRefBlend(void *dstp, size_t dpitch, rasterfmt_t fmt,
+                    const uint32_t *srcp, size_t spitch,
+                    uint16_t width, uint16_t height, uint8_t alpha) {
+  unsigned x, y, i, bpp;
+  uint32_t s, d, a, sc, dc, out;
+  uint8_t *p;
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL) && RASTER_IS_DIRECT(fmt),
+             "rasterRefBlend");
+
+  bpp = bytes_per_pixel[fmt];
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++) {
+      s = pixel_load((const uint8_t *)srcp + y * spitch + x * 4, 4);
+      p = (uint8_t *)dstp + y * dpitch + x * bpp;
+      d = rasterToARGB8888(pixel_load(p, bpp), fmt);
+      a = (s >> 24) * ((uint32_t)alpha + 1) / 256;
+      if (a >= 128)
+        a++;
+      out = 0;
+      for (i = 0; i < 32; i += 8) {
+        sc = i == 24 ? 255 : (s >> i) & 0xFF;
+        dc = (d >> i) & 0xFF;
+        out |= ((sc * a + dc * (256 - a)) / 256) << i;
+      }
+      pixel_store(p, bpp, rasterFromARGB8888(out, fmt));
+    }
+}
+
+/**
+ * @brief   Reference version of @p rasterExpand().
+ *
+ * @api
+ */
+void rasterRefExpand(void *dstp, size_t dpitch, rasterfmt_t fmt,
+                     const uint8_t *srcp, size_t spitch,
+                     const uint32_t *palette,
+                     uint16_t width, uint16_t height) {
+  unsigned x, y, bpp;
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL) && (palette != NULL) &&
+             RASTER_IS_DIRECT(fmt), "rasterRefExpand");
+
+  bpp = bytes_per_pixel[fmt];
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++)
+      pixel_store((uint8_t *)dstp + y * dpitch + x * bpp, bpp,
+                  rasterFromARGB8888(palette[srcp[y * spitch + x]], fmt));
+}
+
+/**
+ * @brief   Reference version of @p rasterConvert().
+ *
+ * @api
+ */
+void rasterRefConvert(void *dstp, size_t dpitch, rasterfmt_t dfmt,
+                      const void *srcp, size_t spitch, rasterfmt_t sfmt,
+                      uint16_t width, uint16_t height) {
+  unsigned x, y, dbpp, sbpp;
+  uint32_t c;
+
+  chDbgCheck((dstp != NULL) && (srcp != NULL) &&
+             RASTER_IS_DIRECT(dfmt) && RASTER_IS_DIRECT(sfmt),
+             "rasterRefConvert");
+
+  dbpp = bytes_per_pixel[dfmt];
+  sbpp = bytes_per_pixel[sfmt];
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++) {
+      c = pixel_load((const uint8_t *)srcp + y * spitch + x * sbpp, sbpp);
+      pixel_store((uint8_t *)dstp + y * dpitch + x * dbpp, dbpp,
+                  rasterFromARGB8888(rasterToARGB8888(c, sfmt), dfmt));
+    }
+}
+
+/** @} */
@@ -0,0 +1,114 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    raster.h
+ * @brief   CPU raster kernels macros and structures.
+ *
+ * @addtogroup raster
+ * @{
+ */
+
+#ifndef _RASTER_H_
+#define _RASTER_H_
+
+/**
+ * @brief   Enables the word parallel kernels.
+ * @details The Cortex-M4 DSP instructions are used when available, portable
+ *          equivalents otherwise. When disabled the API functions are the
+ *          reference ones.
+ */
+#if !defined(RASTER_USE_SIMD) || defined(__DOXYGEN__)
+#define RASTER_USE_SIMD             TRUE
+#endif
+
+/**
+ * @name    Pixel formats
+ * @note    Same encoding as the @p DMA2D_FMT_* constants.
+ * @{
+ */
+#define RASTER_FMT_ARGB8888         0   /**< @brief ARGB-8888.              */
+#define RASTER_FMT_RGB888           1   /**< @brief RGB-888.                */
+#define RASTER_FMT_RGB565           2   /**< @brief RGB-565.                */
+#define RASTER_FMT_ARGB1555         3   /**< @brief ARGB-1555.              */
+#define RASTER_FMT_ARGB4444         4   /**< @brief ARGB-4444.              */
+#define RASTER_FMT_L8               5   /**< @brief L-8.                    */
+#define RASTER_FMT_AL44             6   /**< @brief AL-44.                  */
+#define RASTER_FMT_AL88             7   /**< @brief AL-88.                  */
+#define RASTER_FMT_A8               9   /**< @brief A-8.                    */
+/** @} */
+
+/**
+ * @brief   Pixel format.
+ * @details Fill and copy accept any byte sized format, conversion and
+ *          blending are limited to the direct color ones, ARGB-8888 to
+ *          ARGB-4444.
+ */
+typedef uint32_t rasterfmt_t;
+
+/**
+ * @brief   Checks for a direct color format.
+ */
+#define RASTER_IS_DIRECT(fmt)       ((fmt) <= RASTER_FMT_ARGB4444)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  unsigned rasterBytesPerPixel(rasterfmt_t fmt);
+  uint32_t rasterToARGB8888(uint32_t pixel, rasterfmt_t fmt);
+  uint32_t rasterFromARGB8888(uint32_t color, rasterfmt_t fmt);
+  void rasterFill(void *dstp, size_t pitch, rasterfmt_t fmt,
+                  uint16_t width, uint16_t height, uint32_t color);
+  void rasterCopy(void *dstp, size_t dpitch,
+                  const void *srcp, size_t spitch, rasterfmt_t fmt,
+                  uint16_t width, uint16_t height);
+  void rasterCopyKeyed(void *dstp, size_t dpitch,
+                       const void *srcp, size_t spitch,
+                       uint16_t width, uint16_t height, uint8_t key);
+  void rasterBlend(void *dstp, size_t dpitch, rasterfmt_t fmt,
+                   const uint32_t *srcp, size_t spitch,
+                   uint16_t width, uint16_t height, uint8_t alpha);
+  void rasterExpand(void *dstp, size_t dpitch, rasterfmt_t fmt,
+                    const uint8_t *srcp, size_t spitch,
+                    const uint32_t *palette, uint16_t width, uint16_t height);
+  void rasterConvert(void *dstp, size_t dpitch, rasterfmt_t dfmt,
+                     const void *srcp, size_t spitch, rasterfmt_t sfmt,
+                     uint16_t width, uint16_t height);
+  void rasterRefFill(void *dstp, size_t pitch, rasterfmt_t fmt,
+                     uint16_t width, uint16_t height, uint32_t color);
+  void rasterRefCopy(void *dstp, size_t dpitch,
+                     const void *srcp, size_t spitch, rasterfmt_t fmt,
+                     uint16_t width, uint16_t height);
+  void rasterRefCopyKeyed(void *dstp, size_t dpitch,
+                          const void *srcp, size_t spitch,
+                          uint16_t width, uint16_t height, uint8_t key);
+  void rasterRefBlend(void *dstp, size_t dpitch, rasterfmt_t fmt,
+                      const uint32_t *srcp, size_t spitch,
+                      uint16_t width, uint16_t height, uint8_t alpha);
+  void rasterRefExpand(void *dstp, size_t dpitch, rasterfmt_t fmt,
+                       const uint8_t *srcp, size_t spitch,
+                       const uint32_t *palette,
+                       uint16_t width, uint16_t height);
+  void rasterRefConvert(void *dstp, size_t dpitch, rasterfmt_t dfmt,
+                        const void *srcp, size_t spitch, rasterfmt_t sfmt,
+                        uint16_t width, uint16_t height);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RASTER_H_ */
+
+/** @} */
@@ -0,0 +1,118 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    tracestream.c
+ * @brief   Kernel events trace streaming code.
+ *
+ * @addtogroup trace_stream
+ * @{
+ */
+
+#include <string.h>
+
+#include "ch.h"
+#include "tracestream.h"
+
+static void write_names(BaseSequentialStream *chp) {
+#if CH_USE_REGISTRY
+  Thread *tp;
+
+  tp = chRegFirstThread();
+  do {
+    ch_trace_event_t te;
+    const char *name = chRegGetThreadName(tp);
+    size_t n = name != NULL ? strlen(name) : 0;
+
+    if (n > 255)
+      n = 255;
+    te.te_time = port_rt_get_counter_value();
+    te.te_obj  = (uint32_t)(size_t)tp;
+    te.te_type = CH_TRACE_NAME;
+    te.te_info = (uint8_t)n;
+    te.te_seq  = 0;
+    chSequentialStreamWrite(chp, (const uint8_t *)&te, sizeof(te));
+    if (n > 0)
+      chSequentialStreamWrite(chp, (const uint8_t *)name, n);
+    tp = chRegNextThread(tp);
+  } while (tp != NULL);
+#else
+  (void)chp;
+#endif
+}
+
+static msg_t trace_thread(void *p) {
+  const TraceStreamConfig *tscp = p;
+  BaseSequentialStream *chp = tscp->tsc_channel;
+  ch_trace_event_t buf[TRACE_STREAM_BATCH];
+  TraceStreamHeader th;
+  systime_t start, names;
+  size_t n;
+
+  chRegSetThreadName("trace");
+
+  memcpy(th.th_magic, "CHTR", 4);
+  th.th_version     = TRACE_STREAM_VERSION;
+  th.th_record_size = sizeof(ch_trace_event_t);
+  th.th_reserved    = 0;
+  th.th_frequency   = tscp->tsc_frequency;
+  chSequentialStreamWrite(chp, (const uint8_t *)&th, sizeof(th));
+
+  /* Records are dropped rather than overwritten from now on.*/
+  chDbgTraceSetStreaming(TRUE);
+  start = names = chTimeNow();
+  write_names(chp);
+  while (!chThdShouldTerminate()) {
+    if ((tscp->tsc_duration > 0) &&
+        (chTimeElapsedSince(start) >= tscp->tsc_duration))
+      break;
+    n = chDbgTraceRead(buf, TRACE_STREAM_BATCH);
+    if (n > 0)
+      chSequentialStreamWrite(chp, (const uint8_t *)buf,
+                              n * sizeof(ch_trace_event_t));
+    else
+      chThdSleep(TRACE_STREAM_POLL);
+    if (chTimeElapsedSince(names) >= TRACE_STREAM_NAMES) {
+      names = chTimeNow();
+      write_names(chp);
+    }
+  }
+  chDbgTraceSetStreaming(FALSE);
+  return 0;
+}
+
+/**
+ * @brief   Spawns a trace streaming thread.
+ * @details The thread continuously drains the kernel events tracer buffer
+ *          into the configured channel, the stream can be converted into
+ *          a timeline using the host decoder in @p tools/chtrace.
+ * @note    The tracer buffer is switched to streaming mode until the
+ *          thread terminates, either after the configured duration or
+ *          when requested using @p chThdTerminate().
+ *
+ * @param[in] tscp      pointer to a @p TraceStreamConfig object
+ * @param[in] wsp       pointer to a working area dedicated to the thread
+ * @param[in] size      size of the working area
+ * @param[in] prio      priority level for the new thread
+ * @return              A pointer to the streaming thread.
+ */
+Thread *traceStreamCreateStatic(const TraceStreamConfig *tscp, void *wsp,
+                                size_t size, tprio_t prio) {
+
+  return chThdCreateStatic(wsp, size, prio, trace_thread, (void *)tscp);
+}
+
+/** @} */
@@ -0,0 +1,103 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    tracestream.h
+ * @brief   Kernel events trace streaming macros and structures.
+ *
+ * @addtogroup trace_stream
+ * @{
+ */
+
+#ifndef _TRACESTREAM_H_
+#define _TRACESTREAM_H_
+
+/*
+ * Module dependencies check.
+ */
+#if !CH_DBG_TRACE_EVENTS
+#error "Trace streaming requires CH_DBG_TRACE_EVENTS"
+#endif
+
+/**
+ * @brief   Number of records written to the channel in a single operation.
+ */
+#if !defined(TRACE_STREAM_BATCH) || defined(__DOXYGEN__)
+#define TRACE_STREAM_BATCH          16
+#endif
+
+/**
+ * @brief   Polling interval when the trace buffer is empty.
+ */
+#if !defined(TRACE_STREAM_POLL) || defined(__DOXYGEN__)
+#define TRACE_STREAM_POLL           MS2ST(10)
+#endif
+
+/**
+ * @brief   Interval between threads names updates.
+ */
+#if !defined(TRACE_STREAM_NAMES) || defined(__DOXYGEN__)
+#define TRACE_STREAM_NAMES          MS2ST(1000)
+#endif
+
+/**
+ * @brief   Stream format version.
+ */
+#define TRACE_STREAM_VERSION        1
+
+/**
+ * @brief   Stream header.
+ * @details The header is sent once at the beginning of the stream, it is
+ *          followed by @p ch_trace_event_t records, a @p CH_TRACE_NAME
+ *          record is followed by the thread name characters. All fields
+ *          are in the target endianness.
+ */
+typedef struct {
+  char                  th_magic[4];        /**< @brief "CHTR".             */
+  uint8_t               th_version;         /**< @brief Format version.     */
+  uint8_t               th_record_size;     /**< @brief Record size.        */
+  uint16_t              th_reserved;        /**< @brief Reserved, zero.     */
+  uint32_t              th_frequency;       /**< @brief Timestamps frequency
+                                                 in Hz.                     */
+} TraceStreamHeader;
+
+/**
+ * @brief   Trace stream configuration.
+ */
+typedef struct {
+  BaseSequentialStream  *tsc_channel;       /**< @brief Output channel.     */
+  uint32_t              tsc_frequency;      /**< @brief Timestamps frequency
+                                                 in Hz, the cycle counter
+                                                 clock if the port provides
+                                                 one or @p CH_FREQUENCY.    */
+  systime_t             tsc_duration;       /**< @brief Stream duration in
+                                                 system ticks, zero streams
+                                                 until the thread is asked
+                                                 to terminate.              */
+} TraceStreamConfig;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  Thread *traceStreamCreateStatic(const TraceStreamConfig *tscp, void *wsp,
+                                  size_t size, tprio_t prio);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TRACESTREAM_H_ */
+
+/** @} */
@@ -22,6 +22,8 @@
  * @{
  */
 
+#include <string.h>
+
 #include "ch.h"
 #include "hal.h"
 
@@ -47,9 +49,9 @@ static const uint8_t scsi_inquiry_data[] = {
   0x00,             /* Direct Access Device.      */
   0x80,             /* RMB = 1: Removable Medium. */
   0x02,             /* ISO, ECMA, ANSI = 2.       */
-  0x00,             /* UFI response format.       */
+  0x02,             /* SPC-2 response format.     */
 
-  36 - 4,           /* Additional Length.         */
+  36 - 5,           /* Additional Length.         */
   0x00,
   0x00,
   0x00,
@@ -62,112 +64,570 @@ static const uint8_t scsi_inquiry_data[] = {
   '1', '.', '0', ' '
 };
 
-/**
- * @brief   Generic buffer.
- */
-uint8_t buf[16];
-
 /*===========================================================================*/
-/* MMC interface code.                                                       */
+/* Driver local functions.                                                   */
 /*===========================================================================*/
 
-/*===========================================================================*/
-/* SCSI emulation code.                                                      */
-/*===========================================================================*/
+#define USBP(mscp) ((mscp)->config->usbp)
+#define BLKP(mscp) ((mscp)->config->blkp)
+#define BUF(mscp, i) ((uint8_t *)(mscp)->buf[i])
 
-static uint8_t scsi_read_format_capacities(uint32_t *nblocks,
-                                           uint32_t *secsize) {
+static uint32_t get_be32(const uint8_t *p) {
 
-  *nblocks = 1024;
-  *secsize = 512;
-  return 3; /* No Media.*/
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+         ((uint32_t)p[2] << 8) | (uint32_t)p[3];
 }
 
-/*===========================================================================*/
-/* Mass Storage Class related code.                                          */
-/*===========================================================================*/
+static void put_be32(uint8_t *p, uint32_t v) {
 
-/**
- * @brief   MSC state machine current state.
+  p[0] = (uint8_t)(v >> 24);
+  p[1] = (uint8_t)(v >> 16);
+  p[2] = (uint8_t)(v >> 8);
+  p[3] = (uint8_t)v;
+}
+
+/*
+ * Wakes up the driver thread if it is waiting for an endpoint.
  */
-static mscstate_t msc_state;
+static void msc_wakeup_i(USBMassStorageDriver *mscp) {
 
-/**
- * @brief   Received CBW.
+  if (mscp->wait != NULL) {
+    Thread *tp = mscp->wait;
+    mscp->wait = NULL;
+    chSchReadyI(tp);
+  }
+}
+
+/*
+ * Waits for the end of the transaction on an endpoint, returns CH_FAILED
+ * if the current command has to be abandoned. A bus reset silently drops
+ * the transactions, the device is no more active then.
  */
-static msccbw_t CBW;
+static bool_t msc_wait(USBMassStorageDriver *mscp, bool_t in) {
+  USBDriver *usbp = USBP(mscp);
+  bool_t err;
+
+  chSysLock();
+  while (!mscp->reset && !chThdShouldTerminate() &&
+         (usbGetDriverStateI(usbp) == USB_ACTIVE) &&
+         (in ? usbGetTransmitStatusI(usbp, mscp->config->bulk_in) :
+               usbGetReceiveStatusI(usbp, mscp->config->bulk_out))) {
+    mscp->wait = chThdSelf();
+    chSchGoSleepS(THD_STATE_SUSPENDED);
+  }
+  err = mscp->reset || chThdShouldTerminate() ||
+        (usbGetDriverStateI(usbp) != USB_ACTIVE);
+  chSysUnlock();
+  return err;
+}
 
-/**
- * @brief   CSW to be transmitted.
+static void msc_start_transmit(USBMassStorageDriver *mscp,
+                               const uint8_t *p, size_t n) {
+
+  usbPrepareTransmit(USBP(mscp), mscp->config->bulk_in, p, n);
+  chSysLock();
+  usbStartTransmitI(USBP(mscp), mscp->config->bulk_in);
+  chSysUnlock();
+}
+
+static void msc_start_receive(USBMassStorageDriver *mscp,
+                              uint8_t *p, size_t n) {
+
+  usbPrepareReceive(USBP(mscp), mscp->config->bulk_out, p, n);
+  chSysLock();
+  usbStartReceiveI(USBP(mscp), mscp->config->bulk_out);
+  chSysUnlock();
+}
+
+/*
+ * Size of the last transaction received on the OUT endpoint.
  */
-static msccsw_t CSW;
+static size_t msc_received(USBMassStorageDriver *mscp) {
+  size_t n;
 
-/**
- * @brief   MSC state machine initialization.
- *
- * @param[in] usbp      pointer to the @p USBDriver object
+  chSysLock();
+  n = usbGetReceiveTransactionSizeI(USBP(mscp), mscp->config->bulk_out);
+  chSysUnlock();
+  return n;
+}
+
+static void msc_stall_in(USBMassStorageDriver *mscp) {
+
+  chSysLock();
+  usbStallTransmitI(USBP(mscp), mscp->config->bulk_in);
+  chSysUnlock();
+}
+
+static void msc_stall_out(USBMassStorageDriver *mscp) {
+
+  chSysLock();
+  usbStallReceiveI(USBP(mscp), mscp->config->bulk_out);
+  chSysUnlock();
+}
+
+/*
+ * Terminates the data stage after @p n bytes have been moved, the host
+ * expecting more data is notified by stalling the endpoint, 6.7.2 and
+ * 6.7.3. A short IN packet already terminates the transfer.
+ */
+static void msc_end_data(USBMassStorageDriver *mscp, uint32_t n) {
+
+  mscp->csw.dCSWDataResidue = mscp->cbw.dCBWDataTransferLength - n;
+  if (mscp->csw.dCSWDataResidue == 0)
+    return;
+  if (mscp->cbw.bmCBWFlags & 0x80) {
+    if ((n % USBP(mscp)->epc[mscp->config->bulk_in]->in_maxsize) == 0)
+      msc_stall_in(mscp);
+  }
+  else
+    msc_stall_out(mscp);
+}
+
+/*
+ * Phase error, the host asked for less data or for the opposite direction
+ * than the command needs, 6.7.
  */
-static void msc_reset(USBDriver *usbp) {
+static void msc_phase_error(USBMassStorageDriver *mscp) {
 
-  msc_state = MSC_IDLE;
-  chSysLockFromIsr();
-  usbStartReceiveI(usbp, MSC_DATA_OUT_EP, (uint8_t *)&CBW, sizeof CBW);
-  chSysUnlockFromIsr();
+  mscp->csw.bCSWStatus = MSC_CSW_STATUS_PHASE_ERROR;
+  msc_end_data(mscp, 0);
 }
 
-static void msc_transmit(USBDriver *usbp, const uint8_t *p, size_t n) {
+static void msc_sense(USBMassStorageDriver *mscp,
+                      uint8_t key, uint8_t asc) {
 
-  if (n > CBW.dCBWDataTransferLength)
-    n = CBW.dCBWDataTransferLength;
-  CSW.dCSWDataResidue = CBW.dCBWDataTransferLength - (uint32_t)n;
-  chSysLockFromIsr();
-  usbStartTransmitI(usbp, MSC_DATA_IN_EP, p, n);
-  chSysUnlockFromIsr();
+  mscp->sense[0] = key;
+  mscp->sense[1] = asc;
+  mscp->sense[2] = 0;
 }
 
-static void msc_sendstatus(USBDriver *usbp) {
+static void msc_fail(USBMassStorageDriver *mscp,
+                     uint8_t key, uint8_t asc) {
 
-  msc_state = MSC_SENDING_CSW;
-  chSysLockFromIsr();
-  usbStartTransmitI(usbp, MSC_DATA_IN_EP, (uint8_t *)&CSW, sizeof CSW);
-  chSysUnlockFromIsr();
+  mscp->csw.bCSWStatus = MSC_CSW_STATUS_FAILED;
+  msc_sense(mscp, key, asc);
 }
 
-static bool_t msc_decode(USBDriver *usbp) {
-  uint32_t nblocks, secsize;
+/*
+ * Checks that the device is ready to move data.
+ */
+static bool_t msc_check_medium(USBMassStorageDriver *mscp) {
+  BlockDeviceInfo bdi;
+
+  if (!blkIsInserted(BLKP(mscp)) ||
+      (blkGetDriverState(BLKP(mscp)) != BLK_READY) ||
+      blkGetInfo(BLKP(mscp), &bdi) ||
+      (bdi.blk_size == 0) || ((MSC_BUFFER_SIZE % bdi.blk_size) != 0)) {
+    msc_fail(mscp, SCSI_SENSE_NOT_READY, SCSI_ASC_MEDIUM_NOT_PRESENT);
+    return CH_FAILED;
+  }
+  mscp->blk_size = bdi.blk_size;
+  mscp->blk_num  = bdi.blk_num;
+  return CH_SUCCESS;
+}
 
-  switch (CBW.CBWCB[0]) {
-  case SCSI_REQUEST_SENSE:
-    break;
+/*
+ * Sends the response of a command, the response is truncated to the
+ * allocation length. A host expecting less data than the device has to
+ * send gets a phase error, case 7 of 6.7.2.
+ */
+static bool_t msc_send(USBMassStorageDriver *mscp, const uint8_t *p,
+                       uint32_t n, uint32_t alloc) {
+
+  if (n > alloc)
+    n = alloc;
+  if (n == 0) {
+    msc_end_data(mscp, 0);
+    return CH_SUCCESS;
+  }
+  if (!(mscp->cbw.bmCBWFlags & 0x80) ||
+      (n > mscp->cbw.dCBWDataTransferLength)) {
+    msc_phase_error(mscp);
+    return CH_SUCCESS;
+  }
+  msc_start_transmit(mscp, p, n);
+  if (msc_wait(mscp, TRUE))
+    return CH_FAILED;
+  msc_end_data(mscp, n);
+  return CH_SUCCESS;
+}
+
+/*
+ * Checks the data stage of a READ(10) or WRITE(10) command, returns
+ * CH_FAILED if there is nothing to transfer.
+ */
+static bool_t msc_check_rw(USBMassStorageDriver *mscp, bool_t in,
+                           uint32_t lba, uint32_t count) {
+  uint32_t n = mscp->cbw.dCBWDataTransferLength;
+
+  if (count == 0) {
+    msc_end_data(mscp, 0);
+    return CH_FAILED;
+  }
+  if ((n == 0) || (!(mscp->cbw.bmCBWFlags & 0x80) != !in) ||
+      (n < count * mscp->blk_size)) {
+    msc_phase_error(mscp);
+    return CH_FAILED;
+  }
+  if ((lba >= mscp->blk_num) || (count > mscp->blk_num - lba)) {
+    msc_fail(mscp, SCSI_SENSE_ILLEGAL_REQUEST, SCSI_ASC_LBA_OUT_OF_RANGE);
+    msc_end_data(mscp, 0);
+    return CH_FAILED;
+  }
+  return CH_SUCCESS;
+}
+
+/*
+ * READ(10), a chunk is read from the device while the previous one is
+ * being transmitted.
+ */
+static bool_t msc_read(USBMassStorageDriver *mscp, uint32_t lba,
+                       uint32_t count) {
+  uint32_t chunk = MSC_BUFFER_SIZE / mscp->blk_size;
+  uint32_t done = 0, n;
+  unsigned i = 0;
+
+  if (msc_check_rw(mscp, TRUE, lba, count))
+    return CH_SUCCESS;
+
+  while (count > 0) {
+    n = count < chunk ? count : chunk;
+    if (blkRead(BLKP(mscp), lba, BUF(mscp, i), n)) {
+      msc_fail(mscp, SCSI_SENSE_MEDIUM_ERROR, SCSI_ASC_READ_ERROR);
+      break;
+    }
+    mscp->blocks_read += n;
+    if (msc_wait(mscp, TRUE))
+      return CH_FAILED;
+    msc_start_transmit(mscp, BUF(mscp, i), n * mscp->blk_size);
+    done  += n * mscp->blk_size;
+    lba   += n;
+    count -= n;
+    i ^= 1;
+  }
+  if (msc_wait(mscp, TRUE))
+    return CH_FAILED;
+  msc_end_data(mscp, done);
+  return CH_SUCCESS;
+}
+
+/*
+ * WRITE(10), a chunk is received while the previous one is being written
+ * to the device.
+ */
+static bool_t msc_write(USBMassStorageDriver *mscp, uint32_t lba,
+                        uint32_t count) {
+  uint32_t chunk = MSC_BUFFER_SIZE / mscp->blk_size;
+  uint32_t done = 0, n, next;
+  unsigned i = 0;
+
+  if (msc_check_rw(mscp, FALSE, lba, count))
+    return CH_SUCCESS;
+  if (blkIsWriteProtected(BLKP(mscp))) {
+    msc_fail(mscp, SCSI_SENSE_DATA_PROTECT, SCSI_ASC_WRITE_PROTECTED);
+    msc_end_data(mscp, 0);
+    return CH_SUCCESS;
+  }
+
+  n = count < chunk ? count : chunk;
+  msc_start_receive(mscp, BUF(mscp, 0), n * mscp->blk_size);
+  while (TRUE) {
+    if (msc_wait(mscp, FALSE))
+      return CH_FAILED;
+    if (msc_received(mscp) != n * mscp->blk_size) {
+      /* Short packet before the end of the data.*/
+      mscp->csw.bCSWStatus = MSC_CSW_STATUS_PHASE_ERROR;
+      break;
+    }
+    done  += n * mscp->blk_size;
+    count -= n;
+
+    /* Receiving the next chunk in the other buffer.*/
+    next = count < chunk ? count : chunk;
+    if (next > 0)
+      msc_start_receive(mscp, BUF(mscp, i ^ 1), next * mscp->blk_size);
+
+    if (blkWrite(BLKP(mscp), lba, BUF(mscp, i), n)) {
+      msc_fail(mscp, SCSI_SENSE_MEDIUM_ERROR, SCSI_ASC_WRITE_ERROR);
+      if (next > 0) {
+        /* The chunk already requested is accepted and discarded.*/
+        if (msc_wait(mscp, FALSE))
+          return CH_FAILED;
+        done += msc_received(mscp);
+      }
+      break;
+    }
+    mscp->blocks_written += n;
+    if (next == 0)
+      break;
+    lba += n;
+    n = next;
+    i ^= 1;
+  }
+  msc_end_data(mscp, done);
+  return CH_SUCCESS;
+}
+
+/*
+ * Executes the SCSI command in the current CBW, returns CH_FAILED if the
+ * command has been abandoned.
+ */
+static bool_t msc_scsi(USBMassStorageDriver *mscp) {
+  const uint8_t *cb = mscp->cbw.CBWCB;
+  uint8_t *bp = BUF(mscp, 0);
+  uint32_t alloc;
+
+  /* The sense data describes the last command, REQUEST SENSE excluded.*/
+  if (cb[0] != SCSI_REQUEST_SENSE)
+    msc_sense(mscp, SCSI_SENSE_NO_SENSE, SCSI_ASC_NONE);
+  mscp->csw.bCSWStatus = MSC_CSW_STATUS_PASSED;
+
+  switch (cb[0]) {
   case SCSI_INQUIRY:
-    msc_transmit(usbp, (uint8_t *)&scsi_inquiry_data,
-                 sizeof scsi_inquiry_data);
-    CSW.bCSWStatus = MSC_CSW_STATUS_PASSED;
+    if (cb[1] & 0x01) {
+      /* Vital product data pages not supported.*/
+      msc_fail(mscp, SCSI_SENSE_ILLEGAL_REQUEST, SCSI_ASC_INVALID_FIELD);
+      break;
+    }
+    alloc = ((uint32_t)cb[3] << 8) | cb[4];
+    return msc_send(mscp, scsi_inquiry_data, sizeof scsi_inquiry_data,
+                    alloc);
+  case SCSI_REQUEST_SENSE:
+    memset(bp, 0, 18);
+    bp[0]  = 0x70;
+    bp[2]  = mscp->sense[0];
+    bp[7]  = 18 - 8;
+    bp[12] = mscp->sense[1];
+    bp[13] = mscp->sense[2];
+    msc_sense(mscp, SCSI_SENSE_NO_SENSE, SCSI_ASC_NONE);
+    return msc_send(mscp, bp, 18, cb[4]);
+  case SCSI_TEST_UNIT_READY:
+    msc_check_medium(mscp);
     break;
+  case SCSI_READ_CAPACITY10:
+    if (msc_check_medium(mscp))
+      break;
+    put_be32(bp, mscp->blk_num - 1);
+    put_be32(bp + 4, mscp->blk_size);
+    return msc_send(mscp, bp, 8, 8);
   case SCSI_READ_FORMAT_CAPACITIES:
-    buf[8]  = scsi_read_format_capacities(&nblocks, &secsize);
-    buf[0]  = buf[1] = buf[2] = 0;
-    buf[3]  = 8;
-    buf[4]  = (uint8_t)(nblocks >> 24);
-    buf[5]  = (uint8_t)(nblocks >> 16);
-    buf[6]  = (uint8_t)(nblocks >> 8);
-    buf[7]  = (uint8_t)(nblocks >> 0);
-    buf[9]  = (uint8_t)(secsize >> 16);
-    buf[10] = (uint8_t)(secsize >> 8);
-    buf[11] = (uint8_t)(secsize >> 0);
-    msc_transmit(usbp, buf, 12);
-    CSW.bCSWStatus = MSC_CSW_STATUS_PASSED;
+    memset(bp, 0, 12);
+    bp[3] = 8;
+    if (msc_check_medium(mscp)) {
+      /* No media, maximum formattable capacity.*/
+      bp[8] = 0x03;
+      mscp->csw.bCSWStatus = MSC_CSW_STATUS_PASSED;
+    }
+    else {
+      /* Formatted media, current capacity.*/
+      put_be32(bp + 4, mscp->blk_num);
+      put_be32(bp + 8, mscp->blk_size);
+      bp[8] = 0x02;
+    }
+    alloc = ((uint32_t)cb[7] << 8) | cb[8];
+    return msc_send(mscp, bp, 12, alloc);
+  case SCSI_MODE_SENSE6:
+    /* Header only, the WP bit is in the device specific parameter.*/
+    bp[0] = 3;
+    bp[1] = 0;
+    bp[2] = blkIsWriteProtected(BLKP(mscp)) ? 0x80 : 0x00;
+    bp[3] = 0;
+    return msc_send(mscp, bp, 4, cb[4]);
+  case SCSI_MODE_SENSE10:
+    memset(bp, 0, 8);
+    bp[1] = 6;
+    bp[3] = blkIsWriteProtected(BLKP(mscp)) ? 0x80 : 0x00;
+    alloc = ((uint32_t)cb[7] << 8) | cb[8];
+    return msc_send(mscp, bp, 8, alloc);
+  case SCSI_ALLOW_MEDIUM_REMOVAL:
+  case SCSI_START_STOP_UNIT:
+    break;
+  case SCSI_SYNCHRONIZE_CACHE10:
+    if (!msc_check_medium(mscp) && blkSync(BLKP(mscp)))
+      msc_fail(mscp, SCSI_SENSE_MEDIUM_ERROR, SCSI_ASC_WRITE_ERROR);
+    break;
+  case SCSI_VERIFY10:
+    /* The media is not compared, byte checking is not supported.*/
+    if (cb[1] & 0x02)
+      msc_fail(mscp, SCSI_SENSE_ILLEGAL_REQUEST, SCSI_ASC_INVALID_FIELD);
+    else
+      msc_check_medium(mscp);
     break;
+  case SCSI_READ10:
+    if (msc_check_medium(mscp))
+      break;
+    return msc_read(mscp, get_be32(cb + 2), ((uint32_t)cb[7] << 8) | cb[8]);
+  case SCSI_WRITE10:
+    if (msc_check_medium(mscp))
+      break;
+    return msc_write(mscp, get_be32(cb + 2), ((uint32_t)cb[7] << 8) | cb[8]);
   default:
-    return TRUE;
+    msc_fail(mscp, SCSI_SENSE_ILLEGAL_REQUEST, SCSI_ASC_INVALID_COMMAND);
+    break;
+  }
+
+  /* Commands without data stage.*/
+  msc_end_data(mscp, 0);
+  return CH_SUCCESS;
+}
+
+/*
+ * Serves a CBW, data and CSW sequence, returns CH_FAILED if the transport
+ * has to wait for a reset.
+ */
+static bool_t msc_transport(USBMassStorageDriver *mscp) {
+  size_t n;
+
+  msc_start_receive(mscp, (uint8_t *)&mscp->cbw, sizeof mscp->cbw);
+  if (msc_wait(mscp, FALSE))
+    return CH_FAILED;
+
+  /* Invalid CBW, both endpoints stalled until a reset recovery, 6.6.1.*/
+  n = msc_received(mscp);
+  if ((n != MSC_CBW_SIZE) ||
+      (mscp->cbw.dCBWSignature != MSC_CBW_SIGNATURE)) {
+    msc_stall_in(mscp);
+    msc_stall_out(mscp);
+    return CH_FAILED;
+  }
+
+  mscp->csw.dCSWSignature = MSC_CSW_SIGNATURE;
+  mscp->csw.dCSWTag = mscp->cbw.dCBWTag;
+  mscp->csw.dCSWDataResidue = mscp->cbw.dCBWDataTransferLength;
+  if (msc_scsi(mscp))
+    return CH_FAILED;
+
+  /* The CSW is queued even if the endpoint is stalled, it is sent after
+     the host clears the halt condition.*/
+  msc_start_transmit(mscp, (uint8_t *)&mscp->csw, MSC_CSW_SIZE);
+  return msc_wait(mscp, TRUE);
+}
+
+/*
+ * Driver thread, the transport restarts from the CBW stage after each
+ * configuration or reset.
+ */
+static msg_t msc_thread(void *arg) {
+  USBMassStorageDriver *mscp = arg;
+
+  chRegSetThreadName("usb_msc");
+  while (TRUE) {
+    chSysLock();
+    while (!mscp->reset && !chThdShouldTerminate()) {
+      mscp->wait = chThdSelf();
+      chSchGoSleepS(THD_STATE_SUSPENDED);
+    }
+    if (chThdShouldTerminate()) {
+      chSysUnlock();
+      return 0;
+    }
+    mscp->reset = FALSE;
+    chSysUnlock();
+
+    while (msc_transport(mscp) == CH_SUCCESS)
+      ;
   }
-  return FALSE;
 }
 
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
 
+/**
+ * @brief   Initializes a mass storage driver object.
+ *
+ * @param[out] mscp     pointer to a @p USBMassStorageDriver structure
+ *
+ * @init
+ */
+void mscObjectInit(USBMassStorageDriver *mscp) {
+
+  mscp->state  = MSC_STOP;
+  mscp->config = NULL;
+  mscp->thread = NULL;
+  mscp->wait   = NULL;
+  mscp->reset  = FALSE;
+}
+
+/**
+ * @brief   Configures and starts the driver.
+ * @details The driver thread is created, the transport starts when the
+ *          USB configuration is selected, see @p mscConfigureHookI().
+ *
+ * @param[in] mscp      pointer to a @p USBMassStorageDriver object
+ * @param[in] config    the mass storage driver configuration
+ *
+ * @api
+ */
+void mscStart(USBMassStorageDriver *mscp,
+              const USBMassStorageConfig *config) {
+  USBDriver *usbp = config->usbp;
+
+  chDbgCheck((mscp != NULL) && (config->blkp != NULL), "mscStart");
+  chDbgAssert(mscp->state == MSC_STOP, "mscStart(), #1", "invalid state");
+
+  mscp->config = config;
+  mscp->reset  = FALSE;
+  mscp->sense[0] = SCSI_SENSE_NO_SENSE;
+  mscp->sense[1] = SCSI_ASC_NONE;
+  mscp->sense[2] = 0;
+  mscp->blocks_read = mscp->blocks_written = 0;
+  mscp->thread = chThdCreateStatic(mscp->wa, sizeof mscp->wa,
+                                   MSC_THREAD_PRIORITY, msc_thread, mscp);
+
+  chSysLock();
+  usbp->in_params[config->bulk_in - 1]   = mscp;
+  usbp->out_params[config->bulk_out - 1] = mscp;
+  mscp->state = MSC_READY;
+  chSysUnlock();
+}
+
+/**
+ * @brief   Stops the driver.
+ * @details The driver thread terminates after the block device operation
+ *          in progress, if any.
+ *
+ * @param[in] mscp      pointer to a @p USBMassStorageDriver object
+ *
+ * @api
+ */
+void mscStop(USBMassStorageDriver *mscp) {
+  USBDriver *usbp = mscp->config->usbp;
+
+  chDbgCheck(mscp != NULL, "mscStop");
+  chDbgAssert(mscp->state == MSC_READY, "mscStop(), #1", "invalid state");
+
+  chSysLock();
+  usbp->in_params[mscp->config->bulk_in - 1]   = NULL;
+  usbp->out_params[mscp->config->bulk_out - 1] = NULL;
+  mscp->state = MSC_STOP;
+  chThdTerminate(mscp->thread);
+  msc_wakeup_i(mscp);
+  chSchRescheduleS();
+  chSysUnlock();
+
+  chThdWait(mscp->thread);
+  mscp->thread = NULL;
+}
+
+/**
+ * @brief   USB device configured handler.
+ * @details The transport restarts waiting for a CBW, the application must
+ *          invoke this function from the @p USB_EVENT_CONFIGURED event
+ *          after enabling the endpoints.
+ *
+ * @param[in] mscp      pointer to a @p USBMassStorageDriver object
+ *
+ * @iclass
+ */
+void mscConfigureHookI(USBMassStorageDriver *mscp) {
+
+  chDbgCheckClassI();
+
+  mscp->reset = TRUE;
+  msc_wakeup_i(mscp);
+}
+
 /**
  * @brief   Default requests hook.
  * @details The application must use this function as callback for the
@@ -176,6 +636,8 @@ static bool_t msc_decode(USBDriver *usbp) {
  *          - MSC_GET_MAX_LUN_COMMAND.
  *          - MSC_MASS_STORAGE_RESET_COMMAND.
  *          .
+ * @note    The reset is applied to the driver owning the first endpoint
+ *          using @p mscDataReceived() as callback.
  *
  * @param[in] usbp      pointer to the @p USBDriver object
  * @return              The hook status.
@@ -183,6 +645,8 @@ static bool_t msc_decode(USBDriver *usbp) {
  * @retval FALSE        Message not handled.
  */
 bool_t mscRequestsHook(USBDriver *usbp) {
+  USBMassStorageDriver *mscp;
+  usbep_t ep;
 
   if ((usbp->setup[0] & (USB_RTYPE_TYPE_MASK | USB_RTYPE_RECIPIENT_MASK)) ==
        (USB_RTYPE_TYPE_CLASS | USB_RTYPE_RECIPIENT_INTERFACE)) {
@@ -191,7 +655,16 @@ bool_t mscRequestsHook(USBDriver *usbp) {
       usbSetupTransfer(usbp, (uint8_t *)zerobuf, 1, NULL);
       return TRUE;
     case MSC_MASS_STORAGE_RESET_COMMAND:
-      msc_reset(usbp);
+      for (ep = 1; ep <= USB_MAX_ENDPOINTS; ep++) {
+        if ((usbp->epc[ep] != NULL) &&
+            (usbp->epc[ep]->out_cb == mscDataReceived) &&
+            ((mscp = usbp->out_params[ep - 1]) != NULL)) {
+          chSysLockFromIsr();
+          mscConfigureHookI(mscp);
+          chSysUnlockFromIsr();
+          break;
+        }
+      }
       usbSetupTransfer(usbp, NULL, 0, NULL);
       return TRUE;
     default:
@@ -210,25 +683,14 @@ bool_t mscRequestsHook(USBDriver *usbp) {
  * @param[in] ep        endpoint number
  */
 void mscDataTransmitted(USBDriver *usbp, usbep_t ep) {
+  USBMassStorageDriver *mscp = usbp->in_params[ep - 1];
 
-  switch (msc_state) {
-  case MSC_DATA_IN:
-    CSW.dCSWSignature = MSC_CSW_SIGNATURE;
-    CSW.dCSWTag = CBW.dCBWTag;
-    chSysLockFromIsr();
-    usbStartTransmitI(usbp, ep, (uint8_t *)&CSW, sizeof CSW);
-    chSysUnlockFromIsr();
-    msc_state = MSC_SENDING_CSW;
-    break;
-  case MSC_SENDING_CSW:
-    chSysLockFromIsr();
-    usbStartReceiveI(usbp, MSC_DATA_OUT_EP, (uint8_t *)&CBW, sizeof CBW);
-    chSysUnlockFromIsr();
-    msc_state = MSC_IDLE;
-    break;
-  default:
-    ;
-  }
+  if (mscp == NULL)
+    return;
+
+  chSysLockFromIsr();
+  msc_wakeup_i(mscp);
+  chSysUnlockFromIsr();
 }
 
 /**
@@ -240,60 +702,14 @@ void mscDataTransmitted(USBDriver *usbp, usbep_t ep) {
  * @param[in] ep        endpoint number
  */
 void mscDataReceived(USBDriver *usbp, usbep_t ep) {
-  size_t n;
-
-  n = usbGetReceiveTransactionSizeI(usbp, ep);
-  switch (msc_state) {
-  case MSC_IDLE:
-    if ((n != sizeof(msccbw_t)) || (CBW.dCBWSignature != MSC_CBW_SIGNATURE))
-      goto stall_out; /* 6.6.1 */
-
-    /* Decoding SCSI command.*/
-    if (msc_decode(usbp)) {
-      if (CBW.dCBWDataTransferLength == 0) {
-        CSW.bCSWStatus = MSC_CSW_STATUS_FAILED;
-        CSW.dCSWDataResidue = 0;
-        msc_sendstatus(usbp);
-        return;
-      }
-      goto stall_both;
-    }
+  USBMassStorageDriver *mscp = usbp->out_params[ep - 1];
 
-    /* Commands with zero transfer length, 5.1.*/
-    if (CBW.dCBWDataTransferLength == 0) {
-      msc_sendstatus(usbp);
-      return;
-    }
+  if (mscp == NULL)
+    return;
 
-    /* Transfer direction.*/
-    if (CBW.bmCBWFlags & 0x80) {
-      /* IN, Device to Host.*/
-      msc_state = MSC_DATA_IN;
-    }
-    else {
-      /* OUT, Host to Device.*/
-      msc_state = MSC_DATA_OUT;
-    }
-    break;
-  case MSC_DATA_OUT:
-    break;
-  default:
-    ;
-  }
-  return;
-stall_out:
-  msc_state = MSC_ERROR;
-  chSysLockFromIsr();
-  usbStallReceiveI(usbp, ep);
-  chSysUnlockFromIsr();
-  return;
-stall_both:
-  msc_state = MSC_ERROR;
   chSysLockFromIsr();
-  usbStallTransmitI(usbp, ep);
-  usbStallReceiveI(usbp, ep);
+  msc_wakeup_i(mscp);
   chSysUnlockFromIsr();
-  return;
 }
 
 /** @} */
@@ -39,6 +39,13 @@
 #define MSC_CSW_STATUS_FAILED           1
 #define MSC_CSW_STATUS_PHASE_ERROR      2
 
+/**
+ * @name    Bulk-only transport wrappers sizes
+ * @{
+ */
+#define MSC_CBW_SIZE                    31
+#define MSC_CSW_SIZE                    13
+/** @} */
 
 #define SCSI_FORMAT_UNIT            0x04
 #define SCSI_INQUIRY                0x12
@@ -69,46 +76,98 @@
 
 #define SCSI_SEND_DIAGNOSTIC        0x1D
 #define SCSI_READ_FORMAT_CAPACITIES 0x23
+#define SCSI_SYNCHRONIZE_CACHE10    0x35
+
+/**
+ * @name    SCSI sense keys
+ * @{
+ */
+#define SCSI_SENSE_NO_SENSE         0x00
+#define SCSI_SENSE_NOT_READY        0x02
+#define SCSI_SENSE_MEDIUM_ERROR     0x03
+#define SCSI_SENSE_ILLEGAL_REQUEST  0x05
+#define SCSI_SENSE_DATA_PROTECT     0x07
+/** @} */
+
+/**
+ * @name    SCSI additional sense codes
+ * @{
+ */
+#define SCSI_ASC_NONE               0x00
+#define SCSI_ASC_WRITE_ERROR        0x0C
+#define SCSI_ASC_READ_ERROR         0x11
+#define SCSI_ASC_INVALID_COMMAND    0x20
+#define SCSI_ASC_LBA_OUT_OF_RANGE   0x21
+#define SCSI_ASC_INVALID_FIELD      0x24
+#define SCSI_ASC_WRITE_PROTECTED    0x27
+#define SCSI_ASC_MEDIUM_NOT_PRESENT 0x3A
+/** @} */
 
 /*===========================================================================*/
 /* Driver pre-compile time settings.                                         */
 /*===========================================================================*/
 
 /**
- * @brief   Endpoint number for bulk IN.
+ * @name    USB_MSC configuration options
+ * @{
+ */
+/**
+ * @brief   Size of each of the two data buffers.
+ * @details READ(10) and WRITE(10) commands are moved in chunks of this size,
+ *          the block device fills or drains one buffer while the other one
+ *          is transferred over USB.
+ * @note    Must be a multiple of both the block size of the device and the
+ *          bulk endpoints maximum packet size.
+ */
+#if !defined(MSC_BUFFER_SIZE) || defined(__DOXYGEN__)
+#define MSC_BUFFER_SIZE             4096
+#endif
+
+/**
+ * @brief   Stack size of the driver thread.
+ * @note    The block device operations are invoked from this thread.
  */
-#if !defined(MSC_DATA_IN_EP) || defined(__DOXYGEN__)
-#define MSC_DATA_IN_EP          1
+#if !defined(MSC_THREAD_STACK_SIZE) || defined(__DOXYGEN__)
+#define MSC_THREAD_STACK_SIZE       256
 #endif
 
 /**
- * @brief   Endpoint number for bulk OUT.
+ * @brief   Priority of the driver thread.
  */
-#if !defined(MSC_DATA_OUT_EP) || defined(__DOXYGEN__)
-#define MSC_DATA_OUT_EP         2
+#if !defined(MSC_THREAD_PRIORITY) || defined(__DOXYGEN__)
+#define MSC_THREAD_PRIORITY         NORMALPRIO
 #endif
+/** @} */
 
 /*===========================================================================*/
 /* Derived constants and error checks.                                       */
 /*===========================================================================*/
 
+#if !HAL_USE_USB || !CH_USE_WAITEXIT
+#error "USB Mass Storage requires HAL_USE_USB and CH_USE_WAITEXIT"
+#endif
+
+#if (MSC_BUFFER_SIZE < 512) || ((MSC_BUFFER_SIZE % 64) != 0)
+#error "invalid MSC_BUFFER_SIZE value"
+#endif
+
 /*===========================================================================*/
 /* Driver data structures and types.                                         */
 /*===========================================================================*/
 
 /**
- * @brief   Type of the MSC possible states.
+ * @brief   Driver state machine possible states.
  */
 typedef enum {
-  MSC_IDLE = 0,
-  MSC_DATA_OUT,
-  MSC_DATA_IN,
-  MSC_SENDING_CSW,
-  MSC_ERROR
+  MSC_UNINIT = 0,                   /**< Not initialized.                   */
+  MSC_STOP = 1,                     /**< Stopped.                           */
+  MSC_READY = 2                     /**< Ready.                             */
 } mscstate_t;
 
 /**
  * @brief   CBW structure.
+ * @note    The fields are naturally aligned, only the trailing padding
+ *          differs from the wire format, see @p MSC_CBW_SIZE.
  */
 struct CBW {
   uint32_t          dCBWSignature;
@@ -122,6 +181,8 @@ struct CBW {
 
 /**
  * @brief   CSW structure.
+ * @note    The fields are naturally aligned, only the trailing padding
+ *          differs from the wire format, see @p MSC_CSW_SIZE.
  */
 struct CSW {
   uint32_t          dCSWSignature;
@@ -140,6 +201,94 @@ typedef struct CBW msccbw_t;
  */
 typedef struct CSW msccsw_t;
 
+/**
+ * @brief   USB Mass Storage Driver configuration structure.
+ * @details An instance of this structure must be passed to @p mscStart()
+ *          in order to configure and start the driver operations.
+ */
+typedef struct {
+  /**
+   * @brief   USB driver to use.
+   */
+  USBDriver                 *usbp;
+  /**
+   * @brief   Bulk IN endpoint used for outgoing data transfer.
+   */
+  usbep_t                   bulk_in;
+  /**
+   * @brief   Bulk OUT endpoint used for incoming data transfer.
+   */
+  usbep_t                   bulk_out;
+  /**
+   * @brief   Block device exposed as the only logical unit.
+   */
+  BaseBlockDevice           *blkp;
+} USBMassStorageConfig;
+
+/**
+ * @brief   Structure representing an USB Mass Storage driver.
+ * @details The bulk-only transport is served by a dedicated thread, the
+ *          endpoints callbacks just wake it up.
+ */
+typedef struct {
+  /**
+   * @brief   Driver state.
+   */
+  mscstate_t                state;
+  /**
+   * @brief   Current configuration data.
+   */
+  const USBMassStorageConfig *config;
+  /**
+   * @brief   Driver thread.
+   */
+  Thread                    *thread;
+  /**
+   * @brief   Driver thread waiting for an endpoint, if any.
+   */
+  Thread                    *wait;
+  /**
+   * @brief   Restart from the CBW stage requested.
+   */
+  bool_t                    reset;
+  /**
+   * @brief   Current CBW.
+   */
+  msccbw_t                  cbw;
+  /**
+   * @brief   CSW of the current command.
+   */
+  msccsw_t                  csw;
+  /**
+   * @brief   Sense key, additional sense code and qualifier.
+   */
+  uint8_t                   sense[3];
+  /**
+   * @brief   Block size of the device.
+   */
+  uint32_t                  blk_size;
+  /**
+   * @brief   Number of blocks of the device.
+   */
+  uint32_t                  blk_num;
+  /**
+   * @brief   Blocks read from the device.
+   */
+  uint32_t                  blocks_read;
+  /**
+   * @brief   Blocks written to the device.
+   */
+  uint32_t                  blocks_written;
+  /**
+   * @brief   Data buffers, word aligned.
+   */
+  uint32_t                  buf[2][MSC_BUFFER_SIZE / sizeof (uint32_t)];
+  /**
+   * @brief   Driver thread working area.
+   */
+  WORKING_AREA(wa, MSC_THREAD_STACK_SIZE);
+} USBMassStorageDriver;
+
 /*===========================================================================*/
 /* Driver macros.                                                            */
 /*===========================================================================*/
@@ -151,6 +300,11 @@ typedef struct CSW msccsw_t;
 #ifdef __cplusplus
 extern "C" {
 #endif
+  void mscObjectInit(USBMassStorageDriver *mscp);
+  void mscStart(USBMassStorageDriver *mscp,
+                const USBMassStorageConfig *config);
+  void mscStop(USBMassStorageDriver *mscp);
+  void mscConfigureHookI(USBMassStorageDriver *mscp);
   bool_t mscRequestsHook(USBDriver *usbp);
   void mscDataTransmitted(USBDriver *usbp, usbep_t ep);
   void mscDataReceived(USBDriver *usbp, usbep_t ep);
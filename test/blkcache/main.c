@@ -0,0 +1,256 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "console.h"
+#include "chprintf.h"
+#include "ramdisk.h"
+#include "blkcache.h"
+
+/*
+ * Random reads, writes and syncs are performed through the cache over a
+ * RAM disk, every read is checked against a reference model of the disk
+ * contents and the disk itself is checked against the model after each
+ * sync.
+ */
+#define ITERATIONS      200000
+#define DISK_BLOCKS     64
+#define CACHE_BLOCKS    16
+#define WINDOW_BLOCKS   8
+
+static BaseSequentialStream *chp = (BaseSequentialStream *)&CD1;
+
+static uint8_t disk[DISK_BLOCKS * BLKCACHE_BLOCK_SIZE];
+static uint8_t model[DISK_BLOCKS * BLKCACHE_BLOCK_SIZE];
+static uint8_t buf[DISK_BLOCKS * BLKCACHE_BLOCK_SIZE];
+
+static RamDisk rd;
+static BlockCache bc;
+static BlockCacheEntry entries[CACHE_BLOCKS];
+static uint8_t cache_buffer[CACHE_BLOCKS * BLKCACHE_BLOCK_SIZE];
+static uint8_t window_buffer[WINDOW_BLOCKS * BLKCACHE_BLOCK_SIZE];
+
+/*
+ * Tested configurations, cache size, window size and pinned range.
+ */
+static const struct {
+  uint32_t      n;
+  uint32_t      window_n;
+  bool_t        pin;
+} configs[] = {
+  {1,  2, FALSE},
+  {4,  5, TRUE},
+  {16, 8, FALSE},
+  {1,  0, TRUE},
+  {4,  0, FALSE},
+  {16, 0, TRUE}
+};
+
+#define NUM_CONFIGS (sizeof(configs) / sizeof(configs[0]))
+
+/*
+ * Deterministic generator, the sequence is the same on every host.
+ */
+static uint32_t seed;
+
+static uint32_t rnd(uint32_t n) {
+
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 8) % n;
+}
+
+static void randomize(uint8_t *p, size_t n) {
+
+  while (n-- > 0)
+    *p++ = (uint8_t)rnd(256);
+}
+
+static void disk_start(BlockCacheConfig *cfgp, unsigned i) {
+
+  cfgp->blkp     = (BaseBlockDevice *)&rd;
+  cfgp->entries  = entries;
+  cfgp->buffer   = cache_buffer;
+  cfgp->n        = configs[i].n;
+  cfgp->window   = configs[i].window_n > 0 ? window_buffer : NULL;
+  cfgp->window_n = configs[i].window_n;
+
+  randomize(disk, sizeof(disk));
+  memcpy(model, disk, sizeof(disk));
+  ramdiskObjectInit(&rd);
+  ramdiskStart(&rd, disk, BLKCACHE_BLOCK_SIZE, DISK_BLOCKS, FALSE);
+}
+
+/*
+ * Random operations against the model.
+ */
+static bool_t model_check(unsigned i) {
+  BlockCacheConfig cfg;
+  BlockCacheStats *stp;
+  unsigned iter;
+
+  disk_start(&cfg, i);
+  blkConnect(&rd);
+  bcacheObjectInit(&bc);
+  if (bcacheStart(&bc, &cfg)) {
+    chprintf(chp, "  start failed\r\n");
+    return CH_FAILED;
+  }
+  if (configs[i].pin)
+    bcachePin(&bc, 2, 6);
+
+  for (iter = 0; iter < ITERATIONS; iter++) {
+    unsigned op = rnd(10);
+    uint32_t startblk = rnd(DISK_BLOCKS);
+    uint32_t n;
+
+    /* Mostly short transfers, sometimes up to the disk end.*/
+    if (rnd(4) == 0)
+      n = 1 + rnd(DISK_BLOCKS - startblk);
+    else
+      n = 1 + rnd(DISK_BLOCKS - startblk < 3 ? DISK_BLOCKS - startblk : 3);
+    /* Sequential accesses in order to trigger the read-ahead.*/
+    if ((rnd(3) == 0) && (bc.next_read < DISK_BLOCKS)) {
+      startblk = bc.next_read;
+      if (startblk + n > DISK_BLOCKS)
+        n = DISK_BLOCKS - startblk;
+    }
+
+    if (op < 5) {
+      if (blkRead(&bc, startblk, buf, n)) {
+        chprintf(chp, "  read failed, iteration %d\r\n", iter);
+        return CH_FAILED;
+      }
+      if (memcmp(buf, model + startblk * BLKCACHE_BLOCK_SIZE,
+                 n * BLKCACHE_BLOCK_SIZE) != 0) {
+        chprintf(chp, "  read mismatch, iteration %d, blocks %d-%d\r\n",
+                 iter, startblk, startblk + n - 1);
+        return CH_FAILED;
+      }
+    }
+    else if (op < 9) {
+      randomize(buf, n * BLKCACHE_BLOCK_SIZE);
+      memcpy(model + startblk * BLKCACHE_BLOCK_SIZE, buf,
+             n * BLKCACHE_BLOCK_SIZE);
+      if (blkWrite(&bc, startblk, buf, n)) {
+        chprintf(chp, "  write failed, iteration %d\r\n", iter);
+        return CH_FAILED;
+      }
+    }
+    else {
+      if (blkSync(&bc)) {
+        chprintf(chp, "  sync failed, iteration %d\r\n", iter);
+        return CH_FAILED;
+      }
+      if (memcmp(disk, model, sizeof(disk)) != 0) {
+        chprintf(chp, "  disk mismatch after sync, iteration %d\r\n", iter);
+        return CH_FAILED;
+      }
+    }
+  }
+
+  if (bcacheStop(&bc) || (memcmp(disk, model, sizeof(disk)) != 0)) {
+    chprintf(chp, "  disk mismatch after stop\r\n");
+    return CH_FAILED;
+  }
+
+  stp = bcacheGetStats(&bc);
+  chprintf(chp, "  hits %d, read-ahead hits %d, misses %d, reads %d\r\n",
+           stp->bs_hits, stp->bs_ra_hits, stp->bs_misses, stp->bs_reads);
+  chprintf(chp, "  writes %d, written %d, coalesced %d, evictions %d\r\n",
+           stp->bs_writes, stp->bs_written, stp->bs_coalesced,
+           stp->bs_evictions);
+  return CH_SUCCESS;
+}
+
+/*
+ * The cache is started before the device is connected, the read-ahead
+ * must not cross the device end once the device is ready.
+ */
+static bool_t late_connect_check(void) {
+  BlockCacheConfig cfg;
+  uint32_t startblk;
+
+  disk_start(&cfg, 2);
+  bcacheObjectInit(&bc);
+  if (bcacheStart(&bc, &cfg)) {
+    chprintf(chp, "  start failed\r\n");
+    return CH_FAILED;
+  }
+  blkConnect(&rd);
+
+  for (startblk = DISK_BLOCKS - 3; startblk < DISK_BLOCKS; startblk++) {
+    if (blkRead(&bc, startblk, buf, 1) ||
+        (memcmp(buf, model + startblk * BLKCACHE_BLOCK_SIZE,
+                BLKCACHE_BLOCK_SIZE) != 0)) {
+      chprintf(chp, "  sequential read failed, block %d\r\n", startblk);
+      return CH_FAILED;
+    }
+  }
+  if (bcacheGetStats(&bc)->bs_ra_hits == 0) {
+    chprintf(chp, "  no read-ahead\r\n");
+    return CH_FAILED;
+  }
+  bcacheStop(&bc);
+  return CH_SUCCESS;
+}
+
+/*
+ * Simulator main.
+ */
+int main(int argc, char *argv[]) {
+  unsigned i, failures = 0;
+
+  (void)argc;
+  (void)argv;
+
+  /*
+   * System initializations.
+   * - HAL initialization, this also initializes the configured device drivers
+   *   and performs the board-specific initializations.
+   * - Kernel initialization, the main() function becomes a thread and the
+   *   RTOS is active.
+   */
+  halInit();
+  conInit();
+  chSysInit();
+
+  chprintf(chp, "*** Block cache against a reference model\r\n");
+  chprintf(chp, "*** Disk blocks: %d\r\n", DISK_BLOCKS);
+  chprintf(chp, "*** Iterations:  %d\r\n", ITERATIONS);
+  chprintf(chp, "\r\n");
+
+  for (i = 0; i < NUM_CONFIGS; i++) {
+    seed = i + 1;
+    chprintf(chp, "--- %d entries, %d window blocks%s\r\n",
+             configs[i].n, configs[i].window_n,
+             configs[i].pin ? ", pinned range" : "");
+    if (model_check(i))
+      failures++;
+  }
+
+  seed = 100;
+  chprintf(chp, "--- Read-ahead with the device connected after start\r\n");
+  if (late_connect_check())
+    failures++;
+
+  chprintf(chp, "\r\nFinal result: %s\r\n",
+           failures == 0 ? "SUCCESS" : "FAILURE");
+  exit(failures == 0 ? 0 : 1);
+}
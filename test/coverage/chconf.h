@@ -44,6 +44,24 @@
 #define CH_FREQUENCY                    1000
 #endif
 
+/**
+ * @brief   Time delta constant for the tick-less mode.
+ * @note    If this value is zero then the system uses the classic
+ *          periodic tick. A value greater than zero enables the tick-less
+ *          mode, the port must then provide a free running system timer
+ *          and an alarm, @p CH_FREQUENCY becomes the frequency of the free
+ *          running counter and this value is the minimum number of ticks
+ *          between the current time and an alarm, alarms programmed
+ *          closer than this are delayed.
+ * @note    In tick-less mode @p CH_TIME_QUANTUM must be zero and
+ *          @p CH_DBG_THREADS_PROFILING must be disabled.
+ * @note    High values of @p CH_FREQUENCY can overflow the intermediate
+ *          results of the @p MS2ST() and @p US2ST() macros.
+ */
+#if !defined(CH_TIMEDELTA) || defined(__DOXYGEN__)
+#define CH_TIMEDELTA                    0
+#endif
+
 /**
  * @brief   Round robin interval.
  * @details This constant is the number of system ticks allowed for the
@@ -112,6 +130,45 @@
 #define CH_OPTIMIZE_SPEED               FALSE
 #endif
 
+/**
+ * @brief   Bitmap based ready list.
+ * @details If enabled then the ready list keeps a bitmap of the non-empty
+ *          priority levels and a pointer to the first thread of each level,
+ *          threads are inserted in the ready list in constant time instead
+ *          of scanning the list.
+ *
+ * @note    The default is @p FALSE.
+ * @note    This option increases the size of the ready list structure by
+ *          about one kilobyte.
+ */
+#if !defined(CH_USE_READYLIST_BITMAP) || defined(__DOXYGEN__)
+#define CH_USE_READYLIST_BITMAP         FALSE
+#endif
+
+/**
+ * @brief   Hashed timer wheel for the virtual timers.
+ * @details If enabled then the virtual timers are hashed on their expiration
+ *          time into an array of unordered lists instead of being kept in a
+ *          delta list, arming and disarming a timer become constant time
+ *          operations regardless of the number of armed timers.
+ *
+ * @note    The default is @p FALSE.
+ * @note    Each tick scans the timers of a single slot, the slots number
+ *          should be comparable with the typical number of armed timers.
+ * @note    Not compatible with the tick-less mode.
+ */
+#if !defined(CH_USE_TIMER_WHEEL) || defined(__DOXYGEN__)
+#define CH_USE_TIMER_WHEEL              FALSE
+#endif
+
+/**
+ * @brief   Number of slots of the timer wheel.
+ * @note    Must be a power of two.
+ */
+#if !defined(CH_TIMER_WHEEL_SLOTS) || defined(__DOXYGEN__)
+#define CH_TIMER_WHEEL_SLOTS            64
+#endif
+
 /** @} */
 
 /*===========================================================================*/
@@ -255,6 +312,18 @@
 #define CH_USE_MESSAGES_PRIORITY        FALSE
 #endif
 
+/**
+ * @brief   Asynchronous messages APIs.
+ * @details If enabled then messages can be sent without waiting for the
+ *          answer using @p chMsgSendAsync().
+ *
+ * @note    The default is @p FALSE.
+ * @note    Requires @p CH_USE_MESSAGES.
+ */
+#if !defined(CH_USE_MESSAGES_ASYNC) || defined(__DOXYGEN__)
+#define CH_USE_MESSAGES_ASYNC           TRUE
+#endif
+
 /**
  * @brief   Mailboxes APIs.
  * @details If enabled then the asynchronous messages (mailboxes) APIs are
@@ -267,6 +336,19 @@
 #define CH_USE_MAILBOXES                TRUE
 #endif
 
+/**
+ * @brief   Publish/subscribe topics APIs.
+ * @details If enabled then the zero-copy publish/subscribe topics APIs are
+ *          included in the kernel.
+ *
+ * @note    The default is @p FALSE.
+ * @note    Requires @p CH_USE_MEMPOOLS, @p CH_USE_MAILBOXES and
+ *          @p CH_USE_EVENTS.
+ */
+#if !defined(CH_USE_TOPICS) || defined(__DOXYGEN__)
+#define CH_USE_TOPICS                   TRUE
+#endif
+
 /**
  * @brief   I/O Queues APIs.
  * @details If enabled then the I/O queues APIs are included in the kernel.
@@ -277,6 +359,21 @@
 #define CH_USE_QUEUES                   TRUE
 #endif
 
+/**
+ * @brief   I/O Queues transfer chunk size.
+ * @details Maximum number of bytes copied by @p chIQReadTimeout() and
+ *          @p chOQWriteTimeout() within a single critical zone. The
+ *          kernel lock is released between chunks in order to give a
+ *          preemption chance, larger values improve the throughput at
+ *          the cost of a longer critical zone.
+ *
+ * @note    The default is 32 bytes.
+ * @note    Requires @p CH_USE_QUEUES.
+ */
+#if !defined(CH_QUEUES_CHUNK_SIZE) || defined(__DOXYGEN__)
+#define CH_QUEUES_CHUNK_SIZE            32
+#endif
+
 /**
  * @brief   Core Memory Manager APIs.
  * @details If enabled then the core memory manager APIs are included
@@ -316,6 +413,33 @@
 #define CH_USE_MALLOC_HEAP              FALSE
 #endif
 
+/**
+ * @brief   TLSF heap allocator.
+ * @details If enabled the heap allocator uses a Two-Level Segregated Fit
+ *          strategy instead of the first-fit free list, allocation and
+ *          release are performed in bounded constant time regardless of
+ *          the heap fragmentation.
+ *
+ * @note    The default is @p FALSE.
+ * @note    Requires @p CH_USE_HEAP, not used if @p CH_USE_MALLOC_HEAP is
+ *          enabled.
+ * @note    The block headers are larger and each heap descriptor contains
+ *          the segregated lists heads, about 600 bytes on 32 bits
+ *          architectures.
+ */
+#if !defined(CH_USE_HEAP_TLSF) || defined(__DOXYGEN__)
+#define CH_USE_HEAP_TLSF                FALSE
+#endif
+
+/**
+ * @brief   Log2 of the largest TLSF size class.
+ * @note    Lowered so that the test buffer can contain a block of the last
+ *          size class, see the heap test sequence.
+ */
+#if !defined(HEAP_TLSF_MAX_LOG2) || defined(__DOXYGEN__)
+#define HEAP_TLSF_MAX_LOG2              16
+#endif
+
 /**
  * @brief   Memory Pools Allocator APIs.
  * @details If enabled then the memory pools allocator APIs are included
@@ -327,6 +451,19 @@
 #define CH_USE_MEMPOOLS                 TRUE
 #endif
 
+/**
+ * @brief   Slab Allocator APIs.
+ * @details If enabled then the slab allocator APIs are included in the
+ *          kernel. The slab allocator serves variable size requests from a
+ *          set of memory pools, one for each size class.
+ *
+ * @note    The default is @p FALSE.
+ * @note    Requires @p CH_USE_MEMPOOLS.
+ */
+#if !defined(CH_USE_SLABS) || defined(__DOXYGEN__)
+#define CH_USE_SLABS                    TRUE
+#endif
+
 /**
  * @brief   Dynamic Threads APIs.
  * @details If enabled then the dynamic threads creation APIs are included
@@ -394,6 +531,19 @@
 #define CH_DBG_ENABLE_TRACE             TRUE
 #endif
 
+/**
+ * @brief   Debug option, kernel events tracer.
+ * @details If enabled then context switches, ISRs, kernel locks,
+ *          semaphores, mutexes, events and user markers are recorded with
+ *          a cycle resolution timestamp into a ring buffer that can be
+ *          streamed off chip.
+ *
+ * @note    The default is @p FALSE.
+ */
+#if !defined(CH_DBG_TRACE_EVENTS) || defined(__DOXYGEN__)
+#define CH_DBG_TRACE_EVENTS             TRUE
+#endif
+
 /**
  * @brief   Debug option, stack checks.
  * @details If enabled then a runtime stack check is performed.
@@ -433,6 +583,22 @@
 #define CH_DBG_THREADS_PROFILING        TRUE
 #endif
 
+/**
+ * @brief   Debug option, threads statistics.
+ * @details If enabled then the realtime counter is sampled at each context
+ *          switch and a @p ThreadStats structure is added to the
+ *          @p Thread structure, it accumulates the thread run time,
+ *          the number of switches, the worst ready to run latency and the
+ *          stack size. The statistics are read using
+ *          @p chRegGetThreadStats().
+ * @note    The stack high-water mark requires @p CH_DBG_FILL_THREADS.
+ *
+ * @note    The default is @p FALSE.
+ */
+#if !defined(CH_DBG_THREADS_STATISTICS) || defined(__DOXYGEN__)
+#define CH_DBG_THREADS_STATISTICS       TRUE
+#endif
+
 /** @} */
 
 /*===========================================================================*/
@@ -0,0 +1,137 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    dma2d_model.c
+ * @brief   DMA2D registers model code.
+ * @details The model does not move pixels, it records the registers of
+ *          each started operation, accounts the bytes the peripheral would
+ *          read and write, then raises the completion or the error flag
+ *          and invokes the driver interrupt handler.
+ */
+
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "stm32_dma2d.h"
+
+DMA2D_TypeDef dma2d_regs;
+dma2d_model_t dma2d_model;
+
+CH_IRQ_HANDLER(DMA2D_IRQHandler);
+
+/*
+ * Bits per pixel of the DMA2D formats.
+ */
+static const uint8_t fmt_bits[] = {32, 24, 16, 16, 16, 8, 8, 16, 4, 8, 4};
+
+static uint32_t area_bytes(uint32_t nlr, uint32_t cm) {
+  uint32_t width = (nlr & DMA2D_NLR_PL) >> 16;
+  uint32_t height = nlr & DMA2D_NLR_NL;
+
+  return ((width * fmt_bits[cm] + 7) / 8) * height;
+}
+
+static int is_faulty(uint32_t addr) {
+
+  return (dma2d_model.fault_addr != 0) && (addr == dma2d_model.fault_addr);
+}
+
+static uint32_t clut_bytes(uint32_t pfccr) {
+
+  return (((pfccr & DMA2D_FGPFCCR_CS) >> 8) + 1) *
+         ((pfccr & DMA2D_FGPFCCR_CCM) ? 3 : 4);
+}
+
+/**
+ * @brief   Clears the operations log and the counters.
+ */
+void dma2dModelReset(void) {
+
+  memset(dma2d_model.log, 0, sizeof dma2d_model.log);
+  dma2d_model.ops = 0;
+  dma2d_model.bytes = 0;
+}
+
+/**
+ * @brief   Executes the pending operation, if any.
+ * @details The CLUT loads are executed before the transfer, as the driver
+ *          never starts both. The interrupt handler is invoked and the
+ *          preemption is checked on exit, as for the simulator interrupt
+ *          sources.
+ *
+ * @return              Operation executed.
+ * @retval FALSE        nothing to do.
+ */
+int dma2dModelStep(void) {
+  dma2d_record_t r;
+  uint32_t flag;
+
+  memset(&r, 0, sizeof r);
+  if (dma2d_regs.BGPFCCR & DMA2D_BGPFCCR_START) {
+    dma2d_regs.BGPFCCR &= ~DMA2D_BGPFCCR_START;
+    r.op = DMA2D_OP_BGCLUT;
+    r.cmar = dma2d_regs.BGCMAR;
+    r.bytes = clut_bytes(dma2d_regs.BGPFCCR);
+    flag = is_faulty(r.cmar) ? DMA2D_ISR_CAEIF : DMA2D_ISR_CTCIF;
+  }
+  else if (dma2d_regs.FGPFCCR & DMA2D_FGPFCCR_START) {
+    dma2d_regs.FGPFCCR &= ~DMA2D_FGPFCCR_START;
+    r.op = DMA2D_OP_FGCLUT;
+    r.cmar = dma2d_regs.FGCMAR;
+    r.bytes = clut_bytes(dma2d_regs.FGPFCCR);
+    flag = is_faulty(r.cmar) ? DMA2D_ISR_CAEIF : DMA2D_ISR_CTCIF;
+  }
+  else if (dma2d_regs.CR & DMA2D_CR_START) {
+    dma2d_regs.CR &= ~DMA2D_CR_START;
+    r.op = DMA2D_OP_TRANSFER;
+    r.mode = dma2d_regs.CR & DMA2D_CR_MODE;
+    r.nlr = dma2d_regs.NLR;
+    r.omar = dma2d_regs.OMAR;
+    r.bytes = area_bytes(r.nlr, dma2d_regs.OPFCCR & DMA2D_OPFCCR_CM);
+    flag = DMA2D_ISR_TCIF;
+    if (r.mode != DMA2D_JOB_CONST) {
+      r.fgmar = dma2d_regs.FGMAR;
+      r.bytes += area_bytes(r.nlr, dma2d_regs.FGPFCCR & DMA2D_FGPFCCR_CM);
+      if (is_faulty(r.fgmar))
+        flag = DMA2D_ISR_TEIF;
+    }
+    if (r.mode == DMA2D_JOB_BLEND) {
+      r.bgmar = dma2d_regs.BGMAR;
+      r.bytes += area_bytes(r.nlr, dma2d_regs.BGPFCCR & DMA2D_BGPFCCR_CM);
+      if (is_faulty(r.bgmar))
+        flag = DMA2D_ISR_TEIF;
+    }
+    if (is_faulty(r.omar))
+      flag = DMA2D_ISR_TEIF;
+  }
+  else
+    return FALSE;
+
+  if (dma2d_model.ops < DMA2D_MODEL_LOG_SIZE)
+    dma2d_model.log[dma2d_model.ops] = r;
+  dma2d_model.ops++;
+  dma2d_model.bytes += r.bytes;
+
+  /* Raising the flag, the handler clears it through IFCR.*/
+  dma2d_regs.ISR |= flag;
+  DMA2D_IRQHandler();
+  dma2d_regs.ISR &= ~dma2d_regs.IFCR;
+  dma2d_regs.IFCR = 0;
+  _sim_check_preemption();
+  return TRUE;
+}
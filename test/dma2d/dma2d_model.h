@@ -0,0 +1,207 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    dma2d_model.h
+ * @brief   DMA2D registers model header.
+ * @details Replaces the STM32F4xx device header for the DMA2D driver, the
+ *          registers are a plain structure and the operations started by
+ *          the driver are executed by @p dma2dModelStep(). The file is
+ *          included ahead of every source through the compiler command line.
+ */
+
+#ifndef _DMA2D_MODEL_H_
+#define _DMA2D_MODEL_H_
+
+#include <stdint.h>
+
+/*===========================================================================*/
+/* Device definitions.                                                       */
+/*===========================================================================*/
+
+#define STM32F429_439xx
+
+#define __IO volatile
+
+/**
+ * @brief   DMA2D registers block.
+ * @note    The address registers are 32 bits wide, on a 64 bits host they
+ *          only hold the lower part of the addresses.
+ */
+typedef struct {
+  __IO uint32_t CR;
+  __IO uint32_t ISR;
+  __IO uint32_t IFCR;
+  __IO uint32_t FGMAR;
+  __IO uint32_t FGOR;
+  __IO uint32_t BGMAR;
+  __IO uint32_t BGOR;
+  __IO uint32_t FGPFCCR;
+  __IO uint32_t FGCOLR;
+  __IO uint32_t BGPFCCR;
+  __IO uint32_t BGCOLR;
+  __IO uint32_t FGCMAR;
+  __IO uint32_t BGCMAR;
+  __IO uint32_t OPFCCR;
+  __IO uint32_t OCOLR;
+  __IO uint32_t OMAR;
+  __IO uint32_t OOR;
+  __IO uint32_t NLR;
+  __IO uint32_t LWR;
+  __IO uint32_t AMTCR;
+  uint32_t      RESERVED[236];
+  __IO uint32_t FGCLUT[256];
+  __IO uint32_t BGCLUT[256];
+} DMA2D_TypeDef;
+
+#define DMA2D                   (&dma2d_regs)
+#define DMA2D_IRQn              90
+
+#define DMA2D_CR_START          ((uint32_t)0x00000001)
+#define DMA2D_CR_SUSP           ((uint32_t)0x00000002)
+#define DMA2D_CR_ABORT          ((uint32_t)0x00000004)
+#define DMA2D_CR_TEIE           ((uint32_t)0x00000100)
+#define DMA2D_CR_TCIE           ((uint32_t)0x00000200)
+#define DMA2D_CR_TWIE           ((uint32_t)0x00000400)
+#define DMA2D_CR_CAEIE          ((uint32_t)0x00000800)
+#define DMA2D_CR_CTCIE          ((uint32_t)0x00001000)
+#define DMA2D_CR_CEIE           ((uint32_t)0x00002000)
+#define DMA2D_CR_MODE           ((uint32_t)0x00030000)
+
+#define DMA2D_ISR_TEIF          ((uint32_t)0x00000001)
+#define DMA2D_ISR_TCIF          ((uint32_t)0x00000002)
+#define DMA2D_ISR_TWIF          ((uint32_t)0x00000004)
+#define DMA2D_ISR_CAEIF         ((uint32_t)0x00000008)
+#define DMA2D_ISR_CTCIF         ((uint32_t)0x00000010)
+#define DMA2D_ISR_CEIF          ((uint32_t)0x00000020)
+
+#define DMA2D_IFSR_CTEIF        ((uint32_t)0x00000001)
+#define DMA2D_IFSR_CTCIF        ((uint32_t)0x00000002)
+#define DMA2D_IFSR_CTWIF        ((uint32_t)0x00000004)
+#define DMA2D_IFSR_CCAEIF       ((uint32_t)0x00000008)
+#define DMA2D_IFSR_CCTCIF       ((uint32_t)0x00000010)
+#define DMA2D_IFSR_CCEIF        ((uint32_t)0x00000020)
+
+#define DMA2D_FGOR_LO           ((uint32_t)0x00003FFF)
+#define DMA2D_BGOR_LO           ((uint32_t)0x00003FFF)
+#define DMA2D_OOR_LO            ((uint32_t)0x00003FFF)
+
+#define DMA2D_FGPFCCR_CM        ((uint32_t)0x0000000F)
+#define DMA2D_FGPFCCR_CCM       ((uint32_t)0x00000010)
+#define DMA2D_FGPFCCR_START     ((uint32_t)0x00000020)
+#define DMA2D_FGPFCCR_CS        ((uint32_t)0x0000FF00)
+#define DMA2D_FGPFCCR_AM        ((uint32_t)0x00030000)
+#define DMA2D_FGPFCCR_ALPHA     ((uint32_t)0xFF000000)
+
+#define DMA2D_BGPFCCR_CM        ((uint32_t)0x0000000F)
+#define DMA2D_BGPFCCR_CCM       ((uint32_t)0x00000010)
+#define DMA2D_BGPFCCR_START     ((uint32_t)0x00000020)
+#define DMA2D_BGPFCCR_CS        ((uint32_t)0x0000FF00)
+#define DMA2D_BGPFCCR_AM        ((uint32_t)0x00030000)
+#define DMA2D_BGPFCCR_ALPHA     ((uint32_t)0xFF000000)
+
+#define DMA2D_OPFCCR_CM         ((uint32_t)0x00000007)
+
+#define DMA2D_NLR_NL            ((uint32_t)0x0000FFFF)
+#define DMA2D_NLR_PL            ((uint32_t)0x3FFF0000)
+
+#define DMA2D_LWR_LW            ((uint32_t)0x0000FFFF)
+
+#define DMA2D_AMTCR_EN          ((uint32_t)0x00000001)
+#define DMA2D_AMTCR_DT          ((uint32_t)0x0000FF00)
+
+/*
+ * Clock and interrupt controller, nothing to do.
+ */
+#define rccResetDMA2D()
+#define rccEnableDMA2D(lp)
+#define rccDisableDMA2D(lp)
+#define nvicEnableVector(n, prio)
+#define nvicDisableVector(n)
+#define CORTEX_PRIORITY_MASK(prio)  (prio)
+
+/*===========================================================================*/
+/* Model data structures and types.                                          */
+/*===========================================================================*/
+
+/**
+ * @brief   Operations executed by the model.
+ */
+typedef enum {
+  DMA2D_OP_BGCLUT = 0,                  /**< Background CLUT load.*/
+  DMA2D_OP_FGCLUT = 1,                  /**< Foreground CLUT load.*/
+  DMA2D_OP_TRANSFER = 2                 /**< Transfer.*/
+} dma2d_op_t;
+
+/**
+ * @brief   Record of an executed operation.
+ * @details The registers are sampled when the operation is started.
+ */
+typedef struct {
+  dma2d_op_t            op;             /**< Operation.*/
+  uint32_t              mode;           /**< CR mode field.*/
+  uint32_t              nlr;            /**< Size.*/
+  uint32_t              omar;           /**< Output address.*/
+  uint32_t              fgmar;          /**< Foreground address.*/
+  uint32_t              bgmar;          /**< Background address.*/
+  uint32_t              cmar;           /**< CLUT address, CLUT loads only.*/
+  uint32_t              bytes;          /**< Bytes read and written.*/
+} dma2d_record_t;
+
+/**
+ * @brief   Size of the operations log.
+ */
+#define DMA2D_MODEL_LOG_SIZE    256
+
+/**
+ * @brief   Model state.
+ */
+typedef struct {
+  /**
+   * @brief   Operations log, it stops growing when full.
+   */
+  dma2d_record_t        log[DMA2D_MODEL_LOG_SIZE];
+  /**
+   * @brief   Number of executed operations.
+   */
+  unsigned              ops;
+  /**
+   * @brief   Bytes moved by all the executed operations.
+   */
+  uint32_t              bytes;
+  /**
+   * @brief   Address on which accesses fail, zero for none.
+   */
+  uint32_t              fault_addr;
+} dma2d_model_t;
+
+/*===========================================================================*/
+/* External declarations.                                                    */
+/*===========================================================================*/
+
+extern DMA2D_TypeDef dma2d_regs;
+extern dma2d_model_t dma2d_model;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void dma2dModelReset(void);
+  int dma2dModelStep(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DMA2D_MODEL_H_ */
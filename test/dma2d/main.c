@@ -0,0 +1,451 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "console.h"
+#include "chprintf.h"
+#include "stm32_dma2d.h"
+#include "compositor.h"
+
+/*
+ * The DMA2D driver runs over the registers model of dma2d_model.c, a lower
+ * priority thread plays the peripheral and executes the operations started
+ * by the driver. The jobs are submitted by the main thread, the model log
+ * is compared with the expected sequence of operations. The compositor then
+ * renders the scene of the ARMCM4 demo and its costs are measured.
+ */
+#define POOL_SIZE       8
+#define POOL_JOBS       50
+#define AREA_WIDTH      16
+#define AREA_HEIGHT     4
+#define AREA_PIXELS     (AREA_WIDTH * AREA_HEIGHT)
+
+#define addr(p)         ((uint32_t)(uintptr_t)(p))
+
+static BaseSequentialStream *chp = (BaseSequentialStream *)&CD1;
+
+static uint32_t src[AREA_PIXELS];
+static uint8_t lsrc[AREA_PIXELS];
+static uint32_t dst[POOL_JOBS][AREA_PIXELS];
+static uint32_t colors1[16], colors2[16], colors3[16];
+
+static const dma2d_palcfg_t pal1 = {colors1, 16, DMA2D_FMT_ARGB8888};
+static const dma2d_palcfg_t pal2 = {colors2, 16, DMA2D_FMT_ARGB8888};
+static const dma2d_palcfg_t pal3 = {colors3, 16, DMA2D_FMT_ARGB8888};
+
+/*
+ * Scene of the demo, a 32x32 blended indicator slides over a 200x320
+ * picture placed at (8, 0) on a 240x320 background, the screen is RGB-888
+ * with three frame buffers.
+ */
+#define SCREEN_WIDTH    240
+#define SCREEN_HEIGHT   320
+#define SPRITE_SIZE     32
+#define SPRITE_Y        284
+#define FRAMES          240
+
+static uint8_t view_buffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+static uint8_t splash_buffer[200 * SCREEN_HEIGHT];
+static uint32_t status_sprite[SPRITE_SIZE * SPRITE_SIZE];
+static uint32_t frame_buffers[3][SCREEN_WIDTH * SCREEN_HEIGHT * 3 / 4];
+static uint32_t colors256[256];
+
+static const dma2d_palcfg_t scene_pal = {colors256, 256, DMA2D_FMT_ARGB8888};
+
+static void *const comp_buffers[3] = {
+  frame_buffers[0],
+  frame_buffers[1],
+  frame_buffers[2]
+};
+
+static const CompConfig comp_cfg = {
+  &DMA2DD1,
+  SCREEN_WIDTH,
+  SCREEN_HEIGHT,
+  DMA2D_FMT_RGB888,
+  0x000000,
+  comp_buffers,
+  3
+};
+
+static CompLayer comp_layers[3];
+static Compositor comp;
+
+static dma2d_job_t jobs[POOL_SIZE];
+
+static const DMA2DConfig dma2d_cfg = {
+  NULL, NULL, NULL, NULL, NULL, NULL,
+  jobs,
+  POOL_SIZE
+};
+
+static unsigned done;
+static unsigned order_errors;
+static msg_t statuses[POOL_JOBS];
+
+static unsigned failures;
+
+#define check(c) {                                                          \
+  if (!(c)) {                                                               \
+    chprintf(chp, "  failed at line %d: %s\r\n", __LINE__, #c);             \
+    failures++;                                                             \
+  }                                                                         \
+}
+
+/*
+ * Expected operation, the address is the CLUT one for the CLUT loads and
+ * the output one for the transfers.
+ */
+typedef struct {
+  dma2d_op_t    op;
+  const void    *p;
+} expected_t;
+
+/*===========================================================================*/
+/* Peripheral thread.                                                        */
+/*===========================================================================*/
+
+static WORKING_AREA(waDevice, 2048);
+static msg_t device_thread(void *arg) {
+
+  (void)arg;
+  chRegSetThreadName("dma2d");
+  while (TRUE) {
+    if (!dma2dModelStep())
+      chThdSleepMilliseconds(1);
+  }
+  return 0;
+}
+
+/*===========================================================================*/
+/* Helpers.                                                                  */
+/*===========================================================================*/
+
+/*
+ * Completion callback, invoked from the interrupt handler.
+ */
+static void job_done(DMA2DDriver *dma2dp, dma2d_job_t *jobp) {
+  unsigned i = (unsigned)(uintptr_t)jobp->arg;
+
+  (void)dma2dp;
+  if (i != done)
+    order_errors++;
+  statuses[i] = jobp->status;
+  done++;
+}
+
+/*
+ * Allocates and fills a job writing dst[i], the L-8 source is used when a
+ * foreground palette is specified.
+ */
+static dma2d_job_t *job_new(dma2d_jobmode_t mode, unsigned i,
+                            const dma2d_palcfg_t *fgpalp,
+                            const dma2d_palcfg_t *bgpalp) {
+  dma2d_job_t *jobp = dma2dJobAlloc(&DMA2DD1);
+
+  memset(jobp, 0, sizeof *jobp);
+  jobp->mode = mode;
+  jobp->width = AREA_WIDTH;
+  jobp->height = AREA_HEIGHT;
+  if (fgpalp != NULL) {
+    jobp->fg.bufferp = lsrc;
+    jobp->fg.fmt = DMA2D_FMT_L8;
+    jobp->fg.palettep = fgpalp;
+  }
+  else {
+    jobp->fg.bufferp = src;
+    jobp->fg.fmt = DMA2D_FMT_ARGB8888;
+  }
+  if (bgpalp != NULL) {
+    jobp->bg.bufferp = lsrc;
+    jobp->bg.fmt = DMA2D_FMT_L8;
+    jobp->bg.palettep = bgpalp;
+  }
+  else {
+    jobp->bg.bufferp = dst[i];
+    jobp->bg.fmt = DMA2D_FMT_ARGB8888;
+  }
+  jobp->out.bufferp = dst[i];
+  jobp->out.fmt = DMA2D_FMT_ARGB8888;
+  jobp->callback = job_done;
+  jobp->arg = (void *)(uintptr_t)i;
+  return jobp;
+}
+
+static void check_log(const expected_t *ep, unsigned n) {
+  unsigned i;
+
+  check(dma2d_model.ops == n);
+  for (i = 0; (i < n) && (i < dma2d_model.ops); i++) {
+    const dma2d_record_t *rp = &dma2d_model.log[i];
+
+    check(rp->op == ep[i].op);
+    check((ep[i].op == DMA2D_OP_TRANSFER ? rp->omar : rp->cmar) ==
+          addr(ep[i].p));
+  }
+}
+
+static void start_sequence(void) {
+
+  dma2dModelReset();
+  done = 0;
+  order_errors = 0;
+  memset(statuses, 0, sizeof statuses);
+}
+
+/*===========================================================================*/
+/* Test sequences.                                                           */
+/*===========================================================================*/
+
+/*
+ * More jobs than the pool contains, the submitting thread blocks on the
+ * allocation until the peripheral releases a completed job.
+ */
+static void test_pool(void) {
+  unsigned i;
+
+  chprintf(chp, "--- %d jobs through a %d jobs pool\r\n",
+           POOL_JOBS, POOL_SIZE);
+  start_sequence();
+  for (i = 0; i < POOL_JOBS; i++)
+    dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_COPY, i, NULL, NULL));
+  check(dma2dQueueWait(&DMA2DD1) == RDY_OK);
+  check((done == POOL_JOBS) && (order_errors == 0));
+  check(dma2d_model.ops == POOL_JOBS);
+  for (i = 0; (i < POOL_JOBS) && (i < dma2d_model.ops); i++) {
+    const dma2d_record_t *rp = &dma2d_model.log[i];
+
+    check((rp->op == DMA2D_OP_TRANSFER) && (rp->mode == DMA2D_JOB_COPY));
+    check(rp->nlr == ((AREA_WIDTH << 16) | AREA_HEIGHT));
+    check((rp->omar == addr(dst[i])) && (rp->fgmar == addr(src)));
+  }
+  check(chSemGetCounterI(&DMA2DD1.jobsem) == POOL_SIZE);
+}
+
+/*
+ * A whole pool of jobs with a failing transfer in the middle, the jobs are
+ * chained by the interrupt handler and the submitting thread is woken once,
+ * when the queue has drained.
+ */
+static void test_batch(void) {
+  Thread *tp = chThdSelf();
+  uint32_t switches;
+  unsigned i;
+  msg_t msg;
+
+  chprintf(chp, "--- %d jobs batch, the fourth one failing\r\n", POOL_SIZE);
+  start_sequence();
+  dma2d_model.fault_addr = addr(dst[3]);
+  chRegResetThreadStats(tp);
+  for (i = 0; i < POOL_SIZE; i++)
+    dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_COPY, i, NULL, NULL));
+  msg = dma2dQueueWait(&DMA2DD1);
+  switches = tp->p_stats.ts_switches;
+  dma2d_model.fault_addr = 0;
+  chprintf(chp, "    submitting thread wakeups: %d\r\n", switches);
+  check(msg == RDY_RESET);
+  check(switches == 1);
+  check((done == POOL_SIZE) && (order_errors == 0));
+  check(dma2d_model.ops == POOL_SIZE);
+  for (i = 0; i < POOL_SIZE; i++)
+    check(statuses[i] == (i == 3 ? RDY_RESET : RDY_OK));
+
+  /* The failure is reported once.*/
+  check(dma2dQueueWait(&DMA2DD1) == RDY_OK);
+}
+
+/*
+ * A palette is loaded only when it differs from the one loaded on the same
+ * layer by the previous job of the queue.
+ */
+static void test_palettes(void) {
+  static const expected_t batch1[] = {
+    {DMA2D_OP_FGCLUT, colors1}, {DMA2D_OP_TRANSFER, dst[0]},
+    {DMA2D_OP_TRANSFER, dst[1]},
+    {DMA2D_OP_FGCLUT, colors2}, {DMA2D_OP_TRANSFER, dst[2]},
+    {DMA2D_OP_FGCLUT, colors1}, {DMA2D_OP_TRANSFER, dst[3]},
+    {DMA2D_OP_BGCLUT, colors2}, {DMA2D_OP_TRANSFER, dst[4]}
+  };
+  static const expected_t batch2[] = {
+    {DMA2D_OP_FGCLUT, colors1}, {DMA2D_OP_TRANSFER, dst[5]}
+  };
+  static const expected_t batch3[] = {
+    {DMA2D_OP_FGCLUT, colors1}, {DMA2D_OP_TRANSFER, dst[6]},
+    {DMA2D_OP_FGCLUT, colors3},
+    {DMA2D_OP_FGCLUT, colors1}, {DMA2D_OP_TRANSFER, dst[8]}
+  };
+
+  chprintf(chp, "--- Palettes\r\n");
+  start_sequence();
+  dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_CONVERT, 0, &pal1, NULL));
+  dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_CONVERT, 1, &pal1, NULL));
+  dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_CONVERT, 2, &pal2, NULL));
+  dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_CONVERT, 3, &pal1, NULL));
+  dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_BLEND, 4, &pal1, &pal2));
+  check(dma2dQueueWait(&DMA2DD1) == RDY_OK);
+  check_log(batch1, sizeof batch1 / sizeof batch1[0]);
+
+  /* The loaded palettes are forgotten when the queue drains.*/
+  dma2dModelReset();
+  dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_CONVERT, 5, &pal1, NULL));
+  check(dma2dQueueWait(&DMA2DD1) == RDY_OK);
+  check_log(batch2, sizeof batch2 / sizeof batch2[0]);
+
+  /* A failed palette load fails its job and forgets the loaded palettes.*/
+  dma2dModelReset();
+  dma2d_model.fault_addr = addr(colors3);
+  dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_CONVERT, 6, &pal1, NULL));
+  dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_CONVERT, 7, &pal3, NULL));
+  dma2dJobSubmit(&DMA2DD1, job_new(DMA2D_JOB_CONVERT, 8, &pal1, NULL));
+  check(dma2dQueueWait(&DMA2DD1) == RDY_RESET);
+  dma2d_model.fault_addr = 0;
+  check_log(batch3, sizeof batch3 / sizeof batch3[0]);
+  check((done == 9) && (order_errors == 0));
+  check((statuses[6] == RDY_OK) && (statuses[7] == RDY_RESET) &&
+        (statuses[8] == RDY_OK));
+}
+
+static void scene_layer(CompLayer *lp, void *bufferp, dma2d_pixfmt_t fmt,
+                        uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+
+  memset(lp, 0, sizeof *lp);
+  lp->cl_source.bufferp = bufferp;
+  lp->cl_source.fmt = fmt;
+  lp->cl_source.const_alpha = 0xFF;
+  lp->cl_source.palettep = fmt == DMA2D_FMT_L8 ? &scene_pal : NULL;
+  lp->cl_amode = DMA2D_ALPHA_KEEP;
+  lp->cl_x = x;
+  lp->cl_y = y;
+  lp->cl_width = w;
+  lp->cl_height = h;
+  lp->cl_blend = fmt == DMA2D_FMT_ARGB8888;
+  lp->cl_visible = TRUE;
+}
+
+/*
+ * Bytes moved by the transfers in the model log.
+ */
+static uint32_t log_transfer_bytes(void) {
+  uint32_t bytes = 0;
+  unsigned i;
+
+  for (i = 0; (i < dma2d_model.ops) && (i < DMA2D_MODEL_LOG_SIZE); i++)
+    if (dma2d_model.log[i].op == DMA2D_OP_TRANSFER)
+      bytes += dma2d_model.log[i].bytes;
+  return bytes;
+}
+
+/*
+ * The indicator moves by 4 pixels each frame as in the demo and the frame
+ * buffers are rendered in rotation, the bytes accounted by the compositor
+ * are compared with the ones moved by the model.
+ */
+static void test_compositor(void) {
+  uint32_t first, full, min, max, total, mismatches;
+  unsigned frame, x;
+  int dx;
+
+  chprintf(chp, "--- Compositor, demo scene, %d frames\r\n", FRAMES);
+  scene_layer(&comp_layers[0], view_buffer, DMA2D_FMT_L8,
+              0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+  scene_layer(&comp_layers[1], splash_buffer, DMA2D_FMT_L8,
+              8, 0, 200, SCREEN_HEIGHT);
+  scene_layer(&comp_layers[2], status_sprite, DMA2D_FMT_ARGB8888,
+              0, SPRITE_Y, SPRITE_SIZE, SPRITE_SIZE);
+  compObjectInit(&comp, &comp_cfg, comp_layers, 3);
+
+  dma2dModelReset();
+  check(compRender(&comp, comp_buffers[0]) == RDY_OK);
+  first = comp.co_stats.cs_bytes;
+  full = comp.co_stats.cs_full_bytes;
+  check(first == log_transfer_bytes());
+
+  x = 0;
+  dx = 4;
+  min = 0xFFFFFFFF;
+  max = 0;
+  total = 0;
+  mismatches = 0;
+  for (frame = 1; frame <= FRAMES; frame++) {
+    uint32_t bytes;
+
+    if (((x == 0) && (dx < 0)) ||
+        ((x == SCREEN_WIDTH - SPRITE_SIZE) && (dx > 0)))
+      dx = -dx;
+    x += dx;
+    compLayerMove(&comp, 2, x, SPRITE_Y);
+    dma2dModelReset();
+    check(compRender(&comp, comp_buffers[frame % 3]) == RDY_OK);
+    bytes = comp.co_stats.cs_bytes;
+    if (bytes != log_transfer_bytes())
+      mismatches++;
+
+    /* The first frames of the other buffers catch up with the whole screen.*/
+    if (frame >= 3) {
+      if (bytes < min)
+        min = bytes;
+      if (bytes > max)
+        max = bytes;
+      total += bytes;
+    }
+  }
+  chprintf(chp, "    full redraw:         %d bytes\r\n", full);
+  chprintf(chp, "    first frame:         %d bytes\r\n", first);
+  chprintf(chp, "    steady state frames: %d bytes min, %d max, %d average"
+           "\r\n", min, max, total / (FRAMES - 2));
+  check(first == full);
+  check(mismatches == 0);
+  check(max < full);
+}
+
+/*
+ * Simulator main.
+ */
+int main(int argc, char *argv[]) {
+
+  (void)argc;
+  (void)argv;
+
+  /*
+   * System initializations.
+   * - HAL initialization, this also initializes the configured device drivers
+   *   and performs the board-specific initializations.
+   * - Kernel initialization, the main() function becomes a thread and the
+   *   RTOS is active.
+   */
+  halInit();
+  conInit();
+  chSysInit();
+
+  dma2dInit();
+  dma2dStart(&DMA2DD1, &dma2d_cfg);
+  chThdCreateStatic(waDevice, sizeof(waDevice), NORMALPRIO - 1,
+                    device_thread, NULL);
+
+  chprintf(chp, "*** DMA2D job queue over the registers model\r\n\r\n");
+  test_pool();
+  test_batch();
+  test_palettes();
+  test_compositor();
+
+  chprintf(chp, "\r\nFinal result: %s\r\n",
+           failures == 0 ? "SUCCESS" : "FAILURE");
+  exit(failures == 0 ? 0 : 1);
+}
@@ -0,0 +1,103 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/*
+ * FatFs disk I/O functions over a RAM disk, each command takes a fixed
+ * time in order to simulate a slow device, commands and transferred
+ * sectors are counted.
+ */
+
+#include "ch.h"
+#include "hal.h"
+#include "ramdisk.h"
+#include "diskio.h"
+#include "diskio_ram.h"
+
+RamDisk RD1;
+DiskCounters disk_counters;
+unsigned disk_latency_ms;
+
+static void disk_wait(BYTE count) {
+
+  disk_counters.sectors += count;
+  if (disk_latency_ms > 0)
+    chThdSleepMilliseconds(disk_latency_ms);
+}
+
+DSTATUS disk_initialize(BYTE drv) {
+
+  if (drv != 0)
+    return STA_NOINIT;
+  return blkIsInserted(&RD1) ? 0 : STA_NODISK;
+}
+
+DSTATUS disk_status(BYTE drv) {
+
+  if (drv != 0)
+    return STA_NOINIT;
+  return blkGetDriverState(&RD1) == BLK_READY ? 0 : STA_NOINIT;
+}
+
+DRESULT disk_read(BYTE drv, BYTE *buff, DWORD sector, BYTE count) {
+
+  if (drv != 0)
+    return RES_PARERR;
+  disk_counters.reads++;
+  disk_wait(count);
+  if (blkRead(&RD1, sector, buff, count))
+    return RES_ERROR;
+  return RES_OK;
+}
+
+DRESULT disk_write(BYTE drv, const BYTE *buff, DWORD sector, BYTE count) {
+
+  if (drv != 0)
+    return RES_PARERR;
+  disk_counters.writes++;
+  disk_wait(count);
+  if (blkWrite(&RD1, sector, buff, count))
+    return RES_ERROR;
+  return RES_OK;
+}
+
+DRESULT disk_ioctl(BYTE drv, BYTE ctrl, void *buff) {
+  BlockDeviceInfo bdi;
+
+  if (drv != 0)
+    return RES_PARERR;
+  switch (ctrl) {
+  case CTRL_SYNC:
+    return blkSync(&RD1) ? RES_ERROR : RES_OK;
+  case GET_SECTOR_COUNT:
+    if (blkGetInfo(&RD1, &bdi))
+      return RES_ERROR;
+    *((DWORD *)buff) = bdi.blk_num;
+    return RES_OK;
+  case GET_SECTOR_SIZE:
+    *((WORD *)buff) = 512;
+    return RES_OK;
+  case GET_BLOCK_SIZE:
+    *((DWORD *)buff) = 1;
+    return RES_OK;
+  default:
+    return RES_PARERR;
+  }
+}
+
+DWORD get_fattime(void) {
+
+  return 0;
+}
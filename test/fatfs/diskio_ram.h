@@ -0,0 +1,39 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef _DISKIO_RAM_H_
+#define _DISKIO_RAM_H_
+
+/*
+ * Disk commands counters.
+ */
+typedef struct {
+  unsigned      reads;
+  unsigned      writes;
+  unsigned      sectors;
+} DiskCounters;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  extern RamDisk RD1;
+  extern DiskCounters disk_counters;
+  extern unsigned disk_latency_ms;
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DISKIO_RAM_H_ */
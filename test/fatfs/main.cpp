@@ -0,0 +1,345 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ch.hpp"
+#include "hal.h"
+#include "chprintf.h"
+#include "ramdisk.h"
+#include "diskio_ram.h"
+#include "fatfs_fsimpl.hpp"
+
+/* The console header declares CD1 outside its C linkage block.*/
+extern "C" {
+#include "console.h"
+}
+
+using namespace chibios_rt;
+using namespace chibios_fs;
+using namespace chibios_fatfs;
+
+/*
+ * Three clients share the file system through the wrapper, a logger makes
+ * small asynchronous appends, a loader makes small synchronous reads and a
+ * streamer reads a large file asynchronously. Every disk command takes
+ * DISK_LATENCY milliseconds, the data is checked and the disk commands and
+ * the elapsed times are reported.
+ */
+#define DISK_BLOCKS     4096
+#define DISK_LATENCY    1
+
+#define LOG_RECORDS     1000
+#define LOG_SIZE        32
+#define LOG_DEPTH       8
+
+#define CFG_SIZE        4096
+#define CFG_READS       200
+#define CFG_CHUNK       64
+
+#define ASSET_SIZE      (128 * 1024)
+#define ASSET_CHUNK     512
+#define ASSET_DEPTH     4
+
+static BaseSequentialStream *chp = (BaseSequentialStream *)&CD1;
+
+static uint8_t storage[DISK_BLOCKS * 512];
+static FatFSWrapper fs;
+static unsigned failures;
+
+static WORKING_AREA(waLogger, 2048);
+static WORKING_AREA(waLoader, 2048);
+static WORKING_AREA(waStreamer, 2048);
+
+/*
+ * Host time in microseconds, the simulated system time does not advance
+ * while the threads are running.
+ */
+static uint32_t host_us(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void check(bool c, const char *msg) {
+
+  if (!c) {
+    chprintf(chp, "  %s\r\n", msg);
+    failures++;
+  }
+}
+
+static uint8_t asset_byte(uint32_t offset) {
+
+  return (uint8_t)(offset * 7 + (offset >> 9));
+}
+
+/*
+ * Clients elapsed times in microseconds.
+ */
+static uint32_t logger_us, loader_us, loader_max_us, streamer_us;
+
+/*
+ * Logger, asynchronous appends with up to LOG_DEPTH requests in flight.
+ * The records buffers are not contiguous so the merged requests are served
+ * by separate FatFS calls, the streamer buffers are contiguous instead.
+ */
+static msg_t logger(void *arg) {
+  FatFSFileWrapper *fp = (FatFSFileWrapper *)arg;
+  static FatFSRequest req[LOG_DEPTH];
+  static uint8_t buf[LOG_DEPTH][LOG_SIZE + 4];
+  uint32_t start = host_us();
+  unsigned i, j, k;
+
+  for (i = 0; i < LOG_RECORDS; i++) {
+    k = i % LOG_DEPTH;
+    if (i >= LOG_DEPTH) {
+      req[k].waitCompletion(TIME_INFINITE);
+      check(req[k].getResult() == LOG_SIZE, "log write failed");
+    }
+    for (j = 0; j < LOG_SIZE; j++)
+      buf[k][j] = (uint8_t)(i + j);
+    fp->startWrite(&req[k], buf[k], LOG_SIZE, NORMALPRIO + 2, 0);
+  }
+  for (k = 0; k < LOG_DEPTH; k++) {
+    req[k].waitCompletion(TIME_INFINITE);
+    check(req[k].getResult() == LOG_SIZE, "log write failed");
+  }
+  logger_us = host_us() - start;
+  return 0;
+}
+
+/*
+ * Loader, synchronous reads, the requests take the thread priority.
+ */
+static msg_t loader(void *arg) {
+  BaseFileStreamInterface *fp = (BaseFileStreamInterface *)arg;
+  uint8_t buf[CFG_CHUNK];
+  uint32_t start = host_us();
+  unsigned i, j;
+
+  for (i = 0; i < CFG_READS; i++) {
+    uint32_t t = host_us();
+    if (fp->getPosition() >= CFG_SIZE)
+      fp->setPosition(0);
+    if (fp->read(buf, CFG_CHUNK) != CFG_CHUNK) {
+      check(false, "config read failed");
+      break;
+    }
+    t = host_us() - t;
+    if (t > loader_max_us)
+      loader_max_us = t;
+    for (j = 0; j < CFG_CHUNK; j++)
+      if (buf[j] != 'c')
+        break;
+    check(j == CFG_CHUNK, "config data mismatch");
+  }
+  loader_us = host_us() - start;
+  return 0;
+}
+
+/*
+ * Streamer, asynchronous reads with up to ASSET_DEPTH requests in flight.
+ * Every other read has a higher priority, the reads must still be served
+ * in order.
+ */
+static msg_t streamer(void *arg) {
+  FatFSFileWrapper *fp = (FatFSFileWrapper *)arg;
+  static FatFSRequest req[ASSET_DEPTH];
+  static uint8_t buf[ASSET_DEPTH][ASSET_CHUNK];
+  uint32_t start = host_us();
+  uint32_t offset, issued = 0;
+  unsigned i, j;
+
+  for (i = 0; i < ASSET_DEPTH; i++, issued += ASSET_CHUNK)
+    fp->startRead(&req[i], buf[i], ASSET_CHUNK, NORMALPRIO + (i & 1), 0);
+  for (offset = 0; offset < ASSET_SIZE; offset += ASSET_CHUNK) {
+    unsigned k = (offset / ASSET_CHUNK) % ASSET_DEPTH;
+    req[k].waitCompletion(TIME_INFINITE);
+    if (req[k].getResult() != ASSET_CHUNK) {
+      check(false, "asset read failed");
+      break;
+    }
+    for (j = 0; j < ASSET_CHUNK; j++)
+      if (buf[k][j] != asset_byte(offset + j))
+        break;
+    check(j == ASSET_CHUNK, "asset data mismatch");
+    if (issued < ASSET_SIZE) {
+      fp->startRead(&req[k], buf[k], ASSET_CHUNK, NORMALPRIO + (k & 1), 0);
+      issued += ASSET_CHUNK;
+    }
+  }
+  streamer_us = host_us() - start;
+  return 0;
+}
+
+/*
+ * Creates the files read by the clients.
+ */
+static void make_files(void) {
+  static uint8_t buf[4096];
+  BaseFileStreamInterface *fp;
+  uint32_t offset;
+  unsigned j;
+
+  fp = fs.create("cfg.txt");
+  check(fp != NULL, "config create failed");
+  memset(buf, 'c', CFG_SIZE);
+  check(fp->write(buf, CFG_SIZE) == CFG_SIZE, "config write failed");
+  fs.close(fp);
+
+  fp = fs.create("asset.bin");
+  check(fp != NULL, "asset create failed");
+  for (offset = 0; offset < ASSET_SIZE; offset += sizeof buf) {
+    for (j = 0; j < sizeof buf; j++)
+      buf[j] = asset_byte(offset + j);
+    check(fp->write(buf, sizeof buf) == sizeof buf, "asset write failed");
+  }
+  check(fp->getSize() == ASSET_SIZE, "asset size mismatch");
+  fs.close(fp);
+
+  check(fs.openForRead("missing.txt") == NULL, "missing file opened");
+  check(fs.getAndClearLastError() == FR_NO_FILE, "missing file error");
+}
+
+/*
+ * Reads back the log written by the logger.
+ */
+static void check_log(void) {
+  BaseFileStreamInterface *fp;
+  uint8_t buf[LOG_SIZE];
+  unsigned i, j;
+
+  fp = fs.openForRead("log.txt");
+  check(fp != NULL, "log open failed");
+  if (fp == NULL)
+    return;
+  check(fp->getSize() == LOG_RECORDS * LOG_SIZE, "log size mismatch");
+  for (i = 0; i < LOG_RECORDS; i++) {
+    if (fp->read(buf, LOG_SIZE) != LOG_SIZE) {
+      check(false, "log read failed");
+      break;
+    }
+    for (j = 0; j < LOG_SIZE; j++)
+      if (buf[j] != (uint8_t)(i + j))
+        break;
+    if (j != LOG_SIZE) {
+      check(false, "log data mismatch");
+      break;
+    }
+  }
+  fs.close(fp);
+  fs.remove("log.txt");
+  check(fs.openForRead("log.txt") == NULL, "log not removed");
+  fs.getAndClearLastError();
+}
+
+/*
+ * Simulator main.
+ */
+int main(int argc, char *argv[]) {
+  static FATFS fatfs;
+  BaseFileStreamInterface *lfp, *cfp, *afp;
+  ::Thread *tp[3];
+  uint32_t start, us;
+  unsigned i;
+
+  (void)argc;
+  (void)argv;
+
+  /*
+   * System initializations.
+   * - HAL initialization, this also initializes the configured device drivers
+   *   and performs the board-specific initializations.
+   * - Kernel initialization, the main() function becomes a thread and the
+   *   RTOS is active.
+   */
+  halInit();
+  conInit();
+  System::init();
+
+  chprintf(chp, "*** FatFS wrapper with concurrent clients\r\n");
+  chprintf(chp, "*** Disk blocks:     %d\r\n", DISK_BLOCKS);
+  chprintf(chp, "*** Disk latency:    %d ms per command\r\n", DISK_LATENCY);
+  chprintf(chp, "*** Merged requests: %d\r\n", FATFS_MAX_MERGED_REQUESTS);
+  chprintf(chp, "\r\n");
+
+  /*
+   * Formatted RAM disk, the clients files are created through the
+   * synchronous API.
+   */
+  ramdiskObjectInit(&RD1);
+  ramdiskStart(&RD1, storage, 512, DISK_BLOCKS, FALSE);
+  blkConnect(&RD1);
+  f_mount(0, &fatfs);
+  check(f_mkfs(0, 1, 0) == FR_OK, "format failed");
+  f_mount(0, NULL);
+
+  chprintf(chp, "--- Files setup\r\n");
+  fs.mount();
+  make_files();
+
+  chprintf(chp, "--- Logger, loader and streamer\r\n");
+  lfp = fs.create("log.txt");
+  cfp = fs.openForRead("cfg.txt");
+  afp = fs.openForRead("asset.bin");
+  check((lfp != NULL) && (cfp != NULL) && (afp != NULL), "open failed");
+  if (failures == 0) {
+    disk_latency_ms = DISK_LATENCY;
+    memset(&disk_counters, 0, sizeof disk_counters);
+    start = host_us();
+    tp[0] = chThdCreateStatic(waLogger, sizeof waLogger, NORMALPRIO + 2,
+                              logger, (FatFSFileWrapper *)lfp);
+    tp[1] = chThdCreateStatic(waLoader, sizeof waLoader, NORMALPRIO + 1,
+                              loader, cfp);
+    tp[2] = chThdCreateStatic(waStreamer, sizeof waStreamer, NORMALPRIO,
+                              streamer, (FatFSFileWrapper *)afp);
+    for (i = 0; i < 3; i++)
+      chThdWait(tp[i]);
+    fs.synchronize();
+    us = host_us() - start;
+    disk_latency_ms = 0;
+
+    chprintf(chp, "    elapsed:  %d ms\r\n", us / 1000);
+    chprintf(chp, "    logger:   %d ms, %d records of %d bytes\r\n",
+             logger_us / 1000, LOG_RECORDS, LOG_SIZE);
+    chprintf(chp, "    loader:   %d ms, %d reads of %d bytes, "
+                  "worst read %d ms\r\n",
+             loader_us / 1000, CFG_READS, CFG_CHUNK, loader_max_us / 1000);
+    chprintf(chp, "    streamer: %d ms, %d kB in %d bytes reads\r\n",
+             streamer_us / 1000, ASSET_SIZE / 1024, ASSET_CHUNK);
+    chprintf(chp, "    disk:     %d reads, %d writes, %d sectors\r\n",
+             disk_counters.reads, disk_counters.writes,
+             disk_counters.sectors);
+  }
+  if (lfp != NULL)
+    fs.close(lfp);
+  if (cfp != NULL)
+    fs.close(cfp);
+  if (afp != NULL)
+    fs.close(afp);
+
+  chprintf(chp, "--- Log contents\r\n");
+  check_log();
+  fs.unmount();
+
+  chprintf(chp, "\r\nFinal result: %s\r\n",
+           failures == 0 ? "SUCCESS" : "FAILURE");
+  exit(failures == 0 ? 0 : 1);
+}
@@ -0,0 +1,236 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "console.h"
+#include "chprintf.h"
+#include "raster.h"
+
+/*
+ * Each kernel is run on a random rectangle and its result compared with the
+ * one of the matching reference kernel, the whole buffers are compared so
+ * writes outside the rectangle are detected too.
+ */
+#define ITERATIONS      20000
+#define BUFFER_SIZE     4096
+#define MAX_WIDTH       40
+#define MAX_HEIGHT      5
+
+static BaseSequentialStream *chp = (BaseSequentialStream *)&CD1;
+
+static uint32_t buf_dst[BUFFER_SIZE / 4];
+static uint32_t buf_ref[BUFFER_SIZE / 4];
+static uint32_t buf_src[BUFFER_SIZE / 4];
+static uint32_t palette[256];
+
+static const rasterfmt_t direct_formats[] = {
+  RASTER_FMT_ARGB8888, RASTER_FMT_RGB888, RASTER_FMT_RGB565,
+  RASTER_FMT_ARGB1555, RASTER_FMT_ARGB4444
+};
+
+static const rasterfmt_t all_formats[] = {
+  RASTER_FMT_ARGB8888, RASTER_FMT_RGB888, RASTER_FMT_RGB565,
+  RASTER_FMT_ARGB1555, RASTER_FMT_ARGB4444, RASTER_FMT_L8,
+  RASTER_FMT_AL44, RASTER_FMT_AL88, RASTER_FMT_A8
+};
+
+static const char *kernel_names[] = {
+  "fill", "copy", "keyed copy", "blend", "expand", "convert"
+};
+
+static unsigned failures[6];
+
+/*
+ * Deterministic generator, the sequence is the same on every host.
+ */
+static uint32_t seed = 1;
+
+static uint32_t rnd(uint32_t n) {
+
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 8) % n;
+}
+
+static uint32_t rnd32(void) {
+
+  return (rnd(0x10000) << 16) | rnd(0x10000);
+}
+
+static void randomize(uint32_t *p, size_t n) {
+
+  while (n-- > 0)
+    *p++ = rnd32();
+}
+
+/*
+ * Random offset for a rectangle, ARGB-8888 rectangles must be word aligned
+ * and 16 bits formats are kept half word aligned.
+ */
+static size_t rnd_offset(rasterfmt_t fmt) {
+  size_t offset = rnd(8);
+
+  if (fmt == RASTER_FMT_ARGB8888)
+    return offset & ~3;
+  if (rasterBytesPerPixel(fmt) == 2)
+    return offset & ~1;
+  return offset;
+}
+
+/*
+ * Random pitch, ARGB-8888 rows must stay word aligned.
+ */
+static size_t rnd_pitch(rasterfmt_t fmt, unsigned width) {
+  size_t pitch = width * rasterBytesPerPixel(fmt);
+
+  if ((fmt == RASTER_FMT_ARGB8888) || (rasterBytesPerPixel(fmt) == 2))
+    return pitch + rnd(3) * 4;
+  return pitch + rnd(9);
+}
+
+static void run_once(unsigned kernel) {
+  uint8_t *dst = (uint8_t *)buf_dst;
+  uint8_t *ref = (uint8_t *)buf_ref;
+  uint8_t *src = (uint8_t *)buf_src;
+  uint16_t width = rnd(MAX_WIDTH) + 1;
+  uint16_t height = rnd(MAX_HEIGHT) + 1;
+  rasterfmt_t dfmt = direct_formats[rnd(5)];
+  rasterfmt_t sfmt = direct_formats[rnd(5)];
+  size_t doff, soff = 0, dpitch, spitch;
+  uint32_t color = rnd32();
+  uint8_t key = rnd(4);
+  uint8_t alpha = rnd(256);
+  unsigned i;
+
+  randomize(buf_dst, BUFFER_SIZE / 4);
+  memcpy(buf_ref, buf_dst, BUFFER_SIZE);
+  randomize(buf_src, BUFFER_SIZE / 4);
+  randomize(palette, 256);
+
+  switch (kernel) {
+  case 0:
+    dfmt = all_formats[rnd(9)];
+    doff = rnd_offset(dfmt);
+    dpitch = rnd_pitch(dfmt, width);
+    rasterFill(dst + doff, dpitch, dfmt, width, height, color);
+    rasterRefFill(ref + doff, dpitch, dfmt, width, height, color);
+    break;
+  case 1:
+    dfmt = all_formats[rnd(9)];
+    doff = rnd_offset(dfmt);
+    soff = rnd_offset(dfmt);
+    dpitch = rnd_pitch(dfmt, width);
+    spitch = rnd_pitch(dfmt, width);
+    rasterCopy(dst + doff, dpitch, src + soff, spitch, dfmt, width, height);
+    rasterRefCopy(ref + doff, dpitch, src + soff, spitch, dfmt, width, height);
+    break;
+  case 2:
+    /* Few distinct values so that the key is hit often.*/
+    for (i = 0; i < BUFFER_SIZE; i++)
+      src[i] &= 3;
+    doff = rnd(8);
+    soff = rnd(8);
+    dpitch = width + rnd(9);
+    spitch = width + rnd(9);
+    rasterCopyKeyed(dst + doff, dpitch, src + soff, spitch,
+                    width, height, key);
+    rasterRefCopyKeyed(ref + doff, dpitch, src + soff, spitch,
+                       width, height, key);
+    break;
+  case 3:
+    doff = rnd_offset(dfmt);
+    soff = rnd_offset(RASTER_FMT_ARGB8888);
+    dpitch = rnd_pitch(dfmt, width);
+    spitch = rnd_pitch(RASTER_FMT_ARGB8888, width);
+    rasterBlend(dst + doff, dpitch, dfmt, (const uint32_t *)(src + soff),
+                spitch, width, height, alpha);
+    rasterRefBlend(ref + doff, dpitch, dfmt, (const uint32_t *)(src + soff),
+                   spitch, width, height, alpha);
+    break;
+  case 4:
+    doff = rnd_offset(dfmt);
+    soff = rnd(8);
+    dpitch = rnd_pitch(dfmt, width);
+    spitch = width + rnd(9);
+    rasterExpand(dst + doff, dpitch, dfmt, src + soff, spitch,
+                 palette, width, height);
+    rasterRefExpand(ref + doff, dpitch, dfmt, src + soff, spitch,
+                    palette, width, height);
+    break;
+  default:
+    doff = rnd_offset(dfmt);
+    soff = rnd_offset(sfmt);
+    dpitch = rnd_pitch(dfmt, width);
+    spitch = rnd_pitch(sfmt, width);
+    rasterConvert(dst + doff, dpitch, dfmt, src + soff, spitch, sfmt,
+                  width, height);
+    rasterRefConvert(ref + doff, dpitch, dfmt, src + soff, spitch, sfmt,
+                     width, height);
+    break;
+  }
+
+  if (memcmp(buf_dst, buf_ref, BUFFER_SIZE) != 0) {
+    if (failures[kernel]++ < 4)
+      chprintf(chp, "  %s mismatch: fmt %d/%d, %dx%d, offset %d/%d\r\n",
+               kernel_names[kernel], dfmt, sfmt, width, height,
+               (int)doff, (int)soff);
+  }
+}
+
+/*
+ * Simulator main.
+ */
+int main(int argc, char *argv[]) {
+  unsigned i, total;
+
+  (void)argc;
+  (void)argv;
+
+  /*
+   * System initializations.
+   * - HAL initialization, this also initializes the configured device drivers
+   *   and performs the board-specific initializations.
+   * - Kernel initialization, the main() function becomes a thread and the
+   *   RTOS is active.
+   */
+  halInit();
+  conInit();
+  chSysInit();
+
+  chprintf(chp, "*** Raster kernels against the reference ones\r\n");
+  chprintf(chp, "*** Iterations: %d\r\n", ITERATIONS);
+#if RASTER_USE_SIMD
+  chprintf(chp, "*** Word parallel kernels enabled\r\n");
+#else
+  chprintf(chp, "*** Word parallel kernels disabled\r\n");
+#endif
+  chprintf(chp, "\r\n");
+
+  for (i = 0; i < ITERATIONS; i++)
+    run_once(i % 6);
+
+  total = 0;
+  for (i = 0; i < 6; i++) {
+    chprintf(chp, "--- %s: %d mismatches\r\n", kernel_names[i], failures[i]);
+    total += failures[i];
+  }
+  chprintf(chp, "\r\nFinal result: %s\r\n",
+           total == 0 ? "SUCCESS" : "FAILURE");
+  exit(total == 0 ? 0 : 1);
+}
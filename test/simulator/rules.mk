@@ -0,0 +1,125 @@
+#
+#       !!!! Do NOT edit this makefile with an editor which replace tabs by spaces !!!!
+#
+##############################################################################################
+#
+# Common rules of the simulator test applications, the application makefile
+# defines PROJECT, CHIBIOS, SRC, CPPSRC, UDEFS, UINCDIR, ULIBDIR, ULIBS and OPT
+# then includes this file.
+#
+# The kernel and HAL settings are in ./chconf.h and ./halconf.h, an application
+# overrides the few options it needs through UDEFS. The os/ sources are shared
+# by all the applications and compiled with different settings, so the objects
+# are placed in the application build directory.
+#
+
+##############################################################################################
+# Start of default section
+#
+
+TRGT =
+CC   = $(TRGT)gcc
+CPPC = $(TRGT)g++
+
+# List all default C defines here, like -D_DEBUG=1
+DDEFS = -DSIMULATOR
+
+# Must be a directory in ${CHIBIOS}/os/hal/platforms
+HOST_TYPE = Linux
+
+include $(CHIBIOS)/boards/simulator/board.mk
+include ${CHIBIOS}/os/hal/hal.mk
+include ${CHIBIOS}/os/hal/platforms/$(HOST_TYPE)/platform.mk
+include ${CHIBIOS}/os/ports/GCC/SIMIA32/port.mk
+include ${CHIBIOS}/os/kernel/kernel.mk
+
+# List all default C source files here
+DSRC = ${PORTSRC} \
+       ${KERNSRC} \
+       ${HALSRC} \
+       ${PLATFORMSRC} \
+       $(BOARDSRC) \
+       ${CHIBIOS}/os/hal/platforms/$(HOST_TYPE)/console.c \
+       ${CHIBIOS}/os/various/chprintf.c
+
+# List all default directories to look for include files here, the
+# application directory comes first
+DINCDIR = . $(CHIBIOS)/test/simulator \
+          $(PORTINC) $(KERNINC) \
+          $(HALINC) $(PLATFORMINC) $(BOARDINC) \
+          $(CHIBIOS)/os/various
+
+# List the default directory to look for the libraries here
+DLIBDIR =
+
+# List all default libraries here
+DLIBS =
+
+#
+# End of default section
+##############################################################################################
+
+BUILDDIR = build
+OBJDIR   = $(BUILDDIR)/obj
+LSTDIR   = $(BUILDDIR)/lst
+
+CSRC     = $(DSRC) $(SRC)
+SRCPATHS = $(sort $(dir $(CSRC)) $(dir $(CPPSRC)))
+COBJS    = $(addprefix $(OBJDIR)/, $(notdir $(CSRC:.c=.o)))
+CPPOBJS  = $(addprefix $(OBJDIR)/, $(notdir $(CPPSRC:.cpp=.o)))
+OBJS     = $(COBJS) $(CPPOBJS)
+
+INCDIR  = $(patsubst %,-I%,$(DINCDIR) $(UINCDIR))
+LIBDIR  = $(patsubst %,-L%,$(DLIBDIR) $(ULIBDIR))
+DEFS    = $(DDEFS) $(UDEFS)
+LIBS    = $(DLIBS) $(ULIBS)
+
+# C++ applications are linked with the C++ driver
+ifeq ($(CPPSRC),)
+  LD    = $(CC)
+else
+  LD    = $(CPPC)
+endif
+
+LDFLAGS = -Wl,-Map=$(BUILDDIR)/$(PROJECT).map,--cref,--no-warn-mismatch $(LIBDIR)
+CPFLAGS = $(OPT) -Wall -Wextra -Wstrict-prototypes -fverbose-asm -Wa,-alms=$(LSTDIR)/$(notdir $(<:.c=.lst)) $(DEFS)
+CPPFLAGS = $(OPT) -fno-rtti -fno-exceptions -Wall -Wextra -fverbose-asm -Wa,-alms=$(LSTDIR)/$(notdir $(<:.cpp=.lst)) $(DEFS)
+
+# Generate dependency information
+CPFLAGS += -MD -MP -MF .dep/$(@F).d
+CPPFLAGS += -MD -MP -MF .dep/$(@F).d
+
+# Paths where to search for sources
+VPATH   = $(SRCPATHS)
+
+#
+# makefile rules
+#
+
+all: $(BUILDDIR)/$(PROJECT)
+
+$(OBJS): | $(BUILDDIR)
+
+$(BUILDDIR):
+	@mkdir -p $(OBJDIR)
+	@mkdir -p $(LSTDIR)
+
+$(COBJS) : $(OBJDIR)/%.o : %.c Makefile
+	$(CC) -c $(CPFLAGS) $(INCDIR) $< -o $@
+
+$(CPPOBJS) : $(OBJDIR)/%.o : %.cpp Makefile
+	$(CPPC) -c $(CPPFLAGS) $(INCDIR) $< -o $@
+
+$(BUILDDIR)/$(PROJECT): $(OBJS)
+	$(LD) $(OBJS) $(LDFLAGS) $(LIBS) -o $@
+
+.PHONY: clean
+clean:
+	-rm -fR .dep $(BUILDDIR)
+
+#
+# Include the dependency files, should be the last of the makefile
+#
+-include $(shell mkdir .dep 2>/dev/null) $(wildcard .dep/*)
+
+# *** EOF ***
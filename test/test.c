@@ -31,6 +31,7 @@
 #include "testmtx.h"
 #include "testmsg.h"
 #include "testmbox.h"
+#include "testtopics.h"
 #include "testevt.h"
 #include "testheap.h"
 #include "testpools.h"
@@ -47,6 +48,7 @@ static ROMCONST struct testcase * ROMCONST *patterns[] = {
   patternmtx,
   patternmsg,
   patternmbox,
+  patterntopics,
   patternevt,
   patternheap,
   patternpools,
@@ -95,7 +95,7 @@ extern "C" {
 #if CH_DBG_THREADS_PROFILING
   void test_cpu_pulse(unsigned duration);
 #endif
-#if defined(WIN32)
+#if defined(SIMULATOR)
   void ChkIntSources(void);
 #endif
 #ifdef __cplusplus
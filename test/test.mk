@@ -5,6 +5,7 @@ TESTSRC = ${CHIBIOS}/test/test.c \
           ${CHIBIOS}/test/testmtx.c \
           ${CHIBIOS}/test/testmsg.c \
           ${CHIBIOS}/test/testmbox.c \
+          ${CHIBIOS}/test/testtopics.c \
           ${CHIBIOS}/test/testevt.c \
           ${CHIBIOS}/test/testheap.c \
           ${CHIBIOS}/test/testpools.c \
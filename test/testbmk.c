@@ -15,6 +15,7 @@
 */
 
 #include "ch.h"
+#include "hal.h"
 #include "test.h"
 
 /**
@@ -49,6 +50,8 @@
  * - @subpage test_benchmarks_011
  * - @subpage test_benchmarks_012
  * - @subpage test_benchmarks_013
+ * - @subpage test_benchmarks_014
+ * - @subpage test_benchmarks_015
  * .
  * @file testbmk.c Kernel Benchmarks
  * @brief Kernel Benchmarks source file
@@ -496,11 +499,75 @@ ROMCONST struct testcase testbmk9 = {
  * <h2>Description</h2>
  * A virtual timer is set and immediately reset into a continuous loop.<br>
  * The performance is calculated by measuring the number of iterations after
- * a second of continuous operations.
+ * a second of continuous operations.<br>
+ * If the HAL implements the realtime counter then the worst case time spent
+ * under lock by set and reset is also measured with 1 to @p BMK10_TIMERS
+ * timers armed at pseudo-random times.
  */
 
+/*
+ * Maximum number of armed timers in the worst case measurement, the timers
+ * are statically allocated so only the simulator goes up to large numbers.
+ */
+#if !defined(BMK10_TIMERS) || defined(__DOXYGEN__)
+#if defined(SIMULATOR)
+#define BMK10_TIMERS 1024
+#else
+#define BMK10_TIMERS 16
+#endif
+#endif
+
 static void tmo(void *param) {(void)param;}
 
+#if HAL_IMPLEMENTS_COUNTERS || defined(__DOXYGEN__)
+static VirtualTimer bmk10_vt[BMK10_TIMERS];
+
+static void bmk10_printns(halrtcnt_t cnt) {
+
+  test_printn((uint32_t)(((uint64_t)cnt * 1000000000ULL) /
+                         halGetCounterFrequency()));
+  test_print(" nS");
+}
+
+static void bmk10_worst_case(void) {
+  uint32_t seed = 0x12345678;
+  unsigned i, n;
+
+  for (n = 1; n <= BMK10_TIMERS; n <<= 1) {
+    halrtcnt_t set = 0, reset = 0, start, cnt;
+
+    for (i = 0; i < n; i++) {
+      /* Delays between 1 and 10 seconds, none expires during the test.*/
+      seed = seed * 1103515245UL + 12345UL;
+      chSysLock();
+      start = halGetCounterValue();
+      chVTSetI(&bmk10_vt[i], S2ST(1) + (systime_t)((seed >> 8) % S2ST(9)),
+               tmo, NULL);
+      cnt = halGetCounterValue() - start;
+      chSysUnlock();
+      if (cnt > set)
+        set = cnt;
+    }
+    for (i = 0; i < n; i++) {
+      chSysLock();
+      start = halGetCounterValue();
+      chVTResetI(&bmk10_vt[i]);
+      cnt = halGetCounterValue() - start;
+      chSysUnlock();
+      if (cnt > reset)
+        reset = cnt;
+    }
+    test_print("--- Timers: ");
+    test_printn(n);
+    test_print(", worst set ");
+    bmk10_printns(set);
+    test_print(", worst reset ");
+    bmk10_printns(reset);
+    test_println("");
+  }
+}
+#endif /* HAL_IMPLEMENTS_COUNTERS */
+
 static void bmk10_execute(void) {
   static VirtualTimer vt1, vt2;
   uint32_t n = 0;
@@ -522,6 +589,9 @@ static void bmk10_execute(void) {
   test_print("--- Score : ");
   test_printn(n * 2);
   test_println(" timers/S");
+#if HAL_IMPLEMENTS_COUNTERS
+  bmk10_worst_case();
+#endif
 }
 
 ROMCONST struct testcase testbmk10 = {
@@ -691,6 +761,139 @@ ROMCONST struct testcase testbmk13 = {
   bmk13_execute
 };
 
+/**
+ * @page test_benchmarks_014 Ready list insertion performance
+ *
+ * <h2>Description</h2>
+ * Up to sixteen threads with decreasing priorities are inserted in the ready
+ * list and then removed from it, each insertion happens behind all the
+ * threads already inserted. The threads are never executed, their structures
+ * are placed in the test buffer. The operation is performed into a
+ * continuous loop.<br>
+ * The performance is calculated by measuring the number of iterations after
+ * a second of continuous operations, the score depends on the setting of
+ * the @p CH_USE_READYLIST_BITMAP option.
+ */
+
+#define BMK14_THREADS   ((sizeof(union test_buffers) / sizeof(Thread)) < 16 ?  \
+                         (sizeof(union test_buffers) / sizeof(Thread)) : 16)
+
+static void bmk14_execute(void) {
+  Thread *rl = (Thread *)test.buffer;
+  uint32_t n = 0;
+  unsigned i;
+
+  for (i = 0; i < BMK14_THREADS; i++) {
+    rl[i].p_prio = chThdGetPriority() - 1 - i;
+    rl[i].p_state = THD_STATE_SUSPENDED;
+  }
+  test_wait_tick();
+  test_start_timer(1000);
+  do {
+    chSysLock();
+    for (i = 0; i < BMK14_THREADS; i++)
+      chSchReadyI(&rl[i]);
+    for (i = 0; i < BMK14_THREADS; i++) {
+      chSchDequeueI(&rl[i], rl[i].p_prio);
+      rl[i].p_state = THD_STATE_SUSPENDED;
+    }
+    chSysUnlock();
+    n++;
+#if defined(SIMULATOR)
+    ChkIntSources();
+#endif
+  } while (!test_timer_done);
+#if CH_USE_READYLIST_BITMAP
+  test_print("--- Bitmap: ");
+#else
+  test_print("--- Linear: ");
+#endif
+  test_printn(BMK14_THREADS);
+  test_println(" threads");
+  test_print("--- Score : ");
+  test_printn(n * BMK14_THREADS);
+  test_println(" insertions/S");
+}
+
+ROMCONST struct testcase testbmk14 = {
+  "Benchmark, ready list insertion",
+  NULL,
+  NULL,
+  bmk14_execute
+};
+
+#if CH_USE_QUEUES || defined(__DOXYGEN__)
+/**
+ * @page test_benchmarks_015 I/O Queues bulk transfers throughput
+ *
+ * <h2>Description</h2>
+ * Blocks of data are read from an @p InputQueue using @p chIQReadTimeout()
+ * and then written into an @p OutputQueue using @p chOQWriteTimeout() into
+ * a continuous loop. The queues notification callbacks simulate a lower
+ * driver instantly refilling the input queue and draining the output
+ * queue.<br>
+ * The performance is calculated by measuring the number of bytes transferred
+ * after a second of continuous operations, the test is repeated for 1, 64
+ * and 512 bytes transfers, the score depends on the setting of the
+ * @p CH_QUEUES_CHUNK_SIZE option.
+ */
+
+#define BMK15_QSIZE     128
+#define BMK15_MAXSIZE   512
+
+static void bmk15_refill(GenericQueue *qp) {
+
+  if (chIQIsEmptyI(qp)) {
+    qp->q_rdptr = qp->q_wrptr = qp->q_buffer;
+    qp->q_counter = chQSizeI(qp);
+  }
+}
+
+static void bmk15_drain(GenericQueue *qp) {
+
+  chOQResetI(qp);
+}
+
+static void bmk15_execute(void) {
+  static const size_t sizes[] = {1, 64, BMK15_MAXSIZE};
+  static InputQueue iq;
+  static OutputQueue oq;
+  uint8_t *ib = test.buffer;
+  uint8_t *ob = ib + BMK15_QSIZE;
+  uint8_t *bp = ob + BMK15_QSIZE;
+  unsigned i;
+
+  chIQInit(&iq, ib, BMK15_QSIZE, bmk15_refill, NULL);
+  chOQInit(&oq, ob, BMK15_QSIZE, bmk15_drain, NULL);
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    uint32_t n = 0;
+
+    test_wait_tick();
+    test_start_timer(1000);
+    do {
+      (void)chIQReadTimeout(&iq, bp, sizes[i], TIME_IMMEDIATE);
+      (void)chOQWriteTimeout(&oq, bp, sizes[i], TIME_IMMEDIATE);
+      n++;
+#if defined(SIMULATOR)
+      ChkIntSources();
+#endif
+    } while (!test_timer_done);
+    test_print("--- Size  : ");
+    test_printn(sizes[i]);
+    test_print(" bytes, score : ");
+    test_printn(n * sizes[i]);
+    test_println(" bytes/S");
+  }
+}
+
+ROMCONST struct testcase testbmk15 = {
+  "Benchmark, I/O Queues bulk throughput",
+  NULL,
+  NULL,
+  bmk15_execute
+};
+#endif /* CH_USE_QUEUES */
+
 /**
  * @brief   Test sequence for benchmarks.
  */
@@ -715,6 +918,10 @@ ROMCONST struct testcase * ROMCONST patternbmk[] = {
   &testbmk12,
 #endif
   &testbmk13,
+  &testbmk14,
+#if CH_USE_QUEUES || defined(__DOXYGEN__)
+  &testbmk15,
+#endif
 #endif
   NULL
 };
@@ -69,6 +69,7 @@ static void heap1_setup(void) {
 static void heap1_execute(void) {
   void *p1, *p2, *p3;
   size_t n, sz;
+  HeapStatus hs;
 
   /* Unrelated, for coverage only.*/
   (void)chCoreStatus();
@@ -137,6 +138,9 @@ static void heap1_execute(void) {
 
   test_assert(11, chHeapStatus(&test_heap, &n) == 1, "heap fragmented");
   test_assert(12, n == sz, "size changed");
+  test_assert(13, (chHeapGetStatus(&test_heap, &hs) == 1) &&
+                  (hs.hs_free == sz) && (hs.hs_largest == sz),
+                  "invalid status");
 }
 
 ROMCONST struct testcase testheap1 = {
@@ -146,6 +150,57 @@ ROMCONST struct testcase testheap1 = {
   heap1_execute
 };
 
+#if (CH_USE_HEAP_TLSF && (HEAP_TLSF_MAX_LOG2 <= 16)) || defined(__DOXYGEN__)
+/**
+ * @page test_heap_002 TLSF largest size class test
+ *
+ * <h2>Description</h2>
+ * A heap is initialized with a single free block whose size is exactly
+ * 2^HEAP_TLSF_MAX_LOG2 bytes, the first size in the last size class. The
+ * block is allocated and released and the heap status is checked after
+ * each step.<br>
+ * The test requires a test buffer larger than 2^HEAP_TLSF_MAX_LOG2 bytes.
+ */
+
+#define TLSF_TOP_SIZE ((size_t)1 << HEAP_TLSF_MAX_LOG2)
+#define TLSF_TOP_HEAP (TLSF_TOP_SIZE + 2 * sizeof(union heap_header))
+
+static void heap2_execute(void) {
+  void *p1;
+  size_t n;
+  HeapStatus hs;
+
+  test_assert(1, sizeof(union test_buffers) >= TLSF_TOP_HEAP,
+              "test buffer too small");
+  chHeapInit(&test_heap, test.buffer, TLSF_TOP_HEAP);
+
+  test_assert(2, (chHeapGetStatus(&test_heap, &hs) == 1) &&
+                 (hs.hs_free == TLSF_TOP_SIZE) &&
+                 (hs.hs_largest == TLSF_TOP_SIZE), "invalid status");
+
+  p1 = chHeapAlloc(&test_heap, TLSF_TOP_SIZE);
+  test_assert(3, p1 != NULL, "allocation failed");
+  test_assert(4, chHeapStatus(&test_heap, &n) == 0, "not empty");
+  chHeapFree(p1);
+  test_assert(5, (chHeapStatus(&test_heap, &n) == 1) &&
+                 (n == TLSF_TOP_SIZE), "heap fragmented");
+
+  /* Splitting the block moves the remaining part in a lower class.*/
+  p1 = chHeapAlloc(&test_heap, SIZE);
+  test_assert(6, p1 != NULL, "allocation failed");
+  chHeapFree(p1);
+  test_assert(7, (chHeapStatus(&test_heap, &n) == 1) &&
+                 (n == TLSF_TOP_SIZE), "heap fragmented");
+}
+
+ROMCONST struct testcase testheap2 = {
+  "Heap, TLSF largest size class",
+  NULL,
+  NULL,
+  heap2_execute
+};
+#endif /* CH_USE_HEAP_TLSF && (HEAP_TLSF_MAX_LOG2 <= 16) */
+
 #endif /* CH_USE_HEAP.*/
 
 /**
@@ -154,6 +209,10 @@ ROMCONST struct testcase testheap1 = {
 ROMCONST struct testcase * ROMCONST patternheap[] = {
 #if (CH_USE_HEAP && !CH_USE_MALLOC_HEAP) || defined(__DOXYGEN__)
   &testheap1,
+#endif
+#if (CH_USE_HEAP && !CH_USE_MALLOC_HEAP && CH_USE_HEAP_TLSF &&              \
+     (HEAP_TLSF_MAX_LOG2 <= 16)) || defined(__DOXYGEN__)
+  &testheap2,
 #endif
   NULL
 };
@@ -32,12 +32,14 @@
  * <h2>Preconditions</h2>
  * The module requires the following kernel options:
  * - @p CH_USE_MESSAGES
+ * - @p CH_USE_MESSAGES_ASYNC
  * .
  * In case some of the required options are not enabled then some or all tests
  * may be skipped.
  *
  * <h2>Test Cases</h2>
  * - @subpage test_msg_001
+ * - @subpage test_msg_002
  * .
  * @file testmsg.c
  * @brief Messages test source file
@@ -95,6 +97,85 @@ ROMCONST struct testcase testmsg1 = {
   msg1_execute
 };
 
+#if CH_USE_MESSAGES_ASYNC || defined(__DOXYGEN__)
+/**
+ * @page test_msg_002 Asynchronous messages
+ *
+ * <h2>Description</h2>
+ * Three messages are sent asynchronously to a lower priority server thread,
+ * the answers are then collected by waiting, polling and by event.<br>
+ * The test expects the sender to not be blocked by the send operations and
+ * the server to answer the messages in order.
+ */
+
+static msg_t server(void *p) {
+  Thread *tp;
+  msg_t msg;
+
+  (void)p;
+  do {
+    tp = chMsgWait();
+    msg = chMsgGet(tp);
+    if (msg)
+      test_emit_token(msg);
+    chMsgRelease(tp, msg + 1);
+  } while (msg);
+  return 0;
+}
+
+static void msg2_execute(void) {
+  static MsgRequest mr[3];
+  Thread *tp;
+
+  tp = chThdCreateStatic(wa[0], WA_SIZE, chThdGetPriority() - 1,
+                         server, NULL);
+  threads[0] = tp;
+
+  /*
+   * Sending without waiting, the server has lower priority so no message
+   * is handled yet.
+   */
+  chMsgSendAsync(tp, &mr[0], 'A', 0);
+  chMsgSendAsync(tp, &mr[1], 'B', 0);
+  chMsgSendAsync(tp, &mr[2], 'C', EVENT_MASK(0));
+  test_assert_lock(1, !chMsgIsAnsweredI(&mr[0]) &&
+                      !chMsgIsAnsweredI(&mr[1]) &&
+                      !chMsgIsAnsweredI(&mr[2]), "already answered");
+  test_assert(2, chMsgWaitAnswer(&mr[0], TIME_IMMEDIATE) == RDY_TIMEOUT,
+              "not timed out");
+
+  /*
+   * Collecting the answers.
+   */
+  test_assert(3, chMsgWaitAnswer(&mr[0], TIME_INFINITE) == 'A' + 1,
+              "wrong answer");
+#if CH_USE_EVENTS
+  test_assert(4, chEvtWaitAnyTimeout(EVENT_MASK(0), TIME_INFINITE) ==
+                 EVENT_MASK(0), "no event");
+#else
+  test_assert(4, chMsgWaitAnswer(&mr[2], TIME_INFINITE) == 'C' + 1,
+              "wrong answer");
+#endif
+  test_assert_lock(5, chMsgIsAnsweredI(&mr[1]) &&
+                      chMsgIsAnsweredI(&mr[2]), "not answered");
+  test_assert(6, (chMsgGetAnswer(&mr[1]) == 'B' + 1) &&
+                 (chMsgGetAnswer(&mr[2]) == 'C' + 1), "wrong answer");
+  test_assert_sequence(7, "ABC");
+
+  /*
+   * Terminating the server using a synchronous message.
+   */
+  test_assert(8, chMsgSend(tp, 0) == 1, "wrong answer");
+}
+
+ROMCONST struct testcase testmsg2 = {
+  "Messages, asynchronous send",
+  NULL,
+  NULL,
+  msg2_execute
+};
+#endif /* CH_USE_MESSAGES_ASYNC */
+
 #endif /* CH_USE_MESSAGES */
 
 /**
@@ -103,6 +184,9 @@ ROMCONST struct testcase testmsg1 = {
 ROMCONST struct testcase * ROMCONST patternmsg[] = {
 #if CH_USE_MESSAGES || defined(__DOXYGEN__)
   &testmsg1,
+#endif
+#if CH_USE_MESSAGES_ASYNC || defined(__DOXYGEN__)
+  &testmsg2,
 #endif
   NULL
 };
@@ -58,7 +58,7 @@
 
 #if CH_USE_MUTEXES || defined(__DOXYGEN__)
 
-#define ALLOWED_DELAY 5
+#define ALLOWED_DELAY MS2ST(5)
 
 /*
  * Note, the static initializers are not really required because the
@@ -31,12 +31,14 @@
  * <h2>Preconditions</h2>
  * The module requires the following kernel options:
  * - @p CH_USE_MEMPOOLS
+ * - @p CH_USE_SLABS
  * .
  * In case some of the required options are not enabled then some or all tests
  * may be skipped.
  *
  * <h2>Test Cases</h2>
  * - @subpage test_pools_001
+ * - @subpage test_pools_002
  * .
  * @file testpools.c
  * @brief Memory Pools test source file
@@ -104,6 +106,75 @@ ROMCONST struct testcase testpools1 = {
   pools1_execute
 };
 
+#if CH_USE_SLABS || defined(__DOXYGEN__)
+/**
+ * @page test_pools_002 Slab allocator test
+ *
+ * <h2>Description</h2>
+ * A slab allocator with two size classes is exhausted then released.<br>
+ * The test expects the requests to be routed to the smallest fitting
+ * class, to the larger class when the smallest is empty and the classes
+ * counters and high water marks to be updated accordingly.
+ */
+
+static SlabAllocator sa1;
+static SlabClass sc16, sc64;
+static SLAB_BUFFER_DECL(sb16, 16, 4);
+static SLAB_BUFFER_DECL(sb64, 64, 2);
+
+static void pools2_setup(void) {
+
+  chSlabInit(&sa1);
+  chSlabClassInit(&sc64, 64, sb64, 2);
+  chSlabClassInit(&sc16, 16, sb16, 4);
+  chSlabAddClass(&sa1, &sc64);
+  chSlabAddClass(&sa1, &sc16);
+}
+
+static void pools2_execute(void) {
+  void *p[6];
+  int i;
+
+  /* Exhausting the small class.*/
+  for (i = 0; i < 4; i++)
+    p[i] = chSlabAlloc(&sa1, 16 - i);
+  test_assert(1, (p[0] != NULL) && (p[1] != NULL) &&
+                 (p[2] != NULL) && (p[3] != NULL), "allocation failed");
+  test_assert(2, (chSlabGetUsed(&sc16) == 4) && (chSlabGetUsed(&sc64) == 0),
+              "wrong class");
+
+  /* Small requests now routed to the large class.*/
+  p[4] = chSlabAlloc(&sa1, 1);
+  p[5] = chSlabAlloc(&sa1, 64);
+  test_assert(3, (p[4] != NULL) && (p[5] != NULL), "allocation failed");
+  test_assert(4, chSlabGetUsed(&sc64) == 2, "wrong class");
+
+  /* Everything allocated or too large.*/
+  test_assert(5, chSlabAlloc(&sa1, 1) == NULL, "not empty");
+  test_assert(6, chSlabAlloc(&sa1, 65) == NULL, "oversized allocation");
+
+  /* Releasing, the high water marks must remain.*/
+  for (i = 0; i < 6; i++)
+    chSlabFree(p[i]);
+  test_assert(7, (chSlabGetUsed(&sc16) == 0) && (chSlabGetUsed(&sc64) == 0),
+              "objects still allocated");
+  test_assert(8, (chSlabGetHighWater(&sc16) == 4) &&
+                 (chSlabGetHighWater(&sc64) == 2), "wrong high water mark");
+
+  /* Objects are reusable.*/
+  p[0] = chSlabAlloc(&sa1, 64);
+  test_assert(9, p[0] != NULL, "allocation failed");
+  chSlabFree(p[0]);
+}
+
+ROMCONST struct testcase testpools2 = {
+  "Memory Pools, slab allocator",
+  pools2_setup,
+  NULL,
+  pools2_execute
+};
+#endif /* CH_USE_SLABS */
+
 #endif /* CH_USE_MEMPOOLS */
 
 /*
@@ -112,6 +183,9 @@ ROMCONST struct testcase testpools1 = {
 ROMCONST struct testcase * ROMCONST patternpools[] = {
 #if CH_USE_MEMPOOLS || defined(__DOXYGEN__)
   &testpools1,
+#endif
+#if CH_USE_SLABS || defined(__DOXYGEN__)
+  &testpools2,
 #endif
   NULL
 };
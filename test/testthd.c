@@ -40,6 +40,7 @@
  * - @subpage test_threads_002
  * - @subpage test_threads_003
  * - @subpage test_threads_004
+ * - @subpage test_threads_005
  * .
  * @file testthd.c
  * @brief Threads and Scheduler test source file
@@ -47,6 +48,17 @@
  * @brief Threads and Scheduler test header file
  */
 
+/*
+ * In tick-less mode the alarms are never programmed closer than
+ * CH_TIMEDELTA ticks and the counter keeps running during the wakeup,
+ * the delays window is widened accordingly.
+ */
+#if CH_TIMEDELTA > 0
+#define ALLOWED_DELAY (CH_TIMEDELTA + 1)
+#else
+#define ALLOWED_DELAY 1
+#endif
+
 /**
  * @page test_threads_001 Ready List functionality #1
  *
@@ -194,22 +206,22 @@ static void thd4_execute(void) {
   /* Timeouts in microseconds.*/
   time = chTimeNow();
   chThdSleepMicroseconds(100000);
-  test_assert_time_window(1, time + US2ST(100000), time + US2ST(100000) + 1);
+  test_assert_time_window(1, time + US2ST(100000), time + US2ST(100000) + ALLOWED_DELAY);
 
   /* Timeouts in milliseconds.*/
   time = chTimeNow();
   chThdSleepMilliseconds(100);
-  test_assert_time_window(2, time + MS2ST(100), time + MS2ST(100) + 1);
+  test_assert_time_window(2, time + MS2ST(100), time + MS2ST(100) + ALLOWED_DELAY);
 
   /* Timeouts in seconds.*/
   time = chTimeNow();
   chThdSleepSeconds(1);
-  test_assert_time_window(3, time + S2ST(1), time + S2ST(1) + 1);
+  test_assert_time_window(3, time + S2ST(1), time + S2ST(1) + ALLOWED_DELAY);
 
   /* Absolute timelines.*/
   time = chTimeNow() + MS2ST(100);
   chThdSleepUntil(time);
-  test_assert_time_window(4, time, time + 1);
+  test_assert_time_window(4, time, time + ALLOWED_DELAY);
 }
 
 ROMCONST struct testcase testthd4 = {
@@ -219,6 +231,97 @@ ROMCONST struct testcase testthd4 = {
   thd4_execute
 };
 
+#if (CH_DBG_THREADS_STATISTICS && CH_USE_REGISTRY) || defined(__DOXYGEN__)
+/**
+ * @page test_threads_005 Threads statistics
+ *
+ * <h2>Description</h2>
+ * A thread is created with higher priority, it sleeps for one tick and
+ * then terminates, the statistics are expected to report exactly two
+ * switches and a stack usage within the stack size. The statistics of the
+ * current thread are then reset and verified to count the switches from
+ * the reset point.<br>
+ * A waiting thread with higher priority is then signaled and preempts the
+ * current thread after a busy loop, the latency of the preempted thread is
+ * expected to be shorter than the busy loop.
+ */
+
+static Semaphore sem5;
+
+static msg_t thread5(void *p) {
+
+  chThdSleep(1);
+  test_emit_token(*(char *)p);
+  return 0;
+}
+
+static msg_t thread5b(void *p) {
+
+  chSemWait(&sem5);
+  test_emit_token(*(char *)p);
+  return 0;
+}
+
+static void thd5_execute(void) {
+  ThreadStats ts;
+  Thread *tp;
+  uint32_t start, spin;
+
+  /* The thread structure is still accessible after the thread termination
+     because the working area is static.*/
+  tp = threads[0] = chThdCreateStatic(wa[0], WA_SIZE, chThdGetPriority()+1,
+                                      thread5, "A");
+  chRegGetThreadStats(tp, &ts);
+  test_assert(1, ts.ts_switches == 1, "wrong switches count");
+  test_assert(2, ts.ts_stksize == WA_SIZE - sizeof(Thread),
+              "wrong stack size");
+#if CH_DBG_FILL_THREADS
+  test_assert(3, (chRegGetStackHighWater(tp) > 0) &&
+                 (chRegGetStackHighWater(tp) <= ts.ts_stksize),
+              "stack high-water out of range");
+#endif
+  test_wait_threads();
+  test_assert_sequence(4, "A");
+  chRegGetThreadStats(tp, &ts);
+  test_assert(5, ts.ts_switches == 2, "wrong switches count");
+
+  chRegResetThreadStats(chThdSelf());
+  chRegGetThreadStats(chThdSelf(), &ts);
+  test_assert(6, ts.ts_switches == 0, "statistics not reset");
+  test_assert(7, ts.ts_maxlatency == 0, "statistics not reset");
+  chThdSleep(1);
+  chRegGetThreadStats(chThdSelf(), &ts);
+  test_assert(8, ts.ts_switches == 1, "wrong switches count");
+
+  /* Preemption, the time spent running before being preempted must not be
+     accounted as ready latency.*/
+  chSemInit(&sem5, 0);
+  threads[0] = chThdCreateStatic(wa[0], WA_SIZE, chThdGetPriority()+1,
+                                 thread5b, "B");
+  chRegResetThreadStats(chThdSelf());
+  start = port_rt_get_counter_value();
+  do {
+    spin = port_rt_get_counter_value() - start;
+  } while (spin < 100000);
+  chSysLock();
+  chSemSignalI(&sem5);
+  chSchRescheduleS();
+  chSysUnlock();
+  test_wait_threads();
+  test_assert_sequence(9, "B");
+  chRegGetThreadStats(chThdSelf(), &ts);
+  test_assert(10, ts.ts_switches >= 1, "wrong switches count");
+  test_assert(11, ts.ts_maxlatency < spin, "run time accounted as latency");
+}
+
+ROMCONST struct testcase testthd5 = {
+  "Threads, statistics",
+  NULL,
+  NULL,
+  thd5_execute
+};
+#endif /* CH_DBG_THREADS_STATISTICS && CH_USE_REGISTRY */
+
 /**
  * @brief   Test sequence for threads.
  */
@@ -227,5 +330,8 @@ ROMCONST struct testcase * ROMCONST patternthd[] = {
   &testthd2,
   &testthd3,
   &testthd4,
+#if CH_DBG_THREADS_STATISTICS && CH_USE_REGISTRY
+  &testthd5,
+#endif
   NULL
 };
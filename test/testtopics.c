@@ -0,0 +1,275 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "ch.h"
+#include "test.h"
+
+/**
+ * @page test_topics Topics test
+ *
+ * File: @ref testtopics.c
+ *
+ * <h2>Description</h2>
+ * This module implements the test sequence for the @ref topics subsystem.
+ *
+ * <h2>Objective</h2>
+ * Objective of the test module is to cover 100% of the @ref topics
+ * subsystem code.<br>
+ * Note that the @ref topics subsystem depends on the @ref pools,
+ * @ref mailboxes and @ref events subsystems that have to met their testing
+ * objectives as well.
+ *
+ * <h2>Preconditions</h2>
+ * The module requires the following kernel options:
+ * - @p CH_USE_TOPICS
+ * .
+ * In case some of the required options are not enabled then some or all tests
+ * may be skipped.
+ *
+ * <h2>Test Cases</h2>
+ * - @subpage test_topics_001
+ * - @subpage test_topics_002
+ * - @subpage test_topics_003
+ * .
+ * @file testtopics.c
+ * @brief Topics test source file
+ * @file testtopics.h
+ * @brief Topics test header file
+ */
+
+#if CH_USE_TOPICS || defined(__DOXYGEN__)
+
+#define TOPIC_BUFFERS   4
+#define QUEUE_SIZE      2
+
+static Topic t1;
+static TopicSubscriber ts1, ts2;
+static TOPIC_BUFFER_DECL(tb1, uint32_t, TOPIC_BUFFERS);
+static msg_t qb1[QUEUE_SIZE], qb2[QUEUE_SIZE];
+
+static void topics_setup(void) {
+
+  chTopicInit(&t1, sizeof(uint32_t), tb1, TOPIC_BUFFERS);
+}
+
+static void publish(uint32_t value) {
+  uint32_t *p = chTopicBorrow(&t1);
+
+  *p = value;
+  chTopicPublish(p);
+}
+
+/**
+ * @page test_topics_001 Fan-out and overflow policies
+ *
+ * <h2>Description</h2>
+ * Messages are published to a topic with two subscribers using different
+ * overflow policies, the subscribers queues are overflown.<br>
+ * The test expects the subscribers to receive the same buffers, the
+ * proper messages to be dropped for each subscriber and all the buffers
+ * to be returned to the topic once released.
+ */
+
+static void topics1_execute(void) {
+  uint32_t *p1, *p2, *p[TOPIC_BUFFERS];
+  unsigned i;
+
+  /*
+   * Publishing without subscribers, the buffer is returned immediately.
+   */
+  for (i = 0; i < TOPIC_BUFFERS + 1; i++)
+    publish(i);
+
+  chTopicSubscribe(&t1, &ts1, qb1, QUEUE_SIZE, TOPIC_DROP_OLDEST);
+  chTopicSubscribe(&t1, &ts2, qb2, QUEUE_SIZE, TOPIC_DROP_NEWEST);
+
+  /*
+   * Three messages into queues of two.
+   */
+  publish(1);
+  publish(2);
+  publish(3);
+  test_assert_lock(1, (chTopicGetPendingI(&ts1) == QUEUE_SIZE) &&
+                      (chTopicGetPendingI(&ts2) == QUEUE_SIZE),
+                   "wrong queued messages");
+  test_assert_lock(2, (chTopicGetDroppedI(&ts1) == 1) &&
+                      (chTopicGetDroppedI(&ts2) == 1),
+                   "wrong dropped messages");
+
+  /*
+   * Oldest dropped for the first subscriber, newest for the second.
+   */
+  p1 = chTopicReceive(&ts1, TIME_IMMEDIATE);
+  p2 = chTopicReceive(&ts2, TIME_IMMEDIATE);
+  test_assert(3, (p1 != NULL) && (*p1 == 2), "wrong message");
+  test_assert(4, (p2 != NULL) && (*p2 == 1), "wrong message");
+  chTopicRelease(p1);
+  chTopicRelease(p2);
+
+  /*
+   * Same buffer delivered to both subscribers.
+   */
+  p2 = chTopicReceive(&ts2, TIME_IMMEDIATE);
+  test_assert(5, (p2 != NULL) && (*p2 == 2), "wrong message");
+  test_assert(6, p1 == p2, "message copied");
+  chTopicRelease(p2);
+  test_assert(7, chTopicReceive(&ts2, TIME_IMMEDIATE) == NULL, "not empty");
+
+  /*
+   * Pending messages released on unsubscribe.
+   */
+  chTopicUnsubscribe(&ts1);
+  chTopicUnsubscribe(&ts2);
+  for (i = 0; i < TOPIC_BUFFERS; i++) {
+    p[i] = chTopicBorrow(&t1);
+    test_assert(8, p[i] != NULL, "buffer not returned");
+  }
+  test_assert(9, chTopicBorrow(&t1) == NULL, "too many buffers");
+  for (i = 0; i < TOPIC_BUFFERS; i++)
+    chTopicRelease(p[i]);
+}
+
+ROMCONST struct testcase testtopics1 = {
+  "Topics, fan-out and overflow policies",
+  topics_setup,
+  NULL,
+  topics1_execute
+};
+
+/**
+ * @page test_topics_002 Waiting subscriber
+ *
+ * <h2>Description</h2>
+ * A thread waits on a subscriber queue while messages are published, the
+ * messages carry the tokens emitted by the thread.<br>
+ * The test expects the thread to receive the messages in order and all the
+ * buffers to be returned to the topic.
+ */
+
+static msg_t thread(void *p) {
+  unsigned i;
+
+  (void)p;
+  for (i = 0; i < 3; i++) {
+    uint32_t *msgp = chTopicReceive(&ts1, TIME_INFINITE);
+    test_emit_token((char)*msgp);
+    chTopicRelease(msgp);
+  }
+  return 0;
+}
+
+static void topics2_execute(void) {
+  void *p[TOPIC_BUFFERS];
+  unsigned i;
+
+  chTopicSubscribe(&t1, &ts1, qb1, QUEUE_SIZE, TOPIC_DROP_NEWEST);
+  threads[0] = chThdCreateStatic(wa[0], WA_SIZE, chThdGetPriority() + 1,
+                                 thread, NULL);
+  publish('A');
+  publish('B');
+  publish('C');
+  test_wait_threads();
+  test_assert_sequence(1, "ABC");
+  chTopicUnsubscribe(&ts1);
+
+  for (i = 0; i < TOPIC_BUFFERS; i++) {
+    p[i] = chTopicBorrow(&t1);
+    test_assert(2, p[i] != NULL, "buffer not returned");
+  }
+  for (i = 0; i < TOPIC_BUFFERS; i++)
+    chTopicRelease(p[i]);
+}
+
+ROMCONST struct testcase testtopics2 = {
+  "Topics, waiting subscriber",
+  topics_setup,
+  NULL,
+  topics2_execute
+};
+
+/**
+ * @page test_topics_003 Overflow with a waiting subscriber
+ *
+ * <h2>Description</h2>
+ * A thread waits on a subscriber queue of depth one with the drop oldest
+ * policy, two messages are published before the thread can run so the
+ * first message is already taken when the second one is published.<br>
+ * The test expects the thread to receive the first message, the second
+ * one to be dropped and all the buffers to be returned to the topic.
+ */
+
+static msg_t thread3(void *p) {
+  uint32_t *msgp;
+
+  (void)p;
+  msgp = chTopicReceive(&ts1, TIME_INFINITE);
+  test_emit_token((char)*msgp);
+  chTopicRelease(msgp);
+  return 0;
+}
+
+static void topics3_execute(void) {
+  uint32_t *p1, *p2;
+  void *p[TOPIC_BUFFERS];
+  unsigned i;
+
+  chTopicSubscribe(&t1, &ts1, qb1, 1, TOPIC_DROP_OLDEST);
+  threads[0] = chThdCreateStatic(wa[0], WA_SIZE, chThdGetPriority() + 1,
+                                 thread3, NULL);
+  p1 = chTopicBorrow(&t1);
+  p2 = chTopicBorrow(&t1);
+  *p1 = 'A';
+  *p2 = 'B';
+  chSysLock();
+  chTopicPublishI(p1);
+  chTopicPublishI(p2);
+  chSchRescheduleS();
+  chSysUnlock();
+  test_wait_threads();
+  test_assert_sequence(1, "A");
+  test_assert_lock(2, chTopicGetDroppedI(&ts1) == 1, "wrong dropped messages");
+  test_assert_lock(3, chTopicGetPendingI(&ts1) == 0, "not empty");
+  chTopicUnsubscribe(&ts1);
+
+  for (i = 0; i < TOPIC_BUFFERS; i++) {
+    p[i] = chTopicBorrow(&t1);
+    test_assert(4, p[i] != NULL, "buffer not returned");
+  }
+  test_assert(5, chTopicBorrow(&t1) == NULL, "too many buffers");
+  for (i = 0; i < TOPIC_BUFFERS; i++)
+    chTopicRelease(p[i]);
+}
+
+ROMCONST struct testcase testtopics3 = {
+  "Topics, overflow with a waiting subscriber",
+  topics_setup,
+  NULL,
+  topics3_execute
+};
+
+#endif /* CH_USE_TOPICS */
+
+/**
+ * @brief   Test sequence for topics.
+ */
+ROMCONST struct testcase * ROMCONST patterntopics[] = {
+#if CH_USE_TOPICS || defined(__DOXYGEN__)
+  &testtopics1,
+  &testtopics2,
+  &testtopics3,
+#endif
+  NULL
+};
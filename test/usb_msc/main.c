@@ -0,0 +1,596 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "console.h"
+#include "chprintf.h"
+#include "ramdisk.h"
+#include "usb_msc.h"
+
+/*
+ * The main thread plays the USB host, it moves the data of the transactions
+ * prepared by the mass storage driver through the loopback low level driver
+ * and invokes the endpoint callbacks as the interrupt handlers would.
+ */
+#define EP_IN           1
+#define EP_OUT          2
+#define EP_SIZE         64
+#define DISK_BLOCKS     (8 * 1024)
+#define HOST_BUFFER     (256 * 1024)
+
+static BaseSequentialStream *chp = (BaseSequentialStream *)&CD1;
+
+static USBDriver *usbp = &USBD1;
+static USBMassStorageDriver MSCD1;
+static RamDisk RD1;
+static uint8_t storage[DISK_BLOCKS * 512];
+static uint8_t hbuf[HOST_BUFFER];
+static uint8_t hbuf2[HOST_BUFFER];
+
+static unsigned failures;
+
+#define check(c) {                                                          \
+  if (!(c)) {                                                               \
+    chprintf(chp, "  failed at line %d: %s\r\n", __LINE__, #c);             \
+    failures++;                                                             \
+  }                                                                         \
+}
+
+/*===========================================================================*/
+/* Slow device simulation.                                                   */
+/*===========================================================================*/
+
+/*
+ * Milliseconds spent by the device and by the bus for each 4kB, zero for
+ * memory speed.
+ */
+static unsigned slow_ms;
+static bool_t fail_io;
+
+static struct RamDiskVMT slow_vmt;
+static bool_t (*rd_read)(void *ip, uint32_t startblk, uint8_t *buf,
+                         uint32_t n);
+static bool_t (*rd_write)(void *ip, uint32_t startblk, const uint8_t *buf,
+                          uint32_t n);
+
+static bool_t slow_read(void *ip, uint32_t startblk, uint8_t *buf,
+                        uint32_t n) {
+
+  if ((slow_ms > 0) && (n >= 8))
+    chThdSleepMilliseconds(slow_ms * n / 8);
+  if (fail_io)
+    return CH_FAILED;
+  return rd_read(ip, startblk, buf, n);
+}
+
+static bool_t slow_write(void *ip, uint32_t startblk, const uint8_t *buf,
+                         uint32_t n) {
+
+  if ((slow_ms > 0) && (n >= 8))
+    chThdSleepMilliseconds(slow_ms * n / 8);
+  if (fail_io)
+    return CH_FAILED;
+  return rd_write(ip, startblk, buf, n);
+}
+
+/*===========================================================================*/
+/* Host side.                                                                */
+/*===========================================================================*/
+
+static USBInEndpointState ep1instate;
+static USBOutEndpointState ep2outstate;
+
+static const USBEndpointConfig ep1config = {
+  USB_EP_MODE_TYPE_BULK,
+  NULL,
+  mscDataTransmitted,
+  NULL,
+  EP_SIZE,
+  0,
+  &ep1instate,
+  NULL
+};
+
+static const USBEndpointConfig ep2config = {
+  USB_EP_MODE_TYPE_BULK,
+  NULL,
+  NULL,
+  mscDataReceived,
+  0,
+  EP_SIZE,
+  NULL,
+  &ep2outstate
+};
+
+static const USBConfig usbcfg = {
+  NULL,
+  NULL,
+  mscRequestsHook,
+  NULL
+};
+
+static const USBMassStorageConfig msccfg = {
+  &USBD1,
+  EP_IN,
+  EP_OUT,
+  (BaseBlockDevice *)&RD1
+};
+
+/*
+ * Lets the driver thread run while waiting for a transaction.
+ */
+static void host_wait(void) {
+
+  if (slow_ms > 0)
+    chThdSleepMilliseconds(1);
+  else
+    chThdYield();
+}
+
+/*
+ * Bus time of a transaction.
+ */
+static void host_bus(size_t n) {
+
+  if ((slow_ms > 0) && (n >= 4096))
+    chThdSleepMilliseconds(slow_ms * n / 4096);
+}
+
+/*
+ * One OUT transaction, returns -1 if the endpoint is stalled.
+ */
+static int host_out(const uint8_t *p, size_t n) {
+  USBOutEndpointState *osp = usbp->epc[EP_OUT]->out_state;
+  unsigned spins = 0;
+
+  while (!(usbp->receiving & (1 << EP_OUT))) {
+    if (usbp->stalled_out & (1 << EP_OUT))
+      return -1;
+    host_wait();
+    if (++spins > 1000000) {
+      chprintf(chp, "OUT timeout\r\n");
+      exit(2);
+    }
+  }
+  if (usbp->stalled_out & (1 << EP_OUT))
+    return -1;
+  if (n > osp->rxsize)
+    n = osp->rxsize;
+  host_bus(n);
+  memcpy(osp->mode.linear.rxbuf, p, n);
+  osp->rxcnt = n;
+  chSysLock();
+  _usb_isr_invoke_out_cb(usbp, EP_OUT);
+  chSchRescheduleS();
+  chSysUnlock();
+  return (int)n;
+}
+
+/*
+ * One IN transaction, returns -1 if the endpoint is stalled.
+ */
+static int host_in(uint8_t *p, size_t max) {
+  USBInEndpointState *isp = usbp->epc[EP_IN]->in_state;
+  unsigned spins = 0;
+  size_t n;
+
+  while (!(usbp->transmitting & (1 << EP_IN))) {
+    if (usbp->stalled_in & (1 << EP_IN))
+      return -1;
+    host_wait();
+    if (++spins > 1000000) {
+      chprintf(chp, "IN timeout\r\n");
+      exit(2);
+    }
+  }
+  if (usbp->stalled_in & (1 << EP_IN))
+    return -1;
+  n = isp->txsize;
+  if (n > max) {
+    chprintf(chp, "babble, %d bytes instead of %d\r\n", (int)n, (int)max);
+    exit(2);
+  }
+  host_bus(n);
+  memcpy(p, isp->mode.linear.txbuf, n);
+  isp->txcnt = n;
+  chSysLock();
+  _usb_isr_invoke_in_cb(usbp, EP_IN);
+  chSchRescheduleS();
+  chSysUnlock();
+  return (int)n;
+}
+
+/*
+ * Outcome of a command as seen by the host.
+ */
+typedef struct {
+  uint32_t      residue;
+  uint8_t       status;
+  bool_t        in_stalled;
+  bool_t        out_stalled;
+  uint32_t      moved;
+} result_t;
+
+static uint32_t tag = 1;
+
+/*
+ * Performs a CBW, data and CSW sequence, @p len is the data length
+ * expected by the host.
+ */
+static result_t command(const uint8_t *cb, uint32_t len, bool_t in,
+                        uint8_t *data) {
+  uint8_t cbw[31], csw[64];
+  uint32_t sig, csw_tag;
+  result_t r;
+  int n;
+
+  memset(&r, 0, sizeof r);
+  memset(cbw, 0, sizeof cbw);
+  memcpy(cbw, "USBC", 4);
+  memcpy(cbw + 4, &tag, 4);
+  memcpy(cbw + 8, &len, 4);
+  cbw[12] = in ? 0x80 : 0;
+  cbw[14] = 10;
+  memcpy(cbw + 15, cb, 10);
+  check(host_out(cbw, sizeof cbw) == sizeof cbw);
+
+  while (r.moved < len) {
+    if (in) {
+      n = host_in(data + r.moved, len - r.moved);
+      if (n < 0)
+        break;
+      r.moved += n;
+      /* A short packet ends the data stage.*/
+      if ((n == 0) || ((n % EP_SIZE) != 0))
+        break;
+    }
+    else {
+      n = host_out(data + r.moved, len - r.moved);
+      if (n < 0)
+        break;
+      r.moved += n;
+    }
+  }
+
+  /* Halt conditions are cleared before reading the CSW.*/
+  if (usbp->stalled_in & (1 << EP_IN)) {
+    r.in_stalled = TRUE;
+    usb_lld_clear_in(usbp, EP_IN);
+  }
+  if (usbp->stalled_out & (1 << EP_OUT)) {
+    r.out_stalled = TRUE;
+    usb_lld_clear_out(usbp, EP_OUT);
+  }
+
+  check(host_in(csw, sizeof csw) == MSC_CSW_SIZE);
+  memcpy(&sig, csw, 4);
+  memcpy(&csw_tag, csw + 4, 4);
+  memcpy(&r.residue, csw + 8, 4);
+  r.status = csw[12];
+  check(sig == MSC_CSW_SIGNATURE);
+  check(csw_tag == tag);
+  tag++;
+  return r;
+}
+
+static void cdb_rw10(uint8_t *cb, uint8_t op, uint32_t lba, uint32_t n) {
+
+  memset(cb, 0, 10);
+  cb[0] = op;
+  cb[2] = (uint8_t)(lba >> 24);
+  cb[3] = (uint8_t)(lba >> 16);
+  cb[4] = (uint8_t)(lba >> 8);
+  cb[5] = (uint8_t)lba;
+  cb[7] = (uint8_t)(n >> 8);
+  cb[8] = (uint8_t)n;
+}
+
+static void check_sense(uint8_t key, uint8_t asc) {
+  uint8_t cb[10] = {SCSI_REQUEST_SENSE, 0, 0, 0, 18};
+  result_t r;
+
+  r = command(cb, 18, TRUE, hbuf2);
+  check((r.status == MSC_CSW_STATUS_PASSED) && (r.moved == 18));
+  check((hbuf2[2] == key) && (hbuf2[12] == asc));
+}
+
+/*===========================================================================*/
+/* Test sequences.                                                           */
+/*===========================================================================*/
+
+static void test_commands(void) {
+  uint8_t cb[10];
+  result_t r;
+
+  chprintf(chp, "--- Commands\r\n");
+
+  /* INQUIRY.*/
+  memset(cb, 0, 10);
+  cb[0] = SCSI_INQUIRY;
+  cb[4] = 36;
+  r = command(cb, 36, TRUE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PASSED) && (r.moved == 36) &&
+        (r.residue == 0) && (memcmp(hbuf + 8, "ChibiOS ", 8) == 0));
+
+  /* INQUIRY, the host expects more, a short packet ends the data stage,
+     case 5.*/
+  cb[4] = 96;
+  r = command(cb, 96, TRUE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PASSED) && (r.moved == 36) &&
+        (r.residue == 60) && !r.in_stalled);
+
+  /* INQUIRY, the host expects less than the device sends, phase error,
+     case 7.*/
+  cb[4] = 36;
+  r = command(cb, 18, TRUE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PHASE_ERROR) && (r.moved == 0) &&
+        (r.residue == 18));
+
+  /* TEST UNIT READY.*/
+  memset(cb, 0, 10);
+  r = command(cb, 0, FALSE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PASSED) && (r.residue == 0));
+
+  /* READ CAPACITY(10).*/
+  cb[0] = SCSI_READ_CAPACITY10;
+  r = command(cb, 8, TRUE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PASSED) && (r.moved == 8));
+  check((hbuf[0] == 0) && (hbuf[1] == 0) && (hbuf[2] == 0x1F) &&
+        (hbuf[3] == 0xFF) && (hbuf[6] == 2) && (hbuf[7] == 0));
+
+  /* MODE SENSE(6).*/
+  cb[0] = SCSI_MODE_SENSE6;
+  cb[4] = 192;
+  r = command(cb, 192, TRUE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PASSED) && (r.moved == 4) &&
+        (r.residue == 188) && (hbuf[2] == 0));
+
+  /* Unknown command.*/
+  memset(cb, 0, 10);
+  cb[0] = 0xC7;
+  r = command(cb, 0, FALSE, hbuf);
+  check(r.status == MSC_CSW_STATUS_FAILED);
+  check_sense(SCSI_SENSE_ILLEGAL_REQUEST, SCSI_ASC_INVALID_COMMAND);
+}
+
+static void test_data(void) {
+  uint8_t cb[10];
+  result_t r;
+  unsigned i;
+
+  chprintf(chp, "--- Data transfers\r\n");
+
+  /* READ(10), odd size spanning several buffers.*/
+  cdb_rw10(cb, SCSI_READ10, 3, 37);
+  r = command(cb, 37 * 512, TRUE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PASSED) && (r.moved == 37 * 512) &&
+        (r.residue == 0));
+  check(memcmp(hbuf, storage + 3 * 512, 37 * 512) == 0);
+
+  /* WRITE(10) then compare with the device contents.*/
+  for (i = 0; i < 77 * 512; i++)
+    hbuf[i] = (uint8_t)rand();
+  memcpy(hbuf2, hbuf, 77 * 512);
+  cdb_rw10(cb, SCSI_WRITE10, 100, 77);
+  r = command(cb, 77 * 512, FALSE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PASSED) && (r.moved == 77 * 512) &&
+        (r.residue == 0));
+  check(memcmp(storage + 100 * 512, hbuf2, 77 * 512) == 0);
+  check(MSCD1.blocks_written == 77);
+}
+
+static void test_cases(void) {
+  uint8_t cb[10];
+  result_t r;
+
+  chprintf(chp, "--- Host and device expectations mismatches\r\n");
+
+  /* Hi > Di, full packets then stall, case 5.*/
+  cdb_rw10(cb, SCSI_READ10, 0, 1);
+  r = command(cb, 1024, TRUE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PASSED) && (r.moved == 512) &&
+        r.in_stalled && (r.residue == 512));
+
+  /* Ho > Do, case 11.*/
+  cdb_rw10(cb, SCSI_WRITE10, 0, 1);
+  r = command(cb, 1024, FALSE, hbuf2);
+  check((r.status == MSC_CSW_STATUS_PASSED) && r.out_stalled &&
+        (r.residue == 512));
+
+  /* Hi < Di, case 7.*/
+  cdb_rw10(cb, SCSI_READ10, 0, 4);
+  r = command(cb, 1024, TRUE, hbuf);
+  check(r.status == MSC_CSW_STATUS_PHASE_ERROR);
+
+  /* Ho <> Di, case 10.*/
+  cdb_rw10(cb, SCSI_READ10, 0, 1);
+  r = command(cb, 512, FALSE, hbuf);
+  check((r.status == MSC_CSW_STATUS_PHASE_ERROR) && r.out_stalled);
+}
+
+static void test_errors(void) {
+  uint8_t cb[10];
+  result_t r;
+
+  chprintf(chp, "--- Errors and recovery\r\n");
+
+  /* LBA out of range.*/
+  cdb_rw10(cb, SCSI_READ10, DISK_BLOCKS - 1, 2);
+  r = command(cb, 1024, TRUE, hbuf);
+  check((r.status == MSC_CSW_STATUS_FAILED) && r.in_stalled &&
+        (r.residue == 1024));
+  check_sense(SCSI_SENSE_ILLEGAL_REQUEST, SCSI_ASC_LBA_OUT_OF_RANGE);
+  check_sense(SCSI_SENSE_NO_SENSE, SCSI_ASC_NONE);
+
+  /* Device failure in the middle of a read and of a write.*/
+  fail_io = TRUE;
+  cdb_rw10(cb, SCSI_READ10, 0, 64);
+  r = command(cb, 64 * 512, TRUE, hbuf);
+  check((r.status == MSC_CSW_STATUS_FAILED) && r.in_stalled &&
+        (r.residue == 64 * 512));
+  check_sense(SCSI_SENSE_MEDIUM_ERROR, SCSI_ASC_READ_ERROR);
+  cdb_rw10(cb, SCSI_WRITE10, 0, 64);
+  r = command(cb, 64 * 512, FALSE, hbuf);
+  check((r.status == MSC_CSW_STATUS_FAILED) && r.out_stalled &&
+        (r.residue == 64 * 512 - 2 * MSC_BUFFER_SIZE));
+  check_sense(SCSI_SENSE_MEDIUM_ERROR, SCSI_ASC_WRITE_ERROR);
+  fail_io = FALSE;
+
+  /* Write protection.*/
+  RD1.readonly = TRUE;
+  cdb_rw10(cb, SCSI_WRITE10, 0, 8);
+  r = command(cb, 8 * 512, FALSE, hbuf);
+  check((r.status == MSC_CSW_STATUS_FAILED) && r.out_stalled);
+  check_sense(SCSI_SENSE_DATA_PROTECT, SCSI_ASC_WRITE_PROTECTED);
+  RD1.readonly = FALSE;
+
+  /* Invalid CBW, both endpoints stalled until the reset recovery.*/
+  memset(hbuf, 0, 31);
+  check(host_out(hbuf, 31) == 31);
+  host_wait();
+  host_wait();
+  check((usbp->stalled_in & (1 << EP_IN)) &&
+        (usbp->stalled_out & (1 << EP_OUT)));
+  usbp->setup[0] = 0x21;
+  usbp->setup[1] = MSC_MASS_STORAGE_RESET_COMMAND;
+  check(mscRequestsHook(usbp));
+  host_wait();
+  usb_lld_clear_in(usbp, EP_IN);
+  usb_lld_clear_out(usbp, EP_OUT);
+  memset(cb, 0, 10);
+  r = command(cb, 0, FALSE, hbuf);
+  check(r.status == MSC_CSW_STATUS_PASSED);
+}
+
+/*===========================================================================*/
+/* Throughput.                                                               */
+/*===========================================================================*/
+
+static uint32_t host_us(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/*
+ * Moves @p total blocks using commands of @p n blocks, prints the rate.
+ */
+static void bench(const char *name, uint8_t op, uint32_t total, uint32_t n) {
+  uint32_t lba, start, us, kbs;
+  uint8_t cb[10];
+  result_t r;
+
+  start = host_us();
+  for (lba = 0; lba < total; lba += n) {
+    cdb_rw10(cb, op, lba % DISK_BLOCKS, n);
+    r = command(cb, n * 512, op == SCSI_READ10, hbuf);
+    check((r.status == MSC_CSW_STATUS_PASSED) && (r.residue == 0));
+  }
+  us = host_us() - start;
+  if (us == 0)
+    us = 1;
+  kbs = (uint32_t)((uint64_t)total * 512 * 1000000 / 1024 / us);
+  chprintf(chp, "    %s: %d.%02d MB/s\r\n", name, kbs / 1024,
+           (kbs % 1024) * 100 / 1024);
+}
+
+static void test_throughput(void) {
+
+  chprintf(chp, "--- Throughput, %d blocks commands, memory speed\r\n", 128);
+  bench("READ(10) ", SCSI_READ10, 64 * 1024, 128);
+  bench("WRITE(10)", SCSI_WRITE10, 64 * 1024, 128);
+
+  /* 4ms per 4kB on both the device and the bus, 1MB/s each, 0.5MB/s if
+     the transfers did not overlap.*/
+  chprintf(chp, "--- Throughput, %d blocks commands, 1MB/s device and bus\r\n",
+           128);
+  slow_ms = 4;
+  bench("READ(10) ", SCSI_READ10, 4 * 1024, 128);
+  bench("WRITE(10)", SCSI_WRITE10, 4 * 1024, 128);
+  slow_ms = 0;
+}
+
+/*
+ * Simulator main.
+ */
+int main(int argc, char *argv[]) {
+  unsigned i;
+
+  (void)argc;
+  (void)argv;
+
+  /*
+   * System initializations.
+   * - HAL initialization, this also initializes the configured device drivers
+   *   and performs the board-specific initializations.
+   * - Kernel initialization, the main() function becomes a thread and the
+   *   RTOS is active.
+   */
+  halInit();
+  conInit();
+  chSysInit();
+
+  chprintf(chp, "*** USB mass storage bulk-only transport\r\n");
+  chprintf(chp, "*** Disk blocks: %d\r\n", DISK_BLOCKS);
+  chprintf(chp, "\r\n");
+
+  /*
+   * RAM disk with a known pattern, the device methods are wrapped in order
+   * to simulate a slow or failing device.
+   */
+  for (i = 0; i < sizeof storage; i++)
+    storage[i] = (uint8_t)(i * 7 + (i >> 9));
+  ramdiskObjectInit(&RD1);
+  ramdiskStart(&RD1, storage, 512, DISK_BLOCKS, FALSE);
+  blkConnect(&RD1);
+  slow_vmt = *RD1.vmt;
+  rd_read = slow_vmt.read;
+  rd_write = slow_vmt.write;
+  slow_vmt.read = slow_read;
+  slow_vmt.write = slow_write;
+  RD1.vmt = &slow_vmt;
+
+  /*
+   * The device is configured by hand, there is no enumeration.
+   */
+  usbStart(usbp, &usbcfg);
+  mscObjectInit(&MSCD1);
+  mscStart(&MSCD1, &msccfg);
+  chSysLock();
+  usbp->state = USB_ACTIVE;
+  usbInitEndpointI(usbp, EP_IN, &ep1config);
+  usbInitEndpointI(usbp, EP_OUT, &ep2config);
+  mscConfigureHookI(&MSCD1);
+  chSchRescheduleS();
+  chSysUnlock();
+
+  test_commands();
+  test_data();
+  test_cases();
+  test_errors();
+  test_throughput();
+
+  mscStop(&MSCD1);
+  chprintf(chp, "\r\nFinal result: %s\r\n",
+           failures == 0 ? "SUCCESS" : "FAILURE");
+  exit(failures == 0 ? 0 : 1);
+}
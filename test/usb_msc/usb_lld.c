@@ -0,0 +1,130 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    usb_lld.c
+ * @brief   Loopback USB low level driver code.
+ */
+
+#include "ch.h"
+#include "hal.h"
+
+/**
+ * @brief   USB1 driver identifier.
+ */
+USBDriver USBD1;
+
+void usb_lld_init(void) {
+
+  usbObjectInit(&USBD1);
+}
+
+void usb_lld_start(USBDriver *usbp) {
+
+  (void)usbp;
+}
+
+void usb_lld_stop(USBDriver *usbp) {
+
+  (void)usbp;
+}
+
+void usb_lld_reset(USBDriver *usbp) {
+
+  usbp->stalled_in = 0;
+  usbp->stalled_out = 0;
+}
+
+void usb_lld_set_address(USBDriver *usbp) {
+
+  (void)usbp;
+}
+
+void usb_lld_init_endpoint(USBDriver *usbp, usbep_t ep) {
+
+  (void)usbp;
+  (void)ep;
+}
+
+void usb_lld_disable_endpoints(USBDriver *usbp) {
+
+  (void)usbp;
+}
+
+usbepstatus_t usb_lld_get_status_in(USBDriver *usbp, usbep_t ep) {
+
+  if (usbp->stalled_in & (1 << ep))
+    return EP_STATUS_STALLED;
+  return EP_STATUS_ACTIVE;
+}
+
+usbepstatus_t usb_lld_get_status_out(USBDriver *usbp, usbep_t ep) {
+
+  if (usbp->stalled_out & (1 << ep))
+    return EP_STATUS_STALLED;
+  return EP_STATUS_ACTIVE;
+}
+
+void usb_lld_read_setup(USBDriver *usbp, usbep_t ep, uint8_t *buf) {
+
+  (void)usbp;
+  (void)ep;
+  (void)buf;
+}
+
+void usb_lld_prepare_receive(USBDriver *usbp, usbep_t ep) {
+
+  (void)usbp;
+  (void)ep;
+}
+
+void usb_lld_prepare_transmit(USBDriver *usbp, usbep_t ep) {
+
+  (void)usbp;
+  (void)ep;
+}
+
+void usb_lld_start_out(USBDriver *usbp, usbep_t ep) {
+
+  (void)usbp;
+  (void)ep;
+}
+
+void usb_lld_start_in(USBDriver *usbp, usbep_t ep) {
+
+  (void)usbp;
+  (void)ep;
+}
+
+void usb_lld_stall_out(USBDriver *usbp, usbep_t ep) {
+
+  usbp->stalled_out |= 1 << ep;
+}
+
+void usb_lld_stall_in(USBDriver *usbp, usbep_t ep) {
+
+  usbp->stalled_in |= 1 << ep;
+}
+
+void usb_lld_clear_out(USBDriver *usbp, usbep_t ep) {
+
+  usbp->stalled_out &= ~(1 << ep);
+}
+
+void usb_lld_clear_in(USBDriver *usbp, usbep_t ep) {
+
+  usbp->stalled_in &= ~(1 << ep);
+}
@@ -0,0 +1,182 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    usb_lld.h
+ * @brief   Loopback USB low level driver header.
+ * @details The test application plays the host role, it moves the data of
+ *          the prepared transactions itself and invokes the endpoint
+ *          callbacks as the interrupt handlers would.
+ */
+
+#ifndef _USB_LLD_H_
+#define _USB_LLD_H_
+
+#if HAL_USE_USB || defined(__DOXYGEN__)
+
+/*===========================================================================*/
+/* Driver constants.                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief   Maximum endpoint address.
+ */
+#define USB_MAX_ENDPOINTS                   3
+
+/**
+ * @brief   The address is changed after the status stage.
+ */
+#define USB_SET_ADDRESS_MODE                USB_LATE_SET_ADDRESS
+
+/*===========================================================================*/
+/* Driver data structures and types.                                         */
+/*===========================================================================*/
+
+/**
+ * @brief   Type of an IN endpoint state structure.
+ */
+typedef struct {
+  bool_t                        txqueued;
+  size_t                        txsize;
+  size_t                        txcnt;
+  union {
+    struct {
+      const uint8_t             *txbuf;
+    } linear;
+    struct {
+      OutputQueue               *txqueue;
+    } queue;
+  } mode;
+} USBInEndpointState;
+
+/**
+ * @brief   Type of an OUT endpoint state structure.
+ */
+typedef struct {
+  bool_t                        rxqueued;
+  size_t                        rxsize;
+  size_t                        rxcnt;
+  union {
+    struct {
+      uint8_t                   *rxbuf;
+    } linear;
+    struct {
+      InputQueue                *rxqueue;
+    } queue;
+  } mode;
+} USBOutEndpointState;
+
+/**
+ * @brief   Type of an USB endpoint configuration structure.
+ */
+typedef struct {
+  uint32_t                      ep_mode;
+  usbepcallback_t               setup_cb;
+  usbepcallback_t               in_cb;
+  usbepcallback_t               out_cb;
+  uint16_t                      in_maxsize;
+  uint16_t                      out_maxsize;
+  USBInEndpointState            *in_state;
+  USBOutEndpointState           *out_state;
+} USBEndpointConfig;
+
+/**
+ * @brief   Type of an USB driver configuration structure.
+ */
+typedef struct {
+  usbeventcb_t                  event_cb;
+  usbgetdescriptor_t            get_descriptor_cb;
+  usbreqhandler_t               requests_hook_cb;
+  usbcallback_t                 sof_cb;
+} USBConfig;
+
+/**
+ * @brief   Structure representing an USB driver.
+ */
+struct USBDriver {
+  usbstate_t                    state;
+  const USBConfig               *config;
+  uint16_t                      transmitting;
+  uint16_t                      receiving;
+  const USBEndpointConfig       *epc[USB_MAX_ENDPOINTS + 1];
+  void                          *in_params[USB_MAX_ENDPOINTS];
+  void                          *out_params[USB_MAX_ENDPOINTS];
+  usbep0state_t                 ep0state;
+  uint8_t                       *ep0next;
+  size_t                        ep0n;
+  usbcallback_t                 ep0endcb;
+  uint8_t                       setup[8];
+  uint16_t                      status;
+  uint8_t                       address;
+  uint8_t                       configuration;
+  /* End of the mandatory fields.*/
+  /**
+   * @brief   Stalled IN endpoints mask.
+   */
+  uint16_t                      stalled_in;
+  /**
+   * @brief   Stalled OUT endpoints mask.
+   */
+  uint16_t                      stalled_out;
+};
+
+/*===========================================================================*/
+/* Driver macros.                                                            */
+/*===========================================================================*/
+
+#define usb_lld_get_transaction_size(usbp, ep)                              \
+  ((usbp)->epc[ep]->out_state->rxcnt)
+
+#define usb_lld_connect_bus(usbp)
+
+#define usb_lld_disconnect_bus(usbp)
+
+#define usb_lld_get_frame_number(usbp) 0
+
+/*===========================================================================*/
+/* External declarations.                                                    */
+/*===========================================================================*/
+
+extern USBDriver USBD1;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  void usb_lld_init(void);
+  void usb_lld_start(USBDriver *usbp);
+  void usb_lld_stop(USBDriver *usbp);
+  void usb_lld_reset(USBDriver *usbp);
+  void usb_lld_set_address(USBDriver *usbp);
+  void usb_lld_init_endpoint(USBDriver *usbp, usbep_t ep);
+  void usb_lld_disable_endpoints(USBDriver *usbp);
+  usbepstatus_t usb_lld_get_status_in(USBDriver *usbp, usbep_t ep);
+  usbepstatus_t usb_lld_get_status_out(USBDriver *usbp, usbep_t ep);
+  void usb_lld_read_setup(USBDriver *usbp, usbep_t ep, uint8_t *buf);
+  void usb_lld_prepare_receive(USBDriver *usbp, usbep_t ep);
+  void usb_lld_prepare_transmit(USBDriver *usbp, usbep_t ep);
+  void usb_lld_start_out(USBDriver *usbp, usbep_t ep);
+  void usb_lld_start_in(USBDriver *usbp, usbep_t ep);
+  void usb_lld_stall_out(USBDriver *usbp, usbep_t ep);
+  void usb_lld_stall_in(USBDriver *usbp, usbep_t ep);
+  void usb_lld_clear_out(USBDriver *usbp, usbep_t ep);
+  void usb_lld_clear_in(USBDriver *usbp, usbep_t ep);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_USE_USB */
+
+#endif /* _USB_LLD_H_ */
@@ -190,4 +190,9 @@
    defines how many files can be opened simultaneously. */
 
 
+/* Sectors cache between FatFs and the card driver, see fatfs_cache.h. */
+#define FATFS_USE_CACHE		TRUE
+#define FATFS_CACHE_BLOCKS	16
+#define FATFS_CACHE_WINDOW	8
+
 #endif /* _FFCONFIG */
@@ -256,6 +256,13 @@
 #define SDC_NICE_WAITING            TRUE
 #endif
 
+/**
+ * @brief   Enables the asynchronous transfers API.
+ */
+#if !defined(SDC_USE_ASYNC) || defined(__DOXYGEN__)
+#define SDC_USE_ASYNC               TRUE
+#endif
+
 /**
  * @brief   Write timeout in milliseconds.
  */
@@ -22,6 +22,7 @@
 #include "chprintf.h"
 
 #include "ff.h"
+#include "fatfs_cache.h"
 
 #define SDC_DATA_DESTRUCTIVE_TEST   FALSE
 
@@ -167,6 +168,32 @@ void cmd_sdiotest(BaseSequentialStream *chp, int argc, char *argv[]){
     chprintf(chp, " OK\r\n");
     chThdSleepMilliseconds(100);
 
+#if SDC_USE_ASYNC
+    chprintf(chp, "Asynchronous unaligned reads...");
+    chThdSleepMilliseconds(100);
+    {
+      EventListener el;
+      uint32_t spins = 0;
+
+      chEvtRegisterMask(sdcGetEventSource(&SDCD1), &el, EVENT_MASK(0));
+      for (i=0; i<1000; i++){
+        fillbuffer(0, outbuf);
+        if (sdcStartRead(&SDCD1, 0, outbuf + 1, SDC_BURST_SIZE))
+          chSysHalt();
+        /* work done while the transfer is in progress */
+        while (chEvtGetAndClearEvents(EVENT_MASK(0)) == 0)
+          spins++;
+        if (sdcWaitTransfer(&SDCD1))
+          chSysHalt();
+        if (memcmp(inbuf + 1, outbuf + 1, SDC_BURST_SIZE * MMCSD_BLOCK_SIZE) != 0)
+          chSysHalt();
+      }
+      chEvtUnregister(sdcGetEventSource(&SDCD1), &el);
+      chprintf(chp, " OK, %U loops overlapped\r\n", spins);
+    }
+    chThdSleepMilliseconds(100);
+#endif /* SDC_USE_ASYNC */
+
 #if SDC_DATA_DESTRUCTIVE_TEST
 
     chprintf(chp, "Single aligned write...");
@@ -250,6 +277,9 @@ void cmd_sdiotest(BaseSequentialStream *chp, int argc, char *argv[]){
              "FS: %lu free clusters, %lu sectors per cluster, %lu bytes free\r\n",
              clusters, (uint32_t)SDC_FS.csize,
              clusters * (uint32_t)SDC_FS.csize * (uint32_t)MMCSD_BLOCK_SIZE);
+#if FATFS_USE_CACHE
+    fatfsCachePinMetadata(&SDC_FS);
+#endif
 
 
     chprintf(chp, "Create file \"chtest.txt\"... ");
@@ -311,7 +341,20 @@ void cmd_sdiotest(BaseSequentialStream *chp, int argc, char *argv[]){
 
     chprintf(chp, "Umount filesystem... ");
     f_mount(0, NULL);
+#if FATFS_USE_CACHE
+    if (bcacheStop(&FATFSCache))
+      chSysHalt();
+#endif
     chprintf(chp, "OK\r\n");
+#if FATFS_USE_CACHE
+    chprintf(chp, "Cache: %U hits, %U read-ahead hits, %U misses, "
+                  "%U blocks written in %U writes\r\n",
+             bcacheGetStats(&FATFSCache)->bs_hits,
+             bcacheGetStats(&FATFSCache)->bs_ra_hits,
+             bcacheGetStats(&FATFSCache)->bs_misses,
+             bcacheGetStats(&FATFSCache)->bs_written,
+             bcacheGetStats(&FATFSCache)->bs_writes);
+#endif
 
     chprintf(chp, "Disconnecting from SDIO...");
     chThdSleepMilliseconds(100);
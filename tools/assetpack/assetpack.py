@@ -0,0 +1,256 @@
+#!/usr/bin/env python
+#
+# Asset archive packer.
+#
+# Packs images and palettes into an indexed archive and emits it as a C
+# source and header pair, to be decoded on target by os/various/assets.c.
+# Every asset is compressed with the smallest of the supported codecs.
+#
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = 0x54455341  # 'ASET'
+VERSION = 1
+
+CODEC_STORE, CODEC_RLE, CODEC_LZ4 = range(3)
+CODECS = {'store': CODEC_STORE, 'rle': CODEC_RLE, 'lz4': CODEC_LZ4}
+
+FMT_RAW, FMT_L8, FMT_RGB888, FMT_ARGB8888, FMT_PALETTE = range(5)
+FORMATS = {'raw': (FMT_RAW, 1), 'l8': (FMT_L8, 1),
+           'rgb888': (FMT_RGB888, 3), 'argb8888': (FMT_ARGB8888, 4),
+           'palette': (FMT_PALETTE, 3)}
+
+HEADER = struct.Struct('<IHH')
+ENTRY = struct.Struct('<IIIHHBBH')
+
+# LZ4 block format limits.
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MATCH_LIMIT = 12
+MAX_DISTANCE = 65535
+
+
+def rle_encode(data):
+    """Runs of 3..130 equal bytes: 0x80 + n - 3, byte.
+    Literals of 1..128 bytes: n - 1, bytes."""
+    out = bytearray()
+    lit = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        run = 1
+        while i + run < n and run < 130 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            if lit:
+                out.append(len(lit) - 1)
+                out += lit
+                lit = bytearray()
+            out.append(0x80 + run - 3)
+            out.append(data[i])
+            i += run
+        else:
+            lit.append(data[i])
+            i += 1
+            if len(lit) == 128:
+                out.append(len(lit) - 1)
+                out += lit
+                lit = bytearray()
+    if lit:
+        out.append(len(lit) - 1)
+        out += lit
+    return out
+
+
+def lz4_length(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def lz4_sequence(out, literals, distance, match):
+    lit = len(literals)
+    token = min(lit, 15) << 4
+    if match:
+        token |= min(match - MIN_MATCH, 15)
+    out.append(token)
+    if lit >= 15:
+        lz4_length(out, lit - 15)
+    out += literals
+    if match:
+        out += struct.pack('<H', distance)
+        if match - MIN_MATCH >= 15:
+            lz4_length(out, match - MIN_MATCH - 15)
+
+
+def lz4_encode(data, depth=64):
+    """Greedy LZ4 block compressor with bounded hash chains."""
+    out = bytearray()
+    n = len(data)
+    head = {}
+    chain = [0] * n
+    anchor = 0
+    i = 0
+    limit = n - MATCH_LIMIT
+    while i < limit:
+        key = bytes(data[i:i + MIN_MATCH])
+        best_len = 0
+        best_pos = 0
+        cand = head.get(key, -1)
+        tries = depth
+        while cand >= 0 and i - cand <= MAX_DISTANCE and tries > 0:
+            length = 0
+            end = n - LAST_LITERALS
+            while i + length < end and data[cand + length] == data[i + length]:
+                length += 1
+            if length > best_len:
+                best_len = length
+                best_pos = cand
+            cand = chain[cand]
+            tries -= 1
+        chain[i] = head.get(key, -1)
+        head[key] = i
+        if best_len >= MIN_MATCH:
+            lz4_sequence(out, data[anchor:i], i - best_pos, best_len)
+            for j in range(i + 1, min(i + best_len, limit)):
+                k = bytes(data[j:j + MIN_MATCH])
+                chain[j] = head.get(k, -1)
+                head[k] = j
+            i += best_len
+            anchor = i
+        else:
+            i += 1
+    lz4_sequence(out, data[anchor:], 0, 0)
+    return out
+
+
+def compress(data, codec):
+    candidates = {'store': lambda: data, 'rle': lambda: rle_encode(data),
+                  'lz4': lambda: lz4_encode(data)}
+    names = sorted(CODECS) if codec == 'auto' else [codec]
+    best = None
+    for name in names:
+        packed = candidates[name]()
+        if best is None or len(packed) < len(best[1]):
+            best = (name, packed)
+    return best
+
+
+def gif_palette(data):
+    """Extracts the global color table of a GIF file, as RGB triplets."""
+    if data[:3] != b'GIF' or not bytearray(data)[10] & 0x80:
+        raise ValueError('not a GIF with a global color table')
+    entries = 2 << (bytearray(data)[10] & 7)
+    return bytearray(data[13:13 + 3 * entries]), entries
+
+
+def parse_spec(spec):
+    """NAME=PATH[,fmt=F][,width=W][,height=H][,codec=C]"""
+    name, _, rest = spec.partition('=')
+    fields = rest.split(',')
+    opts = {'path': fields[0], 'fmt': 'raw', 'codec': 'auto'}
+    for field in fields[1:]:
+        key, _, value = field.partition('=')
+        opts[key] = value
+    if not name.replace('_', '').isalnum():
+        raise ValueError('invalid asset name "%s"' % name)
+    if opts['fmt'] not in FORMATS:
+        raise ValueError('unknown format "%s"' % opts['fmt'])
+    if opts['codec'] != 'auto' and opts['codec'] not in CODECS:
+        raise ValueError('unknown codec "%s"' % opts['codec'])
+    return name, opts
+
+
+def load(opts):
+    with open(opts['path'], 'rb') as f:
+        data = f.read()
+    fmt, bpp = FORMATS[opts['fmt']]
+    if fmt == FMT_PALETTE and opts['path'].lower().endswith('.gif'):
+        data, entries = gif_palette(data)
+        return bytearray(data), fmt, entries, 1
+    data = bytearray(data)
+    width = int(opts.get('width', 0))
+    height = int(opts.get('height', 0))
+    if width == 0 and height == 0:
+        width, height = len(data) // bpp, 1
+    elif height == 0:
+        height = len(data) // (width * bpp)
+    elif width == 0:
+        width = len(data) // (height * bpp)
+    if width * height * bpp != len(data) or width > 65535 or height > 65535:
+        raise ValueError('%s: size does not match %dx%d' %
+                         (opts['path'], width, height))
+    return data, fmt, width, height
+
+
+def c_array(out, data):
+    for i in range(0, len(data), 16):
+        out.write('  ' + ' '.join('0x%02X,' % b for b in data[i:i + 16]) +
+                  '\n')
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Asset archive packer.')
+    ap.add_argument('-o', '--output', required=True,
+                    help='output base name, .c and .h are appended')
+    ap.add_argument('-s', '--symbol', help='archive symbol, default from '
+                    'the output base name')
+    ap.add_argument('assets', nargs='+', metavar='NAME=PATH[,opt=val]',
+                    help='asset, options are fmt, width, height and codec')
+    args = ap.parse_args()
+
+    base = os.path.basename(args.output)
+    symbol = args.symbol or base
+    guard = '_%s_H_' % symbol.upper()
+
+    assets = []
+    for spec in args.assets:
+        name, opts = parse_spec(spec)
+        data, fmt, width, height = load(opts)
+        codec, packed = compress(data, opts['codec'])
+        assets.append((name.upper(), opts['path'], data, fmt, width, height,
+                       codec, packed))
+
+    offset = HEADER.size + ENTRY.size * len(assets)
+    archive = bytearray(HEADER.pack(MAGIC, VERSION, len(assets)))
+    blobs = bytearray()
+    for name, path, data, fmt, width, height, codec, packed in assets:
+        archive += ENTRY.pack(offset + len(blobs), len(packed), len(data),
+                              width, height, CODECS[codec], fmt, 0)
+        blobs += packed
+        while len(blobs) % 4:
+            blobs.append(0)
+    archive += blobs
+
+    with open(args.output + '.h', 'w') as h:
+        h.write('/* Generated by assetpack.py, do not edit manually.*/\n\n')
+        h.write('#ifndef %s\n#define %s\n\n' % (guard, guard))
+        for i, a in enumerate(assets):
+            h.write('#define ASSET_%-24s %d\n' % (a[0], i))
+        h.write('\n#define %s_size %d\n' % (symbol, len(archive)))
+        h.write('extern const uint8_t %s[%d];\n\n' % (symbol, len(archive)))
+        h.write('#endif /* %s */\n' % guard)
+
+    with open(args.output + '.c', 'w') as c:
+        c.write('/* Generated by assetpack.py, do not edit manually.*/\n\n')
+        c.write('#include <stdint.h>\n\n#include "%s.h"\n\n' % base)
+        for name, path, data, fmt, width, height, codec, packed in assets:
+            c.write('/* %s: %s, %dx%d, %s %d -> %d bytes.*/\n' % (
+                name, os.path.basename(path), width, height, codec,
+                len(data), len(packed)))
+        c.write('const uint8_t %s[%d] __attribute__((aligned(4))) = {\n' %
+                (symbol, len(archive)))
+        c_array(c, archive)
+        c.write('};\n')
+
+    total = sum(len(a[2]) for a in assets)
+    sys.stderr.write('%d assets, %d -> %d bytes\n' % (len(assets), total,
+                                                      len(archive)))
+
+
+if __name__ == '__main__':
+    main()
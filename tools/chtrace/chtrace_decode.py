@@ -0,0 +1,191 @@
+#!/usr/bin/env python
+#
+# ChibiOS/RT kernel events trace decoder.
+#
+# Converts the binary stream produced by os/various/tracestream.c into a
+# Chrome Trace Event JSON timeline or a plain text listing.
+#
+
+import argparse
+import json
+import struct
+import sys
+
+(SWITCH, ISR_ENTER, ISR_LEAVE, LOCK, UNLOCK, SEM_WAIT, SEM_SIGNAL,
+ MTX_LOCK, MTX_UNLOCK, EVT_SIGNAL, EVT_BROADCAST, EVT_WAIT, MARKER,
+ LOST, NAME) = range(15)
+
+STATES = ['READY', 'CURRENT', 'SUSPENDED', 'WTSEM', 'WTMTX', 'WTCOND',
+          'SLEEPING', 'WTEXIT', 'WTOREVT', 'WTANDEVT', 'SNDMSGQ', 'SNDMSG',
+          'WTMSG', 'WTQUEUE', 'FINAL']
+
+NAMES = ['switch', 'isr_enter', 'isr_leave', 'lock', 'unlock', 'sem_wait',
+         'sem_signal', 'mtx_lock', 'mtx_unlock', 'evt_signal',
+         'evt_broadcast', 'evt_wait', 'marker', 'lost', 'name']
+
+PID = 1
+TID_THREADS = 1
+TID_ISR = 2
+TID_LOCK = 3
+TID_EVENTS = 4
+
+
+def records(data, endian):
+    """Yields (time, obj, type, info, extra) tuples from the raw stream."""
+    header = struct.Struct(endian + '4sBBHI')
+    record = struct.Struct(endian + 'IIBBH')
+    magic, version, size, _, freq = header.unpack_from(data, 0)
+    if magic != b'CHTR':
+        raise ValueError('not a trace stream')
+    if version != 1 or size != record.size:
+        raise ValueError('unsupported stream version %d' % version)
+    yield freq
+    pos = header.size
+    while pos + size <= len(data):
+        time, obj, typ, info, seq = record.unpack_from(data, pos)
+        pos += size
+        extra = None
+        if typ == NAME:
+            extra = data[pos:pos + info].decode('ascii', 'replace')
+            pos += info
+        yield time, obj, typ, info, extra
+
+
+def unwrap(events):
+    """Extends the 32 bits timestamps to 64 bits.
+
+    Names are written by the streaming thread out of band, their timestamps
+    are not in sequence with the records and are not used for unwrapping."""
+    base = 0
+    last = None
+    for time, obj, typ, info, extra in events:
+        if typ == NAME:
+            yield None, obj, typ, info, extra
+            continue
+        if last is not None and time < last and last - time > 0x80000000:
+            base += 1 << 32
+        last = time
+        yield base + time, obj, typ, info, extra
+
+
+class Timeline(object):
+
+    def __init__(self, freq):
+        self.freq = float(freq) if freq else 1.0
+        self.t0 = None
+        self.names = {}
+        self.out = []
+        self.current = None
+        self.isr_depth = 0
+        self.lock_depth = 0
+
+    def us(self, t):
+        return (t - self.t0) * 1000000.0 / self.freq
+
+    def thread_name(self, tp):
+        return self.names.get(tp, '0x%08x' % tp)
+
+    def emit(self, ph, name, t, tid, **kw):
+        ev = {'ph': ph, 'name': name, 'ts': self.us(t), 'pid': PID,
+              'tid': tid}
+        ev.update(kw)
+        self.out.append(ev)
+
+    def add(self, t, obj, typ, info, extra):
+        if typ == NAME:
+            self.names[obj] = extra
+            return
+        if self.t0 is None:
+            self.t0 = t
+        if typ == SWITCH:
+            # The info field is the state of the switched out thread.
+            state = STATES[info] if info < len(STATES) else str(info)
+            if self.current is not None:
+                self.emit('E', self.thread_name(self.current), t,
+                          TID_THREADS, args={'state': state})
+            self.current = obj
+            self.emit('B', self.thread_name(obj), t, TID_THREADS,
+                      args={'thread': '0x%08x' % obj})
+        elif typ == ISR_ENTER:
+            self.isr_depth += 1
+            self.emit('B', 'isr %d' % obj, t, TID_ISR)
+        elif typ == ISR_LEAVE:
+            if self.isr_depth > 0:
+                self.isr_depth -= 1
+                self.emit('E', 'isr %d' % obj, t, TID_ISR)
+        elif typ == LOCK:
+            self.lock_depth += 1
+            self.emit('B', 'locked', t, TID_LOCK,
+                      args={'from_isr': bool(info)})
+        elif typ == UNLOCK:
+            if self.lock_depth > 0:
+                self.lock_depth -= 1
+                self.emit('E', 'locked', t, TID_LOCK)
+        elif typ == LOST:
+            self.emit('i', 'lost', t, TID_EVENTS, s='g',
+                      args={'records': obj})
+        else:
+            args = {'object': '0x%08x' % obj, 'info': info}
+            if typ == MARKER:
+                name = 'marker %d' % info
+                args = {'value': obj}
+            else:
+                name = NAMES[typ] if typ < len(NAMES) else 'type %d' % typ
+            if self.current is not None:
+                args['thread'] = self.thread_name(self.current)
+            self.emit('i', name, t, TID_EVENTS, s='t', args=args)
+
+    def finish(self, t):
+        if self.current is not None and self.t0 is not None:
+            self.emit('E', self.thread_name(self.current), t, TID_THREADS)
+        meta = [('threads', TID_THREADS), ('isr', TID_ISR),
+                ('critical zones', TID_LOCK), ('events', TID_EVENTS)]
+        for name, tid in meta:
+            self.out.append({'ph': 'M', 'name': 'thread_name', 'pid': PID,
+                             'tid': tid, 'args': {'name': name}})
+        return {'traceEvents': self.out, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    ap = argparse.ArgumentParser(description='ChibiOS/RT trace decoder.')
+    ap.add_argument('input', help='captured binary stream')
+    ap.add_argument('-o', '--output', help='output file, default stdout')
+    ap.add_argument('--big-endian', action='store_true',
+                    help='target is big endian')
+    ap.add_argument('--text', action='store_true',
+                    help='plain text listing instead of JSON')
+    args = ap.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+    stream = records(data, '>' if args.big_endian else '<')
+    freq = next(stream)
+    out = open(args.output, 'w') if args.output else sys.stdout
+
+    if args.text:
+        t0 = None
+        for t, obj, typ, info, extra in unwrap(stream):
+            if typ == NAME:
+                out.write('%17s  %-14s 0x%08x  "%s"\n' % ('', 'name', obj,
+                                                        extra))
+                continue
+            if t0 is None:
+                t0 = t
+            name = NAMES[typ] if typ < len(NAMES) else 'type %d' % typ
+            out.write('%14.3f us  %-14s 0x%08x %3d\n' % (
+                (t - t0) * 1000000.0 / freq, name, obj, info))
+    else:
+        tl = Timeline(freq)
+        last = 0
+        for t, obj, typ, info, extra in unwrap(stream):
+            tl.add(t, obj, typ, info, extra)
+            if t is not None:
+                last = t
+        json.dump(tl.finish(last), out, indent=1)
+        out.write('\n')
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()